@@ -32,17 +32,20 @@ class Program
             description: "Build configuration (Debug or Release)");
         configOption.AddAlias("-c");
 
+        var gcOption = CreateGCOption();
+
         var compileCommand = new Command("compile", "Compile C# project to native executable")
         {
             inputOption,
             outputOption,
-            configOption
+            configOption,
+            gcOption
         };
 
-        compileCommand.SetHandler((input, output, config) =>
+        compileCommand.SetHandler((input, output, config, gc) =>
         {
-            Compile(input, output, config);
-        }, inputOption, outputOption, configOption);
+            Compile(input, output, config, gc);
+        }, inputOption, outputOption, configOption, gcOption);
 
         rootCommand.AddCommand(compileCommand);
 
@@ -62,18 +65,37 @@ class Program
             getDefaultValue: () => false,
             description: "Enable multi-assembly mode (load referenced assemblies, tree shake)");
 
+        var codegenUnitsOption = new Option<int>(
+            name: "--translation-units",
+            getDefaultValue: () => 0,
+            description: "Number of .cpp files for method implementations (0 = by generated code size)");
+
+        var codegenNoCacheOption = new Option<bool>(
+            name: "--no-cache",
+            getDefaultValue: () => false,
+            description: "Regenerate everything, ignoring the incremental cache in the output directory");
+
+        var codegenPoolAsyncOption = new Option<bool>(
+            name: "--pool-async-state-machines",
+            getDefaultValue: () => false,
+            description: "Allocate every async Task state machine from the runtime's per-thread pools");
+
+        var codegenGCOption = CreateGCOption();
+
         var codegenCommand = new Command("codegen", "Generate C++ code from C# project (without compiling)")
         {
-            codegenInputOption, codegenOutputOption, codegenConfigOption, codegenMultiOption
+            codegenInputOption, codegenOutputOption, codegenConfigOption, codegenMultiOption, codegenUnitsOption,
+            codegenNoCacheOption, codegenPoolAsyncOption, codegenGCOption
         };
 
-        codegenCommand.SetHandler((input, output, config, multi) =>
+        codegenCommand.SetHandler((input, output, config, multi, units, noCache, poolAsync, gc) =>
         {
             if (multi)
-                GenerateCppMultiAssembly(input, output, config);
+                GenerateCppMultiAssembly(input, output, config, units, !noCache, poolAsync, gc);
             else
-                GenerateCpp(input, output, config);
-        }, codegenInputOption, codegenOutputOption, codegenConfigOption, codegenMultiOption);
+                GenerateCpp(input, output, config, units, !noCache, poolAsync, gc);
+        }, codegenInputOption, codegenOutputOption, codegenConfigOption, codegenMultiOption, codegenUnitsOption,
+            codegenNoCacheOption, codegenPoolAsyncOption, codegenGCOption);
 
         rootCommand.AddCommand(codegenCommand);
 
@@ -99,6 +121,16 @@ class Program
         return await rootCommand.InvokeAsync(args);
     }
 
+    /// <summary>
+    /// --gc key=value (repeatable): GC settings compiled into the generated main().
+    /// </summary>
+    static Option<string[]> CreateGCOption() => new(
+        name: "--gc",
+        getDefaultValue: Array.Empty<string>,
+        description: "GC setting compiled into main(), repeatable: initial-heap=<size>, max-heap=<size>, " +
+            "free-space-divisor=<n>, markers=<n>, incremental=<true|false>, full-frequency=<n>. " +
+            "CIL2CPP_GC_* environment variables override them at startup");
+
     /// <summary>
     /// Build a .csproj and return the path to the output DLL.
     /// </summary>
@@ -167,7 +199,8 @@ class Program
     /// Returns null if setup fails (error already printed).
     /// </summary>
     static (FileInfo AssemblyFile, BuildConfiguration Config)? PrepareBuild(
-        FileInfo input, DirectoryInfo output, string configName)
+        FileInfo input, DirectoryInfo output, string configName, int translationUnits = 0,
+        bool poolAsyncStateMachines = false, string[]? gcSettings = null)
     {
         FileInfo assemblyFile;
         try
@@ -183,7 +216,12 @@ class Program
         BuildConfiguration config;
         try
         {
-            config = BuildConfiguration.FromName(configName);
+            config = BuildConfiguration.FromName(configName) with
+            {
+                TranslationUnits = translationUnits,
+                PoolAsyncStateMachines = poolAsyncStateMachines,
+                GC = GCSettings.Parse(gcSettings ?? Array.Empty<string>())
+            };
         }
         catch (ArgumentException ex)
         {
@@ -199,12 +237,66 @@ class Program
     {
         Console.WriteLine($"      {generatedOutput.HeaderFile.FileName}");
         Console.WriteLine($"      {generatedOutput.SourceFile.FileName}");
+        if (generatedOutput.InternalHeaderFile != null)
+            Console.WriteLine($"      {generatedOutput.InternalHeaderFile.FileName}");
+        foreach (var file in generatedOutput.MethodSourceFiles)
+            Console.WriteLine($"      {file.FileName}");
         if (generatedOutput.MainFile != null)
             Console.WriteLine($"      {generatedOutput.MainFile.FileName}");
         if (generatedOutput.CMakeFile != null)
             Console.WriteLine($"      {generatedOutput.CMakeFile.FileName}");
     }
 
+    /// <summary>
+    /// Load the incremental cache of the output directory (null when caching is disabled).
+    /// UpToDate means the inputs match the previous run and there is nothing to generate.
+    /// </summary>
+    static (CodeGenCache? Cache, string Fingerprint, bool UpToDate) OpenCache(
+        FileInfo assemblyFile, DirectoryInfo output, BuildConfiguration config, string mode, bool useCache)
+    {
+        if (!useCache) return (null, "", false);
+
+        var cache = CodeGenCache.Load(output.FullName);
+        var fingerprint = CodeGenCache.FingerprintInputs(assemblyFile.FullName, config, mode);
+        if (cache.IsUpToDate(fingerprint, output.FullName))
+        {
+            Console.WriteLine("Inputs unchanged since the last run - generated code is up to date.");
+            return (null, fingerprint, true);
+        }
+        return (cache, fingerprint, false);
+    }
+
+    static void WriteOutput(GeneratedOutput generatedOutput, DirectoryInfo output, CodeGenCache? cache, string fingerprint)
+    {
+        var written = generatedOutput.WriteToDirectory(output.FullName);
+        PrintGeneratedFiles(generatedOutput);
+        Console.WriteLine($"      {written} of {generatedOutput.AllFiles.Count()} files changed");
+        if (cache == null) return;
+
+        cache.Update(fingerprint, generatedOutput, output.FullName);
+        cache.Save(output.FullName);
+        Console.WriteLine($"      Cache: {cache.MethodHits} method bodies reused, {cache.MethodMisses} generated");
+    }
+
+    static void PrintOptimizationReport(IRModule module)
+    {
+        var inlined = module.GetAllMethods().Where(m => m.InlinedCalls.Count > 0).ToList();
+        if (inlined.Count > 0)
+        {
+            Console.WriteLine($"      Inlining: {inlined.Sum(m => m.InlinedCalls.Count)} call site(s) inlined in {inlined.Count} method(s)");
+            foreach (var method in inlined)
+                Console.WriteLine($"        {method.DeclaringType?.ILFullName}::{method.Name}: {string.Join(", ", method.InlinedCalls)}");
+        }
+
+        var stackAllocating = module.GetAllMethods().Where(m => m.StackObjects.Count > 0).ToList();
+        if (stackAllocating.Count > 0)
+        {
+            Console.WriteLine($"      Escape analysis: {stackAllocating.Sum(m => m.StackObjects.Count)} allocation(s) moved to the stack in {stackAllocating.Count} method(s)");
+            foreach (var method in stackAllocating)
+                Console.WriteLine($"        {method.DeclaringType?.ILFullName}::{method.Name}: {method.StackObjects.Count}");
+        }
+    }
+
     static void PrintBanner(FileInfo assemblyFile, DirectoryInfo output, BuildConfiguration config, string? modeSuffix = null)
     {
         var version = typeof(Program).Assembly.GetName().Version;
@@ -216,14 +308,18 @@ class Program
         Console.WriteLine();
     }
 
-    static void GenerateCpp(FileInfo input, DirectoryInfo output, string configName = "Release")
+    static void GenerateCpp(FileInfo input, DirectoryInfo output, string configName = "Release",
+        int translationUnits = 0, bool useCache = true, bool poolAsyncStateMachines = false,
+        string[]? gcSettings = null)
     {
-        var prepared = PrepareBuild(input, output, configName);
+        var prepared = PrepareBuild(input, output, configName, translationUnits, poolAsyncStateMachines, gcSettings);
         if (prepared is not var (assemblyFile, config)) return;
 
         try
         {
             PrintBanner(assemblyFile, output, config);
+            var (cache, fingerprint, upToDate) = OpenCache(assemblyFile, output, config, "single-assembly", useCache);
+            if (upToDate) return;
 
             Console.WriteLine("[1/3] Reading assembly...");
             using var reader = new AssemblyReader(assemblyFile.FullName, config);
@@ -236,16 +332,16 @@ class Program
             var builder = new IRBuilder(reader, config);
             var module = builder.Build();
             Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
+            PrintOptimizationReport(module);
             if (module.EntryPoint != null)
                 Console.WriteLine($"      Entry point: {module.EntryPoint.DeclaringType?.ILFullName}.{module.EntryPoint.Name}");
             else
                 Console.WriteLine("      No entry point - generating static library");
 
             Console.WriteLine("[3/3] Generating C++ code...");
-            var generator = new CppCodeGenerator(module, config);
+            var generator = new CppCodeGenerator(module, config, cache);
             var generatedOutput = generator.Generate();
-            generatedOutput.WriteToDirectory(output.FullName);
-            PrintGeneratedFiles(generatedOutput);
+            WriteOutput(generatedOutput, output, cache, fingerprint);
 
             Console.WriteLine();
             var outputType = module.EntryPoint != null ? "executable" : "static library";
@@ -258,14 +354,18 @@ class Program
         }
     }
 
-    static void GenerateCppMultiAssembly(FileInfo input, DirectoryInfo output, string configName = "Release")
+    static void GenerateCppMultiAssembly(FileInfo input, DirectoryInfo output, string configName = "Release",
+        int translationUnits = 0, bool useCache = true, bool poolAsyncStateMachines = false,
+        string[]? gcSettings = null)
     {
-        var prepared = PrepareBuild(input, output, configName);
+        var prepared = PrepareBuild(input, output, configName, translationUnits, poolAsyncStateMachines, gcSettings);
         if (prepared is not var (assemblyFile, config)) return;
 
         try
         {
             PrintBanner(assemblyFile, output, config, "multi-assembly mode");
+            var (cache, fingerprint, upToDate) = OpenCache(assemblyFile, output, config, "multi-assembly", useCache);
+            if (upToDate) return;
 
             Console.WriteLine("[1/4] Loading assembly set...");
             using var assemblySet = new AssemblySet(assemblyFile.FullName, config);
@@ -283,16 +383,16 @@ class Program
             var builder = new IRBuilder(reader, config);
             var module = builder.Build(assemblySet, reachability);
             Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
+            PrintOptimizationReport(module);
             if (module.EntryPoint != null)
                 Console.WriteLine($"      Entry point: {module.EntryPoint.DeclaringType?.ILFullName}.{module.EntryPoint.Name}");
             else
                 Console.WriteLine("      No entry point - generating static library");
 
             Console.WriteLine("[4/4] Generating C++ code...");
-            var generator = new CppCodeGenerator(module, config);
+            var generator = new CppCodeGenerator(module, config, cache);
             var generatedOutput = generator.Generate();
-            generatedOutput.WriteToDirectory(output.FullName);
-            PrintGeneratedFiles(generatedOutput);
+            WriteOutput(generatedOutput, output, cache, fingerprint);
 
             Console.WriteLine();
             var outputType = module.EntryPoint != null ? "executable" : "static library";
@@ -305,7 +405,8 @@ class Program
         }
     }
 
-    static void Compile(FileInfo input, DirectoryInfo output, string configName = "Release")
+    static void Compile(FileInfo input, DirectoryInfo output, string configName = "Release",
+        string[]? gcSettings = null)
     {
         FileInfo assemblyFile;
         try
@@ -321,7 +422,7 @@ class Program
         BuildConfiguration config;
         try
         {
-            config = BuildConfiguration.FromName(configName);
+            config = BuildConfiguration.FromName(configName) with { GC = GCSettings.Parse(gcSettings ?? Array.Empty<string>()) };
         }
         catch (ArgumentException ex)
         {
@@ -355,6 +456,7 @@ class Program
             var builder = new IRBuilder(reader, config);
             var module = builder.Build();
             Console.WriteLine($"      {module.Types.Count} types, {module.GetAllMethods().Count()} methods");
+            PrintOptimizationReport(module);
 
             // Step 3: Generate C++
             Console.WriteLine("[3/4] Generating C++ code...");
@@ -20,6 +20,27 @@ public record BuildConfiguration
     /// <summary>Read debug symbols (PDB/MDB) from the input assembly.</summary>
     public bool ReadDebugSymbols { get; init; }
 
+    /// <summary>Inline small managed methods at their call sites (MethodInliner).</summary>
+    public bool EnableInlining { get; init; }
+
+    /// <summary>Construct objects that never leave their method in stack storage (EscapeAnalysis).</summary>
+    public bool EnableEscapeAnalysis { get; init; }
+
+    /// <summary>
+    /// Number of .cpp files the method implementations are split across
+    /// (0 = one per CppCodeGenerator.TranslationUnitTargetSize of generated code).
+    /// </summary>
+    public int TranslationUnits { get; init; }
+
+    /// <summary>
+    /// Box the state machines of all async Task methods from the runtime's per-thread
+    /// pools (otherwise only methods marked [PoolAsyncStateMachine] are pooled).
+    /// </summary>
+    public bool PoolAsyncStateMachines { get; init; }
+
+    /// <summary>GC settings compiled into the generated main() (see <see cref="GCSettings"/>).</summary>
+    public GCSettings GC { get; init; } = new();
+
     /// <summary>Configuration name for CMake (Debug or Release).</summary>
     public string ConfigurationName => IsDebug ? "Debug" : "Release";
 
@@ -31,6 +52,8 @@ public record BuildConfiguration
         EmitILOffsetComments = true,
         EnableStackTraces = true,
         ReadDebugSymbols = true,
+        EnableInlining = false,
+        EnableEscapeAnalysis = false,
     };
 
     /// <summary>Pre-configured Release build settings.</summary>
@@ -41,6 +64,8 @@ public record BuildConfiguration
         EmitILOffsetComments = false,
         EnableStackTraces = false,
         ReadDebugSymbols = false,
+        EnableInlining = true,
+        EnableEscapeAnalysis = true,
     };
 
     /// <summary>Create configuration from a string name.</summary>
@@ -0,0 +1,140 @@
+using System.Security.Cryptography;
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+using CIL2CPP.Core.IL;
+
+namespace CIL2CPP.Core.CodeGen;
+
+/// <summary>
+/// Persistent state of the previous code generation run in an output directory
+/// ({output}/.cil2cpp_cache.json), used to make repeated runs incremental:
+///   - the input fingerprint (assemblies, configuration, compiler build) lets the
+///     CLI skip the whole pipeline when nothing changed;
+///   - generated method bodies are reused when the method's fingerprint matches;
+///   - the translation unit boundaries are kept so an edit only changes the
+///     .cpp file that holds the edited method.
+/// GeneratedOutput.WriteToDirectory only rewrites files whose content changed,
+/// so the native build recompiles just those.
+/// </summary>
+public class CodeGenCache
+{
+    public const string FileName = ".cil2cpp_cache.json";
+
+    /// <summary>Bumped whenever the cache layout or its invalidation rules change.</summary>
+    private const int FormatVersion = 1;
+
+    public int Version { get; set; } = FormatVersion;
+
+    /// <summary>Fingerprint of everything the generated code depends on (see <see cref="FingerprintInputs"/>).</summary>
+    public string InputFingerprint { get; set; } = "";
+
+    /// <summary>Generated method bodies keyed by C++ signature.</summary>
+    public Dictionary<string, CachedMethod> Methods { get; set; } = new();
+
+    /// <summary>C++ signature of the first method in each {Module}_methods_N.cpp.</summary>
+    public List<string> PartitionStarts { get; set; } = new();
+
+    /// <summary>Content hashes of the files written by the previous run, by file name.</summary>
+    public Dictionary<string, string> OutputFiles { get; set; } = new();
+
+    /// <summary>Method bodies reused from the cache in the current run.</summary>
+    [JsonIgnore]
+    public int MethodHits { get; set; }
+
+    /// <summary>Method bodies generated in the current run.</summary>
+    [JsonIgnore]
+    public int MethodMisses { get; set; }
+
+    public class CachedMethod
+    {
+        public string Fingerprint { get; set; } = "";
+        public string Code { get; set; } = "";
+    }
+
+    /// <summary>
+    /// Load the cache from an output directory. Returns an empty cache when the
+    /// file is missing, unreadable or from another cache format version.
+    /// </summary>
+    public static CodeGenCache Load(string outputDir)
+    {
+        var path = Path.Combine(outputDir, FileName);
+        if (!File.Exists(path)) return new CodeGenCache();
+        try
+        {
+            var cache = JsonSerializer.Deserialize<CodeGenCache>(File.ReadAllText(path));
+            if (cache != null && cache.Version == FormatVersion)
+                return cache;
+        }
+        catch (Exception ex) when (ex is JsonException or IOException)
+        {
+            // Corrupt or locked cache file: start over
+        }
+        return new CodeGenCache();
+    }
+
+    public void Save(string outputDir)
+    {
+        Directory.CreateDirectory(outputDir);
+        File.WriteAllText(Path.Combine(outputDir, FileName), JsonSerializer.Serialize(this));
+    }
+
+    /// <summary>
+    /// True when the previous run used the same inputs and its output files are still
+    /// there, unmodified.
+    /// </summary>
+    public bool IsUpToDate(string inputFingerprint, string outputDir) =>
+        InputFingerprint == inputFingerprint
+        && OutputFiles.Count > 0
+        && OutputFiles.All(f =>
+        {
+            var path = Path.Combine(outputDir, f.Key);
+            return File.Exists(path) && Hash(File.ReadAllText(path)) == f.Value;
+        });
+
+    /// <summary>
+    /// Record the outcome of a generation run and delete the files the previous run
+    /// wrote that this one no longer produces (e.g. after the method code shrank to
+    /// fewer translation units).
+    /// </summary>
+    public void Update(string inputFingerprint, GeneratedOutput output, string outputDir)
+    {
+        var files = output.AllFiles.ToDictionary(f => f.FileName, f => Hash(f.Content));
+        foreach (var stale in OutputFiles.Keys.Where(f => !files.ContainsKey(f)))
+        {
+            var path = Path.Combine(outputDir, stale);
+            if (File.Exists(path)) File.Delete(path);
+        }
+        InputFingerprint = inputFingerprint;
+        OutputFiles = files;
+    }
+
+    /// <summary>
+    /// Fingerprint the inputs of a run: the assemblies and symbol/deps files next to
+    /// the root assembly, the BCL directory they resolve against, the build
+    /// configuration, the code generation mode and the compiler build itself.
+    /// </summary>
+    public static string FingerprintInputs(string rootAssemblyPath, BuildConfiguration config, string mode)
+    {
+        var sb = new StringBuilder();
+        sb.AppendLine($"format {FormatVersion}");
+        sb.AppendLine($"compiler {typeof(CodeGenCache).Assembly.ManifestModule.ModuleVersionId}");
+        sb.AppendLine($"config {config}");
+        sb.AppendLine($"mode {mode}");
+        sb.AppendLine($"runtime {RuntimeLocator.FindRuntimeDirectory(rootAssemblyPath)}");
+
+        var dir = Path.GetDirectoryName(Path.GetFullPath(rootAssemblyPath))!;
+        var inputs = Directory.EnumerateFiles(dir)
+            .Where(f => f.EndsWith(".dll", StringComparison.OrdinalIgnoreCase)
+                || f.EndsWith(".pdb", StringComparison.OrdinalIgnoreCase)
+                || f.EndsWith(".json", StringComparison.OrdinalIgnoreCase))
+            .OrderBy(f => f, StringComparer.Ordinal);
+        foreach (var file in inputs)
+            sb.AppendLine($"{Path.GetFileName(file)} {Convert.ToHexString(SHA256.HashData(File.ReadAllBytes(file)))}");
+
+        return Hash(sb.ToString());
+    }
+
+    internal static string Hash(string text) =>
+        Convert.ToHexString(SHA256.HashData(Encoding.UTF8.GetBytes(text)));
+}
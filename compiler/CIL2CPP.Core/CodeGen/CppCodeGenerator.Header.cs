@@ -186,21 +186,26 @@ public partial class CppCodeGenerator
         foreach (var type in userTypes)
         {
             if (type.IsEnum || type.IsDelegate || type.IsRuntimeProvided) continue;
-            if (type.StaticFields.Count > 0)
+            if (type.StaticFields.Any(f => !f.IsThreadStatic))
             {
                 sb.AppendLine($"// Static fields for {type.ILFullName}");
                 sb.AppendLine($"struct {type.CppName}_Statics {{");
-                var emittedStaticFields = new HashSet<string>();
-                foreach (var field in type.StaticFields)
-                {
-                    if (!emittedStaticFields.Add(field.CppName)) continue; // Deduplicate
-                    var cppType = SanitizeFieldType(field.FieldTypeName, definedTypeNames);
-                    sb.AppendLine($"    {cppType} {field.CppName};");
-                }
+                EmitStaticFieldMembers(sb, type.StaticFields.Where(f => !f.IsThreadStatic), definedTypeNames);
                 sb.AppendLine("};");
                 sb.AppendLine($"extern {type.CppName}_Statics {type.CppName}_statics;");
                 sb.AppendLine();
             }
+            if (type.StaticFields.Any(f => f.IsThreadStatic))
+            {
+                // [ThreadStatic]: one zero-initialized copy per thread, registered as a
+                // GC root on each thread by a static initializer in the source file
+                sb.AppendLine($"// Thread-static fields for {type.ILFullName}");
+                sb.AppendLine($"struct {type.CppName}_ThreadStatics {{");
+                EmitStaticFieldMembers(sb, type.StaticFields.Where(f => f.IsThreadStatic), definedTypeNames);
+                sb.AppendLine("};");
+                sb.AppendLine($"extern thread_local constinit {type.CppName}_ThreadStatics {type.CppName}_thread_statics;");
+                sb.AppendLine();
+            }
         }
 
         // Build set of all known C++ type names (defined + forward-declared + stubs)
@@ -393,6 +398,24 @@ public partial class CppCodeGenerator
         }
     }
 
+    private void EmitStaticFieldMembers(StringBuilder sb, IEnumerable<IRField> fields, HashSet<string> definedTypeNames)
+    {
+        var emitted = new HashSet<string>();
+        foreach (var field in fields)
+        {
+            if (!emitted.Add(field.CppName)) continue; // Deduplicate
+            var cppType = SanitizeFieldType(field.FieldTypeName, definedTypeNames);
+            sb.AppendLine($"    {cppType} {field.CppName};");
+        }
+    }
+
+    /// <summary>Types with [ThreadStatic] fields, which get a thread_local statics block.</summary>
+    private IEnumerable<IRType> ThreadStaticTypes(IEnumerable<IRType> types) =>
+        types.Where(t => !t.IsEnum && !t.IsDelegate && !t.IsRuntimeProvided
+            && t.StaticFields.Any(f => f.IsThreadStatic)
+            && !CppNameMapper.IsCompilerGeneratedType(t.ILFullName) && !HasUnresolvedGenericParams(t))
+            .DistinctBy(t => t.CppName);
+
     private static void CheckFieldForStub(string fieldTypeName, HashSet<string> definedTypes, HashSet<string> stubs)
     {
         var cppType = CppNameMapper.GetCppTypeForDecl(fieldTypeName);
@@ -559,6 +582,18 @@ public partial class CppCodeGenerator
         yield return ("System_Threading_CancellationTokenSource", "cil2cpp::CancellationTokenSource");
         yield return ("System_Threading_CancellationToken", "cil2cpp::CancellationToken");
 
+        // StringBuilder — runtime-provided chunked buffer
+        yield return ("System_Text_StringBuilder", "cil2cpp::StringBuilder");
+
+        // Parallel.For/ForEach options and result
+        yield return ("System_Threading_Tasks_ParallelOptions", "cil2cpp::ParallelOptions");
+        yield return ("System_Threading_Tasks_ParallelLoopResult", "cil2cpp::ParallelLoopResult");
+
+        // SemaphoreSlim / ManualResetEventSlim / ReaderWriterLockSlim — runtime-provided
+        yield return ("System_Threading_SemaphoreSlim", "cil2cpp::SemaphoreSlim");
+        yield return ("System_Threading_ManualResetEventSlim", "cil2cpp::ManualResetEventSlim");
+        yield return ("System_Threading_ReaderWriterLockSlim", "cil2cpp::ReaderWriterLockSlim");
+
         // Exception hierarchy — all map to runtime C++ exception types
         yield return ("System_Exception", "cil2cpp::Exception");
         yield return ("System_NullReferenceException", "cil2cpp::NullReferenceException");
@@ -583,6 +618,10 @@ public partial class CppCodeGenerator
         yield return ("System_AggregateException", "cil2cpp::AggregateException");
         yield return ("System_OperationCanceledException", "cil2cpp::OperationCanceledException");
         yield return ("System_Threading_Tasks_TaskCanceledException", "cil2cpp::TaskCanceledException");
+        yield return ("System_Threading_Channels_ChannelClosedException", "cil2cpp::ChannelClosedException");
+        yield return ("System_Threading_SemaphoreFullException", "cil2cpp::SemaphoreFullException");
+        yield return ("System_Threading_SynchronizationLockException", "cil2cpp::SynchronizationLockException");
+        yield return ("System_Threading_LockRecursionException", "cil2cpp::LockRecursionException");
         yield return ("System_Collections_Generic_KeyNotFoundException", "cil2cpp::KeyNotFoundException");
     }
 
@@ -616,6 +655,10 @@ public partial class CppCodeGenerator
         yield return ("System_AggregateException", "cil2cpp::AggregateException_TypeInfo");
         yield return ("System_OperationCanceledException", "cil2cpp::OperationCanceledException_TypeInfo");
         yield return ("System_Threading_Tasks_TaskCanceledException", "cil2cpp::TaskCanceledException_TypeInfo");
+        yield return ("System_Threading_Channels_ChannelClosedException", "cil2cpp::ChannelClosedException_TypeInfo");
+        yield return ("System_Threading_SemaphoreFullException", "cil2cpp::SemaphoreFullException_TypeInfo");
+        yield return ("System_Threading_SynchronizationLockException", "cil2cpp::SynchronizationLockException_TypeInfo");
+        yield return ("System_Threading_LockRecursionException", "cil2cpp::LockRecursionException_TypeInfo");
         yield return ("System_Collections_Generic_KeyNotFoundException", "cil2cpp::KeyNotFoundException_TypeInfo");
     }
 
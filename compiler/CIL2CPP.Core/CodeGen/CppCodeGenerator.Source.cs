@@ -1,4 +1,5 @@
 using System.Text;
+using System.Text.RegularExpressions;
 using CIL2CPP.Core.IL;
 using CIL2CPP.Core.IR;
 
@@ -6,8 +7,35 @@ namespace CIL2CPP.Core.CodeGen;
 
 public partial class CppCodeGenerator
 {
-    private GeneratedFile GenerateSource()
+    /// <summary>
+    /// Standard headers the generated method bodies rely on.
+    /// </summary>
+    private static readonly string[] SourceStandardHeaders =
+        ["cstdio", "cmath", "cstring", "algorithm", "limits", "atomic"];
+
+    /// <summary>
+    /// Generate {Module}.cpp. When the method implementations are split across
+    /// several translation units (see <see cref="CountTranslationUnits"/>), {Module}.cpp
+    /// keeps the module-wide data (literals, statics, cctor guards) and each type's
+    /// methods, vtables, reflection metadata and TypeInfo go to one of the
+    /// {Module}_methods_N.cpp files, which share {Module}_internal.h.
+    /// </summary>
+    private void GenerateSource(GeneratedOutput output)
     {
+        // Filter out compiler-generated types, open generic types, and deduplicate by CppName
+        var seenTypeNames = new HashSet<string>();
+        var userTypes = _module.Types
+            .Where(t => !CppNameMapper.IsCompilerGeneratedType(t.ILFullName))
+            .Where(t => !HasUnresolvedGenericParams(t))
+            .Where(t => seenTypeNames.Add(t.CppName)) // Deduplicate by CppName
+            .ToList();
+
+        var methodCode = GenerateMethodImplementations(userTypes);
+        int units = CountTranslationUnits(methodCode);
+        bool split = units > 1;
+        // File-scope data referenced from method bodies needs external linkage when split
+        var linkage = split ? "" : "static ";
+
         var sb = new StringBuilder();
 
         sb.AppendLine("// Generated by CIL2CPP - DO NOT EDIT");
@@ -17,14 +45,17 @@ public partial class CppCodeGenerator
             sb.AppendLine("// DEBUG BUILD - contains #line directives and IL offset comments");
         }
         sb.AppendLine();
-        sb.AppendLine($"#include \"{_module.Name}.h\"");
-        sb.AppendLine();
-        sb.AppendLine("#include <cstdio>");
-        sb.AppendLine("#include <cmath>");
-        sb.AppendLine("#include <cstring>");
-        sb.AppendLine("#include <algorithm>");
-        sb.AppendLine("#include <limits>");
-        sb.AppendLine("#include <atomic>");
+        if (split)
+        {
+            sb.AppendLine($"#include \"{InternalHeaderName}\"");
+        }
+        else
+        {
+            sb.AppendLine($"#include \"{_module.Name}.h\"");
+            sb.AppendLine();
+            foreach (var header in SourceStandardHeaders)
+                sb.AppendLine($"#include <{header}>");
+        }
         sb.AppendLine();
 
         // String literals
@@ -35,7 +66,7 @@ public partial class CppCodeGenerator
             {
                 // Escape string for C++
                 var escaped = EscapeString(value);
-                sb.AppendLine($"static cil2cpp::String* {literal.Id} = nullptr;");
+                sb.AppendLine($"{linkage}cil2cpp::String* {literal.Id} = nullptr;");
             }
             sb.AppendLine();
 
@@ -56,33 +87,47 @@ public partial class CppCodeGenerator
             foreach (var blob in _module.ArrayInitDataBlobs)
             {
                 var bytes = string.Join(", ", blob.Data.Select(b => $"0x{b:X2}"));
-                sb.AppendLine($"static const unsigned char {blob.Id}[] = {{ {bytes} }};");
+                // const namespace-scope data is internal unless declared extern
+                sb.AppendLine($"{(split ? "extern " : "static ")}const unsigned char {blob.Id}[] = {{ {bytes} }};");
             }
             sb.AppendLine();
         }
 
-        // Filter out compiler-generated types, open generic types, and deduplicate by CppName
-        var seenTypeNames = new HashSet<string>();
-        var userTypes = _module.Types
-            .Where(t => !CppNameMapper.IsCompilerGeneratedType(t.ILFullName))
-            .Where(t => !HasUnresolvedGenericParams(t))
-            .Where(t => seenTypeNames.Add(t.CppName)) // Deduplicate by CppName
-            .ToList();
-
         // Static field storage (skip runtime-provided types)
         foreach (var type in userTypes)
         {
             if (type.IsEnum || type.IsDelegate || type.IsRuntimeProvided) continue;
-            if (type.StaticFields.Count > 0)
+            if (type.StaticFields.Any(f => !f.IsThreadStatic))
             {
                 sb.AppendLine($"{type.CppName}_Statics {type.CppName}_statics = {{}};");
             }
+            if (type.StaticFields.Any(f => f.IsThreadStatic))
+            {
+                sb.AppendLine($"thread_local constinit {type.CppName}_ThreadStatics {type.CppName}_thread_statics = {{}};");
+            }
         }
         if (userTypes.Any(t => !t.IsEnum && !t.IsDelegate && !t.IsRuntimeProvided && t.StaticFields.Count > 0))
         {
             sb.AppendLine();
         }
 
+        // Every thread's copy of each thread-static block is a GC root. Registered from a
+        // static initializer (like the runtime's ThreadLocal table) so that library
+        // outputs, which have no generated main(), are covered too.
+        var threadStaticTypes = ThreadStaticTypes(userTypes).ToList();
+        if (threadStaticTypes.Count > 0)
+        {
+            sb.AppendLine("static const bool __thread_statics_rooted = (");
+            foreach (var type in threadStaticTypes)
+            {
+                sb.AppendLine("    cil2cpp::gc::register_thread_static_block(" +
+                    $"[] {{ return static_cast<void*>(&{type.CppName}_thread_statics); }}, " +
+                    $"sizeof({type.CppName}_ThreadStatics)),");
+            }
+            sb.AppendLine("    true);");
+            sb.AppendLine();
+        }
+
         // Primitive type TypeInfo definitions (for array element types)
         // Runtime-provided reference types get aliases to runtime TypeInfo instead of new definitions.
         if (_module.PrimitiveTypeInfos.Count > 0)
@@ -138,7 +183,7 @@ public partial class CppCodeGenerator
         // (In multi-assembly mode they're defined by PrimitiveTypeInfos; in single-assembly mode we alias)
         var needsObjectAlias = !_module.PrimitiveTypeInfos.Values.Any(e => e.ILFullName == "System.Object");
         var needsStringAlias = !_module.PrimitiveTypeInfos.Values.Any(e => e.ILFullName == "System.String");
-        if (needsObjectAlias || needsStringAlias)
+        if (!split && (needsObjectAlias || needsStringAlias))
         {
             sb.AppendLine("// ===== Runtime TypeInfo Aliases =====");
             if (needsObjectAlias)
@@ -153,7 +198,7 @@ public partial class CppCodeGenerator
         sb.AppendLine("// ===== Runtime Base Type TypeInfo Stubs =====");
         foreach (var (mangledName, ilName) in GetRuntimeBaseTypeInfoStubs())
         {
-            sb.AppendLine($"static cil2cpp::TypeInfo {mangledName}_TypeInfo = {{ " +
+            sb.AppendLine($"{linkage}cil2cpp::TypeInfo {mangledName}_TypeInfo = {{ " +
                 $".name = \"{ilName.Split('.').Last()}\", " +
                 $".namespace_name = \"{string.Join(".", ilName.Split('.').SkipLast(1))}\", " +
                 $".full_name = \"{ilName}\", " +
@@ -161,32 +206,114 @@ public partial class CppCodeGenerator
         }
         sb.AppendLine();
 
-        // VTable data
-        EmitVTableData(sb, userTypes);
+        // Per-type data (moves to the method translation units when split)
+        var emittedTypeInfo = CollectPredefinedTypeInfos();
+        if (!split)
+            EmitTypeData(sb, userTypes, emittedTypeInfo);
 
-        // Interface data
-        EmitInterfaceData(sb, userTypes);
+        // Static constructor guards (skip runtime-provided types)
+        foreach (var type in userTypes)
+        {
+            if (type.IsRuntimeProvided) continue;
+            if (type.HasCctor)
+            {
+                var cctorMethod = type.Methods.FirstOrDefault(m => m.IsStaticConstructor);
+                if (cctorMethod != null)
+                {
+                    sb.AppendLine($"static bool {type.CppName}_cctor_called = false;");
+                    sb.AppendLine($"void {type.CppName}_ensure_cctor() {{");
+                    sb.AppendLine($"    if (!{type.CppName}_cctor_called) {{");
+                    sb.AppendLine($"        {type.CppName}_cctor_called = true;");
+                    sb.AppendLine($"        {cctorMethod.CppName}();");
+                    sb.AppendLine($"    }}");
+                    sb.AppendLine($"}}");
+                    sb.AppendLine();
+                }
+            }
+        }
 
-        // Finalizer wrappers
-        EmitFinalizerWrappers(sb, userTypes);
+        // P/Invoke extern declarations and wrappers
+        EmitPInvokeDeclarations(sb, userTypes);
 
-        // Reflection metadata (FieldInfo/MethodInfo arrays)
-        EmitReflectionMetadata(sb, userTypes);
+        if (!split)
+        {
+            sb.AppendLine("// ===== Method Implementations =====");
+            foreach (var (_, _, code) in methodCode)
+                sb.Append(code);
+        }
 
-        // Generic variance data arrays (for variance-aware type checking)
-        EmitGenericVarianceData(sb, userTypes);
+        output.SourceFile = new GeneratedFile
+        {
+            FileName = $"{_module.Name}.cpp",
+            Content = sb.ToString()
+        };
+        if (!split) return;
+
+        output.InternalHeaderFile = GenerateInternalHeader(needsObjectAlias, needsStringAlias);
+        var parts = PartitionMethods(methodCode, units);
+
+        // Each type's data goes with its methods (types without methods follow the
+        // preceding type). Parts are contiguous, so TypeInfo order is unchanged.
+        var partOfType = new Dictionary<IRType, int>();
+        for (int i = 0; i < parts.Count; i++)
+            foreach (var (type, _, _) in parts[i])
+                partOfType.TryAdd(type, i);
+        var typeParts = parts.Select(_ => new List<IRType>()).ToList();
+        int current = 0;
+        foreach (var type in userTypes)
+        {
+            if (partOfType.TryGetValue(type, out var part)) current = part;
+            typeParts[current].Add(type);
+        }
 
-        // Type info definitions (skip runtime-provided types — already defined in runtime)
-        sb.AppendLine("// ===== Type Info =====");
+        for (int i = 0; i < parts.Count; i++)
+            output.MethodSourceFiles.Add(GenerateMethodSource(i, parts.Count, typeParts[i], parts[i], emittedTypeInfo));
+    }
+
+    /// <summary>
+    /// TypeInfos defined outside the per-type data: primitives, exception aliases
+    /// and runtime base type stubs.
+    /// </summary>
+    private HashSet<string> CollectPredefinedTypeInfos()
+    {
         var emittedTypeInfo = new HashSet<string>();
-        // Collect types that already have TypeInfo definitions (primitives, exceptions, base type stubs)
         foreach (var entry in _module.PrimitiveTypeInfos.Values)
             emittedTypeInfo.Add(entry.CppMangledName);
         foreach (var (mangledName, _) in GetExceptionTypeInfoAliases())
             emittedTypeInfo.Add(mangledName);
         foreach (var (mangledName, _) in GetRuntimeBaseTypeInfoStubs())
             emittedTypeInfo.Add(mangledName);
-        foreach (var type in userTypes)
+        return emittedTypeInfo;
+    }
+
+    /// <summary>
+    /// Per-type data: vtables, interface tables, finalizer wrappers, equality thunks,
+    /// reflection metadata, variance data and the TypeInfo definitions. Everything but
+    /// the TypeInfos is file-static, so a type's data can live in any translation unit.
+    /// </summary>
+    private void EmitTypeData(StringBuilder sb, List<IRType> types, HashSet<string> emittedTypeInfo)
+    {
+        // VTable data
+        EmitVTableData(sb, types);
+
+        // Interface data
+        EmitInterfaceData(sb, types);
+
+        // Finalizer wrappers
+        EmitFinalizerWrappers(sb, types);
+
+        // Unboxed Equals/GetHashCode thunks for value types
+        EmitValueEqualityThunks(sb, types);
+
+        // Reflection metadata (FieldInfo/MethodInfo arrays)
+        EmitReflectionMetadata(sb, types);
+
+        // Generic variance data arrays (for variance-aware type checking)
+        EmitGenericVarianceData(sb, types);
+
+        // Type info definitions
+        sb.AppendLine("// ===== Type Info =====");
+        foreach (var type in types)
         {
             if (emittedTypeInfo.Contains(type.CppName)) continue;
             if (!IsValidCppIdentifier(type.CppName)) continue;
@@ -205,31 +332,15 @@ public partial class CppCodeGenerator
             GenerateTypeInfo(sb, type);
         }
         sb.AppendLine();
+    }
 
-        // Static constructor guards (skip runtime-provided types)
-        foreach (var type in userTypes)
-        {
-            if (type.IsRuntimeProvided) continue;
-            if (type.HasCctor)
-            {
-                var cctorMethod = type.Methods.FirstOrDefault(m => m.IsStaticConstructor);
-                if (cctorMethod != null)
-                {
-                    sb.AppendLine($"static bool {type.CppName}_cctor_called = false;");
-                    sb.AppendLine($"void {type.CppName}_ensure_cctor() {{");
-                    sb.AppendLine($"    if (!{type.CppName}_cctor_called) {{");
-                    sb.AppendLine($"        {type.CppName}_cctor_called = true;");
-                    sb.AppendLine($"        {cctorMethod.CppName}();");
-                    sb.AppendLine($"    }}");
-                    sb.AppendLine($"}}");
-                    sb.AppendLine();
-                }
-            }
-        }
-
-        // P/Invoke extern declarations and wrappers
-        EmitPInvokeDeclarations(sb, userTypes);
-
+    /// <summary>
+    /// Emit every method body (one entry per method), in type declaration order.
+    /// Skips runtime-provided types and InternalCall methods. Bodies whose
+    /// <see cref="FingerprintMethod"/> matches the cache are reused.
+    /// </summary>
+    private List<(IRType Type, string Signature, string Code)> GenerateMethodImplementations(List<IRType> userTypes)
+    {
         // Build known type set (includes all defined types, aliases, enums, forward-declared)
         var knownTypeNames = new HashSet<string>();
         foreach (var t in userTypes)
@@ -239,9 +350,35 @@ public partial class CppCodeGenerator
         foreach (var (mangled, _) in GetRuntimeProvidedTypeAliases())
             knownTypeNames.Add(mangled);
 
-        // Method implementations (skip runtime-provided types and InternalCall methods)
-        sb.AppendLine("// ===== Method Implementations =====");
+        var methodCode = new List<(IRType Type, string Signature, string Code)>();
         var emittedMethodSignatures = new HashSet<string>();
+        var cachedMethods = new Dictionary<string, CodeGenCache.CachedMethod>();
+        void Emit(IRType type, IRMethod method, bool stub)
+        {
+            var signature = method.GetCppSignature();
+            string code;
+            if (_cache == null)
+            {
+                code = GenerateMethodCode(method, stub);
+            }
+            else
+            {
+                var fingerprint = FingerprintMethod(method, stub);
+                if (_cache.Methods.TryGetValue(signature, out var cached) && cached.Fingerprint == fingerprint)
+                {
+                    code = cached.Code;
+                    _cache.MethodHits++;
+                }
+                else
+                {
+                    code = GenerateMethodCode(method, stub);
+                    _cache.MethodMisses++;
+                }
+                cachedMethods[signature] = new CodeGenCache.CachedMethod { Fingerprint = fingerprint, Code = code };
+            }
+            methodCode.Add((type, signature, code));
+        }
+
         foreach (var type in userTypes)
         {
             if (type.IsDelegate || type.IsRuntimeProvided) continue;
@@ -255,10 +392,7 @@ public partial class CppCodeGenerator
                     if (method.IsAbstract || method.BasicBlocks.Count == 0) continue;
                     if (HasUnknownParameterTypes(method, knownTypeNames)) continue;
                     if (!emittedMethodSignatures.Add(method.GetCppSignature())) continue;
-                    if (isBclInterface)
-                        GenerateMethodStub(sb, method);
-                    else
-                        GenerateMethodImpl(sb, method);
+                    Emit(type, method, stub: isBclInterface);
                 }
                 continue;
             }
@@ -273,7 +407,7 @@ public partial class CppCodeGenerator
                     if (method.BasicBlocks.Count == 0) continue;
                     if (HasUnknownParameterTypes(method, knownTypeNames)) continue;
                     if (!emittedMethodSignatures.Add(method.GetCppSignature())) continue;
-                    GenerateMethodStub(sb, method);
+                    Emit(type, method, stub: true);
                 }
                 continue;
             }
@@ -284,17 +418,218 @@ public partial class CppCodeGenerator
                 if (method.BasicBlocks.Count == 0) continue;
                 if (HasUnknownParameterTypes(method, knownTypeNames)) continue;
                 if (!emittedMethodSignatures.Add(method.GetCppSignature())) continue;
-                GenerateMethodImpl(sb, method);
+                Emit(type, method, stub: false);
             }
         }
 
+        // Keep only the methods of this run so the cache doesn't grow without bound
+        if (_cache != null)
+            _cache.Methods = cachedMethods;
+        return methodCode;
+    }
+
+    private string GenerateMethodCode(IRMethod method, bool stub)
+    {
+        var sb = new StringBuilder();
+        if (stub)
+            GenerateMethodStub(sb, method);
+        else
+            GenerateMethodImpl(sb, method);
+        return sb.ToString();
+    }
+
+    /// <summary>
+    /// Hash of everything <see cref="GenerateMethodImpl"/> reads. Taken over the lowered IR
+    /// rather than the IL alone, so changes that reach a method only through its
+    /// dependencies (an inlined callee, a vtable slot, a field turning into a value type,
+    /// a renumbered string literal) invalidate the cached body as well.
+    /// </summary>
+    private string FingerprintMethod(IRMethod method, bool stub)
+    {
+        var sb = new StringBuilder();
+        sb.AppendLine(_config.ToString());
+        sb.AppendLine(stub ? "stub" : "impl");
+        sb.AppendLine($"{method.DeclaringType?.ILFullName}::{method.Name}");
+        sb.AppendLine(method.GetCppSignature());
+        sb.AppendLine(method.ReturnTypeCpp);
+        if (!stub)
+        {
+            foreach (var local in method.Locals)
+                sb.AppendLine($"local {local.CppTypeName} {local.CppName}");
+            foreach (var storage in method.StackObjects)
+                sb.AppendLine($"stack {storage.CppTypeName} {storage.CppName}");
+            foreach (var block in method.BasicBlocks)
+            {
+                foreach (var instr in block.Instructions)
+                {
+                    sb.Append(instr.GetType().Name).Append(' ').AppendLine(instr.ToCpp());
+                    if (instr.DebugInfo != null && (_config.EmitILOffsetComments || _config.EmitLineDirectives))
+                        sb.AppendLine($"@{instr.DebugInfo.ILOffset} {instr.DebugInfo.Line} {instr.DebugInfo.FilePath}");
+                }
+            }
+        }
+        return CodeGenCache.Hash(sb.ToString());
+    }
+
+    private string InternalHeaderName => $"{_module.Name}_internal.h";
+
+    /// <summary>
+    /// Number of translation units for the method implementations: the configured
+    /// count, or one per <see cref="TranslationUnitTargetSize"/> characters of
+    /// generated method code (at most <see cref="MaxTranslationUnits"/>).
+    /// </summary>
+    private int CountTranslationUnits(List<(IRType Type, string Signature, string Code)> methodCode)
+    {
+        if (methodCode.Count == 0) return 1;
+        long size = methodCode.Sum(m => (long)m.Code.Length);
+        int units = _config.TranslationUnits > 0
+            ? _config.TranslationUnits
+            : (int)Math.Min(MaxTranslationUnits, (size + TranslationUnitTargetSize - 1) / TranslationUnitTargetSize);
+        return Math.Clamp(units, 1, methodCode.Count);
+    }
+
+    /// <summary>
+    /// Split the methods into <paramref name="units"/> translation units. With a cache, the
+    /// previous run's boundaries are kept as long as they still exist and the parts
+    /// stay within twice the size of a fresh split, so an edit only changes one file.
+    /// </summary>
+    private List<List<(IRType Type, string Signature, string Code)>> PartitionMethods(
+        List<(IRType Type, string Signature, string Code)> methodCode, int units)
+    {
+        var parts = PartitionBySize(methodCode, m => m.Code.Length, units);
+        if (_cache == null) return parts;
+
+        var starts = _cache.PartitionStarts;
+        if (starts.Count == units && starts.Count > 0 && methodCode[0].Signature == starts[0])
+        {
+            var kept = new List<List<(IRType Type, string Signature, string Code)>>();
+            int next = 0;
+            foreach (var method in methodCode)
+            {
+                if (next < starts.Count && method.Signature == starts[next])
+                {
+                    kept.Add(new());
+                    next++;
+                }
+                kept[^1].Add(method);
+            }
+            long Largest(List<List<(IRType Type, string Signature, string Code)>> p) =>
+                p.Max(part => part.Sum(m => (long)m.Code.Length));
+            if (next == starts.Count && Largest(kept) <= 2 * Largest(parts))
+                parts = kept;
+        }
+        _cache.PartitionStarts = parts.Select(p => p[0].Signature).ToList();
+        return parts;
+    }
+
+    /// <summary>
+    /// Split <paramref name="items"/> into at most <paramref name="units"/> contiguous runs
+    /// of roughly equal total size. Contiguous runs keep a type's methods (and the
+    /// types of one namespace, which the IR lists together) in the same file.
+    /// </summary>
+    internal static List<List<T>> PartitionBySize<T>(List<T> items, Func<T, int> size, int units)
+    {
+        long total = items.Sum(i => (long)size(i));
+        var parts = new List<List<T>> { new() };
+        long before = 0;
+        foreach (var item in items)
+        {
+            // Start the next part once the running total reaches its share
+            if (parts[^1].Count > 0 && parts.Count < units && before >= total * parts.Count / units)
+                parts.Add(new List<T>());
+            parts[^1].Add(item);
+            before += size(item);
+        }
+        return parts;
+    }
+
+    /// <summary>
+    /// {Module}_internal.h: the declarations the method translation units share
+    /// with {Module}.cpp beyond the public header. String literals and array blobs are
+    /// declared in the files that use them instead, so adding a literal doesn't
+    /// recompile every translation unit.
+    /// </summary>
+    private GeneratedFile GenerateInternalHeader(bool needsObjectAlias, bool needsStringAlias)
+    {
+        var sb = new StringBuilder();
+        sb.AppendLine("// Generated by CIL2CPP - DO NOT EDIT");
+        sb.AppendLine($"// Source assembly: {_module.Name}");
+        sb.AppendLine("// Declarations shared by the generated translation units");
+        sb.AppendLine();
+        sb.AppendLine("#pragma once");
+        sb.AppendLine();
+        sb.AppendLine($"#include \"{_module.Name}.h\"");
+        sb.AppendLine();
+        foreach (var header in SourceStandardHeaders)
+            sb.AppendLine($"#include <{header}>");
+        sb.AppendLine();
+
+        if (needsObjectAlias || needsStringAlias)
+        {
+            sb.AppendLine("// ===== Runtime TypeInfo Aliases =====");
+            if (needsObjectAlias)
+                sb.AppendLine("static cil2cpp::TypeInfo& System_Object_TypeInfo = cil2cpp::System_Object_TypeInfo;");
+            if (needsStringAlias)
+                sb.AppendLine("static cil2cpp::TypeInfo& System_String_TypeInfo = cil2cpp::System_String_TypeInfo;");
+            sb.AppendLine();
+        }
+
+        sb.AppendLine("// ===== Runtime Base Type TypeInfo Stubs =====");
+        foreach (var (mangledName, _) in GetRuntimeBaseTypeInfoStubs())
+            sb.AppendLine($"extern cil2cpp::TypeInfo {mangledName}_TypeInfo;");
+
         return new GeneratedFile
         {
-            FileName = $"{_module.Name}.cpp",
+            FileName = InternalHeaderName,
+            Content = sb.ToString()
+        };
+    }
+
+    private GeneratedFile GenerateMethodSource(int index, int count, List<IRType> types,
+        List<(IRType Type, string Signature, string Code)> methodCode, HashSet<string> emittedTypeInfo)
+    {
+        var body = new StringBuilder();
+        EmitTypeData(body, types, emittedTypeInfo);
+        body.AppendLine("// ===== Method Implementations =====");
+        foreach (var (_, _, code) in methodCode)
+            body.Append(code);
+        var content = body.ToString();
+
+        var sb = new StringBuilder();
+        sb.AppendLine("// Generated by CIL2CPP - DO NOT EDIT");
+        sb.AppendLine($"// Source assembly: {_module.Name}");
+        sb.AppendLine($"// Types and method implementations, part {index + 1} of {count}");
+        if (_config.IsDebug)
+        {
+            sb.AppendLine("// DEBUG BUILD - contains #line directives and IL offset comments");
+        }
+        sb.AppendLine();
+        sb.AppendLine($"#include \"{InternalHeaderName}\"");
+        sb.AppendLine();
+
+        // Module data defined in {Module}.cpp that this part uses
+        var used = ModuleDataReference.Matches(content).Select(m => m.Value).ToHashSet();
+        var literals = _module.StringLiterals.Values.Where(l => used.Contains(l.Id)).ToList();
+        var blobs = _module.ArrayInitDataBlobs.Where(b => used.Contains(b.Id)).ToList();
+        if (literals.Count > 0 || blobs.Count > 0)
+        {
+            foreach (var literal in literals)
+                sb.AppendLine($"extern cil2cpp::String* {literal.Id};");
+            foreach (var blob in blobs)
+                sb.AppendLine($"extern const unsigned char {blob.Id}[{blob.Data.Length}];");
+            sb.AppendLine();
+        }
+        sb.Append(content);
+
+        return new GeneratedFile
+        {
+            FileName = $"{_module.Name}_methods_{index}.cpp",
             Content = sb.ToString()
         };
     }
 
+    private static readonly Regex ModuleDataReference = new(@"\b__(str|arr_init)_\d+\b", RegexOptions.Compiled);
+
     private void GenerateTypeInfo(StringBuilder sb, IRType type)
     {
         // For enum/delegate types skipped by EmitReflectionMetadata, emit type-level custom attrs
@@ -339,7 +674,9 @@ public partial class CppCodeGenerator
         sb.AppendLine($"    .interfaces = {interfacesExpr},");
         sb.AppendLine($"    .interface_count = {interfaceCount},");
         sb.AppendLine($"    .instance_size = {instanceSize},");
-        sb.AppendLine($"    .element_size = 0,");
+        // Value types are stored inline in arrays and collections; references are pointers (0)
+        var elementSize = type.IsValueType && !type.IsInterface ? $"sizeof({type.CppName})" : "0";
+        sb.AppendLine($"    .element_size = {elementSize},");
         sb.AppendLine($"    .flags = {flagsStr},");
         sb.AppendLine($"    .vtable = {vtableExpr},");
         // Reflection metadata: FieldInfo/MethodInfo arrays
@@ -379,6 +716,9 @@ public partial class CppCodeGenerator
         sb.AppendLine($"    .generic_variances = {genVarExpr},");
         sb.AppendLine($"    .generic_argument_count = {genCount},");
         sb.AppendLine($"    .generic_definition_name = {genDefName},");
+        var (valueEquals, valueHash) = FindValueEqualityMethods(type);
+        sb.AppendLine($"    .value_equals = {(valueEquals != null ? $"{type.CppName}__value_equals" : "nullptr")},");
+        sb.AppendLine($"    .value_hash = {(valueHash != null ? $"{type.CppName}__value_hash" : "nullptr")},");
         sb.AppendLine("};");
     }
 
@@ -424,6 +764,10 @@ public partial class CppCodeGenerator
             sb.AppendLine($"    {local.CppTypeName} {local.CppName} = {defaultVal};");
         }
 
+        // Storage for non-escaping objects (initialized by object_init_stack at the newobj)
+        foreach (var storage in method.StackObjects)
+            sb.AppendLine($"    {storage.CppTypeName} {storage.CppName};");
+
         // Collect temp variables that need auto declarations
         var declaredTemps = new HashSet<string>();
         string? lastLineDirective = null;
@@ -864,6 +1208,61 @@ public partial class CppCodeGenerator
         if (any) sb.AppendLine();
     }
 
+    /// <summary>
+    /// Pick the Equals/GetHashCode a value type defines itself, for the unboxed
+    /// TypeInfo thunks. Equals(T) (IEquatable) is preferred over Equals(object).
+    /// Enums, BCL and runtime-provided types keep bitwise semantics (nulls).
+    /// </summary>
+    private static (IRMethod? EqualsMethod, IRMethod? HashMethod) FindValueEqualityMethods(IRType type)
+    {
+        if (!type.IsValueType || type.IsEnum || type.IsInterface || type.IsRuntimeProvided
+            || type.SourceKind == AssemblyKind.BCL)
+            return (null, null);
+
+        var candidates = type.Methods
+            .Where(m => !m.IsStatic && !m.IsAbstract && m.BasicBlocks.Count > 0)
+            .ToList();
+        var equals = candidates.FirstOrDefault(m => m.Name == "Equals" && m.Parameters.Count == 1
+                                                    && m.Parameters[0].ILTypeName == type.ILFullName)
+                     ?? candidates.FirstOrDefault(m => m.Name == "Equals" && m.IsVirtual && m.Parameters.Count == 1
+                                                       && m.Parameters[0].ILTypeName == "System.Object");
+        var hash = candidates.FirstOrDefault(m => m.Name == "GetHashCode" && m.IsVirtual && m.Parameters.Count == 0);
+        return (equals, hash);
+    }
+
+    private void EmitValueEqualityThunks(StringBuilder sb, List<IRType> userTypes)
+    {
+        bool any = false;
+        foreach (var type in userTypes)
+        {
+            var (equals, hash) = FindValueEqualityMethods(type);
+            if (equals == null && hash == null) continue;
+            if (!any)
+            {
+                sb.AppendLine("// ===== Value Equality Thunks =====");
+                any = true;
+            }
+
+            if (equals != null)
+            {
+                // Equals(object) still needs its argument boxed; Equals(T) takes it by value
+                var other = equals.Parameters[0].ILTypeName == type.ILFullName
+                    ? $"*static_cast<const {type.CppName}*>(b)"
+                    : $"(cil2cpp::Object*)cil2cpp::box_raw(b, sizeof({type.CppName}), &{type.CppName}_TypeInfo)";
+                sb.AppendLine($"static cil2cpp::Boolean {type.CppName}__value_equals(const void* a, const void* b) {{");
+                sb.AppendLine($"    return {equals.CppName}(({type.CppName}*)a, {other});");
+                sb.AppendLine("}");
+            }
+            if (hash != null)
+            {
+                sb.AppendLine($"static cil2cpp::Int32 {type.CppName}__value_hash(const void* value) {{");
+                sb.AppendLine($"    return {hash.CppName}(({type.CppName}*)value);");
+                sb.AppendLine("}");
+            }
+        }
+        if (any) sb.AppendLine();
+    }
+
     /// <summary>
     /// Build a lookup table mapping IL type full names to TypeInfo pointer expressions.
     /// Only includes types with TypeInfo emitted in generated code (non-runtime-provided user types + primitives).
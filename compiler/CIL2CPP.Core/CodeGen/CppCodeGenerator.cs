@@ -74,13 +74,29 @@ public partial class CppCodeGenerator
         return true;
     }
 
+    /// <summary>
+    /// Characters of generated method code per translation unit when
+    /// BuildConfiguration.TranslationUnits is 0 (automatic).
+    /// </summary>
+    public const int TranslationUnitTargetSize = 256 * 1024;
+
+    /// <summary>Upper bound on the automatically chosen number of method translation units.</summary>
+    public const int MaxTranslationUnits = 64;
+
     private readonly IRModule _module;
     private readonly BuildConfiguration _config;
+    private readonly CodeGenCache? _cache;
 
-    public CppCodeGenerator(IRModule module, BuildConfiguration? config = null)
+    /// <summary>
+    /// With a <paramref name="cache"/> from the previous run in the same output directory,
+    /// unchanged method bodies and translation unit boundaries are reused; the cache is
+    /// updated in place.
+    /// </summary>
+    public CppCodeGenerator(IRModule module, BuildConfiguration? config = null, CodeGenCache? cache = null)
     {
         _module = module;
         _config = config ?? BuildConfiguration.Release;
+        _cache = cache;
     }
 
     /// <summary>
@@ -93,8 +109,8 @@ public partial class CppCodeGenerator
         // Generate header file with all type declarations
         output.HeaderFile = GenerateHeader();
 
-        // Generate source file with all implementations
-        output.SourceFile = GenerateSource();
+        // Generate source file(s) with all implementations
+        GenerateSource(output);
 
         // Generate main entry point only for executable projects (with entry point)
         if (_module.EntryPoint != null)
@@ -103,7 +119,7 @@ public partial class CppCodeGenerator
         }
 
         // Generate CMakeLists.txt
-        output.CMakeFile = GenerateCMakeLists();
+        output.CMakeFile = GenerateCMakeLists(output);
 
         return output;
     }
@@ -118,7 +134,17 @@ public partial class CppCodeGenerator
         sb.AppendLine($"#include \"{_module.Name}.h\"");
         sb.AppendLine();
         sb.AppendLine("int main(int argc, char* argv[]) {");
-        sb.AppendLine("    cil2cpp::runtime_init();");
+        if (_config.GC.IsDefault)
+        {
+            sb.AppendLine("    cil2cpp::runtime_init();");
+        }
+        else
+        {
+            sb.AppendLine("    // GC settings from --gc; CIL2CPP_GC_* environment variables override them");
+            sb.AppendLine("    cil2cpp::gc::GCConfig gc_config;");
+            EmitGCConfig(sb, _config.GC);
+            sb.AppendLine("    cil2cpp::runtime_init(gc_config);");
+        }
         sb.AppendLine();
 
         // Initialize string literals
@@ -151,7 +177,23 @@ public partial class CppCodeGenerator
         };
     }
 
-    private GeneratedFile GenerateCMakeLists()
+    private static void EmitGCConfig(StringBuilder sb, GCSettings gc)
+    {
+        if (gc.InitialHeapSize is { } initialHeap)
+            sb.AppendLine($"    gc_config.initial_heap_size = {initialHeap}ull;");
+        if (gc.MaxHeapSize is { } maxHeap)
+            sb.AppendLine($"    gc_config.max_heap_size = {maxHeap}ull;");
+        if (gc.FreeSpaceDivisor is { } divisor)
+            sb.AppendLine($"    gc_config.free_space_divisor = {divisor}u;");
+        if (gc.ParallelMarkers is { } markers)
+            sb.AppendLine($"    gc_config.parallel_markers = {markers};");
+        if (gc.Incremental is { } incremental)
+            sb.AppendLine($"    gc_config.incremental = {(incremental ? "true" : "false")};");
+        if (gc.FullCollectionFrequency is { } fullFrequency)
+            sb.AppendLine($"    gc_config.full_collection_frequency = {fullFrequency};");
+    }
+
+    private GeneratedFile GenerateCMakeLists(GeneratedOutput output)
     {
         var sb = new StringBuilder();
         var projectName = _module.Name;
@@ -179,12 +221,16 @@ public partial class CppCodeGenerator
             sb.AppendLine($"add_executable({projectName}");
             sb.AppendLine("    main.cpp");
             sb.AppendLine($"    {projectName}.cpp");
+            foreach (var file in output.MethodSourceFiles)
+                sb.AppendLine($"    {file.FileName}");
             sb.AppendLine(")");
         }
         else
         {
             sb.AppendLine($"add_library({projectName} STATIC");
             sb.AppendLine($"    {projectName}.cpp");
+            foreach (var file in output.MethodSourceFiles)
+                sb.AppendLine($"    {file.FileName}");
             sb.AppendLine(")");
             sb.AppendLine();
             sb.AppendLine($"target_include_directories({projectName} PUBLIC");
@@ -198,6 +244,20 @@ public partial class CppCodeGenerator
         sb.AppendLine($"target_link_libraries({projectName} {linkVisibility} cil2cpp::runtime)");
         sb.AppendLine();
 
+        // Split sources: parse the runtime header once instead of once per translation unit
+        if (output.MethodSourceFiles.Count > 0)
+        {
+            sb.AppendLine("option(CIL2CPP_PRECOMPILED_HEADER \"Precompile cil2cpp.h for the generated sources\" ON)");
+            sb.AppendLine("if(CIL2CPP_PRECOMPILED_HEADER)");
+            sb.AppendLine($"    target_precompile_headers({projectName} PRIVATE");
+            sb.AppendLine("        <cil2cpp/cil2cpp.h>");
+            foreach (var header in SourceStandardHeaders)
+                sb.AppendLine($"        <{header}>");
+            sb.AppendLine("    )");
+            sb.AppendLine("endif()");
+            sb.AppendLine();
+        }
+
         // P/Invoke native library linking (filter out .NET internal modules)
         var internalPInvokeModules = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
             { "QCall", "QCall.dll", "libSystem.Native", "libSystem.Globalization.Native" };
@@ -291,21 +351,45 @@ public class GeneratedOutput
     public GeneratedFile? CMakeFile { get; set; }
 
     /// <summary>
-    /// Write all generated files to a directory.
+    /// Translation units with the method implementations and per-type data
+    /// ({Module}_methods_N.cpp). Empty when everything fits in SourceFile.
     /// </summary>
-    public void WriteToDirectory(string outputDir)
+    public List<GeneratedFile> MethodSourceFiles { get; } = new();
+
+    /// <summary>Declarations shared by SourceFile and MethodSourceFiles ({Module}_internal.h).</summary>
+    public GeneratedFile? InternalHeaderFile { get; set; }
+
+    /// <summary>All generated files, in write order.</summary>
+    public IEnumerable<GeneratedFile> AllFiles
     {
-        Directory.CreateDirectory(outputDir);
-        File.WriteAllText(Path.Combine(outputDir, HeaderFile.FileName), HeaderFile.Content);
-        File.WriteAllText(Path.Combine(outputDir, SourceFile.FileName), SourceFile.Content);
-        if (MainFile != null)
+        get
         {
-            File.WriteAllText(Path.Combine(outputDir, MainFile.FileName), MainFile.Content);
+            yield return HeaderFile;
+            yield return SourceFile;
+            if (InternalHeaderFile != null) yield return InternalHeaderFile;
+            foreach (var file in MethodSourceFiles) yield return file;
+            if (MainFile != null) yield return MainFile;
+            if (CMakeFile != null) yield return CMakeFile;
         }
-        if (CMakeFile != null)
+    }
+
+    /// <summary>
+    /// Write all generated files to a directory. Files whose content is unchanged are
+    /// left alone so their timestamps don't trigger a native rebuild.
+    /// Returns the number of files written.
+    /// </summary>
+    public int WriteToDirectory(string outputDir)
+    {
+        Directory.CreateDirectory(outputDir);
+        int written = 0;
+        foreach (var file in AllFiles)
         {
-            File.WriteAllText(Path.Combine(outputDir, CMakeFile.FileName), CMakeFile.Content);
+            var path = Path.Combine(outputDir, file.FileName);
+            if (File.Exists(path) && File.ReadAllText(path) == file.Content) continue;
+            File.WriteAllText(path, file.Content);
+            written++;
         }
+        return written;
     }
 }
 
@@ -0,0 +1,90 @@
+using System.Globalization;
+
+namespace CIL2CPP.Core;
+
+/// <summary>
+/// GC tuning compiled into the generated main() as a cil2cpp::gc::GCConfig.
+/// Null leaves the runtime default; the CIL2CPP_GC_* environment variables
+/// still override every setting when the program starts.
+/// </summary>
+public record GCSettings
+{
+    /// <summary>Bytes to grow the heap to at startup (initial-heap).</summary>
+    public ulong? InitialHeapSize { get; init; }
+
+    /// <summary>Hard heap limit in bytes (max-heap).</summary>
+    public ulong? MaxHeapSize { get; init; }
+
+    /// <summary>Grow the heap once free space drops below heap / divisor (free-space-divisor).</summary>
+    public uint? FreeSpaceDivisor { get; init; }
+
+    /// <summary>Marking threads, the collecting thread included; 1 = serial (markers).</summary>
+    public int? ParallelMarkers { get; init; }
+
+    /// <summary>Incremental, generational collection (incremental).</summary>
+    public bool? Incremental { get; init; }
+
+    /// <summary>Partial collections between full ones in incremental mode (full-frequency).</summary>
+    public int? FullCollectionFrequency { get; init; }
+
+    /// <summary>True when no setting is given, so main() keeps the runtime defaults.</summary>
+    public bool IsDefault => this == new GCSettings();
+
+    /// <summary>
+    /// Parse <c>key=value</c> settings as given to <c>--gc</c>, e.g. <c>max-heap=512M</c>.
+    /// Sizes accept a K/M/G suffix.
+    /// </summary>
+    public static GCSettings Parse(IEnumerable<string> settings)
+    {
+        var result = new GCSettings();
+        foreach (var setting in settings)
+        {
+            var eq = setting.IndexOf('=');
+            if (eq <= 0)
+                throw new ArgumentException($"Invalid GC setting '{setting}'. Use key=value, e.g. max-heap=512M.");
+            var key = setting[..eq].Trim().ToLowerInvariant();
+            var value = setting[(eq + 1)..].Trim();
+            result = key switch
+            {
+                "initial-heap" => result with { InitialHeapSize = ParseSize(key, value) },
+                "max-heap" => result with { MaxHeapSize = ParseSize(key, value) },
+                "free-space-divisor" => result with { FreeSpaceDivisor = (uint)ParseInt(key, value, 1, 1 << 20) },
+                "markers" => result with { ParallelMarkers = ParseInt(key, value, 1, 1024) },
+                "incremental" => result with { Incremental = ParseBool(key, value) },
+                "full-frequency" => result with { FullCollectionFrequency = ParseInt(key, value, 0, 1 << 20) },
+                _ => throw new ArgumentException(
+                    $"Unknown GC setting '{key}'. Use initial-heap, max-heap, free-space-divisor, markers, incremental or full-frequency."),
+            };
+        }
+        return result;
+    }
+
+    private static ulong ParseSize(string key, string value)
+    {
+        var digits = value.EndsWith('b') || value.EndsWith('B') ? value[..^1] : value;
+        int shift = 0;
+        if (digits.Length > 0)
+        {
+            shift = char.ToUpperInvariant(digits[^1]) switch { 'K' => 10, 'M' => 20, 'G' => 30, _ => 0 };
+            if (shift != 0) digits = digits[..^1];
+        }
+        if (!ulong.TryParse(digits, NumberStyles.None, CultureInfo.InvariantCulture, out var n)
+            || n > ulong.MaxValue >> shift)
+            throw new ArgumentException($"Invalid size for GC setting {key}: '{value}'.");
+        return n << shift;
+    }
+
+    private static int ParseInt(string key, string value, int min, int max)
+    {
+        if (!int.TryParse(value, NumberStyles.None, CultureInfo.InvariantCulture, out var n) || n < min || n > max)
+            throw new ArgumentException($"Invalid value for GC setting {key}: '{value}' (expected {min}..{max}).");
+        return n;
+    }
+
+    private static bool ParseBool(string key, string value) => value.ToLowerInvariant() switch
+    {
+        "1" or "true" or "on" => true,
+        "0" or "false" or "off" => false,
+        _ => throw new ArgumentException($"Invalid value for GC setting {key}: '{value}' (expected true or false)."),
+    };
+}
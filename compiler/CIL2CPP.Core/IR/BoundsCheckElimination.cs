@@ -0,0 +1,297 @@
+using System.Globalization;
+using System.Text.RegularExpressions;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// Removes array bounds checks that the IR proves redundant, turning
+/// array_get/array_set/array_element_ptr into their _unchecked variants.
+///
+/// Two shapes are recognised:
+///  1. Counted loops — <c>for (int i = k; i &lt; a.Length; i++)</c> with k ≥ 0, and
+///     <c>foreach</c> over an array (same IL). Accesses <c>a[i]</c> in the loop body
+///     before the increment are in range: the condition was just checked, i only
+///     grows by one from a non-negative start, and <c>a</c> is not reassigned.
+///     A null <c>a</c> never enters the body (array_length(nullptr) is 0).
+///  2. Fresh arrays — constant indices into the result of <c>newarr</c> with a
+///     constant length (array initializers, params packing).
+///
+/// Anything the pass does not fully understand (address-taken variables, extra
+/// writes, jumps into the loop, exception regions) keeps its check.
+/// </summary>
+public static class BoundsCheckElimination
+{
+    private static readonly Regex ArrayCreateRegex =
+        new(@"^auto (__t\d+) = cil2cpp::array_create\([^;]*, (\d+)\);$", RegexOptions.Compiled);
+    private static readonly Regex ArrayLengthRegex =
+        new(@"^auto (__t\d+) = cil2cpp::array_length\(([A-Za-z_]\w*)\);$", RegexOptions.Compiled);
+    private static readonly Regex LessThanRegex =
+        new(@"^([A-Za-z_]\w*) < ([A-Za-z_]\w*)$", RegexOptions.Compiled);
+    private static readonly Regex IdentifierRegex =
+        new(@"^[A-Za-z_]\w*$", RegexOptions.Compiled);
+
+    /// <summary>
+    /// Run the pass over a method body. Returns the number of checks removed.
+    /// </summary>
+    public static int Run(IRMethod method)
+    {
+        var instructions = method.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+        if (!instructions.Any(i => i is IRArrayAccess or IRArrayElementAddress)) return 0;
+
+        return EliminateFreshArrayChecks(instructions) + EliminateCountedLoopChecks(instructions);
+    }
+
+    // ── Fresh arrays with constant length ────────────────────
+
+    private static int EliminateFreshArrayChecks(List<IRInstruction> instructions)
+    {
+        int removed = 0;
+        foreach (var instr in instructions)
+        {
+            if (instr is not IRRawCpp raw) continue;
+            var m = ArrayCreateRegex.Match(raw.Code);
+            if (!m.Success || !int.TryParse(m.Groups[2].Value, NumberStyles.None,
+                    CultureInfo.InvariantCulture, out var length))
+                continue;
+
+            // The temp must name this array for the whole method
+            var array = m.Groups[1].Value;
+            if (instructions.Count(i => MayWrite(i, array)) != 1) continue;
+
+            foreach (var access in instructions)
+            {
+                if (TryGetAccess(access, out var arr, out var idx) && arr == array
+                    && int.TryParse(idx, NumberStyles.None, CultureInfo.InvariantCulture, out var index)
+                    && index < length)
+                {
+                    removed += Elide(access);
+                }
+            }
+        }
+        return removed;
+    }
+
+    // ── Counted loops ────────────────────────────────────────
+
+    private static int EliminateCountedLoopChecks(List<IRInstruction> instructions)
+    {
+        int removed = 0;
+        var labelIndex = new Dictionary<string, int>();
+        for (int i = 0; i < instructions.Count; i++)
+        {
+            if (instructions[i] is IRLabel label)
+                labelIndex[label.LabelName] = i;
+        }
+
+        for (int c = 0; c < instructions.Count; c++)
+        {
+            // Back edge: if (i < len) goto BODY, with BODY above
+            if (instructions[c] is not IRConditionalBranch { FalseLabel: null } backEdge
+                || !labelIndex.TryGetValue(backEdge.TrueLabel, out var body) || body >= c)
+                continue;
+            removed += TryEliminateLoop(instructions, body, c);
+        }
+        return removed;
+    }
+
+    private static int TryEliminateLoop(List<IRInstruction> instructions, int body, int backEdge)
+    {
+        // The condition is evaluated in the block that ends with the back edge
+        int condStart = backEdge - 1;
+        while (condStart > body && instructions[condStart] is not IRLabel) condStart--;
+        if (condStart <= body) return 0;
+        var condLabel = ((IRLabel)instructions[condStart]).LabelName;
+
+        var condition = ((IRConditionalBranch)instructions[backEdge]).Condition;
+        if (!TryResolveLessThan(instructions, condStart, backEdge, condition, out var iv, out var lengthExpr))
+            return 0;
+        if (!TryResolveArrayLength(instructions, condStart, backEdge, lengthExpr, out var array))
+            return 0;
+        if (iv.StartsWith("__") || array.StartsWith("__") || iv == array) return 0;
+
+        // Entry: "iv = k (k >= 0); goto COND;" directly above the body, and no
+        // other way into the loop from outside
+        if (body < 2
+            || instructions[body - 1] is not IRBranch entry || entry.TargetLabel != condLabel
+            || instructions[body - 2] is not IRAssign init || init.Target != iv
+            || !int.TryParse(init.Value, NumberStyles.None, CultureInfo.InvariantCulture, out _))
+            return 0;
+
+        var loopLabels = new List<string>();
+        for (int k = body; k < backEdge; k++)
+        {
+            switch (instructions[k])
+            {
+                case IRLabel l:
+                    loopLabels.Add(l.LabelName);
+                    break;
+                case IRTryBegin or IRCatchBegin or IRFinallyBegin or IRTryEnd or IRFilterBegin or IREndFilter:
+                    return 0;
+            }
+        }
+        for (int k = 0; k < instructions.Count; k++)
+        {
+            if (k >= body && k <= backEdge) continue;
+            if (k == body - 1) continue; // the entry jump
+            var code = instructions[k].ToCpp();
+            if (loopLabels.Any(l => ReferencesLabel(code, l))) return 0;
+        }
+
+        // Neither variable may have its address taken anywhere
+        if (instructions.Any(i => TakesAddress(i, iv) || TakesAddress(i, array))) return 0;
+
+        // Inside the loop: the array is never reassigned, and iv is written
+        // exactly once, by "iv = iv + 1"
+        int increment = -1;
+        for (int k = body + 1; k < backEdge; k++)
+        {
+            var instr = instructions[k];
+            if (MayWrite(instr, array)) return 0;
+            if (!MayWrite(instr, iv)) continue;
+            if (increment >= 0 || !IsIncrement(instructions, body, k, iv)) return 0;
+            increment = k;
+        }
+        if (increment < 0) return 0;
+
+        // Nothing between the increment and the back edge may jump back into the body
+        for (int k = increment + 1; k < backEdge; k++)
+        {
+            if (instructions[k] is IRBranch or IRConditionalBranch or IRSwitch) return 0;
+        }
+
+        int removed = 0;
+        for (int k = body + 1; k < increment; k++)
+        {
+            if (TryGetAccess(instructions[k], out var arr, out var idx) && arr == array && idx == iv)
+                removed += Elide(instructions[k]);
+        }
+        return removed;
+    }
+
+    /// <summary>
+    /// Resolve a branch condition to "iv &lt; len": either the condition itself
+    /// (Release: blt) or a flag computed by clt in the condition block (Debug).
+    /// </summary>
+    private static bool TryResolveLessThan(List<IRInstruction> instructions, int from, int to,
+        string condition, out string iv, out string length)
+    {
+        iv = length = "";
+        var expr = condition;
+        for (int step = 0; step < 3; step++)
+        {
+            var m = LessThanRegex.Match(expr);
+            if (m.Success)
+            {
+                iv = m.Groups[1].Value;
+                length = m.Groups[2].Value;
+                return true;
+            }
+            if (!IdentifierRegex.IsMatch(expr)) return false;
+
+            var def = FindDefinition(instructions, from, to, expr);
+            switch (def)
+            {
+                case IRAssign assign:
+                    expr = assign.Value;
+                    break;
+                case IRBinaryOp { Op: "<" } lt:
+                    expr = $"{lt.Left} < {lt.Right}";
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return false;
+    }
+
+    /// <summary>Resolve "len" to array_length(array), through an optional conv.i4.</summary>
+    private static bool TryResolveArrayLength(List<IRInstruction> instructions, int from, int to,
+        string lengthExpr, out string array)
+    {
+        array = "";
+        var def = FindDefinition(instructions, from, to, lengthExpr);
+        if (def is IRConversion { TargetType: "int32_t" } conv)
+            def = FindDefinition(instructions, from, to, conv.SourceExpr);
+        if (def is not IRRawCpp raw) return false;
+        var m = ArrayLengthRegex.Match(raw.Code);
+        if (!m.Success) return false;
+        array = m.Groups[2].Value;
+        return true;
+    }
+
+    /// <summary>Last instruction in [from, to) that writes name, if it is the only one there.</summary>
+    private static IRInstruction? FindDefinition(List<IRInstruction> instructions, int from, int to, string name)
+    {
+        IRInstruction? def = null;
+        for (int k = from; k < to; k++)
+        {
+            if (!MayWrite(instructions[k], name)) continue;
+            if (def != null) return null;
+            def = instructions[k];
+        }
+        return def;
+    }
+
+    private static bool IsIncrement(List<IRInstruction> instructions, int body, int at, string iv)
+    {
+        if (instructions[at] is not IRAssign assign || assign.Target != iv) return false;
+        var def = FindDefinition(instructions, body + 1, at, assign.Value);
+        return def is IRBinaryOp { Op: "+", Right: "1" } add && add.Left == iv
+            && add.ResultVar == assign.Value;
+    }
+
+    // ── Instruction helpers ──────────────────────────────────
+
+    private static bool TryGetAccess(IRInstruction instr, out string array, out string index)
+    {
+        switch (instr)
+        {
+            case IRArrayAccess a:
+                (array, index) = (a.ArrayExpr, a.IndexExpr);
+                return true;
+            case IRArrayElementAddress e:
+                (array, index) = (e.ArrayExpr, e.IndexExpr);
+                return true;
+            default:
+                array = index = "";
+                return false;
+        }
+    }
+
+    private static int Elide(IRInstruction instr)
+    {
+        switch (instr)
+        {
+            case IRArrayAccess { BoundsCheckElided: false } a:
+                a.BoundsCheckElided = true;
+                return 1;
+            case IRArrayElementAddress { BoundsCheckElided: false } e:
+                e.BoundsCheckElided = true;
+                return 1;
+            default:
+                return 0;
+        }
+    }
+
+    /// <summary>
+    /// Conservative textual check: does the generated C++ assign, increment or
+    /// take the address of <paramref name="name"/>?
+    /// </summary>
+    internal static bool MayWrite(IRInstruction instr, string name)
+    {
+        var code = instr.ToCpp();
+        if (!code.Contains(name)) return false;
+        var n = Regex.Escape(name);
+        return Regex.IsMatch(code,
+            $@"(?<![\w.>]){n}\b\s*(([-+*/%&|^]|<<|>>)?=(?!=)|\+\+|--)|(\+\+|--)\s*{n}\b|&\s*{n}\b");
+    }
+
+    internal static bool TakesAddress(IRInstruction instr, string name)
+    {
+        var code = instr.ToCpp();
+        return code.Contains(name) && Regex.IsMatch(code, $@"&\s*{Regex.Escape(name)}\b");
+    }
+
+    private static bool ReferencesLabel(string code, string label) =>
+        code.Contains(label) && Regex.IsMatch(code, $@"\b{Regex.Escape(label)}\b");
+}
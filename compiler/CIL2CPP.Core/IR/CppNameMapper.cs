@@ -43,6 +43,10 @@ public static class CppNameMapper
         ["System.AggregateException"] = "cil2cpp::AggregateException",
         ["System.OperationCanceledException"] = "cil2cpp::OperationCanceledException",
         ["System.Threading.Tasks.TaskCanceledException"] = "cil2cpp::TaskCanceledException",
+        ["System.Threading.Channels.ChannelClosedException"] = "cil2cpp::ChannelClosedException",
+        ["System.Threading.SemaphoreFullException"] = "cil2cpp::SemaphoreFullException",
+        ["System.Threading.SynchronizationLockException"] = "cil2cpp::SynchronizationLockException",
+        ["System.Threading.LockRecursionException"] = "cil2cpp::LockRecursionException",
         // Collections
         ["System.Collections.Generic.KeyNotFoundException"] = "cil2cpp::KeyNotFoundException",
         // IO
@@ -0,0 +1,262 @@
+using System.Text.RegularExpressions;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// Moves <c>newobj</c> allocations that never outlive their method from the GC
+/// heap into storage declared in the method body (IRNewObj.StackStorage, listed
+/// in IRMethod.StackObjects).
+///
+/// An object does not escape when every use of it, or of a local it is copied
+/// into, is one of:
+///  - a field load, or a field store whose value is not the object itself;
+///  - a null check, a reference comparison (== / !=) or a branch on it;
+///  - a cast (the result becomes another name for the object);
+///  - a non-virtual call or constructor whose parameter does not escape in the
+///    callee (same rules, computed once per parameter; recursion escapes).
+///
+/// Returning it, storing it anywhere, virtual/interface calls, raw C++ and every
+/// other instruction count as escapes. Copies must go to locals assigned exactly
+/// once and never address-taken, so an allocation inside a loop can reuse its
+/// storage: no variable can still refer to the previous iteration's object.
+/// Types with finalizers, delegates and runtime-provided types stay on the heap.
+/// </summary>
+public static class EscapeAnalysis
+{
+    /// <summary>Larger objects stay on the heap to keep frames small.</summary>
+    public const int MaxStackObjectSize = 1024;
+
+    private static readonly Regex PointerCastRegex =
+        new(@"^\(\s*[\w:]+\s*\*\s*\)\s*", RegexOptions.Compiled);
+    private static readonly Regex TempRegex =
+        new(@"^__t\d+$", RegexOptions.Compiled);
+    private static readonly Regex CallRegex =
+        new(@"[\w>]\s*\(", RegexOptions.Compiled);
+
+    /// <summary>
+    /// Run the pass over every method body of the module. Returns the number of
+    /// allocation sites moved to the stack.
+    /// </summary>
+    public static int Run(IRModule module)
+    {
+        var state = new State(module);
+        int moved = 0;
+        foreach (var method in module.GetAllMethods())
+        {
+            var instructions = state.Body(method);
+            foreach (var newObj in instructions.OfType<IRNewObj>())
+            {
+                if (!IsCandidate(newObj, state)) continue;
+                if (state.ArgumentEscapes(newObj.CtorName, 0)) continue;
+                if (Escapes(method, newObj.ResultVar, newObj, state)) continue;
+
+                var storage = new IRLocal
+                {
+                    Index = method.StackObjects.Count,
+                    CppName = $"__stack_obj{method.StackObjects.Count}",
+                    CppTypeName = newObj.TypeCppName,
+                };
+                method.StackObjects.Add(storage);
+                newObj.StackStorage = storage.CppName;
+                moved++;
+            }
+        }
+        return moved;
+    }
+
+    private static bool IsCandidate(IRNewObj newObj, State state)
+    {
+        if (!TempRegex.IsMatch(newObj.ResultVar) || newObj.Pooled) return false;
+        if (!state.Types.TryGetValue(newObj.TypeCppName, out var type)) return false;
+        if (type.IsValueType || type.IsDelegate || type.IsRuntimeProvided || type.IsInterface) return false;
+        if (type.InstanceSize > MaxStackObjectSize) return false;
+        for (var t = type; t != null; t = t.BaseType)
+        {
+            if (t.Finalizer != null || t.IsRuntimeProvided) return false;
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Follow every name <paramref name="root"/> is known by through the method body.
+    /// </summary>
+    private static bool Escapes(IRMethod method, string root, IRInstruction? definition, State state)
+    {
+        var instructions = state.Body(method);
+        var aliases = new List<string> { root };
+        for (int k = 0; k < aliases.Count; k++)
+        {
+            var alias = aliases[k];
+            foreach (var instr in instructions)
+            {
+                if (instr == definition || !Mentions(instr.ToCpp(), alias)) continue;
+                if (!IsContainedUse(instr, alias, method, instructions, aliases, state)) return true;
+            }
+        }
+        return false;
+    }
+
+    private static bool IsContainedUse(IRInstruction instr, string alias, IRMethod method,
+        List<IRInstruction> instructions, List<string> aliases, State state)
+    {
+        switch (instr)
+        {
+            case IRFieldAccess field when !field.IsValueAccess && StripCasts(field.ObjectExpr) == alias:
+                return !field.IsStore || !Mentions(field.StoreValue ?? "", alias);
+
+            case IRCall call when !call.IsVirtual && !Mentions(call.FunctionName, alias):
+                for (int i = 0; i < call.Arguments.Count; i++)
+                {
+                    if (!Mentions(call.Arguments[i], alias)) continue;
+                    if (StripCasts(call.Arguments[i]) != alias) return false;
+                    if (state.ArgumentEscapes(call.FunctionName, i)) return false;
+                }
+                return true;
+
+            case IRNewObj newObj:
+                for (int i = 0; i < newObj.CtorArgs.Count; i++)
+                {
+                    if (!Mentions(newObj.CtorArgs[i], alias)) continue;
+                    if (StripCasts(newObj.CtorArgs[i]) != alias) return false;
+                    if (state.ArgumentEscapes(newObj.CtorName, i + 1)) return false;
+                }
+                return true;
+
+            // The copy that introduced this name
+            case IRAssign assign when assign.Target == alias && aliases.Contains(StripCasts(assign.Value)):
+                return true;
+            case IRCast cast when cast.ResultVar == alias && aliases.Contains(StripCasts(cast.SourceExpr)):
+                return true;
+
+            case IRAssign assign when StripCasts(assign.Value) == alias:
+                return AddCopy(assign.Target, method, instructions, aliases);
+
+            case IRCast cast when StripCasts(cast.SourceExpr) == alias:
+                return AddCopy(cast.ResultVar, method, instructions, aliases);
+
+            case IRNullCheck:
+            case IRComment:
+                return true;
+
+            case IRConditionalBranch branch:
+                return !CallRegex.IsMatch(branch.Condition);
+
+            case IRBinaryOp op:
+                return op.Op is "==" or "!=";
+
+            default:
+                return false;
+        }
+    }
+
+    /// <summary>
+    /// Track a copy of the object. Only temps and locals written exactly once qualify.
+    /// </summary>
+    private static bool AddCopy(string target, IRMethod method, List<IRInstruction> instructions,
+        List<string> aliases)
+    {
+        if (!TempRegex.IsMatch(target) && method.Locals.All(l => l.CppName != target)) return false;
+        if (instructions.Count(i => BoundsCheckElimination.MayWrite(i, target)) != 1) return false;
+        if (!aliases.Contains(target)) aliases.Add(target);
+        return true;
+    }
+
+    private static string StripCasts(string expr)
+    {
+        expr = expr.Trim();
+        while (true)
+        {
+            var m = PointerCastRegex.Match(expr);
+            if (m.Success)
+            {
+                expr = expr.Substring(m.Length).Trim();
+                continue;
+            }
+            if (IsParenthesized(expr))
+            {
+                expr = expr[1..^1].Trim();
+                continue;
+            }
+            return expr;
+        }
+    }
+
+    /// <summary>Whether the whole expression is one (...) group.</summary>
+    private static bool IsParenthesized(string expr)
+    {
+        if (expr.Length < 2 || expr[0] != '(' || expr[^1] != ')') return false;
+        int depth = 0;
+        for (int i = 0; i < expr.Length; i++)
+        {
+            if (expr[i] == '(') depth++;
+            else if (expr[i] == ')' && --depth == 0) return i == expr.Length - 1;
+        }
+        return false;
+    }
+
+    private static bool Mentions(string code, string name) =>
+        code.Contains(name) && Regex.IsMatch(code, $@"(?<!\w){Regex.Escape(name)}(?!\w)");
+
+    /// <summary>
+    /// Per-module lookup tables and memoized parameter summaries.
+    /// </summary>
+    private sealed class State
+    {
+        public Dictionary<string, IRType> Types { get; } = new();
+        private readonly Dictionary<string, List<IRMethod>> _methods = new();
+        private readonly Dictionary<IRMethod, List<IRInstruction>> _bodies = new();
+        private readonly Dictionary<(string, int), bool> _summaries = new();
+        private readonly HashSet<(string, int)> _inProgress = new();
+
+        public State(IRModule module)
+        {
+            foreach (var type in module.Types)
+                Types.TryAdd(type.CppName, type);
+            foreach (var method in module.GetAllMethods())
+            {
+                if (!_methods.TryGetValue(method.CppName, out var list))
+                    _methods[method.CppName] = list = new List<IRMethod>();
+                list.Add(method);
+            }
+        }
+
+        public List<IRInstruction> Body(IRMethod method)
+        {
+            if (!_bodies.TryGetValue(method, out var body))
+                _bodies[method] = body = method.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+            return body;
+        }
+
+        /// <summary>
+        /// Whether argument <paramref name="index"/> (0 = this for instance methods)
+        /// may escape from any method compiled under <paramref name="cppName"/>.
+        /// </summary>
+        public bool ArgumentEscapes(string cppName, int index)
+        {
+            if (cppName == "System_Object__ctor") return false;
+            var key = (cppName, index);
+            if (_summaries.TryGetValue(key, out var known)) return known;
+            if (!_inProgress.Add(key)) return true;
+
+            bool escapes = !_methods.TryGetValue(cppName, out var callees)
+                || callees.Any(m => ParameterEscapes(m, index));
+            _inProgress.Remove(key);
+            _summaries[key] = escapes;
+            return escapes;
+        }
+
+        private bool ParameterEscapes(IRMethod method, int index)
+        {
+            if (method.BasicBlocks.Count == 0 || method.IsAbstract) return true;
+            if (!method.IsStatic) index--;
+            string name;
+            if (index < 0) name = "__this";
+            else if (index < method.Parameters.Count) name = method.Parameters[index].CppName;
+            else return true;
+
+            var body = Body(method);
+            if (body.Any(i => BoundsCheckElimination.MayWrite(i, name))) return true;
+            return Escapes(method, name, null, this);
+        }
+    }
+}
@@ -44,18 +44,45 @@ public static class ICallRegistry
         RegisterICall("System.Threading.Monitor", "Pulse", 1, "cil2cpp::icall::Monitor_Pulse");
         RegisterICall("System.Threading.Monitor", "PulseAll", 1, "cil2cpp::icall::Monitor_PulseAll");
 
-        // ===== System.Threading.Interlocked =====
-        RegisterICallTyped("System.Threading.Interlocked", "Increment", 1, "System.Int32&", "cil2cpp::icall::Interlocked_Increment_i32");
-        RegisterICallTyped("System.Threading.Interlocked", "Increment", 1, "System.Int64&", "cil2cpp::icall::Interlocked_Increment_i64");
-        RegisterICallTyped("System.Threading.Interlocked", "Decrement", 1, "System.Int32&", "cil2cpp::icall::Interlocked_Decrement_i32");
-        RegisterICallTyped("System.Threading.Interlocked", "Decrement", 1, "System.Int64&", "cil2cpp::icall::Interlocked_Decrement_i64");
-        RegisterICallTyped("System.Threading.Interlocked", "Exchange", 2, "System.Int32&", "cil2cpp::icall::Interlocked_Exchange_i32");
-        RegisterICallTyped("System.Threading.Interlocked", "Exchange", 2, "System.Int64&", "cil2cpp::icall::Interlocked_Exchange_i64");
-        RegisterICallTyped("System.Threading.Interlocked", "Exchange", 2, "System.Object&", "cil2cpp::icall::Interlocked_Exchange_obj");
-        RegisterICallTyped("System.Threading.Interlocked", "CompareExchange", 3, "System.Int32&", "cil2cpp::icall::Interlocked_CompareExchange_i32");
-        RegisterICallTyped("System.Threading.Interlocked", "CompareExchange", 3, "System.Int64&", "cil2cpp::icall::Interlocked_CompareExchange_i64");
-        RegisterICallTyped("System.Threading.Interlocked", "CompareExchange", 3, "System.Object&", "cil2cpp::icall::Interlocked_CompareExchange_obj");
-        RegisterICall("System.Threading.Interlocked", "Add", 2, "cil2cpp::icall::Interlocked_Add_i32");
+        // ===== System.Threading.Interlocked / Volatile =====
+        // Inline std::atomic_ref templates (interlocked.h): each call compiles to
+        // the atomic instruction itself. Reference-type overloads (and generic
+        // CompareExchange<T>/Exchange<T>) go through the _obj entry points.
+        const string interlocked = "System.Threading.Interlocked";
+        foreach (var (ilType, cppType) in new[]
+        {
+            ("System.Int32", "int32_t"), ("System.UInt32", "uint32_t"),
+            ("System.Int64", "int64_t"), ("System.UInt64", "uint64_t"),
+        })
+        {
+            RegisterICallTyped(interlocked, "Increment", 1, ilType + "&", $"cil2cpp::interlocked::increment<{cppType}>");
+            RegisterICallTyped(interlocked, "Decrement", 1, ilType + "&", $"cil2cpp::interlocked::decrement<{cppType}>");
+            RegisterICallTyped(interlocked, "Add", 2, ilType + "&", $"cil2cpp::interlocked::add<{cppType}>");
+            RegisterICallTyped(interlocked, "And", 2, ilType + "&", $"cil2cpp::interlocked::and_<{cppType}>");
+            RegisterICallTyped(interlocked, "Or", 2, ilType + "&", $"cil2cpp::interlocked::or_<{cppType}>");
+        }
+        foreach (var (ilType, cppType) in new[]
+        {
+            ("System.Byte", "uint8_t"), ("System.SByte", "int8_t"),
+            ("System.Int16", "int16_t"), ("System.UInt16", "uint16_t"),
+            ("System.Int32", "int32_t"), ("System.UInt32", "uint32_t"),
+            ("System.Int64", "int64_t"), ("System.UInt64", "uint64_t"),
+            ("System.Single", "float"), ("System.Double", "double"),
+            ("System.IntPtr", "intptr_t"), ("System.UIntPtr", "uintptr_t"),
+        })
+        {
+            RegisterICallTyped(interlocked, "Exchange", 2, ilType + "&", $"cil2cpp::interlocked::exchange<{cppType}>");
+            RegisterICallTyped(interlocked, "CompareExchange", 3, ilType + "&", $"cil2cpp::interlocked::compare_exchange<{cppType}>");
+        }
+        RegisterICallTyped(interlocked, "Exchange", 2, "System.Object&", "cil2cpp::interlocked::exchange_obj");
+        RegisterICallTyped(interlocked, "CompareExchange", 3, "System.Object&", "cil2cpp::interlocked::compare_exchange_obj");
+        RegisterICallTyped(interlocked, "Read", 1, "System.Int64&", "cil2cpp::interlocked::read<int64_t>");
+        RegisterICallTyped(interlocked, "Read", 1, "System.UInt64&", "cil2cpp::interlocked::read<uint64_t>");
+        RegisterICall(interlocked, "MemoryBarrier", 0, "cil2cpp::interlocked::memory_barrier");
+        RegisterICall(interlocked, "MemoryBarrierProcessWide", 0, "cil2cpp::interlocked::memory_barrier_process_wide");
+        // Volatile.Read/Write: every overload, and Read<T>/Write<T>, deduce T from the ref argument
+        RegisterICall("System.Threading.Volatile", "Read", 1, "cil2cpp::interlocked::volatile_read");
+        RegisterICall("System.Threading.Volatile", "Write", 2, "cil2cpp::interlocked::volatile_write");
 
         // ===== System.Threading.Thread =====
         RegisterICall("System.Threading.Thread", "Sleep", 1, "cil2cpp::icall::Thread_Sleep");
@@ -68,10 +95,15 @@ public static class ICallRegistry
         RegisterICall("System.Environment", "get_CurrentManagedThreadId", 0, "cil2cpp::icall::Environment_get_CurrentManagedThreadId");
 
         // ===== System.GC =====
-        RegisterICall("System.GC", "Collect", 0, "cil2cpp::gc_collect");
-        RegisterICall("System.GC", "SuppressFinalize", 1, "cil2cpp::gc_suppress_finalize");
-        RegisterICall("System.GC", "KeepAlive", 1, "cil2cpp::gc_keep_alive");
-        RegisterICall("System.GC", "_Collect", 2, "cil2cpp::gc_collect");
+        RegisterICall("System.GC", "Collect", 0, "cil2cpp::icall::GC_Collect");
+        RegisterICall("System.GC", "Collect", 1, "cil2cpp::icall::GC_Collect");
+        RegisterICall("System.GC", "SuppressFinalize", 1, "cil2cpp::icall::GC_SuppressFinalize");
+        RegisterICall("System.GC", "KeepAlive", 1, "cil2cpp::icall::GC_KeepAlive");
+        RegisterICall("System.GC", "_Collect", 2, "cil2cpp::icall::GC_Collect");
+        RegisterICall("System.GC", "GetTotalMemory", 1, "cil2cpp::icall::GC_GetTotalMemory");
+        RegisterICall("System.GC", "CollectionCount", 1, "cil2cpp::icall::GC_CollectionCount");
+        RegisterICall("System.GC", "GetAllocatedBytesForCurrentThread", 0, "cil2cpp::icall::GC_GetAllocatedBytesForCurrentThread");
+        RegisterICall("System.GC", "GetTotalAllocatedBytes", 1, "cil2cpp::icall::GC_GetTotalAllocatedBytes");
 
         // ===== System.Buffer =====
         RegisterICall("System.Buffer", "Memmove", 3, "cil2cpp::icall::Buffer_Memmove");
@@ -145,6 +177,11 @@ public static class ICallRegistry
         RegisterManaged("System.String", "get_Length", 0, "cil2cpp::string_length");
         RegisterManaged("System.String", "get_Chars", 1, "cil2cpp::string_get_chars");
         RegisterManagedWildcard("System.String", "Concat", "cil2cpp::string_concat");
+        RegisterManagedTyped("System.String", "Concat", 1, "System.String[]", "cil2cpp::string_concat_array");
+        RegisterManagedTyped("System.String", "Concat", 1, "System.Object[]", "cil2cpp::string_concat_obj_array");
+        RegisterManagedTyped("System.String", "Concat", 1, "System.Object", "cil2cpp::string_concat_obj");
+        RegisterManagedTyped("System.String", "Concat", 2, "System.Object", "cil2cpp::string_concat_obj");
+        RegisterManagedTyped("System.String", "Concat", 3, "System.Object", "cil2cpp::string_concat_obj3");
         RegisterManaged("System.String", "IsNullOrEmpty", 1, "cil2cpp::string_is_null_or_empty");
         RegisterManaged("System.String", "IsNullOrWhiteSpace", 1, "cil2cpp::string_is_null_or_empty");
         RegisterManagedWildcard("System.String", "Substring", "cil2cpp::string_substring");
@@ -210,11 +247,19 @@ public static class ICallRegistry
 
         // ===== Primitive ToString =====
         RegisterManaged("System.Int32", "ToString", 0, "cil2cpp::string_from_int32");
+        RegisterManaged("System.UInt32", "ToString", 0, "cil2cpp::string_from_uint32");
         RegisterManaged("System.Int64", "ToString", 0, "cil2cpp::string_from_int64");
+        RegisterManaged("System.UInt64", "ToString", 0, "cil2cpp::string_from_uint64");
         RegisterManaged("System.Double", "ToString", 0, "cil2cpp::string_from_double");
-        RegisterManaged("System.Single", "ToString", 0, "cil2cpp::string_from_double");
+        RegisterManaged("System.Single", "ToString", 0, "cil2cpp::string_from_single");
         RegisterManaged("System.Boolean", "ToString", 0, "cil2cpp::string_from_bool");
         RegisterManaged("System.Char", "ToString", 0, "cil2cpp::string_from_char");
+        RegisterManagedTyped("System.Int32", "ToString", 1, "System.String", "cil2cpp::string_from_int32");
+        RegisterManagedTyped("System.UInt32", "ToString", 1, "System.String", "cil2cpp::string_from_uint32");
+        RegisterManagedTyped("System.Int64", "ToString", 1, "System.String", "cil2cpp::string_from_int64");
+        RegisterManagedTyped("System.UInt64", "ToString", 1, "System.String", "cil2cpp::string_from_uint64");
+        RegisterManagedTyped("System.Double", "ToString", 1, "System.String", "cil2cpp::string_from_double");
+        RegisterManagedTyped("System.Single", "ToString", 1, "System.String", "cil2cpp::string_from_single");
 
         // ===== System.Array =====
         RegisterManaged("System.Array", "get_Length", 0, "cil2cpp::array_get_length");
@@ -46,6 +46,38 @@ public partial class IRBuilder
             || openTypeName.StartsWith("System.Runtime.CompilerServices.AsyncTaskMethodBuilder`");
     }
 
+    // ── Pooled state machines ─────────────────────────────────
+
+    private readonly Dictionary<string, bool> _pooledStateMachines = new();
+
+    /// <summary>
+    /// Whether a compiler-generated async state machine class is boxed from the
+    /// runtime's per-thread pool (async_box_acquire) instead of a fresh gc::alloc.
+    /// Applies to async Task / Task&lt;T&gt; methods when PoolAsyncStateMachines is set
+    /// or the method carries an attribute named PoolAsyncStateMachineAttribute
+    /// (declared by the program, any namespace). The box is released twice: by the
+    /// stub once it has read the builder's task, and by MoveNext once it has
+    /// completed that task; nothing else can reference a compiler-generated box.
+    /// </summary>
+    private bool IsPooledAsyncStateMachine(TypeDefinition smType)
+    {
+        if (smType.IsValueType || smType.DeclaringType == null
+            || !smType.Interfaces.Any(i => i.InterfaceType.FullName == "System.Runtime.CompilerServices.IAsyncStateMachine"))
+            return false;
+        if (_pooledStateMachines.TryGetValue(smType.FullName, out var pooled))
+            return pooled;
+
+        var stub = smType.DeclaringType.Methods.FirstOrDefault(m => m.CustomAttributes.Any(a =>
+            a.AttributeType.FullName == "System.Runtime.CompilerServices.AsyncStateMachineAttribute"
+            && a.ConstructorArguments.Count == 1
+            && a.ConstructorArguments[0].Value is TypeReference t && t.FullName == smType.FullName));
+        pooled = stub != null && IsTaskType(stub.ReturnType)
+            && (_config.PoolAsyncStateMachines
+                || stub.CustomAttributes.Any(a => a.AttributeType.Name == "PoolAsyncStateMachineAttribute"));
+        _pooledStateMachines[smType.FullName] = pooled;
+        return pooled;
+    }
+
     // ── Synthetic field creation ──────────────────────────────
 
     /// <summary>
@@ -139,31 +171,16 @@ public partial class IRBuilder
         {
             case "Create":
             {
-                // Static factory: returns zero-initialized builder with pending task
+                // Static factory: returns a zero-initialized builder. The task is created
+                // lazily (task_builder_get_task / task_builder_set_result), so a method that
+                // completes synchronously gets a cached or pre-completed task and never
+                // allocates a pending one.
                 var builderType = GetMangledTypeNameForRef(methodRef.DeclaringType);
                 var tmp = $"__t{tempCounter++}";
-
-                if (methodRef.DeclaringType is GenericInstanceType builderGit
-                    && builderGit.GenericArguments.Count > 0)
-                {
-                    // Generic builder: allocate correctly-sized Task<T> using gc::alloc
-                    // (task_create_pending allocates sizeof(Task) which lacks the f_result field)
-                    var taskTypeCpp = ResolveTaskTypeCppName(builderGit.GenericArguments[0]);
-                    block.Instructions.Add(new IRRawCpp
-                    {
-                        Code = $"{builderType} {tmp} = {{}}; " +
-                               $"{tmp}.f_task = static_cast<{taskTypeCpp}*>(cil2cpp::gc::alloc(sizeof({taskTypeCpp}), nullptr)); " +
-                               $"cil2cpp::task_init_pending(reinterpret_cast<cil2cpp::Task*>({tmp}.f_task));"
-                    });
-                }
-                else
+                block.Instructions.Add(new IRRawCpp
                 {
-                    // Non-generic builder: use standard task_create_pending (sizeof(Task) is correct)
-                    block.Instructions.Add(new IRRawCpp
-                    {
-                        Code = $"{builderType} {tmp} = {{}}; {tmp}.f_task = cil2cpp::task_create_pending();"
-                    });
-                }
+                    Code = $"{builderType} {tmp} = {{}};"
+                });
                 stack.Push(tmp);
                 return true;
             }
@@ -200,13 +217,22 @@ public partial class IRBuilder
             }
             case "get_Task":
             {
-                // Return builder->f_task
+                // Return builder->f_task, creating a pending task if the method is still running
                 var thisArg = WrapThis(stack.Count > 0 ? stack.Pop() : "nullptr");
                 var tmp = $"__t{tempCounter++}";
                 block.Instructions.Add(new IRRawCpp
                 {
-                    Code = $"auto {tmp} = {thisArg}->f_task;"
+                    Code = $"auto {tmp} = cil2cpp::task_builder_get_task({thisArg}->f_task);"
                 });
+                if (_pooledBoxTypeCpp != null)
+                {
+                    // Stub of a pooled state machine: done with the box (the builder is its field)
+                    block.Instructions.Add(new IRRawCpp
+                    {
+                        Code = $"cil2cpp::async_box_release(reinterpret_cast<char*>({thisArg}) - " +
+                               $"offsetof({_pooledBoxTypeCpp}, {CppNameMapper.MangleFieldName("<>t__builder")}));"
+                    });
+                }
                 stack.Push(tmp);
                 return true;
             }
@@ -214,12 +240,13 @@ public partial class IRBuilder
             {
                 if (isGeneric && methodRef.Parameters.Count == 1)
                 {
-                    // SetResult(T result) — generic version stores result, then completes
+                    // SetResult(T result) — completes the pending task, or (no await yet)
+                    // picks a cached/pre-completed task for the result
                     var result = stack.Count > 0 ? stack.Pop() : "0";
                     var thisArg = WrapThis(stack.Count > 0 ? stack.Pop() : "nullptr");
                     block.Instructions.Add(new IRRawCpp
                     {
-                        Code = $"{thisArg}->f_task->f_result = {result}; cil2cpp::task_complete(reinterpret_cast<cil2cpp::Task*>({thisArg}->f_task));"
+                        Code = $"cil2cpp::task_builder_set_result({thisArg}->f_task, {result});"
                     });
                 }
                 else
@@ -228,9 +255,10 @@ public partial class IRBuilder
                     var thisArg = WrapThis(stack.Count > 0 ? stack.Pop() : "nullptr");
                     block.Instructions.Add(new IRRawCpp
                     {
-                        Code = $"cil2cpp::task_complete({thisArg}->f_task);"
+                        Code = $"cil2cpp::task_builder_set_result({thisArg}->f_task);"
                     });
                 }
+                EmitPooledMoveNextRelease(block);
                 return true;
             }
             case "SetException":
@@ -240,8 +268,9 @@ public partial class IRBuilder
                 var thisArg = WrapThis(stack.Count > 0 ? stack.Pop() : "nullptr");
                 block.Instructions.Add(new IRRawCpp
                 {
-                    Code = $"cil2cpp::task_fault(reinterpret_cast<cil2cpp::Task*>({thisArg}->f_task), static_cast<cil2cpp::Exception*>({ex}));"
+                    Code = $"cil2cpp::task_builder_set_exception({thisArg}->f_task, static_cast<cil2cpp::Exception*>({ex}));"
                 });
+                EmitPooledMoveNextRelease(block);
                 return true;
             }
             case "AwaitUnsafeOnCompleted" or "AwaitOnCompleted":
@@ -267,6 +296,16 @@ public partial class IRBuilder
                             smArg = smArg[1..]; // Strip & — pointer variable itself is the correct arg
                     }
 
+                    // First real await: the method's task must exist before MoveNext can
+                    // resume on another thread and complete it
+                    if (builderAddr != "nullptr")
+                    {
+                        block.Instructions.Add(new IRRawCpp
+                        {
+                            Code = $"cil2cpp::task_builder_get_task({WrapThis(builderAddr)}->f_task);"
+                        });
+                    }
+
                     // Get the task from the awaiter to register continuation on
                     var awaiterDeref = awaiterAddr.StartsWith("&") ? $"({awaiterAddr})" : awaiterAddr;
                     block.Instructions.Add(new IRRawCpp
@@ -290,6 +329,16 @@ public partial class IRBuilder
         }
     }
 
+    /// <summary>
+    /// After SetResult/SetException the state machine is finished: MoveNext returns
+    /// without touching it again, so it drops its reference to a pooled box.
+    /// </summary>
+    private void EmitPooledMoveNextRelease(IRBasicBlock block)
+    {
+        if (_inPooledMoveNext)
+            block.Instructions.Add(new IRRawCpp { Code = "cil2cpp::async_box_release(__this);" });
+    }
+
     // ── TaskAwaiter interception ──────────────────────────────
 
     private bool TryEmitAwaiterCall(IRBasicBlock block, Stack<string> stack,
@@ -424,20 +473,16 @@ public partial class IRBuilder
             }
             case "FromResult":
             {
-                // Task.FromResult<T>(T value) — allocate correctly-sized Task<T>
+                // Task.FromResult<T>(T value) — cached task for common results,
+                // otherwise a correctly-sized completed Task<T>
                 var value = stack.Count > 0 ? stack.Pop() : "0";
                 var tmp = $"__t{tempCounter++}";
 
                 // Get the concrete Task<T> type from the GenericInstanceMethod
                 var taskTypeCpp = ResolveTaskTypeFromFromResult(methodRef);
-                // Split into separate instructions to avoid AddAutoDeclarations conflict
-                block.Instructions.Add(new IRRawCpp
-                {
-                    Code = $"{tmp} = static_cast<{taskTypeCpp}*>(cil2cpp::gc::alloc(sizeof({taskTypeCpp}), nullptr));"
-                });
                 block.Instructions.Add(new IRRawCpp
                 {
-                    Code = $"cil2cpp::task_init_completed(reinterpret_cast<cil2cpp::Task*>({tmp})); {tmp}->f_result = {value};"
+                    Code = $"{tmp} = cil2cpp::task_from_result<{taskTypeCpp}>({value});"
                 });
                 stack.Push(tmp);
                 return true;
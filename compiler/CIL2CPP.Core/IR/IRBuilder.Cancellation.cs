@@ -368,10 +368,13 @@ public partial class IRBuilder
     {
         if (!IsTaskCompletionSourceType(ctorRef.DeclaringType)) return false;
 
-        // Pop constructor params (TaskCreationOptions, object state, etc.)
-        for (int i = 0; i < ctorRef.Parameters.Count; i++)
+        // Pop constructor params (object state, TaskCreationOptions); only the options are kept
+        string? options = null;
+        for (int i = ctorRef.Parameters.Count - 1; i >= 0; i--)
         {
-            if (stack.Count > 0) stack.Pop();
+            var arg = stack.Count > 0 ? stack.Pop() : "0";
+            if (ctorRef.Parameters[i].ParameterType.FullName == "System.Threading.Tasks.TaskCreationOptions")
+                options = arg;
         }
 
         // Determine the generic Task<T> type
@@ -397,7 +400,7 @@ public partial class IRBuilder
         // Create pending task and store in f_task field
         block.Instructions.Add(new IRRawCpp
         {
-            Code = $"{tmp}->f_task = static_cast<{taskTypeCpp}*>(cil2cpp::gc::alloc(sizeof({taskTypeCpp}), &{taskTypeCpp}_TypeInfo)); cil2cpp::task_init_pending(reinterpret_cast<cil2cpp::Task*>({tmp}->f_task));"
+            Code = $"{tmp}->f_task = static_cast<{taskTypeCpp}*>(cil2cpp::gc::alloc(sizeof({taskTypeCpp}), &{taskTypeCpp}_TypeInfo)); cil2cpp::task_init_pending(reinterpret_cast<cil2cpp::Task*>({tmp}->f_task){(options != null ? $", static_cast<cil2cpp::TaskCreationOptions>({options})" : "")});"
         });
 
         stack.Push(tmp);
@@ -0,0 +1,158 @@
+using Mono.Cecil;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// System.Threading.Channels interception. Channel&lt;T&gt;, ChannelReader&lt;T&gt;
+/// and ChannelWriter&lt;T&gt; are opaque handles to one runtime channel object
+/// (channel.h): Reader and Writer return the channel itself, and every call is
+/// lowered to a channel_* function with the element type erased to its size.
+/// ReadAsync / WaitToReadAsync / WriteAsync produce ValueTasks that carry the
+/// result directly when the call completes synchronously.
+/// Their CancellationToken is passed on: canceling it removes a parked call and
+/// faults its task. The options overloads of CreateBounded / CreateUnbounded
+/// and ReadAllAsync are not lowered.
+/// </summary>
+public partial class IRBuilder
+{
+    private const string ChannelsNamespace = "System.Threading.Channels";
+
+    internal static bool IsChannelBclGenericType(string openTypeName)
+    {
+        return openTypeName is "System.Threading.Channels.Channel`1" or "System.Threading.Channels.Channel`2"
+            or "System.Threading.Channels.ChannelReader`1" or "System.Threading.Channels.ChannelWriter`1";
+    }
+
+    /// <summary>
+    /// Cast a channel pointer to the generated handle type when that
+    /// specialization exists (it does whenever a local, field or parameter has it).
+    /// </summary>
+    private string ChannelHandle(string openTypeName, string elemIL, string expr)
+    {
+        var key = $"{openTypeName}<{elemIL}>";
+        var cpp = _typeCache.TryGetValue(key, out var irType) ? irType.CppName : "cil2cpp::Object";
+        return $"({cpp}*)({expr})";
+    }
+
+    private static string ChannelExpr(string expr) => $"(cil2cpp::Channel*)({expr})";
+
+    private static string ChannelValueTask(string resultIL) =>
+        CppNameMapper.MangleGenericInstanceTypeName("System.Threading.Tasks.ValueTask`1", new List<string> { resultIL });
+
+    /// <summary>
+    /// Intercept Channel.CreateBounded/CreateUnbounded, Channel&lt;T&gt;.Reader/Writer
+    /// and the ChannelReader&lt;T&gt; / ChannelWriter&lt;T&gt; members.
+    /// </summary>
+    private bool TryEmitChannelCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        var declaring = methodRef.DeclaringType;
+        if (declaring.Namespace != ChannelsNamespace) return false;
+
+        var paramTypes = methodRef.Parameters.Select(p => p.ParameterType.FullName).ToArray();
+        var id = tempCounter;
+
+        // Channel.CreateBounded<T>(int capacity) / Channel.CreateUnbounded<T>()
+        if (declaring.FullName == "System.Threading.Channels.Channel")
+        {
+            if (methodRef is not GenericInstanceMethod { GenericArguments.Count: 1 } gim) return false;
+            var elemIL = ResolveTypeRefOperand(gim.GenericArguments[0]);
+            var elemSize = $"sizeof({CppNameMapper.GetCppTypeForDecl(elemIL)})";
+            string create;
+            if (methodRef.Name == "CreateBounded" && paramTypes is ["System.Int32"])
+                create = $"cil2cpp::channel_create_bounded({stack.Pop()}, {elemSize})";
+            else if (methodRef.Name == "CreateUnbounded" && paramTypes.Length == 0)
+                create = $"cil2cpp::channel_create_unbounded({elemSize})";
+            else
+                return false;
+            var tmp = $"__t{tempCounter++}";
+            block.Instructions.Add(new IRRawCpp
+            {
+                Code = $"auto {tmp} = {ChannelHandle("System.Threading.Channels.Channel`1", elemIL, create)};"
+            });
+            stack.Push(tmp);
+            return true;
+        }
+
+        if (declaring is not GenericInstanceType git || !IsChannelBclGenericType(git.ElementType.FullName))
+            return false;
+        var openName = git.ElementType.FullName;
+        var isChannel = openName is "System.Threading.Channels.Channel`1" or "System.Threading.Channels.Channel`2";
+        var isReader = openName == "System.Threading.Channels.ChannelReader`1";
+        var isWriter = openName == "System.Threading.Channels.ChannelWriter`1";
+        var valueParams = paramTypes.Count(t => t != "System.Threading.CancellationToken");
+        var lowered = methodRef.Name switch
+        {
+            "get_Reader" or "get_Writer" => isChannel,
+            "TryRead" => isReader && valueParams == 1,
+            "ReadAsync" or "WaitToReadAsync" => isReader && valueParams == 0,
+            "get_Completion" => isReader,
+            "TryWrite" or "WriteAsync" => isWriter && valueParams == 1,
+            "Complete" or "TryComplete" => isWriter,
+            _ => false,
+        };
+        if (!lowered) return false;
+
+        // Channel<TWrite, TRead>: the reader reads TRead; Channel<T>, ChannelReader<T>, ChannelWriter<T>: T
+        var elem = ResolveTypeRefOperand(git.GenericArguments[^1]);
+        var elemCpp = CppNameMapper.GetCppTypeForDecl(elem);
+        var allArgs = PopArgs(stack, paramTypes.Length);
+        var tokenIndex = Array.IndexOf(paramTypes, "System.Threading.CancellationToken");
+        var token = tokenIndex >= 0 ? allArgs[tokenIndex] : "cil2cpp::ct_get_none()";
+        var args = allArgs.Where((_, i) => i != tokenIndex).ToList();
+        var channel = ChannelExpr(stack.Count > 0 ? stack.Pop() : "nullptr");
+        var error = $"(cil2cpp::Exception*)({(args.Count > 0 ? args[0] : "nullptr")})";
+
+        string? code = null;
+        string? result = null;
+        switch (methodRef.Name)
+        {
+            case "get_Reader":
+                result = ChannelHandle("System.Threading.Channels.ChannelReader`1", elem, channel);
+                break;
+            case "get_Writer":
+                result = ChannelHandle("System.Threading.Channels.ChannelWriter`1",
+                    ResolveTypeRefOperand(git.GenericArguments[0]), channel);
+                break;
+            case "TryRead":
+                result = $"cil2cpp::channel_try_read({channel}, {args[0]})";
+                break;
+            case "ReadAsync":
+                result = $"cil2cpp::channel_read_async<{ChannelValueTask(elem)}>({channel}, {token})";
+                break;
+            case "WaitToReadAsync":
+                result = $"cil2cpp::channel_wait_to_read_async<{ChannelValueTask("System.Boolean")}>({channel}, {token})";
+                break;
+            case "get_Completion":
+                result = $"cil2cpp::channel_get_completion({channel})";
+                break;
+            case "TryWrite":
+                code = $"{elemCpp} __ch_i{id} = {args[0]};";
+                result = $"cil2cpp::channel_try_write({channel}, &__ch_i{id})";
+                break;
+            case "WriteAsync":
+                code = $"{elemCpp} __ch_i{id} = {args[0]};";
+                result = $"System_Threading_Tasks_ValueTask{{cil2cpp::channel_write_async({channel}, &__ch_i{id}, {token})}}";
+                break;
+            case "TryComplete":
+                result = $"cil2cpp::channel_try_complete({channel}, {error})";
+                break;
+            case "Complete":
+                code = $"cil2cpp::channel_complete({channel}, {error});";
+                break;
+        }
+
+        if (result != null)
+        {
+            var tmp = $"__t{tempCounter++}";
+            var declare = $"auto {tmp} = {result};";
+            block.Instructions.Add(new IRRawCpp { Code = code != null ? $"{code} {declare}" : declare });
+            stack.Push(tmp);
+        }
+        else
+        {
+            block.Instructions.Add(new IRRawCpp { Code = code! });
+        }
+        return true;
+    }
+}
@@ -461,6 +461,10 @@ public partial class IRBuilder
     /// </summary>
     private string GetTypeInfoExpr(TypeReference typeRef)
     {
+        // Primitive element TypeInfos are only emitted on demand
+        var ilName = ResolveTypeRefOperand(typeRef);
+        if (CppNameMapper.IsPrimitive(ilName))
+            _module.RegisterPrimitiveTypeInfo(ilName);
         var mangledName = GetMangledTypeNameForRef(typeRef);
         return $"&{mangledName}_TypeInfo";
     }
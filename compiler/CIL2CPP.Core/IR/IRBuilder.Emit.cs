@@ -96,7 +96,8 @@ public partial class IRBuilder
         // ===== BCL Type Interceptions =====
         // In SA mode: ALL interceptions are active (BCL IL is not available).
         // In MA mode: Nullable/Index/Range compile from BCL IL — interceptions bypassed.
-        // Always intercept: ValueTuple, Async, Thread, Type, Span, MdArray, EqualityComparer, List, Dictionary
+        // Always intercept: ValueTuple, Async, Thread, Type, Span, MdArray, EqualityComparer, List, Dictionary,
+        // StringBuilder
 
         // SA-only: simple BCL value types that compile from IL in MA mode
         if (_assemblySet == null)
@@ -122,6 +123,8 @@ public partial class IRBuilder
             return;
         if (TryEmitSpanCall(block, stack, methodRef, ref tempCounter))
             return;
+        if (TryEmitMemoryExtensionsCall(block, stack, methodRef, ref tempCounter))
+            return;
         if (TryEmitEqualityComparerCall(block, stack, methodRef, ref tempCounter))
             return;
         if (TryEmitMdArrayCall(block, stack, methodRef, ref tempCounter))
@@ -136,8 +139,22 @@ public partial class IRBuilder
             return;
         if (TryEmitTaskCompletionSourceCall(block, stack, methodRef, ref tempCounter))
             return;
+        if (TryEmitStringBuilderCall(block, stack, methodRef, ref tempCounter))
+            return;
         if (TryEmitLinqCall(block, stack, methodRef, ref tempCounter))
             return;
+        if (TryEmitParallelCall(block, stack, methodRef, ref tempCounter))
+            return;
+        if (TryEmitParallelOptionsCall(block, stack, methodRef, ref tempCounter))
+            return;
+        if (TryEmitAggregateExceptionCall(block, stack, methodRef, ref tempCounter))
+            return;
+        if (TryEmitChannelCall(block, stack, methodRef, ref tempCounter))
+            return;
+        if (TryEmitSynchronizationCall(block, stack, methodRef, ref tempCounter))
+            return;
+        if (TryEmitThreadLocalCall(block, stack, methodRef, ref tempCounter))
+            return;
         if (TryEmitStringFormatCall(block, stack, methodRef, ref tempCounter))
             return;
         if (TryEmitAsyncEnumerableCall(block, stack, methodRef, ref tempCounter))
@@ -249,7 +266,7 @@ public partial class IRBuilder
 
         // Interlocked _obj methods need Object*/Object** casts for generic type arguments
         if (mappedName != null && mappedName.EndsWith("_obj")
-            && mappedName.Contains("Interlocked"))
+            && mappedName.StartsWith("cil2cpp::interlocked::"))
         {
             // First arg is T** → cast to Object**
             if (args.Count > 0)
@@ -317,40 +334,45 @@ public partial class IRBuilder
 
         // Constrained call on value type: convert virtual dispatch to direct call or box
         // ECMA-335 III.2.1: constrained. callvirt on value type T:
-        //   - If T overrides the method: call T's override directly (no boxing)
-        //   - Otherwise: box T and do virtual dispatch on the boxed object
+        //   - If T overrides the method: call T's override directly on the address (no boxing)
+        //   - Otherwise: box T once and do virtual dispatch on the boxed object
         if (constrainedType != null && isVirtual && methodRef.HasThis && mappedName == null)
         {
-            var constrainedTypeName = ResolveTypeRefOperand(constrainedType);
             var constrainedIrType = _typeCache.GetValueOrDefault(ResolveCacheKey(constrainedType));
-            if (constrainedIrType != null && constrainedIrType.IsValueType)
+            if (constrainedIrType != null && constrainedIrType.IsValueType && irCall.Arguments.Count > 0)
             {
-                // Find the method override on the constrained type (only methods with bodies)
-                var overrideMethod = constrainedIrType.Methods.FirstOrDefault(m =>
-                    m.Name == methodRef.Name && !m.IsStaticConstructor && !m.IsStatic
-                    && m.BasicBlocks.Count > 0
-                    && ParameterTypesMatchRef(m, methodRef));
+                // Strip the (cil2cpp::Object*) / (Interface*) cast to get the raw value pointer
+                var rawPtr = LinqPointerCastRegex.Replace(irCall.Arguments[0], "");
+                var cppTypeName = GetMangledTypeNameForRef(constrainedType);
+                var overrideMethod = FindValueTypeOverride(constrainedIrType, methodRef);
                 if (overrideMethod != null)
                 {
                     // Direct call to the value type's override
                     irCall.FunctionName = overrideMethod.CppName;
+                    irCall.Arguments[0] = $"({cppTypeName}*){rawPtr}";
                     isVirtual = false; // Suppress vtable dispatch
                 }
+                else if (!constrainedIrType.IsEnum && constrainedIrType.SourceKind != AssemblyKind.BCL
+                         && methodRef.DeclaringType.FullName is "System.Object" or "System.ValueType"
+                         && (methodRef.Name, methodRef.Parameters.Count) is ("GetHashCode", 0) or ("Equals", 1))
+                {
+                    // Inherited ValueType.GetHashCode/Equals: hash/compare the fields in place
+                    var typeInfo = $"&{cppTypeName}_TypeInfo";
+                    irCall.FunctionName = methodRef.Name == "GetHashCode"
+                        ? "cil2cpp::element_hash" : "cil2cpp::value_type_equals";
+                    irCall.Arguments[0] = rawPtr;
+                    irCall.Arguments.Add(typeInfo);
+                    isVirtual = false;
+                }
                 else
                 {
-                    // No override found — box the value type and do vtable dispatch
-                    // The `this` arg is currently a pointer to the value type; box it
-                    if (irCall.Arguments.Count > 0)
+                    // No override — box into a temp (the vtable call reads its receiver twice)
+                    var boxed = $"__t{tempCounter++}";
+                    block.Instructions.Add(new IRRawCpp
                     {
-                        var thisPtr = irCall.Arguments[0]; // e.g., "(cil2cpp::Object*)&loc_0"
-                        var cppTypeName = GetMangledTypeNameForRef(constrainedType);
-                        var typeInfoName = $"{cppTypeName}_TypeInfo";
-                        // Strip the (cil2cpp::Object*) cast to get the raw value pointer
-                        var rawPtr = thisPtr;
-                        if (rawPtr.StartsWith("(cil2cpp::Object*)"))
-                            rawPtr = rawPtr["(cil2cpp::Object*)".Length..];
-                        irCall.Arguments[0] = $"(cil2cpp::Object*)cil2cpp::box_raw({rawPtr}, sizeof({cppTypeName}), &{typeInfoName})";
-                    }
+                        Code = $"auto {boxed} = (cil2cpp::Object*)cil2cpp::box_raw({rawPtr}, sizeof({cppTypeName}), &{cppTypeName}_TypeInfo);"
+                    });
+                    irCall.Arguments[0] = boxed;
                 }
             }
         }
@@ -480,6 +502,22 @@ public partial class IRBuilder
         if (TryEmitCancellationTokenSourceNewObj(block, stack, ctorRef, ref tempCounter))
             return;
 
+        // Special: StringBuilder constructor
+        if (TryEmitStringBuilderNewObj(block, stack, ctorRef, ref tempCounter))
+            return;
+
+        // Special: ParallelOptions constructor
+        if (TryEmitParallelOptionsNewObj(block, stack, ctorRef, ref tempCounter))
+            return;
+
+        // Special: SemaphoreSlim / ManualResetEventSlim / ReaderWriterLockSlim constructors
+        if (TryEmitSynchronizationNewObj(block, stack, ctorRef, ref tempCounter))
+            return;
+
+        // Special: ThreadLocal<T> constructor
+        if (TryEmitThreadLocalNewObj(block, stack, ctorRef, ref tempCounter))
+            return;
+
         // Special: TaskCompletionSource<T> constructor
         if (TryEmitAsyncEnumerableNewObj(block, stack, ctorRef, ref tempCounter))
             return;
@@ -580,12 +618,15 @@ public partial class IRBuilder
             }
             else
             {
+                var pooled = irType?.IsPooledAsyncStateMachine == true;
+                if (pooled) _pooledBoxTypeCpp = typeCpp;
                 block.Instructions.Add(new IRNewObj
                 {
                     TypeCppName = typeCpp,
                     CtorName = ctorName,
                     ResultVar = tmp,
                     CtorArgs = { },
+                    Pooled = pooled,
                 });
 
                 // Add ctor args
@@ -964,6 +1005,37 @@ public partial class IRBuilder
         return true;
     }
 
+    /// <summary>
+    /// Find a value type's own implementation of a virtual or interface method, so a
+    /// constrained. callvirt can call it on the address instead of boxing. Interface
+    /// parameters (IEquatable&lt;T&gt;.Equals(T)) are resolved against the declaring instance.
+    /// An explicit implementation (.override) of exactly the called interface method wins;
+    /// otherwise the public method of the same name implements it implicitly.
+    /// BCL value types only qualify once their body is compiled (otherwise it is a stub).
+    /// </summary>
+    private IRMethod? FindValueTypeOverride(IRType valueType, MethodReference methodRef)
+    {
+        var paramTypes = methodRef.Parameters.Select(p =>
+        {
+            var t = p.ParameterType;
+            if (t is GenericParameter { Type: GenericParameterType.Type } gp
+                && methodRef.DeclaringType is GenericInstanceType git && gp.Position < git.GenericArguments.Count)
+                t = git.GenericArguments[gp.Position];
+            return ResolveTypeRefOperand(t);
+        }).ToList();
+
+        bool Callable(IRMethod m) =>
+            !m.IsStatic && !m.IsConstructor && !m.IsAbstract
+            && (m.BasicBlocks.Count > 0 || valueType.SourceKind != AssemblyKind.BCL)
+            && m.Parameters.Count == paramTypes.Count
+            && m.Parameters.Select(p => p.ILTypeName).SequenceEqual(paramTypes);
+
+        var declaringType = ResolveTypeRefOperand(methodRef.DeclaringType);
+        return valueType.Methods.FirstOrDefault(m => Callable(m)
+                   && m.ExplicitOverrides.Contains((declaringType, methodRef.Name)))
+               ?? valueType.Methods.FirstOrDefault(m => Callable(m) && m.Name == methodRef.Name);
+    }
+
     /// <summary>
     /// Check if an IR method matches a Cecil MethodReference by parameter types
     /// (for vtable dispatch slot lookup).
@@ -74,6 +74,7 @@ public partial class IRBuilder
                             // Collect generic method instantiations
                             if (methodRef is GenericInstanceMethod gim)
                                 CollectGenericMethod(gim);
+                            CollectSpanConversionTypes(methodRef);
                             break;
                         case FieldReference fieldRef:
                             CollectGenericType(fieldRef.DeclaringType);
@@ -251,6 +252,10 @@ public partial class IRBuilder
             var isCancellationBcl = IsCancellationBclGenericType(info.OpenTypeName);
             var isAsyncEnumerableBcl = IsAsyncEnumerableBclGenericType(info.OpenTypeName);
             var isSyntheticBcl = isAsyncBcl || isSpanBcl || isCollectionBcl || isCancellationBcl || isAsyncEnumerableBcl;
+            var isParallelQueryBcl = IsParallelQueryBclGenericType(info.OpenTypeName);
+            var isChannelBcl = IsChannelBclGenericType(info.OpenTypeName);
+            var isThreadLocalBcl = IsThreadLocalBclGenericType(info.OpenTypeName);
+            var isInnerExceptionsBcl = IsAggregateInnerExceptionsType(key);
 
             // Skip types we can't resolve — except synthetic BCL types
             if (info.CecilOpenType == null && !isSyntheticBcl) continue;
@@ -354,6 +359,7 @@ public partial class IRBuilder
                 IsSealed = openType?.IsSealed ?? true,
                 IsGenericInstance = true,
                 IsDelegate = isDelegate,
+                IsPooledAsyncStateMachine = openType != null && IsPooledAsyncStateMachine(openType),
                 GenericArguments = info.TypeArguments,
                 IsRuntimeProvided = isSyntheticBcl && !isCollectionBcl,
                 SourceKind = isSyntheticBcl ? AssemblyKind.BCL
@@ -418,6 +424,10 @@ public partial class IRBuilder
             {
                 irType.Fields.AddRange(CreateAsyncEnumerableSyntheticFields(info.OpenTypeName, irType, typeParamMap));
             }
+            else if (isParallelQueryBcl || isChannelBcl || isThreadLocalBcl || isInnerExceptionsBcl)
+            {
+                // Opaque: no fields
+            }
             else
             {
                 foreach (var fieldDef in openType!.Fields)
@@ -430,6 +440,7 @@ public partial class IRBuilder
                         FieldTypeName = fieldTypeName,
                         IsStatic = fieldDef.IsStatic,
                         IsPublic = fieldDef.IsPublic,
+                        IsThreadStatic = fieldDef.IsStatic && IsThreadStaticField(fieldDef),
                         DeclaringType = irType,
                     };
                     if (fieldDef.IsStatic)
@@ -446,8 +457,10 @@ public partial class IRBuilder
             _module.Types.Add(irType);
             _typeCache[key] = irType;
 
-            // Methods: skip entirely for async/collection/cancellation/async-enumerable BCL types (all calls are intercepted)
-            if (openType != null && !isAsyncBcl && !isCollectionBcl && !isCancellationBcl && !isAsyncEnumerableBcl)
+            // Methods: skip entirely for async/collection/cancellation/async-enumerable/PLINQ/channel/ThreadLocal
+            // BCL types and AggregateException.InnerExceptions (all calls are intercepted)
+            if (openType != null && !isAsyncBcl && !isCollectionBcl && !isCancellationBcl && !isAsyncEnumerableBcl
+                && !isParallelQueryBcl && !isChannelBcl && !isThreadLocalBcl && !isInnerExceptionsBcl)
             {
                 foreach (var methodDef in openType.Methods)
                 {
@@ -470,6 +483,12 @@ public partial class IRBuilder
                         IsStaticConstructor = methodDef.IsConstructor && methodDef.IsStatic,
                     };
 
+                    // Explicit interface overrides, with the interface instantiated
+                    foreach (var ovr in methodDef.Overrides)
+                    {
+                        irMethod.ExplicitOverrides.Add((ResolveGenericTypeName(ovr.DeclaringType, typeParamMap), ovr.Name));
+                    }
+
                     // Parameters
                     foreach (var paramDef in methodDef.Parameters)
                     {
@@ -539,8 +558,10 @@ public partial class IRBuilder
                     irType.BaseType = baseType;
             }
 
-            // Interfaces (Cecil flattens the list)
-            foreach (var iface in openType.Interfaces)
+            // Interfaces (Cecil flattens the list); opaque PLINQ and InnerExceptions handles implement none
+            var interfaces = IsParallelQueryBclGenericType(info.OpenTypeName) || IsAggregateInnerExceptionsType(key)
+                ? Enumerable.Empty<InterfaceImplementation>() : openType.Interfaces;
+            foreach (var iface in interfaces)
             {
                 var ifaceName = ResolveGenericTypeName(iface.InterfaceType, typeParamMap);
                 if (_typeCache.TryGetValue(ifaceName, out var ifaceType))
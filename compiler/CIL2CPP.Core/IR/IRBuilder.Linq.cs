@@ -1,19 +1,143 @@
+using System.Text.RegularExpressions;
 using Mono.Cecil;
 
 namespace CIL2CPP.Core.IR;
 
 /// <summary>
 /// LINQ extension method interception (System.Linq.Enumerable).
-/// Generates inline C++ code for the most common LINQ operations.
-/// Operates eagerly (no deferred execution) on arrays and collections.
+///
+/// Operator chains are fused: Where and Select add a stage to a query instead
+/// of running it, and the operator that consumes the query (Sum, Count, First,
+/// ToList, ...) emits one loop over the original source with every stage
+/// inlined into its body, so xs.Where(p).Select(f).Sum() touches each element
+/// once and allocates nothing. Lambdas whose delegate is created in the method
+/// (ldftn + newobj, including the compiler's cached static lambdas) are called
+/// directly instead of through Delegate::method_ptr.
+///
+/// A query that escapes keeps deferred semantics where the IR allows it: one
+/// stored to a local that only LINQ operators read captures its source and
+/// delegates, and each reader runs the fused loop (FinalizeLinqQueries).
+/// Anything else becomes a lazy query object (runtime LinqDeferredType) that
+/// runs the stages as it is enumerated; only parallel queries and element types
+/// without an IEnumerable&lt;T&gt; in the module are materialized into an array.
+///
+/// Sources are arrays, List&lt;T&gt; and user IEnumerable&lt;T&gt; types; the
+/// loop itself is cil2cpp::linq_for_each (runtime linq.h). Sum, Min, Max,
+/// Average and Contains directly on a source of primitives call linq_sum etc.,
+/// which run the SIMD kernels of vector_ops.h on arrays and lists.
+///
+/// System.Linq.ParallelEnumerable goes through the same model: AsParallel marks
+/// the query parallel, WithDegreeOfParallelism / WithCancellation set its loop
+/// options, and Sum, Count, Aggregate(func), the combining Aggregate overload
+/// and ForAll run the fused stages on the fork-join layer (runtime parallel.h).
+/// Every other operator on a parallel query runs the sequential loop, which is
+/// one of the results PLINQ is allowed to produce.
 /// </summary>
 public partial class IRBuilder
 {
     private static bool IsLinqEnumerableType(TypeReference typeRef)
     {
-        return typeRef.FullName == "System.Linq.Enumerable";
+        return typeRef.FullName is "System.Linq.Enumerable" or "System.Linq.ParallelEnumerable";
     }
 
+    /// <summary>
+    /// ParallelQuery&lt;T&gt; / OrderedParallelQuery&lt;T&gt; are opaque handles: every
+    /// operator on them is intercepted, so their specializations get no fields
+    /// or method bodies (the BCL ones reference PLINQ internals).
+    /// </summary>
+    internal static bool IsParallelQueryBclGenericType(string openTypeName)
+    {
+        return openTypeName is "System.Linq.ParallelQuery`1" or "System.Linq.OrderedParallelQuery`1";
+    }
+
+    // ── Query model ──────────────────────────────────────────────
+
+    /// <summary>
+    /// A Where (filter) or Select (projection) stage. DirectFunction is set when the
+    /// delegate's target method is known; DirectTargetCpp is its declaring type for
+    /// instance (closure / cached lambda) methods, null for static ones.
+    /// </summary>
+    private sealed record LinqStage(bool IsWhere, string DelegateExpr,
+        string InTypeCpp, string OutTypeCpp, string OutTypeIL,
+        string? DirectFunction, string? DirectTargetCpp);
+
+    /// <summary>
+    /// A delegate consumed by a terminal operator (Aggregate's func, ForAll's action),
+    /// with its parameter and return types; DirectFunction as for <see cref="LinqStage"/>.
+    /// </summary>
+    private sealed record LinqFunc(string DelegateExpr, IReadOnlyList<string> ParamTypesCpp,
+        string ReturnTypeCpp, string? DirectFunction, string? DirectTargetCpp);
+
+    private sealed class LinqQuery
+    {
+        public string Source { get; set; } = "";
+        public string SourceElemCpp { get; init; } = "";
+        public string SourceElemIL { get; init; } = "";
+        /// <summary>&amp;List&lt;T&gt;_TypeInfo, or nullptr if List&lt;T&gt; is not in the module.</summary>
+        public string ListTypeInfo { get; init; } = "nullptr";
+        /// <summary>cil2cpp::LinqEnumerableTypes initializer, or null if T has no enumerable path.</summary>
+        public string? EnumerableTypes { get; init; }
+        public List<LinqStage> Stages { get; init; } = new();
+        /// <summary>AsParallel: Sum/Count/Aggregate/ForAll run on the fork-join layer.</summary>
+        public bool Parallel { get; set; }
+        /// <summary>WithDegreeOfParallelism / WithCancellation arguments, or null.</summary>
+        public string? MaxDegree { get; set; }
+        public string? Token { get; set; }
+
+        public string ElemCpp => Stages.Count > 0 ? Stages[^1].OutTypeCpp : SourceElemCpp;
+        public string ElemIL => Stages.Count > 0 ? Stages[^1].OutTypeIL : SourceElemIL;
+
+        public LinqQuery Clone() => new()
+        {
+            Source = Source,
+            SourceElemCpp = SourceElemCpp,
+            SourceElemIL = SourceElemIL,
+            ListTypeInfo = ListTypeInfo,
+            EnumerableTypes = EnumerableTypes,
+            Stages = new List<LinqStage>(Stages),
+            Parallel = Parallel,
+            MaxDegree = MaxDegree,
+            Token = Token,
+        };
+    }
+
+    private enum LinqTerminalKind
+    {
+        Count, Any, All, First, FirstOrDefault, Last, Sum, Min, Max, Average, Contains,
+        ToArray, ToList, Reverse, Aggregate, ForAll,
+        /// <summary>Where/Select result used by something other than a LINQ operator.</summary>
+        Materialize,
+    }
+
+    /// <summary>
+    /// Value is Contains' item or Aggregate's seed. Func is Aggregate's accumulator or
+    /// ForAll's action; Combine and Selector are Aggregate's combine and result selector.
+    /// </summary>
+    private sealed record LinqTerminal(LinqTerminalKind Kind, LinqStage? Predicate = null, string? Value = null,
+        LinqFunc? Func = null, LinqFunc? Combine = null, LinqFunc? Selector = null);
+
+    /// <summary>Code emitted for one query, kept so later operators can fuse or re-emit it.</summary>
+    private sealed class LinqEmission
+    {
+        public LinqQuery Query { get; set; } = null!;
+        public LinqTerminal Terminal { get; set; } = null!;
+        public int Id { get; init; }
+        public string ResultVar { get; init; } = "";
+        public List<IRInstruction> Instructions { get; set; } = new();
+        /// <summary>Folded into a later operator; the instructions are dropped at the end of the method.</summary>
+        public bool Fused { get; set; }
+        /// <summary>Turned into captures of a deferred query stored in a local.</summary>
+        public bool Deferred { get; set; }
+    }
+
+    private static readonly Regex LinqIdentifierRegex = new(@"^[A-Za-z_]\w*$", RegexOptions.Compiled);
+    private static readonly Regex LinqLocalRegex = new(@"^loc_\d+$", RegexOptions.Compiled);
+    private static readonly Regex LinqTempRegex = new(@"^__t\d+$", RegexOptions.Compiled);
+    private static readonly Regex LinqPointerCastRegex = new(@"^\([\w:]+\s*\*\)\s*", RegexOptions.Compiled);
+    private static readonly Regex LinqIntegerLiteralRegex = new(@"^-?\d+$", RegexOptions.Compiled);
+
+    // ── Interception ─────────────────────────────────────────────
+
     /// <summary>
     /// Intercept System.Linq.Enumerable extension method calls.
     /// Returns true if the call was handled.
@@ -28,15 +152,16 @@ public partial class IRBuilder
         string? elemTypeCpp = null;
         string? elemTypeIL = null;
         string? resultTypeCpp = null;
+        string? resultTypeIL = null;
 
         if (gim != null && gim.GenericArguments.Count > 0)
         {
             elemTypeIL = ResolveTypeRefOperand(gim.GenericArguments[0]);
-            elemTypeCpp = CppNameMapper.GetCppTypeName(elemTypeIL);
+            elemTypeCpp = CppNameMapper.GetCppTypeForDecl(elemTypeIL);
             if (gim.GenericArguments.Count > 1)
             {
-                var rIL = ResolveTypeRefOperand(gim.GenericArguments[1]);
-                resultTypeCpp = CppNameMapper.GetCppTypeName(rIL);
+                resultTypeIL = ResolveTypeRefOperand(gim.GenericArguments[1]);
+                resultTypeCpp = CppNameMapper.GetCppTypeForDecl(resultTypeIL);
             }
         }
 
@@ -48,81 +173,324 @@ public partial class IRBuilder
             if (paramType is GenericInstanceType git && git.GenericArguments.Count > 0)
             {
                 elemTypeIL = ResolveTypeRefOperand(git.GenericArguments[0]);
-                elemTypeCpp = CppNameMapper.GetCppTypeName(elemTypeIL);
+                elemTypeCpp = CppNameMapper.GetCppTypeForDecl(elemTypeIL);
             }
         }
 
-        bool elemIsValue = elemTypeIL != null && CppNameMapper.IsValueType(elemTypeIL);
+        if (elemTypeCpp == null || elemTypeIL == null) return false;
+        var paramCount = methodRef.Parameters.Count;
 
         switch (methodRef.Name)
         {
-            case "Count" when methodRef.Parameters.Count == 1:
-                return EmitLinqCount(block, stack, ref tempCounter);
+            case "Where" when paramCount == 2:
+            {
+                var pred = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                query.Stages.Add(MakeLinqStage(block, true, pred, elemTypeCpp, elemTypeCpp, elemTypeIL));
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Materialize));
+                return true;
+            }
 
-            case "Count" when methodRef.Parameters.Count == 2:
-                return EmitLinqCountPredicate(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "Select" when paramCount == 2 && resultTypeCpp != null && resultTypeIL != null:
+            {
+                var sel = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                query.Stages.Add(MakeLinqStage(block, false, sel, elemTypeCpp, resultTypeCpp, resultTypeIL));
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Materialize));
+                return true;
+            }
 
-            case "Any" when methodRef.Parameters.Count == 1:
-                return EmitLinqAnyNoArg(block, stack, ref tempCounter);
+            // Count(p) / Any(p) are Where(p).Count() / Where(p).Any()
+            case "Count" or "Any" when paramCount is 1 or 2:
+            {
+                var pred = paramCount == 2 ? stack.Pop() : null;
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                if (pred != null)
+                    query.Stages.Add(MakeLinqStage(block, true, pred, elemTypeCpp, elemTypeCpp, elemTypeIL));
+                var kind = methodRef.Name == "Count" ? LinqTerminalKind.Count : LinqTerminalKind.Any;
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(kind));
+                return true;
+            }
 
-            case "Any" when methodRef.Parameters.Count == 2:
-                return EmitLinqAnyPredicate(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "All" when paramCount == 2:
+            {
+                var pred = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                var predicate = MakeLinqStage(block, true, pred, elemTypeCpp, elemTypeCpp, elemTypeIL);
+                EmitLinqQuery(block, stack, ref tempCounter, query,
+                    new LinqTerminal(LinqTerminalKind.All, Predicate: predicate));
+                return true;
+            }
 
-            case "All" when methodRef.Parameters.Count == 2:
-                return EmitLinqAll(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "Contains" when paramCount == 2:
+            {
+                var value = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                EmitLinqQuery(block, stack, ref tempCounter, query,
+                    new LinqTerminal(LinqTerminalKind.Contains, Value: value));
+                return true;
+            }
 
-            case "First" when methodRef.Parameters.Count == 1:
-                return EmitLinqFirst(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "AsParallel" or "AsSequential" or "AsOrdered" or "AsUnordered" when paramCount == 1 && gim != null:
+            {
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                if (methodRef.Name == "AsParallel") query.Parallel = true;
+                if (methodRef.Name == "AsSequential") query.Parallel = false;
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Materialize));
+                return true;
+            }
 
-            case "FirstOrDefault" when methodRef.Parameters.Count == 1:
-                return EmitLinqFirstOrDefault(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "WithDegreeOfParallelism" or "WithCancellation" when paramCount == 2:
+            {
+                var value = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                if (methodRef.Name == "WithDegreeOfParallelism") query.MaxDegree = value;
+                else query.Token = value;
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Materialize));
+                return true;
+            }
 
-            case "Last" when methodRef.Parameters.Count == 1:
-                return EmitLinqLast(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+            case "ForAll" when paramCount == 2:
+            {
+                var action = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                var func = MakeLinqFunc(block, action, new[] { elemTypeCpp }, "void");
+                EmitLinqQuery(block, stack, ref tempCounter, query,
+                    new LinqTerminal(LinqTerminalKind.ForAll, Func: func));
+                return true;
+            }
 
-            case "Sum" when methodRef.Parameters.Count == 1 && elemTypeCpp is "int32_t" or "int64_t" or "double" or "float":
-                return EmitLinqSum(block, stack, ref tempCounter, elemTypeCpp!);
+            // Aggregate(func), Aggregate(seed, func[, resultSelector]) and PLINQ's
+            // Aggregate(seed, update, combine, resultSelector)
+            case "Aggregate" when paramCount == 2 && gim?.GenericArguments.Count == 1:
+            {
+                var func = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Aggregate,
+                    Func: MakeLinqFunc(block, func, new[] { elemTypeCpp, elemTypeCpp }, elemTypeCpp)));
+                return true;
+            }
+            case "Aggregate" when paramCount is 3 or 4 or 5 && resultTypeCpp != null
+                && methodRef.Parameters[1].ParameterType is GenericParameter:
+            {
+                var accCpp = resultTypeCpp;
+                var resultCpp = gim!.GenericArguments.Count > 2
+                    ? CppNameMapper.GetCppTypeForDecl(ResolveTypeRefOperand(gim.GenericArguments[2]))
+                    : accCpp;
+                var selector = paramCount >= 4 ? stack.Pop() : null;
+                var combine = paramCount == 5 ? stack.Pop() : null;
+                var func = stack.Pop();
+                var seed = stack.Pop();
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                EmitLinqQuery(block, stack, ref tempCounter, query, new LinqTerminal(LinqTerminalKind.Aggregate,
+                    Value: seed,
+                    Func: MakeLinqFunc(block, func, new[] { accCpp, elemTypeCpp }, accCpp),
+                    Combine: combine != null ? MakeLinqFunc(block, combine, new[] { accCpp, accCpp }, accCpp) : null,
+                    Selector: selector != null ? MakeLinqFunc(block, selector, new[] { accCpp }, resultCpp) : null));
+                return true;
+            }
 
-            case "Min" when methodRef.Parameters.Count == 1 && elemTypeCpp is "int32_t" or "int64_t" or "double" or "float":
-                return EmitLinqMinMax(block, stack, ref tempCounter, elemTypeCpp!, isMin: true);
+            case "Sum" or "Min" or "Max" or "Average" when paramCount == 1
+                && elemTypeCpp is "int32_t" or "int64_t" or "double" or "float":
+            case "First" or "FirstOrDefault" or "Last" or "ToArray" or "ToList" or "Reverse" when paramCount == 1:
+            {
+                var query = TakeLinqQuery(block, stack, stack.Pop(), elemTypeCpp, elemTypeIL, ref tempCounter);
+                EmitLinqQuery(block, stack, ref tempCounter, query,
+                    new LinqTerminal(Enum.Parse<LinqTerminalKind>(methodRef.Name)));
+                return true;
+            }
+        }
 
-            case "Max" when methodRef.Parameters.Count == 1 && elemTypeCpp is "int32_t" or "int64_t" or "double" or "float":
-                return EmitLinqMinMax(block, stack, ref tempCounter, elemTypeCpp!, isMin: false);
+        return false;
+    }
 
-            case "ToArray" when methodRef.Parameters.Count == 1:
-                return EmitLinqToArray(block, stack, ref tempCounter, elemTypeCpp);
+    /// <summary>
+    /// Start a query over <paramref name="source"/>. If the source is the result of a
+    /// Where/Select emitted earlier that nothing else uses, that query is continued
+    /// instead and its materialization dropped.
+    /// </summary>
+    private LinqQuery TakeLinqQuery(IRBasicBlock block, Stack<string> stack, string source,
+        string elemTypeCpp, string elemTypeIL, ref int tempCounter)
+    {
+        var pending = _linqEmissions.LastOrDefault(e => e.ResultVar == source && !e.Fused && !e.Deferred
+            && e.Terminal.Kind == LinqTerminalKind.Materialize);
+        if (pending != null && !stack.Contains(source) && CanFuseLinqQuery(block, pending))
+        {
+            pending.Fused = true;
+            return pending.Query.Clone();
+        }
 
-            case "ToList" when methodRef.Parameters.Count == 1:
-                return EmitLinqToList(block, stack, ref tempCounter, elemTypeCpp, elemTypeIL);
+        return new LinqQuery
+        {
+            Source = SpillLinqSourceBeforeLabel(block, source, ref tempCounter),
+            SourceElemCpp = elemTypeCpp,
+            SourceElemIL = elemTypeIL,
+            ListTypeInfo = LinqListTypeInfo(elemTypeIL),
+            EnumerableTypes = GetLinqEnumerableTypes(elemTypeIL),
+        };
+    }
 
-            case "Where" when methodRef.Parameters.Count == 2:
-                return EmitLinqWhere(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+    /// <summary>
+    /// A source temp assigned before a label (usually the cached-lambda check between
+    /// the call and the operator) is pre-declared as cil2cpp::Object*, which an
+    /// interface pointer does not convert to. Copy it through an explicit cast right
+    /// after its only assignment and read the copy instead.
+    /// </summary>
+    private static string SpillLinqSourceBeforeLabel(IRBasicBlock block, string source, ref int tempCounter)
+    {
+        if (!LinqTempRegex.IsMatch(source)) return source;
+        var prefix = source + " = ";
+        var defs = block.Instructions.Select((instr, index) => (instr, index))
+            .Where(d => d.instr is not IRRawCpp && d.instr.ToCpp().StartsWith(prefix, StringComparison.Ordinal))
+            .ToList();
+        if (defs.Count != 1) return source;
+        var (def, at) = defs[0];
+        if (!block.Instructions.Skip(at + 1).Any(i => i is IRLabel)) return source;
 
-            case "Select" when methodRef.Parameters.Count == 2 && resultTypeCpp != null:
-                return EmitLinqSelect(block, stack, ref tempCounter,
-                    elemTypeCpp, elemIsValue, resultTypeCpp);
+        var spill = $"__t{tempCounter++}";
+        block.Instructions.Insert(at + 1, new IRAssign { Target = spill, Value = $"(cil2cpp::Object*){source}" });
+        block.Instructions[at + 1].DebugInfo = def.DebugInfo;
+        return spill;
+    }
 
-            case "Contains" when methodRef.Parameters.Count == 2:
-                return EmitLinqContains(block, stack, ref tempCounter, elemTypeCpp, elemIsValue);
+    /// <summary>
+    /// A pending query can move to the current operator if its result is not used
+    /// elsewhere and nothing emitted since changes the source or delegates it reads.
+    /// </summary>
+    private bool CanFuseLinqQuery(IRBasicBlock block, LinqEmission pending)
+    {
+        var query = pending.Query;
+        var inputs = query.Stages.Select(s => s.DelegateExpr).Prepend(query.Source).ToList();
+        if (!inputs.All(LinqIdentifierRegex.IsMatch)) return false;
+        foreach (var option in new[] { query.MaxDegree, query.Token })
+        {
+            if (option == null || LinqIntegerLiteralRegex.IsMatch(option)) continue;
+            if (!LinqIdentifierRegex.IsMatch(option)) return false;
+            inputs.Add(option);
+        }
 
-            case "Reverse" when methodRef.Parameters.Count == 1:
-                return EmitLinqReverse(block, stack, ref tempCounter, elemTypeCpp);
+        var start = block.Instructions.IndexOf(pending.Instructions[^1]);
+        if (start < 0) return false;
+        var dead = FusedLinqInstructions();
+        for (int k = start + 1; k < block.Instructions.Count; k++)
+        {
+            var instr = block.Instructions[k];
+            if (dead.Contains(instr)) continue;
+            if (ReferencesLinqVariable(instr, pending.ResultVar)) return false;
+            if (inputs.Any(v => BoundsCheckElimination.MayWrite(instr, v))) return false;
         }
+        return true;
+    }
 
-        return false;
+    private void EmitLinqQuery(IRBasicBlock block, Stack<string> stack, ref int tempCounter,
+        LinqQuery query, LinqTerminal terminal)
+    {
+        var id = tempCounter;
+        var tmp = $"__t{tempCounter++}";
+        var emission = new LinqEmission
+        {
+            Query = query,
+            Terminal = terminal,
+            Id = id,
+            ResultVar = tmp,
+            Instructions = BuildLinqQueryCode(query, terminal, id, tmp),
+        };
+        block.Instructions.AddRange(emission.Instructions);
+        _linqEmissions.Add(emission);
+        if (terminal.Kind != LinqTerminalKind.ForAll) stack.Push(tmp);
     }
 
-    // ── Helpers ──────────────────────────────────────────────────
-    // All generated code uses FLAT layout (no compound blocks wrapping __tN).
-    // __tN assignment is always on a separate IRRawCpp so AddAutoDeclarations
-    // can correctly prepend `auto`.
-    // Loop variables use __linq_{prefix}{id} to avoid collisions.
+    // ── Delegates ────────────────────────────────────────────────
 
-    private static string CastToArray(string sourceExpr)
-        => $"reinterpret_cast<cil2cpp::Array*>({sourceExpr})";
+    private LinqStage MakeLinqStage(IRBasicBlock block, bool isWhere, string delegateExpr,
+        string inTypeCpp, string outTypeCpp, string outTypeIL)
+    {
+        var lambda = ResolveLinqLambda(block, delegateExpr);
+        if (lambda == null)
+            return new LinqStage(isWhere, delegateExpr, inTypeCpp, outTypeCpp, outTypeIL, null, null);
+
+        var typeCpp = GetMangledTypeNameForRef(lambda.DeclaringType);
+        return new LinqStage(isWhere, delegateExpr, inTypeCpp, outTypeCpp, outTypeIL,
+            CppNameMapper.MangleMethodName(typeCpp, lambda.Name), lambda.HasThis ? typeCpp : null);
+    }
+
+    private LinqFunc MakeLinqFunc(IRBasicBlock block, string delegateExpr,
+        IReadOnlyList<string> paramTypesCpp, string returnTypeCpp)
+    {
+        var lambda = ResolveLinqLambda(block, delegateExpr, paramTypesCpp.Count);
+        if (lambda == null)
+            return new LinqFunc(delegateExpr, paramTypesCpp, returnTypeCpp, null, null);
 
-    private static string ArrElem(string arrVar, string idxVar, string elemTypeCpp)
-        => $"static_cast<{elemTypeCpp}*>(cil2cpp::array_data({arrVar}))[{idxVar}]";
+        var typeCpp = GetMangledTypeNameForRef(lambda.DeclaringType);
+        return new LinqFunc(delegateExpr, paramTypesCpp, returnTypeCpp,
+            CppNameMapper.MangleMethodName(typeCpp, lambda.Name), lambda.HasThis ? typeCpp : null);
+    }
+
+    /// <summary>
+    /// Find the method a delegate value was created from, if every definition of it in
+    /// this method is a delegate over the same ldftn target: newobj directly, through a
+    /// local, or through the compiler's lambda cache field (&lt;&gt;9__N_M, which only ever
+    /// holds that lambda). Returns null when the delegate must be called indirectly.
+    /// </summary>
+    private MethodReference? ResolveLinqLambda(IRBasicBlock block, string delegateExpr, int arity = 1)
+    {
+        MethodReference? resolved = null;
+        var work = new Stack<string>();
+        var seen = new HashSet<string>();
+        work.Push(delegateExpr);
+
+        while (work.Count > 0)
+        {
+            var expr = work.Pop();
+            if (!seen.Add(expr)) continue;
+            if (!LinqIdentifierRegex.IsMatch(expr)) return null;
+
+            bool defined = false;
+            foreach (var instr in block.Instructions)
+            {
+                switch (instr)
+                {
+                    case IRDelegateCreate create when create.ResultVar == expr:
+                        if (!_functionPointerMethods.TryGetValue(create.FunctionPtrExpr, out var method)
+                            || method.HasThis == (create.TargetExpr == "nullptr")
+                            || (resolved != null && resolved.FullName != method.FullName))
+                            return null;
+                        resolved = method;
+                        defined = true;
+                        break;
+
+                    case IRAssign assign when assign.Target == expr:
+                        work.Push(LinqPointerCastRegex.Replace(assign.Value, ""));
+                        defined = true;
+                        break;
+
+                    case IRStaticFieldAccess { IsStore: false } load when load.ResultVar == expr:
+                        if (!load.FieldCppName.StartsWith("f___9__")) return null;
+                        var stores = block.Instructions.OfType<IRStaticFieldAccess>()
+                            .Where(s => s.IsStore && s.TypeCppName == load.TypeCppName
+                                && s.FieldCppName == load.FieldCppName)
+                            .ToList();
+                        if (stores.Count == 0) return null;
+                        foreach (var store in stores) work.Push(store.StoreValue ?? "");
+                        defined = true;
+                        break;
+
+                    default:
+                        if (BoundsCheckElimination.MayWrite(instr, expr)) return null;
+                        break;
+                }
+            }
+            if (!defined) return null;
+        }
+
+        if (resolved == null || resolved.Parameters.Count != arity
+            || resolved.HasGenericParameters || resolved is GenericInstanceMethod
+            || resolved.DeclaringType is GenericInstanceType || resolved.DeclaringType.HasGenericParameters
+            || !_typeCache.TryGetValue(ResolveCacheKey(resolved.DeclaringType), out var declType)
+            || declType.IsValueType)
+            return null;
+        return resolved;
+    }
 
     /// <summary>
     /// Generate inline C++ for calling a delegate with one argument.
@@ -137,404 +505,605 @@ public partial class IRBuilder
                $"else {resultVar} = (({staticFn})({delVar}->method_ptr))({argExpr});";
     }
 
-    // ── Terminal operations ────────────────────────────────────
+    /// <summary>Declare <paramref name="resultVar"/> as a stage's delegate applied to <paramref name="arg"/>.</summary>
+    private static string LinqStageCall(LinqStage stage, string delVar, string arg, string resultVar)
+    {
+        var returnTypeCpp = stage.IsWhere ? "bool" : stage.OutTypeCpp;
+        if (stage.DirectFunction == null)
+            return $"{returnTypeCpp} {resultVar}; {DelegateCallStmt(delVar, arg, stage.InTypeCpp, returnTypeCpp, resultVar)}";
+        var args = stage.DirectTargetCpp != null ? $"({stage.DirectTargetCpp}*){delVar}->target, {arg}" : arg;
+        return $"{returnTypeCpp} {resultVar} = {stage.DirectFunction}({args});";
+    }
 
-    private bool EmitLinqCount(IRBasicBlock block, Stack<string> stack, ref int tempCounter)
+    /// <summary>
+    /// Expression calling a terminal's delegate: directly when the lambda is known,
+    /// otherwise through method_ptr with or without the target. The arguments appear
+    /// in both arms of the conditional, so they must be plain names.
+    /// </summary>
+    private static string LinqFuncCall(LinqFunc func, string delVar, params string[] args)
     {
-        var src = stack.Pop();
-        var tmp = $"__t{tempCounter++}";
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"{tmp} = cil2cpp::array_length({CastToArray(src)});"
-        });
-        stack.Push(tmp);
-        return true;
+        var argList = string.Join(", ", args);
+        if (func.DirectFunction != null)
+            return func.DirectTargetCpp != null
+                ? $"{func.DirectFunction}(({func.DirectTargetCpp}*){delVar}->target, {argList})"
+                : $"{func.DirectFunction}({argList})";
+        var paramList = string.Join(", ", func.ParamTypesCpp);
+        var instFn = $"{func.ReturnTypeCpp}(*)(cil2cpp::Object*, {paramList})";
+        var staticFn = $"{func.ReturnTypeCpp}(*)({paramList})";
+        return $"({delVar}->target ? (({instFn})({delVar}->method_ptr))({delVar}->target, {argList}) " +
+               $": (({staticFn})({delVar}->method_ptr))({argList}))";
     }
 
-    private bool EmitLinqCountPredicate(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
+    // ── Sources ──────────────────────────────────────────────────
+
+    /// <summary>
+    /// Interface proxies for enumerating user IEnumerable&lt;T&gt; sources, or null.
+    /// Arrays carry their element's TypeInfo, so the runtime can only tell a T[] from an
+    /// IEnumerable&lt;T&gt; object when no type assignable to T implements IEnumerable&lt;T&gt;.
+    /// </summary>
+    private string? GetLinqEnumerableTypes(string elemTypeIL)
     {
-        if (elemTypeCpp == null) return false;
-        var pred = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var del = $"__linq_d{id}";
-        var cnt = $"__linq_c{id}";
-        var idx = $"__linq_i{id}";
+        if (!_typeCache.TryGetValue($"System.Collections.Generic.IEnumerable`1<{elemTypeIL}>", out var enumerable)
+            || !_typeCache.TryGetValue($"System.Collections.Generic.IEnumerator`1<{elemTypeIL}>", out var enumerator)
+            || !_typeCache.TryGetValue("System.Collections.IEnumerator", out var enumeratorBase))
+            return null;
 
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {del} = (cil2cpp::Delegate*)({pred}); " +
-                $"int32_t {cnt} = 0; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"bool __r; {DelegateCallStmt(del, "__e", elemTypeCpp, "bool", "__r")} " +
-                $"if (__r) {cnt}++; }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {cnt};" });
-        stack.Push(tmp);
-        return true;
+        if (_module.Types.Any(t => !t.IsInterface && LinqTypeImplements(t, enumerable)
+                && (elemTypeIL == "System.Object" || LinqTypeIsOrImplements(t, elemTypeIL))))
+            return null;
+
+        var disposable = _typeCache.TryGetValue("System.IDisposable", out var disposableType)
+            ? $"&{disposableType.CppName}_TypeInfo" : "nullptr";
+        return $"{{ &{enumerable.CppName}_TypeInfo, &{enumerator.CppName}_TypeInfo, " +
+               $"&{enumeratorBase.CppName}_TypeInfo, {disposable} }}";
     }
 
-    private bool EmitLinqAnyNoArg(IRBasicBlock block, Stack<string> stack, ref int tempCounter)
+    /// <summary>&amp;List&lt;T&gt;_TypeInfo, or nullptr if List&lt;T&gt; is not in the module.</summary>
+    private string LinqListTypeInfo(string elemTypeIL) =>
+        _typeCache.TryGetValue($"System.Collections.Generic.List`1<{elemTypeIL}>", out var listType)
+            ? $"&{listType.CppName}_TypeInfo" : "nullptr";
+
+    private static bool LinqTypeImplements(IRType type, IRType iface)
     {
-        var src = stack.Pop();
-        var tmp = $"__t{tempCounter++}";
-        block.Instructions.Add(new IRRawCpp
+        for (var t = type; t != null; t = t.BaseType)
         {
-            Code = $"{tmp} = (cil2cpp::array_length({CastToArray(src)}) > 0);"
-        });
-        stack.Push(tmp);
-        return true;
+            if (t.Interfaces.Contains(iface)) return true;
+        }
+        return false;
     }
 
-    private bool EmitLinqAnyPredicate(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
+    private static bool LinqTypeIsOrImplements(IRType type, string ilFullName)
     {
-        if (elemTypeCpp == null) return false;
-        var pred = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var del = $"__linq_d{id}";
-        var found = $"__linq_f{id}";
-        var idx = $"__linq_i{id}";
-
-        block.Instructions.Add(new IRRawCpp
+        for (var t = type; t != null; t = t.BaseType)
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {del} = (cil2cpp::Delegate*)({pred}); " +
-                $"bool {found} = false; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"bool __r; {DelegateCallStmt(del, "__e", elemTypeCpp, "bool", "__r")} " +
-                $"if (__r) {{ {found} = true; break; }} }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {found};" });
-        stack.Push(tmp);
-        return true;
+            if (t.ILFullName == ilFullName || t.Interfaces.Any(i => i.ILFullName == ilFullName)) return true;
+        }
+        return false;
     }
 
-    private bool EmitLinqAll(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
+    private string LinqElementTypeInfo(string elemTypeIL)
     {
-        if (elemTypeCpp == null) return false;
-        var pred = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var del = $"__linq_d{id}";
-        var ok = $"__linq_ok{id}";
-        var idx = $"__linq_i{id}";
-
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {del} = (cil2cpp::Delegate*)({pred}); " +
-                $"bool {ok} = true; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"bool __r; {DelegateCallStmt(del, "__e", elemTypeCpp, "bool", "__r")} " +
-                $"if (!__r) {{ {ok} = false; break; }} }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {ok};" });
-        stack.Push(tmp);
-        return true;
+        if (CppNameMapper.IsPrimitive(elemTypeIL))
+            _module.RegisterPrimitiveTypeInfo(elemTypeIL);
+        return $"&{CppNameMapper.MangleTypeName(elemTypeIL)}_TypeInfo";
     }
 
-    private bool EmitLinqFirst(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
-    {
-        if (elemTypeCpp == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
+    // ── Code generation ──────────────────────────────────────────
+    // FLAT layout like the rest of the builder: the query runs in one IRRawCpp and
+    // the __tN result is assigned in a separate one so AddAutoDeclarations can
+    // prepend `auto`. Names use __linq_{prefix}{id}; the loop body is a lambda
+    // passed to linq_for_each that returns false to stop early.
 
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"if ({arr}->length == 0) cil2cpp::throw_invalid_operation();"
-        });
-        block.Instructions.Add(new IRRawCpp
+    private List<IRInstruction> BuildLinqQueryCode(LinqQuery query, LinqTerminal terminal, int id, string resultVar)
+    {
+        var src = $"__linq_o{id}";
+        var code = new List<string> { $"auto* {src} = (cil2cpp::Object*)({query.Source});" };
+        var enumerable = "nullptr";
+        if (query.EnumerableTypes != null)
         {
-            Code = $"{tmp} = {ArrElem(arr, "0", elemTypeCpp)};"
-        });
-        stack.Push(tmp);
-        return true;
-    }
+            code.Add($"static const cil2cpp::LinqEnumerableTypes __linq_et{id} = {query.EnumerableTypes};");
+            enumerable = $"&__linq_et{id}";
+        }
+        var sourceArgs = $"{src}, {query.ListTypeInfo}, {enumerable}";
 
-    private bool EmitLinqFirstOrDefault(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
-    {
-        if (elemTypeCpp == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var defVal = CppNameMapper.GetDefaultValue(elemTypeCpp);
+        // An escaping Where/Select chain stays deferred behind a lazy enumerator object;
+        // parallel queries and element types with no IEnumerable<T> fall back to an array
+        if (terminal.Kind == LinqTerminalKind.Materialize && query.Stages.Count > 0
+            && !query.Parallel && query.Token == null
+            && GetLinqEnumerableTypes(query.ElemIL) is { } resultTypes)
+            return BuildDeferredLinqQueryCode(query, id, resultVar, code, resultTypes, enumerable);
 
-        block.Instructions.Add(new IRRawCpp
+        // Stages: __e0 is the source element, each Select produces the next __eN
+        var body = new List<string>();
+        var current = "__e0";
+        for (int i = 0; i < query.Stages.Count; i++)
         {
-            Code = $"auto* {arr} = {CastToArray(src)};"
-        });
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"{tmp} = ({arr}->length > 0) ? {ArrElem(arr, "0", elemTypeCpp)} : {defVal};"
-        });
-        stack.Push(tmp);
-        return true;
-    }
+            var stage = query.Stages[i];
+            var del = $"__linq_d{id}_{i}";
+            code.Add($"auto* {del} = (cil2cpp::Delegate*)({stage.DelegateExpr});");
+            if (stage.IsWhere)
+            {
+                body.Add($"{LinqStageCall(stage, del, current, $"__r{i}")} if (!__r{i}) return true;");
+            }
+            else
+            {
+                var next = $"__e{i + 1}";
+                body.Add(LinqStageCall(stage, del, current, next));
+                current = next;
+            }
+        }
 
-    private bool EmitLinqLast(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
-    {
-        if (elemTypeCpp == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
+        var elem = query.ElemCpp;
+        var hasFilter = query.Stages.Any(s => s.IsWhere);
+        string? result;
+        string? post = null;
+        bool loop = true;
 
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"if ({arr}->length == 0) cil2cpp::throw_invalid_operation();"
-        });
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"{tmp} = {ArrElem(arr, $"({arr}->length - 1)", elemTypeCpp)};"
-        });
-        stack.Push(tmp);
-        return true;
-    }
+        if (terminal.Func != null) code.Add($"auto* __linq_fa{id} = (cil2cpp::Delegate*)({terminal.Func.DelegateExpr});");
+        if (terminal.Combine != null) code.Add($"auto* __linq_fc{id} = (cil2cpp::Delegate*)({terminal.Combine.DelegateExpr});");
+        if (terminal.Selector != null) code.Add($"auto* __linq_fr{id} = (cil2cpp::Delegate*)({terminal.Selector.DelegateExpr});");
 
-    // ── Aggregate operations ────────────────────────────────────
+        var parallel = query.Parallel && terminal.Kind switch
+        {
+            LinqTerminalKind.Sum or LinqTerminalKind.Count or LinqTerminalKind.ForAll => true,
+            // Aggregate(seed, func) has no way to merge partials and runs sequentially, as in PLINQ
+            LinqTerminalKind.Aggregate => terminal.Value == null || terminal.Combine != null,
+            _ => false,
+        };
+        if (parallel)
+            return BuildParallelLinqQueryCode(query, terminal, id, resultVar, code, body, current, sourceArgs);
+        if (query.Token != null)
+            code.Add($"cil2cpp::ct_throw_if_cancellation_requested({query.Token});");
 
-    private bool EmitLinqSum(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string elemTypeCpp)
-    {
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var sum = $"__linq_s{id}";
-        var idx = $"__linq_i{id}";
+        switch (terminal.Kind)
+        {
+            case LinqTerminalKind.Count when query.Stages.Count == 0:
+                result = $"cil2cpp::linq_count({sourceArgs})";
+                loop = false;
+                break;
+            case LinqTerminalKind.Count:
+                code.Add($"int32_t __linq_c{id} = 0;");
+                body.Add($"__linq_c{id}++; return true;");
+                result = $"__linq_c{id}";
+                break;
+            case LinqTerminalKind.Any:
+                code.Add($"bool __linq_f{id} = false;");
+                body.Add($"__linq_f{id} = true; return false;");
+                result = $"__linq_f{id}";
+                break;
+            case LinqTerminalKind.All:
+            {
+                var del = $"__linq_p{id}";
+                code.Add($"auto* {del} = (cil2cpp::Delegate*)({terminal.Predicate!.DelegateExpr});");
+                code.Add($"bool __linq_ok{id} = true;");
+                body.Add($"{LinqStageCall(terminal.Predicate, del, current, "__rp")} " +
+                         $"if (!__rp) {{ __linq_ok{id} = false; return false; }} return true;");
+                result = $"__linq_ok{id}";
+                break;
+            }
+            case LinqTerminalKind.First or LinqTerminalKind.FirstOrDefault:
+                code.Add($"{elem} __linq_v{id}{{}}; bool __linq_f{id} = false;");
+                body.Add($"__linq_v{id} = {current}; __linq_f{id} = true; return false;");
+                if (terminal.Kind == LinqTerminalKind.First)
+                    post = $"if (!__linq_f{id}) cil2cpp::throw_invalid_operation();";
+                result = $"__linq_v{id}";
+                break;
+            case LinqTerminalKind.Last when query.Stages.Count == 0:
+                code.Add($"{elem} __linq_v{id}{{}};");
+                code.Add($"if (!cil2cpp::linq_try_get_last<{elem}>({sourceArgs}, __linq_v{id})) " +
+                         "cil2cpp::throw_invalid_operation();");
+                result = $"__linq_v{id}";
+                loop = false;
+                break;
+            case LinqTerminalKind.Last:
+                code.Add($"{elem} __linq_v{id}{{}}; bool __linq_f{id} = false;");
+                body.Add($"__linq_v{id} = {current}; __linq_f{id} = true; return true;");
+                post = $"if (!__linq_f{id}) cil2cpp::throw_invalid_operation();";
+                result = $"__linq_v{id}";
+                break;
+            case LinqTerminalKind.Sum or LinqTerminalKind.Min or LinqTerminalKind.Max or LinqTerminalKind.Average
+                when query.Stages.Count == 0:
+                result = $"cil2cpp::linq_{terminal.Kind.ToString().ToLowerInvariant()}<{elem}>({sourceArgs})";
+                // linq_sum<float> returns the double accumulator
+                if (terminal.Kind == LinqTerminalKind.Sum && elem == "float") result = $"static_cast<float>({result})";
+                loop = false;
+                break;
+            case LinqTerminalKind.Sum:
+            {
+                // Integer Sum is checked, as in the BCL; Sum(IEnumerable<float>) accumulates in double
+                var accumulator = elem == "float" ? "double" : elem;
+                code.Add($"{accumulator} __linq_s{id} = 0;");
+                body.Add(elem is "int32_t" or "int64_t"
+                    ? $"__linq_s{id} = cil2cpp::checked_add(__linq_s{id}, {current}); return true;"
+                    : $"__linq_s{id} += {current}; return true;");
+                result = elem == "float" ? $"static_cast<float>(__linq_s{id})" : $"__linq_s{id}";
+                break;
+            }
+            case LinqTerminalKind.Average:
+            {
+                // Int32 values cannot overflow an Int64 total; Int64 totals are checked
+                var accumulator = elem is "int32_t" or "int64_t" ? "int64_t" : "double";
+                code.Add($"{accumulator} __linq_s{id} = 0; int64_t __linq_c{id} = 0;");
+                body.Add((elem == "int64_t"
+                    ? $"__linq_s{id} = cil2cpp::checked_add(__linq_s{id}, {current});"
+                    : $"__linq_s{id} += {current};") + $" __linq_c{id}++; return true;");
+                post = $"if (__linq_c{id} == 0) cil2cpp::throw_invalid_operation();";
+                result = elem == "float"
+                    ? $"static_cast<float>(__linq_s{id} / __linq_c{id})"
+                    : $"static_cast<double>(__linq_s{id}) / __linq_c{id}";
+                break;
+            }
+            case LinqTerminalKind.Min or LinqTerminalKind.Max:
+            {
+                var op = terminal.Kind == LinqTerminalKind.Min ? "<" : ">";
+                code.Add($"{elem} __linq_v{id}{{}}; bool __linq_f{id} = false;");
+                var isFloat = elem is "float" or "double";
+                if (isFloat && terminal.Kind == LinqTerminalKind.Min)
+                {
+                    // Min stops at the first NaN
+                    body.Add($"if (!__linq_f{id} || {current} < __linq_v{id} || {current} != {current}) " +
+                             $"{{ __linq_v{id} = {current}; __linq_f{id} = true; if ({current} != {current}) return false; }} return true;");
+                }
+                else
+                {
+                    // Max replaces a NaN result with any later element
+                    var nan = isFloat ? $" || __linq_v{id} != __linq_v{id}" : "";
+                    body.Add($"if (!__linq_f{id} || {current} {op} __linq_v{id}{nan}) " +
+                             $"{{ __linq_v{id} = {current}; __linq_f{id} = true; }} return true;");
+                }
+                post = $"if (!__linq_f{id}) cil2cpp::throw_invalid_operation();";
+                result = $"__linq_v{id}";
+                break;
+            }
+            case LinqTerminalKind.Contains when query.Stages.Count == 0 && VectorElementTypes.Contains(elem):
+                result = $"cil2cpp::linq_contains<{elem}>({sourceArgs}, {terminal.Value})";
+                loop = false;
+                break;
+            case LinqTerminalKind.Contains:
+            {
+                // EqualityComparer<T>.Default: NaN equals NaN for floating point
+                var equal = elem is "float" or "double"
+                    ? $"({current} == {terminal.Value} || ({current} != {current} && {terminal.Value} != {terminal.Value}))"
+                    : $"{current} == {terminal.Value}";
+                code.Add($"bool __linq_f{id} = false;");
+                body.Add($"if ({equal}) {{ __linq_f{id} = true; return false; }} return true;");
+                result = $"__linq_f{id}";
+                break;
+            }
+            case LinqTerminalKind.Aggregate when terminal.Value == null:
+                code.Add($"{elem} __linq_v{id}{{}}; bool __linq_f{id} = false;");
+                body.Add($"if (__linq_f{id}) __linq_v{id} = {LinqFuncCall(terminal.Func!, $"__linq_fa{id}", $"__linq_v{id}", current)}; " +
+                         $"else {{ __linq_v{id} = {current}; __linq_f{id} = true; }} return true;");
+                post = $"if (!__linq_f{id}) cil2cpp::throw_invalid_operation();";
+                result = $"__linq_v{id}";
+                break;
+            case LinqTerminalKind.Aggregate:
+                code.Add($"{terminal.Func!.ReturnTypeCpp} __linq_v{id} = {terminal.Value};");
+                body.Add($"__linq_v{id} = {LinqFuncCall(terminal.Func, $"__linq_fa{id}", $"__linq_v{id}", current)}; return true;");
+                result = terminal.Selector != null
+                    ? LinqFuncCall(terminal.Selector, $"__linq_fr{id}", $"__linq_v{id}")
+                    : $"__linq_v{id}";
+                break;
+            case LinqTerminalKind.ForAll:
+                body.Add($"{LinqFuncCall(terminal.Func!, $"__linq_fa{id}", current)}; return true;");
+                result = null;
+                break;
+            case LinqTerminalKind.ToList:
+            {
+                var listType = CppNameMapper.MangleGenericInstanceTypeName(
+                    "System.Collections.Generic.List`1", new List<string> { query.ElemIL });
+                var capacity = hasFilter ? "0" : $"cil2cpp::linq_count_hint({sourceArgs})";
+                code.Add($"auto* __linq_l{id} = static_cast<{listType}*>(cil2cpp::list_create(" +
+                         $"&{listType}_TypeInfo, {LinqElementTypeInfo(query.ElemIL)}, {capacity}));");
+                body.Add($"cil2cpp::list_add(__linq_l{id}, &{current}); return true;");
+                result = $"__linq_l{id}";
+                break;
+            }
+            default: // ToArray, Reverse, Materialize
+            {
+                var capacity = hasFilter ? "0" : $"cil2cpp::linq_count_hint({sourceArgs})";
+                code.Add($"cil2cpp::LinqArrayBuilder<{elem}> __linq_b{id}({LinqElementTypeInfo(query.ElemIL)}, {capacity});");
+                body.Add($"__linq_b{id}.add({current}); return true;");
+                result = terminal.Kind == LinqTerminalKind.Reverse
+                    ? $"cil2cpp::linq_reverse<{elem}>(__linq_b{id}.to_array())"
+                    : $"__linq_b{id}.to_array()";
+                break;
+            }
+        }
 
-        block.Instructions.Add(new IRRawCpp
+        if (loop)
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"{elemTypeCpp} {sum} = 0; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) " +
-                $"{sum} += static_cast<{elemTypeCpp}*>(cil2cpp::array_data({arr}))[{idx}];"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {sum};" });
-        stack.Push(tmp);
-        return true;
+            code.Add($"cil2cpp::linq_for_each<{query.SourceElemCpp}>({sourceArgs}, " +
+                     $"[&]({query.SourceElemCpp} __e0) -> bool {{ {string.Join(" ", body)} }});");
+        }
+        if (post != null) code.Add(post);
+
+        return LinqQueryInstructions(code, resultVar, result);
     }
 
-    private bool EmitLinqMinMax(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string elemTypeCpp, bool isMin)
+    /// <summary>
+    /// An escaping query: cil2cpp::LinqDeferredType builds the query object's TypeInfo
+    /// once, and the step function pulls source elements through the stages until one
+    /// passes, so the source is walked only when (and each time) the result is enumerated.
+    /// The delegates are captured in the query object when the IL creates it.
+    /// </summary>
+    private List<IRInstruction> BuildDeferredLinqQueryCode(LinqQuery query, int id, string resultVar,
+        List<string> code, string resultTypes, string enumerable)
     {
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var val = $"__linq_v{id}";
-        var idx = $"__linq_i{id}";
-        var op = isMin ? "<" : ">";
-
-        block.Instructions.Add(new IRRawCpp
+        var src = query.SourceElemCpp;
+        var elem = query.ElemCpp;
+        var body = new List<string>();
+        var delegates = new List<string>();
+        var current = "__e0";
+        for (int i = 0; i < query.Stages.Count; i++)
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"if ({arr}->length == 0) cil2cpp::throw_invalid_operation(); " +
-                $"{elemTypeCpp} {val} = static_cast<{elemTypeCpp}*>(cil2cpp::array_data({arr}))[0]; " +
-                $"for (int32_t {idx} = 1; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __v = static_cast<{elemTypeCpp}*>(cil2cpp::array_data({arr}))[{idx}]; " +
-                $"if (__v {op} {val}) {val} = __v; }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {val};" });
-        stack.Push(tmp);
-        return true;
-    }
+            var stage = query.Stages[i];
+            var del = $"__linq_d{id}_{i}";
+            delegates.Add($"(cil2cpp::Object*)({stage.DelegateExpr})");
+            body.Add($"auto* {del} = (cil2cpp::Delegate*)__d[{i}];");
+            if (stage.IsWhere)
+            {
+                body.Add($"{LinqStageCall(stage, del, current, $"__r{i}")} if (!__r{i}) continue;");
+            }
+            else
+            {
+                var next = $"__e{i + 1}";
+                body.Add(LinqStageCall(stage, del, current, next));
+                current = next;
+            }
+        }
 
-    // ── Transformation operations ──────────────────────────────
+        var enumerableBase = _typeCache.TryGetValue("System.Collections.IEnumerable", out var iEnumerable)
+            ? $"&{iEnumerable.CppName}_TypeInfo" : "nullptr";
+        code.Add($"static const cil2cpp::LinqDeferredType<{src}, {elem}> __linq_dt{id}({resultTypes}, " +
+                 $"{enumerableBase}, {LinqElementTypeInfo(query.ElemIL)}, {query.ListTypeInfo}, {enumerable}, " +
+                 $"[](cil2cpp::LinqCursor<{src}>& __c, cil2cpp::Object* const* __d, {elem}& __out) -> bool {{ " +
+                 $"{src} __e0; while (__c.next(__e0)) {{ {string.Join(" ", body)} __out = {current}; return true; }} " +
+                 "return false; });");
+        return LinqQueryInstructions(code, resultVar,
+            $"__linq_dt{id}.create(__linq_o{id}, {{ {string.Join(", ", delegates)} }})");
+    }
 
-    private bool EmitLinqToArray(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp)
+    /// <summary>
+    /// Parallel Sum / Count / Aggregate / ForAll: the stages run inside the fold of
+    /// cil2cpp::linq_parallel_reduce (or linq_parallel_for_all), one accumulator per
+    /// participant, combined at the end.
+    /// </summary>
+    private static List<IRInstruction> BuildParallelLinqQueryCode(LinqQuery query, LinqTerminal terminal,
+        int id, string resultVar, List<string> code, List<string> body, string current, string sourceArgs)
     {
-        if (elemTypeCpp == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var res = $"__linq_r{id}";
+        var options = $"__linq_po{id}";
+        code.Add($"cil2cpp::parallel::LoopOptions {options}{{{query.Token ?? "cil2cpp::CancellationToken{nullptr}"}, " +
+                 $"{query.MaxDegree ?? "-1"}}};");
+        // ParallelEnumerable.WithDegreeOfParallelism accepts 1..512
+        if (query.MaxDegree != null)
+            code.Add($"if ({options}.max_degree < 1 || {options}.max_degree > 512) cil2cpp::throw_argument_out_of_range();");
 
-        block.Instructions.Add(new IRRawCpp
+        var elem = query.ElemCpp;
+        var src = query.SourceElemCpp;
+        if (terminal.Kind == LinqTerminalKind.ForAll)
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {res} = cil2cpp::array_create({arr}->element_type, {arr}->length); " +
-                $"std::memcpy(cil2cpp::array_data({res}), cil2cpp::array_data({arr}), " +
-                $"{arr}->length * sizeof({elemTypeCpp}));"
-        });
-        block.Instructions.Add(new IRRawCpp
+            body.Add($"{LinqFuncCall(terminal.Func!, $"__linq_fa{id}", current)}; return true;");
+            code.Add($"cil2cpp::linq_parallel_for_all<{src}>({sourceArgs}, {options}, " +
+                     $"[&]({src} __e0) -> bool {{ {string.Join(" ", body)} }});");
+            return LinqQueryInstructions(code, resultVar, null);
+        }
+
+        string acc, identity, fold, combine, result;
+        string? post = null;
+        var isInt = elem is "int32_t" or "int64_t";
+        switch (terminal.Kind)
         {
-            Code = $"{tmp} = reinterpret_cast<cil2cpp::Array*>({res});"
-        });
-        stack.Push(tmp);
-        return true;
+            case LinqTerminalKind.Sum:
+                // Integer Sum is checked per participant and when the partials are added
+                acc = elem == "float" ? "double" : elem;
+                identity = $"static_cast<{acc}>(0)";
+                fold = isInt ? $"__acc = cil2cpp::checked_add(__acc, {current});" : $"__acc += {current};";
+                combine = isInt ? "return cil2cpp::checked_add(__a, __b);" : "return __a + __b;";
+                result = elem == "float" ? $"static_cast<float>(__linq_r{id})" : $"__linq_r{id}";
+                break;
+            case LinqTerminalKind.Count:
+                acc = "int32_t";
+                identity = "0";
+                fold = "__acc++;";
+                combine = "return cil2cpp::checked_add(__a, __b);";
+                result = $"__linq_r{id}";
+                break;
+            case LinqTerminalKind.Aggregate when terminal.Value == null:
+            {
+                // A participant that saw no element has no partial to merge
+                acc = $"cil2cpp::LinqPartial<{elem}>";
+                identity = $"{acc}{{}}";
+                var func = terminal.Func!;
+                fold = $"if (__acc.has_value) __acc.value = {LinqFuncCall(func, $"__linq_fa{id}", "__acc.value", current)}; " +
+                       $"else {{ __acc.value = {current}; __acc.has_value = true; }}";
+                combine = "if (!__a.has_value) return __b; if (!__b.has_value) return __a; " +
+                          $"__a.value = {LinqFuncCall(func, $"__linq_fa{id}", "__a.value", "__b.value")}; return __a;";
+                post = $"if (!__linq_r{id}.has_value) cil2cpp::throw_invalid_operation();";
+                result = $"__linq_r{id}.value";
+                break;
+            }
+            default: // Aggregate(seed, update, combine, resultSelector)
+                acc = terminal.Func!.ReturnTypeCpp;
+                identity = terminal.Value!;
+                fold = $"__acc = {LinqFuncCall(terminal.Func, $"__linq_fa{id}", "__acc", current)};";
+                combine = $"return {LinqFuncCall(terminal.Combine!, $"__linq_fc{id}", "__a", "__b")};";
+                result = terminal.Selector != null
+                    ? LinqFuncCall(terminal.Selector, $"__linq_fr{id}", $"__linq_r{id}")
+                    : $"__linq_r{id}";
+                break;
+        }
+
+        body.Add($"{fold} return true;");
+        code.Add($"auto __linq_r{id} = cil2cpp::linq_parallel_reduce<{src}, {acc}>({sourceArgs}, {options}, {identity}, " +
+                 $"[&]({acc}& __acc, {src} __e0) -> bool {{ {string.Join(" ", body)} }}, " +
+                 $"[&]({acc} __a, {acc} __b) -> {acc} {{ {combine} }});");
+        if (post != null) code.Add(post);
+        return LinqQueryInstructions(code, resultVar, result);
     }
 
-    private bool EmitLinqToList(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, string? elemTypeIL)
+    /// <summary>The query code, then the __tN assignment (none for ForAll).</summary>
+    private static List<IRInstruction> LinqQueryInstructions(List<string> code, string resultVar, string? result)
     {
-        if (elemTypeCpp == null || elemTypeIL == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var list = $"__linq_l{id}";
-        var idx = $"__linq_i{id}";
-        var listType = CppNameMapper.MangleGenericInstanceTypeName(
-            "System.Collections.Generic.List`1", new List<string> { elemTypeIL });
-
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {list} = static_cast<{listType}*>(cil2cpp::list_create(&{listType}_TypeInfo, {arr}->element_type, {arr}->length)); " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"cil2cpp::list_add({list}, &__e); }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {list};" });
-        stack.Push(tmp);
-        return true;
+        var instructions = new List<IRInstruction> { new IRRawCpp { Code = string.Join(" ", code) } };
+        if (result != null) instructions.Add(new IRRawCpp { Code = $"{resultVar} = {result};" });
+        return instructions;
     }
 
-    private bool EmitLinqWhere(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
+    // ── End of method ────────────────────────────────────────────
+
+    /// <summary>
+    /// Called after the method body is converted: defer queries held in locals, then
+    /// drop the code of queries that were fused into a later operator.
+    /// </summary>
+    private void FinalizeLinqQueries(IRBasicBlock block, ref int tempCounter)
     {
-        if (elemTypeCpp == null) return false;
-        var pred = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var del = $"__linq_d{id}";
-        var cnt = $"__linq_c{id}";
-        var res = $"__linq_r{id}";
-        var wi = $"__linq_wi{id}";
-        var idx = $"__linq_i{id}";
-
-        // Two-pass: count matches, then allocate and fill
-        block.Instructions.Add(new IRRawCpp
+        if (_linqEmissions.Count == 0) return;
+
+        // Lambdas were resolved against the IR seen so far; a later write to the
+        // delegate (a local reassigned further down a loop) forces the indirect call
+        foreach (var emission in _linqEmissions.Where(e => !e.Fused))
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {del} = (cil2cpp::Delegate*)({pred}); " +
-                $"int32_t {cnt} = 0; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"bool __r; {DelegateCallStmt(del, "__e", elemTypeCpp, "bool", "__r")} " +
-                $"if (__r) {cnt}++; }} " +
-                $"auto* {res} = cil2cpp::array_create({arr}->element_type, {cnt}); " +
-                $"int32_t {wi} = 0; " +
-                $"for (int32_t {idx}2 = 0; {idx}2 < {arr}->length; {idx}2++) {{ " +
-                $"auto __e = {ArrElem(arr, $"{idx}2", elemTypeCpp)}; " +
-                $"bool __r; {DelegateCallStmt(del, "__e", elemTypeCpp, "bool", "__r")} " +
-                $"if (__r) static_cast<{elemTypeCpp}*>(cil2cpp::array_data({res}))[{wi}++] = __e; }}"
-        });
-        block.Instructions.Add(new IRRawCpp
+            var query = emission.Query.Clone();
+            for (int i = 0; i < query.Stages.Count; i++)
+                query.Stages[i] = RecheckLinqStage(block, query.Stages[i]);
+            var terminal = emission.Terminal;
+            if (terminal.Predicate != null)
+                terminal = terminal with { Predicate = RecheckLinqStage(block, terminal.Predicate) };
+            terminal = terminal with
+            {
+                Func = RecheckLinqFunc(block, terminal.Func),
+                Combine = RecheckLinqFunc(block, terminal.Combine),
+                Selector = RecheckLinqFunc(block, terminal.Selector),
+            };
+            if (query.Stages.SequenceEqual(emission.Query.Stages) && terminal == emission.Terminal) continue;
+
+            emission.Query = query;
+            emission.Terminal = terminal;
+            var code = BuildLinqQueryCode(query, terminal, emission.Id, emission.ResultVar);
+            ReplaceLinqInstructions(block, emission.Instructions, code);
+            emission.Instructions = code;
+        }
+
+        foreach (var pending in _linqEmissions.ToList())
         {
-            Code = $"{tmp} = reinterpret_cast<cil2cpp::Array*>({res});"
-        });
-        stack.Push(tmp);
-        return true;
+            if (pending.Terminal.Kind == LinqTerminalKind.Materialize && !pending.Fused)
+                TryDeferLinqQuery(block, pending, ref tempCounter);
+        }
+
+        var dead = FusedLinqInstructions();
+        block.Instructions.RemoveAll(dead.Contains);
     }
 
-    private bool EmitLinqSelect(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter,
-        string? elemTypeCpp, bool elemIsValue, string? resultTypeCpp)
+    /// <summary>
+    /// <c>var q = xs.Where(p); ... q.Sum(); q.Count();</c> — if the local holding the
+    /// query is assigned once and read only by LINQ operators, capture the source and
+    /// delegates where the query is created and let every reader run the fused loop,
+    /// instead of materializing an array up front. Readers see the source as it is
+    /// when they run, as with System.Linq.
+    /// </summary>
+    private void TryDeferLinqQuery(IRBasicBlock block, LinqEmission pending, ref int tempCounter)
     {
-        if (elemTypeCpp == null || resultTypeCpp == null) return false;
-        var sel = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var del = $"__linq_d{id}";
-        var res = $"__linq_r{id}";
-        var idx = $"__linq_i{id}";
+        var instructions = block.Instructions;
+        var dead = FusedLinqInstructions();
+        var own = pending.Instructions.ToHashSet();
+
+        // The query's only use: "loc_N = (T*)__tK;"
+        var uses = instructions.Where(i => !own.Contains(i) && !dead.Contains(i)
+            && ReferencesLinqVariable(i, pending.ResultVar)).ToList();
+        if (uses is not [IRAssign store]
+            || LinqPointerCastRegex.Replace(store.Value, "") != pending.ResultVar
+            || !LinqLocalRegex.IsMatch(store.Target))
+            return;
+        var local = store.Target;
+
+        var readers = _linqEmissions.Where(e => e != pending && !e.Fused && e.Query.Source == local).ToList();
+        var storeIndex = instructions.IndexOf(store);
+        if (readers.Count == 0
+            || readers.Any(r => instructions.IndexOf(r.Instructions[0]) < storeIndex))
+            return;
 
-        block.Instructions.Add(new IRRawCpp
+        // Nothing else reads, writes or takes the address of the local
+        var owned = readers.SelectMany(r => r.Instructions).Append(store).ToHashSet();
+        if (instructions.Any(i => !owned.Contains(i) && !dead.Contains(i) && ReferencesLinqVariable(i, local)))
+            return;
+
+        var captured = pending.Query.Clone();
+        var captures = new List<IRInstruction>();
+        var sourceVar = $"__t{tempCounter++}";
+        captures.Add(new IRRawCpp { Code = $"{sourceVar} = (cil2cpp::Object*)({captured.Source});" });
+        captured.Source = sourceVar;
+        for (int i = 0; i < captured.Stages.Count; i++)
         {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {del} = (cil2cpp::Delegate*)({sel}); " +
-                $"auto* {res} = cil2cpp::array_create(nullptr, {arr}->length); " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"auto __e = {ArrElem(arr, idx, elemTypeCpp)}; " +
-                $"{resultTypeCpp} __r; {DelegateCallStmt(del, "__e", elemTypeCpp, resultTypeCpp, "__r")} " +
-                $"static_cast<{resultTypeCpp}*>(cil2cpp::array_data({res}))[{idx}] = __r; }}"
-        });
-        block.Instructions.Add(new IRRawCpp
+            var delegateVar = $"__t{tempCounter++}";
+            captures.Add(new IRRawCpp { Code = $"{delegateVar} = (cil2cpp::Object*)({captured.Stages[i].DelegateExpr});" });
+            captured.Stages[i] = captured.Stages[i] with { DelegateExpr = delegateVar };
+        }
+        if (captured.MaxDegree != null && !LinqIntegerLiteralRegex.IsMatch(captured.MaxDegree))
         {
-            Code = $"{tmp} = reinterpret_cast<cil2cpp::Array*>({res});"
-        });
-        stack.Push(tmp);
-        return true;
+            var degreeVar = $"__t{tempCounter++}";
+            captures.Add(new IRRawCpp { Code = $"{degreeVar} = static_cast<int32_t>({captured.MaxDegree});" });
+            captured.MaxDegree = degreeVar;
+        }
+        if (captured.Token != null)
+        {
+            var tokenVar = $"__t{tempCounter++}";
+            captures.Add(new IRRawCpp { Code = $"{tokenVar} = {captured.Token};" });
+            captured.Token = tokenVar;
+        }
+        ReplaceLinqInstructions(block, pending.Instructions, captures);
+        pending.Instructions = captures;
+        pending.Deferred = true;
+        instructions.Remove(store);
+
+        foreach (var reader in readers)
+        {
+            var query = captured.Clone();
+            query.Stages.AddRange(reader.Query.Stages);
+            query.Parallel |= reader.Query.Parallel;
+            query.MaxDegree = reader.Query.MaxDegree ?? query.MaxDegree;
+            query.Token = reader.Query.Token ?? query.Token;
+            reader.Query = query;
+            var code = BuildLinqQueryCode(query, reader.Terminal, reader.Id, reader.ResultVar);
+            ReplaceLinqInstructions(block, reader.Instructions, code);
+            reader.Instructions = code;
+        }
     }
 
-    private bool EmitLinqContains(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp, bool elemIsValue)
+    private LinqStage RecheckLinqStage(IRBasicBlock block, LinqStage stage)
     {
-        if (elemTypeCpp == null) return false;
-        var val = stack.Pop();
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var found = $"__linq_f{id}";
-        var idx = $"__linq_i{id}";
+        if (stage.DirectFunction == null) return stage;
+        var lambda = ResolveLinqLambda(block, stage.DelegateExpr);
+        if (lambda != null && CppNameMapper.MangleMethodName(
+                GetMangledTypeNameForRef(lambda.DeclaringType), lambda.Name) == stage.DirectFunction)
+            return stage;
+        return stage with { DirectFunction = null, DirectTargetCpp = null };
+    }
 
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"bool {found} = false; " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) {{ " +
-                $"if ({ArrElem(arr, idx, elemTypeCpp)} == {val}) {{ {found} = true; break; }} }}"
-        });
-        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = {found};" });
-        stack.Push(tmp);
-        return true;
+    private LinqFunc? RecheckLinqFunc(IRBasicBlock block, LinqFunc? func)
+    {
+        if (func?.DirectFunction == null) return func;
+        var lambda = ResolveLinqLambda(block, func.DelegateExpr, func.ParamTypesCpp.Count);
+        if (lambda != null && CppNameMapper.MangleMethodName(
+                GetMangledTypeNameForRef(lambda.DeclaringType), lambda.Name) == func.DirectFunction)
+            return func;
+        return func with { DirectFunction = null, DirectTargetCpp = null };
     }
 
-    private bool EmitLinqReverse(IRBasicBlock block, Stack<string> stack,
-        ref int tempCounter, string? elemTypeCpp)
+    private HashSet<IRInstruction> FusedLinqInstructions() =>
+        _linqEmissions.Where(e => e.Fused).SelectMany(e => e.Instructions).ToHashSet();
+
+    private static void ReplaceLinqInstructions(IRBasicBlock block, List<IRInstruction> old, List<IRInstruction> replacement)
     {
-        if (elemTypeCpp == null) return false;
-        var src = stack.Pop();
-        var id = tempCounter;
-        var tmp = $"__t{tempCounter++}";
-        var arr = $"__linq_a{id}";
-        var res = $"__linq_r{id}";
-        var idx = $"__linq_i{id}";
+        var index = block.Instructions.IndexOf(old[0]);
+        foreach (var instr in replacement) instr.DebugInfo = old[0].DebugInfo;
+        block.Instructions.RemoveRange(index, old.Count);
+        block.Instructions.InsertRange(index, replacement);
+    }
 
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"auto* {arr} = {CastToArray(src)}; " +
-                $"auto* {res} = cil2cpp::array_create({arr}->element_type, {arr}->length); " +
-                $"for (int32_t {idx} = 0; {idx} < {arr}->length; {idx}++) " +
-                $"static_cast<{elemTypeCpp}*>(cil2cpp::array_data({res}))[{idx}] = " +
-                $"static_cast<{elemTypeCpp}*>(cil2cpp::array_data({arr}))[{arr}->length - 1 - {idx}];"
-        });
-        block.Instructions.Add(new IRRawCpp
-        {
-            Code = $"{tmp} = reinterpret_cast<cil2cpp::Array*>({res});"
-        });
-        stack.Push(tmp);
-        return true;
+    private static bool ReferencesLinqVariable(IRInstruction instr, string name)
+    {
+        var code = instr.ToCpp();
+        return code.Contains(name) && Regex.IsMatch(code, $@"\b{Regex.Escape(name)}\b");
     }
 }
@@ -122,6 +122,10 @@ public partial class IRBuilder
         _constrainedType = null;
         _inFilterRegion = false;
         _endfilterOffset = -1;
+        _functionPointerMethods.Clear();
+        _linqEmissions.Clear();
+        _pooledBoxTypeCpp = null;
+        _inPooledMoveNext = irMethod.Name == "MoveNext" && irMethod.DeclaringType?.IsPooledAsyncStateMachine == true;
         var block = new IRBasicBlock { Id = 0 };
         irMethod.BasicBlocks.Add(block);
 
@@ -340,12 +344,20 @@ public partial class IRBuilder
                     ? currentLoc with { ILOffset = instr.Offset }
                     : new SourceLocation { ILOffset = instr.Offset };
 
+                // Instructions inserted before the new ones (LINQ source spills) carry
+                // their own debug info and shift the range by one, so keep what is set
                 for (int i = beforeCount; i < block.Instructions.Count; i++)
                 {
-                    block.Instructions[i].DebugInfo = debugInfo;
+                    block.Instructions[i].DebugInfo ??= debugInfo;
                 }
             }
         }
+
+        // Defer LINQ queries held in locals and drop the ones fused into later operators
+        FinalizeLinqQueries(block, ref tempCounter);
+
+        // Drop array bounds checks proven redundant (counted loops, fresh arrays)
+        BoundsCheckElimination.Run(irMethod);
     }
 
     private void ConvertInstruction(ILInstruction instr, IRBasicBlock block, Stack<string> stack,
@@ -797,6 +809,7 @@ public partial class IRBuilder
                     TypeCppName = typeCppName,
                     FieldCppName = CppNameMapper.MangleFieldName(fieldRef.Name),
                     ResultVar = tmp,
+                    IsThreadStatic = IsThreadStaticField(fieldRef),
                 });
                 stack.Push(tmp);
                 break;
@@ -817,6 +830,7 @@ public partial class IRBuilder
                     FieldCppName = CppNameMapper.MangleFieldName(fieldRef.Name),
                     IsStore = true,
                     StoreValue = val,
+                    IsThreadStatic = IsThreadStaticField(fieldRef),
                 });
                 // volatile. prefix: fence after store
                 if (isVolatileStore)
@@ -848,7 +862,7 @@ public partial class IRBuilder
                 var tmp = $"__t{tempCounter++}";
                 block.Instructions.Add(new IRRawCpp
                 {
-                    Code = $"auto {tmp} = &{typeCppName}_statics.{CppNameMapper.MangleFieldName(fieldRef.Name)};"
+                    Code = $"auto {tmp} = &{StaticsBlockName(typeCppName, IsThreadStaticField(fieldRef))}.{CppNameMapper.MangleFieldName(fieldRef.Name)};"
                 });
                 stack.Push(tmp);
                 break;
@@ -1177,9 +1191,10 @@ public partial class IRBuilder
                 var index = stack.Count > 0 ? stack.Pop() : "0";
                 var arr = stack.Count > 0 ? stack.Pop() : "nullptr";
                 var tmp = $"__t{tempCounter++}";
-                block.Instructions.Add(new IRRawCpp
+                block.Instructions.Add(new IRArrayElementAddress
                 {
-                    Code = $"auto {tmp} = ({elemType}*)cil2cpp::array_get_element_ptr({arr}, {index});"
+                    ArrayExpr = arr, IndexExpr = index,
+                    ElementType = elemType, ResultVar = tmp
                 });
                 stack.Push(tmp);
                 break;
@@ -1386,6 +1401,7 @@ public partial class IRBuilder
                     ResultVar = tmp,
                     IsVirtual = false
                 });
+                _functionPointerMethods[tmp] = targetMethod;
                 stack.Push(tmp);
                 break;
             }
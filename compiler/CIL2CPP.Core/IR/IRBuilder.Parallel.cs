@@ -0,0 +1,308 @@
+using Mono.Cecil;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// System.Threading.Tasks.Parallel / ParallelOptions interception.
+/// Parallel.For and Parallel.ForEach are lowered to the runtime's fork-join
+/// layer (parallel.h): the loop body becomes a C++ lambda over a chunk of the
+/// index range, and the Action delegate is called directly when its lambda
+/// is known (same resolution as LINQ stages). ParallelOptions is a
+/// runtime-provided reference type; ParallelLoopResult a value type.
+/// Overloads taking ParallelLoopState or thread-local state are not lowered.
+///
+/// The AggregateException a failed loop throws is the runtime's (exception.h).
+/// InnerExceptions returns an enumerable over its Exception[] (a zero-stage
+/// cil2cpp::LinqDeferredType query), so ReadOnlyCollection&lt;Exception&gt; is an
+/// opaque handle: Count, the indexer and GetEnumerator are lowered, as are
+/// Flatten and Handle.
+/// </summary>
+public partial class IRBuilder
+{
+    private static bool IsParallelType(TypeReference typeRef)
+    {
+        return typeRef.FullName == "System.Threading.Tasks.Parallel";
+    }
+
+    private static bool IsParallelOptionsType(TypeReference typeRef)
+    {
+        return typeRef.FullName == "System.Threading.Tasks.ParallelOptions";
+    }
+
+    /// <summary>
+    /// Create synthetic IRTypes for ParallelOptions (reference type) and
+    /// ParallelLoopResult (value type).
+    /// </summary>
+    private void CreateParallelSyntheticTypes()
+    {
+        if (!_typeCache.ContainsKey("System.Threading.Tasks.ParallelOptions"))
+        {
+            var optionsType = new IRType
+            {
+                ILFullName = "System.Threading.Tasks.ParallelOptions",
+                CppName = "System_Threading_Tasks_ParallelOptions",
+                Name = "ParallelOptions",
+                Namespace = "System.Threading.Tasks",
+                IsValueType = false,
+                IsSealed = false,
+                IsRuntimeProvided = true,
+            };
+            _module.Types.Add(optionsType);
+            _typeCache["System.Threading.Tasks.ParallelOptions"] = optionsType;
+        }
+
+        if (!_typeCache.ContainsKey("System.Threading.Tasks.ParallelLoopResult"))
+        {
+            var resultType = new IRType
+            {
+                ILFullName = "System.Threading.Tasks.ParallelLoopResult",
+                CppName = "System_Threading_Tasks_ParallelLoopResult",
+                Name = "ParallelLoopResult",
+                Namespace = "System.Threading.Tasks",
+                IsValueType = true,
+                IsSealed = true,
+            };
+            resultType.Fields.Add(new IRField
+            {
+                Name = "_isCompleted",
+                CppName = "f_isCompleted",
+                FieldTypeName = "System.Boolean",
+                IsStatic = false,
+                IsPublic = false,
+                DeclaringType = resultType,
+            });
+            _module.Types.Add(resultType);
+            _typeCache["System.Threading.Tasks.ParallelLoopResult"] = resultType;
+
+            CppNameMapper.RegisterValueType("System.Threading.Tasks.ParallelLoopResult");
+            CppNameMapper.RegisterValueType("System_Threading_Tasks_ParallelLoopResult");
+        }
+    }
+
+    // ── Parallel.For / Parallel.ForEach ───────────────────────
+
+    /// <summary>
+    /// Intercept Parallel.For(from, to, [options,] body) over int or long and
+    /// Parallel.ForEach(source, [options,] body) over IEnumerable&lt;T&gt;.
+    /// </summary>
+    private bool TryEmitParallelCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        if (!IsParallelType(methodRef.DeclaringType)) return false;
+
+        var paramTypes = methodRef.Parameters.Select(p => p.ParameterType.FullName).ToArray();
+        var id = tempCounter;
+        var code = new List<string>();
+
+        var hasOptions = paramTypes.Length >= 2 && paramTypes[^2] == "System.Threading.Tasks.ParallelOptions";
+        if (methodRef.Name == "For" && paramTypes.Length == (hasOptions ? 4 : 3)
+            && paramTypes[0] is "System.Int32" or "System.Int64" && paramTypes[1] == paramTypes[0]
+            && paramTypes[^1] == $"System.Action`1<{paramTypes[0]}>")
+        {
+            var args = PopArgs(stack, paramTypes.Length);
+            var indexCpp = paramTypes[0] == "System.Int32" ? "int32_t" : "int64_t";
+            var body = MakeLinqFunc(block, args[^1], new[] { indexCpp }, "void");
+            code.Add($"auto* __par_d{id} = (cil2cpp::Delegate*)({args[^1]});");
+            code.Add(ParallelLoopOptions(id, hasOptions ? args[2] : null));
+            code.Add($"auto __par_r{id} = cil2cpp::parallel::for_range({args[0]}, {args[1]}, __par_o{id}, " +
+                     "[&](int64_t __lo, int64_t __hi, int32_t) { " +
+                     $"for (int64_t __i = __lo; __i < __hi; __i++) {{ {indexCpp} __e = static_cast<{indexCpp}>(__i); " +
+                     $"{LinqFuncCall(body, $"__par_d{id}", "__e")}; }} }});");
+        }
+        else if (methodRef.Name == "ForEach" && paramTypes.Length == (hasOptions ? 3 : 2)
+            && methodRef is GenericInstanceMethod { GenericArguments.Count: 1 } gim
+            && paramTypes[0].StartsWith("System.Collections.Generic.IEnumerable`1<")
+            && paramTypes[^1].StartsWith("System.Action`1<"))
+        {
+            var elemIL = ResolveTypeRefOperand(gim.GenericArguments[0]);
+            var elemCpp = CppNameMapper.GetCppTypeForDecl(elemIL);
+            var args = PopArgs(stack, paramTypes.Length);
+            var body = MakeLinqFunc(block, args[^1], new[] { elemCpp }, "void");
+            code.Add($"auto* __par_d{id} = (cil2cpp::Delegate*)({args[^1]});");
+            code.Add(ParallelLoopOptions(id, hasOptions ? args[1] : null));
+            var enumerable = "nullptr";
+            if (GetLinqEnumerableTypes(elemIL) is { } enumerableTypes)
+            {
+                code.Add($"static const cil2cpp::LinqEnumerableTypes __par_et{id} = {enumerableTypes};");
+                enumerable = $"&__par_et{id}";
+            }
+            code.Add($"auto __par_r{id} = cil2cpp::parallel::for_each<{elemCpp}>(" +
+                     $"(cil2cpp::Object*)({args[0]}), {LinqListTypeInfo(elemIL)}, {enumerable}, __par_o{id}, " +
+                     $"[&]({elemCpp} __e) {{ {LinqFuncCall(body, $"__par_d{id}", "__e")}; }});");
+        }
+        else
+        {
+            return false;
+        }
+
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp { Code = string.Join(" ", code) });
+        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = __par_r{id};" });
+        if (methodRef.ReturnType.FullName != "System.Void") stack.Push(tmp);
+        return true;
+    }
+
+    private static string ParallelLoopOptions(int id, string? optionsExpr) => optionsExpr != null
+        ? $"cil2cpp::parallel::LoopOptions __par_o{id} = cil2cpp::parallel::options_of((cil2cpp::ParallelOptions*)({optionsExpr}));"
+        : $"cil2cpp::parallel::LoopOptions __par_o{id}{{}};";
+
+    // ── ParallelOptions / ParallelLoopResult ──────────────────
+
+    private bool TryEmitParallelOptionsNewObj(IRBasicBlock block, Stack<string> stack,
+        MethodReference ctorRef, ref int tempCounter)
+    {
+        if (!IsParallelOptionsType(ctorRef.DeclaringType) || ctorRef.Parameters.Count != 0) return false;
+
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = cil2cpp::parallel_options_create();" });
+        stack.Push(tmp);
+        return true;
+    }
+
+    private bool TryEmitParallelOptionsCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        if (methodRef.DeclaringType.FullName == "System.Threading.Tasks.ParallelLoopResult"
+            && methodRef.Name == "get_IsCompleted")
+        {
+            // Value type receiver: thisExpr is its address
+            var resultExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+            var tmp = $"__t{tempCounter++}";
+            block.Instructions.Add(new IRRawCpp
+            {
+                Code = $"auto {tmp} = reinterpret_cast<cil2cpp::ParallelLoopResult*>({resultExpr})->f_isCompleted;"
+            });
+            stack.Push(tmp);
+            return true;
+        }
+
+        if (!IsParallelOptionsType(methodRef.DeclaringType)) return false;
+
+        switch (methodRef.Name)
+        {
+            case "get_MaxDegreeOfParallelism" or "get_CancellationToken":
+            {
+                var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+                var field = methodRef.Name == "get_CancellationToken" ? "f_cancellationToken" : "f_maxDegreeOfParallelism";
+                var tmp = $"__t{tempCounter++}";
+                block.Instructions.Add(new IRRawCpp
+                {
+                    Code = $"auto {tmp} = reinterpret_cast<cil2cpp::ParallelOptions*>({thisExpr})->{field};"
+                });
+                stack.Push(tmp);
+                return true;
+            }
+            case "set_MaxDegreeOfParallelism":
+            {
+                // -1 means no limit; 0 and anything below -1 are rejected
+                var value = stack.Count > 0 ? stack.Pop() : "-1";
+                var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+                block.Instructions.Add(new IRRawCpp
+                {
+                    Code = $"{{ int32_t __par_v = {value}; if (__par_v == 0 || __par_v < -1) cil2cpp::throw_argument_out_of_range(); " +
+                           $"reinterpret_cast<cil2cpp::ParallelOptions*>({thisExpr})->f_maxDegreeOfParallelism = __par_v; }}"
+                });
+                return true;
+            }
+            case "set_CancellationToken":
+            {
+                var value = stack.Count > 0 ? stack.Pop() : "cil2cpp::ct_get_none()";
+                var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+                block.Instructions.Add(new IRRawCpp
+                {
+                    Code = $"reinterpret_cast<cil2cpp::ParallelOptions*>({thisExpr})->f_cancellationToken = {value};"
+                });
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // ── AggregateException ────────────────────────────────────
+
+    private const string AggregateInnerExceptionsType = "System.Collections.ObjectModel.ReadOnlyCollection`1<System.Exception>";
+
+    /// <summary>ReadOnlyCollection&lt;Exception&gt; gets no fields or method bodies; every call is intercepted.</summary>
+    internal static bool IsAggregateInnerExceptionsType(string typeKey) => typeKey == AggregateInnerExceptionsType;
+
+    private const string AggregateQueryCpp = "cil2cpp::LinqDeferredQuery<cil2cpp::Exception*, cil2cpp::Exception*>";
+
+    private bool TryEmitAggregateExceptionCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        var declaring = methodRef.DeclaringType.FullName;
+        if (declaring != "System.AggregateException" && declaring != AggregateInnerExceptionsType) return false;
+
+        var paramTypes = methodRef.Parameters.Select(p => p.ParameterType.FullName).ToArray();
+        var id = tempCounter;
+        var code = new List<string>();
+        string? result;
+        switch (methodRef.Name)
+        {
+            case "get_InnerExceptions" when declaring == "System.AggregateException":
+            {
+                var thisExpr = stack.Pop();
+                // Only the interfaces the module uses exist; the query implements those
+                string TypeInfoOf(string key) =>
+                    _typeCache.TryGetValue(key, out var type) ? $"&{type.CppName}_TypeInfo" : "nullptr";
+                var types = $"{{ {TypeInfoOf("System.Collections.Generic.IEnumerable`1<System.Exception>")}, " +
+                            $"{TypeInfoOf("System.Collections.Generic.IEnumerator`1<System.Exception>")}, " +
+                            $"{TypeInfoOf("System.Collections.IEnumerator")}, {TypeInfoOf("System.IDisposable")} }}";
+                code.Add($"static const cil2cpp::LinqDeferredType<cil2cpp::Exception*, cil2cpp::Exception*> __agg_t{id}(" +
+                         $"{types}, {TypeInfoOf("System.Collections.IEnumerable")}, &cil2cpp::Exception_TypeInfo, nullptr, nullptr, " +
+                         "[](cil2cpp::LinqCursor<cil2cpp::Exception*>& __c, cil2cpp::Object* const*, cil2cpp::Exception*& __out) -> bool " +
+                         "{ return __c.next(__out); });");
+                result = $"__agg_t{id}.create(((cil2cpp::AggregateException*)({thisExpr}))->inner_exceptions, {{}})";
+                break;
+            }
+            case "Flatten" when declaring == "System.AggregateException":
+                result = $"cil2cpp::aggregate_exception_flatten((cil2cpp::AggregateException*)({stack.Pop()}))";
+                break;
+            case "Handle" when declaring == "System.AggregateException"
+                               && paramTypes is ["System.Func`2<System.Exception,System.Boolean>"]:
+            {
+                var predicate = stack.Pop();
+                var thisExpr = stack.Pop();
+                var func = MakeLinqFunc(block, predicate, new[] { "cil2cpp::Exception*" }, "bool");
+                code.Add($"auto* __agg_d{id} = (cil2cpp::Delegate*)({predicate});");
+                code.Add($"if (!__agg_d{id}) cil2cpp::throw_argument_null();");
+                code.Add($"cil2cpp::aggregate_exception_handle((cil2cpp::AggregateException*)({thisExpr}), " +
+                         "[](void* __d, cil2cpp::Exception* __e) -> bool { auto* __agg_d = (cil2cpp::Delegate*)__d; " +
+                         $"return {LinqFuncCall(func, "__agg_d", "__e")}; }}, __agg_d{id});");
+                result = null;
+                break;
+            }
+            case "get_Count" when declaring == AggregateInnerExceptionsType:
+                result = $"cil2cpp::array_length((cil2cpp::Array*)(({AggregateQueryCpp}*)({stack.Pop()}))->source)";
+                break;
+            case "get_Item" when declaring == AggregateInnerExceptionsType:
+            {
+                var index = stack.Pop();
+                result = $"cil2cpp::array_get<cil2cpp::Exception*>((cil2cpp::Array*)(({AggregateQueryCpp}*)({stack.Pop()}))->source, {index})";
+                break;
+            }
+            case "GetEnumerator" when declaring == AggregateInnerExceptionsType:
+                result = "cil2cpp::LinqDeferredType<cil2cpp::Exception*, cil2cpp::Exception*>::get_enumerator(" +
+                         $"(cil2cpp::Object*)({stack.Pop()}))";
+                break;
+            default:
+                return false;
+        }
+
+        if (code.Count > 0) block.Instructions.Add(new IRRawCpp { Code = string.Join(" ", code) });
+        if (result == null) return true;
+        var tmp = $"__t{tempCounter++}";
+        // The handle's T is Exception: IEnumerator<!0> and !0 in the member signatures
+        var returnIL = methodRef.Name switch
+        {
+            "get_Item" => "System.Exception",
+            "GetEnumerator" => "System.Collections.Generic.IEnumerator`1<System.Exception>",
+            _ => methodRef.ReturnType.FullName,
+        };
+        var returnCpp = CppNameMapper.GetCppTypeForDecl(returnIL);
+        block.Instructions.Add(new IRRawCpp { Code = $"{tmp} = ({returnCpp})({result});" });
+        stack.Push(tmp);
+        return true;
+    }
+}
@@ -12,9 +12,22 @@ namespace CIL2CPP.Core.IR;
 ///   int _length     — number of elements
 ///
 /// ReadOnlySpan&lt;T&gt; uses the same layout.
+///
+/// Searching, comparing and filling spans of primitives (MemoryExtensions
+/// IndexOf / Contains / SequenceEqual, Span&lt;T&gt;.Fill) call the SIMD kernels
+/// of the runtime's vector_ops.h.
 /// </summary>
 public partial class IRBuilder
 {
+    /// <summary>
+    /// C++ element types accepted by the cil2cpp::vec kernels (vector_ops.h).
+    /// </summary>
+    private static readonly HashSet<string> VectorElementTypes = new()
+    {
+        "bool", "uint8_t", "int8_t", "int16_t", "uint16_t", "char16_t",
+        "int32_t", "uint32_t", "int64_t", "uint64_t", "float", "double",
+    };
+
     /// <summary>
     /// Check if a type reference is System.Span`1 (any instantiation).
     /// </summary>
@@ -206,10 +219,19 @@ public partial class IRBuilder
                     var thisArg = This();
                     block.Instructions.Add(new IRRawCpp
                     {
-                        Code = $"if ({thisArg}->f_length > 0) std::memset((void*){thisArg}->f_reference, 0, {thisArg}->f_length * sizeof({elemCppType}));"
+                        Code = $"cil2cpp::vec::clear((void*){thisArg}->f_reference, {thisArg}->f_length * sizeof({elemCppType}));"
                     });
                 }
-                else // Fill
+                else if (VectorElementTypes.Contains(elemCppType))
+                {
+                    var value = stack.Count > 0 ? stack.Pop() : "0";
+                    var thisArg = This();
+                    block.Instructions.Add(new IRRawCpp
+                    {
+                        Code = $"cil2cpp::vec::fill<{elemCppType}>(static_cast<{elemCppType}*>((void*){thisArg}->f_reference), {thisArg}->f_length, {value});"
+                    });
+                }
+                else // Fill with a struct or reference
                 {
                     var value = stack.Count > 0 ? stack.Pop() : "0";
                     var thisArg = This();
@@ -221,9 +243,124 @@ public partial class IRBuilder
                 return true;
             }
 
+            case "op_Implicit" when methodRef.Parameters.Count == 1:
+            {
+                // T[] -> Span<T> / ReadOnlySpan<T>, Span<T> -> ReadOnlySpan<T>
+                var source = stack.Count > 0 ? stack.Pop() : "nullptr";
+                var resultType = MakeSpanOfDeclaringElement(methodRef);
+                if (resultType == null) return false;
+                var typeCpp = GetMangledTypeNameForRef(resultType);
+                var tmp = $"__t{tempCounter++}";
+                var code = methodRef.Parameters[0].ParameterType is ArrayType
+                    ? $"{typeCpp} {tmp}; {tmp}.f_reference = (intptr_t)({source} ? cil2cpp::array_data({source}) : nullptr); {tmp}.f_length = {source} ? {source}->length : 0;"
+                    : $"{typeCpp} {tmp}; {tmp}.f_reference = ({source}).f_reference; {tmp}.f_length = ({source}).f_length;";
+                block.Instructions.Add(new IRRawCpp { Code = code });
+                stack.Push(tmp);
+                return true;
+            }
+
+            default:
+                return false;
+        }
+    }
+
+    /// <summary>
+    /// Result type of Span&lt;T&gt;.op_Implicit / ReadOnlySpan&lt;T&gt;.op_Implicit, closed over
+    /// the declaring span's T. Cecil gives the return type over the open parameter.
+    /// </summary>
+    private static GenericInstanceType? MakeSpanOfDeclaringElement(MethodReference methodRef)
+    {
+        if (methodRef.DeclaringType is not GenericInstanceType declaring
+            || methodRef.ReturnType is not GenericInstanceType ret) return null;
+        var closed = new GenericInstanceType(ret.ElementType);
+        closed.GenericArguments.Add(declaring.GenericArguments[0]);
+        return closed;
+    }
+
+    /// <summary>
+    /// Span types produced by intercepted calls whose signatures only name them over
+    /// a generic parameter (op_Implicit to ReadOnlySpan&lt;T&gt;, MemoryExtensions.AsSpan&lt;T&gt;),
+    /// so the generic instantiation scan does not see them.
+    /// </summary>
+    private void CollectSpanConversionTypes(MethodReference methodRef)
+    {
+        if (methodRef.Name == "op_Implicit"
+            && (IsSpanType(methodRef.DeclaringType) || IsReadOnlySpanType(methodRef.DeclaringType)))
+        {
+            if (MakeSpanOfDeclaringElement(methodRef) is { } result)
+                CollectGenericType(result);
+        }
+        else if (methodRef is GenericInstanceMethod { Name: "AsSpan" } gim
+                 && methodRef.DeclaringType.FullName == "System.MemoryExtensions"
+                 && methodRef.ReturnType is GenericInstanceType ret)
+        {
+            var closed = new GenericInstanceType(ret.ElementType);
+            closed.GenericArguments.Add(gim.GenericArguments[0]);
+            CollectGenericType(closed);
+        }
+    }
+
+    /// <summary>
+    /// Intercept System.MemoryExtensions helpers over spans of primitives:
+    /// IndexOf(value), Contains(value), SequenceEqual(other) and AsSpan(T[]).
+    /// Span arguments are passed by value. Returns true if the call was handled.
+    /// </summary>
+    private bool TryEmitMemoryExtensionsCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        if (methodRef.DeclaringType.FullName != "System.MemoryExtensions"
+            || methodRef is not GenericInstanceMethod gim || gim.GenericArguments.Count != 1)
+            return false;
+
+        var elemIL = ResolveTypeRefOperand(gim.GenericArguments[0]);
+        var elem = CppNameMapper.GetCppTypeName(elemIL);
+        if (!VectorElementTypes.Contains(elem)) return false;
+
+        var parameters = methodRef.Parameters;
+        bool IsSpanParam(int i) => IsSpanType(parameters[i].ParameterType) || IsReadOnlySpanType(parameters[i].ParameterType);
+        string Data(string span) => $"static_cast<const {elem}*>((void*)({span}).f_reference)";
+
+        string code;
+        var tmp = $"__t{tempCounter}";
+        switch (methodRef.Name)
+        {
+            case "IndexOf" or "Contains" when parameters.Count == 2 && IsSpanParam(0)
+                                             && parameters[1].ParameterType is GenericParameter:
+            {
+                var value = stack.Pop();
+                var span = stack.Pop();
+                code = methodRef.Name == "IndexOf"
+                    ? $"auto {tmp} = cil2cpp::vec::index_of<{elem}>({Data(span)}, ({span}).f_length, {value});"
+                    : $"auto {tmp} = cil2cpp::vec::contains<{elem}>({Data(span)}, ({span}).f_length, {value});";
+                break;
+            }
+            case "SequenceEqual" when parameters.Count == 2 && IsSpanParam(0) && IsSpanParam(1):
+            {
+                var other = stack.Pop();
+                var span = stack.Pop();
+                code = $"auto {tmp} = ({span}).f_length == ({other}).f_length && " +
+                       $"cil2cpp::vec::sequence_equal<{elem}>({Data(span)}, {Data(other)}, ({span}).f_length);";
+                break;
+            }
+            case "AsSpan" when parameters.Count == 1 && parameters[0].ParameterType is ArrayType
+                               && methodRef.ReturnType is GenericInstanceType ret:
+            {
+                var array = stack.Pop();
+                var spanType = new GenericInstanceType(ret.ElementType);
+                spanType.GenericArguments.Add(gim.GenericArguments[0]);
+                var typeCpp = GetMangledTypeNameForRef(spanType);
+                code = $"{typeCpp} {tmp}; {tmp}.f_reference = (intptr_t)({array} ? cil2cpp::array_data({array}) : nullptr); " +
+                       $"{tmp}.f_length = {array} ? {array}->length : 0;";
+                break;
+            }
             default:
                 return false;
         }
+
+        tempCounter++;
+        block.Instructions.Add(new IRRawCpp { Code = code });
+        stack.Push(tmp);
+        return true;
     }
 
     private bool EmitSpanCtor(IRBasicBlock block, Stack<string> stack,
@@ -0,0 +1,224 @@
+using Mono.Cecil;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// System.Text.StringBuilder interception.
+/// StringBuilder is a runtime-provided type (cil2cpp::StringBuilder, a chunked
+/// UTF-16 buffer); constructor and method calls are lowered to the runtime's
+/// string_builder_* functions. Append overloads for primitives map to typed
+/// entry points that format directly into the buffer instead of going through
+/// a temporary ToString() string.
+/// </summary>
+public partial class IRBuilder
+{
+    private static bool IsStringBuilderType(TypeReference typeRef)
+    {
+        return typeRef.FullName == "System.Text.StringBuilder";
+    }
+
+    /// <summary>
+    /// Create synthetic IRType for System.Text.StringBuilder (reference type).
+    /// </summary>
+    private void CreateStringBuilderSyntheticType()
+    {
+        if (_typeCache.ContainsKey("System.Text.StringBuilder")) return;
+
+        var sbType = new IRType
+        {
+            ILFullName = "System.Text.StringBuilder",
+            CppName = "System_Text_StringBuilder",
+            Name = "StringBuilder",
+            Namespace = "System.Text",
+            IsValueType = false,
+            IsSealed = true,
+            IsRuntimeProvided = true,
+        };
+        _module.Types.Add(sbType);
+        _typeCache["System.Text.StringBuilder"] = sbType;
+    }
+
+    // ── Constructor ───────────────────────────────────────────
+
+    private bool TryEmitStringBuilderNewObj(IRBasicBlock block, Stack<string> stack,
+        MethodReference ctorRef, ref int tempCounter)
+    {
+        if (!IsStringBuilderType(ctorRef.DeclaringType)) return false;
+
+        var paramTypes = ctorRef.Parameters.Select(p => p.ParameterType.FullName).ToArray();
+        var args = PopArgs(stack, paramTypes.Length);
+
+        string call;
+        switch (paramTypes)
+        {
+            case []:
+                call = "cil2cpp::string_builder_create()";
+                break;
+            case ["System.Int32"]:
+                call = $"cil2cpp::string_builder_create({args[0]})";
+                break;
+            case ["System.Int32", "System.Int32"]:
+                call = $"cil2cpp::string_builder_create({args[0]}, {args[1]})";
+                break;
+            case ["System.String"]:
+                call = $"cil2cpp::string_builder_create(static_cast<cil2cpp::String*>({args[0]}))";
+                break;
+            case ["System.String", "System.Int32"]:
+                call = $"cil2cpp::string_builder_create(static_cast<cil2cpp::String*>({args[0]}), {args[1]})";
+                break;
+            case ["System.String", "System.Int32", "System.Int32", "System.Int32"]:
+                // StringBuilder(string value, int startIndex, int length, int capacity)
+                call = $"cil2cpp::string_builder_create(" +
+                       $"cil2cpp::string_substring({args[0]}, {args[1]}, {args[2]}), {args[3]})";
+                break;
+            default:
+                // Unknown overload: put the arguments back for the generic path
+                foreach (var arg in args) stack.Push(arg);
+                return false;
+        }
+
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = {call};" });
+        stack.Push(tmp);
+        return true;
+    }
+
+    // ── Method calls ──────────────────────────────────────────
+
+    private bool TryEmitStringBuilderCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        if (!IsStringBuilderType(methodRef.DeclaringType) || !methodRef.HasThis) return false;
+
+        var paramTypes = methodRef.Parameters.Select(p => p.ParameterType.FullName).ToArray();
+
+        // AppendFormat(string, object[, object[, object]]) packs its arguments first
+        if (methodRef.Name == "AppendFormat")
+            return EmitStringBuilderAppendFormat(block, stack, paramTypes, ref tempCounter);
+
+        var function = GetStringBuilderFunction(methodRef.Name, paramTypes);
+        if (function == null) return false;
+
+        var args = PopArgs(stack, paramTypes.Length);
+        var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+        for (int i = 0; i < args.Length; i++)
+            args[i] = CastStringBuilderArg(paramTypes[i], args[i]);
+
+        var argList = string.Join("", args.Select(a => $", {a}"));
+        var call = $"{function}(reinterpret_cast<cil2cpp::StringBuilder*>({thisExpr}){argList})";
+
+        if (methodRef.ReturnType.FullName == "System.Void")
+        {
+            block.Instructions.Add(new IRRawCpp { Code = $"{call};" });
+        }
+        else
+        {
+            var tmp = $"__t{tempCounter++}";
+            block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = {call};" });
+            stack.Push(tmp);
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Map a StringBuilder method overload to its runtime function, or null if unsupported.
+    /// </summary>
+    internal static string? GetStringBuilderFunction(string methodName, string[] paramTypes)
+    {
+        return (methodName, paramTypes) switch
+        {
+            ("Append", ["System.String"]) => "cil2cpp::string_builder_append",
+            ("Append", ["System.String", "System.Int32", "System.Int32"]) => "cil2cpp::string_builder_append",
+            ("Append", ["System.Char"]) => "cil2cpp::string_builder_append_char",
+            ("Append", ["System.Char", "System.Int32"]) => "cil2cpp::string_builder_append_char",
+            ("Append", ["System.Char[]"]) => "cil2cpp::string_builder_append_char_array",
+            ("Append", ["System.Char[]", "System.Int32", "System.Int32"]) => "cil2cpp::string_builder_append_char_array",
+            ("Append", ["System.Int32" or "System.Int16" or "System.SByte"]) => "cil2cpp::string_builder_append_int32",
+            ("Append", ["System.UInt32" or "System.UInt16" or "System.Byte"]) => "cil2cpp::string_builder_append_uint32",
+            ("Append", ["System.Int64"]) => "cil2cpp::string_builder_append_int64",
+            ("Append", ["System.UInt64"]) => "cil2cpp::string_builder_append_uint64",
+            ("Append", ["System.Double"]) => "cil2cpp::string_builder_append_double",
+            ("Append", ["System.Single"]) => "cil2cpp::string_builder_append_single",
+            ("Append", ["System.Boolean"]) => "cil2cpp::string_builder_append_bool",
+            ("Append", ["System.Object"]) => "cil2cpp::string_builder_append_object",
+            ("Append", ["System.Text.StringBuilder"]) => "cil2cpp::string_builder_append_builder",
+            ("AppendLine", []) => "cil2cpp::string_builder_append_line",
+            ("AppendLine", ["System.String"]) => "cil2cpp::string_builder_append_line",
+            ("Insert", ["System.Int32", "System.String"]) => "cil2cpp::string_builder_insert",
+            ("Insert", ["System.Int32", "System.Char"]) => "cil2cpp::string_builder_insert_char",
+            ("Remove", ["System.Int32", "System.Int32"]) => "cil2cpp::string_builder_remove",
+            ("Replace", ["System.String", "System.String"]) => "cil2cpp::string_builder_replace",
+            ("Replace", ["System.String", "System.String", "System.Int32", "System.Int32"]) => "cil2cpp::string_builder_replace",
+            ("Replace", ["System.Char", "System.Char"]) => "cil2cpp::string_builder_replace_char",
+            ("Replace", ["System.Char", "System.Char", "System.Int32", "System.Int32"]) => "cil2cpp::string_builder_replace_char",
+            ("Clear", []) => "cil2cpp::string_builder_clear",
+            ("ToString", []) => "cil2cpp::string_builder_to_string",
+            ("ToString", ["System.Int32", "System.Int32"]) => "cil2cpp::string_builder_to_string",
+            ("get_Length", []) => "cil2cpp::string_builder_get_length",
+            ("set_Length", ["System.Int32"]) => "cil2cpp::string_builder_set_length",
+            ("get_Capacity", []) => "cil2cpp::string_builder_get_capacity",
+            ("set_Capacity", ["System.Int32"]) => "cil2cpp::string_builder_set_capacity",
+            ("EnsureCapacity", ["System.Int32"]) => "cil2cpp::string_builder_ensure_capacity",
+            ("get_MaxCapacity", []) => "cil2cpp::string_builder_get_max_capacity",
+            ("get_Chars", ["System.Int32"]) => "cil2cpp::string_builder_get_char",
+            ("set_Chars", ["System.Int32", "System.Char"]) => "cil2cpp::string_builder_set_char",
+            _ => null,
+        };
+    }
+
+    private static string CastStringBuilderArg(string paramType, string arg) => paramType switch
+    {
+        "System.String" => $"static_cast<cil2cpp::String*>({arg})",
+        "System.Object" => $"(cil2cpp::Object*)({arg})",
+        "System.Char[]" => $"reinterpret_cast<cil2cpp::Array*>({arg})",
+        "System.Text.StringBuilder" => $"reinterpret_cast<cil2cpp::StringBuilder*>({arg})",
+        _ => arg,
+    };
+
+    /// <summary>
+    /// AppendFormat(string, object...) / AppendFormat(string, object[]):
+    /// arguments are passed like String.Format's (primitives unboxed), then
+    /// string_builder_append_format. IFormatProvider overloads are left to the generic path.
+    /// </summary>
+    private bool EmitStringBuilderAppendFormat(IRBasicBlock block, Stack<string> stack,
+        string[] paramTypes, ref int tempCounter)
+    {
+        if (paramTypes.Length < 2 || paramTypes[0] != "System.String") return false;
+
+        string argsExpr;
+        if (paramTypes is ["System.String", "System.Object[]"])
+        {
+            argsExpr = $"reinterpret_cast<cil2cpp::Array*>({stack.Pop()})";
+        }
+        else if (paramTypes.Skip(1).All(t => t == "System.Object"))
+        {
+            var argCount = paramTypes.Length - 1;
+            var args = PopArgs(stack, argCount);
+            argsExpr = $"{EmitFormatArgs(block, stack, args, ref tempCounter)}, {argCount}";
+        }
+        else
+        {
+            return false;
+        }
+
+        var fmtExpr = stack.Pop();
+        var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp
+        {
+            Code = $"auto {tmp} = cil2cpp::string_builder_append_format(" +
+                   $"reinterpret_cast<cil2cpp::StringBuilder*>({thisExpr}), {fmtExpr}, {argsExpr});"
+        });
+        stack.Push(tmp);
+        return true;
+    }
+
+    /// <summary>Pop N call arguments (last argument is on top) into source order.</summary>
+    private static string[] PopArgs(Stack<string> stack, int count)
+    {
+        var args = new string[count];
+        for (int i = count - 1; i >= 0; i--)
+            args[i] = stack.Count > 0 ? stack.Pop() : "nullptr";
+        return args;
+    }
+}
@@ -3,8 +3,9 @@ using Mono.Cecil;
 namespace CIL2CPP.Core.IR;
 
 /// <summary>
-/// String.Format interception — packs variadic args into an Object[] array
-/// then calls cil2cpp::string_format(format, argsArray).
+/// String.Format interception. Variadic overloads pass their arguments as a
+/// stack cil2cpp::FormatArg[] (primitives unboxed); the object[] overload
+/// calls cil2cpp::string_format(format, argsArray).
 /// </summary>
 public partial class IRBuilder
 {
@@ -67,7 +68,7 @@ public partial class IRBuilder
     }
 
     /// <summary>
-    /// Pack N object args into an Object[] array and call string_format.
+    /// Pack N args into a stack FormatArg[] and call string_format(fmt, args, N).
     /// </summary>
     private bool EmitStringFormatPack(IRBasicBlock block, Stack<string> stack,
         ref int tempCounter, int argCount)
@@ -78,23 +79,66 @@ public partial class IRBuilder
             args[i] = stack.Pop();
         var fmtExpr = stack.Pop();
 
-        var id = tempCounter;
         var tmp = $"__t{tempCounter++}";
-        var arrVar = $"__fmt_a{id}";
+        var arrVar = EmitFormatArgs(block, stack, args, ref tempCounter);
+        block.Instructions.Add(new IRRawCpp
+        {
+            Code = $"{tmp} = cil2cpp::string_format({fmtExpr}, {arrVar}, {argCount});"
+        });
+        stack.Push(tmp);
+        return true;
+    }
 
-        // Create Object[] array and fill
-        var code = $"auto* {arrVar} = cil2cpp::array_create(nullptr, {argCount}); ";
-        for (int i = 0; i < argCount; i++)
+    /// <summary>
+    /// Primitive boxes whose value cil2cpp::FormatArg can carry unboxed (TypeInfo names).
+    /// </summary>
+    private static readonly HashSet<string> FormatArgPrimitives = new()
+    {
+        "System_Boolean", "System_Char", "System_SByte", "System_Byte",
+        "System_Int16", "System_UInt16", "System_Int32", "System_UInt32",
+        "System_Int64", "System_UInt64", "System_Single", "System_Double",
+    };
+
+    /// <summary>
+    /// Emit a stack cil2cpp::FormatArg[] for composite-format arguments and return its name.
+    /// An argument produced by a primitive box earlier in the same block, and used
+    /// nowhere else, is passed unboxed: the box is rewritten in place into a FormatArg
+    /// of the value, so the value is still captured at the point the IL evaluated it.
+    /// </summary>
+    private string EmitFormatArgs(IRBasicBlock block, Stack<string> stack, string[] args,
+        ref int tempCounter)
+    {
+        var items = new string[args.Length];
+        for (int i = 0; i < args.Length; i++)
         {
-            code += $"static_cast<cil2cpp::Object**>(cil2cpp::array_data({arrVar}))[{i}] = " +
-                    $"(cil2cpp::Object*)({args[i]}); ";
+            var arg = args[i];
+            var boxIndex = block.Instructions.FindLastIndex(instr =>
+                instr is IRBox box && box.ResultVar == arg);
+            if (boxIndex >= 0
+                && block.Instructions[boxIndex] is IRBox box
+                && FormatArgPrimitives.Contains(box.TypeInfoCppName ?? box.ValueTypeCppName)
+                && !stack.Contains(arg)
+                && args.Count(a => a == arg) == 1
+                && !block.Instructions.Skip(boxIndex + 1).Any(instr => instr.ToCpp().Contains(arg)))
+            {
+                var valueVar = $"__fmt_v{tempCounter++}";
+                block.Instructions[boxIndex] = new IRRawCpp
+                {
+                    Code = $"cil2cpp::FormatArg {valueVar}(static_cast<{box.ValueTypeCppName}>({box.ValueExpr}));"
+                };
+                items[i] = valueVar;
+            }
+            else
+            {
+                items[i] = $"cil2cpp::FormatArg((cil2cpp::Object*)({arg}))";
+            }
         }
-        block.Instructions.Add(new IRRawCpp { Code = code });
+
+        var arrVar = $"__fmt_a{tempCounter++}";
         block.Instructions.Add(new IRRawCpp
         {
-            Code = $"{tmp} = cil2cpp::string_format({fmtExpr}, {arrVar});"
+            Code = $"cil2cpp::FormatArg {arrVar}[] = {{ {string.Join(", ", items)} }};"
         });
-        stack.Push(tmp);
-        return true;
+        return arrVar;
     }
 }
@@ -0,0 +1,170 @@
+using Mono.Cecil;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// SemaphoreSlim / ManualResetEventSlim / ReaderWriterLockSlim interception.
+/// All three are runtime-provided reference types (synchronization.h): the
+/// constructors and members below become direct calls into the runtime, which
+/// spins briefly and then parks on the runtime's parking lot. Overloads taking
+/// a TimeSpan or CancellationToken, WaitAsync with a timeout, and upgradeable
+/// read locks are not lowered.
+/// </summary>
+public partial class IRBuilder
+{
+    private const string SemaphoreSlimType = "System.Threading.SemaphoreSlim";
+    private const string ManualResetEventSlimType = "System.Threading.ManualResetEventSlim";
+    private const string ReaderWriterLockSlimType = "System.Threading.ReaderWriterLockSlim";
+
+    /// <summary>
+    /// Create synthetic IRTypes for the three runtime-provided synchronization types.
+    /// </summary>
+    private void CreateSynchronizationSyntheticTypes()
+    {
+        foreach (var (ilName, name) in new[]
+        {
+            (SemaphoreSlimType, "SemaphoreSlim"),
+            (ManualResetEventSlimType, "ManualResetEventSlim"),
+            (ReaderWriterLockSlimType, "ReaderWriterLockSlim"),
+        })
+        {
+            if (_typeCache.ContainsKey(ilName)) continue;
+            var irType = new IRType
+            {
+                ILFullName = ilName,
+                CppName = CppNameMapper.MangleTypeName(ilName),
+                Name = name,
+                Namespace = "System.Threading",
+                IsValueType = false,
+                IsSealed = false,
+                IsRuntimeProvided = true,
+            };
+            _module.Types.Add(irType);
+            _typeCache[ilName] = irType;
+        }
+    }
+
+    /// <summary>
+    /// True when the parameter types match <paramref name="types"/> exactly;
+    /// picks the overloads that have a runtime lowering.
+    /// </summary>
+    private static bool HasParameters(MethodReference methodRef, params string[] types)
+    {
+        if (methodRef.Parameters.Count != types.Length) return false;
+        for (int i = 0; i < types.Length; i++)
+        {
+            if (methodRef.Parameters[i].ParameterType.FullName != types[i]) return false;
+        }
+        return true;
+    }
+
+    private bool TryEmitSynchronizationNewObj(IRBasicBlock block, Stack<string> stack,
+        MethodReference ctorRef, ref int tempCounter)
+    {
+        string? call = ctorRef.DeclaringType.FullName switch
+        {
+            SemaphoreSlimType when HasParameters(ctorRef, "System.Int32") =>
+                $"cil2cpp::semaphore_create({PopOr(stack, "0")}, 0x7FFFFFFF)",   // maxCount = int.MaxValue
+            SemaphoreSlimType when HasParameters(ctorRef, "System.Int32", "System.Int32") =>
+                PopCall(stack, "cil2cpp::semaphore_create", 2),
+            ManualResetEventSlimType when HasParameters(ctorRef) =>
+                "cil2cpp::reset_event_create(false, -1)",
+            ManualResetEventSlimType when HasParameters(ctorRef, "System.Boolean") =>
+                $"cil2cpp::reset_event_create({PopOr(stack, "false")}, -1)",
+            ManualResetEventSlimType when HasParameters(ctorRef, "System.Boolean", "System.Int32") =>
+                PopCall(stack, "cil2cpp::reset_event_create", 2),
+            ReaderWriterLockSlimType when HasParameters(ctorRef) =>
+                "cil2cpp::rwlock_create(0)",
+            ReaderWriterLockSlimType when HasParameters(ctorRef, "System.Threading.LockRecursionPolicy") =>
+                $"cil2cpp::rwlock_create(static_cast<int32_t>({PopOr(stack, "0")}))",
+            _ => null,
+        };
+        if (call == null) return false;
+
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = {call};" });
+        stack.Push(tmp);
+        return true;
+    }
+
+    private bool TryEmitSynchronizationCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        var (runtimeType, lowered) = methodRef.DeclaringType.FullName switch
+        {
+            SemaphoreSlimType => ("cil2cpp::SemaphoreSlim", LowerSemaphoreSlim(methodRef)),
+            ManualResetEventSlimType => ("cil2cpp::ManualResetEventSlim", LowerManualResetEventSlim(methodRef)),
+            ReaderWriterLockSlimType => ("cil2cpp::ReaderWriterLockSlim", LowerReaderWriterLockSlim(methodRef)),
+            _ => (null, null),
+        };
+        if (lowered == null) return false;
+
+        // lowered: a format string over {0} = receiver and {1}.. = arguments
+        var args = new string[methodRef.Parameters.Count + 1];
+        for (int i = args.Length - 1; i >= 1; i--)
+            args[i] = stack.Count > 0 ? stack.Pop() : "0";
+        var thisExpr = stack.Count > 0 ? stack.Pop() : "nullptr";
+        args[0] = $"reinterpret_cast<{runtimeType}*>({thisExpr})";
+        var expr = string.Format(lowered, args);
+
+        if (methodRef.ReturnType.FullName == "System.Void")
+        {
+            block.Instructions.Add(new IRRawCpp { Code = $"{expr};" });
+            return true;
+        }
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = {expr};" });
+        stack.Push(tmp);
+        return true;
+    }
+
+    private static string? LowerSemaphoreSlim(MethodReference m) => m.Name switch
+    {
+        "Wait" when HasParameters(m) => "cil2cpp::semaphore_wait({0}, -1)",
+        "Wait" when HasParameters(m, "System.Int32") => "cil2cpp::semaphore_wait({0}, {1})",
+        "WaitAsync" when HasParameters(m) => "cil2cpp::semaphore_wait_async({0})",
+        "Release" when HasParameters(m) => "cil2cpp::semaphore_release({0}, 1)",
+        "Release" when HasParameters(m, "System.Int32") => "cil2cpp::semaphore_release({0}, {1})",
+        "get_CurrentCount" => "cil2cpp::semaphore_current_count({0})",
+        "Dispose" when HasParameters(m) => "(void)({0})",
+        _ => null,
+    };
+
+    private static string? LowerManualResetEventSlim(MethodReference m) => m.Name switch
+    {
+        "Set" => "cil2cpp::reset_event_set({0})",
+        "Reset" => "cil2cpp::reset_event_reset({0})",
+        "get_IsSet" => "cil2cpp::reset_event_is_set({0})",
+        "Wait" when HasParameters(m) => "cil2cpp::reset_event_wait({0}, -1)",
+        "Wait" when HasParameters(m, "System.Int32") => "cil2cpp::reset_event_wait({0}, {1})",
+        "Dispose" when HasParameters(m) => "(void)({0})",
+        _ => null,
+    };
+
+    private static string? LowerReaderWriterLockSlim(MethodReference m) => m.Name switch
+    {
+        "EnterReadLock" => "cil2cpp::rwlock_enter_read({0}, -1)",
+        "TryEnterReadLock" when HasParameters(m, "System.Int32") => "cil2cpp::rwlock_enter_read({0}, {1})",
+        "ExitReadLock" => "cil2cpp::rwlock_exit_read({0})",
+        "EnterWriteLock" => "cil2cpp::rwlock_enter_write({0}, -1)",
+        "TryEnterWriteLock" when HasParameters(m, "System.Int32") => "cil2cpp::rwlock_enter_write({0}, {1})",
+        "ExitWriteLock" => "cil2cpp::rwlock_exit_write({0})",
+        "get_IsWriteLockHeld" => "cil2cpp::rwlock_is_write_lock_held({0})",
+        "get_CurrentReadCount" => "cil2cpp::rwlock_current_read_count({0})",
+        "get_WaitingWriteCount" => "cil2cpp::rwlock_waiting_write_count({0})",
+        "Dispose" => "(void)({0})",
+        _ => null,
+    };
+
+    private static string PopOr(Stack<string> stack, string fallback)
+        => stack.Count > 0 ? stack.Pop() : fallback;
+
+    /// <summary>Pop <paramref name="count"/> arguments and format fn(arg0, ..).</summary>
+    private static string PopCall(Stack<string> stack, string fn, int count)
+    {
+        var args = new string[count];
+        for (int i = count - 1; i >= 0; i--)
+            args[i] = PopOr(stack, "0");
+        return $"{fn}({string.Join(", ", args)})";
+    }
+}
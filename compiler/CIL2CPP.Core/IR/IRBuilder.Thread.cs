@@ -6,10 +6,24 @@ namespace CIL2CPP.Core.IR;
 /// System.Threading.Thread method interception.
 /// Thread is a reference type whose methods are not in user assemblies.
 /// We intercept calls and emit inline C++ delegating to runtime functions.
-/// Also handles Thread.MemoryBarrier.
+/// Also handles Thread.MemoryBarrier, [ThreadStatic] fields and ThreadLocal&lt;T&gt;.
 /// </summary>
 public partial class IRBuilder
 {
+    /// <summary>
+    /// True for a [ThreadStatic] static field. Such fields live in the declaring
+    /// type's thread_local {Type}_thread_statics block instead of {Type}_statics.
+    /// </summary>
+    internal static bool IsThreadStaticField(FieldReference fieldRef)
+    {
+        var fieldDef = fieldRef.Resolve();
+        return fieldDef is { IsStatic: true }
+            && fieldDef.CustomAttributes.Any(a => a.AttributeType.FullName == "System.ThreadStaticAttribute");
+    }
+
+    private static string StaticsBlockName(string typeCppName, bool threadStatic) =>
+        threadStatic ? $"{typeCppName}_thread_statics" : $"{typeCppName}_statics";
+
     /// <summary>
     /// Create synthetic IRType for System.Threading.Thread.
     /// Thread is a reference type (not value type) with runtime backing.
@@ -54,7 +68,7 @@ public partial class IRBuilder
                 {
                     Code = $"{{ auto __tmp_thread = cil2cpp::thread::create(" +
                            $"reinterpret_cast<cil2cpp::Delegate*>({startDelegate})); " +
-                           $"std::memcpy({thisArg}, __tmp_thread, sizeof(cil2cpp::ManagedThread)); }}"
+                           $"std::memcpy(static_cast<void*>({thisArg}), __tmp_thread, sizeof(cil2cpp::ManagedThread)); }}"
                 });
                 return true;
             }
@@ -121,6 +135,17 @@ public partial class IRBuilder
                 stack.Push(tmp);
                 return true;
             }
+            case "get_CurrentThread":
+            {
+                // static Thread CurrentThread { get; } — thread-local lookup
+                var tmp = $"__t{tempCounter++}";
+                block.Instructions.Add(new IRRawCpp
+                {
+                    Code = $"auto {tmp} = cil2cpp::thread::current();"
+                });
+                stack.Push(tmp);
+                return true;
+            }
             case "Sleep":
             {
                 // static void Sleep(int) — handled by ICallRegistry, but intercept here too
@@ -178,4 +203,88 @@ public partial class IRBuilder
         stack.Push(tmp);
         return true;
     }
+
+    // ===== ThreadLocal<T> =====
+
+    private const string ThreadLocalType = "System.Threading.ThreadLocal`1";
+
+    internal static bool IsThreadLocalBclGenericType(string openTypeName) => openTypeName == ThreadLocalType;
+
+    /// <summary>
+    /// new ThreadLocal&lt;T&gt;() / (Func&lt;T&gt;) / (bool) / (Func&lt;T&gt;, bool): a runtime
+    /// ThreadLocal (threadlocal.h) with T erased to its size. trackAllValues is
+    /// ignored (Values is not lowered).
+    /// </summary>
+    private bool TryEmitThreadLocalNewObj(IRBasicBlock block, Stack<string> stack,
+        MethodReference ctorRef, ref int tempCounter)
+    {
+        if (ctorRef.DeclaringType is not GenericInstanceType { ElementType.FullName: ThreadLocalType } git)
+            return false;
+
+        var args = PopArgs(stack, ctorRef.Parameters.Count);
+        var factory = "nullptr";
+        for (int i = 0; i < args.Length; i++)
+        {
+            if (ctorRef.Parameters[i].ParameterType.FullName.StartsWith("System.Func`1"))
+                factory = $"(cil2cpp::Delegate*)({args[i]})";
+        }
+        var elemIL = ResolveTypeRefOperand(git.GenericArguments[0]);
+        var elemSize = $"sizeof({CppNameMapper.GetCppTypeForDecl(elemIL)})";
+        var tmp = $"__t{tempCounter++}";
+        block.Instructions.Add(new IRRawCpp
+        {
+            Code = $"auto {tmp} = {ThreadLocalHandle(git, $"cil2cpp::threadlocal_create({elemSize}, {factory})")};"
+        });
+        stack.Push(tmp);
+        return true;
+    }
+
+    /// <summary>
+    /// ThreadLocal&lt;T&gt;.Value get/set (inline fast path), IsValueCreated and Dispose.
+    /// </summary>
+    private bool TryEmitThreadLocalCall(IRBasicBlock block, Stack<string> stack,
+        MethodReference methodRef, ref int tempCounter)
+    {
+        if (methodRef.DeclaringType is not GenericInstanceType { ElementType.FullName: ThreadLocalType } git)
+            return false;
+        if (methodRef.Name is not ("get_Value" or "set_Value" or "get_IsValueCreated" or "Dispose"))
+            return false;
+        if (methodRef.Name == "Dispose" && methodRef.Parameters.Count != 0) return false;
+
+        var elemCpp = CppNameMapper.GetCppTypeForDecl(ResolveTypeRefOperand(git.GenericArguments[0]));
+        var value = methodRef.Name == "set_Value" ? PopOr(stack, "{}") : null;
+        var tl = $"(cil2cpp::ThreadLocal*)({PopOr(stack, "nullptr")})";
+
+        switch (methodRef.Name)
+        {
+            case "get_Value":
+            case "get_IsValueCreated":
+            {
+                var tmp = $"__t{tempCounter++}";
+                var call = methodRef.Name == "get_Value"
+                    ? $"cil2cpp::threadlocal_get_value<{elemCpp}>({tl})"
+                    : $"cil2cpp::threadlocal_is_value_created({tl})";
+                block.Instructions.Add(new IRRawCpp { Code = $"auto {tmp} = {call};" });
+                stack.Push(tmp);
+                break;
+            }
+            case "set_Value":
+                block.Instructions.Add(new IRRawCpp
+                {
+                    Code = $"cil2cpp::threadlocal_set_value<{elemCpp}>({tl}, {value});"
+                });
+                break;
+            default:
+                block.Instructions.Add(new IRRawCpp { Code = $"cil2cpp::threadlocal_dispose({tl});" });
+                break;
+        }
+        return true;
+    }
+
+    private string ThreadLocalHandle(GenericInstanceType git, string expr)
+    {
+        var key = $"{ThreadLocalType}<{ResolveTypeRefOperand(git.GenericArguments[0])}>";
+        var cpp = _typeCache.TryGetValue(key, out var irType) ? irType.CppName : "cil2cpp::Object";
+        return $"({cpp}*)({expr})";
+    }
 }
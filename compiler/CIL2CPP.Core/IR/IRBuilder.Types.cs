@@ -25,6 +25,8 @@ public partial class IRBuilder
         if (typeDef.IsEnum)
             irType.EnumUnderlyingType = typeDef.EnumUnderlyingType ?? "System.Int32";
 
+        irType.IsPooledAsyncStateMachine = IsPooledAsyncStateMachine(typeDef.GetCecilType());
+
         // Detect delegate types (base is System.MulticastDelegate)
         if (typeDef.BaseTypeName is "System.MulticastDelegate" or "System.Delegate")
             irType.IsDelegate = true;
@@ -94,6 +96,7 @@ public partial class IRBuilder
 
             irField.ConstantValue = fieldDef.ConstantValue;
             irField.Attributes = (uint)fieldDef.GetCecilField().Attributes;
+            irField.IsThreadStatic = fieldDef.IsStatic && IsThreadStaticField(fieldDef.GetCecilField());
 
             if (fieldDef.IsStatic)
                 irType.StaticFields.Add(irField);
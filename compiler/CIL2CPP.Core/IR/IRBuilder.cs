@@ -39,6 +39,11 @@ public partial class IRBuilder
         "System.Runtime.CompilerServices.IAsyncStateMachine",
         "System.Threading.Thread",
         "System.Threading.CancellationTokenSource",
+        "System.Text.StringBuilder",
+        "System.Threading.Tasks.ParallelOptions",
+        "System.Threading.SemaphoreSlim",
+        "System.Threading.ManualResetEventSlim",
+        "System.Threading.ReaderWriterLockSlim",
         "System.Type",
         "System.Span`1",
         "System.ReadOnlySpan`1",
@@ -67,6 +72,15 @@ public partial class IRBuilder
     private bool _inFilterRegion;
     private int _endfilterOffset = -1;
 
+    // ldftn targets by result temp, and LINQ queries emitted so far (IRBuilder.Linq.cs)
+    private readonly Dictionary<string, MethodReference> _functionPointerMethods = new();
+    private readonly List<LinqEmission> _linqEmissions = new();
+
+    // Pooled async state machines (IRBuilder.Async.cs): the box type created in the
+    // current stub, and whether the current method is a pooled MoveNext
+    private string? _pooledBoxTypeCpp;
+    private bool _inPooledMoveNext;
+
     // Multi-assembly mode fields (null in single-assembly mode)
     private AssemblySet? _assemblySet;
     private ReachabilityResult? _reachability;
@@ -181,9 +195,18 @@ public partial class IRBuilder
         // Pass 1.5b2: Create synthetic types for CancellationTokenSource/CancellationToken
         CreateCancellationSyntheticTypes();
 
-        // Pass 1.5b3: Create synthetic types for async enumerable (ValueTask, AsyncIteratorMethodBuilder)
+        // Pass 1.5b3: Create synthetic type for System.Text.StringBuilder (reference type)
+        CreateStringBuilderSyntheticType();
+
+        // Pass 1.5b4: Create synthetic types for async enumerable (ValueTask, AsyncIteratorMethodBuilder)
         CreateAsyncEnumerableSyntheticTypes();
 
+        // Pass 1.5b5: Create synthetic types for ParallelOptions/ParallelLoopResult
+        CreateParallelSyntheticTypes();
+
+        // Pass 1.5b6: Create synthetic types for SemaphoreSlim/ManualResetEventSlim/ReaderWriterLockSlim
+        CreateSynchronizationSyntheticTypes();
+
         // Pass 1.5c: Create proxy types for well-known BCL interfaces (IDisposable, IEnumerable, etc.)
         // In multi-assembly mode, real BCL interfaces are loaded from assemblies — no proxies needed.
         if (_assemblySet == null)
@@ -303,6 +326,15 @@ public partial class IRBuilder
                 SynthesizeRecordMethods(irType);
         }
 
+        // Pass 8: Inline small methods (getters/setters, forwarders, short helpers)
+        if (_config.EnableInlining)
+            MethodInliner.Run(_module);
+
+        // Pass 9: Move allocations that never leave their method to the stack
+        // (needs every body converted: callee parameters are summarized on demand)
+        if (_config.EnableEscapeAnalysis)
+            EscapeAnalysis.Run(_module);
+
         return _module;
     }
 
@@ -117,12 +117,26 @@ public class IRNewObj : IRInstruction
     public string CtorName { get; set; } = "";
     public List<string> CtorArgs { get; } = new();
     public string ResultVar { get; set; } = "";
+    /// <summary>
+    /// Set by EscapeAnalysis: name of the method-local storage the object is
+    /// constructed in instead of the GC heap.
+    /// </summary>
+    public string? StackStorage { get; set; }
+    /// <summary>
+    /// Async state machine box taken from the runtime's per-thread pool
+    /// (IRType.IsPooledAsyncStateMachine); released by the stub and by MoveNext.
+    /// </summary>
+    public bool Pooled { get; set; }
 
     public override string ToCpp()
     {
         var lines = new List<string>
         {
-            $"{ResultVar} = ({TypeCppName}*)cil2cpp::gc::alloc(sizeof({TypeCppName}), &{TypeCppName}_TypeInfo);",
+            StackStorage != null
+                ? $"{ResultVar} = ({TypeCppName}*)cil2cpp::object_init_stack(&{StackStorage}, sizeof({TypeCppName}), &{TypeCppName}_TypeInfo);"
+                : Pooled
+                    ? $"{ResultVar} = ({TypeCppName}*)cil2cpp::async_box_acquire(sizeof({TypeCppName}), &{TypeCppName}_TypeInfo);"
+                    : $"{ResultVar} = ({TypeCppName}*)cil2cpp::gc::alloc(sizeof({TypeCppName}), &{TypeCppName}_TypeInfo);",
         };
 
         var allArgs = new List<string> { ResultVar };
@@ -237,10 +251,13 @@ public class IRStaticFieldAccess : IRInstruction
     public string ResultVar { get; set; } = "";
     public bool IsStore { get; set; }
     public string? StoreValue { get; set; }
+    /// <summary>[ThreadStatic] field: lives in {Type}_thread_statics</summary>
+    public bool IsThreadStatic { get; set; }
 
     public override string ToCpp()
     {
-        var fullName = $"{TypeCppName}_statics.{FieldCppName}";
+        var block = IsThreadStatic ? $"{TypeCppName}_thread_statics" : $"{TypeCppName}_statics";
+        var fullName = $"{block}.{FieldCppName}";
         if (IsStore)
             return $"{fullName} = {StoreValue};";
         return $"{ResultVar} = {fullName};";
@@ -255,12 +272,32 @@ public class IRArrayAccess : IRInstruction
     public string ResultVar { get; set; } = "";
     public bool IsStore { get; set; }
     public string? StoreValue { get; set; }
+    /// <summary>Set by BoundsCheckElimination when the index is proven in range.</summary>
+    public bool BoundsCheckElided { get; set; }
 
     public override string ToCpp()
     {
+        var suffix = BoundsCheckElided ? "_unchecked" : "";
         if (IsStore)
-            return $"cil2cpp::array_set<{ElementType}>({ArrayExpr}, {IndexExpr}, {StoreValue});";
-        return $"{ResultVar} = cil2cpp::array_get<{ElementType}>({ArrayExpr}, {IndexExpr});";
+            return $"cil2cpp::array_set{suffix}<{ElementType}>({ArrayExpr}, {IndexExpr}, {StoreValue});";
+        return $"{ResultVar} = cil2cpp::array_get{suffix}<{ElementType}>({ArrayExpr}, {IndexExpr});";
+    }
+}
+
+/// <summary>ldelema: address of a 1-D array element.</summary>
+public class IRArrayElementAddress : IRInstruction
+{
+    public string ArrayExpr { get; set; } = "";
+    public string IndexExpr { get; set; } = "";
+    public string ElementType { get; set; } = "";
+    public string ResultVar { get; set; } = "";
+    /// <summary>Set by BoundsCheckElimination when the index is proven in range.</summary>
+    public bool BoundsCheckElided { get; set; }
+
+    public override string ToCpp()
+    {
+        var suffix = BoundsCheckElided ? "_unchecked" : "";
+        return $"{ResultVar} = cil2cpp::array_element_ptr{suffix}<{ElementType}>({ArrayExpr}, {IndexExpr});";
     }
 }
 
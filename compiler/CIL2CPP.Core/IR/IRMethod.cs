@@ -26,6 +26,15 @@ public class IRMethod
     /// <summary>Local variables</summary>
     public List<IRLocal> Locals { get; } = new();
 
+    /// <summary>
+    /// Storage for objects EscapeAnalysis moved off the GC heap, declared
+    /// uninitialized at the top of the body (CppTypeName is the class struct).
+    /// </summary>
+    public List<IRLocal> StackObjects { get; } = new();
+
+    /// <summary>C++ names of the callees MethodInliner expanded into this body, one per call site.</summary>
+    public List<string> InlinedCalls { get; } = new();
+
     /// <summary>Basic blocks (control flow graph)</summary>
     public List<IRBasicBlock> BasicBlocks { get; } = new();
 
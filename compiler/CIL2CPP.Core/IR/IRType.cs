@@ -64,6 +64,9 @@ public class IRType
     public bool IsGenericInstance { get; set; }
     public bool IsRecord { get; set; }
 
+    /// <summary>Async state machine class boxed from the runtime's per-thread pool.</summary>
+    public bool IsPooledAsyncStateMachine { get; set; }
+
     /// <summary>Concrete type argument names for generic instances (e.g., ["System.Int32"])</summary>
     public List<string> GenericArguments { get; set; } = new();
 
@@ -114,6 +117,10 @@ public class IRField
     public string FieldTypeName { get; set; } = "";
     public bool IsStatic { get; set; }
     public bool IsPublic { get; set; }
+
+    /// <summary>[ThreadStatic] static field: stored in the type's thread_local statics block</summary>
+    public bool IsThreadStatic { get; set; }
+
     public int Offset { get; set; }
     public IRType? DeclaringType { get; set; }
     public object? ConstantValue { get; set; }
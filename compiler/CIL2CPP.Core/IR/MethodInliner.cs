@@ -0,0 +1,314 @@
+using System.Text.RegularExpressions;
+using CIL2CPP.Core.IL;
+
+namespace CIL2CPP.Core.IR;
+
+/// <summary>
+/// Replaces direct calls to small managed methods — property getters/setters,
+/// forwarding methods, short static helpers — with a copy of the callee's body.
+///
+/// A callee is inlined when its body, after its own calls have been inlined, is
+/// straight-line code of at most <see cref="MaxInlineSize"/> instructions ending
+/// in its only return: no labels, branches, exception regions or locals, no
+/// writes to its parameters, and only instructions whose operands can be renamed
+/// (field and static field access, arithmetic, conversions, casts, calls, cctor
+/// guards, and single-statement raw C++). Calls through the vtable, recursive
+/// methods, overloads sharing one C++ name and BCL bodies (emitted as stubs)
+/// are left alone.
+///
+/// Parameters are substituted as <c>((T)(arg))</c> so the callee's expressions
+/// keep their declared types; arguments that contain a call are evaluated once
+/// into a temp first. When the callee takes a by-ref or pointer parameter (or is
+/// an instance method of a value type), every non-constant argument goes into a
+/// temp, so a write through one argument is not seen by another that names the
+/// same variable (<c>F(ref x, x)</c>). The callee's temps are renamed into the caller's. A cctor
+/// guard that repeats an earlier guard with no label in between is dropped.
+/// </summary>
+public static class MethodInliner
+{
+    /// <summary>Largest callee body (excluding the return) that is inlined.</summary>
+    public const int MaxInlineSize = 8;
+
+    private static readonly Regex TempRegex =
+        new(@"__t(\d+)\b", RegexOptions.Compiled);
+    private static readonly Regex IdentifierRegex =
+        new(@"(?<![\w.:>])[A-Za-z_]\w*", RegexOptions.Compiled);
+    private static readonly Regex ConstantRegex =
+        new(@"^(-?[\d.]+[A-Za-z]*|nullptr|true|false)$", RegexOptions.Compiled);
+    private static readonly Regex SimpleOperandRegex =
+        new(@"^(&?[A-Za-z_]\w*|-?[\d.]+[A-Za-z]*|\([\w:]+\s*\*?\)\s*&?[A-Za-z_]\w*|nullptr|true|false)$",
+            RegexOptions.Compiled);
+
+    /// <summary>
+    /// Run the pass over every method body of the module. Returns the number of
+    /// call sites inlined; each caller lists its inlined callees in
+    /// IRMethod.InlinedCalls.
+    /// </summary>
+    public static int Run(IRModule module)
+    {
+        var methods = new Dictionary<string, List<IRMethod>>();
+        foreach (var method in module.GetAllMethods())
+        {
+            if (!methods.TryGetValue(method.CppName, out var list))
+                methods[method.CppName] = list = new List<IRMethod>();
+            list.Add(method);
+        }
+
+        var state = new State(methods);
+        foreach (var method in module.GetAllMethods())
+            state.Process(method);
+        return state.Inlined;
+    }
+
+    private sealed class State
+    {
+        private readonly Dictionary<string, List<IRMethod>> _methods;
+        private readonly HashSet<IRMethod> _done = new();
+        private readonly HashSet<IRMethod> _inProgress = new();
+        public int Inlined { get; private set; }
+
+        public State(Dictionary<string, List<IRMethod>> methods) => _methods = methods;
+
+        /// <summary>Inline into <paramref name="method"/>, finishing its callees first.</summary>
+        public void Process(IRMethod method)
+        {
+            if (_done.Contains(method) || !_inProgress.Add(method)) return;
+
+            int nextTemp = NextTempIndex(method);
+            foreach (var block in method.BasicBlocks)
+            {
+                for (int i = 0; i < block.Instructions.Count; i++)
+                {
+                    if (block.Instructions[i] is not IRCall call || call.IsVirtual) continue;
+                    var callee = Resolve(call);
+                    if (callee == null || callee == method) continue;
+
+                    Process(callee);
+                    if (_inProgress.Contains(callee) || !IsInlinable(callee)) continue;
+
+                    var body = Expand(call, callee, ref nextTemp);
+                    if (body == null) continue;
+
+                    block.Instructions.RemoveAt(i);
+                    block.Instructions.InsertRange(i, body);
+                    i += body.Count - 1;
+                    method.InlinedCalls.Add(callee.CppName);
+                    Inlined++;
+                }
+            }
+            if (method.InlinedCalls.Count > 0)
+                RemoveRepeatedCctorGuards(method);
+
+            _inProgress.Remove(method);
+            _done.Add(method);
+        }
+
+        private IRMethod? Resolve(IRCall call)
+        {
+            if (!_methods.TryGetValue(call.FunctionName, out var candidates) || candidates.Count != 1)
+                return null;
+            var callee = candidates[0];
+            int expected = callee.Parameters.Count + (callee.IsStatic ? 0 : 1);
+            return call.Arguments.Count == expected ? callee : null;
+        }
+    }
+
+    // ── Eligibility ──────────────────────────────────────────
+
+    private static bool IsInlinable(IRMethod callee)
+    {
+        if (callee.IsAbstract || callee.IsInternalCall || callee.IsPInvoke || callee.IsStaticConstructor)
+            return false;
+        // Only bodies the code generator emits as written (BCL bodies become stubs)
+        if (callee.DeclaringType is not { SourceKind: not AssemblyKind.BCL, IsRuntimeProvided: false,
+                IsDelegate: false, IsInterface: false })
+            return false;
+        if (callee.Locals.Count > 0 || callee.StackObjects.Count > 0) return false;
+
+        var body = callee.BasicBlocks.SelectMany(b => b.Instructions)
+            .Where(i => i is not IRComment).ToList();
+        if (body.Count == 0 || body.Count - 1 > MaxInlineSize) return false;
+        if (body[^1] is not IRReturn || body.Take(body.Count - 1).Any(i => i is IRReturn)) return false;
+        if (!body.All(IsRenamable)) return false;
+
+        foreach (var name in ParameterNames(callee))
+        {
+            if (body.Any(i => BoundsCheckElimination.MayWrite(i, name))) return false;
+            if (body.OfType<IRFieldAccess>().Any(f => f.IsValueAccess && f.IsStore && f.ObjectExpr == name))
+                return false;
+        }
+        return true;
+    }
+
+    private static bool IsRenamable(IRInstruction instr) => instr switch
+    {
+        IRFieldAccess or IRStaticFieldAccess or IRAssign or IRBinaryOp or IRUnaryOp
+            or IRConversion or IRCast or IRNullCheck or IRStaticCtorGuard or IRDeclareLocal
+            or IRReturn => true,
+        IRCall call => !call.IsInterfaceCall || call.InterfaceTypeCppName != null,
+        IRRawCpp raw => IsSingleStatement(raw.Code),
+        _ => false,
+    };
+
+    private static bool IsSingleStatement(string code)
+    {
+        code = code.Trim();
+        return code.EndsWith(';') && code.IndexOf(';') == code.Length - 1
+            && code.IndexOfAny(new[] { '{', '}', '"', '\'', '\n' }) < 0
+            && !code.Contains("goto") && !code.Contains("return") && !code.Contains("CIL2CPP_");
+    }
+
+    private static IEnumerable<string> ParameterNames(IRMethod method)
+    {
+        if (!method.IsStatic) yield return "__this";
+        foreach (var p in method.Parameters) yield return p.CppName;
+    }
+
+    /// <summary>Whether the callee can write to its caller's variables through a parameter.</summary>
+    private static bool HasByRefParameter(IRMethod method) =>
+        (!method.IsStatic && method.DeclaringType!.IsValueType)
+        || method.Parameters.Any(p => p.ILTypeName.EndsWith('&') || p.ILTypeName.EndsWith('*'));
+
+    // ── Expansion ────────────────────────────────────────────
+
+    private static List<IRInstruction>? Expand(IRCall call, IRMethod callee, ref int nextTemp)
+    {
+        var body = callee.BasicBlocks.SelectMany(b => b.Instructions).Where(i => i is not IRComment).ToList();
+        var ret = (IRReturn)body[^1];
+        if (ret.Value != null && call.ResultVar == null && ret.Value.Contains('(')
+            && Regex.IsMatch(ret.Value, @"\w\s*\("))
+            return null;
+
+        var result = new List<IRInstruction>();
+        var map = new Dictionary<string, string>();
+
+        // Parameters: ((T)(arg)), evaluating anything non-trivial once (and, next to
+        // a by-ref parameter, anything that is not a constant)
+        bool spillAll = HasByRefParameter(callee);
+        var types = new List<string>();
+        if (!callee.IsStatic) types.Add($"{callee.DeclaringType!.CppName}*");
+        types.AddRange(callee.Parameters.Select(p => p.CppTypeName));
+        var names = ParameterNames(callee).ToList();
+        for (int i = 0; i < names.Count; i++)
+        {
+            var arg = call.Arguments[i].Trim();
+            if (!SimpleOperandRegex.IsMatch(arg) || (spillAll && !ConstantRegex.IsMatch(arg)))
+            {
+                var temp = $"__t{nextTemp++}";
+                result.Add(new IRAssign { Target = temp, Value = arg });
+                arg = temp;
+            }
+            map[names[i]] = $"(({types[i]})({arg}))";
+        }
+
+        // Callee temps get fresh caller temps
+        foreach (var instr in body)
+        {
+            foreach (Match m in TempRegex.Matches(instr.ToCpp()))
+            {
+                if (!map.ContainsKey(m.Value))
+                    map[m.Value] = $"__t{nextTemp++}";
+            }
+        }
+
+        foreach (var instr in body.Take(body.Count - 1))
+            result.Add(Clone(instr, e => Substitute(e, map)));
+
+        if (ret.Value != null && call.ResultVar != null)
+        {
+            result.Add(new IRAssign
+            {
+                Target = call.ResultVar,
+                Value = $"({callee.ReturnTypeCpp})({Substitute(ret.Value, map)})",
+            });
+        }
+
+        foreach (var instr in result)
+            instr.DebugInfo = call.DebugInfo;
+        return result;
+    }
+
+    private static string Substitute(string expr, Dictionary<string, string> map) =>
+        IdentifierRegex.Replace(expr, m => map.TryGetValue(m.Value, out var r) ? r : m.Value);
+
+    private static IRInstruction Clone(IRInstruction instr, Func<string, string> s) => instr switch
+    {
+        IRFieldAccess f => new IRFieldAccess
+        {
+            ObjectExpr = s(f.ObjectExpr), FieldCppName = f.FieldCppName, ResultVar = s(f.ResultVar),
+            IsStore = f.IsStore, StoreValue = f.StoreValue != null ? s(f.StoreValue) : null,
+            IsValueAccess = f.IsValueAccess,
+        },
+        IRStaticFieldAccess f => new IRStaticFieldAccess
+        {
+            TypeCppName = f.TypeCppName, FieldCppName = f.FieldCppName, ResultVar = s(f.ResultVar),
+            IsStore = f.IsStore, StoreValue = f.StoreValue != null ? s(f.StoreValue) : null,
+            IsThreadStatic = f.IsThreadStatic,
+        },
+        IRAssign a => new IRAssign { Target = s(a.Target), Value = s(a.Value) },
+        IRBinaryOp b => new IRBinaryOp { Left = s(b.Left), Right = s(b.Right), Op = b.Op, ResultVar = s(b.ResultVar) },
+        IRUnaryOp u => new IRUnaryOp { Operand = s(u.Operand), Op = u.Op, ResultVar = s(u.ResultVar) },
+        IRConversion c => new IRConversion { SourceExpr = s(c.SourceExpr), TargetType = c.TargetType, ResultVar = s(c.ResultVar) },
+        IRCast c => new IRCast { SourceExpr = s(c.SourceExpr), TargetTypeCpp = c.TargetTypeCpp, ResultVar = s(c.ResultVar), IsSafe = c.IsSafe },
+        IRNullCheck n => new IRNullCheck { Expr = s(n.Expr) },
+        IRStaticCtorGuard g => new IRStaticCtorGuard { TypeCppName = g.TypeCppName },
+        IRDeclareLocal d => new IRDeclareLocal
+        {
+            TypeName = d.TypeName, VarName = s(d.VarName), InitValue = d.InitValue != null ? s(d.InitValue) : null,
+        },
+        IRRawCpp r => new IRRawCpp { Code = s(r.Code) },
+        IRCall c => CloneCall(c, s),
+        _ => throw new InvalidOperationException($"Cannot inline {instr.GetType().Name}"),
+    };
+
+    private static IRCall CloneCall(IRCall c, Func<string, string> s)
+    {
+        var call = new IRCall
+        {
+            FunctionName = c.FunctionName,
+            ResultVar = c.ResultVar != null ? s(c.ResultVar) : null,
+            IsVirtual = c.IsVirtual,
+            VTableSlot = c.VTableSlot,
+            VTableReturnType = c.VTableReturnType,
+            VTableParamTypes = c.VTableParamTypes,
+            IsInterfaceCall = c.IsInterfaceCall,
+            InterfaceTypeCppName = c.InterfaceTypeCppName,
+        };
+        call.Arguments.AddRange(c.Arguments.Select(s));
+        return call;
+    }
+
+    private static int NextTempIndex(IRMethod method)
+    {
+        int max = -1;
+        foreach (var instr in method.BasicBlocks.SelectMany(b => b.Instructions))
+        {
+            foreach (Match m in TempRegex.Matches(instr.ToCpp()))
+                max = Math.Max(max, int.Parse(m.Groups[1].Value));
+        }
+        return max + 1;
+    }
+
+    /// <summary>
+    /// Drop cctor guards already executed on every path to them: an identical
+    /// guard earlier in the same label-free stretch of code.
+    /// </summary>
+    private static void RemoveRepeatedCctorGuards(IRMethod method)
+    {
+        var seen = new HashSet<string>();
+        foreach (var block in method.BasicBlocks)
+        {
+            seen.Clear();
+            block.Instructions.RemoveAll(instr =>
+            {
+                if (instr is IRLabel or IRTryBegin or IRCatchBegin or IRFinallyBegin or IRTryEnd
+                    or IRFilterBegin or IREndFilter)
+                {
+                    seen.Clear();
+                    return false;
+                }
+                return instr is IRStaticCtorGuard guard && !seen.Add(guard.TypeCppName);
+            });
+        }
+    }
+}
@@ -0,0 +1,182 @@
+using Xunit;
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Tests;
+
+public class BoundsCheckEliminationTests
+{
+    private static IRMethod MakeMethod(params IRInstruction[] instructions)
+    {
+        var method = new IRMethod { Name = "M", CppName = "Test_M", IsStatic = true, ReturnTypeCpp = "void" };
+        var block = new IRBasicBlock { Id = 0 };
+        block.Instructions.AddRange(instructions);
+        method.BasicBlocks.Add(block);
+        return method;
+    }
+
+    private static IRArrayAccess Load(string arr, string index, string result) =>
+        new() { ArrayExpr = arr, IndexExpr = index, ElementType = "int32_t", ResultVar = result };
+
+    /// <summary>
+    /// for (loc_1 = 0; loc_1 &lt; loc_0.Length; loc_1++) { body } as the IR builder emits it (Release).
+    /// </summary>
+    private static List<IRInstruction> CountedLoop(params IRInstruction[] body)
+    {
+        var list = new List<IRInstruction>
+        {
+            new IRAssign { Target = "loc_1", Value = "0" },
+            new IRBranch { TargetLabel = "IL_0020" },
+            new IRLabel { LabelName = "IL_0008" },
+        };
+        list.AddRange(body);
+        list.AddRange(new IRInstruction[]
+        {
+            new IRBinaryOp { Left = "loc_1", Right = "1", Op = "+", ResultVar = "__t5" },
+            new IRAssign { Target = "loc_1", Value = "__t5" },
+            new IRLabel { LabelName = "IL_0020" },
+            new IRRawCpp { Code = "auto __t6 = cil2cpp::array_length(loc_0);" },
+            new IRConversion { SourceExpr = "__t6", TargetType = "int32_t", ResultVar = "__t7" },
+            new IRConditionalBranch { Condition = "loc_1 < __t7", TrueLabel = "IL_0008" },
+        });
+        return list;
+    }
+
+    [Fact]
+    public void CountedLoop_IndexByInductionVariable_Elided()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        var method = MakeMethod(CountedLoop(access).ToArray());
+
+        Assert.Equal(1, BoundsCheckElimination.Run(method));
+        Assert.True(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_DebugFlagCondition_Elided()
+    {
+        // Debug IL: clt; stloc flag; ldloc flag; brtrue BODY
+        var access = Load("loc_0", "loc_1", "__t3");
+        var instrs = CountedLoop(access);
+        instrs[^1] = new IRBinaryOp { Left = "loc_1", Right = "__t7", Op = "<", ResultVar = "__t8" };
+        instrs.Add(new IRAssign { Target = "loc_2", Value = "__t8" });
+        instrs.Add(new IRConditionalBranch { Condition = "loc_2", TrueLabel = "IL_0008" });
+
+        BoundsCheckElimination.Run(MakeMethod(instrs.ToArray()));
+        Assert.True(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_ElementAddress_Elided()
+    {
+        var addr = new IRArrayElementAddress
+        {
+            ArrayExpr = "loc_0", IndexExpr = "loc_1", ElementType = "Point", ResultVar = "__t3"
+        };
+        BoundsCheckElimination.Run(MakeMethod(CountedLoop(addr).ToArray()));
+        Assert.True(addr.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_OtherArrayOrIndex_Kept()
+    {
+        var otherArray = Load("loc_2", "loc_1", "__t3");
+        var otherIndex = Load("loc_0", "__t2", "__t4");
+        BoundsCheckElimination.Run(MakeMethod(CountedLoop(
+            new IRBinaryOp { Left = "loc_1", Right = "1", Op = "+", ResultVar = "__t2" },
+            otherArray, otherIndex).ToArray()));
+
+        Assert.False(otherArray.BoundsCheckElided);
+        Assert.False(otherIndex.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_ExtraWriteToIndex_Kept()
+    {
+        // a[i++] inside the body: i may reach Length before the access
+        var access = Load("loc_0", "loc_1", "__t3");
+        BoundsCheckElimination.Run(MakeMethod(CountedLoop(
+            new IRAssign { Target = "loc_1", Value = "loc_4" }, access).ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_ArrayReassignedInBody_Kept()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        BoundsCheckElimination.Run(MakeMethod(CountedLoop(
+            access, new IRAssign { Target = "loc_0", Value = "loc_5" }).ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_IndexAddressTaken_Kept()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        var instrs = CountedLoop(access);
+        instrs.Insert(0, new IRRawCpp { Code = "Helper_Bump(&loc_1);" });
+        BoundsCheckElimination.Run(MakeMethod(instrs.ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_NegativeOrUnknownStart_Kept()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        var instrs = CountedLoop(access);
+        instrs[0] = new IRAssign { Target = "loc_1", Value = "-1" };
+        BoundsCheckElimination.Run(MakeMethod(instrs.ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_JumpIntoBodyFromOutside_Kept()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        var instrs = CountedLoop(access);
+        instrs.Add(new IRBranch { TargetLabel = "IL_0008" });
+        BoundsCheckElimination.Run(MakeMethod(instrs.ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void CountedLoop_AccessAfterIncrement_Kept()
+    {
+        var access = Load("loc_0", "loc_1", "__t3");
+        var instrs = CountedLoop();
+        instrs.Insert(instrs.FindIndex(i => i is IRAssign { Target: "loc_1", Value: "__t5" }) + 1, access);
+        BoundsCheckElimination.Run(MakeMethod(instrs.ToArray()));
+        Assert.False(access.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void FreshArray_ConstantIndexInRange_Elided()
+    {
+        var inRange = new IRArrayAccess
+        {
+            ArrayExpr = "__t0", IndexExpr = "2", ElementType = "int32_t", IsStore = true, StoreValue = "7"
+        };
+        var outOfRange = new IRArrayAccess
+        {
+            ArrayExpr = "__t0", IndexExpr = "3", ElementType = "int32_t", IsStore = true, StoreValue = "7"
+        };
+        var method = MakeMethod(
+            new IRRawCpp { Code = "auto __t0 = cil2cpp::array_create(&System_Int32_TypeInfo, 3);" },
+            inRange, outOfRange);
+
+        Assert.Equal(1, BoundsCheckElimination.Run(method));
+        Assert.True(inRange.BoundsCheckElided);
+        Assert.False(outOfRange.BoundsCheckElided);
+    }
+
+    [Fact]
+    public void FreshArray_TempReassigned_Kept()
+    {
+        var access = Load("__t0", "0", "__t1");
+        var method = MakeMethod(
+            new IRRawCpp { Code = "auto __t0 = cil2cpp::array_create(&System_Int32_TypeInfo, 3);" },
+            new IRAssign { Target = "__t0", Value = "loc_0" },
+            access);
+
+        Assert.Equal(0, BoundsCheckElimination.Run(method));
+    }
+}
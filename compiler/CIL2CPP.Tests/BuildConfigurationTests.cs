@@ -29,6 +29,34 @@ public class BuildConfigurationTests
         Assert.False(config.ReadDebugSymbols);
     }
 
+    [Fact]
+    public void EscapeAnalysis_EnabledInReleaseOnly()
+    {
+        Assert.False(BuildConfiguration.Debug.EnableEscapeAnalysis);
+        Assert.True(BuildConfiguration.Release.EnableEscapeAnalysis);
+    }
+
+    [Fact]
+    public void Inlining_EnabledInReleaseOnly()
+    {
+        Assert.False(BuildConfiguration.Debug.EnableInlining);
+        Assert.True(BuildConfiguration.Release.EnableInlining);
+    }
+
+    [Fact]
+    public void TranslationUnits_DefaultsToAutomatic()
+    {
+        Assert.Equal(0, BuildConfiguration.Debug.TranslationUnits);
+        Assert.Equal(0, BuildConfiguration.Release.TranslationUnits);
+    }
+
+    [Fact]
+    public void PoolAsyncStateMachines_OffByDefault()
+    {
+        Assert.False(BuildConfiguration.Debug.PoolAsyncStateMachines);
+        Assert.False(BuildConfiguration.Release.PoolAsyncStateMachines);
+    }
+
     [Fact]
     public void ConfigurationName_Debug_ReturnsDebug()
     {
@@ -83,4 +111,61 @@ public class BuildConfigurationTests
     {
         Assert.NotEqual(BuildConfiguration.Debug, BuildConfiguration.Release);
     }
+
+    [Fact]
+    public void GCSettings_DefaultIsEmpty()
+    {
+        Assert.True(BuildConfiguration.Release.GC.IsDefault);
+        Assert.True(GCSettings.Parse(Array.Empty<string>()).IsDefault);
+    }
+
+    [Fact]
+    public void GCSettings_Parse_AllKeys()
+    {
+        var gc = GCSettings.Parse(new[]
+        {
+            "initial-heap=64M", "max-heap=2g", "free-space-divisor=5", "markers=2",
+            "incremental=false", "full-frequency=0",
+        });
+        Assert.Equal(64UL << 20, gc.InitialHeapSize);
+        Assert.Equal(2UL << 30, gc.MaxHeapSize);
+        Assert.Equal(5u, gc.FreeSpaceDivisor);
+        Assert.Equal(2, gc.ParallelMarkers);
+        Assert.False(gc.Incremental);
+        Assert.Equal(0, gc.FullCollectionFrequency);
+        Assert.False(gc.IsDefault);
+    }
+
+    [Theory]
+    [InlineData("4096", 4096UL)]
+    [InlineData("16k", 16UL << 10)]
+    [InlineData("512MB", 512UL << 20)]
+    [InlineData("17179869183G", 17179869183UL << 30)]
+    [InlineData("18446744073709551615", ulong.MaxValue)]
+    public void GCSettings_Parse_SizeSuffixes(string value, ulong expected)
+    {
+        Assert.Equal(expected, GCSettings.Parse(new[] { $"max-heap={value}" }).MaxHeapSize);
+    }
+
+    [Theory]
+    [InlineData("max-heap")]
+    [InlineData("max-heap=lots")]
+    [InlineData("markers=0")]
+    [InlineData("incremental=maybe")]
+    [InlineData("heap-size=1M")]
+    [InlineData("max-heap=64MBB")]
+    [InlineData("max-heap=17179869184G")]
+    [InlineData("initial-heap=18446744073709551615k")]
+    public void GCSettings_Parse_Invalid_ThrowsArgumentException(string setting)
+    {
+        Assert.Throws<ArgumentException>(() => GCSettings.Parse(new[] { setting }));
+    }
+
+    [Fact]
+    public void GCSettings_PartOfRecordEquality()
+    {
+        var tuned = BuildConfiguration.Release with { GC = new GCSettings { MaxHeapSize = 1 << 20 } };
+        Assert.NotEqual(BuildConfiguration.Release, tuned);
+        Assert.NotEqual(BuildConfiguration.Release.ToString(), tuned.ToString());
+    }
 }
@@ -0,0 +1,246 @@
+using Xunit;
+using CIL2CPP.Core;
+using CIL2CPP.Core.CodeGen;
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Tests;
+
+public class CodeGenCacheTests
+{
+    /// <summary>
+    /// static class Program { static int M0() .. M{count-1}() { return N; } static void Main() }
+    /// </summary>
+    private static IRModule CreateModule(int methodCount = 4)
+    {
+        var module = new IRModule { Name = "TestApp" };
+        var type = new IRType { ILFullName = "Program", CppName = "Program", Name = "Program", Namespace = "" };
+        for (int i = 0; i < methodCount; i++)
+            AddMethod(type, $"M{i}", new IRReturn { Value = i.ToString() });
+        var main = AddMethod(type, "Main", new IRReturn());
+        main.ReturnTypeCpp = "void";
+        main.IsEntryPoint = true;
+        module.EntryPoint = main;
+        module.Types.Add(type);
+        return module;
+    }
+
+    private static IRMethod AddMethod(IRType type, string name, params IRInstruction[] instructions)
+    {
+        var method = new IRMethod
+        {
+            Name = name, CppName = $"{type.CppName}_{name}", DeclaringType = type,
+            IsStatic = true, ReturnTypeCpp = "int32_t"
+        };
+        var bb = new IRBasicBlock { Id = 0 };
+        bb.Instructions.AddRange(instructions);
+        method.BasicBlocks.Add(bb);
+        type.Methods.Add(method);
+        return method;
+    }
+
+    private static IRMethod Method(IRModule module, string name) =>
+        module.GetAllMethods().Single(m => m.Name == name);
+
+    private static string MakeTempDir() =>
+        Path.Combine(Path.GetTempPath(), "cil2cpp_test_" + Guid.NewGuid().ToString("N")[..8]);
+
+    [Fact]
+    public void Generate_UnchangedModule_ReusesEveryMethodBody()
+    {
+        var cache = new CodeGenCache();
+        var first = new CppCodeGenerator(CreateModule(), cache: cache).Generate();
+        Assert.Equal(0, cache.MethodHits);
+        Assert.Equal(5, cache.MethodMisses);
+
+        cache.MethodHits = cache.MethodMisses = 0;
+        var second = new CppCodeGenerator(CreateModule(), cache: cache).Generate();
+        Assert.Equal(5, cache.MethodHits);
+        Assert.Equal(0, cache.MethodMisses);
+        Assert.Equal(first.SourceFile.Content, second.SourceFile.Content);
+    }
+
+    [Fact]
+    public void Generate_ChangedMethod_RegeneratedAlone()
+    {
+        var cache = new CodeGenCache();
+        new CppCodeGenerator(CreateModule(), cache: cache).Generate();
+
+        var module = CreateModule();
+        var m2 = Method(module, "M2");
+        m2.BasicBlocks[0].Instructions[0] = new IRReturn { Value = "42" };
+        cache.MethodHits = cache.MethodMisses = 0;
+        var output = new CppCodeGenerator(module, cache: cache).Generate();
+
+        Assert.Equal(4, cache.MethodHits);
+        Assert.Equal(1, cache.MethodMisses);
+        Assert.Contains("return 42;", output.SourceFile.Content);
+    }
+
+    [Fact]
+    public void Generate_ChangedConfiguration_RegeneratesBodies()
+    {
+        var cache = new CodeGenCache();
+        new CppCodeGenerator(CreateModule(), BuildConfiguration.Release, cache).Generate();
+
+        cache.MethodHits = cache.MethodMisses = 0;
+        new CppCodeGenerator(CreateModule(), BuildConfiguration.Debug, cache).Generate();
+        Assert.Equal(0, cache.MethodHits);
+    }
+
+    [Fact]
+    public void Generate_RemovedMethod_DroppedFromCache()
+    {
+        var cache = new CodeGenCache();
+        new CppCodeGenerator(CreateModule(4), cache: cache).Generate();
+        new CppCodeGenerator(CreateModule(2), cache: cache).Generate();
+
+        Assert.Equal(3, cache.Methods.Count);
+        Assert.DoesNotContain(cache.Methods.Keys, k => k.Contains("Program_M3"));
+    }
+
+    [Fact]
+    public void Generate_GrownMethod_KeepsTranslationUnitBoundaries()
+    {
+        var config = BuildConfiguration.Release with { TranslationUnits = 3 };
+        var cache = new CodeGenCache();
+        var first = new CppCodeGenerator(CreateModule(8), config, cache).Generate();
+
+        // Growing M0 moves the boundaries of a fresh split...
+        static IRModule Grown()
+        {
+            var module = CreateModule(8);
+            Method(module, "M0").BasicBlocks[0].Instructions.InsertRange(0, Enumerable.Range(0, 6)
+                .Select(i => (IRInstruction)new IRBinaryOp { Left = "1", Right = "2", Op = "+", ResultVar = $"__t{i}" }));
+            return module;
+        }
+        var fresh = new CppCodeGenerator(Grown(), config).Generate();
+        Assert.NotEqual(first.MethodSourceFiles[1].Content, fresh.MethodSourceFiles[1].Content);
+
+        // ...but with the cache only the file holding M0 changes
+        var second = new CppCodeGenerator(Grown(), config, cache).Generate();
+        Assert.Equal(3, second.MethodSourceFiles.Count);
+        Assert.NotEqual(first.MethodSourceFiles[0].Content, second.MethodSourceFiles[0].Content);
+        Assert.Equal(first.MethodSourceFiles[1].Content, second.MethodSourceFiles[1].Content);
+        Assert.Equal(first.MethodSourceFiles[2].Content, second.MethodSourceFiles[2].Content);
+    }
+
+    [Fact]
+    public void WriteToDirectory_UnchangedFiles_NotRewritten()
+    {
+        var output = new CppCodeGenerator(CreateModule()).Generate();
+        var tempDir = MakeTempDir();
+        try
+        {
+            Assert.Equal(4, output.WriteToDirectory(tempDir));
+            var header = Path.Combine(tempDir, "TestApp.h");
+            var stamp = new DateTime(2000, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            File.SetLastWriteTimeUtc(header, stamp);
+
+            output.SourceFile.Content += "// changed\n";
+            Assert.Equal(1, output.WriteToDirectory(tempDir));
+            Assert.Equal(stamp, File.GetLastWriteTimeUtc(header));
+        }
+        finally
+        {
+            if (Directory.Exists(tempDir))
+                Directory.Delete(tempDir, true);
+        }
+    }
+
+    [Fact]
+    public void SaveLoad_RoundTripsAndDetectsUpToDateOutput()
+    {
+        var tempDir = MakeTempDir();
+        try
+        {
+            var cache = new CodeGenCache();
+            var output = new CppCodeGenerator(CreateModule(), cache: cache).Generate();
+            output.WriteToDirectory(tempDir);
+            cache.Update("inputs-1", output, tempDir);
+            cache.Save(tempDir);
+
+            var loaded = CodeGenCache.Load(tempDir);
+            Assert.Equal(5, loaded.Methods.Count);
+            Assert.True(loaded.IsUpToDate("inputs-1", tempDir));
+            Assert.False(loaded.IsUpToDate("inputs-2", tempDir));
+
+            // A hand-edited output file forces regeneration
+            File.AppendAllText(Path.Combine(tempDir, "TestApp.cpp"), "// edit\n");
+            Assert.False(loaded.IsUpToDate("inputs-1", tempDir));
+        }
+        finally
+        {
+            if (Directory.Exists(tempDir))
+                Directory.Delete(tempDir, true);
+        }
+    }
+
+    [Fact]
+    public void Update_DeletesFilesNoLongerGenerated()
+    {
+        var tempDir = MakeTempDir();
+        try
+        {
+            var cache = new CodeGenCache();
+            var split = new CppCodeGenerator(CreateModule(),
+                BuildConfiguration.Release with { TranslationUnits = 2 }, cache).Generate();
+            split.WriteToDirectory(tempDir);
+            cache.Update("a", split, tempDir);
+            Assert.True(File.Exists(Path.Combine(tempDir, "TestApp_methods_1.cpp")));
+
+            var single = new CppCodeGenerator(CreateModule(), BuildConfiguration.Release, cache).Generate();
+            single.WriteToDirectory(tempDir);
+            cache.Update("b", single, tempDir);
+            Assert.False(File.Exists(Path.Combine(tempDir, "TestApp_methods_1.cpp")));
+            Assert.False(File.Exists(Path.Combine(tempDir, "TestApp_internal.h")));
+            Assert.True(File.Exists(Path.Combine(tempDir, "TestApp.cpp")));
+        }
+        finally
+        {
+            if (Directory.Exists(tempDir))
+                Directory.Delete(tempDir, true);
+        }
+    }
+
+    [Fact]
+    public void Load_CorruptFile_ReturnsEmptyCache()
+    {
+        var tempDir = MakeTempDir();
+        Directory.CreateDirectory(tempDir);
+        try
+        {
+            File.WriteAllText(Path.Combine(tempDir, CodeGenCache.FileName), "{ not json");
+            var cache = CodeGenCache.Load(tempDir);
+            Assert.Empty(cache.Methods);
+            Assert.False(cache.IsUpToDate("", tempDir));
+        }
+        finally
+        {
+            Directory.Delete(tempDir, true);
+        }
+    }
+
+    [Fact]
+    public void FingerprintInputs_ChangesWithAssemblyAndConfiguration()
+    {
+        var tempDir = MakeTempDir();
+        Directory.CreateDirectory(tempDir);
+        try
+        {
+            var dll = Path.Combine(tempDir, "App.dll");
+            File.WriteAllBytes(dll, new byte[] { 1, 2, 3 });
+            var release = CodeGenCache.FingerprintInputs(dll, BuildConfiguration.Release, "single-assembly");
+
+            Assert.Equal(release, CodeGenCache.FingerprintInputs(dll, BuildConfiguration.Release, "single-assembly"));
+            Assert.NotEqual(release, CodeGenCache.FingerprintInputs(dll, BuildConfiguration.Debug, "single-assembly"));
+            Assert.NotEqual(release, CodeGenCache.FingerprintInputs(dll, BuildConfiguration.Release, "multi-assembly"));
+
+            File.WriteAllBytes(Path.Combine(tempDir, "Lib.dll"), new byte[] { 4 });
+            Assert.NotEqual(release, CodeGenCache.FingerprintInputs(dll, BuildConfiguration.Release, "single-assembly"));
+        }
+        finally
+        {
+            Directory.Delete(tempDir, true);
+        }
+    }
+}
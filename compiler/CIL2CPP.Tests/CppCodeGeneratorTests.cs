@@ -209,6 +209,84 @@ public class CppCodeGeneratorTests
         Assert.Contains("Calculator_Statics Calculator_statics = {};", output.SourceFile.Content);
     }
 
+    [Fact]
+    public void Generate_ThreadStaticField_ThreadLocalBlockRegisteredStatically()
+    {
+        var module = CreateSimpleModule();
+        module.Types[0].StaticFields.Add(new IRField
+        {
+            Name = "PerThread",
+            CppName = "f_PerThread",
+            FieldTypeName = "System.Int32",
+            IsStatic = true,
+            IsThreadStatic = true,
+        });
+        var output = new CppCodeGenerator(module).Generate();
+
+        // Plain statics keep their block; the [ThreadStatic] field moves to a thread_local one
+        Assert.Contains("struct Calculator_ThreadStatics {", output.HeaderFile.Content);
+        Assert.Contains("extern thread_local constinit Calculator_ThreadStatics Calculator_thread_statics;",
+            output.HeaderFile.Content);
+        var statics = output.HeaderFile.Content[output.HeaderFile.Content.IndexOf("struct Calculator_Statics {")..];
+        Assert.DoesNotContain("f_PerThread", statics[..statics.IndexOf("};")]);
+        Assert.Contains("thread_local constinit Calculator_ThreadStatics Calculator_thread_statics = {};",
+            output.SourceFile.Content);
+        // Registered from a static initializer, so library outputs without main() root it too
+        Assert.Contains("static const bool __thread_statics_rooted = (", output.SourceFile.Content);
+        Assert.Contains("cil2cpp::gc::register_thread_static_block(", output.SourceFile.Content);
+        Assert.DoesNotContain("__init_thread_statics", output.MainFile!.Content);
+    }
+
+    [Fact]
+    public void Generate_Main_DefaultGCSettings_PlainRuntimeInit()
+    {
+        var output = new CppCodeGenerator(CreateSimpleModule(), BuildConfiguration.Release).Generate();
+        Assert.Contains("cil2cpp::runtime_init();", output.MainFile!.Content);
+        Assert.DoesNotContain("gc_config", output.MainFile.Content);
+    }
+
+    [Fact]
+    public void Generate_Main_GCSettings_PassedToRuntimeInit()
+    {
+        var config = BuildConfiguration.Release with
+        {
+            GC = GCSettings.Parse(new[] { "max-heap=512M", "markers=2", "incremental=false" })
+        };
+        var main = new CppCodeGenerator(CreateSimpleModule(), config).Generate().MainFile!.Content;
+
+        Assert.Contains("cil2cpp::gc::GCConfig gc_config;", main);
+        Assert.Contains($"gc_config.max_heap_size = {512UL << 20}ull;", main);
+        Assert.Contains("gc_config.parallel_markers = 2;", main);
+        Assert.Contains("gc_config.incremental = false;", main);
+        Assert.DoesNotContain("gc_config.initial_heap_size", main);
+        Assert.Contains("cil2cpp::runtime_init(gc_config);", main);
+    }
+
+    [Fact]
+    public void Generate_Main_EveryGCOption_EmittedAsGCConfigFields()
+    {
+        // The values of repeated --gc options, as the CLI passes them on
+        var options = new[]
+        {
+            "initial-heap=64M", "max-heap=2GB", "free-space-divisor=6", "markers=4",
+            "incremental=on", "full-frequency=8",
+        };
+        var config = BuildConfiguration.FromName("Debug") with { GC = GCSettings.Parse(options) };
+        var main = new CppCodeGenerator(CreateSimpleModule(), config).Generate().MainFile!.Content;
+
+        var fields = main.Split('\n').Select(l => l.Trim()).Where(l => l.StartsWith("gc_config.")).ToList();
+        Assert.Equal(new[]
+        {
+            $"gc_config.initial_heap_size = {64UL << 20}ull;",
+            $"gc_config.max_heap_size = {2UL << 30}ull;",
+            "gc_config.free_space_divisor = 6u;",
+            "gc_config.parallel_markers = 4;",
+            "gc_config.incremental = true;",
+            "gc_config.full_collection_frequency = 8;",
+        }, fields);
+        Assert.True(main.IndexOf("cil2cpp::gc::GCConfig gc_config;") < main.IndexOf("cil2cpp::runtime_init(gc_config);"));
+    }
+
     [Fact]
     public void Generate_Source_FileName()
     {
@@ -841,6 +919,53 @@ public class CppCodeGeneratorTests
         Assert.Contains("_finalizer_wrapper", output.SourceFile.Content);
     }
 
+    [Fact]
+    public void Generate_ValueTypeWithEquatableOverrides_EmitsUnboxedThunks()
+    {
+        var module = new IRModule { Name = "Test" };
+        var type = new IRType { ILFullName = "Key", CppName = "Key", Name = "Key", Namespace = "", IsValueType = true };
+        IRMethod Method(string name, string cppName, string returnType, params IRParameter[] parameters)
+        {
+            var m = new IRMethod
+            {
+                Name = name, CppName = cppName, DeclaringType = type,
+                IsVirtual = true, ReturnTypeCpp = returnType
+            };
+            m.Parameters.AddRange(parameters);
+            var bb = new IRBasicBlock { Id = 0 };
+            bb.Instructions.Add(new IRReturn { Value = "0" });
+            m.BasicBlocks.Add(bb);
+            return m;
+        }
+        type.Methods.Add(Method("Equals", "Key_Equals__obj", "bool",
+            new IRParameter { Name = "obj", CppName = "obj", CppTypeName = "cil2cpp::Object*", ILTypeName = "System.Object" }));
+        type.Methods.Add(Method("Equals", "Key_Equals", "bool",
+            new IRParameter { Name = "other", CppName = "other", CppTypeName = "Key", ILTypeName = "Key" }));
+        type.Methods.Add(Method("GetHashCode", "Key_GetHashCode", "int32_t"));
+        module.Types.Add(type);
+
+        var source = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        // Equals(Key) wins over Equals(object): the argument is passed by value, not boxed
+        Assert.Contains("return Key_Equals((Key*)a, *static_cast<const Key*>(b));", source);
+        Assert.Contains("return Key_GetHashCode((Key*)value);", source);
+        Assert.Contains(".value_equals = Key__value_equals,", source);
+        Assert.Contains(".value_hash = Key__value_hash,", source);
+    }
+
+    [Fact]
+    public void Generate_ValueTypeWithoutOverrides_KeepsBitwiseEquality()
+    {
+        var module = new IRModule { Name = "Test" };
+        module.Types.Add(new IRType { ILFullName = "Plain", CppName = "Plain", Name = "Plain", Namespace = "", IsValueType = true });
+
+        var source = new CppCodeGenerator(module).Generate().SourceFile.Content;
+
+        Assert.DoesNotContain("Plain__value_equals", source);
+        Assert.Contains(".value_equals = nullptr,", source);
+        Assert.Contains(".element_size = sizeof(Plain),", source);
+    }
+
     [Fact]
     public void Generate_EnumType_EmitsTypedefAndConstants()
     {
@@ -1383,4 +1508,92 @@ public class CppCodeGeneratorTests
         Assert.Contains("MyResource_Finalize", output.SourceFile.Content);
         Assert.Contains("finalizer", output.SourceFile.Content);
     }
+
+    // ===== Translation Units =====
+
+    [Fact]
+    public void Generate_SmallModule_SingleTranslationUnit()
+    {
+        var module = CreateSimpleModule();
+        var gen = new CppCodeGenerator(module);
+        var output = gen.Generate();
+
+        Assert.Empty(output.MethodSourceFiles);
+        Assert.Null(output.InternalHeaderFile);
+        Assert.Contains("Calculator_Add", output.SourceFile.Content);
+        Assert.DoesNotContain("target_precompile_headers", output.CMakeFile!.Content);
+    }
+
+    [Fact]
+    public void Generate_TranslationUnits_SplitsMethodsAndTypeData()
+    {
+        var module = CreateSimpleModule();
+        var literal = module.RegisterStringLiteral("Hello");
+        var type = module.Types[0];
+        foreach (var name in new[] { "Sub", "Mul" })
+        {
+            var method = new IRMethod { Name = name, CppName = $"Calculator_{name}", DeclaringType = type, IsStatic = true, ReturnTypeCpp = "cil2cpp::String*" };
+            var bb = new IRBasicBlock { Id = 0 };
+            bb.Instructions.Add(new IRReturn { Value = name == "Mul" ? literal : "nullptr" });
+            method.BasicBlocks.Add(bb);
+            type.Methods.Add(method);
+        }
+        var config = BuildConfiguration.Release with { TranslationUnits = 3 };
+        var output = new CppCodeGenerator(module, config).Generate();
+
+        Assert.Equal(new[] { "TestApp_methods_0.cpp", "TestApp_methods_1.cpp", "TestApp_methods_2.cpp" },
+            output.MethodSourceFiles.Select(f => f.FileName));
+        Assert.Equal("TestApp_internal.h", output.InternalHeaderFile!.FileName);
+        Assert.Contains("cil2cpp::String* __str_0 = nullptr;", output.SourceFile.Content);
+        Assert.DoesNotContain("static cil2cpp::String* __str_0", output.SourceFile.Content);
+
+        // Literals are declared only where they are used
+        Assert.DoesNotContain("__str_0", output.InternalHeaderFile.Content);
+        var user = output.MethodSourceFiles.Single(f => f.Content.Contains("Calculator_Mul("));
+        Assert.Contains("extern cil2cpp::String* __str_0;", user.Content);
+        Assert.Single(output.MethodSourceFiles, f => f.Content.Contains("__str_0"));
+
+        // Methods leave the data TU; Calculator's TypeInfo goes with its first method
+        Assert.DoesNotContain("Calculator_Add(", output.SourceFile.Content);
+        Assert.DoesNotContain("cil2cpp::TypeInfo Calculator_TypeInfo", output.SourceFile.Content);
+        Assert.Contains("cil2cpp::TypeInfo Calculator_TypeInfo", output.MethodSourceFiles[0].Content);
+        Assert.Contains("Program_Main()", output.MethodSourceFiles[2].Content);
+        Assert.All(output.MethodSourceFiles, f => Assert.Contains("#include \"TestApp_internal.h\"", f.Content));
+    }
+
+    [Fact]
+    public void Generate_TranslationUnits_CMakeListsFilesWithPrecompiledHeader()
+    {
+        var module = CreateSimpleModule();
+        var config = BuildConfiguration.Release with { TranslationUnits = 2 };
+        var output = new CppCodeGenerator(module, config).Generate();
+
+        var cmake = output.CMakeFile!.Content;
+        Assert.Contains("TestApp_methods_0.cpp", cmake);
+        Assert.Contains("TestApp_methods_1.cpp", cmake);
+        Assert.Contains("target_precompile_headers(TestApp PRIVATE", cmake);
+        Assert.Contains("<cil2cpp/cil2cpp.h>", cmake);
+        Assert.Contains("option(CIL2CPP_PRECOMPILED_HEADER", cmake);
+    }
+
+    [Fact]
+    public void Generate_TranslationUnits_CappedAtMethodCount()
+    {
+        var module = CreateSimpleModule();
+        var config = BuildConfiguration.Release with { TranslationUnits = 16 };
+        var output = new CppCodeGenerator(module, config).Generate();
+
+        Assert.Equal(2, output.MethodSourceFiles.Count);
+    }
+
+    [Fact]
+    public void PartitionBySize_BalancesContiguousRuns()
+    {
+        var sizes = new List<int> { 10, 10, 10, 10, 40, 5, 5, 5, 5 };
+        var parts = CppCodeGenerator.PartitionBySize(sizes, s => s, 3);
+
+        Assert.Equal(3, parts.Count);
+        Assert.Equal(sizes, parts.SelectMany(p => p));
+        Assert.Equal(new[] { 40, 40, 20 }, parts.Select(p => p.Sum()));
+    }
 }
@@ -0,0 +1,189 @@
+using Xunit;
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Tests;
+
+public class EscapeAnalysisTests
+{
+    /// <summary>
+    /// class Point { int X; Point(int x) { X = x; } } plus a static Program type
+    /// holding the method under test.
+    /// </summary>
+    private static (IRModule Module, IRType Point, IRType Program) MakeModule()
+    {
+        var module = new IRModule { Name = "Test" };
+        var point = new IRType { ILFullName = "Point", CppName = "Point", InstanceSize = 16 };
+        var ctor = new IRMethod { Name = ".ctor", CppName = "Point__ctor", DeclaringType = point, IsConstructor = true };
+        ctor.Parameters.Add(new IRParameter { Name = "x", CppName = "x", CppTypeName = "int32_t" });
+        AddBody(ctor,
+            new IRCall { FunctionName = "System_Object__ctor", Arguments = { "__this" } },
+            new IRFieldAccess { ObjectExpr = "__this", FieldCppName = "f_X", IsStore = true, StoreValue = "x" },
+            new IRReturn());
+        point.Methods.Add(ctor);
+
+        var program = new IRType { ILFullName = "Program", CppName = "Program" };
+        module.Types.Add(point);
+        module.Types.Add(program);
+        return (module, point, program);
+    }
+
+    private static void AddBody(IRMethod method, params IRInstruction[] instructions)
+    {
+        var block = new IRBasicBlock { Id = 0 };
+        block.Instructions.AddRange(instructions);
+        method.BasicBlocks.Add(block);
+    }
+
+    private static IRMethod AddMethod(IRType type, string name, params IRInstruction[] instructions)
+    {
+        var method = new IRMethod { Name = name, CppName = $"{type.CppName}_{name}", DeclaringType = type, IsStatic = true };
+        AddBody(method, instructions);
+        type.Methods.Add(method);
+        return method;
+    }
+
+    private static IRNewObj NewPoint(string result) =>
+        new() { TypeCppName = "Point", CtorName = "Point__ctor", ResultVar = result, CtorArgs = { "1" } };
+
+    [Fact]
+    public void FieldReadsOnly_MovedToStack()
+    {
+        var (module, _, program) = MakeModule();
+        var newObj = NewPoint("__t0");
+        var method = AddMethod(program, "M",
+            newObj,
+            new IRAssign { Target = "loc_0", Value = "(Point*)__t0" },
+            new IRFieldAccess { ObjectExpr = "loc_0", FieldCppName = "f_X", ResultVar = "__t1" },
+            new IRReturn { Value = "__t1" });
+        method.Locals.Add(new IRLocal { CppName = "loc_0", CppTypeName = "Point*" });
+
+        Assert.Equal(1, EscapeAnalysis.Run(module));
+        Assert.Equal("__stack_obj0", newObj.StackStorage);
+        Assert.Single(method.StackObjects);
+        Assert.Equal("Point", method.StackObjects[0].CppTypeName);
+        Assert.Contains("object_init_stack(&__stack_obj0", newObj.ToCpp());
+    }
+
+    [Fact]
+    public void Returned_StaysOnHeap()
+    {
+        var (module, _, program) = MakeModule();
+        var newObj = NewPoint("__t0");
+        AddMethod(program, "M", newObj, new IRReturn { Value = "__t0" });
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+        Assert.Null(newObj.StackStorage);
+    }
+
+    [Fact]
+    public void StoredToStaticOrField_StaysOnHeap()
+    {
+        var (module, _, program) = MakeModule();
+        var toStatic = NewPoint("__t0");
+        var toField = NewPoint("__t1");
+        AddMethod(program, "M",
+            toStatic,
+            new IRStaticFieldAccess { TypeCppName = "Program", FieldCppName = "f_s", IsStore = true, StoreValue = "__t0" },
+            toField,
+            new IRFieldAccess { ObjectExpr = "__this", FieldCppName = "f_p", IsStore = true, StoreValue = "(Point*)__t1" },
+            new IRReturn());
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void PassedToNonEscapingCallee_MovedToStack()
+    {
+        var (module, point, program) = MakeModule();
+        var getX = new IRMethod { Name = "GetX", CppName = "Point_GetX", DeclaringType = point };
+        AddBody(getX,
+            new IRFieldAccess { ObjectExpr = "__this", FieldCppName = "f_X", ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+        point.Methods.Add(getX);
+
+        var newObj = NewPoint("__t0");
+        AddMethod(program, "M",
+            newObj,
+            new IRCall { FunctionName = "Point_GetX", Arguments = { "(Point*)__t0" }, ResultVar = "__t1" },
+            new IRReturn { Value = "__t1" });
+
+        Assert.Equal(1, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void PassedToEscapingOrUnknownCallee_StaysOnHeap()
+    {
+        var (module, point, program) = MakeModule();
+        var keep = new IRMethod { Name = "Keep", CppName = "Point_Keep", DeclaringType = point, IsStatic = true };
+        keep.Parameters.Add(new IRParameter { Name = "p", CppName = "p", CppTypeName = "Point*" });
+        AddBody(keep,
+            new IRStaticFieldAccess { TypeCppName = "Point", FieldCppName = "f_last", IsStore = true, StoreValue = "p" },
+            new IRReturn());
+        point.Methods.Add(keep);
+
+        var kept = NewPoint("__t0");
+        var unknown = NewPoint("__t1");
+        AddMethod(program, "M",
+            kept,
+            new IRCall { FunctionName = "Point_Keep", Arguments = { "__t0" } },
+            unknown,
+            new IRCall { FunctionName = "cil2cpp::System::Console_WriteLine", Arguments = { "(cil2cpp::Object*)__t1" } },
+            new IRReturn());
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void VirtualCall_StaysOnHeap()
+    {
+        var (module, _, program) = MakeModule();
+        AddMethod(program, "M",
+            NewPoint("__t0"),
+            new IRCall { FunctionName = "Point_ToString", Arguments = { "__t0" }, IsVirtual = true, VTableSlot = 0 },
+            new IRReturn());
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void CopiedToReassignedLocal_StaysOnHeap()
+    {
+        // Point prev = null; ... prev = new Point(1): the old object may still be read
+        var (module, _, program) = MakeModule();
+        var method = AddMethod(program, "M",
+            new IRAssign { Target = "loc_0", Value = "nullptr" },
+            NewPoint("__t0"),
+            new IRAssign { Target = "loc_0", Value = "__t0" },
+            new IRReturn());
+        method.Locals.Add(new IRLocal { CppName = "loc_0", CppTypeName = "Point*" });
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void FinalizableType_StaysOnHeap()
+    {
+        var (module, point, program) = MakeModule();
+        point.Finalizer = new IRMethod { Name = "Finalize", CppName = "Point_Finalize", DeclaringType = point };
+        AddMethod(program, "M", NewPoint("__t0"), new IRReturn());
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+
+    [Fact]
+    public void RecursiveCallee_StaysOnHeap()
+    {
+        var (module, point, program) = MakeModule();
+        var walk = new IRMethod { Name = "Walk", CppName = "Point_Walk", DeclaringType = point };
+        AddBody(walk,
+            new IRCall { FunctionName = "Point_Walk", Arguments = { "__this" } },
+            new IRReturn());
+        point.Methods.Add(walk);
+        AddMethod(program, "M",
+            NewPoint("__t0"),
+            new IRCall { FunctionName = "Point_Walk", Arguments = { "__t0" } },
+            new IRReturn());
+
+        Assert.Equal(0, EscapeAnalysis.Run(module));
+    }
+}
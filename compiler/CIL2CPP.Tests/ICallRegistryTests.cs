@@ -53,10 +53,15 @@ public class ICallRegistryTests
 
     // System.GC
     [Theory]
-    [InlineData("System.GC", "Collect", 0, "cil2cpp::gc_collect")]
-    [InlineData("System.GC", "SuppressFinalize", 1, "cil2cpp::gc_suppress_finalize")]
-    [InlineData("System.GC", "KeepAlive", 1, "cil2cpp::gc_keep_alive")]
-    [InlineData("System.GC", "_Collect", 2, "cil2cpp::gc_collect")]
+    [InlineData("System.GC", "Collect", 0, "cil2cpp::icall::GC_Collect")]
+    [InlineData("System.GC", "Collect", 1, "cil2cpp::icall::GC_Collect")]
+    [InlineData("System.GC", "SuppressFinalize", 1, "cil2cpp::icall::GC_SuppressFinalize")]
+    [InlineData("System.GC", "KeepAlive", 1, "cil2cpp::icall::GC_KeepAlive")]
+    [InlineData("System.GC", "_Collect", 2, "cil2cpp::icall::GC_Collect")]
+    [InlineData("System.GC", "GetTotalMemory", 1, "cil2cpp::icall::GC_GetTotalMemory")]
+    [InlineData("System.GC", "CollectionCount", 1, "cil2cpp::icall::GC_CollectionCount")]
+    [InlineData("System.GC", "GetAllocatedBytesForCurrentThread", 0, "cil2cpp::icall::GC_GetAllocatedBytesForCurrentThread")]
+    [InlineData("System.GC", "GetTotalAllocatedBytes", 1, "cil2cpp::icall::GC_GetTotalAllocatedBytes")]
     public void Lookup_SystemGC_ReturnsCorrectCppName(string type, string method, int paramCount, string expected)
     {
         var result = ICallRegistry.Lookup(type, method, paramCount);
@@ -172,6 +177,62 @@ public class ICallRegistryTests
         Assert.Equal(expected, result);
     }
 
+    // System.Threading.Interlocked typed dispatch → inline atomic_ref templates
+    [Theory]
+    [InlineData("Increment", 1, "System.Int32&", "cil2cpp::interlocked::increment<int32_t>")]
+    [InlineData("Decrement", 1, "System.UInt64&", "cil2cpp::interlocked::decrement<uint64_t>")]
+    [InlineData("Add", 2, "System.Int64&", "cil2cpp::interlocked::add<int64_t>")]
+    [InlineData("Or", 2, "System.UInt32&", "cil2cpp::interlocked::or_<uint32_t>")]
+    [InlineData("Exchange", 2, "System.Single&", "cil2cpp::interlocked::exchange<float>")]
+    [InlineData("CompareExchange", 3, "System.IntPtr&", "cil2cpp::interlocked::compare_exchange<intptr_t>")]
+    [InlineData("CompareExchange", 3, "System.Object&", "cil2cpp::interlocked::compare_exchange_obj")]
+    [InlineData("Read", 1, "System.Int64&", "cil2cpp::interlocked::read<int64_t>")]
+    public void Lookup_Interlocked_TypedDispatch(string method, int paramCount, string firstParamType, string expected)
+    {
+        var result = ICallRegistry.Lookup("System.Threading.Interlocked", method, paramCount, firstParamType);
+        Assert.Equal(expected, result);
+    }
+
+    [Fact]
+    public void Lookup_Interlocked_AddHasNoUntypedFallback()
+    {
+        // Add(ref double) does not exist; an unknown first parameter must not pick the Int32 overload
+        Assert.Null(ICallRegistry.Lookup("System.Threading.Interlocked", "Add", 2, "System.Double&"));
+    }
+
+    // String.Concat overloads that are not string-typed dispatch on the first parameter
+    [Theory]
+    [InlineData(1, "System.String[]", "cil2cpp::string_concat_array")]
+    [InlineData(1, "System.Object[]", "cil2cpp::string_concat_obj_array")]
+    [InlineData(1, "System.Object", "cil2cpp::string_concat_obj")]
+    [InlineData(2, "System.Object", "cil2cpp::string_concat_obj")]
+    [InlineData(3, "System.Object", "cil2cpp::string_concat_obj3")]
+    [InlineData(4, "System.String", "cil2cpp::string_concat")]
+    public void Lookup_StringConcat_TypedDispatch(int paramCount, string firstParamType, string expected)
+    {
+        var result = ICallRegistry.Lookup("System.String", "Concat", paramCount, firstParamType);
+        Assert.Equal(expected, result);
+    }
+
+    [Theory]
+    [InlineData("System.Int32", 0, null, "cil2cpp::string_from_int32")]
+    [InlineData("System.Int32", 1, "System.String", "cil2cpp::string_from_int32")]
+    [InlineData("System.UInt64", 1, "System.String", "cil2cpp::string_from_uint64")]
+    [InlineData("System.Single", 0, null, "cil2cpp::string_from_single")]
+    [InlineData("System.Double", 1, "System.String", "cil2cpp::string_from_double")]
+    public void Lookup_PrimitiveToString_WithAndWithoutFormat(string type, int paramCount,
+        string? firstParamType, string expected)
+    {
+        var result = ICallRegistry.Lookup(type, "ToString", paramCount, firstParamType);
+        Assert.Equal(expected, result);
+    }
+
+    [Fact]
+    public void Lookup_PrimitiveToString_FormatProviderOverload_NotMapped()
+    {
+        Assert.Null(ICallRegistry.Lookup("System.Int32", "ToString", 1, "System.IFormatProvider"));
+    }
+
     // Wildcard registrations (Console, String.Concat/Substring)
     [Theory]
     [InlineData("System.Console", "WriteLine", 0, "cil2cpp::System::Console_WriteLine")]
@@ -1426,6 +1426,17 @@ public class IRBuilderTests
         Assert.Contains(instrs, i => i is IRRawCpp raw && raw.Code.Contains("array_length"));
     }
 
+    [Fact]
+    public void Build_FeatureTest_TestForeachArray_BoundsCheckElided()
+    {
+        var module = BuildFeatureTest();
+        var instrs = GetMethodInstructions(module, "Program", "TestForeachArray");
+        // foreach over an array is a counted loop over its Length
+        var load = Assert.Single(instrs.OfType<IRArrayAccess>());
+        Assert.True(load.BoundsCheckElided);
+        Assert.Contains("array_get_unchecked<int32_t>", load.ToCpp());
+    }
+
     // ===== Typed array element access (GetArrayElementType coverage) =====
 
     [Fact]
@@ -2159,7 +2170,7 @@ public class IRBuilderTests
     [Fact]
     public void Build_FeatureTest_TestInitOnlySetter_CallsSetters()
     {
-        var module = BuildFeatureTest();
+        var module = BuildFeatureTest(BuildConfiguration.Debug);
         var instrs = GetMethodInstructions(module, "Program", "TestInitOnlySetter");
         var calls = instrs.OfType<IRCall>().ToList();
         Assert.Contains(calls, c => c.FunctionName.Contains("set_X"));
@@ -2545,6 +2556,66 @@ public class IRBuilderTests
         Assert.Contains("f_status", allCode);
     }
 
+    [Fact]
+    public void Build_FeatureTest_Async_BuilderTaskCreatedLazily()
+    {
+        var module = BuildFeatureTest();
+        var stub = module.GetAllMethods().First(m => m.Name == "ComputeAsync" && m.BasicBlocks.Count > 0);
+        var code = string.Join("\n", stub.BasicBlocks.SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>().Select(r => r.Code));
+        // Create() no longer allocates a pending task; get_Task creates it only if still running
+        Assert.DoesNotContain("task_init_pending", code);
+        Assert.Contains("task_builder_get_task(", code);
+
+        var moveNext = module.Types.First(t => t.Name.Contains("ComputeAsync") && t.Name.Contains("d__"))
+            .Methods.First(m => m.Name == "MoveNext");
+        var moveNextCode = string.Join("\n", moveNext.BasicBlocks.SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>().Select(r => r.Code));
+        Assert.Contains("task_builder_set_result(", moveNextCode);
+        Assert.Contains("task_builder_set_exception(", moveNextCode);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Async_FromResultUsesCompletedTaskCache()
+    {
+        var module = BuildFeatureTest();
+        var method = module.GetAllMethods().First(m => m.Name == "TestAsyncConcurrency");
+        var code = string.Join("\n", method.BasicBlocks.SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>().Select(r => r.Code));
+        Assert.Contains("cil2cpp::task_from_result<System_Threading_Tasks_Task_1_System_Int32>(", code);
+        Assert.DoesNotContain("gc::alloc", code);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Async_PooledStateMachine_AcquiredAndReleasedTwice()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Release with { PoolAsyncStateMachines = true });
+        var stub = module.GetAllMethods().First(m => m.Name == "ComputeAsync" && m.BasicBlocks.Count > 0);
+        var stubInstrs = stub.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+        var newObj = stubInstrs.OfType<IRNewObj>().Single();
+        Assert.True(newObj.Pooled);
+        Assert.Null(newObj.StackStorage);
+        Assert.Contains("cil2cpp::async_box_acquire(", newObj.ToCpp());
+        // The stub drops its reference once it has read the builder's task
+        Assert.Contains(stubInstrs.OfType<IRRawCpp>(), r => r.Code.Contains("cil2cpp::async_box_release("));
+
+        var moveNext = module.Types.First(t => t.Name.Contains("ComputeAsync") && t.Name.Contains("d__"))
+            .Methods.First(m => m.Name == "MoveNext");
+        var moveNextCode = string.Join("\n", moveNext.BasicBlocks.SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>().Select(r => r.Code));
+        // ...and MoveNext once it has completed the task (result and exception paths)
+        Assert.Equal(2, moveNextCode.Split("cil2cpp::async_box_release(__this);").Length - 1);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Async_NotPooledByDefault()
+    {
+        var module = BuildFeatureTest();
+        Assert.DoesNotContain(module.GetAllMethods()
+            .SelectMany(m => m.BasicBlocks).SelectMany(b => b.Instructions), i =>
+                i is IRNewObj { Pooled: true } || i is IRRawCpp r && r.Code.Contains("async_box_release"));
+    }
+
     // ===== unbox.any reference type → castclass =====
 
     [Fact]
@@ -3395,10 +3466,9 @@ public class IRBuilderTests
             .OfType<IRCall>()
             .Select(c => c.FunctionName)
             .ToList();
-        // Interlocked.Increment → Interlocked_Increment_i32
-        Assert.Contains(calls, c => c.Contains("Interlocked_Increment"));
-        // Interlocked.CompareExchange → Interlocked_CompareExchange_i32
-        Assert.Contains(calls, c => c.Contains("Interlocked_CompareExchange"));
+        // Interlocked maps to the inline atomic_ref templates, not an out-of-line icall
+        Assert.Contains("cil2cpp::interlocked::increment<int32_t>", calls);
+        Assert.Contains("cil2cpp::interlocked::compare_exchange<int32_t>", calls);
     }
 
     [Fact]
@@ -3412,8 +3482,33 @@ public class IRBuilderTests
             .OfType<IRCall>()
             .Select(c => c.FunctionName)
             .ToList();
-        // Interlocked.Increment(ref long) → Interlocked_Increment_i64
-        Assert.Contains(calls, c => c.Contains("Interlocked_Increment_i64"));
+        Assert.Contains("cil2cpp::interlocked::increment<int64_t>", calls);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_TestInterlockedSurface_TypedAtomics()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "TestInterlockedSurface");
+        var calls = method.BasicBlocks
+            .SelectMany(b => b.Instructions)
+            .OfType<IRCall>()
+            .ToList();
+        var names = calls.Select(c => c.FunctionName).ToList();
+        Assert.Contains("cil2cpp::interlocked::increment<uint32_t>", names);
+        // Add(ref long) no longer falls back to the Int32 overload
+        Assert.Equal(2, names.Count(n => n == "cil2cpp::interlocked::add<int64_t>"));
+        Assert.Contains("cil2cpp::interlocked::read<int64_t>", names);
+        Assert.Contains("cil2cpp::interlocked::or_<int32_t>", names);
+        Assert.Contains("cil2cpp::interlocked::and_<int32_t>", names);
+        Assert.Contains("cil2cpp::interlocked::compare_exchange<double>", names);
+        Assert.Contains("cil2cpp::interlocked::memory_barrier", names);
+        Assert.Contains("cil2cpp::interlocked::volatile_write", names);
+        Assert.Equal(2, names.Count(n => n == "cil2cpp::interlocked::volatile_read"));
+        // Generic CompareExchange<string> goes through the Object* entry point
+        var cas = calls.Single(c => c.FunctionName == "cil2cpp::interlocked::compare_exchange_obj");
+        Assert.StartsWith("(cil2cpp::Object**)", cas.Arguments[0]);
     }
 
     [Fact]
@@ -3431,6 +3526,71 @@ public class IRBuilderTests
         Assert.Contains(rawCpps, c => c.Contains("thread::sleep"));
     }
 
+    [Fact]
+    public void Build_FeatureTest_TestThreadJoinTimeout_UsesThreadRegistry()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "TestThreadJoinTimeout");
+        var instrs = method.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+        var rawCpps = instrs.OfType<IRRawCpp>().Select(r => r.Code).ToList();
+        // Thread.CurrentThread → thread-local lookup, Join(int) → completion-event wait
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::thread::current()"));
+        Assert.Equal(2, rawCpps.Count(c => c.Contains("cil2cpp::thread::join_timeout(")));
+        Assert.Contains(instrs.OfType<IRCall>(),
+            c => c.FunctionName == "cil2cpp::icall::Environment_get_CurrentManagedThreadId");
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ThreadStaticFields_UseThreadLocalBlock()
+    {
+        var module = BuildFeatureTest();
+        var program = module.Types.First(t => t.Name == "Program");
+        var counter = program.StaticFields.First(f => f.Name == "_tsCounter");
+        Assert.True(counter.IsThreadStatic);
+        Assert.False(program.StaticFields.First(f => f.Name == "_flags").IsThreadStatic);
+
+        var method = program.Methods.First(m => m.Name == "TestThreadStatic");
+        var accesses = method.BasicBlocks
+            .SelectMany(b => b.Instructions)
+            .OfType<IRStaticFieldAccess>()
+            .ToList();
+        var store = accesses.First(a => a.IsStore && a.FieldCppName == counter.CppName);
+        Assert.True(store.IsThreadStatic);
+        Assert.StartsWith("Program_thread_statics.", store.ToCpp());
+    }
+
+    [Fact]
+    public void Build_FeatureTest_TestThreadLocal_LoweredToRuntime()
+    {
+        var module = BuildFeatureTest();
+        var rawCpps = LinqRawCpp(module, "TestThreadLocal");
+        Assert.Contains(rawCpps, c => c.Code.Contains("cil2cpp::threadlocal_create(sizeof(int32_t), (cil2cpp::Delegate*)"));
+        Assert.Contains(rawCpps, c => c.Code.Contains("cil2cpp::threadlocal_get_value<int32_t>("));
+        Assert.Contains(rawCpps, c => c.Code.Contains("cil2cpp::threadlocal_set_value<int32_t>("));
+        Assert.Contains(rawCpps, c => c.Code.Contains("cil2cpp::threadlocal_is_value_created("));
+        Assert.Contains(rawCpps, c => c.Code.Contains("cil2cpp::threadlocal_dispose("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_TestGCStatistics_LoweredToGCIcalls()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "TestGCStatistics");
+        var calls = method.BasicBlocks
+            .SelectMany(b => b.Instructions)
+            .OfType<IRCall>()
+            .Select(c => c.FunctionName)
+            .ToList();
+        Assert.Contains("cil2cpp::icall::GC_GetAllocatedBytesForCurrentThread", calls);
+        Assert.Contains("cil2cpp::icall::GC_CollectionCount", calls);
+        Assert.Contains("cil2cpp::icall::GC_GetTotalMemory", calls);
+        Assert.Contains("cil2cpp::icall::GC_GetTotalAllocatedBytes", calls);
+        Assert.Contains("cil2cpp::icall::GC_Collect", calls);
+        Assert.Contains("cil2cpp::icall::GC_KeepAlive", calls);
+    }
+
     [Fact]
     public void Build_FeatureTest_TestMonitorWaitPulse_HasMonitorWaitPulse()
     {
@@ -3466,6 +3626,62 @@ public class IRBuilderTests
         Assert.Equal("System_Threading_Thread", threadType.CppName);
     }
 
+    // ===== StringBuilder / String.Concat tests =====
+
+    [Fact]
+    public void Build_FeatureTest_StringBuilderSyntheticType_Exists()
+    {
+        var module = BuildFeatureTest();
+        var sbType = module.Types.FirstOrDefault(t => t.ILFullName == "System.Text.StringBuilder");
+        Assert.NotNull(sbType);
+        Assert.True(sbType.IsRuntimeProvided);
+        Assert.Equal("System_Text_StringBuilder", sbType.CppName);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_TestStringBuilder_LowersToRuntime()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "TestStringBuilder");
+        var rawCpps = method.BasicBlocks
+            .SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>()
+            .Select(r => r.Code)
+            .ToList();
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_create()"));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_append("));
+        // Append(int) formats in place — no intermediate ToString()
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_append_int32("));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_append_char("));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_append_bool("));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_append_format("));
+        // AppendFormat's object arguments go into an array with a real element type
+        Assert.DoesNotContain(rawCpps, c => c.Contains("array_create(nullptr"));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_insert("));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_replace("));
+        // sb.ToString() is emitted as callvirt Object::ToString; StringBuilder_TypeInfo's
+        // vtable slot dispatches it to string_builder_to_string.
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_get_length("));
+        Assert.Contains(rawCpps, c => c.Contains("cil2cpp::string_builder_clear("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_TestStringConcatMany_UsesNaryConcat()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "TestStringConcatMany");
+        var calls = method.BasicBlocks
+            .SelectMany(b => b.Instructions)
+            .OfType<IRCall>()
+            .ToList();
+        // a + b + c + d → one 4-argument string_concat
+        Assert.Contains(calls, c => c.FunctionName == "cil2cpp::string_concat" && c.Arguments.Count == 4);
+        // a + b + c + d + e → String.Concat(string[])
+        Assert.Contains(calls, c => c.FunctionName == "cil2cpp::string_concat_array");
+    }
+
     // ===== Reflection tests =====
 
     [Fact]
@@ -3926,6 +4142,32 @@ public class IRBuilderTests
         Assert.True(rawCpp.Any(r => r.Code.Contains("f_reference")));
     }
 
+    private static List<IRRawCpp> SpanRawCpp(IRModule module, string methodName) =>
+        module.Types.First(t => t.Name == "SpanTest")
+            .Methods.First(m => m.Name == methodName)
+            .BasicBlocks.SelectMany(b => b.Instructions).OfType<IRRawCpp>().ToList();
+
+    [Fact]
+    public void Build_FeatureTest_SpanIndexOf_UsesKernel()
+    {
+        var rawCpp = SpanRawCpp(BuildFeatureTest(), "SpanIndexOf");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::vec::index_of<int32_t>("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_SpanSequenceEqual_UsesKernel()
+    {
+        var rawCpp = SpanRawCpp(BuildFeatureTest(), "SpanSequenceEqual");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::vec::sequence_equal<int32_t>("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_SpanFill_UsesKernel()
+    {
+        var rawCpp = SpanRawCpp(BuildFeatureTest(), "SpanFill");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::vec::fill<int32_t>("));
+    }
+
     [Fact]
     public void Build_FeatureTest_ReadOnlySpan_SyntheticType_Created()
     {
@@ -4042,6 +4284,22 @@ public class IRBuilderTests
         Assert.Contains(tcsInt.Fields, f => f.CppName == "f_task");
     }
 
+    [Fact]
+    public void Build_FeatureTest_TaskCompletionSource_CreationOptionsPassedToTask()
+    {
+        var module = BuildFeatureTest();
+        string Code(string stubName) => string.Join("\n", module.GetAllMethods()
+            .Where(m => m.DeclaringType?.Name.Contains(stubName) == true && m.Name == "MoveNext")
+            .SelectMany(m => m.BasicBlocks).SelectMany(b => b.Instructions)
+            .OfType<IRRawCpp>().Select(r => r.Code));
+
+        Assert.Contains("static_cast<cil2cpp::TaskCreationOptions>(64)",
+            Code("TestTaskCompletionSourceRunContinuationsAsync"));
+        var plain = Code("TestTaskCompletionSourceAsync");
+        Assert.Contains("cil2cpp::task_init_pending(", plain);
+        Assert.DoesNotContain("TaskCreationOptions", plain);
+    }
+
     // ── LINQ Interception Tests ───────────────────────────────
 
     [Fact]
@@ -4052,8 +4310,8 @@ public class IRBuilderTests
             .Methods.First(m => m.Name == "LinqCount");
         var rawCpp = method.BasicBlocks.SelectMany(b => b.Instructions)
             .OfType<IRRawCpp>().ToList();
-        Assert.True(rawCpp.Any(r => r.Code.Contains("array_length")),
-            "LinqCount should use array_length");
+        Assert.True(rawCpp.Any(r => r.Code.Contains("cil2cpp::linq_count(")),
+            "LinqCount should use linq_count");
     }
 
     [Fact]
@@ -4064,8 +4322,10 @@ public class IRBuilderTests
             .Methods.First(m => m.Name == "LinqCountPredicate");
         var rawCpp = method.BasicBlocks.SelectMany(b => b.Instructions)
             .OfType<IRRawCpp>().ToList();
-        Assert.True(rawCpp.Any(r => r.Code.Contains("method_ptr")),
-            "LinqCountPredicate should call delegate via method_ptr");
+        Assert.True(rawCpp.Any(r => r.Code.Contains("__linq_c")),
+            "LinqCountPredicate should count in the fused loop");
+        Assert.False(rawCpp.Any(r => r.Code.Contains("method_ptr")),
+            "LinqCountPredicate should call the cached lambda directly");
     }
 
     [Fact]
@@ -4076,8 +4336,8 @@ public class IRBuilderTests
             .Methods.First(m => m.Name == "LinqSum");
         var rawCpp = method.BasicBlocks.SelectMany(b => b.Instructions)
             .OfType<IRRawCpp>().ToList();
-        Assert.True(rawCpp.Any(r => r.Code.Contains("array_data")),
-            "LinqSum should use array_data for iteration");
+        Assert.True(rawCpp.Any(r => r.Code.Contains("cil2cpp::linq_sum<int32_t>(")),
+            "LinqSum should use the vectorized linq_sum");
     }
 
     [Fact]
@@ -4088,8 +4348,327 @@ public class IRBuilderTests
             .Methods.First(m => m.Name == "LinqContains");
         var rawCpp = method.BasicBlocks.SelectMany(b => b.Instructions)
             .OfType<IRRawCpp>().ToList();
-        Assert.True(rawCpp.Any(r => r.Code.Contains("__linq_f")),
-            "LinqContains should use __linq_f found variable");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::linq_contains<int32_t>("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqAverage_UsesKernel()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "LinqAverage");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::linq_average<int32_t>("));
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("linq_for_each"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqMinDouble_UsesKernel()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "LinqMinDouble");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::linq_min<double>("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqFusedChain_CheckedSum()
+    {
+        var loop = LinqRawCpp(BuildFeatureTest(), "LinqFusedChain")
+            .Single(r => r.Code.Contains("linq_for_each")).Code;
+        // Enumerable.Sum(IEnumerable<int>) throws on overflow
+        Assert.Contains("cil2cpp::checked_add(", loop);
+    }
+
+    private static List<IRRawCpp> LinqRawCpp(IRModule module, string methodName) =>
+        module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == methodName)
+            .BasicBlocks.SelectMany(b => b.Instructions).OfType<IRRawCpp>().ToList();
+
+    [Fact]
+    public void Build_FeatureTest_LinqFusedChain_SingleLoop()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "LinqFusedChain");
+        // Where + Select + Sum run in one loop; nothing is materialized in between
+        Assert.Single(rawCpp, r => r.Code.Contains("linq_for_each"));
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("LinqArrayBuilder"));
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("method_ptr"));
+        var loop = rawCpp.Single(r => r.Code.Contains("linq_for_each")).Code;
+        Assert.Contains("__linq_s", loop);
+        Assert.Contains("if (!__r0) return true;", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqListChain_ListSourceAndClosure()
+    {
+        var loop = LinqRawCpp(BuildFeatureTest(), "LinqListChain")
+            .Single(r => r.Code.Contains("linq_for_each")).Code;
+        Assert.Contains("System_Collections_Generic_List_1_System_Int32_TypeInfo", loop);
+        // The closure lambda is called with its display class as the target
+        Assert.Contains("->target, __e0)", loop);
+        Assert.DoesNotContain("method_ptr", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqDeferredQuery_RunsAtCount()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "LinqDeferredQuery");
+        // The local holds a captured query, not an array built before list.Add
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("LinqArrayBuilder"));
+        var loop = rawCpp.Single(r => r.Code.Contains("linq_for_each")).Code;
+        Assert.Contains("__linq_c", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqEscapingQuery_LazyQueryObject()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "LinqScaled");
+        // The returned query is an object that runs Where + Select when enumerated
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("LinqArrayBuilder"));
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("linq_for_each"));
+        var query = rawCpp.Single(r => r.Code.Contains("cil2cpp::LinqDeferredType<int32_t, int32_t>")).Code;
+        Assert.Contains("if (!__r0) continue;", query);
+        Assert.Contains("System_Collections_Generic_IEnumerable_1_System_Int32_TypeInfo", query);
+        Assert.Contains(rawCpp, r => r.Code.Contains(".create(__linq_o"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqIteratorChain_EnumerableSource()
+    {
+        var loop = LinqRawCpp(BuildFeatureTest(), "LinqIteratorChain")
+            .Single(r => r.Code.Contains("linq_for_each")).Code;
+        Assert.Contains("cil2cpp::LinqEnumerableTypes", loop);
+        Assert.Contains("System_Collections_Generic_IEnumerable_1_System_Int32_TypeInfo", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_LinqIteratorChain_SourceSpilledBeforeLambdaCache()
+    {
+        // GetNumbers() is called before the cached-lambda branch, so its interface
+        // pointer is copied through an Object* cast before the label
+        var instrs = BuildFeatureTest().Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "LinqIteratorChain")
+            .BasicBlocks.SelectMany(b => b.Instructions).ToList();
+        var call = instrs.OfType<IRCall>().Single(c => c.FunctionName == "IteratorHelper_GetNumbers");
+        var spill = Assert.IsType<IRAssign>(instrs[instrs.IndexOf(call) + 1]);
+        Assert.Equal($"(cil2cpp::Object*){call.ResultVar}", spill.Value);
+        Assert.True(instrs.IndexOf(call) < instrs.FindIndex(i => i is IRLabel));
+        var loop = instrs.OfType<IRRawCpp>().Single(r => r.Code.Contains("linq_for_each")).Code;
+        Assert.Contains($"(cil2cpp::Object*)({spill.Target})", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ParallelFor_ForkJoinWithDirectBody()
+    {
+        var loop = LinqRawCpp(BuildFeatureTest(), "ParallelForSum")
+            .Single(r => r.Code.Contains("cil2cpp::parallel::for_range(")).Code;
+        // The closure lambda is called directly for every index of a chunk
+        Assert.Contains("ParallelForSum_b__0(", loop);
+        Assert.DoesNotContain("method_ptr", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ParallelForEach_UsesOptions()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "ParallelForEachList");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::parallel_options_create()"));
+        Assert.Contains(rawCpp, r => r.Code.Contains("f_maxDegreeOfParallelism = __par_v"));
+        var loop = rawCpp.Single(r => r.Code.Contains("cil2cpp::parallel::for_each<int32_t>(")).Code;
+        Assert.Contains("cil2cpp::parallel::options_of(", loop);
+        Assert.Contains("System_Collections_Generic_List_1_System_Int32_TypeInfo", loop);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_AggregateException_InnerExceptionsLowered()
+    {
+        var module = BuildFeatureTest();
+        var rawCpp = LinqRawCpp(module, "ParallelForInnerExceptions");
+        // InnerExceptions wraps the runtime's Exception[]; Count, [i] and foreach read it
+        Assert.Contains(rawCpp, r => r.Code.Contains("->inner_exceptions, {})"));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::array_length("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::array_get<cil2cpp::Exception*>("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("::get_enumerator("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::aggregate_exception_flatten("));
+        var handle = rawCpp.Single(r => r.Code.Contains("cil2cpp::aggregate_exception_handle(")).Code;
+        Assert.Contains("ParallelForInnerExceptions_b__", handle);
+        // The ReadOnlyCollection<Exception> handle is opaque
+        var collection = module.Types.Single(t =>
+            t.ILFullName == "System.Collections.ObjectModel.ReadOnlyCollection`1<System.Exception>");
+        Assert.Empty(collection.Methods);
+        Assert.Empty(collection.Interfaces);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_PlinqWhereSum_ParallelReduce()
+    {
+        var rawCpp = LinqRawCpp(BuildFeatureTest(), "PlinqWhereSum");
+        var loop = rawCpp.Single(r => r.Code.Contains("cil2cpp::linq_parallel_reduce<int32_t, int64_t>(")).Code;
+        // Where + Select fold into each partition's partial sum
+        Assert.Contains("cil2cpp::checked_add(", loop);
+        Assert.DoesNotContain("method_ptr", loop);
+        Assert.DoesNotContain(rawCpp, r => r.Code.Contains("LinqArrayBuilder"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_PlinqAggregate_SeedlessPartials()
+    {
+        var loop = LinqRawCpp(BuildFeatureTest(), "PlinqAggregate")
+            .Single(r => r.Code.Contains("linq_parallel_reduce")).Code;
+        Assert.Contains("cil2cpp::LinqPartial<int32_t>", loop);
+        // An empty source has no first element to start from
+        Assert.Contains("cil2cpp::throw_invalid_operation()", loop);
+    }
+
+    private static List<IRRawCpp> StateMachineRawCpp(IRModule module, string asyncMethodName) =>
+        module.Types.First(t => t.Name.Contains(asyncMethodName) && t.Name.Contains("d__"))
+            .Methods.First(m => m.Name == "MoveNext")
+            .BasicBlocks.SelectMany(b => b.Instructions).OfType<IRRawCpp>().ToList();
+
+    [Fact]
+    public void Build_FeatureTest_ChannelPipeline_LoweredToRuntimeChannel()
+    {
+        var module = BuildFeatureTest();
+        var rawCpp = StateMachineRawCpp(module, "ChannelPipelineAsync");
+        var create = rawCpp.Single(r => r.Code.Contains("cil2cpp::channel_create_bounded(")).Code;
+        Assert.Contains("sizeof(int32_t)", create);
+        Assert.Contains(rawCpp, r => r.Code.Contains(
+            "cil2cpp::channel_wait_to_read_async<System_Threading_Tasks_ValueTask_1_System_Boolean>("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::channel_try_read("));
+        // No call reaches the BCL ChannelReader/ChannelWriter implementation
+        var calls = module.Types.SelectMany(t => t.Methods).SelectMany(m => m.BasicBlocks)
+            .SelectMany(b => b.Instructions).OfType<IRCall>();
+        Assert.DoesNotContain(calls, c => c.FunctionName.Contains("System_Threading_Channels"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ChannelReadAsync_ValueTaskOfElement()
+    {
+        var rawCpp = StateMachineRawCpp(BuildFeatureTest(), "ChannelUnboundedReadAsync");
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::channel_try_write("));
+        Assert.Contains(rawCpp, r => r.Code.Contains(
+            "cil2cpp::channel_read_async<System_Threading_Tasks_ValueTask_1_System_String>("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::channel_get_completion("));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ChannelReadAsync_PassesCancellationToken()
+    {
+        var rawCpp = StateMachineRawCpp(BuildFeatureTest(), "ChannelReadCanceledAsync");
+        var token = rawCpp.Single(r => r.Code.Contains("System_Threading_CancellationToken __t")).Code;
+        var tokenVar = System.Text.RegularExpressions.Regex.Match(token, @"CancellationToken (__t\d+);").Groups[1].Value;
+        Assert.Contains(rawCpp, r => r.Code.Contains(
+            $"cil2cpp::channel_read_async<System_Threading_Tasks_ValueTask_1_System_Int32>((cil2cpp::Channel*)("));
+        Assert.Contains(rawCpp, r => r.Code.Contains("channel_read_async") && r.Code.Contains($", {tokenVar});"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_SlimPrimitives_LoweredToRuntime()
+    {
+        var module = BuildFeatureTest();
+        var handshake = LinqRawCpp(module, "ResetEventHandshake");
+        Assert.Contains(handshake, r => r.Code.Contains("cil2cpp::reset_event_create(0, -1)"));
+        Assert.Contains(handshake, r => r.Code.Contains("cil2cpp::reset_event_wait(") && r.Code.Contains("1000)"));
+        Assert.Contains(handshake, r => r.Code.Contains("cil2cpp::reset_event_is_set("));
+
+        var counter = LinqRawCpp(module, "ReaderWriterLockCounter");
+        Assert.Contains(counter, r => r.Code.Contains("cil2cpp::rwlock_create(0)"));
+        Assert.Contains(counter, r => r.Code.Contains("cil2cpp::rwlock_enter_write(") && r.Code.Contains("-1)"));
+        Assert.Contains(counter, r => r.Code.Contains("cil2cpp::rwlock_enter_read(") && r.Code.Contains("100)"));
+        Assert.Contains(counter, r => r.Code.Contains("cil2cpp::rwlock_exit_read("));
+
+        var tryWait = LinqRawCpp(module, "SemaphoreTryWait");
+        Assert.Contains(tryWait, r => r.Code.Contains("cil2cpp::semaphore_create(2, 2)"));
+        Assert.Contains(tryWait, r => r.Code.Contains("cil2cpp::semaphore_wait(") && r.Code.Contains(", 0)"));
+        Assert.Contains(tryWait, r => r.Code.Contains("cil2cpp::semaphore_current_count("));
+        // No call reaches the BCL implementations
+        var calls = module.Types.SelectMany(t => t.Methods).SelectMany(m => m.BasicBlocks)
+            .SelectMany(b => b.Instructions).OfType<IRCall>();
+        Assert.DoesNotContain(calls, c => c.FunctionName.Contains("SemaphoreSlim")
+            || c.FunctionName.Contains("ManualResetEventSlim") || c.FunctionName.Contains("ReaderWriterLockSlim"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_SemaphoreWaitAsync_ReturnsRuntimeTask()
+    {
+        var rawCpp = StateMachineRawCpp(BuildFeatureTest(), "SemaphoreHandoffAsync");
+        // SemaphoreSlim(int) has no upper bound: maxCount is int.MaxValue
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::semaphore_create(1, 0x7FFFFFFF)"));
+        Assert.Equal(2, rawCpp.Count(r => r.Code.Contains("cil2cpp::semaphore_wait_async(")));
+        Assert.Contains(rawCpp, r => r.Code.Contains("cil2cpp::semaphore_release(") && r.Code.Contains(", 1)"));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ConstrainedGetHashCode_CallsOverrideWithoutBoxing()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Debug);
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_HashOf_GridKey");
+        var allCode = string.Join("\n", method.BasicBlocks.SelectMany(b => b.Instructions).Select(i => i.ToCpp()));
+        Assert.Contains("GridKey_GetHashCode((GridKey*)&value)", allCode);
+        Assert.DoesNotContain("box", allCode);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ConstrainedEquatable_PassesValueWithoutBoxing()
+    {
+        var module = BuildFeatureTest();
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_SameKey_GridKey");
+        var allCode = string.Join("\n", method.BasicBlocks.SelectMany(b => b.Instructions).Select(i => i.ToCpp()));
+        Assert.Contains("GridKey_Equals((GridKey*)&a, b)", allCode);
+        Assert.DoesNotContain("box", allCode);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Release_NonEscapingObjectsOnStack()
+    {
+        // TestReferenceEquals: two Dogs only compared by reference
+        var module = BuildFeatureTest(BuildConfiguration.Release);
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_TestReferenceEquals");
+        Assert.Equal(2, method.StackObjects.Count);
+        var newObjs = method.BasicBlocks.SelectMany(b => b.Instructions).OfType<IRNewObj>().ToList();
+        Assert.All(newObjs, n => Assert.Contains("cil2cpp::object_init_stack(&__stack_obj", n.ToCpp()));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Debug_KeepsObjectsOnHeap()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Debug);
+        Assert.All(module.GetAllMethods(), m => Assert.Empty(m.StackObjects));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Release_InlinesPropertyAccessors()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Release);
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_TestProperties");
+        Assert.Contains("Person_get_Name", method.InlinedCalls);
+        var calls = method.BasicBlocks.SelectMany(b => b.Instructions).OfType<IRCall>();
+        Assert.DoesNotContain(calls, c => c.FunctionName == "Person_get_Name");
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Debug_KeepsCalls()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Debug);
+        Assert.All(module.GetAllMethods(), m => Assert.Empty(m.InlinedCalls));
+    }
+
+    [Fact]
+    public void Build_FeatureTest_ConstrainedExplicitImpl_MatchesDeclaringInterface()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Debug);
+        var twoLabels = module.Types.First(t => t.Name == "TwoLabels");
+        var right = twoLabels.Methods.Single(m =>
+            m.ExplicitOverrides.Contains(("IRightLabel", "Label")));
+        var left = twoLabels.Methods.Single(m =>
+            m.ExplicitOverrides.Contains(("ILeftLabel", "Label")));
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_RightLabelOf_TwoLabels");
+        var allCode = string.Join("\n", method.BasicBlocks.SelectMany(b => b.Instructions).Select(i => i.ToCpp()));
+        Assert.Contains($"{right.CppName}((TwoLabels*)&value)", allCode);
+        Assert.DoesNotContain(left.CppName + "(", allCode);
+        Assert.DoesNotContain("box", allCode);
+    }
+
+    [Fact]
+    public void Build_FeatureTest_Release_InlinesConstrainedExplicitImpl()
+    {
+        var module = BuildFeatureTest(BuildConfiguration.Release);
+        var method = module.GetAllMethods().First(m => m.CppName == "Program_RightLabelOf_TwoLabels");
+        Assert.Equal(new[] { "TwoLabels_IRightLabel_Label" }, method.InlinedCalls);
     }
 
     [Fact]
@@ -4117,6 +4696,24 @@ public class IRBuilderTests
             "StringFormat should call string_format");
     }
 
+    [Fact]
+    public void Build_FeatureTest_StringFormatSpecifiers_PassesPrimitivesUnboxed()
+    {
+        var module = BuildFeatureTest();
+        var method = module.Types.First(t => t.Name == "Program")
+            .Methods.First(m => m.Name == "StringFormatSpecifiers");
+        var instrs = method.BasicBlocks.SelectMany(b => b.Instructions).ToList();
+        var rawCpp = instrs.OfType<IRRawCpp>().Select(r => r.Code).ToList();
+        // int and double arguments become FormatArg values, not boxes
+        Assert.DoesNotContain(instrs, i => i is IRBox);
+        Assert.Contains(rawCpp, c => c.Contains("cil2cpp::FormatArg") && c.Contains("static_cast<int32_t>"));
+        Assert.Contains(rawCpp, c => c.Contains("cil2cpp::FormatArg") && c.Contains("static_cast<double>"));
+        Assert.Contains(rawCpp, c => c.Contains("cil2cpp::string_format(") && c.Contains(", 2);"));
+        // Int32.ToString(string) → string_from_int32(value, format)
+        Assert.Contains(instrs.OfType<IRCall>(), c => c.FunctionName == "cil2cpp::string_from_int32"
+                                                     && c.Arguments.Count == 2);
+    }
+
     [Fact]
     public void Build_FeatureTest_StringIndexOf_Mapped()
     {
@@ -109,6 +109,22 @@ public class IRInstructionTests
         Assert.Contains("MyClass__ctor(__t0, 42)", code);
     }
 
+    [Fact]
+    public void IRNewObj_StackStorage_ToCpp()
+    {
+        var instr = new IRNewObj
+        {
+            TypeCppName = "MyClass",
+            CtorName = "MyClass__ctor",
+            ResultVar = "__t0",
+            StackStorage = "__stack_obj0",
+        };
+        var code = instr.ToCpp();
+        Assert.Contains("cil2cpp::object_init_stack(&__stack_obj0, sizeof(MyClass), &MyClass_TypeInfo)", code);
+        Assert.DoesNotContain("gc::alloc", code);
+        Assert.Contains("MyClass__ctor(__t0)", code);
+    }
+
     [Fact]
     public void IRBinaryOp_ToCpp()
     {
@@ -231,6 +247,35 @@ public class IRInstructionTests
         Assert.Equal("cil2cpp::array_set<int32_t>(arr, i, 42);", instr.ToCpp());
     }
 
+    [Fact]
+    public void IRArrayAccess_BoundsCheckElided_UsesUnchecked()
+    {
+        var load = new IRArrayAccess
+        {
+            ArrayExpr = "arr", IndexExpr = "i", ElementType = "double",
+            ResultVar = "__t0", BoundsCheckElided = true
+        };
+        var store = new IRArrayAccess
+        {
+            ArrayExpr = "arr", IndexExpr = "i", ElementType = "double",
+            IsStore = true, StoreValue = "1.0", BoundsCheckElided = true
+        };
+        Assert.Equal("__t0 = cil2cpp::array_get_unchecked<double>(arr, i);", load.ToCpp());
+        Assert.Equal("cil2cpp::array_set_unchecked<double>(arr, i, 1.0);", store.ToCpp());
+    }
+
+    [Fact]
+    public void IRArrayElementAddress_ToCpp()
+    {
+        var instr = new IRArrayElementAddress
+        {
+            ArrayExpr = "arr", IndexExpr = "i", ElementType = "Point", ResultVar = "__t1"
+        };
+        Assert.Equal("__t1 = cil2cpp::array_element_ptr<Point>(arr, i);", instr.ToCpp());
+        instr.BoundsCheckElided = true;
+        Assert.Equal("__t1 = cil2cpp::array_element_ptr_unchecked<Point>(arr, i);", instr.ToCpp());
+    }
+
     [Fact]
     public void IRCast_Safe_ToCpp()
     {
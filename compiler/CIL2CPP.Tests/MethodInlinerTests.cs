@@ -0,0 +1,242 @@
+using Xunit;
+using CIL2CPP.Core.IL;
+using CIL2CPP.Core.IR;
+
+namespace CIL2CPP.Tests;
+
+public class MethodInlinerTests
+{
+    /// <summary>
+    /// class Point { int X { get; set; } } plus a static Program type holding the
+    /// caller under test.
+    /// </summary>
+    private static (IRModule Module, IRType Point, IRType Program) MakeModule()
+    {
+        var module = new IRModule { Name = "Test" };
+        var point = new IRType { ILFullName = "Point", CppName = "Point" };
+
+        var getX = new IRMethod { Name = "get_X", CppName = "Point_get_X", DeclaringType = point, ReturnTypeCpp = "int32_t" };
+        AddBody(getX,
+            new IRFieldAccess { ObjectExpr = "__this", FieldCppName = "f_X", ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+        point.Methods.Add(getX);
+
+        var setX = new IRMethod { Name = "set_X", CppName = "Point_set_X", DeclaringType = point };
+        setX.Parameters.Add(new IRParameter { Name = "value", CppName = "value", CppTypeName = "int32_t" });
+        AddBody(setX,
+            new IRFieldAccess { ObjectExpr = "__this", FieldCppName = "f_X", IsStore = true, StoreValue = "value" },
+            new IRReturn());
+        point.Methods.Add(setX);
+
+        var program = new IRType { ILFullName = "Program", CppName = "Program" };
+        module.Types.Add(point);
+        module.Types.Add(program);
+        return (module, point, program);
+    }
+
+    private static void AddBody(IRMethod method, params IRInstruction[] instructions)
+    {
+        var block = new IRBasicBlock { Id = 0 };
+        block.Instructions.AddRange(instructions);
+        method.BasicBlocks.Add(block);
+    }
+
+    private static IRMethod AddMethod(IRType type, string name, params IRInstruction[] instructions)
+    {
+        var method = new IRMethod { Name = name, CppName = $"{type.CppName}_{name}", DeclaringType = type, IsStatic = true };
+        AddBody(method, instructions);
+        type.Methods.Add(method);
+        return method;
+    }
+
+    private static string Code(IRMethod method) =>
+        string.Join("\n", method.BasicBlocks.SelectMany(b => b.Instructions).Select(i => i.ToCpp()));
+
+    [Fact]
+    public void Getter_InlinedAsFieldLoad()
+    {
+        var (module, _, program) = MakeModule();
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_get_X", Arguments = { "p" }, ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+
+        Assert.Equal(1, MethodInliner.Run(module));
+        Assert.Equal(new[] { "Point_get_X" }, method.InlinedCalls);
+        Assert.Empty(method.BasicBlocks[0].Instructions.OfType<IRCall>());
+        var code = Code(method);
+        Assert.Contains("__t1 = ((Point*)(p))->f_X;", code);
+        Assert.Contains("__t0 = (int32_t)(__t1);", code);
+    }
+
+    [Fact]
+    public void Setter_InlinedAsFieldStore()
+    {
+        var (module, _, program) = MakeModule();
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_set_X", Arguments = { "p", "5" } },
+            new IRReturn());
+
+        Assert.Equal(1, MethodInliner.Run(module));
+        Assert.Contains("((Point*)(p))->f_X = ((int32_t)(5));", Code(method));
+    }
+
+    [Fact]
+    public void NonTrivialArgument_EvaluatedOnce()
+    {
+        var (module, _, program) = MakeModule();
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_set_X", Arguments = { "p", "Program_Next()" } },
+            new IRReturn());
+
+        MethodInliner.Run(module);
+        var code = Code(method);
+        Assert.Contains("__t0 = Program_Next();", code);
+        Assert.Contains("= ((int32_t)(__t0));", code);
+        Assert.Single(System.Text.RegularExpressions.Regex.Matches(code, @"Program_Next\(\)"));
+    }
+
+    [Fact]
+    public void NestedCallees_InlinedBottomUp()
+    {
+        var (module, point, program) = MakeModule();
+        var getDouble = new IRMethod { Name = "get_Double", CppName = "Point_get_Double", DeclaringType = point, ReturnTypeCpp = "int32_t" };
+        AddBody(getDouble,
+            new IRCall { FunctionName = "Point_get_X", Arguments = { "__this" }, ResultVar = "__t0" },
+            new IRBinaryOp { Left = "__t0", Right = "2", Op = "*", ResultVar = "__t1" },
+            new IRReturn { Value = "__t1" });
+        point.Methods.Add(getDouble);
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_get_Double", Arguments = { "p" }, ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+
+        MethodInliner.Run(module);
+        Assert.Equal(new[] { "Point_get_X" }, getDouble.InlinedCalls);
+        Assert.Equal(new[] { "Point_get_Double" }, method.InlinedCalls);
+        Assert.Contains("->f_X;", Code(method));
+        Assert.DoesNotContain("Point_get", Code(method));
+    }
+
+    [Fact]
+    public void ByRefParameter_ArgumentsEvaluatedBeforeBody()
+    {
+        // static int Poke(ref Vec a, Vec b) { a.X = 5; return b.X; } called as Poke(ref v, v)
+        var (module, _, program) = MakeModule();
+        var vec = new IRType { ILFullName = "Vec", CppName = "Vec", IsValueType = true };
+        module.Types.Add(vec);
+        var poke = new IRMethod { Name = "Poke", CppName = "Vec_Poke", DeclaringType = vec, IsStatic = true, ReturnTypeCpp = "int32_t" };
+        poke.Parameters.Add(new IRParameter { Name = "a", CppName = "a", CppTypeName = "Vec*", ILTypeName = "Vec&" });
+        poke.Parameters.Add(new IRParameter { Name = "b", CppName = "b", CppTypeName = "Vec", ILTypeName = "Vec" });
+        AddBody(poke,
+            new IRFieldAccess { ObjectExpr = "a", FieldCppName = "f_X", IsStore = true, StoreValue = "5" },
+            new IRFieldAccess { ObjectExpr = "b", FieldCppName = "f_X", IsValueAccess = true, ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+        vec.Methods.Add(poke);
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Vec_Poke", Arguments = { "&v", "v" }, ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+
+        Assert.Equal(1, MethodInliner.Run(module));
+        var lines = Code(method).Split('\n');
+        int copy = Array.IndexOf(lines, "__t2 = v;");
+        int store = Array.FindIndex(lines, l => l.Contains("->f_X = "));
+        Assert.True(copy >= 0 && copy < store, Code(method));
+        Assert.Contains("((Vec)(__t2)).f_X;", Code(method));
+    }
+
+    [Fact]
+    public void VirtualCall_Kept()
+    {
+        var (module, _, program) = MakeModule();
+        AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_get_X", Arguments = { "p" }, ResultVar = "__t0", IsVirtual = true, VTableSlot = 4 },
+            new IRReturn { Value = "__t0" });
+
+        Assert.Equal(0, MethodInliner.Run(module));
+    }
+
+    [Fact]
+    public void RecursiveMethod_Kept()
+    {
+        var (module, _, program) = MakeModule();
+        var method = AddMethod(program, "Loop",
+            new IRCall { FunctionName = "Program_Loop" },
+            new IRReturn());
+
+        Assert.Equal(0, MethodInliner.Run(module));
+        Assert.Single(method.BasicBlocks[0].Instructions.OfType<IRCall>());
+    }
+
+    [Fact]
+    public void BranchingOrLargeBody_Kept()
+    {
+        var (module, _, program) = MakeModule();
+        AddMethod(program, "Abs",
+            new IRConditionalBranch { Condition = "x >= 0", TrueLabel = "IL_0004" },
+            new IRUnaryOp { Operand = "x", Op = "-", ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+        var large = Enumerable.Range(0, MethodInliner.MaxInlineSize + 1)
+            .Select(i => (IRInstruction)new IRBinaryOp { Left = "1", Right = "2", Op = "+", ResultVar = $"__t{i}" })
+            .Append(new IRReturn())
+            .ToArray();
+        AddMethod(program, "Large", large);
+        AddMethod(program, "M",
+            new IRCall { FunctionName = "Program_Abs", Arguments = { "1" }, ResultVar = "__t0" },
+            new IRCall { FunctionName = "Program_Large" },
+            new IRReturn());
+
+        Assert.Equal(0, MethodInliner.Run(module));
+    }
+
+    [Fact]
+    public void ParameterWrite_Kept()
+    {
+        var (module, point, program) = MakeModule();
+        var clamp = new IRMethod { Name = "Clamp", CppName = "Point_Clamp", DeclaringType = point, IsStatic = true, ReturnTypeCpp = "int32_t" };
+        clamp.Parameters.Add(new IRParameter { Name = "v", CppName = "v", CppTypeName = "int32_t" });
+        AddBody(clamp,
+            new IRAssign { Target = "v", Value = "0" },
+            new IRReturn { Value = "v" });
+        point.Methods.Add(clamp);
+        AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_Clamp", Arguments = { "x" }, ResultVar = "__t0" },
+            new IRReturn());
+
+        Assert.Equal(0, MethodInliner.Run(module));
+    }
+
+    [Fact]
+    public void BclCallee_Kept()
+    {
+        var (module, point, program) = MakeModule();
+        point.SourceKind = AssemblyKind.BCL;
+        AddMethod(program, "M",
+            new IRCall { FunctionName = "Point_get_X", Arguments = { "p" }, ResultVar = "__t0" },
+            new IRReturn());
+
+        Assert.Equal(0, MethodInliner.Run(module));
+    }
+
+    [Fact]
+    public void RepeatedCctorGuard_Removed()
+    {
+        var (module, _, program) = MakeModule();
+        var config = new IRType { ILFullName = "Config", CppName = "Config" };
+        module.Types.Add(config);
+        var getLimit = new IRMethod { Name = "get_Limit", CppName = "Config_get_Limit", DeclaringType = config, IsStatic = true, ReturnTypeCpp = "int32_t" };
+        AddBody(getLimit,
+            new IRStaticCtorGuard { TypeCppName = "Config" },
+            new IRStaticFieldAccess { TypeCppName = "Config", FieldCppName = "f_limit", ResultVar = "__t0" },
+            new IRReturn { Value = "__t0" });
+        config.Methods.Add(getLimit);
+        var method = AddMethod(program, "M",
+            new IRCall { FunctionName = "Config_get_Limit", ResultVar = "__t0" },
+            new IRCall { FunctionName = "Config_get_Limit", ResultVar = "__t1" },
+            new IRLabel { LabelName = "IL_0010" },
+            new IRCall { FunctionName = "Config_get_Limit", ResultVar = "__t2" },
+            new IRReturn());
+
+        Assert.Equal(3, MethodInliner.Run(module));
+        // One guard before the label, one after it
+        Assert.Equal(2, method.BasicBlocks[0].Instructions.OfType<IRStaticCtorGuard>().Count());
+    }
+}
@@ -2,7 +2,9 @@ using System;
 using System.Collections;
 using System.Collections.Generic;
 using System.Linq;
+using System.Text;
 using System.Threading;
+using System.Threading.Channels;
 using System.Threading.Tasks;
 
 // Base class with virtual methods (exercises callvirt, vtable)
@@ -417,6 +419,35 @@ public struct Celsius
     public static explicit operator Celsius(double d) => new Celsius(d);
 }
 
+// Value type with its own equality: generic code and collections call it without boxing
+public struct GridKey : IEquatable<GridKey>
+{
+    public int Row;
+    public int Col;
+    public GridKey(int row, int col) { Row = row; Col = col; }
+    public bool Equals(GridKey other)
+    {
+        if (Row != other.Row) return false;
+        return Col == other.Col;
+    }
+    public override bool Equals(object obj)
+    {
+        if (!(obj is GridKey)) return false;
+        return Equals((GridKey)obj);
+    }
+    public override int GetHashCode() => Row * 397 + Col;
+}
+
+// Two interfaces with the same method: a constrained call must pick the right explicit implementation
+public interface ILeftLabel { int Label(); }
+public interface IRightLabel { int Label(); }
+
+public struct TwoLabels : ILeftLabel, IRightLabel
+{
+    int ILeftLabel.Label() => 1;
+    int IRightLabel.Label() => 2;
+}
+
 // Class that exposes MemberwiseClone (protected on System.Object)
 public class Cloneable
 {
@@ -698,6 +729,8 @@ public class Program
         TestAsyncConcurrency();
         TestAsyncEnumerable();
         TestReflectionAdvanced();
+        TestStringBuilder();
+        TestStringConcatMany();
     }
 
     static void TestAsyncEnumerable()
@@ -2082,6 +2115,89 @@ public class Program
         Console.WriteLine("Slept");
     }
 
+    // Exercises Join(timeout), Thread.CurrentThread and CurrentManagedThreadId
+    static void TestThreadJoinTimeout()
+    {
+        int mainId = Environment.CurrentManagedThreadId;
+        bool sameId = Thread.CurrentThread.ManagedThreadId == mainId;
+        var gate = new ManualResetEventSlim(false);
+        int workerId = 0;
+        Thread t = new Thread(() =>
+        {
+            workerId = Environment.CurrentManagedThreadId;
+            gate.Wait();
+        });
+        t.Start();
+        bool early = t.Join(10);
+        gate.Set();
+        bool done = t.Join(1000);
+        Console.WriteLine(sameId);               // True
+        Console.WriteLine(early);                // False
+        Console.WriteLine(done);                 // True
+        Console.WriteLine(workerId == t.ManagedThreadId);  // True
+    }
+
+    [ThreadStatic] static int _tsCounter;
+    [ThreadStatic] static string? _tsName;
+
+    // Exercises [ThreadStatic] fields: each thread starts from zero/null
+    static void TestThreadStatic()
+    {
+        _tsCounter = 5;
+        _tsName = "main";
+        int seen = -1;
+        bool nameIsNull = false;
+        Thread t = new Thread(() =>
+        {
+            seen = _tsCounter;
+            nameIsNull = _tsName == null;
+            _tsCounter = 9;
+        });
+        t.Start();
+        t.Join();
+        Console.WriteLine(seen);         // 0
+        Console.WriteLine(nameIsNull);   // True
+        Console.WriteLine(_tsCounter);   // 5
+        Console.WriteLine(_tsName);      // main
+    }
+
+    // Exercises ThreadLocal<T>: factory once per thread, Value get/set, Dispose
+    static void TestThreadLocal()
+    {
+        int calls = 0;
+        var local = new ThreadLocal<int>(() => Interlocked.Increment(ref calls) * 10);
+        int mine = local.Value;
+        int other = 0;
+        Thread t = new Thread(() =>
+        {
+            other = local.Value;
+            local.Value = 99;
+        });
+        t.Start();
+        t.Join();
+        local.Value = local.Value + 1;
+        Console.WriteLine(mine);                 // 10
+        Console.WriteLine(other);                // 20
+        Console.WriteLine(local.Value);          // 11
+        Console.WriteLine(local.IsValueCreated); // True
+        local.Dispose();
+    }
+
+    // Exercises GC counters lowered to runtime icalls
+    static void TestGCStatistics()
+    {
+        long before = GC.GetAllocatedBytesForCurrentThread();
+        int collections = GC.CollectionCount(0);
+        var buffer = new byte[4096];
+        long after = GC.GetAllocatedBytesForCurrentThread();
+        GC.Collect();
+        GC.KeepAlive(buffer);
+        Console.WriteLine(after - before >= 4096);                // True
+        Console.WriteLine(GC.CollectionCount(0) > collections);   // True
+        Console.WriteLine(GC.GetTotalMemory(false) > 0);          // True
+        Console.WriteLine(GC.GetTotalAllocatedBytes(false) >= after); // True
+    }
+
     // Exercises Monitor.Wait/Pulse
     static void TestMonitorWaitPulse()
     {
@@ -2113,6 +2229,31 @@ public class Program
         Console.WriteLine(val);  // 1
     }
 
+    static int _flags;
+    static long _total;
+    static double _level;
+    static string? _owner;
+    static bool _ready;
+
+    // Exercises the rest of the Interlocked/Volatile surface
+    static void TestInterlockedSurface()
+    {
+        uint hits = 0;
+        Interlocked.Increment(ref hits);
+        Interlocked.Add(ref _total, 40);
+        Interlocked.Add(ref _total, 2);
+        Console.WriteLine(Interlocked.Read(ref _total));  // 42
+        int before = Interlocked.Or(ref _flags, 0b101);
+        Interlocked.And(ref _flags, 0b100);
+        Console.WriteLine(before + _flags);  // 0 + 4
+        Interlocked.CompareExchange(ref _level, 1.5, 0.0);
+        Interlocked.CompareExchange(ref _owner, "main", null);
+        Interlocked.MemoryBarrier();
+        Volatile.Write(ref _ready, true);
+        Console.WriteLine(Volatile.Read(ref _ready) && Volatile.Read(ref _owner) == "main");  // True
+        Console.WriteLine(hits + (uint)_level);  // 2
+    }
+
     // ===== Reflection Tests =====
 
     // Exercises typeof(T) → ldtoken + GetTypeFromHandle → Type properties
@@ -2227,6 +2368,29 @@ public class Program
         Console.WriteLine(dict.Count);             // 0
     }
 
+    static void TestStringBuilder()
+    {
+        var sb = new StringBuilder();
+        sb.Append("x=").Append(42).Append(',').Append(true);
+        sb.AppendLine();
+        sb.AppendFormat("{0}-{1}", "a", "b");
+        sb.Insert(0, "[");
+        sb.Replace("a", "A");
+        Console.WriteLine(sb.ToString()); // [x=42,True\nA-b
+        Console.WriteLine(sb.Length);     // 14
+        sb.Clear();
+        Console.WriteLine(sb.Append('z', 3).ToString()); // zzz
+    }
+
+    static void TestStringConcatMany()
+    {
+        string a = "a", b = "b", c = "c", d = "d", e = "e";
+        Console.WriteLine(a + b + c + d);     // String.Concat(string, string, string, string)
+        Console.WriteLine(a + b + c + d + e); // String.Concat(string[])
+        int n = 5;
+        Console.WriteLine(a + n + b);         // String.Concat(string, string, string) via ToString
+    }
+
     // ===== Async Concurrency Tests =====
 
     static async Task<int> DelayAndReturn(int value)
@@ -2282,6 +2446,13 @@ public class Program
         return await tcs.Task;
     }
 
+    public static async Task<int> TestTaskCompletionSourceRunContinuationsAsync()
+    {
+        var tcs = new TaskCompletionSource<int>(TaskCreationOptions.RunContinuationsAsynchronously);
+        tcs.SetResult(7);
+        return await tcs.Task;
+    }
+
     // ===== LINQ Extension Methods =====
 
     public static int LinqCount()
@@ -2350,6 +2521,227 @@ public class Program
         return nums.Contains(3); // true
     }
 
+    public static double LinqAverage()
+    {
+        int[] nums = { 1, 2, 3, 4 };
+        return nums.Average(); // 2.5
+    }
+
+    public static double LinqMinDouble()
+    {
+        double[] nums = { 2.5, double.NaN, -1.0 };
+        return nums.Min(); // NaN — the first NaN wins, as in the BCL
+    }
+
+    public static int LinqFusedChain()
+    {
+        int[] nums = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        return nums.Where(x => x % 2 == 0).Select(x => x * 6).Sum(); // 120
+    }
+
+    public static int LinqListChain()
+    {
+        var list = new List<int> { 5, 1, 4, 2, 3 };
+        int offset = 10;
+        return list.Select(x => x + offset).Where(x => x > 12).Count(); // 3
+    }
+
+    public static int LinqDeferredQuery()
+    {
+        var list = new List<int> { 1, 2, 3 };
+        var big = list.Where(x => x > 1);
+        list.Add(4);
+        return big.Count(); // 3 — the query runs when Count() enumerates it
+    }
+
+    public static IEnumerable<int> LinqScaled(List<int> list, int factor)
+    {
+        return list.Where(x => x > 1).Select(x => x * factor);
+    }
+
+    public static int LinqEscapingQuery()
+    {
+        var list = new List<int> { 1, 2, 3 };
+        var scaled = LinqScaled(list, 10);
+        list.Add(4);
+        int sum = 0;
+        foreach (var x in scaled) sum += x;
+        return sum; // 90 — the returned query runs when foreach enumerates it
+    }
+
+    public static int LinqIteratorChain()
+    {
+        return IteratorHelper.GetNumbers().Where(x => x > 10).Sum(); // 50
+    }
+
+    // ── Parallel loops and PLINQ ──────────────────────────
+
+    public static int ParallelForSum()
+    {
+        var squares = new int[100];
+        Parallel.For(0, squares.Length, i => squares[i] = i * i);
+        int sum = 0;
+        foreach (var s in squares) sum += s;
+        return sum; // 328350
+    }
+
+    public static int ParallelForEachList()
+    {
+        var list = new List<int> { 1, 2, 3, 4, 5 };
+        var options = new ParallelOptions();
+        options.MaxDegreeOfParallelism = 2;
+        int total = 0;
+        Parallel.ForEach(list, options, x => Interlocked.Add(ref total, x));
+        return total; // 15
+    }
+
+    public static int ParallelForInnerExceptions()
+    {
+        try
+        {
+            Parallel.For(0, 4, i => { if (i % 2 == 1) throw new InvalidOperationException("odd"); });
+        }
+        catch (AggregateException ae)
+        {
+            // Each failing participant contributes its first exception
+            int failed = 0;
+            foreach (var inner in ae.InnerExceptions)
+                if (inner is InvalidOperationException) failed++;
+            if (failed == 0) return -1;
+            if (failed != ae.InnerExceptions.Count) return -2;
+            if (ae.InnerExceptions[0] is not InvalidOperationException) return -3;
+            ae.Flatten().Handle(e => e is InvalidOperationException);
+            return 1;
+        }
+        return 0; // 1
+    }
+
+    public static long PlinqWhereSum()
+    {
+        int[] nums = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+        return nums.AsParallel().Where(x => x % 2 == 0).Select(x => (long)x * 3).Sum(); // 90
+    }
+
+    public static int PlinqAggregate()
+    {
+        int[] nums = { 3, 9, 4, 1 };
+        return nums.AsParallel().Aggregate((a, b) => Math.Max(a, b)); // 9
+    }
+
+    // ── Channels ──────────────────────────────────────────
+
+    public static async Task<int> ChannelPipelineAsync()
+    {
+        var channel = Channel.CreateBounded<int>(4);
+        var producer = Task.Run(async () =>
+        {
+            for (int i = 1; i <= 10; i++) await channel.Writer.WriteAsync(i);
+            channel.Writer.Complete();
+        });
+        int sum = 0;
+        while (await channel.Reader.WaitToReadAsync())
+            while (channel.Reader.TryRead(out var item)) sum += item;
+        await producer;
+        return sum; // 55
+    }
+
+    public static async Task<string> ChannelUnboundedReadAsync()
+    {
+        var channel = Channel.CreateUnbounded<string>();
+        channel.Writer.TryWrite("ping");
+        var item = await channel.Reader.ReadAsync();
+        channel.Writer.TryComplete();
+        await channel.Reader.Completion;
+        return item; // "ping"
+    }
+
+    public static async Task<bool> ChannelReadCanceledAsync()
+    {
+        var channel = Channel.CreateUnbounded<int>();
+        var cts = new CancellationTokenSource();
+        cts.CancelAfter(10);
+        try
+        {
+            await channel.Reader.ReadAsync(cts.Token);   // parks: the channel stays empty
+            return false;
+        }
+        catch (OperationCanceledException)
+        {
+            return true; // true
+        }
+    }
+
+    // ── Slim synchronization primitives ───────────────────
+
+    public static async Task<int> SemaphoreHandoffAsync()
+    {
+        var gate = new SemaphoreSlim(1);
+        await gate.WaitAsync();
+        var queued = gate.WaitAsync();   // pending until Release
+        gate.Release();
+        await queued;
+        int held = gate.CurrentCount;
+        gate.Release();
+        return held + gate.CurrentCount; // 0 + 1
+    }
+
+    public static int SemaphoreTryWait()
+    {
+        var gate = new SemaphoreSlim(2, 2);
+        int taken = 0;
+        while (gate.Wait(0)) taken++;
+        gate.Release(taken);
+        return taken * 10 + gate.CurrentCount; // 22
+    }
+
+    public static bool ResetEventHandshake()
+    {
+        var ready = new ManualResetEventSlim(false);
+        var worker = new Thread(() => ready.Set());
+        worker.Start();
+        bool signaled = ready.Wait(1000);
+        worker.Join();
+        return signaled && ready.IsSet; // true
+    }
+
+    public static int ReaderWriterLockCounter()
+    {
+        var rw = new ReaderWriterLockSlim();
+        int value = 0;
+        rw.EnterWriteLock();
+        try { value = 42; }
+        finally { rw.ExitWriteLock(); }
+        if (!rw.TryEnterReadLock(100)) return -1;
+        try { return value + rw.CurrentReadCount; } // 43
+        finally { rw.ExitReadLock(); }
+    }
+
+    // ── Value-type equality without boxing ────────────────
+
+    static int HashOf<T>(T value) => value.GetHashCode();
+    static bool SameKey<T>(T a, T b) where T : IEquatable<T> => a.Equals(b);
+
+    public static int StructKeyLookup()
+    {
+        var cells = new Dictionary<GridKey, int>();
+        for (int r = 0; r < 4; r++) cells[new GridKey(r, r + 1)] = r * 10;
+        return cells[new GridKey(2, 3)] + HashOf(new GridKey(1, 2)); // 20 + 399
+    }
+
+    public static bool StructEquatableGeneric()
+    {
+        var a = new GridKey(1, 2);
+        var b = new GridKey(1, 2);
+        return SameKey(a, b); // true
+    }
+
+    static int RightLabelOf<T>(T value) where T : IRightLabel => value.Label();
+
+    public static int StructExplicitInterfaceCall()
+    {
+        return RightLabelOf(new TwoLabels()); // 2
+    }
+
     // ── String operations ─────────────────────────────────
 
     public static string StringFormat()
@@ -2362,6 +2754,11 @@ public class Program
         return string.Format("Value: {0}", 123);
     }
 
+    public static string StringFormatSpecifiers()
+    {
+        return string.Format("{0,5}|{1:F2}|", 42, 3.5) + 255.ToString("X4");
+    }
+
     public static int StringIndexOf()
     {
         string s = "Hello World";
@@ -2628,6 +3025,28 @@ public static class SpanTest
         Span<int> span = new Span<int>(buf, 4);
         return span[0]; // should be 100
     }
+
+    public static int SpanIndexOf()
+    {
+        int[] arr = new int[] { 10, 20, 30, 40, 50 };
+        Span<int> span = arr;
+        return span.IndexOf(40); // should be 3
+    }
+
+    public static bool SpanSequenceEqual()
+    {
+        int[] a = new int[] { 1, 2, 3 };
+        int[] b = new int[] { 1, 2, 3 };
+        return a.AsSpan().SequenceEqual(b); // should be true
+    }
+
+    public static int SpanFill()
+    {
+        int[] arr = new int[8];
+        Span<int> span = arr;
+        span.Fill(7);
+        return arr[7]; // should be 7
+    }
 }
 
 // P/Invoke test class
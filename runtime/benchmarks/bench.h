@@ -0,0 +1,145 @@
+/**
+ * CIL2CPP Runtime Benchmarks - shared timing helpers
+ *
+ * Results are printed to stderr so that benchmarks producing console output
+ * can be run with stdout redirected (e.g. `bench_console > /dev/null`).
+ *
+ * A benchmark that defines BENCH_COUNT_HEAP_ALLOCS before including this
+ * header replaces the global operator new with a counting one, and
+ * measure_allocs reports native heap allocations next to the GC bytes.
+ */
+
+#pragma once
+
+#include <cil2cpp/gc.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace bench {
+
+/// Iteration count override: `BENCH_SCALE=0.1 bench_x` runs 10% of the default work.
+inline double scale() {
+    const char* s = std::getenv("BENCH_SCALE");
+    double v = s ? std::atof(s) : 1.0;
+    return v > 0 ? v : 1.0;
+}
+
+inline long long scaled(long long n) {
+    long long v = static_cast<long long>(static_cast<double>(n) * scale());
+    return v > 0 ? v : 1;
+}
+
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+    double elapsed_ms() const {
+        auto d = std::chrono::steady_clock::now() - start_;
+        return std::chrono::duration<double, std::milli>(d).count();
+    }
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+/// Run fn() once and report wall time plus per-op cost for `ops` operations.
+template<typename F>
+double measure(const char* name, long long ops, F&& fn) {
+    Stopwatch sw;
+    fn();
+    double ms = sw.elapsed_ms();
+    std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f ns/op\n",
+                 name, ms, ms * 1e6 / static_cast<double>(ops));
+    return ms;
+}
+
+/// Best-of-N variant for short kernels (reduces scheduler noise).
+template<typename F>
+double measure_best(const char* name, long long ops, int runs, F&& fn) {
+    double best = 0;
+    for (int i = 0; i < runs; i++) {
+        Stopwatch sw;
+        fn();
+        double ms = sw.elapsed_ms();
+        if (i == 0 || ms < best) best = ms;
+    }
+    std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f ns/op\n",
+                 name, best, best * 1e6 / static_cast<double>(ops));
+    return best;
+}
+
+inline void section(const char* title) {
+    std::fprintf(stderr, "\n== %s ==\n", title);
+}
+
+inline void ratio(const char* label, double baseline_ms, double new_ms) {
+    std::fprintf(stderr, "  %-44s %10.2fx\n", label, new_ms > 0 ? baseline_ms / new_ms : 0.0);
+}
+
+// ===== Allocation accounting =====
+
+#ifdef BENCH_COUNT_HEAP_ALLOCS
+inline std::atomic<long long> g_heap_allocs{0};
+#endif
+
+/// Native heap allocations so far (0 without BENCH_COUNT_HEAP_ALLOCS).
+inline long long heap_allocs() {
+#ifdef BENCH_COUNT_HEAP_ALLOCS
+    return g_heap_allocs.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+/// Per-op costs of one measure_allocs row.
+struct Allocs {
+    double ms;              // best of the 3 runs
+    double gc_bytes;        // GC bytes per op, averaged over the runs
+    double heap_allocs;     // operator new calls per op
+};
+
+/// measure_best over 3 runs, then the GC bytes (and heap allocations) per op.
+template<typename F>
+Allocs measure_allocs(const char* name, long long ops, F&& fn) {
+    size_t gc_before = cil2cpp::gc::get_stats().total_allocated;
+    long long heap_before = heap_allocs();
+    Allocs result{};
+    result.ms = measure_best(name, ops, 3, fn);
+    double runs = 3.0 * static_cast<double>(ops);
+    result.gc_bytes = static_cast<double>(cil2cpp::gc::get_stats().total_allocated - gc_before) / runs;
+    result.heap_allocs = static_cast<double>(heap_allocs() - heap_before) / runs;
+    std::fprintf(stderr, "  %-44s %10.2f B/op\n", "  GC allocated", result.gc_bytes);
+#ifdef BENCH_COUNT_HEAP_ALLOCS
+    std::fprintf(stderr, "  %-44s %10.2f /op\n", "  heap allocations (new)", result.heap_allocs);
+#endif
+    return result;
+}
+
+/// Prevent the optimizer from discarding a computed value.
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(_MSC_VER)
+    static volatile const void* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+} // namespace bench
+
+#ifdef BENCH_COUNT_HEAP_ALLOCS
+// Replacement allocation functions (not inline, so one benchmark translation unit
+// defines BENCH_COUNT_HEAP_ALLOCS)
+void* operator new(std::size_t size) {
+    bench::g_heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif
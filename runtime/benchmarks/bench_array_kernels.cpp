@@ -0,0 +1,208 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Array bounds checks in numeric kernels
+ *
+ * Each kernel is written the way the compiler emits it for
+ * `for (int i = 0; i < a.Length; i++)`, in three variants:
+ *  - previous: array_get<T>/array_set<T> calling an out-of-line bounds check
+ *    (what every ldelem/stelem compiled to), and ldelema through the untyped
+ *    array_get_element_ptr that reloads element_type->element_size;
+ *  - inline check: the header-only check with the throw on a cold path;
+ *  - eliminated: unchecked access where the loop condition proves the index
+ *    in range (other arrays indexed by i keep the inline check).
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <vector>
+
+using namespace cil2cpp;
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+// ===== Previous code shape =====
+
+BENCH_NOINLINE static void legacy_bounds_check(Array* arr, Int32 index) {
+    if (!arr) throw_null_reference();
+    if (index < 0 || index >= arr->length) throw_index_out_of_range();
+}
+
+template<typename T>
+static inline T& legacy_get(Array* arr, Int32 index) {
+    legacy_bounds_check(arr, index);
+    return static_cast<T*>(array_data(arr))[index];
+}
+
+template<typename T>
+static inline void legacy_set(Array* arr, Int32 index, T value) {
+    legacy_bounds_check(arr, index);
+    static_cast<T*>(array_data(arr))[index] = value;
+}
+
+BENCH_NOINLINE static void* legacy_element_ptr(Array* arr, Int32 index) {
+    legacy_bounds_check(arr, index);
+    size_t element_size = arr->element_type->element_size;
+    if (element_size == 0) element_size = sizeof(void*);
+    return static_cast<char*>(array_data(arr)) + index * element_size;
+}
+
+struct Point {
+    Double x;
+    Double y;
+};
+
+static TypeInfo make_type(const char* name, const char* full_name, UInt32 size) {
+    TypeInfo t = {};
+    t.name = name;
+    t.namespace_name = "System";
+    t.full_name = full_name;
+    t.instance_size = size;
+    t.element_size = size;
+    t.flags = TypeFlags::ValueType | TypeFlags::Primitive;
+    return t;
+}
+
+int main() {
+    runtime_init();
+
+    static TypeInfo int_type = make_type("Int32", "System.Int32", sizeof(Int32));
+    static TypeInfo double_type = make_type("Double", "System.Double", sizeof(Double));
+    static TypeInfo point_type = make_type("Point", "Bench.Point", sizeof(Point));
+    point_type.flags = TypeFlags::ValueType;
+
+    const Int32 n = 1 << 16;                         // fits in L2
+    const long long reps = bench::scaled(4000);
+    const long long ops = reps * n;
+
+    Array* ints = array_create(&int_type, n);
+    Array* xs = array_create(&double_type, n);
+    Array* ys = array_create(&double_type, n);
+    Array* pts = array_create(&point_type, n);
+    for (Int32 i = 0; i < n; i++) {
+        array_set<Int32>(ints, i, i & 1023);
+        array_set<Double>(xs, i, i * 0.5);
+        array_set<Double>(ys, i, 1.0);
+        array_element_ptr<Point>(pts, i)->y = i * 0.25;
+    }
+
+    // --- int sum: s += a[i] ---
+    bench::section("Sum int[] (s += a[i])");
+    double legacy_sum = bench::measure_best("previous (out-of-line check)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            for (Int32 i = 0; i < array_length(ints); i++) s += legacy_get<Int32>(ints, i);
+            bench::do_not_optimize(s);
+        }
+    });
+    double inline_sum = bench::measure_best("inline check", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            for (Int32 i = 0; i < array_length(ints); i++) s += array_get<Int32>(ints, i);
+            bench::do_not_optimize(s);
+        }
+    });
+    double elim_sum = bench::measure_best("eliminated", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            for (Int32 i = 0; i < array_length(ints); i++) s += array_get_unchecked<Int32>(ints, i);
+            bench::do_not_optimize(s);
+        }
+    });
+    bench::ratio("  speedup (inline check)", legacy_sum, inline_sum);
+    bench::ratio("  speedup (eliminated)", legacy_sum, elim_sum);
+
+    // --- dot product: loop over x.Length, y[i] stays checked ---
+    bench::section("Dot product double[] (d += x[i] * y[i])");
+    double legacy_dot = bench::measure_best("previous (out-of-line check)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Double d = 0;
+            for (Int32 i = 0; i < array_length(xs); i++)
+                d += legacy_get<Double>(xs, i) * legacy_get<Double>(ys, i);
+            bench::do_not_optimize(d);
+        }
+    });
+    double inline_dot = bench::measure_best("inline check", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Double d = 0;
+            for (Int32 i = 0; i < array_length(xs); i++)
+                d += array_get<Double>(xs, i) * array_get<Double>(ys, i);
+            bench::do_not_optimize(d);
+        }
+    });
+    double elim_dot = bench::measure_best("eliminated (x only)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Double d = 0;
+            for (Int32 i = 0; i < array_length(xs); i++)
+                d += array_get_unchecked<Double>(xs, i) * array_get<Double>(ys, i);
+            bench::do_not_optimize(d);
+        }
+    });
+    bench::ratio("  speedup (inline check)", legacy_dot, inline_dot);
+    bench::ratio("  speedup (eliminated)", legacy_dot, elim_dot);
+
+    // --- saxpy: y[i] = a * x[i] + y[i] over y.Length ---
+    bench::section("SAXPY double[] (y[i] = a * x[i] + y[i])");
+    double legacy_axpy = bench::measure_best("previous (out-of-line check)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(ys); i++)
+                legacy_set<Double>(ys, i, 1e-9 * legacy_get<Double>(xs, i) + legacy_get<Double>(ys, i));
+        }
+        bench::do_not_optimize(ys);
+    });
+    double inline_axpy = bench::measure_best("inline check", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(ys); i++)
+                array_set<Double>(ys, i, 1e-9 * array_get<Double>(xs, i) + array_get<Double>(ys, i));
+        }
+        bench::do_not_optimize(ys);
+    });
+    double elim_axpy = bench::measure_best("eliminated (y only)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(ys); i++)
+                array_set_unchecked<Double>(ys, i,
+                    1e-9 * array_get<Double>(xs, i) + array_get_unchecked<Double>(ys, i));
+        }
+        bench::do_not_optimize(ys);
+    });
+    bench::ratio("  speedup (inline check)", legacy_axpy, inline_axpy);
+    bench::ratio("  speedup (eliminated)", legacy_axpy, elim_axpy);
+
+    // --- struct array through ldelema: pts[i].x += pts[i].y ---
+    bench::section("Struct array via ldelema (p[i].X += p[i].Y)");
+    double legacy_pts = bench::measure_best("previous (untyped element_ptr)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(pts); i++) {
+                auto* p = static_cast<Point*>(legacy_element_ptr(pts, i));
+                p->x += p->y;
+            }
+        }
+        bench::do_not_optimize(pts);
+    });
+    double inline_pts = bench::measure_best("inline check, typed", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(pts); i++) {
+                auto* p = array_element_ptr<Point>(pts, i);
+                p->x += p->y;
+            }
+        }
+        bench::do_not_optimize(pts);
+    });
+    double elim_pts = bench::measure_best("eliminated", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            for (Int32 i = 0; i < array_length(pts); i++) {
+                auto* p = array_element_ptr_unchecked<Point>(pts, i);
+                p->x += p->y;
+            }
+        }
+        bench::do_not_optimize(pts);
+    });
+    bench::ratio("  speedup (inline check)", legacy_pts, inline_pts);
+    bench::ratio("  speedup (eliminated)", legacy_pts, elim_pts);
+
+    runtime_shutdown();
+    return 0;
+}
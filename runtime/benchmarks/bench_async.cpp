@@ -0,0 +1,154 @@
+/**
+ * CIL2CPP Runtime Benchmarks - synchronously completing async methods
+ *
+ * Async call chains written the way the compiler emits them, for the common
+ * case where every await finds its task already completed (cache hits):
+ *
+ *  - previous lowering: AsyncTaskMethodBuilder.Create() allocates a pending
+ *    Task<T> (plus a heap std::mutex that is never freed), SetResult stores
+ *    the result and completes it through the lock;
+ *  - lazy builder: the task is only created on the first real await, so
+ *    SetResult picks a cached task (task_from_result) or allocates a
+ *    lock-less completed one.
+ *
+ * Rows print GC bytes and native heap allocations (operator new, i.e. the
+ * mutexes) per async call.
+ */
+
+#define BENCH_COUNT_HEAP_ALLOCS
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+
+using namespace cil2cpp;
+
+// ===== Task<T> / AsyncTaskMethodBuilder<T>, as the generated code declares them =====
+
+template <typename T>
+struct TaskOf {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_status;
+    Exception* f_exception;
+    intptr_t f_continuations;
+    intptr_t f_lock;
+    T f_result;
+};
+
+template <typename T>
+struct BuilderOf {
+    TaskOf<T>* f_task;
+};
+
+// awaiter.IsCompleted / GetResult on an already completed task
+template <typename T>
+static T await_completed(TaskOf<T>* task) {
+    auto* t = reinterpret_cast<Task*>(task);
+    if (!task_is_completed(t)) std::abort();  // never suspends in this benchmark
+    task_wait(t);
+    if (t->f_status == 2 && t->f_exception) throw_exception(t->f_exception);
+    return task->f_result;
+}
+
+// async Task<T> Lookup(depth, key) { return depth == 0 ? Leaf(key) : await Lookup(depth - 1, key); }
+
+template <typename T, typename Leaf>
+static TaskOf<T>* lookup_previous(Int32 depth, Int32 key, Leaf leaf) {
+    BuilderOf<T> builder = {};
+    builder.f_task = static_cast<TaskOf<T>*>(gc::alloc(sizeof(TaskOf<T>), nullptr));
+    task_init_pending(reinterpret_cast<Task*>(builder.f_task));
+    // MoveNext
+    T result = depth == 0 ? leaf(key) : await_completed(lookup_previous<T>(depth - 1, key, leaf));
+    builder.f_task->f_result = result;
+    task_complete(reinterpret_cast<Task*>(builder.f_task));
+    return builder.f_task;
+}
+
+template <typename T, typename Leaf>
+static TaskOf<T>* lookup_lazy(Int32 depth, Int32 key, Leaf leaf) {
+    BuilderOf<T> builder = {};
+    // MoveNext
+    T result = depth == 0 ? leaf(key) : await_completed(lookup_lazy<T>(depth - 1, key, leaf));
+    task_builder_set_result(builder.f_task, result);
+    return task_builder_get_task(builder.f_task);
+}
+
+int main() {
+    runtime_init();
+
+    const Int32 n = static_cast<Int32>(bench::scaled(1'000'000));
+    const Int32 depth = 4;
+    const long long calls = static_cast<long long>(n) * (depth + 1);
+
+    auto hit = [](Int32 key) -> bool { return (key & 15) != 0; };
+    auto small = [](Int32 key) -> Int32 { return key & 7; };
+    auto large = [](Int32 key) -> Int32 { return key | 0x100; };
+
+    bench::section("Task<bool> chain, depth 5, all synchronous (per async call)");
+    {
+        double prev = bench::measure_allocs("pending task + mutex (previous lowering)", calls, [&] {
+            Int32 hits = 0;
+            for (Int32 i = 0; i < n; i++) hits += lookup_previous<bool>(depth, i, hit)->f_result;
+            bench::do_not_optimize(hits);
+        }).ms;
+        double lazy = bench::measure_allocs("lazy builder + cached tasks", calls, [&] {
+            Int32 hits = 0;
+            for (Int32 i = 0; i < n; i++) hits += lookup_lazy<bool>(depth, i, hit)->f_result;
+            bench::do_not_optimize(hits);
+        }).ms;
+        bench::ratio("  speedup", prev, lazy);
+    }
+
+    bench::section("Task<int> chain, results 0..7 (cached)");
+    {
+        double prev = bench::measure_allocs("pending task + mutex (previous lowering)", calls, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += lookup_previous<Int32>(depth, i, small)->f_result;
+            bench::do_not_optimize(acc);
+        }).ms;
+        double lazy = bench::measure_allocs("lazy builder + cached tasks", calls, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += lookup_lazy<Int32>(depth, i, small)->f_result;
+            bench::do_not_optimize(acc);
+        }).ms;
+        bench::ratio("  speedup", prev, lazy);
+    }
+
+    bench::section("Task<int> chain, results >= 256 (not cached)");
+    {
+        double prev = bench::measure_allocs("pending task + mutex (previous lowering)", calls, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += lookup_previous<Int32>(depth, i, large)->f_result;
+            bench::do_not_optimize(acc);
+        }).ms;
+        double lazy = bench::measure_allocs("lazy builder, completed task", calls, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += lookup_lazy<Int32>(depth, i, large)->f_result;
+            bench::do_not_optimize(acc);
+        }).ms;
+        bench::ratio("  speedup", prev, lazy);
+    }
+
+    bench::section("Task.FromResult(bool)");
+    {
+        double prev = bench::measure_allocs("gc::alloc + task_init_completed (previous)", n, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) {
+                auto* t = static_cast<TaskOf<bool>*>(gc::alloc(sizeof(TaskOf<bool>), nullptr));
+                task_init_completed(reinterpret_cast<Task*>(t));
+                t->f_result = (i & 3) != 0;
+                acc += t->f_result;
+            }
+            bench::do_not_optimize(acc);
+        }).ms;
+        double cached = bench::measure_allocs("task_from_result", n, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += task_from_result<TaskOf<bool>>((i & 3) != 0)->f_result;
+            bench::do_not_optimize(acc);
+        }).ms;
+        bench::ratio("  speedup", prev, cached);
+    }
+
+    runtime_shutdown();
+    return 0;
+}
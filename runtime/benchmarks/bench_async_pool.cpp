@@ -0,0 +1,167 @@
+/**
+ * CIL2CPP Runtime Benchmarks - pooled async state machines
+ *
+ * A 10-deep async Task<int> chain whose innermost method awaits a pending
+ * "gate" task, so every level really suspends and resumes, written the way the
+ * compiler emits it:
+ *
+ *  - GC boxes: the stub boxes its state machine with gc::alloc (the default);
+ *  - pooled boxes: [PoolAsyncStateMachine] / --pool-async-state-machines, the
+ *    box comes from async_box_acquire and goes back to the per-thread pool once
+ *    both the stub and MoveNext have released it.
+ *
+ * Continuation nodes are pooled in both chain rows (the runtime always pools
+ * them); the first section isolates that against the previous gc::alloc per
+ * await. The pending tasks themselves (48 B + a heap mutex each) are
+ * allocated in every row.
+ *
+ * Rows print GC bytes and native heap allocations (operator new) per await.
+ */
+
+#define BENCH_COUNT_HEAP_ALLOCS
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <mutex>
+
+using namespace cil2cpp;
+
+// ===== Generated shapes =====
+
+struct TaskOfInt {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_status;
+    Exception* f_exception;
+    intptr_t f_continuations;
+    intptr_t f_lock;
+    Int32 f_result;
+};
+
+struct Builder {
+    TaskOfInt* f_task;
+};
+
+// class <Chain>d__N : IAsyncStateMachine
+struct ChainStateMachine {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_state;
+    Builder f_builder;
+    Int32 f_depth;
+    TaskOfInt* f_gate;
+    TaskOfInt* f_awaiter;
+};
+
+static TypeInfo ChainStateMachine_TypeInfo = {};
+
+// async Task<int> Chain(depth, gate) => depth == 0 ? await gate + 1 : await Chain(depth - 1, gate) + 1;
+
+template <bool Pooled>
+static TaskOfInt* chain(Int32 depth, TaskOfInt* gate);
+
+template <bool Pooled>
+static void chain_move_next(void* state) {
+    auto* sm = static_cast<ChainStateMachine*>(state);
+    if (sm->f_state == -1) {
+        sm->f_awaiter = sm->f_depth == 0 ? sm->f_gate : chain<Pooled>(sm->f_depth - 1, sm->f_gate);
+        if (!task_is_completed(reinterpret_cast<Task*>(sm->f_awaiter))) {
+            sm->f_state = 0;
+            task_builder_get_task(sm->f_builder.f_task);
+            task_add_continuation(reinterpret_cast<Task*>(sm->f_awaiter), chain_move_next<Pooled>, sm);
+            return;
+        }
+    }
+    Int32 result = sm->f_awaiter->f_result + 1;
+    sm->f_state = -2;
+    task_builder_set_result(sm->f_builder.f_task, result);
+    if constexpr (Pooled) async_box_release(sm);
+}
+
+template <bool Pooled>
+static TaskOfInt* chain(Int32 depth, TaskOfInt* gate) {
+    auto* sm = static_cast<ChainStateMachine*>(Pooled
+        ? async_box_acquire(sizeof(ChainStateMachine), &ChainStateMachine_TypeInfo)
+        : gc::alloc(sizeof(ChainStateMachine), &ChainStateMachine_TypeInfo));
+    sm->f_builder = {};
+    sm->f_depth = depth;
+    sm->f_gate = gate;
+    sm->f_state = -1;
+    chain_move_next<Pooled>(sm);
+    auto* task = task_builder_get_task(sm->f_builder.f_task);
+    if constexpr (Pooled) async_box_release(sm);
+    return task;
+}
+
+template <bool Pooled>
+static Int32 run_chain(Int32 depth, Int32 value) {
+    auto* gate = static_cast<TaskOfInt*>(gc::alloc(sizeof(TaskOfInt), nullptr));
+    task_init_pending(reinterpret_cast<Task*>(gate));
+    auto* top = chain<Pooled>(depth - 1, gate);
+    gate->f_result = value;
+    task_complete(reinterpret_cast<Task*>(gate));
+    return top->f_result;
+}
+
+int main() {
+    runtime_init();
+
+    const Int32 depth = 10;
+    const Int32 n = static_cast<Int32>(bench::scaled(200'000));
+    const long long awaits = static_cast<long long>(n) * depth;
+
+    bench::section("Continuation records (await on a pending task)");
+    {
+        const long long m = awaits;
+        auto noop = [](void*) {};
+        Task pending = {};
+        task_init_pending(&pending);
+        std::mutex previous_lock;
+        // task_add_continuation + task_complete as they were, one gc::alloc per node
+        double prev = bench::measure_allocs("gc::alloc per continuation (previous)", m, [&] {
+            for (long long i = 0; i < m; i++) {
+                {
+                    std::lock_guard<std::mutex> lock(previous_lock);
+                    auto* node = static_cast<TaskContinuation*>(gc::alloc(sizeof(TaskContinuation), nullptr));
+                    node->callback = noop;
+                    node->state = &pending;
+                    node->next = pending.f_continuations;
+                    pending.f_continuations = node;
+                }
+                TaskContinuation* conts;
+                {
+                    std::lock_guard<std::mutex> lock(previous_lock);
+                    conts = pending.f_continuations;
+                    pending.f_continuations = nullptr;
+                }
+                for (; conts; conts = conts->next) conts->callback(conts->state);
+            }
+        }).ms;
+        double pooled = bench::measure_allocs("task_add_continuation + complete (pooled)", m, [&] {
+            for (long long i = 0; i < m; i++) {
+                task_add_continuation(&pending, noop, &pending);
+                task_complete(&pending);
+                pending.f_status = 0;  // re-arm the same task
+            }
+        }).ms;
+        bench::ratio("  speedup", prev, pooled);
+    }
+
+    bench::section("Task<int> chain, depth 10, innermost awaits a pending task (per await)");
+    {
+        double gc_boxes = bench::measure_allocs("GC state machine boxes", awaits, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += run_chain<false>(depth, i);
+            bench::do_not_optimize(acc);
+        }).ms;
+        double pooled = bench::measure_allocs("pooled state machine boxes", awaits, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc += run_chain<true>(depth, i);
+            bench::do_not_optimize(acc);
+        }).ms;
+        bench::ratio("  speedup", gc_boxes, pooled);
+    }
+
+    runtime_shutdown();
+    return 0;
+}
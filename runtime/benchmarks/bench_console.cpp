@@ -0,0 +1,56 @@
+/**
+ * CIL2CPP Runtime Benchmarks - System.Console output
+ *
+ * 10M Console.WriteLine(int) calls through the buffered writer, compared
+ * with the previous implementation strategy (printf per call).
+ *
+ * Run with stdout redirected, otherwise the terminal dominates:
+ *   bench_console > /dev/null
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+using namespace cil2cpp;
+using namespace cil2cpp::System;
+
+int main() {
+    runtime_init();
+    const long long n = bench::scaled(10'000'000);
+
+    bench::section("Console.WriteLine(int)");
+    double legacy = bench::measure("printf(\"%d\\n\") per call (old path)", n, [&] {
+        for (long long i = 0; i < n; i++) std::printf("%d\n", static_cast<Int32>(i));
+        std::fflush(stdout);
+    });
+    double block = bench::measure("Console_WriteLine(Int32), Block policy", n, [&] {
+        Console_SetFlushPolicy(ConsoleFlushPolicy::Block);
+        for (long long i = 0; i < n; i++) Console_WriteLine(static_cast<Int32>(i));
+        Console_Flush();
+    });
+    double line = bench::measure("Console_WriteLine(Int32), Line policy", n, [&] {
+        Console_SetFlushPolicy(ConsoleFlushPolicy::Line);
+        for (long long i = 0; i < n; i++) Console_WriteLine(static_cast<Int32>(i));
+        Console_Flush();
+    });
+    bench::ratio("speedup (Block vs printf)", legacy, block);
+    bench::ratio("speedup (Line vs printf)", legacy, line);
+
+    bench::section("Console.WriteLine(string)");
+    String* s = string_create_utf8("2024-01-01T00:00:00Z INFO request handled in 12ms");
+    const long long m = bench::scaled(2'000'000);
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Block);
+    bench::measure("Console_WriteLine(String*), 48 chars", m, [&] {
+        for (long long i = 0; i < m; i++) Console_WriteLine(s);
+        Console_Flush();
+    });
+
+    bench::section("Console.WriteLine(double)");
+    bench::measure("Console_WriteLine(Double)", m, [&] {
+        for (long long i = 0; i < m; i++) Console_WriteLine(static_cast<Double>(i) * 0.25);
+        Console_Flush();
+    });
+
+    runtime_shutdown();
+    return 0;
+}
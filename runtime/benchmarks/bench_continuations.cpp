@@ -0,0 +1,113 @@
+/**
+ * CIL2CPP Runtime Benchmarks - continuation scheduling on long await chains
+ *
+ * A chain of N pending Task<int>s where level i awaits level i-1 (registered
+ * up front, like N async methods each suspended on the previous one). Completing
+ * level 0 resumes them all in sequence. Rows report the time per await from the
+ * first task_complete until the last level completes, the deepest nesting of
+ * inline continuations and the stack that nesting used:
+ *
+ *  - unbounded inline (previous behaviour): every continuation runs inside the
+ *    task_complete that released it, so stack use grows with the chain; measured
+ *    on a shorter chain, since 100k levels would overflow the main stack;
+ *  - depth guard (default limit 64): past the limit the next continuation hops
+ *    to the thread pool and starts again from an empty stack;
+ *  - RunContinuationsAsynchronously: every level is posted to the pool.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <climits>
+#include <vector>
+
+using namespace cil2cpp;
+
+struct TaskOfInt {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_status;
+    Exception* f_exception;
+    intptr_t f_continuations;
+    intptr_t f_lock;
+    Int32 f_result;
+};
+
+struct Level {
+    TaskOfInt* awaited;
+    TaskOfInt* task;
+};
+
+// ===== Stack depth accounting =====
+
+static thread_local Int32 t_nesting = 0;
+static thread_local const char* t_stack_top = nullptr;
+static std::atomic<Int32> g_max_nesting{0};
+static std::atomic<long long> g_max_stack{0};
+
+template <typename T>
+static void update_max(std::atomic<T>& max, T value) {
+    T seen = max.load(std::memory_order_relaxed);
+    while (value > seen && !max.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+}
+
+// MoveNext of level i: result = await level(i-1) + 1
+static void resume_level(void* raw) {
+    char marker;
+    if (t_nesting++ == 0) t_stack_top = &marker;
+    update_max(g_max_nesting, t_nesting);
+    update_max(g_max_stack, static_cast<long long>(t_stack_top - &marker));
+
+    auto* level = static_cast<Level*>(raw);
+    level->task->f_result = level->awaited->f_result + 1;
+    task_complete(reinterpret_cast<Task*>(level->task));
+    t_nesting--;
+}
+
+static void run_chain(const char* name, Int32 length, TaskCreationOptions options) {
+    std::vector<TaskOfInt*> tasks(length + 1);
+    for (auto& t : tasks) {
+        t = static_cast<TaskOfInt*>(gc::alloc(sizeof(TaskOfInt), nullptr));
+        task_init_pending(reinterpret_cast<Task*>(t), options);
+    }
+    std::vector<Level> levels(length);
+    for (Int32 i = 0; i < length; i++) {
+        levels[i] = {tasks[i], tasks[i + 1]};
+        task_add_continuation(reinterpret_cast<Task*>(tasks[i]), resume_level, &levels[i]);
+    }
+
+    g_max_nesting = 0;
+    g_max_stack = 0;
+    bench::measure(name, length, [&] {
+        task_complete(reinterpret_cast<Task*>(tasks[0]));
+        task_wait(reinterpret_cast<Task*>(tasks[length]));
+    });
+    if (tasks[length]->f_result != length) std::abort();
+    std::fprintf(stderr, "  %-44s %10d\n", "  max inline nesting", g_max_nesting.load());
+    std::fprintf(stderr, "  %-44s %10.1f KB\n", "  max stack used by the chain",
+                 static_cast<double>(g_max_stack.load()) / 1024.0);
+}
+
+int main() {
+    runtime_init();
+
+    const Int32 length = static_cast<Int32>(bench::scaled(100'000));
+    const Int32 short_length = length / 10 > 0 ? length / 10 : 1;
+    const Int32 default_limit = task_get_inline_depth_limit();
+
+    bench::section("Await chain, unbounded inline continuations (per await)");
+    task_set_inline_depth_limit(INT_MAX);
+    run_chain("inline, 1/10 length", short_length, TaskCreationOptions::None);
+
+    bench::section("Await chain, depth guard (per await)");
+    task_set_inline_depth_limit(default_limit);
+    run_chain("inline up to the limit, then thread pool", length, TaskCreationOptions::None);
+
+    bench::section("Await chain, RunContinuationsAsynchronously (per await)");
+    run_chain("every continuation on the thread pool", length,
+              TaskCreationOptions::RunContinuationsAsynchronously);
+
+    runtime_shutdown();
+    return 0;
+}
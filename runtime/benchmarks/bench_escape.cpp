@@ -0,0 +1,197 @@
+/**
+ * CIL2CPP Runtime Benchmarks - stack allocation of non-escaping objects
+ *
+ * Small allocation-heavy methods written the way the compiler emits them,
+ * once with every newobj on the GC heap (gc::alloc) and once with the
+ * allocations escape analysis proves method-local constructed in stack storage
+ * (object_init_stack):
+ *
+ *  - SumDots:  two temporary Vec objects per iteration, combined by a
+ *              non-virtual Dot(Vec) call;
+ *  - InRange:  a Range helper object built per lookup and queried twice;
+ *  - Derived:  a two-level constructor chain (Derived : Base) per iteration.
+ *
+ * Every row also prints the GC bytes allocated per operation.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+using namespace cil2cpp;
+
+// ===== Classes, as the generated code declares them =====
+
+struct Vec {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Double f_X;
+    Double f_Y;
+};
+
+struct RangeObj {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_Lo;
+    Int32 f_Hi;
+};
+
+struct Base {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_A;
+};
+
+struct Derived {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_A;
+    Int32 f_B;
+};
+
+static TypeInfo make_type(const char* name, UInt32 size) {
+    TypeInfo t = {};
+    t.name = name;
+    t.namespace_name = "";
+    t.full_name = name;
+    t.instance_size = size;
+    t.flags = TypeFlags::None;
+    return t;
+}
+
+static TypeInfo Vec_TypeInfo = make_type("Vec", sizeof(Vec));
+static TypeInfo RangeObj_TypeInfo = make_type("Range", sizeof(RangeObj));
+static TypeInfo Derived_TypeInfo = make_type("Derived", sizeof(Derived));
+
+static void Vec__ctor(Vec* __this, Double x, Double y) {
+    System_Object__ctor(__this);
+    __this->f_X = x;
+    __this->f_Y = y;
+}
+
+static Double Vec_Dot(Vec* __this, Vec* o) {
+    return __this->f_X * o->f_X + __this->f_Y * o->f_Y;
+}
+
+static void RangeObj__ctor(RangeObj* __this, Int32 lo, Int32 hi) {
+    System_Object__ctor(__this);
+    __this->f_Lo = lo;
+    __this->f_Hi = hi;
+}
+
+static Boolean RangeObj_Contains(RangeObj* __this, Int32 v) {
+    return v >= __this->f_Lo && v < __this->f_Hi;
+}
+
+static void Base__ctor(Base* __this, Int32 a) {
+    System_Object__ctor(__this);
+    __this->f_A = a;
+}
+
+static void Derived__ctor(Derived* __this, Int32 a, Int32 b) {
+    Base__ctor(reinterpret_cast<Base*>(__this), a);
+    __this->f_B = b;
+}
+
+// ===== Method bodies: heap (previous lowering) vs stack storage =====
+
+static Double sum_dots_heap(Int32 n) {
+    Double acc = 0;
+    for (Int32 i = 0; i < n; i++) {
+        auto* a = (Vec*)gc::alloc(sizeof(Vec), &Vec_TypeInfo);
+        Vec__ctor(a, i, 1.0);
+        auto* b = (Vec*)gc::alloc(sizeof(Vec), &Vec_TypeInfo);
+        Vec__ctor(b, 2.0, i);
+        acc += Vec_Dot(a, b);
+    }
+    return acc;
+}
+
+static Double sum_dots_stack(Int32 n) {
+    Vec __stack_obj0;
+    Vec __stack_obj1;
+    Double acc = 0;
+    for (Int32 i = 0; i < n; i++) {
+        auto* a = (Vec*)object_init_stack(&__stack_obj0, sizeof(Vec), &Vec_TypeInfo);
+        Vec__ctor(a, i, 1.0);
+        auto* b = (Vec*)object_init_stack(&__stack_obj1, sizeof(Vec), &Vec_TypeInfo);
+        Vec__ctor(b, 2.0, i);
+        acc += Vec_Dot(a, b);
+    }
+    return acc;
+}
+
+static Boolean in_range_heap(Int32 v, Int32 lo, Int32 hi) {
+    auto* r = (RangeObj*)gc::alloc(sizeof(RangeObj), &RangeObj_TypeInfo);
+    RangeObj__ctor(r, lo, hi);
+    return RangeObj_Contains(r, v) && !RangeObj_Contains(r, v + hi);
+}
+
+static Boolean in_range_stack(Int32 v, Int32 lo, Int32 hi) {
+    RangeObj __stack_obj0;
+    auto* r = (RangeObj*)object_init_stack(&__stack_obj0, sizeof(RangeObj), &RangeObj_TypeInfo);
+    RangeObj__ctor(r, lo, hi);
+    return RangeObj_Contains(r, v) && !RangeObj_Contains(r, v + hi);
+}
+
+static Int32 derived_heap(Int32 a, Int32 b) {
+    auto* d = (Derived*)gc::alloc(sizeof(Derived), &Derived_TypeInfo);
+    Derived__ctor(d, a, b);
+    return d->f_A * 10 + d->f_B;
+}
+
+static Int32 derived_stack(Int32 a, Int32 b) {
+    Derived __stack_obj0;
+    auto* d = (Derived*)object_init_stack(&__stack_obj0, sizeof(Derived), &Derived_TypeInfo);
+    Derived__ctor(d, a, b);
+    return d->f_A * 10 + d->f_B;
+}
+
+int main() {
+    runtime_init();
+
+    const Int32 n = static_cast<Int32>(bench::scaled(10'000'000));
+
+    bench::section("SumDots: 2 x new Vec per iteration + Dot");
+    {
+        double heap = bench::measure_allocs("gc::alloc (previous lowering)", n, [&] {
+            bench::do_not_optimize(sum_dots_heap(n));
+        }).ms;
+        double stack = bench::measure_allocs("stack storage", n, [&] {
+            bench::do_not_optimize(sum_dots_stack(n));
+        }).ms;
+        bench::ratio("  speedup", heap, stack);
+    }
+
+    bench::section("InRange: new Range(lo, hi) per call, two Contains");
+    {
+        double heap = bench::measure_allocs("gc::alloc (previous lowering)", n, [&] {
+            Int32 hits = 0;
+            for (Int32 i = 0; i < n; i++) hits += in_range_heap(i & 1023, 100, 900);
+            bench::do_not_optimize(hits);
+        }).ms;
+        double stack = bench::measure_allocs("stack storage", n, [&] {
+            Int32 hits = 0;
+            for (Int32 i = 0; i < n; i++) hits += in_range_stack(i & 1023, 100, 900);
+            bench::do_not_optimize(hits);
+        }).ms;
+        bench::ratio("  speedup", heap, stack);
+    }
+
+    bench::section("new Derived(a, b) : base(a) per call");
+    {
+        double heap = bench::measure_allocs("gc::alloc (previous lowering)", n, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc ^= derived_heap(i, 7);
+            bench::do_not_optimize(acc);
+        }).ms;
+        double stack = bench::measure_allocs("stack storage", n, [&] {
+            Int32 acc = 0;
+            for (Int32 i = 0; i < n; i++) acc ^= derived_stack(i, 7);
+            bench::do_not_optimize(acc);
+        }).ms;
+        bench::ratio("  speedup", heap, stack);
+    }
+
+    runtime_shutdown();
+    return 0;
+}
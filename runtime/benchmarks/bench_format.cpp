@@ -0,0 +1,209 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Composite and numeric formatting
+ *
+ * Compares the formatting engine against the implementation it replaced:
+ * string_format converting every (boxed) argument to a temporary String and
+ * accumulating into a std::vector<Char>, and primitive ToString() going
+ * through snprintf. The legacy path is given the benefit of formatting boxed
+ * numbers with snprintf (it used to print the type name).
+ *
+ * The last section counts GC bytes per call for small boxed arguments
+ * (counters, flags, separators), with and without the box<T> small-value cache.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace cil2cpp;
+
+static TypeInfo g_int32_type = {};
+static TypeInfo g_double_type = {};
+static TypeInfo g_bool_type = {};
+static TypeInfo g_char_type = {};
+
+static String* legacy_from_int32(Int32 value) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d", value);
+    return string_create_utf8(buf);
+}
+
+static String* legacy_from_double(Double value) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%g", value);
+    return string_create_utf8(buf);
+}
+
+static String* legacy_obj_to_string(Object* obj) {
+    if (!obj) return string_create_utf8("");
+    if (obj->__type_info == &System::String_TypeInfo) return reinterpret_cast<String*>(obj);
+    if (obj->__type_info == &g_int32_type) return legacy_from_int32(unbox<Int32>(obj));
+    if (obj->__type_info == &g_double_type) return legacy_from_double(unbox<Double>(obj));
+    return object_to_string(obj);
+}
+
+// Previous string_format: all arguments to strings first, format specifiers
+// and alignment skipped, result built in a std::vector and copied again.
+static String* legacy_format(String* format, Array* args) {
+    Int32 argCount = args ? args->length : 0;
+    std::vector<String*> argStrings(argCount);
+    for (Int32 i = 0; i < argCount; i++)
+        argStrings[i] = legacy_obj_to_string(static_cast<Object**>(array_data(args))[i]);
+
+    std::vector<Char> result;
+    result.reserve(format->length * 2);
+    for (Int32 i = 0; i < format->length; i++) {
+        Char c = format->chars[i];
+        if (c == '{' && i + 1 < format->length && format->chars[i + 1] == '{') {
+            result.push_back('{');
+            i++;
+            continue;
+        }
+        if (c == '}' && i + 1 < format->length && format->chars[i + 1] == '}') {
+            result.push_back('}');
+            i++;
+            continue;
+        }
+        if (c == '{') {
+            i++;
+            Int32 index = 0;
+            while (i < format->length && format->chars[i] >= '0' && format->chars[i] <= '9') {
+                index = index * 10 + (format->chars[i] - '0');
+                i++;
+            }
+            while (i < format->length && format->chars[i] != '}') i++;
+            if (index >= 0 && index < argCount && argStrings[index]) {
+                String* s = argStrings[index];
+                for (Int32 j = 0; j < s->length; j++) result.push_back(s->chars[j]);
+            }
+        } else {
+            result.push_back(c);
+        }
+    }
+    return string_create_utf16(result.data(), static_cast<Int32>(result.size()));
+}
+
+// What String.Format(fmt, i, j, x, name) compiles to: four boxes + object[].
+static Array* pack_boxed(Int32 i, Int32 j, Double x, String* name) {
+    Array* args = array_create(&System::Object_TypeInfo, 4);
+    auto** items = static_cast<Object**>(array_data(args));
+    items[0] = box<Int32>(i, &g_int32_type);
+    items[1] = box<Int32>(j, &g_int32_type);
+    items[2] = box<Double>(x, &g_double_type);
+    items[3] = reinterpret_cast<Object*>(name);
+    return args;
+}
+
+// Small arguments boxed fresh every time (box_raw never consults the cache),
+// i.e. box<T> before the small-value cache.
+static Array* pack_small_uncached(Int32 i, Boolean ok, Char sep) {
+    Array* args = array_create(&System::Object_TypeInfo, 4);
+    auto** items = static_cast<Object**>(array_data(args));
+    Int32 total = 100;
+    items[0] = box_raw(&i, sizeof(i), &g_int32_type);
+    items[1] = box_raw(&total, sizeof(total), &g_int32_type);
+    items[2] = box_raw(&ok, sizeof(ok), &g_bool_type);
+    items[3] = box_raw(&sep, sizeof(sep), &g_char_type);
+    return args;
+}
+
+static Array* pack_small_cached(Int32 i, Boolean ok, Char sep) {
+    Array* args = array_create(&System::Object_TypeInfo, 4);
+    auto** items = static_cast<Object**>(array_data(args));
+    items[0] = box<Int32>(i, &g_int32_type);
+    items[1] = box<Int32>(100, &g_int32_type);
+    items[2] = box<Boolean>(ok, &g_bool_type);
+    items[3] = box<Char>(sep, &g_char_type);
+    return args;
+}
+
+int main() {
+    runtime_init();
+
+    g_int32_type.name = "Int32";
+    g_int32_type.namespace_name = "System";
+    g_int32_type.full_name = "System.Int32";
+    g_int32_type.flags = TypeFlags::ValueType | TypeFlags::Primitive;
+    g_double_type = g_int32_type;
+    g_double_type.name = "Double";
+    g_double_type.full_name = "System.Double";
+    g_bool_type = g_int32_type;
+    g_bool_type.name = "Boolean";
+    g_bool_type.full_name = "System.Boolean";
+    g_char_type = g_int32_type;
+    g_char_type.name = "Char";
+    g_char_type.full_name = "System.Char";
+
+    String* name = string_literal("widget");
+    String* fmt = string_literal("Item {0}: {1} x {2} = {3}");
+    String* fmt_spec = string_literal("Item {0,6}: {1:D4} x {2:F2} = {3,-8}|");
+    const long long ops = bench::scaled(1'000'000);
+
+    bench::section("String.Format(\"Item {0}: {1} x {2} = {3}\", int, int, double, string)");
+    double legacy_ms = bench::measure_best("previous (boxed, ToString per arg, vector)", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) {
+            Int32 i = static_cast<Int32>(k);
+            bench::do_not_optimize(legacy_format(fmt, pack_boxed(i, i * 3, i * 0.25, name)));
+        }
+    });
+    double boxed_ms = bench::measure_best("engine, boxed object[]", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) {
+            Int32 i = static_cast<Int32>(k);
+            bench::do_not_optimize(string_format(fmt, pack_boxed(i, i * 3, i * 0.25, name)));
+        }
+    });
+    double unboxed_ms = bench::measure_best("engine, unboxed FormatArg[]", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) {
+            Int32 i = static_cast<Int32>(k);
+            FormatArg args[] = {FormatArg(i), FormatArg(i * 3), FormatArg(i * 0.25), FormatArg(name)};
+            bench::do_not_optimize(string_format(fmt, args, 4));
+        }
+    });
+    bench::ratio("  speedup (boxed)", legacy_ms, boxed_ms);
+    bench::ratio("  speedup (unboxed)", legacy_ms, unboxed_ms);
+
+    bench::section("Same with alignment and format specifiers (previous: ignored)");
+    bench::measure_best("engine, unboxed FormatArg[]", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) {
+            Int32 i = static_cast<Int32>(k);
+            FormatArg args[] = {FormatArg(i), FormatArg(i * 3), FormatArg(i * 0.25), FormatArg(name)};
+            bench::do_not_optimize(string_format(fmt_spec, args, 4));
+        }
+    });
+
+    bench::section("Int32.ToString()");
+    double legacy_int = bench::measure_best("snprintf(\"%d\")", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) bench::do_not_optimize(legacy_from_int32(static_cast<Int32>(k * 7919)));
+    });
+    double new_int = bench::measure_best("digit pairs", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) bench::do_not_optimize(string_from_int32(static_cast<Int32>(k * 7919)));
+    });
+    bench::ratio("  speedup", legacy_int, new_int);
+
+    bench::section("Double.ToString()");
+    double legacy_dbl = bench::measure_best("snprintf(\"%g\") (6 digits, lossy)", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) bench::do_not_optimize(legacy_from_double(k * 1.0001));
+    });
+    double new_dbl = bench::measure_best("shortest round-trip", ops, 3, [&] {
+        for (long long k = 0; k < ops; k++) bench::do_not_optimize(string_from_double(k * 1.0001));
+    });
+    bench::ratio("  speedup", legacy_dbl, new_dbl);
+
+    String* fmt_small = string_literal("{0}/{1} done={2}{3}");
+    bench::section("String.Format(\"{0}/{1} done={2}{3}\", 0..99, 100, bool, char)");
+    double uncached_bytes = bench::measure_allocs("fresh box per argument (4 boxes)", ops, [&] {
+        for (long long k = 0; k < ops; k++)
+            bench::do_not_optimize(string_format(fmt_small, pack_small_uncached(static_cast<Int32>(k % 100), (k & 1) != 0, u';')));
+    }).gc_bytes;
+    double cached_bytes = bench::measure_allocs("box<T> small-value cache (0 boxes)", ops, [&] {
+        for (long long k = 0; k < ops; k++)
+            bench::do_not_optimize(string_format(fmt_small, pack_small_cached(static_cast<Int32>(k % 100), (k & 1) != 0, u';')));
+    }).gc_bytes;
+    std::fprintf(stderr, "  %-44s %10.2f B/op\n", "  saved", uncached_bytes - cached_bytes);
+
+    runtime_shutdown();
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * CIL2CPP Runtime Benchmarks - GC instrumentation overhead
+ *
+ * What the statistics cost on the paths they touch:
+ *
+ *  - allocation: gc::alloc (per-thread byte counter) against the previous
+ *    uninstrumented alloc, reproduced here as a noinline function over
+ *    GC_MALLOC; small objects, where a fixed per-call cost shows most;
+ *  - collection: GC_gcollect with the pause-recording event callback
+ *    installed against the same collections with no callback;
+ *  - reading: gc::get_stats and the GC.* icalls, per call.
+ *
+ * Ends by printing the pause histogram the run produced.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <gc.h>
+
+using namespace cil2cpp;
+
+static TypeInfo SmallType = {
+    .name = "Small",
+    .namespace_name = "Bench",
+    .full_name = "Bench.Small",
+    .instance_size = sizeof(Object) + 2 * sizeof(Int64),
+};
+
+// ===== Previous uninstrumented implementation =====
+
+namespace legacy {
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+BENCH_NOINLINE void* alloc(size_t size, TypeInfo* type) {
+    void* memory = GC_MALLOC(size);
+    if (!memory) return nullptr;
+    Object* obj = static_cast<Object*>(memory);
+    obj->__type_info = type;
+    obj->__sync_block = 0;
+    if (type && type->finalizer) std::abort();  // not exercised here
+    return memory;
+}
+
+} // namespace legacy
+
+static double overhead_percent(double baseline_ms, double new_ms) {
+    return baseline_ms > 0 ? (new_ms - baseline_ms) * 100.0 / baseline_ms : 0.0;
+}
+
+int main() {
+    runtime_init();
+
+    bench::section("Small-object allocation (per op)");
+    {
+        const long long n = bench::scaled(500'000);
+        const size_t size = SmallType.instance_size;
+        // Many short interleaved rounds, best of each: heap growth and
+        // collections hit both variants alike, and the difference being
+        // measured is far below run-to-run noise of a single long run
+        double prev = 0, now = 0;
+        auto run_legacy = [&] {
+            bench::Stopwatch sw;
+            for (long long i = 0; i < n; i++) bench::do_not_optimize(legacy::alloc(size, &SmallType));
+            double ms = sw.elapsed_ms();
+            if (prev == 0 || ms < prev) prev = ms;
+        };
+        auto run_counted = [&] {
+            bench::Stopwatch sw;
+            for (long long i = 0; i < n; i++) bench::do_not_optimize(gc::alloc(size, &SmallType));
+            double ms = sw.elapsed_ms();
+            if (now == 0 || ms < now) now = ms;
+        };
+        for (int round = 0; round < 21; round++) {
+            // Alternate which variant goes first
+            if (round & 1) { run_counted(); run_legacy(); }
+            else { run_legacy(); run_counted(); }
+        }
+        std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f ns/op\n", "alloc, uninstrumented", prev, prev * 1e6 / n);
+        std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f ns/op\n", "alloc, per-thread byte counter", now, now * 1e6 / n);
+        std::fprintf(stderr, "  %-44s %+10.2f %%\n", "  overhead", overhead_percent(prev, now));
+    }
+
+    bench::section("Full collection (per collection)");
+    {
+        // Keep a modest live set so each collection has marking to do
+        const int live_count = 20000;
+        auto** live = static_cast<Object**>(gc::alloc_uncollectable(live_count * sizeof(Object*)));
+        for (int i = 0; i < live_count; i++) live[i] = static_cast<Object*>(gc::alloc(SmallType.instance_size, &SmallType));
+
+        const long long n = bench::scaled(200);
+        GC_on_collection_event_proc recorder = GC_get_on_collection_event();
+        double prev = 0, now = 0;
+        for (int round = 0; round < 3; round++) {
+            GC_set_on_collection_event(nullptr);
+            bench::Stopwatch a;
+            for (long long i = 0; i < n; i++) GC_gcollect();
+            double ms = a.elapsed_ms();
+            if (round == 0 || ms < prev) prev = ms;
+
+            GC_set_on_collection_event(recorder);
+            bench::Stopwatch b;
+            for (long long i = 0; i < n; i++) GC_gcollect();
+            ms = b.elapsed_ms();
+            if (round == 0 || ms < now) now = ms;
+        }
+        std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f us/op\n", "GC_gcollect, no event callback", prev, prev * 1e3 / n);
+        std::fprintf(stderr, "  %-44s %10.2f ms  %9.2f us/op\n", "GC_gcollect, pause recording", now, now * 1e3 / n);
+        std::fprintf(stderr, "  %-44s %+10.2f %%\n", "  overhead", overhead_percent(prev, now));
+        gc::free_uncollectable(live);
+    }
+
+    bench::section("Reading the counters (per call)");
+    {
+        const long long n = bench::scaled(1'000'000);
+        bench::measure_best("gc::get_stats", n, 3, [&] {
+            size_t acc = 0;
+            for (long long i = 0; i < n; i++) acc += gc::get_stats().pause_count;
+            bench::do_not_optimize(acc);
+        });
+        bench::measure_best("GC.GetAllocatedBytesForCurrentThread", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc += icall::GC_GetAllocatedBytesForCurrentThread();
+            bench::do_not_optimize(acc);
+        });
+        bench::measure_best("GC.CollectionCount(0)", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc += icall::GC_CollectionCount(0);
+            bench::do_not_optimize(acc);
+        });
+    }
+
+    bench::section("Pause histogram for this run");
+    {
+        auto stats = gc::get_stats();
+        std::fprintf(stderr, "  collections %zu, pauses %zu, total %.2f ms, max %.3f ms\n",
+                     stats.collection_count, stats.pause_count,
+                     stats.total_pause_time_ms, stats.max_pause_time_ms);
+        for (int i = 0; i < gc::kPauseHistogramBuckets; i++) {
+            if (stats.pause_histogram[i] == 0) continue;
+            if (i == gc::kPauseHistogramBuckets - 1)
+                std::fprintf(stderr, "  >= %6llu us  %zu\n",
+                             static_cast<unsigned long long>(gc::pause_bucket_limit_us(i - 1)), stats.pause_histogram[i]);
+            else
+                std::fprintf(stderr, "  <  %6llu us  %zu\n",
+                             static_cast<unsigned long long>(gc::pause_bucket_limit_us(i)), stats.pause_histogram[i]);
+        }
+    }
+
+    runtime_shutdown();
+    return 0;
+}
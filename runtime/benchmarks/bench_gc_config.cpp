@@ -0,0 +1,184 @@
+/**
+ * CIL2CPP Runtime Benchmarks - GC tuning matrix
+ *
+ * One service-like workload run under each GCConfig setting: a steady live
+ * set of small objects held in a table, where every operation allocates a
+ * replacement for a random slot plus some short-lived garbage. Per setting:
+ * throughput (allocations per second), collections, p50 / p99 / max
+ * stop-the-world pause and the final heap size.
+ *
+ * Marker threads and incremental mode can only be set once per process, so
+ * the driver re-runs this executable once per row (`bench_gc_config --run N`).
+ * CIL2CPP_GC_* environment variables apply on top of every row.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <gc.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+struct Setting {
+    const char* name;
+    gc::GCConfig config;
+};
+
+static std::vector<Setting> settings() {
+    std::vector<Setting> rows;
+    gc::GCConfig c;
+    rows.push_back({"default (incremental)", c});
+
+    c = {};
+    c.incremental = false;
+    rows.push_back({"stop-the-world (incremental=false)", c});
+
+    c = {};
+    c.full_collection_frequency = 4;
+    rows.push_back({"incremental, full-frequency=4", c});
+
+    c = {};
+    c.parallel_markers = 1;
+    rows.push_back({"serial marking (markers=1)", c});
+
+    c = {};
+    c.free_space_divisor = 1;
+    rows.push_back({"free-space-divisor=1 (grow eagerly)", c});
+
+    c = {};
+    c.free_space_divisor = 8;
+    rows.push_back({"free-space-divisor=8 (collect eagerly)", c});
+
+    c = {};
+    c.initial_heap_size = size_t{256} << 20;
+    rows.push_back({"initial-heap=256M", c});
+
+    c = {};
+    c.max_heap_size = size_t{96} << 20;
+    rows.push_back({"max-heap=96M", c});
+    return rows;
+}
+
+// ===== Pause samples =====
+// Recorded the same way as gc.cpp's histogram (stop-the-world windows,
+// START..END when the world is never stopped), but kept individually so
+// the percentiles are exact. The collector calls this under its lock.
+
+static constexpr size_t kMaxPauses = 1 << 16;
+static UInt64 g_pauses_ns[kMaxPauses];
+static std::atomic<size_t> g_pause_count{0};
+static GC_on_collection_event_proc g_runtime_callback = nullptr;
+static std::chrono::steady_clock::time_point g_cycle_start, g_stop_start;
+static bool g_stopped_this_cycle = false;
+
+static void add_pause(std::chrono::steady_clock::duration d) {
+    size_t i = g_pause_count.load(std::memory_order_relaxed);
+    if (i < kMaxPauses) {
+        g_pauses_ns[i] = static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+        g_pause_count.store(i + 1, std::memory_order_relaxed);
+    }
+}
+
+static void on_collection_event(GC_EventType event) {
+    auto now = std::chrono::steady_clock::now();
+    switch (event) {
+    case GC_EVENT_START: g_cycle_start = now; g_stopped_this_cycle = false; break;
+    case GC_EVENT_PRE_STOP_WORLD: g_stop_start = now; break;
+    case GC_EVENT_POST_START_WORLD: add_pause(now - g_stop_start); g_stopped_this_cycle = true; break;
+    case GC_EVENT_END: if (!g_stopped_this_cycle) add_pause(now - g_cycle_start); break;
+    default: break;
+    }
+    if (g_runtime_callback) g_runtime_callback(event);
+}
+
+static double percentile_ms(std::vector<UInt64>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t i = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+    return static_cast<double>(sorted[i]) / 1e6;
+}
+
+// ===== Workload =====
+
+struct Node : Object {
+    Node* next;
+    Object* payload;
+};
+
+static TypeInfo NodeType = {
+    .name = "Node",
+    .namespace_name = "Bench",
+    .full_name = "Bench.Node",
+    .instance_size = sizeof(Node),
+};
+
+static int run(const Setting& setting) {
+    runtime_init(setting.config);
+    g_runtime_callback = GC_get_on_collection_event();
+    GC_set_on_collection_event(on_collection_event);
+
+    const size_t live_slots = 100'000;
+    const long long ops = bench::scaled(4'000'000);
+    auto** table = static_cast<Node**>(gc::alloc_uncollectable(live_slots * sizeof(Node*)));
+    UInt64 rng = 0x9E3779B97F4A7C15ull;
+    auto next_random = [&] {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        return rng;
+    };
+
+    size_t collections_before = gc::collection_count();
+    bench::Stopwatch sw;
+    for (long long i = 0; i < ops; i++) {
+        UInt64 r = next_random();
+        auto* node = static_cast<Node*>(gc::alloc(NodeType.instance_size, &NodeType));
+        // Payload of 16..256 bytes, most of it garbage once the slot is replaced
+        node->payload = static_cast<Object*>(gc::alloc(sizeof(Object) + 16 + (r & 0xF0), &NodeType));
+        Node*& slot = table[(r >> 16) % live_slots];
+        node->next = (r & 0x700) == 0 ? slot : nullptr;  // some short chains survive longer
+        slot = node;
+        if ((r & 0x3) == 0) bench::do_not_optimize(gc::alloc(48, &NodeType));  // short-lived temporary
+    }
+    double ms = sw.elapsed_ms();
+
+    auto stats = gc::get_stats();
+    std::vector<UInt64> pauses(g_pauses_ns, g_pauses_ns + std::min(g_pause_count.load(), kMaxPauses));
+    std::sort(pauses.begin(), pauses.end());
+    double mops = static_cast<double>(ops) * 2 / (ms * 1e3);  // node + payload per op
+    std::fprintf(stderr, "  %-40s %8.2f %7zu %9.3f %9.3f %9.3f %8.1f\n",
+                 setting.name, mops, stats.collection_count - collections_before,
+                 percentile_ms(pauses, 0.50), percentile_ms(pauses, 0.99),
+                 pauses.empty() ? 0.0 : static_cast<double>(pauses.back()) / 1e6,
+                 static_cast<double>(stats.current_heap_size) / (1 << 20));
+
+    gc::free_uncollectable(table);
+    runtime_shutdown();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    auto rows = settings();
+    if (argc == 3 && std::string(argv[1]) == "--run") {
+        size_t index = static_cast<size_t>(std::atoi(argv[2]));
+        return index < rows.size() ? run(rows[index]) : 1;
+    }
+
+    char title[96];
+    std::snprintf(title, sizeof(title), "GC settings (%lld ops, 100k live slots; pauses in ms)",
+                  bench::scaled(4'000'000));
+    bench::section(title);
+    std::fprintf(stderr, "  %-40s %8s %7s %9s %9s %9s %8s\n",
+                 "setting", "M alloc/s", "GCs", "p50", "p99", "max", "heap MB");
+    for (size_t i = 0; i < rows.size(); i++) {
+        std::string command = "\"" + std::string(argv[0]) + "\" --run " + std::to_string(i);
+        if (std::system(command.c_str()) != 0)
+            std::fprintf(stderr, "  %-40s failed\n", rows[i].name);
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * CIL2CPP Runtime Benchmarks - IR inlining of property accessors
+ *
+ * A particle integration step written against auto-properties and a static
+ * property whose class has a static constructor:
+ *
+ *     p.VY = p.VY + Physics.Gravity * dt;
+ *     p.X  = p.X + p.VX * dt;
+ *     p.Y  = p.Y + p.VY * dt;
+ *
+ *  - calls:   every accessor is a call, and the static getter runs its cctor
+ *             guard on every read (previous lowering, as it stays once the
+ *             translation unit is past the C++ inliner's growth limits or the
+ *             accessor lives in another translation unit);
+ *  - inlined: the body MethodInliner produces — plain field loads/stores and
+ *             one cctor guard per straight-line stretch.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <vector>
+
+using namespace cil2cpp;
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+// ===== Generated declarations =====
+
+struct Particle {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Double f__X_k__BackingField;
+    Double f__Y_k__BackingField;
+    Double f__VX_k__BackingField;
+    Double f__VY_k__BackingField;
+};
+
+struct Physics_Statics {
+    Double f__Gravity_k__BackingField;
+};
+static Physics_Statics Physics_statics;
+
+static bool Physics_cctor_called = false;
+BENCH_NOINLINE static void Physics__cctor() { Physics_statics.f__Gravity_k__BackingField = -9.81; }
+BENCH_NOINLINE static void Physics_ensure_cctor() {
+    if (!Physics_cctor_called) {
+        Physics_cctor_called = true;
+        Physics__cctor();
+    }
+}
+
+BENCH_NOINLINE static Double Particle_get_X(Particle* __this) { return __this->f__X_k__BackingField; }
+BENCH_NOINLINE static void Particle_set_X(Particle* __this, Double value) { __this->f__X_k__BackingField = value; }
+BENCH_NOINLINE static Double Particle_get_Y(Particle* __this) { return __this->f__Y_k__BackingField; }
+BENCH_NOINLINE static void Particle_set_Y(Particle* __this, Double value) { __this->f__Y_k__BackingField = value; }
+BENCH_NOINLINE static Double Particle_get_VX(Particle* __this) { return __this->f__VX_k__BackingField; }
+BENCH_NOINLINE static Double Particle_get_VY(Particle* __this) { return __this->f__VY_k__BackingField; }
+BENCH_NOINLINE static void Particle_set_VY(Particle* __this, Double value) { __this->f__VY_k__BackingField = value; }
+BENCH_NOINLINE static Double Physics_get_Gravity() {
+    Physics_ensure_cctor();
+    return Physics_statics.f__Gravity_k__BackingField;
+}
+
+// ===== Step(Particle p, double dt) =====
+
+static void step_calls(Particle* p, Double dt) {
+    auto __t0 = Particle_get_VY(p);
+    auto __t1 = Physics_get_Gravity();
+    Particle_set_VY(p, __t0 + __t1 * dt);
+    auto __t2 = Particle_get_X(p);
+    auto __t3 = Particle_get_VX(p);
+    Particle_set_X(p, __t2 + __t3 * dt);
+    auto __t4 = Particle_get_Y(p);
+    auto __t5 = Particle_get_VY(p);
+    Particle_set_Y(p, __t4 + __t5 * dt);
+}
+
+static void step_inlined(Particle* p, Double dt) {
+    auto __t6 = ((Particle*)(p))->f__VY_k__BackingField;
+    Physics_ensure_cctor();
+    auto __t7 = Physics_statics.f__Gravity_k__BackingField;
+    ((Particle*)(p))->f__VY_k__BackingField = (Double)(__t6 + __t7 * dt);
+    auto __t8 = ((Particle*)(p))->f__X_k__BackingField;
+    auto __t9 = ((Particle*)(p))->f__VX_k__BackingField;
+    ((Particle*)(p))->f__X_k__BackingField = (Double)(__t8 + __t9 * dt);
+    auto __t10 = ((Particle*)(p))->f__Y_k__BackingField;
+    auto __t11 = ((Particle*)(p))->f__VY_k__BackingField;
+    ((Particle*)(p))->f__Y_k__BackingField = (Double)(__t10 + __t11 * dt);
+}
+
+int main() {
+    runtime_init();
+
+    static TypeInfo particle_type = {};
+    particle_type.name = "Particle";
+    particle_type.full_name = "Particle";
+    particle_type.instance_size = sizeof(Particle);
+
+    const Int32 count = 4096;
+    std::vector<Particle*> particles(count);
+    for (Int32 i = 0; i < count; i++) {
+        particles[i] = static_cast<Particle*>(gc::alloc(sizeof(Particle), &particle_type));
+        particles[i]->f__VX_k__BackingField = 1.0 + i * 0.001;
+    }
+
+    const Int64 rounds = bench::scaled(5'000);
+    const long long ops = rounds * count;
+    const Double dt = 0.001;
+
+    bench::section("Particle step: 7 accessor calls + static getter (4096 particles)");
+    double calls = bench::measure_best("accessor calls + cctor guard per read", ops, 3, [&] {
+        for (Int64 r = 0; r < rounds; r++)
+            for (Particle* p : particles) step_calls(p, dt);
+        bench::do_not_optimize(particles[0]->f__Y_k__BackingField);
+    });
+    double inlined = bench::measure_best("inlined by MethodInliner", ops, 3, [&] {
+        for (Int64 r = 0; r < rounds; r++)
+            for (Particle* p : particles) step_inlined(p, dt);
+        bench::do_not_optimize(particles[0]->f__Y_k__BackingField);
+    });
+    bench::ratio("  speedup", calls, inlined);
+
+    runtime_shutdown();
+    return 0;
+}
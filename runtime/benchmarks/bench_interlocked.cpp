@@ -0,0 +1,149 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Interlocked counters
+ *
+ * The inline std::atomic_ref operations generated code now calls against
+ * the previous implementation: an out-of-line function per operation over
+ * the legacy __sync builtins (reproduced here as noinline functions, since
+ * interlocked.cpp is gone).
+ *
+ *  - one thread: Increment, Add and a CompareExchange max-update loop, per op;
+ *  - N threads hammering one shared counter (contended), per op;
+ *  - N threads each on their own cache line (uncontended), per op.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using namespace cil2cpp;
+
+// ===== Previous out-of-line implementation =====
+
+namespace legacy {
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+#if defined(_MSC_VER)
+BENCH_NOINLINE Int64 increment_i64(Int64* location) { return _InterlockedIncrement64(location); }
+BENCH_NOINLINE Int64 add_i64(Int64* location, Int64 value) { return _InterlockedExchangeAdd64(location, value) + value; }
+BENCH_NOINLINE Int64 compare_exchange_i64(Int64* location, Int64 value, Int64 comparand) {
+    return _InterlockedCompareExchange64(location, value, comparand);
+}
+#else
+BENCH_NOINLINE Int64 increment_i64(Int64* location) { return __sync_add_and_fetch(location, static_cast<Int64>(1)); }
+BENCH_NOINLINE Int64 add_i64(Int64* location, Int64 value) { return __sync_add_and_fetch(location, value); }
+BENCH_NOINLINE Int64 compare_exchange_i64(Int64* location, Int64 value, Int64 comparand) {
+    return __sync_val_compare_and_swap(location, comparand, value);
+}
+#endif
+
+} // namespace legacy
+
+struct alignas(64) PaddedCounter {
+    Int64 value = 0;
+};
+
+template <typename Body>
+static double on_threads(const char* name, int threads, long long per_thread, Body body) {
+    return bench::measure(name, per_thread * threads, [&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++)
+            workers.emplace_back([&, t] { body(t, per_thread); });
+        for (auto& w : workers) w.join();
+    });
+}
+
+// Interlocked max-update: the usual CompareExchange retry loop
+template <typename Cas>
+static void update_max(Int64* location, Int64 candidate, Cas cas) {
+    Int64 seen = *location;
+    while (candidate > seen) {
+        Int64 prev = cas(location, candidate, seen);
+        if (prev == seen) return;
+        seen = prev;
+    }
+}
+
+int main() {
+    const int threads = static_cast<int>(std::max(2u, std::min(8u, std::thread::hardware_concurrency())));
+
+    bench::section("One thread (per op)");
+    {
+        const long long n = bench::scaled(20'000'000);
+        Int64 counter = 0;
+        double prev = bench::measure_best("Increment, out-of-line __sync", n, 3, [&] {
+            for (long long i = 0; i < n; i++) legacy::increment_i64(&counter);
+        });
+        double now = bench::measure_best("Increment, inline atomic_ref", n, 3, [&] {
+            for (long long i = 0; i < n; i++) interlocked::increment(&counter);
+        });
+        bench::ratio("  speedup", prev, now);
+
+        prev = bench::measure_best("Add (result used), out-of-line __sync", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc ^= legacy::add_i64(&counter, i & 7);
+            bench::do_not_optimize(acc);
+        });
+        now = bench::measure_best("Add (result used), inline atomic_ref", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc ^= interlocked::add<Int64>(&counter, i & 7);
+            bench::do_not_optimize(acc);
+        });
+        bench::ratio("  speedup", prev, now);
+
+        Int64 max = 0;
+        prev = bench::measure_best("CompareExchange max, out-of-line __sync", n, 3, [&] {
+            max = 0;
+            for (long long i = 0; i < n; i++) update_max(&max, i, legacy::compare_exchange_i64);
+        });
+        now = bench::measure_best("CompareExchange max, inline atomic_ref", n, 3, [&] {
+            max = 0;
+            for (long long i = 0; i < n; i++)
+                update_max(&max, i, [](Int64* l, Int64 v, Int64 c) { return interlocked::compare_exchange(l, v, c); });
+        });
+        bench::ratio("  speedup", prev, now);
+    }
+
+    char title[96];
+    std::snprintf(title, sizeof(title), "%d threads, one shared counter (per op)", threads);
+    bench::section(title);
+    {
+        const long long per_thread = bench::scaled(20'000'000) / threads;
+        Int64 counter = 0;
+        double prev = on_threads("Increment, out-of-line __sync", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) legacy::increment_i64(&counter);
+        });
+        double now = on_threads("Increment, inline atomic_ref", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) interlocked::increment(&counter);
+        });
+        bench::ratio("  speedup", prev, now);
+        if (counter != 2 * per_thread * threads) std::abort();
+    }
+
+    std::snprintf(title, sizeof(title), "%d threads, one counter per cache line (per op)", threads);
+    bench::section(title);
+    {
+        const long long per_thread = bench::scaled(20'000'000) / threads;
+        std::vector<PaddedCounter> counters(threads);
+        double prev = on_threads("Increment, out-of-line __sync", threads, per_thread, [&](int t, long long n) {
+            for (long long i = 0; i < n; i++) legacy::increment_i64(&counters[t].value);
+        });
+        double now = on_threads("Increment, inline atomic_ref", threads, per_thread, [&](int t, long long n) {
+            for (long long i = 0; i < n; i++) interlocked::increment(&counters[t].value);
+        });
+        bench::ratio("  speedup", prev, now);
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * CIL2CPP Runtime Benchmarks - LINQ operator chains
+ *
+ * Typical 3-5 operator chains, each written the way the compiler emits it:
+ *  - previous: every operator runs on its own over an array and materializes
+ *    its result (Where evaluated the predicate in a counting pass and again in
+ *    a copying pass), lambdas called through Delegate::method_ptr;
+ *  - fused: one linq_for_each loop over the source, delegates still called
+ *    through method_ptr (lambdas the compiler cannot resolve);
+ *  - fused, direct: the same loop with the lambda bodies called directly, as
+ *    for lambdas created in the calling method.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+using namespace cil2cpp;
+
+// ===== Lambdas, compiled as instance methods of the <>c singleton =====
+
+static Boolean is_even(Object*, Int32 x) { return (x & 1) == 0; }
+static Int32 times_three(Object*, Int32 x) { return x * 3; }
+static Boolean not_multiple_of_five(Object*, Int32 x) { return x % 5 != 0; }
+static Int32 plus_one(Object*, Int32 x) { return x + 1; }
+
+static TypeInfo make_type(const char* name, const char* full_name, UInt32 size, TypeFlags flags) {
+    TypeInfo t = {};
+    t.name = name;
+    t.namespace_name = "System";
+    t.full_name = full_name;
+    t.instance_size = size;
+    t.element_size = size;
+    t.flags = flags;
+    return t;
+}
+
+static TypeInfo int_type = make_type("Int32", "System.Int32", sizeof(Int32),
+                                     TypeFlags::ValueType | TypeFlags::Primitive);
+static TypeInfo list_type = make_type("List_Int32", "System.Collections.Generic.List`1<System.Int32>",
+                                      sizeof(ListBase), TypeFlags::None);
+static TypeInfo func_type = make_type("Func_2", "System.Func`2", sizeof(Delegate), TypeFlags::None);
+static TypeInfo host_type = make_type("__c", "Bench.<>c", sizeof(Object), TypeFlags::None);
+
+template<typename R>
+static inline R invoke(Delegate* d, Int32 arg) {
+    if (d->target) return reinterpret_cast<R (*)(Object*, Int32)>(d->method_ptr)(d->target, arg);
+    return reinterpret_cast<R (*)(Int32)>(d->method_ptr)(arg);
+}
+
+// ===== Previous code shape: one materialized array per operator =====
+
+static Array* eager_where(Array* src, Delegate* pred) {
+    const Int32* data = static_cast<const Int32*>(array_data(src));
+    Int32 count = 0;
+    for (Int32 i = 0; i < src->length; i++)
+        if (invoke<Boolean>(pred, data[i])) count++;
+    Array* result = array_create(src->element_type, count);
+    Int32* out = static_cast<Int32*>(array_data(result));
+    Int32 w = 0;
+    for (Int32 i = 0; i < src->length; i++)
+        if (invoke<Boolean>(pred, data[i])) out[w++] = data[i];
+    return result;
+}
+
+static Array* eager_select(Array* src, Delegate* sel) {
+    const Int32* data = static_cast<const Int32*>(array_data(src));
+    Array* result = array_create(src->element_type, src->length);
+    Int32* out = static_cast<Int32*>(array_data(result));
+    for (Int32 i = 0; i < src->length; i++) out[i] = invoke<Int32>(sel, data[i]);
+    return result;
+}
+
+static Int32 eager_sum(Array* src) {
+    const Int32* data = static_cast<const Int32*>(array_data(src));
+    Int32 s = 0;
+    for (Int32 i = 0; i < src->length; i++) s += data[i];
+    return s;
+}
+
+int main() {
+    runtime_init();
+
+    const Int32 n = 4096;
+    const long long reps = bench::scaled(2000);
+    const long long ops = reps * n;
+
+    Array* arr = array_create(&int_type, n);
+    auto* list = static_cast<ListBase*>(list_create(&list_type, &int_type, n));
+    for (Int32 i = 0; i < n; i++) {
+        array_set<Int32>(arr, i, i);
+        list_add(list, &i);
+    }
+
+    Object* host = object_alloc(&host_type);
+    Delegate* even = delegate_create(&func_type, host, reinterpret_cast<void*>(&is_even));
+    Delegate* triple = delegate_create(&func_type, host, reinterpret_cast<void*>(&times_three));
+    Delegate* not5 = delegate_create(&func_type, host, reinterpret_cast<void*>(&not_multiple_of_five));
+    Delegate* inc = delegate_create(&func_type, host, reinterpret_cast<void*>(&plus_one));
+
+    // --- 3 operators: xs.Where(even).Select(triple).Sum() ---
+    bench::section("int[]: Where -> Select -> Sum");
+    double eager3 = bench::measure_best("previous (array per operator)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++)
+            bench::do_not_optimize(eager_sum(eager_select(eager_where(arr, even), triple)));
+    });
+    double fused3 = bench::measure_best("fused", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            linq_for_each<Int32>(arr, &list_type, nullptr, [&](Int32 e0) -> bool {
+                if (!invoke<Boolean>(even, e0)) return true;
+                s += invoke<Int32>(triple, e0);
+                return true;
+            });
+            bench::do_not_optimize(s);
+        }
+    });
+    double direct3 = bench::measure_best("fused, direct", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            linq_for_each<Int32>(arr, &list_type, nullptr, [&](Int32 e0) -> bool {
+                if (!is_even(even->target, e0)) return true;
+                s += times_three(triple->target, e0);
+                return true;
+            });
+            bench::do_not_optimize(s);
+        }
+    });
+    bench::ratio("  speedup (fused)", eager3, fused3);
+    bench::ratio("  speedup (fused, direct)", eager3, direct3);
+
+    // --- 4 operators: xs.Where(even).Select(triple).Where(not5).Count() ---
+    bench::section("int[]: Where -> Select -> Where -> Count");
+    double eager4 = bench::measure_best("previous (array per operator)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++)
+            bench::do_not_optimize(eager_where(eager_select(eager_where(arr, even), triple), not5)->length);
+    });
+    double direct4 = bench::measure_best("fused, direct", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 c = 0;
+            linq_for_each<Int32>(arr, &list_type, nullptr, [&](Int32 e0) -> bool {
+                if (!is_even(even->target, e0)) return true;
+                Int32 e1 = times_three(triple->target, e0);
+                if (!not_multiple_of_five(not5->target, e1)) return true;
+                c++;
+                return true;
+            });
+            bench::do_not_optimize(c);
+        }
+    });
+    bench::ratio("  speedup (fused, direct)", eager4, direct4);
+
+    // --- 5 operators: xs.Select(inc).Where(even).Select(triple).Where(not5).ToArray() ---
+    bench::section("int[]: Select -> Where -> Select -> Where -> ToArray");
+    double eager5 = bench::measure_best("previous (array per operator)", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++)
+            bench::do_not_optimize(eager_where(eager_select(eager_where(eager_select(arr, inc), even), triple), not5));
+    });
+    double direct5 = bench::measure_best("fused, direct", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            LinqArrayBuilder<Int32> b(&int_type, 0);
+            linq_for_each<Int32>(arr, &list_type, nullptr, [&](Int32 e0) -> bool {
+                Int32 e1 = plus_one(inc->target, e0);
+                if (!is_even(even->target, e1)) return true;
+                Int32 e2 = times_three(triple->target, e1);
+                if (!not_multiple_of_five(not5->target, e2)) return true;
+                b.add(e2);
+                return true;
+            });
+            bench::do_not_optimize(b.to_array());
+        }
+    });
+    bench::ratio("  speedup (fused, direct)", eager5, direct5);
+
+    // --- List<int> source (previously unsupported: the operators assumed arrays) ---
+    bench::section("List<int>: Where -> Select -> Sum");
+    double list_fused = bench::measure_best("fused", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            linq_for_each<Int32>(list, &list_type, nullptr, [&](Int32 e0) -> bool {
+                if (!invoke<Boolean>(even, e0)) return true;
+                s += invoke<Int32>(triple, e0);
+                return true;
+            });
+            bench::do_not_optimize(s);
+        }
+    });
+    double list_direct = bench::measure_best("fused, direct", ops, 3, [&] {
+        for (long long r = 0; r < reps; r++) {
+            Int32 s = 0;
+            linq_for_each<Int32>(list, &list_type, nullptr, [&](Int32 e0) -> bool {
+                if (!is_even(even->target, e0)) return true;
+                s += times_three(triple->target, e0);
+                return true;
+            });
+            bench::do_not_optimize(s);
+        }
+    });
+    bench::ratio("  speedup (direct vs delegate)", list_fused, list_direct);
+
+    runtime_shutdown();
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * CIL2CPP Runtime Benchmarks - fork-join scaling (Parallel.For / PLINQ)
+ *
+ * CPU-bound loops written the way the compiler lowers Parallel.For,
+ * Parallel.ForEach and AsParallel().Where().Sum(), run with
+ * MaxDegreeOfParallelism from 1 up to every pool worker plus the calling
+ * thread. A plain sequential loop is the baseline; each row reports its
+ * speedup over it.
+ *
+ *  - uniform: every iteration costs the same (static split is enough);
+ *  - skewed:  iteration i costs ~i, so the ranges handed out first finish
+ *             last and the other participants have to steal;
+ *  - PLINQ:   filtered sum over an int[] through linq_parallel_reduce;
+ *  - ForEach: per-element work over an int[] through parallel::for_each.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace cil2cpp;
+
+static TypeInfo make_type(const char* name, const char* full_name, UInt32 size, TypeFlags flags) {
+    TypeInfo t = {};
+    t.name = name;
+    t.namespace_name = "System";
+    t.full_name = full_name;
+    t.instance_size = size;
+    t.element_size = size;
+    t.flags = flags;
+    return t;
+}
+
+static TypeInfo int_type = make_type("Int32", "System.Int32", sizeof(Int32),
+                                     TypeFlags::ValueType | TypeFlags::Primitive);
+static TypeInfo list_type = make_type("List_Int32", "System.Collections.Generic.List`1<System.Int32>",
+                                      sizeof(ListBase), TypeFlags::None);
+
+// ===== Loop bodies =====
+
+/// ~`rounds` dependent multiply-adds: pure ALU work, no memory traffic.
+static inline UInt64 spin(UInt64 seed, Int32 rounds) {
+    UInt64 x = seed | 1;
+    for (Int32 r = 0; r < rounds; r++) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return x;
+}
+
+static inline bool keep(Int32 x) { return (x & 3) != 0; }
+static inline Int64 weigh(Int32 x) { return static_cast<Int64>(std::sqrt(static_cast<Double>(x)) * 16.0); }
+
+// ===== Driver =====
+
+/// Degrees to measure: 1, 2, 4, ... and finally workers + caller.
+static std::vector<Int32> degrees() {
+    const Int32 max_degree = threadpool::worker_count() + 1;
+    std::vector<Int32> result;
+    for (Int32 d = 1; d < max_degree; d *= 2) result.push_back(d);
+    result.push_back(max_degree);
+    return result;
+}
+
+template<typename Sequential, typename Parallel>
+static void run(const char* title, long long ops, Sequential&& sequential, Parallel&& parallel) {
+    bench::section(title);
+    double base_ms = bench::measure_best("sequential loop", ops, 3, sequential);
+    char label[64];
+    for (Int32 degree : degrees()) {
+        parallel::LoopOptions options;
+        options.max_degree = degree;
+        std::snprintf(label, sizeof(label), "degree %d", degree);
+        double ms = bench::measure_best(label, ops, 3, [&] { parallel(options); });
+        bench::ratio("  speedup", base_ms, ms);
+    }
+}
+
+int main() {
+    runtime_init();
+    std::fprintf(stderr, "thread pool: %d workers (+ calling thread)\n", threadpool::worker_count());
+
+    const Int64 n = bench::scaled(2'000'000);
+    const Int32 rounds = 64;
+
+    run("Parallel.For uniform (64 mul-add / iteration)", n,
+        [&] {
+            UInt64 acc = 0;
+            for (Int64 i = 0; i < n; i++) acc ^= spin(static_cast<UInt64>(i), rounds);
+            bench::do_not_optimize(acc);
+        },
+        [&](const parallel::LoopOptions& options) {
+            std::vector<UInt64> partial(threadpool::worker_count() + 1);
+            parallel::for_range(0, n, options, [&](Int64 lo, Int64 hi, Int32 worker) {
+                UInt64 acc = 0;
+                for (Int64 i = lo; i < hi; i++) acc ^= spin(static_cast<UInt64>(i), rounds);
+                partial[worker] ^= acc;
+            });
+            bench::do_not_optimize(partial[0]);
+        });
+
+    // Triangular cost: the total work is ~m^2 / 2 rounds
+    const Int64 m = bench::scaled(20'000);
+    run("Parallel.For skewed (iteration i costs i)", m,
+        [&] {
+            UInt64 acc = 0;
+            for (Int64 i = 0; i < m; i++) acc ^= spin(static_cast<UInt64>(i), static_cast<Int32>(i));
+            bench::do_not_optimize(acc);
+        },
+        [&](const parallel::LoopOptions& options) {
+            UInt64 acc = parallel::reduce<UInt64>(0, m, 0, options,
+                [](UInt64& a, Int64 lo, Int64 hi) {
+                    for (Int64 i = lo; i < hi; i++) a ^= spin(static_cast<UInt64>(i), static_cast<Int32>(i));
+                },
+                [](UInt64 a, UInt64 b) { return a ^ b; });
+            bench::do_not_optimize(acc);
+        });
+
+    const Int32 len = static_cast<Int32>(bench::scaled(20'000'000));
+    Array* source = array_create(&int_type, len);
+    Int32* data = static_cast<Int32*>(array_data(source));
+    for (Int32 i = 0; i < len; i++) data[i] = i;
+
+    run("AsParallel().Where().Select().Sum() over int[]", len,
+        [&] {
+            Int64 acc = 0;
+            for (Int32 i = 0; i < len; i++)
+                if (keep(data[i])) acc += weigh(data[i]);
+            bench::do_not_optimize(acc);
+        },
+        [&](const parallel::LoopOptions& options) {
+            Int64 acc = linq_parallel_reduce<Int32>(source, &list_type, nullptr, options, Int64{0},
+                [](Int64& a, Int32 e) {
+                    if (keep(e)) a += weigh(e);
+                    return true;
+                },
+                [](Int64 a, Int64 b) { return a + b; });
+            bench::do_not_optimize(acc);
+        });
+
+    const Int32 each = len / 10;
+    Array* items = array_create(&int_type, each);
+    for (Int32 i = 0; i < each; i++) array_set<Int32>(items, i, data[i]);
+
+    run("Parallel.ForEach over int[] (64 mul-add / element)", each,
+        [&] {
+            for (Int32 i = 0; i < each; i++) bench::do_not_optimize(spin(static_cast<UInt64>(data[i]), rounds));
+        },
+        [&](const parallel::LoopOptions& options) {
+            parallel::for_each<Int32>(items, &list_type, nullptr, options, [&](Int32 e) {
+                bench::do_not_optimize(spin(static_cast<UInt64>(e), rounds));
+            });
+        });
+
+    runtime_shutdown();
+    return 0;
+}
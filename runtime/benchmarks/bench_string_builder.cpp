@@ -0,0 +1,138 @@
+/**
+ * CIL2CPP Runtime Benchmarks - StringBuilder and N-ary string_concat
+ *
+ * Builds a 100 MB (50M UTF-16 chars) string from small pieces — short
+ * literals and formatted integers, as a report/CSV writer would — and compares
+ * against what such code compiled to before StringBuilder was native:
+ * repeated two-way string_concat (quadratic, so it is run on a small prefix)
+ * and Append(i.ToString()) allocating a temporary per number. Also times
+ * three/four-part concatenation against the old nested form.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <string>
+
+using namespace cil2cpp;
+
+// Previous string_concat(a, b, c): builds and discards the a+b intermediate.
+static String* legacy_concat3(String* a, String* b, String* c) {
+    return string_concat(string_concat(a, b), c);
+}
+
+static String* legacy_concat4(String* a, String* b, String* c, String* d) {
+    return string_concat(string_concat(string_concat(a, b), c), d);
+}
+
+int main() {
+    runtime_init();
+
+    String* field = string_literal("row");
+    String* sep = string_literal(",");
+    String* eol = string_literal(";\n");
+    // "row,<id>,<id*7>;\n" ≈ 20 chars per row
+    const long long target_chars = bench::scaled(50'000'000);
+    const long long rows = target_chars / 20;
+
+    bench::section("Build ~100 MB from small pieces (string + int appends)");
+    double builder_ms = bench::measure("StringBuilder (Append(int) in place)", rows, [&] {
+        StringBuilder* sb = string_builder_create();
+        for (long long i = 0; i < rows; i++) {
+            string_builder_append(sb, field);
+            string_builder_append(sb, sep);
+            string_builder_append_int32(sb, static_cast<Int32>(i));
+            string_builder_append(sb, sep);
+            string_builder_append_int32(sb, static_cast<Int32>(i * 7));
+            string_builder_append(sb, eol);
+        }
+        String* s = string_builder_to_string(sb);
+        std::fprintf(stderr, "  result: %.1f MB\n", s->length * 2.0 / (1024 * 1024));
+        bench::do_not_optimize(s);
+    });
+
+    double tostring_ms = bench::measure("StringBuilder (Append(i.ToString()))", rows, [&] {
+        StringBuilder* sb = string_builder_create();
+        for (long long i = 0; i < rows; i++) {
+            string_builder_append(sb, field);
+            string_builder_append(sb, sep);
+            string_builder_append(sb, string_from_int32(static_cast<Int32>(i)));
+            string_builder_append(sb, sep);
+            string_builder_append(sb, string_from_int32(static_cast<Int32>(i * 7)));
+            string_builder_append(sb, eol);
+        }
+        bench::do_not_optimize(string_builder_to_string(sb));
+    });
+    bench::ratio("  in-place int formatting speedup", tostring_ms, builder_ms);
+
+    // Quadratic: every step copies everything built so far.
+    const long long legacy_rows = bench::scaled(2'000);
+    bench::section("Repeated s = s + piece (previous lowering), 40K-char result");
+    double legacy_ms = bench::measure("string_concat loop", legacy_rows, [&] {
+        String* s = string_literal("");
+        for (long long i = 0; i < legacy_rows; i++) {
+            s = string_concat(s, field);
+            s = string_concat(s, sep);
+            s = string_concat(s, string_from_int32(static_cast<Int32>(i)));
+            s = string_concat(s, eol);
+        }
+        bench::do_not_optimize(s);
+    });
+    double small_builder_ms = bench::measure("StringBuilder", legacy_rows, [&] {
+        StringBuilder* sb = string_builder_create();
+        for (long long i = 0; i < legacy_rows; i++) {
+            string_builder_append(sb, field);
+            string_builder_append(sb, sep);
+            string_builder_append_int32(sb, static_cast<Int32>(i));
+            string_builder_append(sb, eol);
+        }
+        bench::do_not_optimize(string_builder_to_string(sb));
+    });
+    bench::ratio("  speedup", legacy_ms, small_builder_ms);
+
+    bench::section("Presized builder: ToString() hand-off vs copy (1M chars)");
+    const long long handoff_reps = bench::scaled(200);
+    std::u16string block(1000, u'x');
+    String* piece = string_create_utf16(block.data(), 1000);
+    bench::measure_best("single full chunk (zero-copy)", handoff_reps, 3, [&] {
+        for (long long r = 0; r < handoff_reps; r++) {
+            StringBuilder* sb = string_builder_create(1'000'000);
+            for (int i = 0; i < 1000; i++) string_builder_append(sb, piece);
+            bench::do_not_optimize(string_builder_to_string(sb));
+        }
+    });
+    bench::measure_best("default capacity (chunked, one copy)", handoff_reps, 3, [&] {
+        for (long long r = 0; r < handoff_reps; r++) {
+            StringBuilder* sb = string_builder_create();
+            for (int i = 0; i < 1000; i++) string_builder_append(sb, piece);
+            bench::do_not_optimize(string_builder_to_string(sb));
+        }
+    });
+
+    const long long concat_ops = bench::scaled(500'000);
+    String* a = string_literal("Hello, ");
+    String* b = string_literal("world");
+    String* c = string_literal("! The answer is ");
+    String* d = string_literal("42.");
+
+    bench::section("string_concat(a, b, c)");
+    double legacy3 = bench::measure_best("nested two-way concat", concat_ops, 3, [&] {
+        for (long long i = 0; i < concat_ops; i++) bench::do_not_optimize(legacy_concat3(a, b, c));
+    });
+    double nary3 = bench::measure_best("n-ary concat", concat_ops, 3, [&] {
+        for (long long i = 0; i < concat_ops; i++) bench::do_not_optimize(string_concat(a, b, c));
+    });
+    bench::ratio("  speedup", legacy3, nary3);
+
+    bench::section("string_concat(a, b, c, d)");
+    double legacy4 = bench::measure_best("nested two-way concat", concat_ops, 3, [&] {
+        for (long long i = 0; i < concat_ops; i++) bench::do_not_optimize(legacy_concat4(a, b, c, d));
+    });
+    double nary4 = bench::measure_best("n-ary concat", concat_ops, 3, [&] {
+        for (long long i = 0; i < concat_ops; i++) bench::do_not_optimize(string_concat(a, b, c, d));
+    });
+    bench::ratio("  speedup", legacy4, nary4);
+
+    runtime_shutdown();
+    return 0;
+}
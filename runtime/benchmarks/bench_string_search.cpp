@@ -0,0 +1,177 @@
+/**
+ * CIL2CPP Runtime Benchmarks - String search / compare (log-grep workload)
+ *
+ * 200K synthetic service-log lines (~110 chars, ~1% ERROR) held as managed
+ * strings, scanned the way a log filter would: Contains / IndexOf /
+ * LastIndexOf / Replace / CompareOrdinal. Each operation is timed with the
+ * previous scalar loops ("legacy") and at every SIMD level this CPU supports.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+// ---- Previous System.String.Extra.cpp implementations ----
+
+static Int32 legacy_index_of_string(String* str, String* value) {
+    if (value->length > str->length) return -1;
+    for (Int32 i = 0; i <= str->length - value->length; i++) {
+        if (std::memcmp(str->chars + i, value->chars, value->length * sizeof(Char)) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static Int32 legacy_index_of(String* str, Char value) {
+    for (Int32 i = 0; i < str->length; i++)
+        if (str->chars[i] == value) return i;
+    return -1;
+}
+
+static Int32 legacy_last_index_of(String* str, Char value) {
+    for (Int32 i = str->length - 1; i >= 0; i--)
+        if (str->chars[i] == value) return i;
+    return -1;
+}
+
+static Int32 legacy_compare_ordinal(String* a, String* b) {
+    Int32 minLen = a->length < b->length ? a->length : b->length;
+    for (Int32 i = 0; i < minLen; i++) {
+        if (a->chars[i] != b->chars[i])
+            return a->chars[i] < b->chars[i] ? -1 : 1;
+    }
+    if (a->length == b->length) return 0;
+    return a->length < b->length ? -1 : 1;
+}
+
+static std::vector<String*> make_log(size_t lines) {
+    static const char* services[] = {"api-gateway", "billing", "auth", "search-indexer"};
+    static const char* levels[] = {"INFO ", "DEBUG", "WARN ", "INFO "};
+    std::vector<String*> out;
+    out.reserve(lines);
+    UInt32 rng = 12345;
+    char buf[256];
+    for (size_t i = 0; i < lines; i++) {
+        rng = rng * 1103515245u + 12345u;
+        bool error = (rng >> 16) % 100 == 0;
+        std::snprintf(buf, sizeof(buf),
+            "2024-05-01T12:%02zu:%02zu.%03zuZ [%s] service=%s req=%08x path=/v1/users/%u/orders "
+            "latency_ms=%u status=%s",
+            (i / 60000) % 60, (i / 1000) % 60, i % 1000,
+            error ? "ERROR" : levels[(rng >> 8) & 3], services[(rng >> 4) & 3], rng,
+            (rng >> 12) % 100000, (rng >> 20) % 900,
+            error ? "500 upstream timeout after 30000ms" : "200");
+        out.push_back(string_create_utf8(buf));
+    }
+    return out;
+}
+
+template<typename F>
+static void per_level(const char* op, long long ops, double legacy_ms, F&& fn) {
+    for (int l = 0; l <= static_cast<int>(simd::detected()); l++) {
+        simd::set_level(static_cast<simd::Level>(l));
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s  %s", op, simd::level_name(simd::level()));
+        double ms = bench::measure_best(label, ops, 3, fn);
+        bench::ratio("  vs legacy", legacy_ms, ms);
+    }
+}
+
+int main() {
+    runtime_init();
+    const size_t n = static_cast<size_t>(bench::scaled(200'000));
+    std::vector<String*> log = make_log(n);
+    String* error = string_create_utf8("ERROR");
+    String* timeout = string_create_utf8("upstream timeout after");
+    String* status = string_create_utf8("status=");
+    String* st = string_create_utf8("s=");
+    const long long ops = static_cast<long long>(n);
+    simd::Level best = simd::detected();
+
+    bench::section("Contains(\"ERROR\") per line");
+    double legacy = bench::measure_best("legacy", ops, 3, [&] {
+        Int32 hits = 0;
+        for (String* line : log) hits += legacy_index_of_string(line, error) >= 0;
+        bench::do_not_optimize(hits);
+    });
+    per_level("string_contains_string", ops, legacy, [&] {
+        Int32 hits = 0;
+        for (String* line : log) hits += string_contains_string(line, error);
+        bench::do_not_optimize(hits);
+    });
+
+    bench::section("Contains(\"upstream timeout after\") per line (22-char needle)");
+    legacy = bench::measure_best("legacy", ops, 3, [&] {
+        Int32 hits = 0;
+        for (String* line : log) hits += legacy_index_of_string(line, timeout) >= 0;
+        bench::do_not_optimize(hits);
+    });
+    per_level("string_contains_string", ops, legacy, [&] {
+        Int32 hits = 0;
+        for (String* line : log) hits += string_contains_string(line, timeout);
+        bench::do_not_optimize(hits);
+    });
+
+    bench::section("IndexOf('[') + LastIndexOf('/') per line");
+    legacy = bench::measure_best("legacy", ops, 3, [&] {
+        Int64 sum = 0;
+        for (String* line : log) sum += legacy_index_of(line, u'[') + legacy_last_index_of(line, u'/');
+        bench::do_not_optimize(sum);
+    });
+    per_level("string_index_of / last_index_of", ops, legacy, [&] {
+        Int64 sum = 0;
+        for (String* line : log) sum += string_index_of(line, u'[') + string_last_index_of(line, u'/');
+        bench::do_not_optimize(sum);
+    });
+
+    bench::section("CompareOrdinal(line[i], line[i+1]) (shared timestamp prefix)");
+    legacy = bench::measure_best("legacy", ops, 3, [&] {
+        Int32 acc = 0;
+        for (size_t i = 0; i + 1 < n; i++) acc += legacy_compare_ordinal(log[i], log[i + 1]);
+        bench::do_not_optimize(acc);
+    });
+    per_level("string_compare_ordinal", ops, legacy, [&] {
+        Int32 acc = 0;
+        for (size_t i = 0; i + 1 < n; i++) acc += string_compare_ordinal(log[i], log[i + 1]);
+        bench::do_not_optimize(acc);
+    });
+
+    // In-cache throughput: one 64K-char string, so the kernels themselves dominate
+    std::u16string big_text(65536, u'x');
+    String* big = string_create_utf16(big_text.data(), 65536);
+    String* big2 = string_create_utf16(big_text.data(), 65536);
+    const long long big_reps = bench::scaled(2000);
+
+    bench::section("IndexOf(absent char) over 64K chars (in cache)");
+    legacy = bench::measure_best("legacy", big_reps, 3, [&] {
+        for (long long r = 0; r < big_reps; r++) bench::do_not_optimize(legacy_index_of(big, u'#'));
+    });
+    per_level("string_index_of", big_reps, legacy, [&] {
+        for (long long r = 0; r < big_reps; r++) bench::do_not_optimize(string_index_of(big, u'#'));
+    });
+
+    bench::section("CompareOrdinal of equal 64K-char strings (in cache)");
+    legacy = bench::measure_best("legacy", big_reps, 3, [&] {
+        for (long long r = 0; r < big_reps; r++) bench::do_not_optimize(legacy_compare_ordinal(big, big2));
+    });
+    per_level("string_compare_ordinal", big_reps, legacy, [&] {
+        for (long long r = 0; r < big_reps; r++) bench::do_not_optimize(string_compare_ordinal(big, big2));
+    });
+
+    bench::section("Replace(\"status=\", \"s=\") per line");
+    simd::set_level(best);
+    bench::measure_best("string_replace_string", ops, 3, [&] {
+        Int64 total = 0;
+        for (String* line : log) total += string_replace_string(line, status, st)->length;
+        bench::do_not_optimize(total);
+    });
+
+    simd::set_level(best);
+    runtime_shutdown();
+    return 0;
+}
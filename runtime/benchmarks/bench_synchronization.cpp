@@ -0,0 +1,229 @@
+/**
+ * CIL2CPP Runtime Benchmarks - SemaphoreSlim, ManualResetEventSlim, ReaderWriterLockSlim
+ *
+ * Each primitive against the Monitor-based equivalent a program would have
+ * written before (one std::mutex + condition variable, the Monitor.Wait/Pulse
+ * pattern):
+ *
+ *  - uncontended Wait+Release / EnterRead+ExitRead on one thread, per pair;
+ *  - a semaphore with 2 slots shared by N threads, per acquire;
+ *  - a read-mostly workload (1 write in 64) on N threads, per operation;
+ *  - a ping-pong between two threads over two events, per round trip.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+// ===== Monitor-based equivalents (previous option) =====
+
+class MonitorSemaphore {
+public:
+    explicit MonitorSemaphore(int count) : count_(count) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        available_.wait(lock, [&] { return count_ > 0; });
+        count_--;
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        count_++;
+        available_.notify_one();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable available_;
+    int count_;
+};
+
+class MonitorEvent {
+public:
+    void set() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        set_ = true;
+        signaled_.notify_all();
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        set_ = false;
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        signaled_.wait(lock, [&] { return set_; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable signaled_;
+    bool set_ = false;
+};
+
+template <typename Body>
+static double on_threads(const char* name, int threads, long long per_thread, Body body) {
+    return bench::measure(name, per_thread * threads, [&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                gc::register_thread();
+                body(t, per_thread);
+                gc::unregister_thread();
+            });
+        }
+        for (auto& w : workers) w.join();
+    });
+}
+
+int main() {
+    runtime_init();
+
+    const int threads = static_cast<int>(std::max(2u, std::min(8u, std::thread::hardware_concurrency())));
+
+    bench::section("Uncontended, one thread (per acquire + release)");
+    {
+        const long long n = bench::scaled(10'000'000);
+        MonitorSemaphore monitor(1);
+        double prev = bench::measure_best("Monitor semaphore", n, 3, [&] {
+            for (long long i = 0; i < n; i++) {
+                monitor.wait();
+                monitor.release();
+            }
+        });
+        SemaphoreSlim* s = semaphore_create(1, 1);
+        double slim = bench::measure_best("SemaphoreSlim Wait + Release", n, 3, [&] {
+            for (long long i = 0; i < n; i++) {
+                semaphore_wait(s, -1);
+                semaphore_release(s, 1);
+            }
+        });
+        bench::ratio("  speedup", prev, slim);
+
+        std::mutex mutex;
+        double locked = bench::measure_best("std::mutex lock + unlock", n, 3, [&] {
+            for (long long i = 0; i < n; i++) {
+                mutex.lock();
+                mutex.unlock();
+            }
+        });
+        ReaderWriterLockSlim* l = rwlock_create(0);
+        double read = bench::measure_best("ReaderWriterLockSlim EnterRead + ExitRead", n, 3, [&] {
+            for (long long i = 0; i < n; i++) {
+                rwlock_enter_read(l, -1);
+                rwlock_exit_read(l);
+            }
+        });
+        bench::ratio("  vs mutex", locked, read);
+    }
+
+    char title[96];
+    std::snprintf(title, sizeof(title), "Semaphore with 2 slots, %d threads (per acquire)", threads);
+    bench::section(title);
+    {
+        const long long per_thread = bench::scaled(400'000) / threads;
+        MonitorSemaphore monitor(2);
+        double prev = on_threads("Monitor semaphore", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) {
+                monitor.wait();
+                monitor.release();
+            }
+        });
+        SemaphoreSlim* s = semaphore_create(2, 2);
+        double slim = on_threads("SemaphoreSlim", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) {
+                semaphore_wait(s, -1);
+                semaphore_release(s, 1);
+            }
+        });
+        bench::ratio("  speedup", prev, slim);
+    }
+
+    std::snprintf(title, sizeof(title), "Read-mostly (1 write in 64), %d threads (per operation)", threads);
+    bench::section(title);
+    {
+        const long long per_thread = bench::scaled(2'000'000) / threads;
+        Int64 table[16] = {};
+        auto read_table = [&] {
+            Int64 sum = 0;
+            for (Int64 v : table) sum += v;
+            bench::do_not_optimize(sum);
+        };
+
+        std::mutex mutex;
+        double prev = on_threads("Monitor (std::mutex)", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) {
+                std::lock_guard<std::mutex> guard(mutex);
+                if ((i & 63) == 0) table[i & 15]++;
+                else read_table();
+            }
+        });
+        ReaderWriterLockSlim* l = rwlock_create(0);
+        double rw = on_threads("ReaderWriterLockSlim", threads, per_thread, [&](int, long long n) {
+            for (long long i = 0; i < n; i++) {
+                if ((i & 63) == 0) {
+                    rwlock_enter_write(l, -1);
+                    table[i & 15]++;
+                    rwlock_exit_write(l);
+                } else {
+                    rwlock_enter_read(l, -1);
+                    read_table();
+                    rwlock_exit_read(l);
+                }
+            }
+        });
+        bench::ratio("  speedup", prev, rw);
+    }
+
+    bench::section("Latency: ping-pong over two events (per round trip)");
+    {
+        const long long rounds = bench::scaled(100'000);
+        MonitorEvent monitors[2];
+        double prev = bench::measure("Monitor events", rounds, [&] {
+            std::thread echo([&] {
+                for (long long i = 0; i < rounds; i++) {
+                    monitors[0].wait();
+                    monitors[0].reset();
+                    monitors[1].set();
+                }
+            });
+            for (long long i = 0; i < rounds; i++) {
+                monitors[0].set();
+                monitors[1].wait();
+                monitors[1].reset();
+            }
+            echo.join();
+        });
+        ManualResetEventSlim* events[2] = {reset_event_create(false, -1), reset_event_create(false, -1)};
+        double slim = bench::measure("ManualResetEventSlim", rounds, [&] {
+            std::thread echo([&] {
+                gc::register_thread();
+                for (long long i = 0; i < rounds; i++) {
+                    reset_event_wait(events[0], -1);
+                    reset_event_reset(events[0]);
+                    reset_event_set(events[1]);
+                }
+                gc::unregister_thread();
+            });
+            for (long long i = 0; i < rounds; i++) {
+                reset_event_set(events[0]);
+                reset_event_wait(events[1], -1);
+                reset_event_reset(events[1]);
+            }
+            echo.join();
+        });
+        bench::ratio("  speedup", prev, slim);
+    }
+
+    runtime_shutdown();
+    return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * CIL2CPP Runtime Benchmarks - Thread registry
+ *
+ *  - Environment.CurrentManagedThreadId: the previous hash of
+ *    std::thread::id per call against the thread_local ID, per call;
+ *  - Thread create/Start/Join() churn, per thread;
+ *  - create/Start/Join(timeout) churn: the previous 1 ms polling loop
+ *    (reproduced over the same thread) against the completion event.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+using namespace cil2cpp;
+
+// ===== Previous implementation =====
+
+namespace legacy {
+
+static Int32 current_managed_id() {
+    return static_cast<Int32>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0x7FFFFFFF);
+}
+
+static bool join_timeout(ManagedThread* t, Int32 timeout_ms) {
+    if (t->state.load() == thread::kStopped) return true;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (t->state.load() == thread::kStopped) {
+            thread::join(t);
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} // namespace legacy
+
+static std::atomic<Int64> g_work{0};
+
+static void thread_body(Object*) {
+    // A little work so that the joiner usually finds the thread still running
+    Int64 acc = 0;
+    for (int i = 0; i < 20000; i++) acc += i ^ (acc >> 3);
+    g_work.fetch_add(acc, std::memory_order_relaxed);
+}
+
+static TypeInfo ThreadStartType = {
+    .name = "ThreadStart",
+    .namespace_name = "System.Threading",
+    .full_name = "System.Threading.ThreadStart",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(Delegate),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .finalizer = nullptr,
+};
+
+static ManagedThread* start_thread() {
+    auto* t = thread::create(delegate_create(&ThreadStartType, nullptr,
+        reinterpret_cast<void*>(&thread_body)));
+    thread::start(t);
+    return t;
+}
+
+int main() {
+    runtime_init();
+
+    bench::section("CurrentManagedThreadId (per call)");
+    {
+        const long long n = bench::scaled(50'000'000);
+        double prev = bench::measure_best("hash of std::thread::id", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc += legacy::current_managed_id();
+            bench::do_not_optimize(acc);
+        });
+        double now = bench::measure_best("thread_local ID", n, 3, [&] {
+            Int64 acc = 0;
+            for (long long i = 0; i < n; i++) acc += icall::Environment_get_CurrentManagedThreadId();
+            bench::do_not_optimize(acc);
+        });
+        bench::ratio("  speedup", prev, now);
+    }
+
+    bench::section("Thread churn (per thread)");
+    {
+        const long long n = bench::scaled(2'000);
+        bench::measure_best("create/Start/Join()", n, 3, [&] {
+            for (long long i = 0; i < n; i++) thread::join(start_thread());
+        });
+
+        double prev = bench::measure_best("create/Start/Join(1000), 1 ms polling", n, 3, [&] {
+            for (long long i = 0; i < n; i++)
+                if (!legacy::join_timeout(start_thread(), 1000)) std::abort();
+        });
+        double now = bench::measure_best("create/Start/Join(1000), completion event", n, 3, [&] {
+            for (long long i = 0; i < n; i++)
+                if (!thread::join_timeout(start_thread(), 1000)) std::abort();
+        });
+        bench::ratio("  speedup", prev, now);
+    }
+
+    runtime_shutdown();
+    return 0;
+}
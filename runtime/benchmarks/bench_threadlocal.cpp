@@ -0,0 +1,117 @@
+/**
+ * CIL2CPP Runtime Benchmarks - per-thread state
+ *
+ * A per-thread counter bumped through each of the ways generated code can
+ * keep per-thread state:
+ *  - the previous fallback: a Dictionary keyed by managed thread id behind a
+ *    lock (std::mutex + std::unordered_map here);
+ *  - ThreadLocal<T>: Value get + set through threadlocal.h;
+ *  - a [ThreadStatic] field: a member of a thread_local statics block.
+ * Per op, on one thread and on N threads at once.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace cil2cpp;
+
+namespace locked {
+
+static std::mutex g_mutex;
+static std::unordered_map<Int32, Int64> g_counters;
+
+static void increment() {
+    Int32 id = thread::current_managed_id();
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_counters[id]++;
+}
+
+} // namespace locked
+
+// What the compiler emits for a type with a [ThreadStatic] long field
+struct Bench_ThreadStatics {
+    Int64 f_counter;
+};
+thread_local constinit Bench_ThreadStatics Bench_thread_statics = {};
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+// One managed method per strategy, as generated code would call it
+BENCH_NOINLINE static void bump_locked() { locked::increment(); }
+
+BENCH_NOINLINE static void bump_thread_local(ThreadLocal* tl) {
+    threadlocal_set_value<Int64>(tl, threadlocal_get_value<Int64>(tl) + 1);
+}
+
+BENCH_NOINLINE static void bump_thread_static() { Bench_thread_statics.f_counter++; }
+
+template <typename Body>
+static double on_threads(const char* name, int threads, long long per_thread, Body body) {
+    return bench::measure(name, per_thread * threads, [&] {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&] {
+                gc::register_thread();
+                body(per_thread);
+                gc::unregister_thread();
+            });
+        }
+        for (auto& w : workers) w.join();
+    });
+}
+
+int main() {
+    runtime_init();
+    const int threads = static_cast<int>(std::max(2u, std::min(8u, std::thread::hardware_concurrency())));
+    auto* tl = threadlocal_create(sizeof(Int64), nullptr);
+
+    bench::section("One thread (per op)");
+    {
+        const long long n = bench::scaled(20'000'000);
+        double prev = bench::measure_best("locked map by thread id", n, 3, [&] {
+            for (long long i = 0; i < n; i++) bump_locked();
+        });
+        double local = bench::measure_best("ThreadLocal<long>.Value++", n, 3, [&] {
+            for (long long i = 0; i < n; i++) bump_thread_local(tl);
+        });
+        double stat = bench::measure_best("[ThreadStatic] long++", n, 3, [&] {
+            for (long long i = 0; i < n; i++) bump_thread_static();
+        });
+        bench::ratio("  ThreadLocal speedup", prev, local);
+        bench::ratio("  [ThreadStatic] speedup", prev, stat);
+    }
+
+    char title[96];
+    std::snprintf(title, sizeof(title), "%d threads at once (per op)", threads);
+    bench::section(title);
+    {
+        const long long per_thread = bench::scaled(20'000'000) / threads;
+        double prev = on_threads("locked map by thread id", threads, per_thread, [&](long long n) {
+            for (long long i = 0; i < n; i++) bump_locked();
+        });
+        double local = on_threads("ThreadLocal<long>.Value++", threads, per_thread, [&](long long n) {
+            for (long long i = 0; i < n; i++) bump_thread_local(tl);
+            if (threadlocal_get_value<Int64>(tl) != n) std::abort();
+        });
+        double stat = on_threads("[ThreadStatic] long++", threads, per_thread, [&](long long n) {
+            for (long long i = 0; i < n; i++) bump_thread_static();
+            if (Bench_thread_statics.f_counter != n) std::abort();
+        });
+        bench::ratio("  ThreadLocal speedup", prev, local);
+        bench::ratio("  [ThreadStatic] speedup", prev, stat);
+    }
+
+    threadlocal_dispose(tl);
+    runtime_shutdown();
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * CIL2CPP Runtime Benchmarks - UTF-8 ⇄ UTF-16 transcoding
+ *
+ * Throughput of the conversions behind string_create_utf8 (single-pass
+ * decode) and string_to_utf8 (length + encode) on four corpora, for every
+ * SIMD level this CPU supports. "legacy" is the previous two-pass byte loop.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+// Previous System.String.cpp converters, kept for comparison
+static size_t legacy_utf8_to_utf16(const char* utf8, Char* out) {
+    size_t n = 0;
+    const char* p = utf8;
+    while (*p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c < 0x80) p += 1;
+        else if ((c & 0xE0) == 0xC0) p += 2;
+        else if ((c & 0xF0) == 0xE0) p += 3;
+        else if ((c & 0xF8) == 0xF0) { p += 4; n++; }
+        else p += 1;
+        n++;
+    }
+    Char* o = out;
+    while (*utf8) {
+        unsigned char c = static_cast<unsigned char>(*utf8);
+        if (c < 0x80) { *o++ = c; utf8 += 1; }
+        else if ((c & 0xE0) == 0xC0) {
+            *o++ = static_cast<Char>(((c & 0x1F) << 6) | (utf8[1] & 0x3F)); utf8 += 2;
+        } else if ((c & 0xF0) == 0xE0) {
+            *o++ = static_cast<Char>(((c & 0x0F) << 12) | ((utf8[1] & 0x3F) << 6) | (utf8[2] & 0x3F));
+            utf8 += 3;
+        } else if ((c & 0xF8) == 0xF0) {
+            UInt32 cp = ((c & 0x07) << 18) | ((utf8[1] & 0x3F) << 12) |
+                        ((utf8[2] & 0x3F) << 6) | (utf8[3] & 0x3F);
+            cp -= 0x10000;
+            *o++ = static_cast<Char>(0xD800 | (cp >> 10));
+            *o++ = static_cast<Char>(0xDC00 | (cp & 0x3FF));
+            utf8 += 4;
+        } else utf8 += 1;
+    }
+    return n;
+}
+
+static size_t legacy_utf16_to_utf8(const Char* s, size_t len, char* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++) n += s[i] < 0x80 ? 1 : s[i] < 0x800 ? 2 : 3;
+    char* p = out;
+    for (size_t i = 0; i < len; i++) {
+        Char c = s[i];
+        if (c < 0x80) *p++ = static_cast<char>(c);
+        else if (c < 0x800) {
+            *p++ = static_cast<char>(0xC0 | (c >> 6));
+            *p++ = static_cast<char>(0x80 | (c & 0x3F));
+        } else {
+            *p++ = static_cast<char>(0xE0 | (c >> 12));
+            *p++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            *p++ = static_cast<char>(0x80 | (c & 0x3F));
+        }
+    }
+    return n;
+}
+
+struct Corpus {
+    const char* name;
+    std::string utf8;
+    std::u16string utf16;
+};
+
+static Corpus make_corpus(const char* name, const char* unit, size_t bytes) {
+    Corpus c{name, {}, {}};
+    while (c.utf8.size() < bytes) c.utf8 += unit;
+    c.utf16.resize(utf::utf8_to_utf16_length(c.utf8.data(), c.utf8.size()));
+    utf::utf8_to_utf16(c.utf8.data(), c.utf8.size(), c.utf16.data());
+    return c;
+}
+
+int main() {
+    runtime_init();
+    const size_t corpus_bytes = 1 << 20;  // 1 MiB per corpus
+    const int reps = static_cast<int>(bench::scaled(200));
+
+    std::vector<Corpus> corpora;
+    corpora.push_back(make_corpus("ascii",
+        "The quick brown fox jumps over the lazy dog. 0123456789\n", corpus_bytes));
+    corpora.push_back(make_corpus("latin",
+        "Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter.\n", corpus_bytes));
+    corpora.push_back(make_corpus("cjk",
+        "\xE4\xBD\xA0\xE5\xA5\xBD\xEF\xBC\x8C\xE4\xB8\x96\xE7\x95\x8C\xE3\x80\x82"
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD"
+        "\xE3\x82\xB9\xE3\x83\x88\n", corpus_bytes));
+    corpora.push_back(make_corpus("emoji",
+        "ok \xF0\x9F\x98\x80\xF0\x9F\x8E\x89\xF0\x9F\x9A\x80 done \xF0\x9F\x91\x8D\n",
+        corpus_bytes));
+
+    std::vector<Char> u16buf(corpus_bytes + 64);
+    std::vector<char> u8buf(corpus_bytes * 3 + 64);
+    simd::Level best = simd::detected();
+
+    for (auto& c : corpora) {
+        const double mb = static_cast<double>(c.utf8.size()) * reps / (1024.0 * 1024.0);
+        char title[96];
+        std::snprintf(title, sizeof(title), "%s corpus (%zu bytes UTF-8, %zu units UTF-16)",
+                      c.name, c.utf8.size(), c.utf16.size());
+        bench::section(title);
+
+        double legacy = bench::measure_best("utf8 -> utf16  legacy", reps, 3, [&] {
+            for (int r = 0; r < reps; r++)
+                bench::do_not_optimize(legacy_utf8_to_utf16(c.utf8.c_str(), u16buf.data()));
+        });
+        std::fprintf(stderr, "  %-44s %10.0f MB/s\n", "", mb / (legacy / 1000.0));
+        for (int l = 0; l <= static_cast<int>(best); l++) {
+            simd::set_level(static_cast<simd::Level>(l));
+            char label[64];
+            std::snprintf(label, sizeof(label), "utf8 -> utf16  %s", simd::level_name(simd::level()));
+            double ms = bench::measure_best(label, reps, 3, [&] {
+                for (int r = 0; r < reps; r++)
+                    bench::do_not_optimize(utf::utf8_to_utf16(c.utf8.data(), c.utf8.size(), u16buf.data()));
+            });
+            std::fprintf(stderr, "  %-44s %10.0f MB/s  (%.2fx legacy)\n", "", mb / (ms / 1000.0), legacy / ms);
+        }
+
+        legacy = bench::measure_best("utf16 -> utf8  legacy", reps, 3, [&] {
+            for (int r = 0; r < reps; r++)
+                bench::do_not_optimize(legacy_utf16_to_utf8(c.utf16.data(), c.utf16.size(), u8buf.data()));
+        });
+        std::fprintf(stderr, "  %-44s %10.0f MB/s\n", "", mb / (legacy / 1000.0));
+        for (int l = 0; l <= static_cast<int>(best); l++) {
+            simd::set_level(static_cast<simd::Level>(l));
+            char label[64];
+            std::snprintf(label, sizeof(label), "utf16 -> utf8  %s", simd::level_name(simd::level()));
+            double ms = bench::measure_best(label, reps, 3, [&] {
+                for (int r = 0; r < reps; r++) {
+                    bench::do_not_optimize(utf::utf16_to_utf8_length(c.utf16.data(), c.utf16.size()));
+                    bench::do_not_optimize(utf::utf16_to_utf8(c.utf16.data(), c.utf16.size(), u8buf.data()));
+                }
+            });
+            std::fprintf(stderr, "  %-44s %10.0f MB/s  (%.2fx legacy)\n", "", mb / (ms / 1000.0), legacy / ms);
+        }
+    }
+
+    simd::set_level(best);
+    runtime_shutdown();
+    return 0;
+}
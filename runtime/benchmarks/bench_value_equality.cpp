@@ -0,0 +1,198 @@
+/**
+ * CIL2CPP Runtime Benchmarks - value-type equality without boxing
+ *
+ * A struct key with its own Equals(T)/Equals(object)/GetHashCode, called the
+ * ways the compiler can lower it:
+ *
+ *  - constrained. callvirt in generic code (HashOf<T>, SameKey<T : IEquatable<T>>):
+ *    box the receiver and dispatch through the vtable (previous lowering) vs a
+ *    direct call on the value's address;
+ *  - Dictionary<GridKey, int> lookups: an Equals(object)-only thunk that boxes
+ *    the probe per comparison vs the Equals(T) thunk vs bitwise memcmp/FNV-1a
+ *    (the reference point when the struct has no overrides).
+ *
+ * Every row also prints the GC bytes and box allocations per operation.
+ */
+
+#include "bench.h"
+#include <cil2cpp/cil2cpp.h>
+
+using namespace cil2cpp;
+
+// ===== The struct, as the generated code declares it =====
+
+struct GridKey {
+    Int32 row;
+    Int32 col;
+};
+
+static TypeInfo grid_key_type;
+
+static Boolean GridKey_Equals(GridKey* self, GridKey other) {
+    return self->row == other.row && self->col == other.col;
+}
+
+static Boolean GridKey_Equals_Object(GridKey* self, Object* obj) {
+    if (!obj || obj->__type_info != &grid_key_type) return false;
+    return GridKey_Equals(self, unbox<GridKey>(obj));
+}
+
+static Int32 GridKey_GetHashCode(GridKey* self) {
+    return self->row * 397 + self->col;
+}
+
+// Vtable entries of the boxed struct (receiver is the box)
+static Boolean boxed_equals(Object* self, Object* obj) { return GridKey_Equals_Object(unbox_ptr<GridKey>(self), obj); }
+static Int32 boxed_get_hash_code(Object* self) { return GridKey_GetHashCode(unbox_ptr<GridKey>(self)); }
+
+static void* grid_key_methods[] = {
+    nullptr,
+    reinterpret_cast<void*>(&boxed_equals),
+    reinterpret_cast<void*>(&boxed_get_hash_code),
+};
+static VTable grid_key_vtable = { &grid_key_type, grid_key_methods, 3 };
+
+// TypeInfo thunks
+static Boolean equatable_thunk(const void* a, const void* b) {
+    return GridKey_Equals(static_cast<GridKey*>(const_cast<void*>(a)), *static_cast<const GridKey*>(b));
+}
+static Boolean object_equals_thunk(const void* a, const void* b) {
+    return GridKey_Equals_Object(static_cast<GridKey*>(const_cast<void*>(a)),
+                                 box_raw(b, sizeof(GridKey), &grid_key_type));
+}
+static Int32 hash_thunk(const void* value) {
+    return GridKey_GetHashCode(static_cast<GridKey*>(const_cast<void*>(value)));
+}
+
+static TypeInfo make_key_type(const char* name, Boolean (*equals)(const void*, const void*),
+                              Int32 (*hash)(const void*)) {
+    TypeInfo t = {};
+    t.name = name;
+    t.namespace_name = "";
+    t.full_name = name;
+    t.instance_size = sizeof(GridKey);
+    t.element_size = sizeof(GridKey);
+    t.flags = TypeFlags::ValueType | TypeFlags::Sealed;
+    t.vtable = &grid_key_vtable;
+    t.value_equals = equals;
+    t.value_hash = hash;
+    return t;
+}
+
+static TypeInfo int_type;
+static TypeInfo dict_type;
+
+// ===== Allocation accounting =====
+
+/// bench::measure_allocs plus the GridKey boxes that GC bytes per op amount to.
+template<typename F>
+static double measure_boxes(const char* name, long long ops, F&& fn) {
+    bench::Allocs allocs = bench::measure_allocs(name, ops, fn);
+    std::fprintf(stderr, "  %-44s %10.2f /op\n", "  boxes",
+                 allocs.gc_bytes / static_cast<double>(sizeof(Object) + sizeof(GridKey)));
+    return allocs.ms;
+}
+
+// ===== Generic code bodies (HashOf<GridKey>, SameKey<GridKey>) =====
+
+static Int32 hash_of_boxed(GridKey value) {
+    auto* boxed = box_raw(&value, sizeof(GridKey), &grid_key_type);
+    return reinterpret_cast<Int32 (*)(Object*)>(boxed->__type_info->vtable->methods[2])(boxed);
+}
+
+static Int32 hash_of_direct(GridKey value) {
+    return GridKey_GetHashCode(&value);
+}
+
+static Boolean same_key_boxed(GridKey a, GridKey b) {
+    auto* boxed_a = box_raw(&a, sizeof(GridKey), &grid_key_type);
+    auto* boxed_b = box_raw(&b, sizeof(GridKey), &grid_key_type);
+    return reinterpret_cast<Boolean (*)(Object*, Object*)>(boxed_a->__type_info->vtable->methods[1])(boxed_a, boxed_b);
+}
+
+static Boolean same_key_direct(GridKey a, GridKey b) {
+    return GridKey_Equals(&a, b);
+}
+
+int main() {
+    runtime_init();
+
+    grid_key_type = make_key_type("GridKey", equatable_thunk, hash_thunk);
+    int_type = {};
+    int_type.name = "Int32";
+    int_type.namespace_name = "System";
+    int_type.full_name = "System.Int32";
+    int_type.instance_size = sizeof(Int32);
+    int_type.element_size = sizeof(Int32);
+    int_type.flags = TypeFlags::ValueType | TypeFlags::Primitive;
+    dict_type = {};
+    dict_type.name = "Dictionary_GridKey_Int32";
+    dict_type.full_name = "System.Collections.Generic.Dictionary`2<GridKey,System.Int32>";
+    dict_type.instance_size = sizeof(DictBase);
+
+    const Int64 n = bench::scaled(5'000'000);
+
+    bench::section("constrained. callvirt GetHashCode in HashOf<T>");
+    {
+        double boxed = measure_boxes("box + vtable (previous lowering)", n, [&] {
+            Int32 acc = 0;
+            for (Int64 i = 0; i < n; i++) acc ^= hash_of_boxed(GridKey{static_cast<Int32>(i), 7});
+            bench::do_not_optimize(acc);
+        });
+        double direct = measure_boxes("direct call on the address", n, [&] {
+            Int32 acc = 0;
+            for (Int64 i = 0; i < n; i++) acc ^= hash_of_direct(GridKey{static_cast<Int32>(i), 7});
+            bench::do_not_optimize(acc);
+        });
+        bench::ratio("  speedup", boxed, direct);
+    }
+
+    bench::section("constrained. callvirt IEquatable<T>.Equals in SameKey<T>");
+    {
+        double boxed = measure_boxes("box both + Equals(object)", n, [&] {
+            Int32 hits = 0;
+            for (Int64 i = 0; i < n; i++)
+                hits += same_key_boxed(GridKey{static_cast<Int32>(i & 15), 1}, GridKey{3, 1});
+            bench::do_not_optimize(hits);
+        });
+        double direct = measure_boxes("direct Equals(T) on the address", n, [&] {
+            Int32 hits = 0;
+            for (Int64 i = 0; i < n; i++)
+                hits += same_key_direct(GridKey{static_cast<Int32>(i & 15), 1}, GridKey{3, 1});
+            bench::do_not_optimize(hits);
+        });
+        bench::ratio("  speedup", boxed, direct);
+    }
+
+    const Int32 keys = 4096;
+    const Int64 lookups = bench::scaled(2'000'000);
+    TypeInfo object_equals_type = make_key_type("GridKey", object_equals_thunk, hash_thunk);
+    TypeInfo bitwise_type = make_key_type("GridKey", nullptr, nullptr);
+
+    auto run_dict = [&](const char* label, TypeInfo* key_type) {
+        auto* dict = dict_create(&dict_type, key_type, &int_type);
+        for (Int32 i = 0; i < keys; i++) {
+            GridKey key{i / 64, i % 64};
+            dict_set(dict, &key, &i);
+        }
+        return measure_boxes(label, lookups, [&] {
+            Int64 acc = 0;
+            for (Int64 i = 0; i < lookups; i++) {
+                Int32 k = static_cast<Int32>((i * 2654435761LL) & (keys - 1));
+                GridKey probe{k / 64, k % 64};
+                acc += *static_cast<Int32*>(dict_get_ref(dict, &probe));
+            }
+            bench::do_not_optimize(acc);
+        });
+    };
+
+    bench::section("Dictionary<GridKey, int> lookups (4096 keys)");
+    double object_equals = run_dict("Equals(object) thunk (boxes the probe)", &object_equals_type);
+    double equatable = run_dict("Equals(T) thunk", &grid_key_type);
+    bench::ratio("  speedup over Equals(object)", object_equals, equatable);
+    double bitwise = run_dict("bitwise memcmp / FNV-1a (no overrides)", &bitwise_type);
+    bench::ratio("  Equals(T) thunk vs bitwise", bitwise, equatable);
+
+    runtime_shutdown();
+    return 0;
+}
@@ -48,13 +48,25 @@ inline void* array_data(Array* arr) {
 
 /**
  * Get element at index (with bounds check).
+ * Untyped: the stride comes from element_type->element_size. Generated code
+ * uses array_element_ptr<T> instead.
  */
 void* array_get_element_ptr(Array* arr, Int32 index);
 
+/**
+ * Throw NullReferenceException (arr == nullptr) or IndexOutOfRangeException.
+ * Kept out of line so the inline check below stays a compare and a branch.
+ */
+[[noreturn]] void array_bounds_fail(Array* arr);
+
 /**
  * Bounds check - throws IndexOutOfRangeException if invalid.
+ * One unsigned compare covers both index < 0 and index >= length.
  */
-void array_bounds_check(Array* arr, Int32 index);
+inline void array_bounds_check(Array* arr, Int32 index) {
+    if (!arr || static_cast<UInt32>(index) >= static_cast<UInt32>(arr->length)) [[unlikely]]
+        array_bounds_fail(arr);
+}
 
 /**
  * Create a subarray (slice) from source array.
@@ -77,6 +89,29 @@ inline void array_set(Array* arr, Int32 index, T value) {
     data[index] = value;
 }
 
+template<typename T>
+inline T* array_element_ptr(Array* arr, Int32 index) {
+    array_bounds_check(arr, index);
+    return static_cast<T*>(array_data(arr)) + index;
+}
+
+// Unchecked variants: emitted by the compiler only where it has proven
+// arr != nullptr and 0 <= index < arr->length (see BoundsCheckElimination).
+template<typename T>
+inline T& array_get_unchecked(Array* arr, Int32 index) {
+    return static_cast<T*>(array_data(arr))[index];
+}
+
+template<typename T>
+inline void array_set_unchecked(Array* arr, Int32 index, T value) {
+    static_cast<T*>(array_data(arr))[index] = value;
+}
+
+template<typename T>
+inline T* array_element_ptr_unchecked(Array* arr, Int32 index) {
+    return static_cast<T*>(array_data(arr)) + index;
+}
+
 // ===== ICall functions for System.Array (work with both 1D and multi-dim arrays) =====
 
 /// System.Array::get_Length — total element count.
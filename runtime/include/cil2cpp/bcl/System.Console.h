@@ -10,6 +10,16 @@
 namespace cil2cpp {
 namespace System {
 
+/**
+ * When buffered console output is handed to stdout.
+ * Default: Line if stdout is a terminal, Block otherwise (pipes, files).
+ */
+enum class ConsoleFlushPolicy {
+    Block,   // only when the 64 KB buffer fills, on Console_Flush, and at shutdown
+    Line,    // additionally after every WriteLine
+    Always,  // after every Write/WriteLine call (.NET Console.Out AutoFlush)
+};
+
 // Console.WriteLine overloads
 void Console_WriteLine();
 void Console_WriteLine(String* value);
@@ -41,5 +51,11 @@ String* Console_ReadLine();
 // Console.Read
 Int32 Console_Read();
 
+// Console.Out.Flush — write any buffered output to stdout.
+void Console_Flush();
+
+void Console_SetFlushPolicy(ConsoleFlushPolicy policy);
+ConsoleFlushPolicy Console_GetFlushPolicy();
+
 } // namespace System
 } // namespace cil2cpp
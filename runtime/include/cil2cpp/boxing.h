@@ -6,6 +6,7 @@
 #pragma once
 
 #include "object.h"
+#include "type_info.h"
 #include "gc.h"
 #include "exception.h"
 #include <cstring>
@@ -13,11 +14,57 @@
 namespace cil2cpp {
 
 /**
- * Box a value type. Allocates on GC heap.
+ * Shared boxes for small primitive values.
+ *
+ * box<T> returns one preallocated box per value for Boolean, Byte, Char
+ * 0-127 and Int32 -128..1023, so `true`, `0` or `'a'` passed to an object
+ * parameter (string.Format, Console.WriteLine(object), ArrayList) does not
+ * allocate. Identity differs from .NET — two boxes of the same cached value
+ * are the same object, so ReferenceEquals((object)1, (object)1) is true and
+ * Monitor.Enter on such a box shares its lock with every other user.
+ *
+ * Known semantic difference: the cached boxes are not protected against
+ * writes. `unbox` (unbox_ptr) and Unsafe.Unbox<T> return a writable pointer
+ * into the box, and a write through it into a shared box (say, the one for
+ * `1`) changes the value every other holder of that box sees. C# only
+ * produces such writes through Unsafe.Unbox or hand-written IL.
+ */
+namespace box_cache {
+
+template<typename T> struct Range { static constexpr bool cached = false; };
+template<> struct Range<Boolean> { static constexpr bool cached = true; static constexpr Int32 min = 0, max = 1; };
+template<> struct Range<Byte> { static constexpr bool cached = true; static constexpr Int32 min = 0, max = 255; };
+template<> struct Range<Char> { static constexpr bool cached = true; static constexpr Int32 min = 0, max = 127; };
+template<> struct Range<Int32> { static constexpr bool cached = true; static constexpr Int32 min = -128, max = 1023; };
+
+/**
+ * Shared box of `value` (within Range<T>) for primitive `type`. The table is
+ * built on the first call for that TypeInfo and kept in type->small_boxes.
+ */
+template<typename T>
+Object* lookup(TypeInfo* type, Int32 value);
+
+extern template Object* lookup<Boolean>(TypeInfo*, Int32);
+extern template Object* lookup<Byte>(TypeInfo*, Int32);
+extern template Object* lookup<Char>(TypeInfo*, Int32);
+extern template Object* lookup<Int32>(TypeInfo*, Int32);
+
+} // namespace box_cache
+
+/**
+ * Box a value type. Allocates on GC heap, except for small primitive values
+ * which come from box_cache (enums share the C++ type but not the Primitive flag).
  * Layout: [Object header] [value data]
  */
 template<typename T>
 inline Object* box(T value, TypeInfo* type) {
+    if constexpr (box_cache::Range<T>::cached) {
+        auto v = static_cast<Int32>(value);
+        if (v >= box_cache::Range<T>::min && v <= box_cache::Range<T>::max
+            && (type->flags & TypeFlags::Primitive)) {
+            return box_cache::lookup<T>(type, v);
+        }
+    }
     Object* obj = static_cast<Object*>(gc::alloc(sizeof(Object) + sizeof(T), type));
     *reinterpret_cast<T*>(reinterpret_cast<char*>(obj) + sizeof(Object)) = value;
     return obj;
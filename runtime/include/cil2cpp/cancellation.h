@@ -15,6 +15,9 @@ namespace cil2cpp {
 
 struct Task;
 
+/** A callback registered with ct_register (opaque). */
+struct CancellationRegistration;
+
 /**
  * CancellationTokenSource (reference type, GC-allocated).
  * Inlines Object header fields to avoid MSVC tail-padding issues.
@@ -23,6 +26,7 @@ struct CancellationTokenSource {
     TypeInfo* __type_info;
     UInt32 __sync_block;
     Int32 f__state;       // 0 = active, 1 = canceled, 2 = disposed
+    CancellationRegistration* f__registrations;   // run (newest first) by cts_cancel
 };
 
 /**
@@ -39,7 +43,7 @@ struct CancellationToken {
 /** Create a new CancellationTokenSource (state=active). */
 CancellationTokenSource* cts_create();
 
-/** Cancel the token source (sets state=1, thread-safe). */
+/** Cancel the token source (sets state=1, thread-safe) and run its registered callbacks. */
 void cts_cancel(CancellationTokenSource* cts);
 
 /** Cancel after a delay in milliseconds (thread pool). */
@@ -80,6 +84,23 @@ inline CancellationToken ct_get_none() {
     return CancellationToken{ nullptr };
 }
 
+using CancellationCallback = void (*)(void* state);
+
+/**
+ * Run `callback(state)` on the thread that cancels `token`. Returns nullptr
+ * (and never runs the callback) if the token is already canceled or can no
+ * longer be canceled; check ct_is_cancellation_requested to tell them apart.
+ * Never runs the callback synchronously, so it may be called under a lock the
+ * callback takes.
+ */
+CancellationRegistration* ct_register(CancellationToken token, CancellationCallback callback, void* state);
+
+/**
+ * Drop a registration (nullptr is ignored). A callback that cancellation
+ * already started may still run.
+ */
+void ct_unregister(CancellationRegistration* registration);
+
 // ===== TaskCompletionSource API =====
 // TaskCompletionSource<T> is essentially a wrapper around Task<T>.
 // The compiler generates monomorphized types; these functions operate on Task*.
@@ -0,0 +1,113 @@
+/**
+ * CIL2CPP Runtime - System.Threading.Channels
+ *
+ * Channel<T> for producer/consumer pipelines. A channel is one runtime object
+ * (Channel, GC-allocated) that also serves as its ChannelReader<T> and
+ * ChannelWriter<T>; the element type is erased to its size, so the same code
+ * backs every Channel<T> specialization.
+ *
+ *  - Bounded channels (Channel.CreateBounded) store items in a lock-free MPMC
+ *    ring: a sequence number per cell hands each cell back and forth between
+ *    producers and consumers without locking.
+ *  - Unbounded channels (Channel.CreateUnbounded) store items in a linked list
+ *    of segments (32 slots, doubling up to 1024); producers claim slots with a
+ *    fetch_add and never wait.
+ *
+ * TryRead/TryWrite and ReadAsync/WriteAsync calls that find an item (or free
+ * space) never lock or allocate: the ValueTask carries the result directly.
+ * Otherwise the caller is parked as a waiter under the channel's lock with a
+ * pending Task, and the producer or consumer that makes progress completes it,
+ * so the awaiting state machine resumes through the task's continuations.
+ * Canceling the call's CancellationToken removes a parked waiter and faults
+ * its Task with OperationCanceledException; an already-canceled token fails
+ * the call up front.
+ */
+
+#pragma once
+
+#include "object.h"
+#include "exception.h"
+#include "task.h"
+#include "cancellation.h"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace cil2cpp {
+
+/** Channel object behind Channel<T>, ChannelReader<T> and ChannelWriter<T> (opaque). */
+struct Channel;
+
+/** Channel.CreateBounded<T>(capacity): FullMode Wait, any number of readers and writers. */
+Channel* channel_create_bounded(Int32 capacity, Int32 element_size);
+
+/** Channel.CreateUnbounded<T>(). */
+Channel* channel_create_unbounded(Int32 element_size);
+
+/** ChannelWriter.TryWrite: false if the channel is full or completed. */
+bool channel_try_write(Channel* c, const void* item);
+
+/** ChannelReader.TryRead: false if no item is available. */
+bool channel_try_read(Channel* c, void* item);
+
+/**
+ * ChannelWriter.WriteAsync. Returns nullptr once the item is in the channel;
+ * otherwise a pending Task that completes when a reader makes room, or a
+ * faulted Task (ChannelClosedException) if the channel is completed.
+ */
+Task* channel_write_async(Channel* c, const void* item, CancellationToken token);
+
+/**
+ * ChannelReader.ReadAsync. Returns nullptr after copying an available item to
+ * `item`; otherwise a Task of `task_size` bytes whose result (at
+ * `result_offset`) receives the next item, faulted with ChannelClosedException
+ * once the channel is completed and empty.
+ */
+Task* channel_read_async(Channel* c, void* item, size_t task_size, size_t result_offset,
+                         CancellationToken token);
+
+/**
+ * ChannelReader.WaitToReadAsync. Returns nullptr with `*ready` set when the
+ * answer is known (an item is available: true; completed and empty: false);
+ * otherwise a pending Task<bool> of `task_size` bytes.
+ */
+Task* channel_wait_to_read_async(Channel* c, bool* ready, size_t task_size, size_t result_offset,
+                                 CancellationToken token);
+
+/**
+ * ChannelWriter.TryComplete(error): no more items will be written. Pending
+ * writers fault; pending readers fault (WaitToReadAsync: false) once the
+ * remaining items are read. Returns false if already completed.
+ */
+bool channel_try_complete(Channel* c, Exception* error);
+
+/** ChannelWriter.Complete(error): like TryComplete, throws ChannelClosedException if already completed. */
+void channel_complete(Channel* c, Exception* error);
+
+/**
+ * ChannelReader.Completion: completes once the channel is completed and all
+ * items are read (faulted with the completion error, if any).
+ */
+Task* channel_get_completion(Channel* c);
+
+/** ChannelReader.ReadAsync returning ValueTask<T> (TValueTask is the generated struct). */
+template <typename TValueTask>
+TValueTask channel_read_async(Channel* c, CancellationToken token) {
+    using TTask = std::remove_pointer_t<decltype(TValueTask::f_task)>;
+    TValueTask vt = {};
+    vt.f_task = reinterpret_cast<TTask*>(
+        channel_read_async(c, &vt.f_result, sizeof(TTask), offsetof(TTask, f_result), token));
+    return vt;
+}
+
+/** ChannelReader.WaitToReadAsync returning ValueTask<bool>. */
+template <typename TValueTask>
+TValueTask channel_wait_to_read_async(Channel* c, CancellationToken token) {
+    using TTask = std::remove_pointer_t<decltype(TValueTask::f_task)>;
+    TValueTask vt = {};
+    vt.f_task = reinterpret_cast<TTask*>(
+        channel_wait_to_read_async(c, &vt.f_result, sizeof(TTask), offsetof(TTask, f_result), token));
+    return vt;
+}
+
+} // namespace cil2cpp
@@ -8,6 +8,12 @@
 #include "types.h"
 #include "object.h"
 #include "string.h"
+#include "simd.h"
+#include "vector_ops.h"
+#include "utf.h"
+#include "string_search.h"
+#include "format.h"
+#include "string_builder.h"
 #include "array.h"
 #include "mdarray.h"
 #include "stackalloc.h"
@@ -23,9 +29,14 @@
 #include "cancellation.h"
 #include "async_enumerable.h"
 #include "threading.h"
+#include "synchronization.h"
 #include "reflection.h"
 #include "memberinfo.h"
 #include "collections.h"
+#include "linq.h"
+#include "parallel.h"
+#include "channel.h"
+#include "threadlocal.h"
 
 // BCL types
 #include "bcl/System.Object.h"
@@ -37,9 +48,11 @@ namespace cil2cpp {
 
 /**
  * Initialize the CIL2CPP runtime.
- * Must be called before any other runtime functions.
+ * Must be called before any other runtime functions. `gc_config` carries
+ * the settings compiled into the program; CIL2CPP_GC_* environment
+ * variables override them (gc::config_from_environment).
  */
-void runtime_init();
+void runtime_init(const gc::GCConfig& gc_config = gc::GCConfig{});
 
 /**
  * Shutdown the CIL2CPP runtime.
@@ -60,11 +73,16 @@ inline int32_t math_sign_f64(double x) { return (x > 0.0) - (x < 0.0); }
 void System_Object__ctor(void* obj);
 inline void System_Object_Finalize(void*) {} // Finalize is a no-op for System.Object
 
-// Entry point macro for generated code
-#define CIL2CPP_MAIN(EntryClass, EntryMethod) \
+// Entry point macros for generated code. The variadic part of
+// CIL2CPP_MAIN_WITH_GC is the program's cil2cpp::gc::GCConfig, e.g.
+// cil2cpp::gc::GCConfig{.max_heap_size = 512 << 20, .incremental = false}
+#define CIL2CPP_MAIN_WITH_GC(EntryClass, EntryMethod, ...) \
     int main(int argc, char* argv[]) { \
-        cil2cpp::runtime_init(); \
+        cil2cpp::runtime_init(__VA_ARGS__); \
         EntryMethod(); \
         cil2cpp::runtime_shutdown(); \
         return 0; \
     }
+
+#define CIL2CPP_MAIN(EntryClass, EntryMethod) \
+    CIL2CPP_MAIN_WITH_GC(EntryClass, EntryMethod, cil2cpp::gc::GCConfig{})
@@ -138,10 +138,13 @@ void dict_clear(void* dict);
 
 // ===== Element comparison helpers =====
 
-/** Compare two elements using vtable Equals for ref types, memcmp for value types. */
+/** Compare two elements: vtable Equals for ref types; TypeInfo::value_equals, else memcmp, for value types. */
 Boolean element_equals(const void* a, const void* b, TypeInfo* type);
 
-/** Hash an element using vtable GetHashCode for ref types, FNV-1a for value types. */
+/** Hash an element: vtable GetHashCode for ref types; TypeInfo::value_hash, else FNV-1a, for value types. */
 Int32 element_hash(const void* element, TypeInfo* type);
 
+/** ValueType.Equals(object) on an unboxed value: other must be a boxed value of the same type with equal contents. */
+Boolean value_type_equals(const void* value, Object* other, TypeInfo* type);
+
 } // namespace cil2cpp
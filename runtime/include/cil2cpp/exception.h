@@ -42,9 +42,17 @@ struct TypeInitializationException : Exception {};
 struct TimeoutException : Exception {};
 
 // --- Task-related exceptions ---
-struct AggregateException : Exception {};
+struct AggregateException : Exception {
+    Array* inner_exceptions;    // Exception*[]; inner_exception is its first element
+};
 struct OperationCanceledException : Exception {};
 struct TaskCanceledException : OperationCanceledException {};
+struct ChannelClosedException : InvalidOperationException {};
+
+// --- Synchronization primitives ---
+struct SemaphoreFullException : Exception {};
+struct SynchronizationLockException : Exception {};
+struct LockRecursionException : Exception {};
 
 // --- IO ---
 struct IOException : Exception {};
@@ -117,6 +125,35 @@ extern thread_local ExceptionContext* g_exception_context;
 [[noreturn]] void throw_array_type_mismatch();
 [[noreturn]] void throw_type_initialization(const char* type_name);
 [[noreturn]] void throw_operation_canceled();
+[[noreturn]] void throw_semaphore_full();
+[[noreturn]] void throw_synchronization_lock();
+[[noreturn]] void throw_lock_recursion();
+
+/**
+ * Create an AggregateException wrapping `count` exceptions (not thrown).
+ */
+AggregateException* aggregate_exception_create(Exception* const* inner, Int32 count);
+
+/**
+ * AggregateException.Flatten: a new AggregateException holding the inner exceptions
+ * of `ex` and of every AggregateException nested in it (not thrown).
+ */
+AggregateException* aggregate_exception_flatten(AggregateException* ex);
+
+/**
+ * AggregateException.Handle: call predicate(ctx, inner) for every inner exception,
+ * then throw a new AggregateException with the ones it returned false for.
+ */
+void aggregate_exception_handle(AggregateException* ex, bool (*predicate)(void* ctx, Exception* inner), void* ctx);
+
+/** Create an OperationCanceledException ("The operation was canceled.", not thrown). */
+Exception* operation_canceled_exception_create();
+
+/**
+ * Create a ChannelClosedException ("The channel has been closed.") wrapping
+ * the exception the channel was completed with, if any (not thrown).
+ */
+ChannelClosedException* channel_closed_exception_create(Exception* inner);
 [[noreturn]] void throw_platform_not_supported();
 [[noreturn]] void throw_io_exception(const char* message);
 [[noreturn]] void throw_file_not_found(const char* path);
@@ -165,6 +202,10 @@ extern TypeInfo TimeoutException_TypeInfo;
 extern TypeInfo AggregateException_TypeInfo;
 extern TypeInfo OperationCanceledException_TypeInfo;
 extern TypeInfo TaskCanceledException_TypeInfo;
+extern TypeInfo ChannelClosedException_TypeInfo;
+extern TypeInfo SemaphoreFullException_TypeInfo;
+extern TypeInfo SynchronizationLockException_TypeInfo;
+extern TypeInfo LockRecursionException_TypeInfo;
 extern TypeInfo KeyNotFoundException_TypeInfo;
 extern TypeInfo IOException_TypeInfo;
 extern TypeInfo FileNotFoundException_TypeInfo;
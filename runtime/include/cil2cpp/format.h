@@ -0,0 +1,148 @@
+/**
+ * CIL2CPP Runtime - Composite and numeric formatting
+ *
+ * One engine behind String.Format, StringBuilder.AppendFormat and the
+ * primitive ToString() / ToString(format) overloads. Format items
+ * ({index[,alignment][:formatString]}) are parsed in a single pass and each
+ * argument is formatted straight into one UTF-16 output buffer; the result
+ * String is allocated once at the end.
+ *
+ * Arguments are FormatArg values, so generated code can pass primitives
+ * unboxed. Boxed primitives arriving through object[] are unwrapped and take
+ * the same path.
+ *
+ * Numbers follow .NET's invariant culture:
+ *  - integers: digits are generated two at a time from a lookup table;
+ *  - floating point: ToString()/"G"/"R" print the shortest string that
+ *    round-trips (std::to_chars), with .NET's choice between fixed and
+ *    scientific notation; precision specifiers are correctly rounded;
+ *  - standard formats C, D, E, F, G, N, P, R, X, and custom formats built
+ *    from 0 # . , % and literals (with ';' sections).
+ * There is no DateTime in the runtime, so no date/time format strings.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "object.h"
+#include "string.h"
+#include "array.h"
+
+#include <concepts>
+#include <type_traits>
+
+namespace cil2cpp {
+
+/**
+ * One argument of a composite format: a primitive held by value or an
+ * object reference.
+ */
+struct FormatArg {
+    enum class Kind : Byte { Object, Signed, Unsigned, Single, Double, Boolean, Char };
+
+    Kind kind;
+    Byte size;                      // Integer width in bytes (X of negative values)
+    union {
+        Object* object;
+        Int64 i;
+        UInt64 u;
+        Single f;
+        Double d;
+        Boolean b;
+        Char c;
+    };
+
+    FormatArg(Object* value) : kind(Kind::Object), size(0), object(value) {}
+    FormatArg(String* value) : kind(Kind::Object), size(0), object(reinterpret_cast<Object*>(value)) {}
+    FormatArg(std::nullptr_t) : kind(Kind::Object), size(0), object(nullptr) {}
+    FormatArg(Single value) : kind(Kind::Single), size(4), f(value) {}
+    FormatArg(Double value) : kind(Kind::Double), size(8), d(value) {}
+    FormatArg(Boolean value) : kind(Kind::Boolean), size(1), b(value) {}
+    FormatArg(Char value) : kind(Kind::Char), size(2), c(value) {}
+
+    template<std::signed_integral T>
+    FormatArg(T value) : kind(Kind::Signed), size(sizeof(T)), i(value) {}
+
+    template<std::unsigned_integral T>
+        requires (!std::same_as<T, Boolean> && !std::same_as<T, Char>)
+    FormatArg(T value) : kind(Kind::Unsigned), size(sizeof(T)), u(value) {}
+
+    /** Unwrap a boxed primitive; any other object stays a reference. */
+    static FormatArg from_object(Object* obj);
+};
+
+namespace format {
+
+/** Longest output of the value-only formatters below (e.g. "-1.7976931348623157E+308"). */
+constexpr Int32 MAX_NUMBER_CHARS = 32;
+
+/**
+ * Default ToString() renderings as ASCII into out[0..MAX_NUMBER_CHARS).
+ * Return the number of characters written.
+ */
+Int32 format_int64(char* out, Int64 value);
+Int32 format_uint64(char* out, UInt64 value);
+Int32 format_double(char* out, Double value);
+Int32 format_single(char* out, Single value);
+
+/**
+ * Growable UTF-16 output buffer. Starts in inline storage, so short results
+ * never touch the heap before the final String.
+ */
+class Writer {
+public:
+    Writer() : buf_(inline_), len_(0), cap_(INLINE_CHARS) {}
+    ~Writer();
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    /** Make room for n more characters and return where they go; commit() after writing. */
+    Char* reserve(Int32 n) {
+        if (cap_ - len_ < n) grow(n);
+        return buf_ + len_;
+    }
+    void commit(Int32 n) { len_ += n; }
+
+    void put(Char c) { *reserve(1) = c; len_++; }
+    void put(const Char* s, Int32 n);
+    void put_ascii(const char* s, Int32 n);
+    void fill(Char c, Int32 n);
+    /** Insert n copies of c at position pos (right alignment). */
+    void insert_fill(Int32 pos, Char c, Int32 n);
+
+    const Char* data() const { return buf_; }
+    Int32 size() const { return len_; }
+
+    String* to_string() const;
+
+private:
+    static constexpr Int32 INLINE_CHARS = 256;
+    void grow(Int32 n);
+
+    Char inline_[INLINE_CHARS];
+    Char* buf_;
+    Int32 len_;
+    Int32 cap_;
+};
+
+/**
+ * Format one value as for {0:spec} (spec may be empty). Throws FormatException
+ * for format strings the value's type rejects (e.g. "X" on a double).
+ */
+void format_value(Writer& out, const FormatArg& arg, const Char* spec, Int32 spec_len);
+
+/**
+ * Expand a composite format string. Throws ArgumentNullException for a null
+ * format and FormatException for malformed items or out-of-range indices.
+ */
+void composite(Writer& out, String* format, const FormatArg* args, Int32 count);
+
+/** Same, with an object[] argument list (boxed primitives are unwrapped). */
+void composite(Writer& out, String* format, Array* args);
+
+} // namespace format
+
+/** String.Format with arguments that need not be boxed. */
+String* string_format(String* format, const FormatArg* args, Int32 count);
+
+} // namespace cil2cpp
@@ -10,17 +10,49 @@ namespace cil2cpp {
 namespace gc {
 
 /**
- * GC configuration options.
- * BoehmGC manages heap sizing automatically; this struct is kept
- * for API compatibility.
+ * GC tuning, applied once by init. Zero / -1 leave BoehmGC's default.
+ * Each field can be overridden at startup by the environment variable
+ * named beside it (see config_from_environment); sizes accept K/M/G.
+ */
+struct GCConfig {
+    // CIL2CPP_GC_INITIAL_HEAP: bytes to grow the heap to at startup, so
+    // a service with a known working set skips the early collections.
+    size_t initial_heap_size = 0;
+    // CIL2CPP_GC_MAX_HEAP: hard heap limit; allocation fails past it. 0 = unlimited.
+    size_t max_heap_size = 0;
+    // CIL2CPP_GC_FREE_SPACE_DIVISOR: the heap grows instead of collecting
+    // once free space drops below heap / divisor. Higher = smaller heap and
+    // more collections; lower = more throughput. 0 = default (3).
+    UInt32 free_space_divisor = 0;
+    // CIL2CPP_GC_MARKERS: marking threads, the collecting thread included.
+    // 0 = one per core; 1 = serial marking. Only read before the first init.
+    Int32 parallel_markers = 0;
+    // CIL2CPP_GC_INCREMENTAL: incremental, generational (dirty-bit)
+    // collection for shorter pauses; false keeps stop-the-world full
+    // collections, which have the best throughput. Cannot be turned off
+    // once enabled in a process.
+    bool incremental = true;
+    // CIL2CPP_GC_FULL_FREQUENCY: partial collections between full ones in
+    // incremental mode. -1 = default (19).
+    Int32 full_collection_frequency = -1;
+};
+
+/**
+ * Apply the CIL2CPP_GC_* environment variables on top of `config`.
+ * Unparsable values are reported on stderr and ignored.
  */
-struct GCConfig {};
+GCConfig config_from_environment(GCConfig config);
 
 /**
  * Initialize the garbage collector.
  */
 void init(const GCConfig& config = GCConfig{});
 
+/**
+ * The configuration passed to the last init.
+ */
+GCConfig current_config();
+
 /**
  * Shutdown the garbage collector.
  */
@@ -42,15 +74,31 @@ void* alloc(size_t size, TypeInfo* type);
  */
 void* alloc_array(TypeInfo* element_type, size_t length);
 
+/**
+ * Allocate zeroed memory that the collector scans for references but never
+ * frees on its own. Used by runtime-owned pools; release with free_uncollectable.
+ */
+void* alloc_uncollectable(size_t size);
+
+/**
+ * Free memory returned by alloc_uncollectable.
+ */
+void free_uncollectable(void* memory);
+
 /**
  * Trigger a full garbage collection cycle.
  */
 void collect();
 
+/**
+ * Drop the finalizer registered for obj at allocation (GC.SuppressFinalize).
+ */
+void suppress_finalize(Object* obj);
+
 /**
  * Enable or disable incremental garbage collection.
  * Incremental mode spreads collection work across multiple small steps,
- * reducing pause times. Enabled by default at init.
+ * reducing pause times. Enabled at init unless GCConfig::incremental is false.
  * Note: BoehmGC does not support disabling incremental mode once enabled.
  */
 void set_incremental(bool enabled);
@@ -74,6 +122,17 @@ void register_thread();
  */
 void unregister_thread();
 
+/**
+ * Register a block of per-thread storage (a thread_local struct such as a
+ * type's [ThreadStatic] fields) as a root on every thread; `block` returns
+ * the calling thread's copy. Each thread adds its copies in register_thread
+ * (the main thread in init) and drops them in unregister_thread; the
+ * collector pushes them while marking, so they use no BoehmGC root sets. Blocks
+ * registered after init reach the calling thread only, so register them
+ * before runtime_init.
+ */
+void register_thread_static_block(void* (*block)(), size_t size);
+
 /**
  * Add a root reference (no-op -BoehmGC scans roots automatically).
  */
@@ -93,14 +152,32 @@ inline void write_barrier(Object* obj, Object* value) {
 }
 
 /**
- * GC statistics.
+ * Stop-the-world pause histogram: bucket i counts pauses shorter than
+ * pause_bucket_limit_us(i) (64us, 128us, ... doubling); the last bucket
+ * also takes everything longer.
+ */
+constexpr int kPauseHistogramBuckets = 12;
+
+constexpr UInt64 pause_bucket_limit_us(int bucket) {
+    return UInt64{64} << bucket;
+}
+
+/**
+ * GC statistics. Pause figures come from the collector's event callback
+ * (each stop-the-world window, incremental steps included); heap figures
+ * are read from BoehmGC at the time of the call.
  */
 struct GCStats {
-    size_t total_allocated;
-    size_t total_freed;
-    size_t current_heap_size;
+    size_t total_allocated;    // bytes allocated since startup
+    size_t total_freed;        // total_allocated - heap_in_use (reclaimed so far)
+    size_t current_heap_size;  // bytes the heap has mapped (unmapped pages excluded)
+    size_t free_bytes;         // free bytes inside the mapped heap
+    size_t heap_in_use;        // current_heap_size - free_bytes (live + not yet swept)
     size_t collection_count;
+    size_t pause_count;
     double total_pause_time_ms;
+    double max_pause_time_ms;
+    size_t pause_histogram[kPauseHistogramBuckets];
 };
 
 /**
@@ -108,5 +185,16 @@ struct GCStats {
  */
 GCStats get_stats();
 
+/**
+ * Number of collections so far; cheaper than get_stats for polling.
+ */
+size_t collection_count();
+
+/**
+ * Bytes allocated through alloc/alloc_array by the calling thread.
+ * A plain thread_local counter; stack-allocated objects are not counted.
+ */
+UInt64 allocated_bytes_for_current_thread();
+
 } // namespace gc
 } // namespace cil2cpp
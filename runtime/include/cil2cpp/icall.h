@@ -22,6 +22,17 @@ Int64 Environment_get_TickCount64();
 Int32 Environment_get_ProcessorCount();
 Int32 Environment_get_CurrentManagedThreadId();
 
+// System.GC
+void GC_Collect();
+void GC_Collect(Int32 generation);
+void GC_Collect(Int32 generation, Int32 mode);
+Int64 GC_GetTotalMemory(bool forceFullCollection);
+Int32 GC_CollectionCount(Int32 generation);
+Int64 GC_GetAllocatedBytesForCurrentThread();
+Int64 GC_GetTotalAllocatedBytes(bool precise);
+void GC_SuppressFinalize(Object* obj);
+void GC_KeepAlive(Object* obj);
+
 // System.Buffer
 void Buffer_Memmove(void* dest, void* src, UInt64 len);
 void Buffer_BlockCopy(Object* src, Int32 srcOffset, Object* dst, Int32 dstOffset, Int32 count);
@@ -39,19 +50,6 @@ inline bool Monitor_Wait(Object* obj) { return Monitor_Wait(obj, -1); }
 void Monitor_Pulse(Object* obj);
 void Monitor_PulseAll(Object* obj);
 
-// System.Threading.Interlocked
-Int32 Interlocked_Increment_i32(Int32* location);
-Int32 Interlocked_Decrement_i32(Int32* location);
-Int32 Interlocked_Exchange_i32(Int32* location, Int32 value);
-Int32 Interlocked_CompareExchange_i32(Int32* location, Int32 value, Int32 comparand);
-Int32 Interlocked_Add_i32(Int32* location, Int32 value);
-Int64 Interlocked_Increment_i64(Int64* location);
-Int64 Interlocked_Decrement_i64(Int64* location);
-Int64 Interlocked_Exchange_i64(Int64* location, Int64 value);
-Int64 Interlocked_CompareExchange_i64(Int64* location, Int64 value, Int64 comparand);
-Object* Interlocked_Exchange_obj(Object** location, Object* value);
-Object* Interlocked_CompareExchange_obj(Object** location, Object* value, Object* comparand);
-
 // System.ArgumentNullException
 void ArgumentNullException_ThrowIfNull(Object* arg, String* paramName);
 
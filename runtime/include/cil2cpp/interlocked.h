@@ -0,0 +1,138 @@
+/**
+ * CIL2CPP Runtime - Interlocked and Volatile
+ *
+ * System.Threading.Interlocked and System.Threading.Volatile over
+ * std::atomic_ref, header-only so that generated code gets the atomic
+ * instruction inline (lock xadd / lock cmpxchg / ldaxr..) instead of a call.
+ *
+ * Read-modify-write operations are sequentially consistent, as .NET
+ * documents Interlocked as a full fence. Volatile.Read is an acquire load and
+ * Volatile.Write a release store. Integer arithmetic wraps on overflow like
+ * the CLR (no UB on signed overflow).
+ */
+
+#pragma once
+
+#include "object.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace cil2cpp {
+namespace interlocked {
+
+template <typename T>
+using Arg = std::type_identity_t<T>;
+
+template <typename T>
+inline std::atomic_ref<T> ref(T* location) {
+    static_assert(std::atomic_ref<T>::is_always_lock_free,
+                  "Interlocked operations must be a single atomic instruction");
+    return std::atomic_ref<T>(*location);
+}
+
+// Two's-complement a + b without signed-overflow UB
+template <typename T>
+inline T wrapping_add(T a, T b) {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+}
+
+// ===== Arithmetic (Int32, UInt32, Int64, UInt64): return the new value =====
+
+template <typename T>
+inline T add(T* location, Arg<T> value) {
+    return wrapping_add(ref(location).fetch_add(value, std::memory_order_seq_cst), value);
+}
+
+template <typename T>
+inline T increment(T* location) {
+    return add<T>(location, 1);
+}
+
+template <typename T>
+inline T decrement(T* location) {
+    return wrapping_add<T>(ref(location).fetch_sub(1, std::memory_order_seq_cst), static_cast<T>(-1));
+}
+
+// ===== Bitwise (Int32, UInt32, Int64, UInt64): return the original value =====
+
+template <typename T>
+inline T and_(T* location, Arg<T> value) {
+    return ref(location).fetch_and(value, std::memory_order_seq_cst);
+}
+
+template <typename T>
+inline T or_(T* location, Arg<T> value) {
+    return ref(location).fetch_or(value, std::memory_order_seq_cst);
+}
+
+// ===== Exchange / CompareExchange (integers, Single, Double, IntPtr, references) =====
+
+template <typename T>
+inline T exchange(T* location, Arg<T> value) {
+    return ref(location).exchange(value, std::memory_order_seq_cst);
+}
+
+/// Store value if *location equals comparand (bitwise for Single/Double);
+/// returns the original value either way.
+template <typename T>
+inline T compare_exchange(T* location, Arg<T> value, Arg<T> comparand) {
+    ref(location).compare_exchange_strong(comparand, value, std::memory_order_seq_cst);
+    return comparand;
+}
+
+/// Interlocked.Read: an atomic 64-bit load, also on 32-bit targets.
+template <typename T>
+inline T read(T* location) {
+    return ref(location).load(std::memory_order_seq_cst);
+}
+
+inline void memory_barrier() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+/// Interlocked.MemoryBarrierProcessWide. There is no portable way to fence
+/// other threads (FlushProcessWriteBuffers / membarrier); a full fence on the
+/// calling thread is what is left once all shared accesses are atomic.
+inline void memory_barrier_process_wide() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+// ===== Volatile =====
+
+template <typename T>
+inline T volatile_read(T* location) {
+    return ref(location).load(std::memory_order_acquire);
+}
+
+template <typename T>
+inline void volatile_write(T* location, Arg<T> value) {
+    ref(location).store(value, std::memory_order_release);
+}
+
+// ===== Typed entry points (runtime callers and generic reference-type calls) =====
+
+inline Int32 increment_i32(Int32* location) { return increment(location); }
+inline Int32 decrement_i32(Int32* location) { return decrement(location); }
+inline Int32 exchange_i32(Int32* location, Int32 value) { return exchange(location, value); }
+inline Int32 compare_exchange_i32(Int32* location, Int32 value, Int32 comparand) {
+    return compare_exchange(location, value, comparand);
+}
+inline Int32 add_i32(Int32* location, Int32 value) { return add(location, value); }
+
+inline Int64 increment_i64(Int64* location) { return increment(location); }
+inline Int64 decrement_i64(Int64* location) { return decrement(location); }
+inline Int64 exchange_i64(Int64* location, Int64 value) { return exchange(location, value); }
+inline Int64 compare_exchange_i64(Int64* location, Int64 value, Int64 comparand) {
+    return compare_exchange(location, value, comparand);
+}
+inline Int64 add_i64(Int64* location, Int64 value) { return add(location, value); }
+
+inline Object* exchange_obj(Object** location, Object* value) { return exchange(location, value); }
+inline Object* compare_exchange_obj(Object** location, Object* value, Object* comparand) {
+    return compare_exchange(location, value, comparand);
+}
+
+} // namespace interlocked
+} // namespace cil2cpp
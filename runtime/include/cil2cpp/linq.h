@@ -0,0 +1,575 @@
+/**
+ * CIL2CPP Runtime - LINQ query execution
+ *
+ * The compiler fuses a chain of System.Linq.Enumerable operators such as
+ * xs.Where(p).Select(f).Sum() into a single loop body and hands it to
+ * linq_for_each, which walks the source once without materializing anything
+ * in between. The source is classified once per query:
+ *  - List<T>: the exact List<T> TypeInfo, passed by the compiler. Modifying
+ *    the list during the query throws, as List<T>.Enumerator does.
+ *  - A user IEnumerable<T> (iterator methods, custom collections): walked
+ *    through the BCL interface proxies when the compiler passes them.
+ *  - Anything else is an array (T[]) and is walked by pointer.
+ *
+ * Sum, Min, Max, Average and Contains over an unfiltered array or list of a
+ * primitive type skip the loop body entirely and run the vector kernels of
+ * vector_ops.h on the contiguous storage.
+ *
+ * A Where/Select chain whose result escapes the method becomes a deferred
+ * query object (LinqDeferredType): an IEnumerable<T> whose enumerator pulls
+ * one source element at a time through the fused stages.
+ */
+
+#pragma once
+
+#include "array.h"
+#include "boxing.h"
+#include "checked.h"
+#include "collections.h"
+#include "exception.h"
+#include "reflection.h"
+#include "type_info.h"
+#include "vector_ops.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+namespace cil2cpp {
+
+/**
+ * Interface TypeInfos for enumerating a user IEnumerable<T>.
+ * Method slots follow the proxy layout: IEnumerable<T>.GetEnumerator,
+ * IEnumerator.MoveNext, IEnumerator<T>.get_Current and IDisposable.Dispose
+ * are each slot 0 of their interface.
+ */
+struct LinqEnumerableTypes {
+    TypeInfo* enumerable;       // IEnumerable<T>
+    TypeInfo* enumerator;       // IEnumerator<T>
+    TypeInfo* enumerator_base;  // IEnumerator
+    TypeInfo* disposable;       // IDisposable (nullptr if not in the module)
+};
+
+namespace detail {
+
+inline ListBase* linq_as_list(Object* source, TypeInfo* list_type) {
+    return list_type && source->__type_info == list_type ? static_cast<ListBase*>(source) : nullptr;
+}
+
+inline InterfaceVTable* linq_as_enumerable(Object* source, const LinqEnumerableTypes* types) {
+    return types ? type_get_interface_vtable(source->__type_info, types->enumerable) : nullptr;
+}
+
+/** IDisposable.Dispose on a finished enumerator, as foreach does. */
+inline void linq_dispose(Object* e, const LinqEnumerableTypes* types) {
+    if (!types->disposable) return;
+    if (auto* dispose = type_get_interface_vtable(e->__type_info, types->disposable))
+        reinterpret_cast<void (*)(Object*)>(dispose->methods[0])(e);
+}
+
+/** Run an IEnumerable<T> source's enumerator; body returns false to stop early. */
+template<typename T, typename Body>
+void linq_enumerate(Object* source, InterfaceVTable* vtable, const LinqEnumerableTypes* types, Body&& body) {
+    auto* e = reinterpret_cast<Object* (*)(Object*)>(vtable->methods[0])(source);
+    if (!e) throw_null_reference();
+    auto move_next = reinterpret_cast<Boolean (*)(Object*)>(
+        type_get_interface_vtable_checked(e->__type_info, types->enumerator_base)->methods[0]);
+    auto current = reinterpret_cast<T (*)(Object*)>(
+        type_get_interface_vtable_checked(e->__type_info, types->enumerator)->methods[0]);
+    while (move_next(e) && body(current(e))) {
+    }
+    linq_dispose(e, types);
+}
+
+} // namespace detail
+
+/**
+ * Walk a LINQ source, calling body(element) until it returns false.
+ * @param list_type TypeInfo of List<T>, or nullptr if List<T> is not in the module
+ * @param enumerable Proxy interfaces for user IEnumerable<T> sources, or nullptr
+ */
+template<typename T, typename Body>
+void linq_for_each(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable, Body&& body) {
+    if (!source) throw_argument_null();
+    if (auto* list = detail::linq_as_list(source, list_type)) {
+        const Int32 version = list->version;
+        for (Int32 i = 0; i < list->count; i++) {
+            if (!body(static_cast<T*>(list->items)[i])) return;
+            if (list->version != version) throw_invalid_operation();
+        }
+        return;
+    }
+    if (auto* vtable = detail::linq_as_enumerable(source, enumerable)) {
+        detail::linq_enumerate<T>(source, vtable, enumerable, body);
+        return;
+    }
+    auto* arr = static_cast<Array*>(source);
+    const T* data = static_cast<const T*>(array_data(arr));
+    for (Int32 i = 0, n = arr->length; i < n; i++) {
+        if (!body(data[i])) return;
+    }
+}
+
+/**
+ * Number of elements in a LINQ source: O(1) for arrays and lists,
+ * a full enumeration for other IEnumerable<T> sources.
+ */
+inline Int32 linq_count(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    if (!source) throw_argument_null();
+    if (auto* list = detail::linq_as_list(source, list_type)) return list->count;
+    if (auto* vtable = detail::linq_as_enumerable(source, enumerable)) {
+        Int32 count = 0;
+        auto* e = reinterpret_cast<Object* (*)(Object*)>(vtable->methods[0])(source);
+        if (!e) throw_null_reference();
+        auto move_next = reinterpret_cast<Boolean (*)(Object*)>(
+            type_get_interface_vtable_checked(e->__type_info, enumerable->enumerator_base)->methods[0]);
+        while (move_next(e)) count++;
+        detail::linq_dispose(e, enumerable);
+        return count;
+    }
+    return static_cast<Array*>(source)->length;
+}
+
+/**
+ * Element count when it is known without enumerating (arrays, lists), else 0.
+ * Used to size the buffer of ToArray/ToList.
+ */
+inline Int32 linq_count_hint(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    if (!source) return 0;
+    if (auto* list = detail::linq_as_list(source, list_type)) return list->count;
+    if (detail::linq_as_enumerable(source, enumerable)) return 0;
+    return static_cast<Array*>(source)->length;
+}
+
+/**
+ * Last element of a LINQ source: indexed for arrays and lists, enumerated otherwise.
+ * Returns false if the source is empty.
+ */
+template<typename T>
+bool linq_try_get_last(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable, T& result) {
+    if (!source) throw_argument_null();
+    if (auto* list = detail::linq_as_list(source, list_type)) {
+        if (list->count == 0) return false;
+        result = static_cast<T*>(list->items)[list->count - 1];
+        return true;
+    }
+    if (auto* vtable = detail::linq_as_enumerable(source, enumerable)) {
+        bool found = false;
+        detail::linq_enumerate<T>(source, vtable, enumerable, [&](T e) {
+            result = e;
+            found = true;
+            return true;
+        });
+        return found;
+    }
+    auto* arr = static_cast<Array*>(source);
+    if (arr->length == 0) return false;
+    result = static_cast<T*>(array_data(arr))[arr->length - 1];
+    return true;
+}
+
+namespace detail {
+
+/**
+ * Contiguous elements of an array or List<T> source. Returns false for a
+ * source that must be enumerated.
+ */
+template<typename T>
+bool linq_contiguous(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable,
+                     const T*& data, Int32& length) {
+    if (auto* list = linq_as_list(source, list_type)) {
+        data = static_cast<const T*>(list->items);
+        length = list->count;
+        return true;
+    }
+    if (linq_as_enumerable(source, enumerable)) return false;
+    auto* arr = static_cast<Array*>(source);
+    data = static_cast<const T*>(array_data(arr));
+    length = arr->length;
+    return true;
+}
+
+/** Accumulator of Enumerable.Sum: checked for integers, double for float. */
+template<typename T>
+using LinqSumType = std::conditional_t<std::is_same_v<T, Single>, Double, T>;
+
+} // namespace detail
+
+/**
+ * Enumerable.Sum over Int32, Int64, Single or Double elements. Integer sums
+ * throw OverflowException; a Single sum is returned in double precision.
+ */
+template<typename T>
+detail::LinqSumType<T> linq_sum(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    if (!source) throw_argument_null();
+    const T* data;
+    Int32 n;
+    if (detail::linq_contiguous(source, list_type, enumerable, data, n))
+        return vec::sum(data, n);
+    detail::LinqSumType<T> sum = 0;
+    detail::linq_enumerate<T>(source, detail::linq_as_enumerable(source, enumerable), enumerable, [&](T e) {
+        if constexpr (std::is_integral_v<T>) sum = checked_add(sum, e);
+        else sum += e;
+        return true;
+    });
+    return sum;
+}
+
+/**
+ * Enumerable.Min / Max over Int32, Int64, Single or Double elements.
+ * Throws InvalidOperationException on an empty source. For floating point,
+ * Min returns NaN as soon as it sees one and Max ignores NaN unless every
+ * element is NaN.
+ */
+template<typename T, bool IsMax>
+T linq_min_max(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    if (!source) throw_argument_null();
+    const T* data;
+    Int32 n;
+    if (detail::linq_contiguous(source, list_type, enumerable, data, n)) {
+        if (n == 0) throw_invalid_operation();
+        return IsMax ? vec::max(data, n) : vec::min(data, n);
+    }
+    T value{};
+    bool found = false;
+    detail::linq_enumerate<T>(source, detail::linq_as_enumerable(source, enumerable), enumerable, [&](T e) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (IsMax) {
+                if (!found || e > value || std::isnan(value)) value = e;
+            } else if (!found || e < value || std::isnan(e)) {
+                value = e;
+                found = true;
+                return !std::isnan(e);
+            }
+        } else if (!found || (IsMax ? e > value : e < value)) {
+            value = e;
+        }
+        found = true;
+        return true;
+    });
+    if (!found) throw_invalid_operation();
+    return value;
+}
+
+template<typename T>
+T linq_min(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    return linq_min_max<T, false>(source, list_type, enumerable);
+}
+
+template<typename T>
+T linq_max(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    return linq_min_max<T, true>(source, list_type, enumerable);
+}
+
+/**
+ * Enumerable.Average: Double for Int32, Int64 and Double elements, Single for
+ * Single. Throws InvalidOperationException on an empty source.
+ */
+template<typename T>
+std::conditional_t<std::is_same_v<T, Single>, Single, Double>
+linq_average(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable) {
+    if (!source) throw_argument_null();
+    const T* data;
+    Int32 n;
+    if (detail::linq_contiguous(source, list_type, enumerable, data, n)) {
+        if (n == 0) throw_invalid_operation();
+        return vec::average(data, n);
+    }
+    // Int32 values are summed in Int64, which cannot overflow
+    std::conditional_t<std::is_integral_v<T>, Int64, Double> sum = 0;
+    Int64 count = 0;
+    detail::linq_enumerate<T>(source, detail::linq_as_enumerable(source, enumerable), enumerable, [&](T e) {
+        if constexpr (std::is_same_v<T, Int64>) sum = checked_add(sum, e);
+        else sum += e;
+        count++;
+        return true;
+    });
+    if (count == 0) throw_invalid_operation();
+    if constexpr (std::is_same_v<T, Single>) return static_cast<Single>(sum / count);
+    else return static_cast<Double>(sum) / count;
+}
+
+/**
+ * Enumerable.Contains for primitive elements, with Equals semantics
+ * (NaN is found by NaN, 0.0 by -0.0).
+ */
+template<typename T>
+bool linq_contains(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable, T value) {
+    if (!source) throw_argument_null();
+    const T* data;
+    Int32 n;
+    if (detail::linq_contiguous(source, list_type, enumerable, data, n))
+        return vec::contains(data, n, value);
+    bool found = false;
+    detail::linq_enumerate<T>(source, detail::linq_as_enumerable(source, enumerable), enumerable, [&](T e) {
+        if constexpr (std::is_floating_point_v<T>) found = e == value || (e != e && value != value);
+        else found = e == value;
+        return !found;
+    });
+    return found;
+}
+
+/**
+ * Growable GC array for query results (ToArray, Reverse, and escaping
+ * Where/Select chains whose element type has no IEnumerable<T> to defer behind). to_array() hands back the buffer itself when it is
+ * exactly full, so a sized source is copied once.
+ */
+template<typename T>
+class LinqArrayBuilder {
+public:
+    LinqArrayBuilder(TypeInfo* element_type, Int32 capacity)
+        : element_type_(element_type),
+          items_(capacity > 0 ? array_create(element_type, capacity) : nullptr) {}
+
+    void add(const T& value) {
+        if (!items_ || count_ == items_->length) [[unlikely]]
+            grow();
+        static_cast<T*>(array_data(items_))[count_++] = value;
+    }
+
+    Int32 count() const { return count_; }
+
+    Array* to_array() {
+        if (items_ && count_ == items_->length) return items_;
+        Array* result = array_create(element_type_, count_);
+        if (count_ > 0)
+            std::memcpy(array_data(result), array_data(items_), static_cast<size_t>(count_) * sizeof(T));
+        return result;
+    }
+
+private:
+    void grow() {
+        Int32 capacity = items_ ? items_->length * 2 : 4;
+        Array* larger = array_create(element_type_, capacity);
+        if (count_ > 0)
+            std::memcpy(array_data(larger), array_data(items_), static_cast<size_t>(count_) * sizeof(T));
+        items_ = larger;
+    }
+
+    TypeInfo* element_type_;
+    Array* items_;
+    Int32 count_ = 0;
+};
+
+/** Reverse an array's elements in place (Enumerable.Reverse result). */
+template<typename T>
+inline Array* linq_reverse(Array* arr) {
+    T* data = static_cast<T*>(array_data(arr));
+    std::reverse(data, data + arr->length);
+    return arr;
+}
+
+// ===== Deferred queries =====
+
+/** Pull-based walk of a LINQ source, one element per next() call. */
+template<typename T>
+struct LinqCursor {
+    Object* source;
+    ListBase* list;                 // List<T> source
+    Object* enumerator;             // IEnumerable<T> source: its enumerator
+    Boolean (*move_next)(Object*);
+    T (*current)(Object*);
+    const LinqEnumerableTypes* enumerable;
+    Int32 index;
+    Int32 version;
+
+    void open(Object* src, TypeInfo* list_type, const LinqEnumerableTypes* types) {
+        source = src;
+        enumerable = types;
+        if ((list = detail::linq_as_list(src, list_type))) {
+            version = list->version;
+        } else if (auto* vtable = detail::linq_as_enumerable(src, types)) {
+            enumerator = reinterpret_cast<Object* (*)(Object*)>(vtable->methods[0])(src);
+            if (!enumerator) throw_null_reference();
+            move_next = reinterpret_cast<Boolean (*)(Object*)>(
+                type_get_interface_vtable_checked(enumerator->__type_info, types->enumerator_base)->methods[0]);
+            current = reinterpret_cast<T (*)(Object*)>(
+                type_get_interface_vtable_checked(enumerator->__type_info, types->enumerator)->methods[0]);
+        }
+    }
+
+    bool next(T& item) {
+        if (list) {
+            // List<T>.Enumerator: modifying the list while enumerating throws
+            if (list->version != version) throw_invalid_operation();
+            if (index >= list->count) return false;
+            item = static_cast<T*>(list->items)[index++];
+            return true;
+        }
+        if (enumerator) {
+            if (!move_next(enumerator)) return false;
+            item = current(enumerator);
+            return true;
+        }
+        auto* arr = static_cast<Array*>(source);
+        if (index >= arr->length) return false;
+        item = static_cast<const T*>(array_data(arr))[index++];
+        return true;
+    }
+
+    void close() {
+        if (!enumerator) return;
+        auto* e = enumerator;
+        enumerator = nullptr;
+        detail::linq_dispose(e, enumerable);
+    }
+};
+
+template<typename TSrc, typename T>
+struct LinqDeferredType;
+
+/** A deferred query object; its captured stage delegates follow. */
+template<typename TSrc, typename T>
+struct LinqDeferredQuery {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    const LinqDeferredType<TSrc, T>* type;
+    Object* source;
+
+    Object* const* delegates() const { return reinterpret_cast<Object* const*>(this + 1); }
+};
+
+/** One enumeration of a deferred query (GetEnumerator). */
+template<typename TSrc, typename T>
+struct LinqDeferredEnumerator {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    LinqDeferredQuery<TSrc, T>* query;
+    LinqCursor<TSrc> cursor;
+    T current;
+    Int32 state;                    // 0 = not started, 1 = running, 2 = finished
+};
+
+/**
+ * TypeInfos and interface tables of the deferred query objects of one Where/Select
+ * chain (a function-local static in the generated code). `step` pulls source
+ * elements through the fused stages until one comes out, and returns false once
+ * the source is exhausted.
+ */
+template<typename TSrc, typename T>
+struct LinqDeferredType {
+    using Query = LinqDeferredQuery<TSrc, T>;
+    using Enumerator = LinqDeferredEnumerator<TSrc, T>;
+    using Step = bool (*)(LinqCursor<TSrc>& cursor, Object* const* delegates, T& item);
+
+    TypeInfo query_type{};
+    TypeInfo enumerator_type{};
+    TypeInfo* query_interfaces[2]{};
+    TypeInfo* enumerator_interfaces[3]{};
+    InterfaceVTable query_vtables[2]{};
+    InterfaceVTable enumerator_vtables[3]{};
+    void* get_enumerator_method[1] = { reinterpret_cast<void*>(&get_enumerator) };
+    void* current_method[1] = { reinterpret_cast<void*>(&get_current) };
+    void* enumerator_base_methods[3] = { reinterpret_cast<void*>(&move_next),
+                                         reinterpret_cast<void*>(&get_current_boxed),
+                                         reinterpret_cast<void*>(&reset) };
+    void* dispose_method[1] = { reinterpret_cast<void*>(&dispose) };
+
+    TypeInfo* element_type;
+    TypeInfo* list_type;
+    const LinqEnumerableTypes* source_enumerable;
+    Step step;
+
+    /**
+     * @param result Interfaces of the query's IEnumerable<T> (disposable may be nullptr)
+     * @param enumerable_base IEnumerable, or nullptr if not in the module
+     * @param element TypeInfo of T, for IEnumerator.Current's box
+     * @param list_type, source Source classification, as for linq_for_each
+     */
+    LinqDeferredType(const LinqEnumerableTypes& result, TypeInfo* enumerable_base, TypeInfo* element,
+                     TypeInfo* list_type, const LinqEnumerableTypes* source, Step step)
+        : element_type(element), list_type(list_type), source_enumerable(source), step(step) {
+        UInt32 n = 0;
+        add(query_type, query_interfaces, query_vtables, n, result.enumerable, get_enumerator_method, 1);
+        add(query_type, query_interfaces, query_vtables, n, enumerable_base, get_enumerator_method, 1);
+        init(query_type, "<LinqQuery>", sizeof(Query));
+
+        n = 0;
+        add(enumerator_type, enumerator_interfaces, enumerator_vtables, n, result.enumerator, current_method, 1);
+        add(enumerator_type, enumerator_interfaces, enumerator_vtables, n, result.enumerator_base,
+            enumerator_base_methods, 3);
+        add(enumerator_type, enumerator_interfaces, enumerator_vtables, n, result.disposable, dispose_method, 1);
+        init(enumerator_type, "<LinqQuery>Enumerator", sizeof(Enumerator));
+    }
+
+    LinqDeferredType(const LinqDeferredType&) = delete;
+    LinqDeferredType& operator=(const LinqDeferredType&) = delete;
+
+    /** Capture `source` and the stage delegates; nothing runs until enumeration. */
+    Object* create(Object* source, std::initializer_list<Object*> delegates) const {
+        if (!source) throw_argument_null();
+        auto* q = static_cast<Query*>(gc::alloc(sizeof(Query) + delegates.size() * sizeof(Object*),
+                                                const_cast<TypeInfo*>(&query_type)));
+        q->type = this;
+        q->source = source;
+        std::copy(delegates.begin(), delegates.end(), const_cast<Object**>(q->delegates()));
+        return reinterpret_cast<Object*>(q);
+    }
+
+    /** IEnumerable<T>.GetEnumerator of a query this type created; a new enumeration each call. */
+    static Object* get_enumerator(Object* self) {
+        auto* q = reinterpret_cast<Query*>(self);
+        auto* e = static_cast<Enumerator*>(gc::alloc(sizeof(Enumerator),
+                                                     const_cast<TypeInfo*>(&q->type->enumerator_type)));
+        e->query = q;
+        return reinterpret_cast<Object*>(e);
+    }
+
+private:
+    static void add(TypeInfo& type, TypeInfo** interfaces, InterfaceVTable* vtables, UInt32& n,
+                    TypeInfo* iface, void** methods, UInt32 count) {
+        if (!iface) return;
+        interfaces[n] = iface;
+        vtables[n] = InterfaceVTable{ iface, methods, count };
+        type.interfaces = interfaces;
+        type.interface_vtables = vtables;
+        type.interface_count = type.interface_vtable_count = ++n;
+    }
+
+    static void init(TypeInfo& type, const char* name, size_t size) {
+        type.name = name;
+        type.namespace_name = "System.Linq";
+        type.full_name = name;
+        type.base_type = &System_Object_TypeInfo;
+        type.instance_size = static_cast<UInt32>(size);
+    }
+
+    static Boolean move_next(Object* self) {
+        auto* e = reinterpret_cast<Enumerator*>(self);
+        auto* q = e->query;
+        if (e->state == 2) return false;
+        if (e->state == 0) {
+            e->cursor.open(q->source, q->type->list_type, q->type->source_enumerable);
+            e->state = 1;
+        }
+        if (q->type->step(e->cursor, q->delegates(), e->current)) return true;
+        e->state = 2;
+        e->current = T{};
+        e->cursor.close();
+        return false;
+    }
+
+    static T get_current(Object* self) {
+        return reinterpret_cast<Enumerator*>(self)->current;
+    }
+
+    static Object* get_current_boxed(Object* self) {
+        auto* e = reinterpret_cast<Enumerator*>(self);
+        if constexpr (std::is_pointer_v<T>) return reinterpret_cast<Object*>(e->current);
+        else return box<T>(e->current, e->query->type->element_type);
+    }
+
+    [[noreturn]] static void reset(Object*) {
+        throw_not_supported();
+    }
+
+    static void dispose(Object* self) {
+        auto* e = reinterpret_cast<Enumerator*>(self);
+        if (e->state == 1) e->cursor.close();
+        e->state = 2;
+    }
+};
+
+} // namespace cil2cpp
@@ -7,6 +7,8 @@
 
 #include "types.h"
 
+#include <cstring>
+
 namespace cil2cpp {
 
 // Forward declaration
@@ -34,6 +36,20 @@ constexpr size_t OBJECT_HEADER_SIZE = sizeof(Object);
  */
 Object* object_alloc(TypeInfo* type);
 
+/**
+ * Initialize caller-owned storage as an object of the given type: zeroed, with
+ * the same header gc::alloc writes. Used by the compiler for objects escape
+ * analysis proves never outlive the allocating method. The collector does not
+ * own the storage (it is still scanned as part of the stack) and the object is
+ * never finalized, so types with finalizers must not be placed here.
+ */
+inline Object* object_init_stack(void* storage, size_t size, TypeInfo* type) {
+    std::memset(storage, 0, size);
+    auto* obj = static_cast<Object*>(storage);
+    obj->__type_info = type;
+    return obj;
+}
+
 /**
  * Get the runtime type of an object.
  */
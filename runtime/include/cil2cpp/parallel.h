@@ -0,0 +1,226 @@
+/**
+ * CIL2CPP Runtime - Data parallelism (Parallel.For/ForEach, PLINQ)
+ *
+ * A fork-join layer on top of the thread pool. A loop over [from, to) is
+ * split into one range per participant: the calling thread, which always
+ * takes part, and up to (degree - 1) pool workers. Each participant takes
+ * chunks from the front of its own range; when that is empty it steals the
+ * back half of the busiest other range, so a participant the pool never gets
+ * around to starting costs nothing but the steal.
+ *
+ * The caller blocks until every started participant has finished. The first
+ * exception thrown by each participant stops the loop and all of them are
+ * rethrown together as an AggregateException. A cancelled CancellationToken
+ * stops the loop between chunks and throws OperationCanceledException.
+ */
+
+#pragma once
+
+#include "cancellation.h"
+#include "exception.h"
+#include "gc.h"
+#include "linq.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cil2cpp {
+
+/**
+ * System.Threading.Tasks.ParallelOptions (reference type, GC-allocated).
+ */
+struct ParallelOptions : Object {
+    CancellationToken f_cancellationToken;
+    Int32 f_maxDegreeOfParallelism;     // -1 = no limit
+};
+
+/**
+ * System.Threading.Tasks.ParallelLoopResult (value type).
+ * Loops without ParallelLoopState always run to completion or throw.
+ */
+struct ParallelLoopResult {
+    Boolean f_isCompleted;
+};
+
+// System.Threading.Tasks.ParallelOptions type info (defined in parallel.cpp)
+extern TypeInfo ParallelOptions_TypeInfo;
+
+/** Create a ParallelOptions with the default token and no degree limit. */
+ParallelOptions* parallel_options_create();
+
+namespace parallel {
+
+/** Cancellation and degree of parallelism for one loop. */
+struct LoopOptions {
+    CancellationToken token{nullptr};
+    Int32 max_degree = -1;              // <= 0: one participant per pool worker
+};
+
+inline LoopOptions options_of(ParallelOptions* options) {
+    if (!options) throw_argument_null();
+    return LoopOptions{options->f_cancellationToken, options->f_maxDegreeOfParallelism};
+}
+
+/**
+ * Number of participants a loop over `count` iterations runs with: the pool
+ * size by default, at most one per pool worker plus the caller, and never
+ * more than there are iterations.
+ */
+Int32 degree_for(Int64 count, const LoopOptions& options);
+
+/** Loop body: iterations [from, to) on participant `worker` (0 .. degree-1). */
+using RangeBody = void (*)(void* ctx, Int64 from, Int64 to, Int32 worker);
+
+/**
+ * Run body over [from, to) with `degree` participants and block until done.
+ * Throws AggregateException or OperationCanceledException as described above.
+ */
+void run(Int64 from, Int64 to, Int32 degree, const LoopOptions& options, RangeBody body, void* ctx);
+
+/**
+ * Parallel.For: fn(lo, hi, worker) for disjoint ranges covering [from, to).
+ */
+template<typename F>
+ParallelLoopResult for_range(Int64 from, Int64 to, const LoopOptions& options, F&& fn) {
+    if (to > from) {
+        run(from, to, degree_for(to - from, options), options,
+            [](void* ctx, Int64 lo, Int64 hi, Int32 worker) {
+                (*static_cast<std::remove_reference_t<F>*>(ctx))(lo, hi, worker);
+            },
+            &fn);
+    } else {
+        ct_throw_if_cancellation_requested(options.token);
+    }
+    return ParallelLoopResult{true};
+}
+
+/**
+ * Reduction over [from, to): each participant folds its ranges into its own
+ * copy of `identity` with body(acc, lo, hi), then the partials are combined
+ * in participant order.
+ */
+template<typename Acc, typename Body, typename Combine>
+Acc reduce(Int64 from, Int64 to, Acc identity, const LoopOptions& options, Body&& body, Combine&& combine) {
+    static_assert(std::is_trivially_copyable_v<Acc>, "parallel::reduce accumulators are copied bitwise");
+    if (to <= from) {
+        ct_throw_if_cancellation_requested(options.token);
+        return identity;
+    }
+    const Int32 degree = degree_for(to - from, options);
+    // Partials live on the GC heap (an accumulator may be a managed reference),
+    // one cache line apart so participants do not share lines
+    struct Partial {
+        Acc value;
+        char pad[64];
+    };
+    auto* partials = static_cast<Partial*>(gc::alloc(sizeof(Partial) * static_cast<size_t>(degree), nullptr));
+    for (Int32 i = 0; i < degree; i++) partials[i].value = identity;
+
+    struct Context {
+        Partial* partials;
+        std::remove_reference_t<Body>* body;
+    } ctx{partials, &body};
+    run(from, to, degree, options,
+        [](void* raw, Int64 lo, Int64 hi, Int32 worker) {
+            auto* c = static_cast<Context*>(raw);
+            (*c->body)(c->partials[worker].value, lo, hi);
+        },
+        &ctx);
+
+    Acc result = partials[0].value;
+    for (Int32 i = 1; i < degree; i++) result = combine(result, partials[i].value);
+    return result;
+}
+
+namespace detail {
+
+/**
+ * Elements of a LINQ source as contiguous storage: arrays and lists in place,
+ * other IEnumerable<T> sources copied into a GC buffer first (enumerators are
+ * not thread-safe, so they are drained on the calling thread).
+ */
+template<typename T>
+const T* parallel_elements(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable,
+                           Int32& length) {
+    if (!source) throw_argument_null();
+    const T* data;
+    if (cil2cpp::detail::linq_contiguous(source, list_type, enumerable, data, length)) return data;
+    T* buffer = nullptr;
+    Int32 capacity = 0;
+    length = 0;
+    cil2cpp::detail::linq_enumerate<T>(source, cil2cpp::detail::linq_as_enumerable(source, enumerable),
+                                       enumerable, [&](T e) {
+        if (length == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            auto* larger = static_cast<T*>(gc::alloc(sizeof(T) * static_cast<size_t>(capacity), nullptr));
+            if (length > 0) std::copy(buffer, buffer + length, larger);
+            buffer = larger;
+        }
+        buffer[length++] = e;
+        return true;
+    });
+    return buffer;
+}
+
+} // namespace detail
+
+/**
+ * Parallel.ForEach over an array, List<T> or IEnumerable<T>: fn(element).
+ */
+template<typename T, typename F>
+ParallelLoopResult for_each(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable,
+                            const LoopOptions& options, F&& fn) {
+    Int32 n;
+    const T* data = detail::parallel_elements<T>(source, list_type, enumerable, n);
+    return for_range(0, n, options, [&](Int64 lo, Int64 hi, Int32) {
+        for (Int64 i = lo; i < hi; i++) fn(data[i]);
+    });
+}
+
+} // namespace parallel
+
+/**
+ * PLINQ aggregation (Sum, Count, Aggregate): body(acc, element) folds one
+ * element and, like a linq_for_each body, returns false to stop (here: the
+ * current chunk); combine(a, b) merges two partials. Partials are merged in
+ * participant order, not source order, as in an unordered PLINQ query.
+ */
+template<typename T, typename Acc, typename Body, typename Combine>
+Acc linq_parallel_reduce(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable,
+                         const parallel::LoopOptions& options, Acc identity, Body&& body, Combine&& combine) {
+    Int32 n;
+    const T* data = parallel::detail::parallel_elements<T>(source, list_type, enumerable, n);
+    return parallel::reduce(0, n, identity, options,
+        [&](Acc& acc, Int64 lo, Int64 hi) {
+            for (Int64 i = lo; i < hi; i++)
+                if (!body(acc, data[i])) break;
+        },
+        combine);
+}
+
+/**
+ * PLINQ ForAll: body(element) for every element, in no particular order; the
+ * body's return value is ignored (a filtered-out element returns true early).
+ */
+template<typename T, typename Body>
+void linq_parallel_for_all(Object* source, TypeInfo* list_type, const LinqEnumerableTypes* enumerable,
+                           const parallel::LoopOptions& options, Body&& body) {
+    Int32 n;
+    const T* data = parallel::detail::parallel_elements<T>(source, list_type, enumerable, n);
+    parallel::for_range(0, n, options, [&](Int64 lo, Int64 hi, Int32) {
+        for (Int64 i = lo; i < hi; i++) body(data[i]);
+    });
+}
+
+/** Partial result of Aggregate(func) without a seed: empty until the first element. */
+template<typename T>
+struct LinqPartial {
+    T value;
+    bool has_value;
+};
+
+} // namespace cil2cpp
+
+// Mangled-name aliases for generated code
+using System_Threading_Tasks_ParallelOptions = cil2cpp::ParallelOptions;
+using System_Threading_Tasks_ParallelLoopResult = cil2cpp::ParallelLoopResult;
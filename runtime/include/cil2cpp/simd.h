@@ -0,0 +1,94 @@
+/**
+ * CIL2CPP Runtime - SIMD capability detection and dispatch
+ *
+ * Vectorized kernels (UTF transcoding, string search, ...) are compiled for
+ * several instruction-set levels in the same binary and pick one at run time.
+ * The runtime never requires more than the platform baseline: on x86-64 that
+ * is SSE2; AVX2 kernels are only entered after CPUID confirms support.
+ *
+ * The active level defaults to the best detected level and can be lowered
+ * with the CIL2CPP_SIMD environment variable (scalar | sse2 | avx2) or
+ * simd::set_level() — mainly for testing each code path and benchmarking.
+ */
+
+#pragma once
+
+#include "types.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CIL2CPP_SIMD_X86 1
+#endif
+
+// Per-function ISA enablement for kernels compiled above the baseline.
+// MSVC accepts AVX2 intrinsics in any function, GCC/Clang need the attribute.
+#if defined(CIL2CPP_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CIL2CPP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define CIL2CPP_TARGET_AVX2
+#endif
+
+// Kernel drivers are templates over a per-level kernel set and are forced
+// inline into a per-level entry point, so a whole conversion loop is compiled
+// for one ISA (no per-run dispatch, no SSE/AVX transition between calls).
+#if defined(_MSC_VER)
+#define CIL2CPP_FORCE_INLINE __forceinline
+#else
+#define CIL2CPP_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+// CIL2CPP_SIMD_ENTRY(ret, name, (params), (args)) defines name_scalar,
+// name_sse2, name_avx2 — each instantiating the driver template
+// name_impl<ScalarKernels | SSE2Kernels | AVX2Kernels> — and name_dispatch,
+// which picks one according to simd::level(). The kernel structs must be in
+// scope at the point of use (see src/text/utf.cpp).
+#if defined(CIL2CPP_SIMD_X86)
+#define CIL2CPP_SIMD_ENTRY(ret, name, params, args)                                     \
+    static ret name##_scalar params { return name##_impl<ScalarKernels> args; }         \
+    static ret name##_sse2 params { return name##_impl<SSE2Kernels> args; }             \
+    CIL2CPP_TARGET_AVX2 static ret name##_avx2 params {                                 \
+        return name##_impl<AVX2Kernels> args;                                           \
+    }                                                                                   \
+    static inline ret name##_dispatch params {                                          \
+        switch (::cil2cpp::simd::level()) {                                             \
+        case ::cil2cpp::simd::Level::AVX2: return name##_avx2 args;                     \
+        case ::cil2cpp::simd::Level::SSE2: return name##_sse2 args;                     \
+        default:                           return name##_scalar args;                   \
+        }                                                                               \
+    }
+#else
+#define CIL2CPP_SIMD_ENTRY(ret, name, params, args)                                     \
+    static inline ret name##_dispatch params { return name##_impl<ScalarKernels> args; }
+#endif
+
+namespace cil2cpp {
+namespace simd {
+
+enum class Level : Byte {
+    Scalar = 0,  // portable C++ (SWAR where useful)
+    SSE2   = 1,  // x86-64 baseline
+    AVX2   = 2,
+};
+
+/**
+ * Best level supported by this CPU/OS (cached after the first call).
+ */
+Level detected();
+
+/**
+ * Level kernels currently dispatch to.
+ */
+Level level();
+
+/**
+ * Override the active level. Requests above detected() are clamped.
+ * @return the level actually in effect
+ */
+Level set_level(Level requested);
+
+/**
+ * "scalar", "sse2" or "avx2".
+ */
+const char* level_name(Level level);
+
+} // namespace simd
+} // namespace cil2cpp
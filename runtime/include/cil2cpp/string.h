@@ -31,6 +31,11 @@ struct String : Object {
  */
 String* string_create_utf8(const char* utf8);
 
+/**
+ * Create a new string from UTF-8 data of known length (may contain NULs).
+ */
+String* string_create_utf8(const char* utf8, Int32 byte_length);
+
 /**
  * Create a new string from UTF-16 data.
  */
@@ -42,10 +47,17 @@ String* string_create_utf16(const Char* utf16, Int32 length);
 String* string_literal(const char* utf8);
 
 /**
- * Concatenate two strings.
+ * Concatenate strings. Null parts count as empty. The N-ary forms sum the
+ * lengths first and copy every part exactly once into a single allocation;
+ * when at most one part is non-empty it is returned without copying.
  */
 String* string_concat(String* a, String* b);
 String* string_concat(String* a, String* b, String* c);
+String* string_concat(String* a, String* b, String* c, String* d);
+String* string_concat(String* const* parts, Int32 count);
+
+/** String.Concat(params string[]) — elements are String*. */
+String* string_concat_array(Array* values);
 
 /**
  * Compare two strings for equality.
@@ -86,19 +98,26 @@ inline Int32 string_length(String* str) {
 }
 
 /**
- * Convert an int32 to a string.
+ * Primitive ToString(): invariant culture; floating point prints the shortest
+ * string that round-trips.
  */
 String* string_from_int32(Int32 value);
-
-/**
- * Convert a double to a string.
- */
+String* string_from_uint32(UInt32 value);
+String* string_from_int64(Int64 value);
+String* string_from_uint64(UInt64 value);
 String* string_from_double(Double value);
+String* string_from_single(Single value);
 
 /**
- * Convert an int64 to a string.
+ * Primitive ToString(format): standard ("N2", "X8", "E3", ...) or custom
+ * ("0.00", "#,##0") numeric format strings. See format.h.
  */
-String* string_from_int64(Int64 value);
+String* string_from_int32(Int32 value, String* format);
+String* string_from_uint32(UInt32 value, String* format);
+String* string_from_int64(Int64 value, String* format);
+String* string_from_uint64(UInt64 value, String* format);
+String* string_from_double(Double value, String* format);
+String* string_from_single(Single value, String* format);
 String* string_from_bool(Boolean value);
 String* string_from_char(Char value);
 String* string_fast_allocate(Int32 length);
@@ -133,8 +152,10 @@ String* string_pad_left(String* str, Int32 totalWidth);
 String* string_pad_right(String* str, Int32 totalWidth);
 
 // ── Concat with Object ────────────────────────────────────
+String* string_concat_obj(Object* a);
 String* string_concat_obj(Object* a, Object* b);
 String* string_concat_obj3(Object* a, Object* b, Object* c);
+String* string_concat_obj_array(Array* values);
 
 // ── Format / Join / Split ─────────────────────────────────
 String* string_format(String* format, Array* args);
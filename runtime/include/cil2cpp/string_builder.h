@@ -0,0 +1,129 @@
+/**
+ * CIL2CPP Runtime - System.Text.StringBuilder
+ *
+ * Characters live in a backward-linked list of chunks. Appends only ever
+ * touch the tail chunk; when it fills, a new chunk is linked in whose capacity
+ * matches the current length (geometric growth, capped at 1M characters per
+ * chunk), so existing characters are never moved while building. ToString()
+ * allocates the result exactly once and copies each chunk into it; when the builder is a single, mostly-full chunk
+ * its buffer is handed out as the string itself with no copy at all (the chunk
+ * is then marked shared and never written again).
+ *
+ * Primitive Append overloads format straight into the tail chunk — no
+ * temporary String is created.
+ */
+
+#pragma once
+
+#include "object.h"
+#include "string.h"
+#include "array.h"
+#include "exception.h"
+#include "format.h"
+
+namespace cil2cpp {
+
+/**
+ * One segment of a StringBuilder's contents.
+ * buffer is a String whose length field is the chunk capacity until the
+ * chunk is handed out by ToString() (then it is the used length, and shared
+ * is set).
+ */
+struct StringBuilderChunk : Object {
+    StringBuilderChunk* previous;   // Chunk holding the preceding characters
+    String* buffer;                 // Character storage
+    Int32 length;                   // Characters used in this chunk
+    Int32 capacity;                 // Characters available in this chunk
+    Int32 offset;                   // Characters in all previous chunks
+    Boolean shared;                 // buffer escaped via ToString(): read-only
+};
+
+/**
+ * StringBuilder (reference type, GC-allocated).
+ */
+struct StringBuilder : Object {
+    StringBuilderChunk* chunk;      // Tail chunk (appends land here)
+    Int32 length;                   // Total characters
+    Int32 max_capacity;             // Upper bound on length
+};
+
+// System.Text.StringBuilder type info (defined in string_builder.cpp)
+extern TypeInfo StringBuilder_TypeInfo;
+
+// ===== Construction =====
+
+/** Create an empty builder with at least the given capacity (<= 0: default 16). */
+StringBuilder* string_builder_create(Int32 capacity = 0);
+
+/** Create a builder with a capacity limit; appends past it throw. */
+StringBuilder* string_builder_create(Int32 capacity, Int32 max_capacity);
+
+/** Create a builder initialized with a copy of value (null = empty). */
+StringBuilder* string_builder_create(String* value, Int32 capacity = 0);
+
+// ===== Append =====
+// Every Append returns sb so generated code can keep the fluent call chain.
+
+StringBuilder* string_builder_append_chars(StringBuilder* sb, const Char* chars, Int32 count);
+StringBuilder* string_builder_append(StringBuilder* sb, String* value);
+StringBuilder* string_builder_append(StringBuilder* sb, String* value, Int32 start, Int32 count);
+StringBuilder* string_builder_append_char(StringBuilder* sb, Char value);
+StringBuilder* string_builder_append_char(StringBuilder* sb, Char value, Int32 repeat_count);
+StringBuilder* string_builder_append_char_array(StringBuilder* sb, Array* value);
+StringBuilder* string_builder_append_char_array(StringBuilder* sb, Array* value, Int32 start, Int32 count);
+StringBuilder* string_builder_append_int32(StringBuilder* sb, Int32 value);
+StringBuilder* string_builder_append_uint32(StringBuilder* sb, UInt32 value);
+StringBuilder* string_builder_append_int64(StringBuilder* sb, Int64 value);
+StringBuilder* string_builder_append_uint64(StringBuilder* sb, UInt64 value);
+StringBuilder* string_builder_append_double(StringBuilder* sb, Double value);
+StringBuilder* string_builder_append_single(StringBuilder* sb, Single value);
+StringBuilder* string_builder_append_bool(StringBuilder* sb, Boolean value);
+StringBuilder* string_builder_append_object(StringBuilder* sb, Object* value);
+StringBuilder* string_builder_append_builder(StringBuilder* sb, StringBuilder* value);
+StringBuilder* string_builder_append_line(StringBuilder* sb);
+StringBuilder* string_builder_append_line(StringBuilder* sb, String* value);
+StringBuilder* string_builder_append_format(StringBuilder* sb, String* format, Array* args);
+StringBuilder* string_builder_append_format(StringBuilder* sb, String* format,
+                                            const FormatArg* args, Int32 count);
+
+// ===== Editing =====
+
+StringBuilder* string_builder_insert(StringBuilder* sb, Int32 index, String* value);
+StringBuilder* string_builder_insert_char(StringBuilder* sb, Int32 index, Char value);
+StringBuilder* string_builder_remove(StringBuilder* sb, Int32 start, Int32 count);
+StringBuilder* string_builder_replace(StringBuilder* sb, String* old_value, String* new_value);
+StringBuilder* string_builder_replace(StringBuilder* sb, String* old_value, String* new_value,
+                                      Int32 start, Int32 count);
+StringBuilder* string_builder_replace_char(StringBuilder* sb, Char old_char, Char new_char);
+StringBuilder* string_builder_replace_char(StringBuilder* sb, Char old_char, Char new_char,
+                                           Int32 start, Int32 count);
+StringBuilder* string_builder_clear(StringBuilder* sb);
+
+// ===== Properties =====
+
+inline Int32 string_builder_get_length(StringBuilder* sb) {
+    if (!sb) throw_null_reference();
+    return sb->length;
+}
+
+/** Truncate, or pad with '\0' up to the new length. */
+void string_builder_set_length(StringBuilder* sb, Int32 length);
+
+Int32 string_builder_get_capacity(StringBuilder* sb);
+void string_builder_set_capacity(StringBuilder* sb, Int32 capacity);
+Int32 string_builder_ensure_capacity(StringBuilder* sb, Int32 capacity);
+Int32 string_builder_get_max_capacity(StringBuilder* sb);
+
+Char string_builder_get_char(StringBuilder* sb, Int32 index);
+void string_builder_set_char(StringBuilder* sb, Int32 index, Char value);
+
+// ===== Materialization =====
+
+/** Build the final string (one allocation, or none — see file comment). */
+String* string_builder_to_string(StringBuilder* sb);
+String* string_builder_to_string(StringBuilder* sb, Int32 start, Int32 length);
+
+} // namespace cil2cpp
+
+// Mangled-name alias for generated code
+using System_Text_StringBuilder = cil2cpp::StringBuilder;
@@ -0,0 +1,43 @@
+/**
+ * CIL2CPP Runtime - UTF-16 search and comparison kernels
+ *
+ * Ordinal (code-unit) primitives behind String.IndexOf / LastIndexOf /
+ * Contains / Replace / Split / CompareOrdinal. SSE2/AVX2 implementations are
+ * selected at run time (see simd.h). All functions return -1 for "not found".
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace cil2cpp {
+namespace search {
+
+/**
+ * Index of the first c in s[0..n), or -1.
+ */
+Int32 index_of_char(const Char* s, Int32 n, Char c);
+
+/**
+ * Index of the last c in s[0..n), or -1.
+ */
+Int32 last_index_of_char(const Char* s, Int32 n, Char c);
+
+/**
+ * Number of occurrences of c in s[0..n).
+ */
+Int32 count_char(const Char* s, Int32 n, Char c);
+
+/**
+ * Index of the first occurrence of needle[0..m) in hay[0..n), or -1.
+ * An empty needle matches at 0.
+ */
+Int32 index_of(const Char* hay, Int32 n, const Char* needle, Int32 m);
+
+/**
+ * Index of the first position where a and b differ, or n if equal.
+ */
+Int32 mismatch(const Char* a, const Char* b, Int32 n);
+
+} // namespace search
+} // namespace cil2cpp
@@ -0,0 +1,182 @@
+/**
+ * CIL2CPP Runtime - Slim Synchronization Primitives
+ *
+ * SemaphoreSlim, ManualResetEventSlim and ReaderWriterLockSlim. Each keeps its
+ * state in atomic words that uncontended calls update with a single CAS. A
+ * thread that has to wait spins briefly, then parks on the address of that
+ * state in the parking lot (a futex-style table of waiters keyed by address)
+ * until the thread whose state change unblocks it unparks it; there is no
+ * per-object mutex or condition variable. SemaphoreSlim.WaitAsync callers
+ * queue a pending Task instead of parking.
+ */
+
+#pragma once
+
+#include "object.h"
+#include "task.h"
+
+#include <atomic>
+#include <chrono>
+
+namespace cil2cpp {
+
+// ===== Parking lot =====
+
+namespace parking {
+
+/**
+ * Park the calling thread on `address` if `validate(context)` returns true.
+ * `validate` runs under the lock of the address's bucket, so a thread that
+ * changes the state it checks and then calls unpark_* on the same address
+ * can't be missed. Returns false if the timeout (ms, -1 = infinite) expired
+ * or validation failed, true if the thread was unparked.
+ */
+bool park(const void* address, bool (*validate)(void* context), void* context, Int32 timeout_ms);
+
+/** Unpark the longest-parked thread on `address`. Returns false if none was parked. */
+bool unpark_one(const void* address);
+
+/** Unpark every thread parked on `address`. Returns how many were parked. */
+Int32 unpark_all(const void* address);
+
+/**
+ * One step of a bounded spin before parking: a CPU pause, or a yield on a
+ * single-processor machine where spinning can't observe progress.
+ */
+void spin_pause();
+
+/** Spin steps a waiter takes before it parks. */
+constexpr Int32 kSpinCount = 35;
+
+/** A millisecond timeout (-1 = infinite) as a deadline, for retry loops around park. */
+class Deadline {
+public:
+    explicit Deadline(Int32 timeout_ms)
+        : infinite_(timeout_ms < 0),
+          end_(std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms < 0 ? 0 : timeout_ms)) {}
+
+    /** Milliseconds left: -1 if infinite, 0 once expired. */
+    Int32 remaining_ms() const {
+        if (infinite_) return -1;
+        auto left = std::chrono::ceil<std::chrono::milliseconds>(end_ - std::chrono::steady_clock::now());
+        return left.count() > 0 ? static_cast<Int32>(left.count()) : 0;
+    }
+
+    bool expired() const { return remaining_ms() == 0; }
+
+private:
+    bool infinite_;
+    std::chrono::steady_clock::time_point end_;
+};
+
+} // namespace parking
+
+// ===== SemaphoreSlim =====
+
+struct SemaphoreWaiter;
+
+/**
+ * System.Threading.SemaphoreSlim (reference type, GC-allocated).
+ */
+struct SemaphoreSlim : Object {
+    std::atomic<Int32> count;
+    Int32 max_count;
+    std::atomic<Int32> parked;          // threads parked in Wait
+    std::atomic<Int32> queued;          // WaitAsync tasks in the queue
+    std::atomic<bool> queue_lock;       // spin lock guarding the queue
+    SemaphoreWaiter* head;              // WaitAsync queue, FIFO
+    SemaphoreWaiter* tail;
+};
+
+/** new SemaphoreSlim(initialCount, maxCount); throws ArgumentOutOfRangeException unless 0 <= initialCount <= maxCount. */
+SemaphoreSlim* semaphore_create(Int32 initial_count, Int32 max_count);
+
+/** SemaphoreSlim.Wait(millisecondsTimeout): false if the timeout expired. */
+bool semaphore_wait(SemaphoreSlim* s, Int32 timeout_ms);
+
+/**
+ * SemaphoreSlim.WaitAsync(): a completed Task if a slot was free, otherwise a
+ * pending Task completed by the Release that hands this caller a slot.
+ */
+Task* semaphore_wait_async(SemaphoreSlim* s);
+
+/** SemaphoreSlim.Release(releaseCount): the previous count. */
+Int32 semaphore_release(SemaphoreSlim* s, Int32 release_count);
+
+inline Int32 semaphore_current_count(SemaphoreSlim* s) {
+    return s->count.load(std::memory_order_acquire);
+}
+
+// ===== ManualResetEventSlim =====
+
+/**
+ * System.Threading.ManualResetEventSlim (reference type, GC-allocated).
+ */
+struct ManualResetEventSlim : Object {
+    std::atomic<Int32> state;           // 0 = reset, 1 = set
+    std::atomic<Int32> parked;
+    Int32 spin_count;
+};
+
+/** new ManualResetEventSlim(initialState, spinCount); spinCount -1 picks the default (parking::kSpinCount). */
+ManualResetEventSlim* reset_event_create(bool initial_state, Int32 spin_count);
+
+void reset_event_set(ManualResetEventSlim* e);
+
+inline void reset_event_reset(ManualResetEventSlim* e) {
+    e->state.store(0, std::memory_order_release);
+}
+
+inline bool reset_event_is_set(ManualResetEventSlim* e) {
+    return e->state.load(std::memory_order_acquire) != 0;
+}
+
+/** ManualResetEventSlim.Wait(millisecondsTimeout): false if the timeout expired. */
+bool reset_event_wait(ManualResetEventSlim* e, Int32 timeout_ms);
+
+// ===== ReaderWriterLockSlim =====
+
+/**
+ * System.Threading.ReaderWriterLockSlim (reference type, GC-allocated), with
+ * LockRecursionPolicy.NoRecursion. Writer-preferring: once a writer waits,
+ * new readers wait behind it. Re-entering the write lock (or the read lock
+ * while holding it) throws LockRecursionException; re-entering the read lock
+ * is not detected. Upgradeable read locks are not supported.
+ */
+struct ReaderWriterLockSlim : Object {
+    std::atomic<UInt32> state;          // reader count | kWriterHeld
+    std::atomic<Int32> writers_waiting;
+    std::atomic<Int32> readers_parked;
+    std::atomic<Int32> writers_parked;
+    std::atomic<const void*> writer;    // identity of the thread holding the write lock
+};
+
+/** new ReaderWriterLockSlim(recursionPolicy); SupportsRecursion is not supported. */
+ReaderWriterLockSlim* rwlock_create(Int32 recursion_policy);
+
+/** TryEnterReadLock(millisecondsTimeout) / EnterReadLock (-1). */
+bool rwlock_enter_read(ReaderWriterLockSlim* l, Int32 timeout_ms);
+void rwlock_exit_read(ReaderWriterLockSlim* l);
+
+/** TryEnterWriteLock(millisecondsTimeout) / EnterWriteLock (-1). */
+bool rwlock_enter_write(ReaderWriterLockSlim* l, Int32 timeout_ms);
+void rwlock_exit_write(ReaderWriterLockSlim* l);
+
+bool rwlock_is_write_lock_held(ReaderWriterLockSlim* l);
+Int32 rwlock_current_read_count(ReaderWriterLockSlim* l);
+
+inline Int32 rwlock_waiting_write_count(ReaderWriterLockSlim* l) {
+    return l->writers_waiting.load(std::memory_order_acquire);
+}
+
+// Type infos (defined in the src/threading sources)
+extern TypeInfo SemaphoreSlim_TypeInfo;
+extern TypeInfo ManualResetEventSlim_TypeInfo;
+extern TypeInfo ReaderWriterLockSlim_TypeInfo;
+
+} // namespace cil2cpp
+
+// Mangled-name aliases for generated code
+using System_Threading_SemaphoreSlim = cil2cpp::SemaphoreSlim;
+using System_Threading_ManualResetEventSlim = cil2cpp::ManualResetEventSlim;
+using System_Threading_ReaderWriterLockSlim = cil2cpp::ReaderWriterLockSlim;
@@ -7,6 +7,9 @@
 
 #include "object.h"
 #include "exception.h"
+#include "gc.h"
+
+#include <type_traits>
 
 namespace cil2cpp {
 
@@ -15,6 +18,26 @@ struct Array;
 // Forward declare for continuation storage
 struct TaskContinuation;
 
+/**
+ * System.Threading.Tasks.TaskCreationOptions (the values the runtime honours).
+ */
+enum class TaskCreationOptions : Int32 {
+    None = 0,
+    RunContinuationsAsynchronously = 64,   // continuations never run inside task_complete
+};
+
+/**
+ * Scheduling of a single continuation when its task completes.
+ * None runs it inline on the completing thread when that is safe (the task was
+ * not created with RunContinuationsAsynchronously and the thread's inline
+ * continuation depth is below task_get_inline_depth_limit()), and posts it to
+ * the thread pool otherwise.
+ */
+enum class ContinuationFlags : UInt32 {
+    None = 0,
+    RunAsynchronously = 1 << 0,            // always post to the thread pool
+};
+
 /**
  * Task (reference type, GC-allocated).
  * Non-generic base; generic Task<T> is monomorphized by the compiler.
@@ -31,17 +54,21 @@ struct Task {
     Int32 f_status;                     // 0=created, 1=completed, 2=faulted
     Exception* f_exception;
     TaskContinuation* f_continuations;  // Linked list of continuations
-    void* f_lock;                       // std::mutex* for thread-safe completion
+    void* f_lock;                       // Pending tasks only: mutex + creation options
 };
 
+/** TypeInfo of runtime-allocated Tasks (defined in task.cpp). */
+extern TypeInfo Task_TypeInfo;
+
 /**
  * A continuation callback registered on a Task.
- * Stored as a singly-linked list (GC-allocated).
+ * Stored as a singly-linked list (nodes come from a per-thread pool).
  */
 struct TaskContinuation {
     void (*callback)(void*);
     void* state;
     TaskContinuation* next;
+    ContinuationFlags flags;
 };
 
 /**
@@ -65,13 +92,13 @@ Task* task_create_completed();
 Task* task_get_completed();
 
 /** Create a new pending (incomplete) Task (non-generic only). */
-Task* task_create_pending();
+Task* task_create_pending(TaskCreationOptions options = TaskCreationOptions::None);
 
 /**
  * Initialize an already-allocated Task as pending (status=0, mutex created).
  * Use this for generic Task<T> where the caller allocates with the correct size.
  */
-void task_init_pending(Task* t);
+void task_init_pending(Task* t, TaskCreationOptions options = TaskCreationOptions::None);
 
 /**
  * Initialize an already-allocated Task as completed (status=1, no mutex).
@@ -98,10 +125,22 @@ void task_fault(Task* t, Exception* ex);
 
 /**
  * Register a continuation to run when the task completes.
- * If task is already complete, runs immediately on calling thread.
+ * If task is already complete, it is scheduled right away: inline on the
+ * calling thread when safe, on the thread pool otherwise (see ContinuationFlags).
  * Thread-safe.
  */
-void task_add_continuation(Task* t, void (*callback)(void*), void* state);
+void task_add_continuation(Task* t, void (*callback)(void*), void* state,
+                           ContinuationFlags flags = ContinuationFlags::None);
+
+/**
+ * Continuations running inline nest on the completing thread's stack (a chain
+ * of awaits completing in sequence recurses once per await). Past this many
+ * nested inline continuations the next one hops to the thread pool, starting
+ * again from an empty stack. Default 64; 0 posts every continuation. Without
+ * an initialized thread pool everything runs inline.
+ */
+Int32 task_get_inline_depth_limit();
+void task_set_inline_depth_limit(Int32 depth);
 
 /**
  * Wait (block) until a task completes.
@@ -109,6 +148,122 @@ void task_add_continuation(Task* t, void (*callback)(void*), void* state);
  */
 void task_wait(Task* t);
 
+// ===== Completed tasks and AsyncTaskMethodBuilder =====
+//
+// Completed tasks never change after construction, so they carry no lock
+// (f_lock == nullptr) and can be shared. The task functions above treat a
+// lock-less task as already completed.
+
+/**
+ * Allocate a completed Task<T> holding `value`.
+ * TTask is the compiler-generated Task<T> struct (Task fields + f_result).
+ */
+template <typename TTask>
+TTask* task_alloc_completed(decltype(TTask::f_result) value) {
+    auto* t = static_cast<TTask*>(gc::alloc(sizeof(TTask), nullptr));
+    task_init_completed(reinterpret_cast<Task*>(t));
+    t->f_result = value;
+    return t;
+}
+
+/**
+ * Task.FromResult<T>: returns a shared completed task for common results
+ * (false/true, integers -1..8, null and default(T)), like the BCL's
+ * AsyncTaskCache; other values get a fresh completed task.
+ */
+template <typename TTask>
+TTask* task_from_result(decltype(TTask::f_result) value) {
+    using T = decltype(TTask::f_result);
+    if constexpr (std::is_same_v<T, bool>) {
+        static TTask* const cached[2] = {
+            task_alloc_completed<TTask>(false), task_alloc_completed<TTask>(true) };
+        return cached[value ? 1 : 0];
+    } else if constexpr (std::is_integral_v<T>) {
+        constexpr Int64 min = std::is_signed_v<T> ? -1 : 0;
+        constexpr Int64 max = 8;
+        auto i = static_cast<Int64>(value);
+        if (i >= min && i <= max) {
+            static TTask* const* const cached = [] {
+                static TTask* tasks[max - min + 1];
+                for (Int64 v = min; v <= max; v++)
+                    tasks[v - min] = task_alloc_completed<TTask>(static_cast<T>(v));
+                return tasks;
+            }();
+            return cached[i - min];
+        }
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+        // null, 0.0, default(struct): all-zero bit pattern (-0.0 is not cached)
+        static const unsigned char zero[sizeof(T)] = {};
+        if (std::memcmp(&value, zero, sizeof(T)) == 0) {
+            static TTask* const cached = task_alloc_completed<TTask>(T{});
+            return cached;
+        }
+    }
+    return task_alloc_completed<TTask>(value);
+}
+
+/**
+ * AsyncTaskMethodBuilder.Task. The builder creates its task lazily: a method
+ * that completes before its first real await never allocates a pending task
+ * (see task_builder_set_result).
+ */
+template <typename TTask>
+TTask* task_builder_get_task(TTask*& task) {
+    if (!task) {
+        if constexpr (std::is_same_v<TTask, Task>) {
+            task = task_create_pending();
+        } else {
+            task = static_cast<TTask*>(gc::alloc(sizeof(TTask), nullptr));
+            task_init_pending(reinterpret_cast<Task*>(task));
+        }
+    }
+    return task;
+}
+
+/** AsyncTaskMethodBuilder.SetResult(): synchronous completion shares Task.CompletedTask. */
+inline void task_builder_set_result(Task*& task) {
+    if (!task) {
+        task = task_get_completed();
+        return;
+    }
+    task_complete(task);
+}
+
+/** AsyncTaskMethodBuilder<T>.SetResult(T): synchronous completion uses task_from_result. */
+template <typename TTask>
+void task_builder_set_result(TTask*& task, decltype(TTask::f_result) result) {
+    if (!task) {
+        task = task_from_result<TTask>(result);
+        return;
+    }
+    task->f_result = result;
+    task_complete(reinterpret_cast<Task*>(task));
+}
+
+/** AsyncTaskMethodBuilder.SetException. */
+template <typename TTask>
+void task_builder_set_exception(TTask*& task, Exception* ex) {
+    task_fault(reinterpret_cast<Task*>(task_builder_get_task(task)), ex);
+}
+
+// ===== Pooled async state machines =====
+
+/**
+ * Allocate a boxed async state machine from the calling thread's pool.
+ * The box starts with two references: the stub's (dropped once it has read the
+ * builder's task) and MoveNext's (dropped once it has completed that task).
+ * Used instead of gc::alloc for IRType.IsPooledAsyncStateMachine types.
+ * Boxes are collectable: one that is never released (its task never
+ * completes) is reclaimed by the collector once unreachable.
+ */
+void* async_box_acquire(size_t size, TypeInfo* type);
+
+/**
+ * Drop one reference to a pooled box; the last one clears it and returns it
+ * to the calling thread's pool.
+ */
+void async_box_release(void* box);
+
 // ===== Combinators =====
 
 /** Task that completes when all tasks in the array complete. */
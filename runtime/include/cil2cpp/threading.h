@@ -9,6 +9,7 @@
 
 #include "object.h"
 #include "delegate.h"
+#include "interlocked.h"
 
 namespace cil2cpp {
 
@@ -53,26 +54,6 @@ void pulse_all(Object* obj);
 
 } // namespace monitor
 
-// ===== Interlocked =====
-
-namespace interlocked {
-
-Int32 increment_i32(Int32* location);
-Int32 decrement_i32(Int32* location);
-Int32 exchange_i32(Int32* location, Int32 value);
-Int32 compare_exchange_i32(Int32* location, Int32 value, Int32 comparand);
-Int32 add_i32(Int32* location, Int32 value);
-
-Int64 increment_i64(Int64* location);
-Int64 decrement_i64(Int64* location);
-Int64 exchange_i64(Int64* location, Int64 value);
-Int64 compare_exchange_i64(Int64* location, Int64 value, Int64 comparand);
-
-Object* exchange_obj(Object** location, Object* value);
-Object* compare_exchange_obj(Object** location, Object* value, Object* comparand);
-
-} // namespace interlocked
-
 // ===== Thread =====
 
 /**
@@ -80,21 +61,26 @@ Object* compare_exchange_obj(Object** location, Object* value, Object* comparand
  * Corresponds to System.Threading.Thread.
  */
 struct ManagedThread : Object {
-    void* native_handle;        // std::thread* (heap-allocated)
-    Delegate* start_delegate;   // ThreadStart delegate
-    Int32 managed_id;           // Managed thread ID
-    Int32 state;                // 0=unstarted, 1=running, 2=stopped
+    void* native_handle;            // std::thread* (heap-allocated), owned by whoever reaps it
+    Delegate* start_delegate;       // ThreadStart delegate
+    Int32 managed_id;               // Managed thread ID
+    std::atomic<Int32> state;       // ThreadState below; Stopped doubles as the completion event
+    std::atomic<Int32> joiners;     // threads parked in Join
 };
 
 namespace thread {
 
+constexpr Int32 kUnstarted = 0;
+constexpr Int32 kRunning = 1;
+constexpr Int32 kStopped = 2;
+
 /**
  * Create a new managed thread with a ThreadStart delegate.
  */
 ManagedThread* create(Delegate* start);
 
 /**
- * Start the thread.
+ * Start the thread. Throws InvalidOperationException if it was already started.
  */
 void start(ManagedThread* t);
 
@@ -104,7 +90,8 @@ void start(ManagedThread* t);
 void join(ManagedThread* t);
 
 /**
- * Wait for the thread to complete with a timeout.
+ * Wait for the thread to complete with a timeout (-1 = infinite).
+ * Blocks on the thread's completion event rather than polling.
  * @return true if thread completed, false if timed out
  */
 bool join_timeout(ManagedThread* t, Int32 timeout_ms);
@@ -124,6 +111,19 @@ bool is_alive(ManagedThread* t);
  */
 Int32 get_managed_id(ManagedThread* t);
 
+/**
+ * Thread.CurrentThread. Threads not started through thread::start (the main
+ * thread, thread pool workers) get a Thread object on first use.
+ */
+ManagedThread* current();
+
+/**
+ * Environment.CurrentManagedThreadId: a thread-local read once assigned.
+ * Started threads report the ID given in create; other threads take the
+ * next ID on first use (the main thread is 1, see runtime_init).
+ */
+Int32 current_managed_id();
+
 } // namespace thread
 
 } // namespace cil2cpp
@@ -0,0 +1,102 @@
+/**
+ * CIL2CPP Runtime - ThreadLocal<T>
+ *
+ * Each ThreadLocal<T> takes a slot index (recycled after Dispose), and every
+ * thread owns a table of value cells indexed by slot. The table pointer is a
+ * constant-initialized thread_local, so reading Value in generated code is a
+ * TLS load, a bounds check and an owner compare, inline, with no lock and no
+ * call. Only a thread's first access (which runs the value factory) leaves
+ * that path. The value type is erased to its size; the templates below
+ * supply the typed copy and the typed factory call.
+ *
+ * A cell's owner is the id of the ThreadLocal it belongs to, so cells left
+ * behind in a recycled slot are never mistaken for the new instance's.
+ * Dispose clears the id, which sends every later access to the slow path and
+ * ObjectDisposedException. The table is GC memory rooted through the
+ * thread_local (see gc::register_thread_static_block) and dies with its thread.
+ */
+
+#pragma once
+
+#include "object.h"
+#include "delegate.h"
+#include "exception.h"
+
+namespace cil2cpp {
+
+/** Runtime object behind System.Threading.ThreadLocal<T>. */
+struct ThreadLocal : Object {
+    UInt64 id;              // owner tag of this instance's cells, 0 once disposed
+    Int32 slot;             // index into every thread's cell table
+    Int32 value_size;
+    Delegate* factory;      // Func<T>, or nullptr for default(T)
+};
+
+/** One thread's value for one ThreadLocal; the value follows the header. */
+struct alignas(16) ThreadLocalCell : Object {
+    UInt64 owner;
+};
+
+struct ThreadLocalTable {
+    Int32 capacity;
+    ThreadLocalCell** cells;
+};
+
+namespace tls {
+extern thread_local constinit ThreadLocalTable* t_table;
+} // namespace tls
+
+/** new ThreadLocal<T>() / ThreadLocal<T>(Func<T>); trackAllValues is ignored. */
+ThreadLocal* threadlocal_create(Int32 value_size, Delegate* factory);
+
+/**
+ * Value getter slow path: throws if disposed, otherwise creates the calling
+ * thread's cell, filling it through `run_factory` when there is a factory.
+ * Returns the value's address.
+ */
+void* threadlocal_get_slow(ThreadLocal* tl, void (*run_factory)(Delegate* factory, void* value));
+
+/** Value setter slow path: the calling thread's cell, created without running the factory. */
+void* threadlocal_set_slow(ThreadLocal* tl);
+
+/** ThreadLocal<T>.IsValueCreated. */
+bool threadlocal_is_value_created(ThreadLocal* tl);
+
+/** ThreadLocal<T>.Dispose: frees the slot; later accesses throw ObjectDisposedException. */
+void threadlocal_dispose(ThreadLocal* tl);
+
+/** The calling thread's value for `tl`, or nullptr if it has none yet (or tl is disposed). */
+inline void* threadlocal_find(ThreadLocal* tl) {
+    ThreadLocalTable* table = tls::t_table;
+    if (table && tl->slot < table->capacity) {
+        ThreadLocalCell* cell = table->cells[tl->slot];
+        if (cell && cell->owner == tl->id) return cell + 1;
+    }
+    return nullptr;
+}
+
+template <typename T>
+void threadlocal_run_factory(Delegate* factory, void* value) {
+    *static_cast<T*>(value) = factory->target
+        ? reinterpret_cast<T(*)(Object*)>(factory->method_ptr)(factory->target)
+        : reinterpret_cast<T(*)()>(factory->method_ptr)();
+}
+
+/** ThreadLocal<T>.Value getter. */
+template <typename T>
+inline T threadlocal_get_value(ThreadLocal* tl) {
+    if (!tl) throw_null_reference();
+    if (void* value = threadlocal_find(tl)) return *static_cast<T*>(value);
+    return *static_cast<T*>(threadlocal_get_slow(tl, &threadlocal_run_factory<T>));
+}
+
+/** ThreadLocal<T>.Value setter. */
+template <typename T>
+inline void threadlocal_set_value(ThreadLocal* tl, T value) {
+    if (!tl) throw_null_reference();
+    void* slot = threadlocal_find(tl);
+    if (!slot) slot = threadlocal_set_slow(tl);
+    *static_cast<T*>(slot) = value;
+}
+
+} // namespace cil2cpp
@@ -27,6 +27,9 @@ void shutdown();
 /** Check if thread pool is initialized. */
 bool is_initialized();
 
+/** Number of worker threads (0 when not initialized). */
+Int32 worker_count();
+
 /**
  * Queue a work item (C function pointer + state).
  * The function will be called on a worker thread.
@@ -196,6 +196,15 @@ struct TypeInfo {
     uint8_t* generic_variances;           // 0=invariant, 1=covariant, 2=contravariant
     UInt32 generic_argument_count;
     const char* generic_definition_name; // Open type's full_name, or nullptr
+
+    // Value types: the type's own Equals/GetHashCode called on unboxed values
+    // (compiler-emitted thunks). nullptr when the type does not override them —
+    // collections then compare and hash the raw bytes.
+    Boolean (*value_equals)(const void* a, const void* b);
+    Int32 (*value_hash)(const void* value);
+
+    // Primitives: shared boxes of small values (box_cache), built on first box
+    Object** small_boxes;
 };
 
 /**
@@ -0,0 +1,62 @@
+/**
+ * CIL2CPP Runtime - UTF-8 ⇄ UTF-16 transcoding
+ *
+ * Every boundary between managed strings (UTF-16) and the outside world
+ * (console, files, paths, reflection names, C string literals) goes through
+ * these functions. ASCII runs are handled by SIMD kernels selected at run time
+ * (see simd.h); everything else by a validating scalar path.
+ *
+ * Ill-formed input never fails: each maximal invalid UTF-8 subsequence and
+ * each unpaired UTF-16 surrogate becomes U+FFFD, matching .NET's
+ * UTF8Encoding replacement behavior.
+ */
+
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+
+namespace cil2cpp {
+namespace utf {
+
+/// UTF-8 bytes needed per UTF-16 code unit in the worst case (BMP char → 3;
+/// a surrogate pair is 4 bytes for 2 units). Use len * 3 as a buffer bound.
+constexpr size_t MAX_UTF8_BYTES_PER_UNIT = 3;
+
+/**
+ * Number of UTF-16 code units utf8_to_utf16() produces for this input.
+ * Never exceeds len.
+ */
+size_t utf8_to_utf16_length(const char* src, size_t len);
+
+/**
+ * Decode UTF-8 into dst, which must hold utf8_to_utf16_length(src, len) units
+ * (len units is always enough). Returns the number of units written.
+ */
+size_t utf8_to_utf16(const char* src, size_t len, Char* dst);
+
+/**
+ * Number of bytes utf16_to_utf8() produces for this input.
+ */
+size_t utf16_to_utf8_length(const Char* src, size_t len);
+
+/**
+ * Encode UTF-16 into dst, which must hold utf16_to_utf8_length(src, len)
+ * bytes (len * MAX_UTF8_BYTES_PER_UNIT is always enough). No terminator is
+ * written. Returns the number of bytes written.
+ */
+size_t utf16_to_utf8(const Char* src, size_t len, char* dst);
+
+/**
+ * Largest prefix of src, at most max_units long, that can be encoded on its
+ * own: a surrogate pair straddling the cut is left for the next chunk.
+ * For streaming output through a fixed-size buffer (max_units >= 2).
+ */
+inline size_t utf16_chunk(const Char* src, size_t len, size_t max_units) {
+    if (len <= max_units) return len;
+    Char last = src[max_units - 1];
+    return (last >= 0xD800 && last <= 0xDBFF) ? max_units - 1 : max_units;
+}
+
+} // namespace utf
+} // namespace cil2cpp
@@ -0,0 +1,124 @@
+/**
+ * CIL2CPP Runtime - Vectorized aggregate and search kernels
+ *
+ * Primitive-element loops behind Enumerable.Sum / Min / Max / Average /
+ * Contains and the Span<T> helpers (IndexOf, Contains, SequenceEqual, Fill,
+ * Clear). SSE2/AVX2 implementations are selected at run time (see simd.h);
+ * every kernel has a scalar tail, so any length is accepted.
+ *
+ * Results match the BCL exactly:
+ *  - Integer Sum is checked: OverflowException is thrown exactly when the
+ *    element-by-element sum would overflow at some step.
+ *  - Floating-point Sum and Average add in element order (no reassociation),
+ *    so the result is bit-identical to the sequential loop.
+ *  - Floating-point Min returns the first NaN if there is one; Max ignores
+ *    NaN unless every element is NaN. Among equal values (+0.0 / -0.0) the
+ *    first one wins.
+ *  - Floating-point search and SequenceEqual use Equals semantics
+ *    (NaN equals NaN, +0.0 equals -0.0); other types compare bitwise.
+ */
+
+#pragma once
+
+#include "types.h"
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+namespace cil2cpp {
+namespace vec {
+
+// ===== Aggregates =====
+// Min, Max and Average require n > 0; callers throw InvalidOperationException on empty input.
+
+Int32 sum(const Int32* data, Int32 n);
+Int64 sum(const Int64* data, Int32 n);
+Double sum(const Double* data, Int32 n);
+/** Accumulates in double, as Enumerable.Sum(IEnumerable<float>) does. */
+Double sum(const Single* data, Int32 n);
+
+Int32 min(const Int32* data, Int32 n);
+Int64 min(const Int64* data, Int32 n);
+Double min(const Double* data, Int32 n);
+Single min(const Single* data, Int32 n);
+
+Int32 max(const Int32* data, Int32 n);
+Int64 max(const Int64* data, Int32 n);
+Double max(const Double* data, Int32 n);
+Single max(const Single* data, Int32 n);
+
+Double average(const Int32* data, Int32 n);
+Double average(const Int64* data, Int32 n);
+Double average(const Double* data, Int32 n);
+Single average(const Single* data, Int32 n);
+
+// ===== Search, comparison, fill =====
+
+namespace detail {
+Int32 index_of_8(const void* data, Int32 n, Byte value);
+Int32 index_of_16(const void* data, Int32 n, UInt16 value);
+Int32 index_of_32(const void* data, Int32 n, UInt32 value);
+Int32 index_of_64(const void* data, Int32 n, UInt64 value);
+Int32 index_of_f32(const Single* data, Int32 n, Single value);
+Int32 index_of_f64(const Double* data, Int32 n, Double value);
+bool equal_f32(const Single* a, const Single* b, Int32 n);
+bool equal_f64(const Double* a, const Double* b, Int32 n);
+void fill_16(void* data, Int32 n, UInt16 value);
+void fill_32(void* data, Int32 n, UInt32 value);
+void fill_64(void* data, Int32 n, UInt64 value);
+} // namespace detail
+
+/**
+ * Index of the first element equal to value in data[0..n), or -1.
+ */
+template<typename T>
+inline Int32 index_of(const T* data, Int32 n, T value) {
+    static_assert(std::is_arithmetic_v<T>, "vec::index_of supports primitive element types");
+    if constexpr (std::is_same_v<T, Single>) return detail::index_of_f32(data, n, value);
+    else if constexpr (std::is_same_v<T, Double>) return detail::index_of_f64(data, n, value);
+    else if constexpr (sizeof(T) == 1) return detail::index_of_8(data, n, std::bit_cast<Byte>(value));
+    else if constexpr (sizeof(T) == 2) return detail::index_of_16(data, n, std::bit_cast<UInt16>(value));
+    else if constexpr (sizeof(T) == 4) return detail::index_of_32(data, n, std::bit_cast<UInt32>(value));
+    else return detail::index_of_64(data, n, std::bit_cast<UInt64>(value));
+}
+
+template<typename T>
+inline bool contains(const T* data, Int32 n, T value) {
+    return index_of(data, n, value) >= 0;
+}
+
+/**
+ * Whether a[0..n) and b[0..n) are element-wise equal.
+ */
+template<typename T>
+inline bool sequence_equal(const T* a, const T* b, Int32 n) {
+    static_assert(std::is_arithmetic_v<T>, "vec::sequence_equal supports primitive element types");
+    if (n <= 0 || a == b) return true;
+    if constexpr (std::is_same_v<T, Single>) return detail::equal_f32(a, b, n);
+    else if constexpr (std::is_same_v<T, Double>) return detail::equal_f64(a, b, n);
+    else return std::memcmp(a, b, static_cast<size_t>(n) * sizeof(T)) == 0;
+}
+
+/**
+ * Set data[0..n) to value.
+ */
+template<typename T>
+inline void fill(T* data, Int32 n, T value) {
+    static_assert(std::is_arithmetic_v<T>, "vec::fill supports primitive element types");
+    if (n <= 0) return;
+    if constexpr (sizeof(T) == 1) std::memset(data, std::bit_cast<Byte>(value), static_cast<size_t>(n));
+    else if constexpr (sizeof(T) == 2) detail::fill_16(data, n, std::bit_cast<UInt16>(value));
+    else if constexpr (sizeof(T) == 4) detail::fill_32(data, n, std::bit_cast<UInt32>(value));
+    else detail::fill_64(data, n, std::bit_cast<UInt64>(value));
+}
+
+/**
+ * Zero `bytes` bytes at data (Span<T>.Clear, Array.Clear).
+ */
+inline void clear(void* data, size_t bytes) {
+    if (bytes > 0) std::memset(data, 0, bytes);
+}
+
+} // namespace vec
+} // namespace cil2cpp
@@ -8,10 +8,24 @@
 #include "cil2cpp/type_info.h"
 #include "cil2cpp/threadpool.h"
 #include <atomic>
+#include <mutex>
 #include <thread>
 
 namespace cil2cpp {
 
+// A registered callback, linked into its source's list until it runs or is
+// unregistered (GC-allocated: the source keeps the callback state alive).
+struct CancellationRegistration {
+    CancellationRegistration* prev;
+    CancellationRegistration* next;
+    CancellationTokenSource* source;    // nullptr once unlinked
+    CancellationCallback callback;
+    void* state;
+};
+
+// Guards every source's registration list
+static std::mutex g_registrations_lock;
+
 // Forward declaration
 extern TypeInfo CancellationTokenSource_TypeInfo;
 
@@ -27,7 +41,17 @@ void cts_cancel(CancellationTokenSource* cts) {
     // Atomic CAS: only cancel if currently active (state 0 -> 1)
     auto* state = reinterpret_cast<std::atomic<Int32>*>(&cts->f__state);
     Int32 expected = 0;
-    state->compare_exchange_strong(expected, 1);
+    if (!state->compare_exchange_strong(expected, 1)) return;
+
+    // No callback can be added from here on; run the registered ones outside the lock
+    CancellationRegistration* head;
+    {
+        std::lock_guard<std::mutex> guard(g_registrations_lock);
+        head = cts->f__registrations;
+        cts->f__registrations = nullptr;
+        for (auto* r = head; r; r = r->next) r->source = nullptr;
+    }
+    for (auto* r = head; r; r = r->next) r->callback(r->state);
 }
 
 // Context struct for delayed cancellation (avoids std::pair template issues)
@@ -53,6 +77,33 @@ void ct_throw_if_cancellation_requested(CancellationToken token) {
     }
 }
 
+CancellationRegistration* ct_register(CancellationToken token, CancellationCallback callback, void* state) {
+    auto* cts = token.f__source;
+    if (!cts) return nullptr;
+    auto* r = static_cast<CancellationRegistration*>(gc::alloc(sizeof(CancellationRegistration), nullptr));
+    r->callback = callback;
+    r->state = state;
+    std::lock_guard<std::mutex> guard(g_registrations_lock);
+    // cts_cancel moves the state off 0 before it takes the lock to collect the callbacks
+    if (reinterpret_cast<std::atomic<Int32>*>(&cts->f__state)->load() != 0) return nullptr;
+    r->source = cts;
+    r->next = cts->f__registrations;
+    if (r->next) r->next->prev = r;
+    cts->f__registrations = r;
+    return r;
+}
+
+void ct_unregister(CancellationRegistration* registration) {
+    if (!registration) return;
+    std::lock_guard<std::mutex> guard(g_registrations_lock);
+    auto* cts = registration->source;
+    if (!cts) return;
+    if (registration->prev) registration->prev->next = registration->next;
+    else cts->f__registrations = registration->next;
+    if (registration->next) registration->next->prev = registration->prev;
+    registration->source = nullptr;
+}
+
 // ===== TaskCompletionSource =====
 
 Task* tcs_create() {
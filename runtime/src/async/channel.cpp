@@ -0,0 +1,616 @@
+/**
+ * CIL2CPP Runtime - Channel<T> Implementation
+ * Lock-free bounded ring / unbounded segment queue with task-based waiters.
+ */
+
+#include <cil2cpp/channel.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/reflection.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace cil2cpp {
+
+static constexpr size_t kCacheLine = 64;
+static constexpr Int32 kFirstSegmentSlots = 32;
+static constexpr Int32 kMaxSegmentSlots = 1024;
+
+// A ring cell or segment slot: a sequence word followed by the item bytes.
+//  - ring cell for position pos: seq == 2*pos -> free for the producer of pos,
+//    seq == 2*pos + 1 -> holds its item; the consumer hands the cell to the
+//    producer of the next lap with seq = 2*(pos + capacity). (Doubling keeps
+//    "full" and "free for the next lap" apart when capacity is 1.)
+//  - segment slot: 0 = empty (or still being written), 1 = holds its item.
+struct ChannelSlot {
+    std::atomic<UInt64> seq;
+};
+
+struct Segment {
+    std::atomic<Segment*> next;
+    Int32 slots;
+    std::atomic<Int32> enq;         // slots claimed by producers (may run past `slots`)
+    std::atomic<Int32> deq;         // slots taken by consumers
+    // `slots` ChannelSlots follow
+};
+
+enum class WaiterKind : Int32 { Read, WaitToRead, Write };
+
+struct Channel;
+
+// A parked ReadAsync / WaitToReadAsync / WriteAsync call (GC-allocated, so the
+// items and tasks it references stay alive).
+struct ChannelWaiter {
+    ChannelWaiter* next;
+    Task* task;
+    void* dest;                     // Read: the task's result; WaitToRead: its bool result
+    Exception* fault;               // set when the call fails instead
+    Channel* channel;
+    CancellationRegistration* registration;     // the call's token, if it can be canceled
+    WaiterKind kind;
+    // Write: the item follows
+};
+
+struct WaiterList {
+    ChannelWaiter* head;
+    ChannelWaiter* tail;
+
+    void push(ChannelWaiter* w) {
+        w->next = nullptr;
+        if (tail) tail->next = w; else head = w;
+        tail = w;
+    }
+
+    ChannelWaiter* pop() {
+        auto* w = head;
+        if (w) {
+            head = w->next;
+            if (!head) tail = nullptr;
+        }
+        return w;
+    }
+
+    // Unlink `w`; false if it is not in the list
+    bool remove(ChannelWaiter* w) {
+        ChannelWaiter* prev = nullptr;
+        for (auto* it = head; it; prev = it, it = it->next) {
+            if (it != w) continue;
+            (prev ? prev->next : head) = w->next;
+            if (tail == w) tail = prev;
+            return true;
+        }
+        return false;
+    }
+};
+
+// Producer and consumer positions sit on separate cache lines, away from the
+// slow-path state.
+struct Channel {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 element_size;
+    Int32 capacity;                 // bounded: ring size; 0 = unbounded
+    size_t stride;                  // bytes per slot (sequence word + item)
+    char* cells;                    // bounded: the ring
+
+    char pad0[kCacheLine];
+    std::atomic<UInt64> enq_pos;    // bounded: next producer position
+    std::atomic<Segment*> tail;     // unbounded: segment producers append to
+    char pad1[kCacheLine - 16];
+    std::atomic<UInt64> deq_pos;    // bounded: next consumer position
+    std::atomic<Segment*> head;     // unbounded: segment consumers read from
+    char pad2[kCacheLine - 16];
+
+    std::atomic<Int32> writers_in_flight;   // lock-free writers past the completed check
+    std::atomic<Int32> readers_waiting;
+    std::atomic<Int32> writers_waiting;
+    std::atomic<bool> completed;
+
+    // Under lock
+    std::mutex lock;
+    WaiterList readers;
+    WaiterList writers;
+    Exception* error;
+    Task* completion;
+    bool drained;                   // completed and every item read
+};
+
+static TypeInfo Channel_TypeInfo = {
+    .name = "Channel`1",
+    .namespace_name = "System.Threading.Channels",
+    .full_name = "System.Threading.Channels.Channel`1",
+    .base_type = &System_Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(Channel),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+// ===== Data path =====
+
+static ChannelSlot* ring_cell(Channel* c, UInt64 pos) {
+    return reinterpret_cast<ChannelSlot*>(c->cells + (pos % static_cast<UInt64>(c->capacity)) * c->stride);
+}
+
+static ChannelSlot* segment_slot(Channel* c, Segment* seg, Int32 i) {
+    return reinterpret_cast<ChannelSlot*>(reinterpret_cast<char*>(seg + 1) + static_cast<size_t>(i) * c->stride);
+}
+
+static void* slot_item(ChannelSlot* slot) {
+    return slot + 1;
+}
+
+static Segment* segment_create(Channel* c, Int32 slots) {
+    void* memory = gc::alloc(sizeof(Segment) + static_cast<size_t>(slots) * c->stride, nullptr);
+    auto* seg = new (memory) Segment{};
+    seg->slots = slots;
+    return seg;
+}
+
+static bool ring_try_enqueue(Channel* c, const void* item) {
+    UInt64 pos = c->enq_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        auto* cell = ring_cell(c, pos);
+        auto diff = static_cast<Int64>(cell->seq.load(std::memory_order_acquire) - 2 * pos);
+        if (diff == 0) {
+            if (c->enq_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                std::memcpy(slot_item(cell), item, c->element_size);
+                cell->seq.store(2 * pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;   // full: the cell still holds the item of the previous lap
+        } else {
+            pos = c->enq_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static bool ring_try_dequeue(Channel* c, void* item) {
+    UInt64 pos = c->deq_pos.load(std::memory_order_relaxed);
+    for (;;) {
+        auto* cell = ring_cell(c, pos);
+        auto diff = static_cast<Int64>(cell->seq.load(std::memory_order_acquire) - (2 * pos + 1));
+        if (diff == 0) {
+            if (c->deq_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                std::memcpy(item, slot_item(cell), c->element_size);
+                std::memset(slot_item(cell), 0, c->element_size);  // don't keep the item alive
+                cell->seq.store(2 * (pos + static_cast<UInt64>(c->capacity)), std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;   // empty
+        } else {
+            pos = c->deq_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+static bool ring_has_item(Channel* c) {
+    UInt64 pos = c->deq_pos.load(std::memory_order_acquire);
+    return ring_cell(c, pos)->seq.load(std::memory_order_acquire) == 2 * pos + 1;
+}
+
+static void segments_enqueue(Channel* c, const void* item) {
+    for (;;) {
+        Segment* seg = c->tail.load(std::memory_order_acquire);
+        Int32 i = seg->enq.fetch_add(1, std::memory_order_relaxed);
+        if (i < seg->slots) {
+            auto* slot = segment_slot(c, seg, i);
+            std::memcpy(slot_item(slot), item, c->element_size);
+            slot->seq.store(1, std::memory_order_release);
+            return;
+        }
+        // Full: make sure it has a successor, then help move the tail
+        Segment* next = seg->next.load(std::memory_order_acquire);
+        if (!next) {
+            Int32 slots = seg->slots < kMaxSegmentSlots ? seg->slots * 2 : kMaxSegmentSlots;
+            Segment* fresh = segment_create(c, slots);
+            if (seg->next.compare_exchange_strong(next, fresh, std::memory_order_acq_rel))
+                next = fresh;   // otherwise `next` is the segment another producer linked
+        }
+        c->tail.compare_exchange_strong(seg, next, std::memory_order_acq_rel);
+    }
+}
+
+static bool segments_try_dequeue(Channel* c, void* item) {
+    for (;;) {
+        Segment* seg = c->head.load(std::memory_order_acquire);
+        Int32 i = seg->deq.load(std::memory_order_acquire);
+        if (i < seg->slots) {
+            auto* slot = segment_slot(c, seg, i);
+            // Empty, or its producer is still copying the item (it wakes any
+            // parked reader once the item is published)
+            if (slot->seq.load(std::memory_order_acquire) == 0) return false;
+            if (seg->deq.compare_exchange_weak(i, i + 1, std::memory_order_relaxed)) {
+                std::memcpy(item, slot_item(slot), c->element_size);
+                std::memset(slot_item(slot), 0, c->element_size);
+                return true;
+            }
+            continue;
+        }
+        Segment* next = seg->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        c->head.compare_exchange_strong(seg, next, std::memory_order_acq_rel);
+    }
+}
+
+static bool segments_has_item(Channel* c) {
+    for (Segment* seg = c->head.load(std::memory_order_acquire); seg;
+         seg = seg->next.load(std::memory_order_acquire)) {
+        Int32 i = seg->deq.load(std::memory_order_acquire);
+        if (i < seg->slots)
+            return segment_slot(c, seg, i)->seq.load(std::memory_order_acquire) != 0;
+    }
+    return false;
+}
+
+static bool try_enqueue(Channel* c, const void* item) {
+    if (c->capacity > 0) return ring_try_enqueue(c, item);
+    segments_enqueue(c, item);
+    return true;
+}
+
+static bool try_dequeue(Channel* c, void* item) {
+    return c->capacity > 0 ? ring_try_dequeue(c, item) : segments_try_dequeue(c, item);
+}
+
+static bool has_item(Channel* c) {
+    return c->capacity > 0 ? ring_has_item(c) : segments_has_item(c);
+}
+
+// ===== Waiters =====
+//
+// A reader or writer that cannot proceed registers itself (readers_waiting /
+// writers_waiting) under the lock, then retries once. Whoever enqueues or
+// dequeues checks the other side's counter afterwards; a full fence on both
+// sides guarantees that either the retry sees the new item / free slot or the
+// other side sees the counter and hands it over under the lock.
+
+static void* waiter_item(ChannelWaiter* w) {
+    return w + 1;
+}
+
+static ChannelWaiter* waiter_create(Channel* c, WaiterKind kind, Task* task, void* dest) {
+    size_t extra = kind == WaiterKind::Write ? static_cast<size_t>(c->element_size) : 0;
+    auto* w = static_cast<ChannelWaiter*>(gc::alloc(sizeof(ChannelWaiter) + extra, nullptr));
+    w->kind = kind;
+    w->task = task;
+    w->dest = dest;
+    w->channel = c;
+    return w;
+}
+
+static Exception* closed_exception(Channel* c) {
+    return channel_closed_exception_create(c->error);
+}
+
+// Completed lock-less task in the faulted state (for calls on a closed channel)
+static Task* faulted_task(size_t task_size, Exception* ex) {
+    auto* t = static_cast<Task*>(gc::alloc(task_size, &Task_TypeInfo));
+    task_init_completed(t);
+    t->f_status = 2;
+    t->f_exception = ex;
+    return t;
+}
+
+static Task* pending_task(size_t task_size) {
+    auto* t = static_cast<Task*>(gc::alloc(task_size, &Task_TypeInfo));
+    task_init_pending(t);
+    return t;
+}
+
+static Task* canceled_task(size_t task_size) {
+    return faulted_task(task_size, operation_canceled_exception_create());
+}
+
+// Token callback: a waiter still parked leaves its list and faults with
+// OperationCanceledException; one already served is left alone.
+static void cancel_waiter(void* state) {
+    auto* w = static_cast<ChannelWaiter*>(state);
+    Channel* c = w->channel;
+    {
+        std::lock_guard<std::mutex> guard(c->lock);
+        if (w->kind == WaiterKind::Write) {
+            if (!c->writers.remove(w)) return;
+            c->writers_waiting.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            if (!c->readers.remove(w)) return;
+            c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+    task_fault(w->task, operation_canceled_exception_create());
+}
+
+// Park `w` on `list` (under the lock) until it is served or its token is
+// canceled. False, without parking, if the token was canceled meanwhile.
+static bool park_locked(WaiterList& list, ChannelWaiter* w, CancellationToken token) {
+    w->registration = ct_register(token, cancel_waiter, w);
+    if (!w->registration && ct_is_cancellation_requested(token)) return false;
+    list.push(w);
+    return true;
+}
+
+// Hand items to parked readers and free slots to parked writers for as long
+// as either makes progress. Finished waiters move to `done`.
+static void drain_locked(Channel* c, WaiterList& done) {
+    for (bool progress = true; progress;) {
+        progress = false;
+        while (auto* w = c->readers.head) {
+            if (w->kind == WaiterKind::Read) {
+                if (!try_dequeue(c, w->dest)) break;
+            } else {
+                if (!has_item(c)) break;
+                *static_cast<bool*>(w->dest) = true;
+            }
+            done.push(c->readers.pop());
+            c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            progress = true;
+        }
+        while (auto* w = c->writers.head) {
+            if (!try_enqueue(c, waiter_item(w))) break;
+            done.push(c->writers.pop());
+            c->writers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            progress = true;
+        }
+    }
+}
+
+// Once the channel is completed and empty, fail the parked readers and
+// release Completion (returned, to be completed after unlocking).
+static Task* finish_if_drained_locked(Channel* c, WaiterList& done) {
+    if (c->drained || !c->completed.load(std::memory_order_relaxed) || has_item(c)) return nullptr;
+    c->drained = true;
+    while (auto* w = c->readers.pop()) {
+        if (w->kind == WaiterKind::Read)
+            w->fault = closed_exception(c);
+        else if (c->error)
+            w->fault = c->error;
+        else
+            *static_cast<bool*>(w->dest) = false;
+        c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+        done.push(w);
+    }
+    return c->completion;
+}
+
+// Complete the tasks of finished waiters (outside the lock: continuations may
+// run inline and call back into the channel).
+static void release(Channel* c, WaiterList& done, Task* completion) {
+    while (auto* w = done.pop()) {
+        ct_unregister(w->registration);
+        if (w->fault) task_fault(w->task, w->fault);
+        else task_complete(w->task);
+    }
+    if (completion) {
+        if (c->error) task_fault(completion, c->error);
+        else task_complete(completion);
+    }
+}
+
+static void wake(Channel* c) {
+    WaiterList done = {};
+    Task* completion;
+    {
+        std::lock_guard<std::mutex> guard(c->lock);
+        drain_locked(c, done);
+        completion = finish_if_drained_locked(c, done);
+    }
+    release(c, done, completion);
+}
+
+static void after_enqueue(Channel* c) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (c->readers_waiting.load(std::memory_order_relaxed) > 0) wake(c);
+}
+
+static void after_dequeue(Channel* c) {
+    if (c->capacity > 0) {  // only bounded writers ever wait
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (c->writers_waiting.load(std::memory_order_relaxed) > 0) {
+            wake(c);
+            return;
+        }
+    }
+    if (c->completed.load(std::memory_order_acquire)) wake(c);
+}
+
+// Lock-free write; false if the ring is full or (closed = true) the channel is completed
+static bool write_lock_free(Channel* c, const void* item, bool& closed) {
+    c->writers_in_flight.fetch_add(1, std::memory_order_seq_cst);
+    if (c->completed.load(std::memory_order_seq_cst)) {
+        c->writers_in_flight.fetch_sub(1, std::memory_order_release);
+        closed = true;
+        return false;
+    }
+    bool written = try_enqueue(c, item);
+    c->writers_in_flight.fetch_sub(1, std::memory_order_release);
+    if (written) after_enqueue(c);
+    return written;
+}
+
+// ===== Public API =====
+
+static Channel* channel_alloc(Int32 capacity, Int32 element_size) {
+    void* memory = gc::alloc(sizeof(Channel), &Channel_TypeInfo);
+    auto* c = new (memory) Channel{};
+    c->__type_info = &Channel_TypeInfo;
+    c->element_size = element_size;
+    c->capacity = capacity;
+    c->stride = (sizeof(ChannelSlot) + static_cast<size_t>(element_size) + 7) & ~static_cast<size_t>(7);
+    return c;
+}
+
+Channel* channel_create_bounded(Int32 capacity, Int32 element_size) {
+    if (capacity < 1) throw_argument_out_of_range();
+    auto* c = channel_alloc(capacity, element_size);
+    c->cells = static_cast<char*>(gc::alloc(static_cast<size_t>(capacity) * c->stride, nullptr));
+    for (Int32 i = 0; i < capacity; i++)
+        ring_cell(c, static_cast<UInt64>(i))->seq.store(2 * static_cast<UInt64>(i), std::memory_order_relaxed);
+    return c;
+}
+
+Channel* channel_create_unbounded(Int32 element_size) {
+    auto* c = channel_alloc(0, element_size);
+    Segment* seg = segment_create(c, kFirstSegmentSlots);
+    c->head.store(seg, std::memory_order_relaxed);
+    c->tail.store(seg, std::memory_order_relaxed);
+    return c;
+}
+
+bool channel_try_write(Channel* c, const void* item) {
+    null_check(c);
+    bool closed = false;
+    return write_lock_free(c, item, closed);
+}
+
+bool channel_try_read(Channel* c, void* item) {
+    null_check(c);
+    if (!try_dequeue(c, item)) return false;
+    after_dequeue(c);
+    return true;
+}
+
+Task* channel_write_async(Channel* c, const void* item, CancellationToken token) {
+    null_check(c);
+    if (ct_is_cancellation_requested(token)) return canceled_task(sizeof(Task));
+    bool closed = false;
+    if (write_lock_free(c, item, closed)) return nullptr;
+    if (closed) return faulted_task(sizeof(Task), closed_exception(c));
+
+    // Bounded and full: park, unless a slot freed up meanwhile
+    {
+        std::lock_guard<std::mutex> guard(c->lock);
+        if (c->completed.load(std::memory_order_relaxed))
+            return faulted_task(sizeof(Task), closed_exception(c));
+        c->writers_waiting.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!try_enqueue(c, item)) {
+            auto* w = waiter_create(c, WaiterKind::Write, pending_task(sizeof(Task)), nullptr);
+            std::memcpy(waiter_item(w), item, c->element_size);
+            if (park_locked(c->writers, w, token)) return w->task;
+            c->writers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            return canceled_task(sizeof(Task));
+        }
+        c->writers_waiting.fetch_sub(1, std::memory_order_relaxed);
+    }
+    after_enqueue(c);
+    return nullptr;
+}
+
+Task* channel_read_async(Channel* c, void* item, size_t task_size, size_t result_offset,
+                         CancellationToken token) {
+    null_check(c);
+    if (ct_is_cancellation_requested(token)) return canceled_task(task_size);
+    if (try_dequeue(c, item)) {
+        after_dequeue(c);
+        return nullptr;
+    }
+
+    WaiterList done = {};
+    Task* completion;
+    Task* result = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(c->lock);
+        c->readers_waiting.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (try_dequeue(c, item)) {
+            c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+        } else if (c->completed.load(std::memory_order_relaxed)) {
+            // Completed under the lock: no writer is still in flight, so it is empty for good
+            c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            result = faulted_task(task_size, closed_exception(c));
+        } else {
+            result = pending_task(task_size);
+            auto* w = waiter_create(c, WaiterKind::Read, result, reinterpret_cast<char*>(result) + result_offset);
+            if (park_locked(c->readers, w, token)) return result;
+            c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            return canceled_task(task_size);
+        }
+        completion = finish_if_drained_locked(c, done);
+    }
+    release(c, done, completion);
+    if (!result) after_dequeue(c);
+    return result;
+}
+
+Task* channel_wait_to_read_async(Channel* c, bool* ready, size_t task_size, size_t result_offset,
+                                 CancellationToken token) {
+    null_check(c);
+    if (ct_is_cancellation_requested(token)) return canceled_task(task_size);
+    if (has_item(c)) {
+        *ready = true;
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> guard(c->lock);
+    c->readers_waiting.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (has_item(c) || c->completed.load(std::memory_order_relaxed)) {
+        c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+        *ready = has_item(c);
+        if (!*ready && c->error) return faulted_task(task_size, c->error);
+        return nullptr;
+    }
+    auto* task = pending_task(task_size);
+    auto* w = waiter_create(c, WaiterKind::WaitToRead, task, reinterpret_cast<char*>(task) + result_offset);
+    if (park_locked(c->readers, w, token)) return task;
+    c->readers_waiting.fetch_sub(1, std::memory_order_relaxed);
+    return canceled_task(task_size);
+}
+
+bool channel_try_complete(Channel* c, Exception* error) {
+    null_check(c);
+    WaiterList done = {};
+    Task* completion;
+    {
+        std::lock_guard<std::mutex> guard(c->lock);
+        if (c->completed.load(std::memory_order_relaxed)) return false;
+        c->error = error;
+        c->completed.store(true, std::memory_order_seq_cst);
+        // Lock-free writers that got past the completed check finish their item
+        while (c->writers_in_flight.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
+        while (auto* w = c->writers.pop()) {
+            w->fault = closed_exception(c);
+            c->writers_waiting.fetch_sub(1, std::memory_order_relaxed);
+            done.push(w);
+        }
+        drain_locked(c, done);
+        completion = finish_if_drained_locked(c, done);
+    }
+    release(c, done, completion);
+    return true;
+}
+
+void channel_complete(Channel* c, Exception* error) {
+    if (!channel_try_complete(c, error))
+        throw_exception(closed_exception(c));
+}
+
+Task* channel_get_completion(Channel* c) {
+    null_check(c);
+    std::lock_guard<std::mutex> guard(c->lock);
+    if (!c->completion) {
+        if (!c->drained) c->completion = task_create_pending();
+        else if (c->error) c->completion = faulted_task(sizeof(Task), c->error);
+        else c->completion = task_get_completed();
+    }
+    return c->completion;
+}
+
+} // namespace cil2cpp
@@ -0,0 +1,264 @@
+/**
+ * CIL2CPP Runtime - Fork-join loops over the thread pool
+ *
+ * Every participant owns a Range; the owner takes chunks from the front and
+ * thieves take the back half, both under the range's spin lock (critical
+ * sections are a few loads and stores). The job is reference counted because
+ * a helper queued on the pool may start after the loop has already finished.
+ */
+
+#include <cil2cpp/parallel.h>
+#include <cil2cpp/array.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/threadpool.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace cil2cpp {
+
+TypeInfo ParallelOptions_TypeInfo = {
+    .name = "ParallelOptions",
+    .namespace_name = "System.Threading.Tasks",
+    .full_name = "System.Threading.Tasks.ParallelOptions",
+    .base_type = &System::Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(ParallelOptions),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+ParallelOptions* parallel_options_create() {
+    auto* options = static_cast<ParallelOptions*>(gc::alloc(sizeof(ParallelOptions), &ParallelOptions_TypeInfo));
+    options->f_cancellationToken = ct_get_none();
+    options->f_maxDegreeOfParallelism = -1;
+    return options;
+}
+
+namespace parallel {
+
+namespace {
+
+// Chunks per participant when the work is spread evenly; more chunks balance
+// uneven iterations better, fewer cost less bookkeeping
+constexpr Int64 kChunksPerParticipant = 16;
+constexpr Int64 kMaxChunk = 1 << 16;
+
+class SpinLock {
+public:
+    void lock() {
+        while (flag_.test_and_set(std::memory_order_acquire)) {
+            while (flag_.test(std::memory_order_relaxed)) {
+            }
+        }
+    }
+    void unlock() { flag_.clear(std::memory_order_release); }
+
+private:
+    std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+};
+
+// next/end change only under the lock; thieves read them unlocked to pick a victim
+struct alignas(64) Range {
+    SpinLock lock;
+    std::atomic<Int64> next{0};
+    std::atomic<Int64> end{0};
+};
+
+struct Job {
+    RangeBody body;
+    void* ctx;
+    CancellationToken token;
+    Int32 degree;
+    Int64 grain;
+    std::unique_ptr<Range[]> ranges;
+    // One slot per participant: the data of an Exception[] on the GC heap so
+    // the exceptions stay reachable; the caller's stack keeps the array alive
+    Exception** errors;
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> canceled{false};
+    std::atomic<Int32> refs{1};
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    Int32 next_participant = 1;
+    Int32 active = 0;
+    bool closed = false;
+
+    void release() {
+        if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+    }
+};
+
+/** Take the next chunk of participant p's own range. */
+bool take_own(Job& job, Int32 p, Int64& lo, Int64& hi) {
+    Range& r = job.ranges[p];
+    std::lock_guard<SpinLock> guard(r.lock);
+    const Int64 end = r.end.load(std::memory_order_relaxed);
+    lo = r.next.load(std::memory_order_relaxed);
+    if (lo >= end) return false;
+    hi = std::min(end, lo + job.grain);
+    r.next.store(hi, std::memory_order_relaxed);
+    return true;
+}
+
+/** Move the back half of the largest other range into participant p's range. */
+bool steal(Job& job, Int32 p) {
+    for (;;) {
+        Int32 victim = -1;
+        Int64 best = 0;
+        for (Int32 i = 0; i < job.degree; i++) {
+            if (i == p) continue;
+            Range& r = job.ranges[i];
+            Int64 remaining = r.end.load(std::memory_order_relaxed) - r.next.load(std::memory_order_relaxed);
+            if (remaining > best) {
+                best = remaining;
+                victim = i;
+            }
+        }
+        if (victim < 0) return false;
+
+        Int64 lo, hi;
+        {
+            Range& r = job.ranges[victim];
+            std::lock_guard<SpinLock> guard(r.lock);
+            const Int64 next = r.next.load(std::memory_order_relaxed);
+            hi = r.end.load(std::memory_order_relaxed);
+            if (hi <= next) continue;  // emptied meanwhile: look again
+            // A small remainder is taken whole rather than split into tiny chunks
+            lo = hi - next <= job.grain ? next : next + (hi - next) / 2;
+            r.end.store(lo, std::memory_order_relaxed);
+        }
+        Range& own = job.ranges[p];
+        std::lock_guard<SpinLock> guard(own.lock);
+        own.next.store(lo, std::memory_order_relaxed);
+        own.end.store(hi, std::memory_order_relaxed);
+        return true;
+    }
+}
+
+/** Run one chunk; returns the exception it threw, if any. */
+Exception* run_chunk(Job& job, Int64 lo, Int64 hi, Int32 p) {
+    Exception* volatile error = nullptr;  // assigned after the longjmp
+    CIL2CPP_TRY
+        job.body(job.ctx, lo, hi, p);
+    CIL2CPP_CATCH_ALL
+        error = cil2cpp::get_current_exception();
+    CIL2CPP_END_TRY
+    return error;
+}
+
+void participate(Job& job, Int32 p) {
+    Int64 lo, hi;
+    while (!job.stop.load(std::memory_order_relaxed)) {
+        if (!take_own(job, p, lo, hi)) {
+            if (!steal(job, p)) break;
+            continue;
+        }
+        if (ct_is_cancellation_requested(job.token)) {
+            job.canceled.store(true, std::memory_order_relaxed);
+            job.stop.store(true, std::memory_order_relaxed);
+            break;
+        }
+        if (Exception* error = run_chunk(job, lo, hi, p)) {
+            job.errors[p] = error;
+            job.stop.store(true, std::memory_order_relaxed);
+            break;
+        }
+    }
+}
+
+void helper_entry(void* raw) {
+    auto* job = static_cast<Job*>(raw);
+    Int32 p;
+    {
+        std::lock_guard<std::mutex> guard(job->mutex);
+        if (job->closed) {
+            p = -1;
+        } else {
+            p = job->next_participant++;
+            job->active++;
+        }
+    }
+    if (p >= 0) {
+        participate(*job, p);
+        std::lock_guard<std::mutex> guard(job->mutex);
+        if (--job->active == 0) job->idle.notify_all();
+    }
+    job->release();
+}
+
+} // namespace
+
+Int32 degree_for(Int64 count, const LoopOptions& options) {
+    Int64 workers = threadpool::is_initialized() ? threadpool::worker_count() : 0;
+    Int64 degree = workers > 0 ? workers : 1;
+    if (options.max_degree > 0) degree = std::min<Int64>(options.max_degree, workers + 1);
+    return static_cast<Int32>(std::max<Int64>(1, std::min(degree, count)));
+}
+
+void run(Int64 from, Int64 to, Int32 degree, const LoopOptions& options, RangeBody body, void* ctx) {
+    ct_throw_if_cancellation_requested(options.token);
+    if (to <= from) return;
+    const Int64 count = to - from;
+    if (degree > count) degree = static_cast<Int32>(count);
+    if (degree < 1) degree = 1;
+
+    Array* error_array = array_create(&Exception_TypeInfo, degree);
+    auto* errors = static_cast<Exception**>(array_data(error_array));
+    auto* job = new Job();
+    job->body = body;
+    job->ctx = ctx;
+    job->token = options.token;
+    job->degree = degree;
+    job->grain = std::clamp<Int64>(count / (degree * kChunksPerParticipant), 1, kMaxChunk);
+    job->ranges = std::make_unique<Range[]>(static_cast<size_t>(degree));
+    job->errors = errors;
+    // count * i would overflow for ranges wider than INT64_MAX / degree, so
+    // split as quotient plus one extra index for each of the first remainder
+    const Int64 share = count / degree, extra = count % degree;
+    auto bound = [&](Int32 i) { return from + share * i + std::min<Int64>(i, extra); };
+    for (Int32 i = 0; i < degree; i++) {
+        job->ranges[i].next.store(bound(i), std::memory_order_relaxed);
+        job->ranges[i].end.store(bound(i + 1), std::memory_order_relaxed);
+    }
+
+    if (degree > 1) {
+        job->refs.fetch_add(degree - 1, std::memory_order_relaxed);
+        for (Int32 i = 1; i < degree; i++) threadpool::queue_work(helper_entry, job);
+    }
+
+    participate(*job, 0);
+
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->closed = true;
+        job->idle.wait(lock, [job] { return job->active == 0; });
+    }
+    const bool canceled = job->canceled.load(std::memory_order_relaxed);
+    job->release();
+
+    Int32 failed = 0;
+    for (Int32 i = 0; i < degree; i++) {
+        if (errors[i]) errors[failed++] = errors[i];
+    }
+    if (failed > 0) throw_exception(aggregate_exception_create(errors, failed));
+    if (canceled) throw_operation_canceled();
+}
+
+} // namespace parallel
+} // namespace cil2cpp
@@ -14,10 +14,12 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <cstring>
+#include <new>
 
 namespace cil2cpp {
 
-static TypeInfo Task_TypeInfo_Internal = {
+TypeInfo Task_TypeInfo = {
     .name = "Task",
     .namespace_name = "System.Threading.Tasks",
     .full_name = "System.Threading.Tasks.Task",
@@ -38,51 +40,249 @@ static TypeInfo Task_TypeInfo_Internal = {
     .interface_vtable_count = 0,
 };
 
-static Task* s_completed_task = nullptr;
+// What f_lock points to on a pending task
+struct TaskLock {
+    std::mutex mutex;
+    bool run_continuations_async;   // TaskCreationOptions.RunContinuationsAsynchronously
+};
+
+static TaskLock* task_lock(Task* t) {
+    return static_cast<TaskLock*>(t->f_lock);
+}
 
-// Allocate a new Task with a fresh mutex
+// Allocate a new pending Task
 // Note: Task doesn't inherit from Object (to avoid MSVC tail-padding mismatch),
 // so we use reinterpret_cast instead of static_cast.
-static Task* task_alloc() {
-    auto* t = reinterpret_cast<Task*>(gc::alloc(sizeof(Task), &Task_TypeInfo_Internal));
-    t->f_status = 0;
-    t->f_exception = nullptr;
-    t->f_continuations = nullptr;
-    t->f_lock = new std::mutex();
+static Task* task_alloc(TaskCreationOptions options) {
+    auto* t = reinterpret_cast<Task*>(gc::alloc(sizeof(Task), &Task_TypeInfo));
+    task_init_pending(t, options);
     return t;
 }
 
-// Run all continuations and clear the list
-static void run_continuations(TaskContinuation* head) {
+// ===== Per-thread pools =====
+//
+// Continuation nodes and pooled state machine boxes are ordinary collectable
+// GC blocks, so a node or box whose task never completes is reclaimed like any
+// other garbage. Only the pool itself (the free list heads) lives in
+// uncollectable memory: the thread_local slot is not a GC root, but the
+// collector scans the pool and through it every pooled block. A block released
+// on another thread than the one that took it simply joins the releasing
+// thread's pool. Pooled blocks are cleared so they do not keep garbage alive;
+// at thread exit the pool is freed and its blocks become garbage.
+
+template <typename Pool>
+struct PoolSlot {
+    Pool* pool = nullptr;
+
+    Pool& get() {
+        if (!pool) pool = new (gc::alloc_uncollectable(sizeof(Pool))) Pool();
+        return *pool;
+    }
+
+    ~PoolSlot() {
+        if (pool) gc::free_uncollectable(pool);
+    }
+};
+
+static constexpr Int32 kMaxPooledContinuations = 256;
+
+struct ContinuationPool {
+    TaskContinuation* free = nullptr;
+    Int32 count = 0;
+};
+
+static thread_local PoolSlot<ContinuationPool> t_continuation_pool;
+
+static TaskContinuation* continuation_acquire() {
+    auto& pool = t_continuation_pool.get();
+    if (auto* node = pool.free) {
+        pool.free = node->next;
+        pool.count--;
+        return node;
+    }
+    return static_cast<TaskContinuation*>(gc::alloc(sizeof(TaskContinuation), nullptr));
+}
+
+static void continuation_release(TaskContinuation* node) {
+    auto& pool = t_continuation_pool.get();
+    if (pool.count >= kMaxPooledContinuations) return;  // left to the collector
+    node->callback = nullptr;
+    node->state = nullptr;
+    node->next = pool.free;
+    pool.free = node;
+    pool.count++;
+}
+
+// Boxes are pooled by size class (16-byte steps up to 1 KB); larger ones are
+// left to the collector on release.
+static constexpr size_t kBoxGranule = 16;
+static constexpr size_t kBoxClasses = 64;
+static constexpr Int32 kMaxPooledBoxesPerClass = 64;
+
+struct alignas(16) AsyncBoxHeader {
+    AsyncBoxHeader* next;           // free list link while pooled
+    std::atomic<Int32> refs;
+    UInt32 size_class;              // 1..kBoxClasses, 0 = not pooled
+};
+static_assert(sizeof(AsyncBoxHeader) == 16, "box payload must stay 16-byte aligned");
+
+struct AsyncBoxPool {
+    AsyncBoxHeader* free[kBoxClasses] = {};
+    Int32 count[kBoxClasses] = {};
+};
+
+static thread_local PoolSlot<AsyncBoxPool> t_box_pool;
+
+void* async_box_acquire(size_t size, TypeInfo* type) {
+    size_t size_class = (size + kBoxGranule - 1) / kBoxGranule;
+    AsyncBoxHeader* header = nullptr;
+    if (size_class <= kBoxClasses) {
+        auto& pool = t_box_pool.get();
+        header = pool.free[size_class - 1];
+        if (header) {
+            pool.free[size_class - 1] = header->next;
+            pool.count[size_class - 1]--;
+        }
+    }
+    if (!header) {
+        // gc::alloc writes an object header at the start of the block; the box
+        // header overwrites it, and the state machine's header follows.
+        header = static_cast<AsyncBoxHeader*>(
+            gc::alloc(sizeof(AsyncBoxHeader) + size_class * kBoxGranule, nullptr));
+        header->size_class = size_class <= kBoxClasses ? static_cast<UInt32>(size_class) : 0;
+    }
+    header->next = nullptr;
+    header->refs.store(2, std::memory_order_relaxed);
+
+    auto* obj = reinterpret_cast<Object*>(header + 1);
+    obj->__type_info = type;
+    obj->__sync_block = 0;
+    return obj;
+}
+
+void async_box_release(void* box) {
+    if (!box) return;
+    auto* header = static_cast<AsyncBoxHeader*>(box) - 1;
+    if (header->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    auto size_class = header->size_class;
+    if (size_class == 0) return;  // left to the collector
+    auto& pool = t_box_pool.get();
+    if (pool.count[size_class - 1] >= kMaxPooledBoxesPerClass) return;
+    std::memset(box, 0, size_class * kBoxGranule);
+    header->next = pool.free[size_class - 1];
+    pool.free[size_class - 1] = header;
+    pool.count[size_class - 1]++;
+}
+
+// ===== Continuation scheduling =====
+//
+// An inline continuation runs on the completing thread's stack, and typically
+// completes another task whose continuations run inline in turn. t_inline_depth
+// counts that nesting; past the limit the next continuation is posted to the
+// thread pool, where it starts from an empty stack.
+
+static std::atomic<Int32> s_inline_depth_limit{64};
+static thread_local Int32 t_inline_depth = 0;
+
+Int32 task_get_inline_depth_limit() {
+    return s_inline_depth_limit.load(std::memory_order_relaxed);
+}
+
+void task_set_inline_depth_limit(Int32 depth) {
+    s_inline_depth_limit.store(depth < 0 ? 0 : depth, std::memory_order_relaxed);
+}
+
+static bool must_post(ContinuationFlags flags, bool task_async) {
+    if (!threadpool::is_initialized()) return false;  // nowhere to post: run inline
+    return task_async
+        || (static_cast<UInt32>(flags) & static_cast<UInt32>(ContinuationFlags::RunAsynchronously))
+        || t_inline_depth >= s_inline_depth_limit.load(std::memory_order_relaxed);
+}
+
+static void run_inline(void (*callback)(void*), void* state) {
+    // A callback that throws longjmps out of this frame; the finally block
+    // keeps the depth balanced before the exception travels on
+    t_inline_depth++;
+    CIL2CPP_TRY
+        callback(state);
+    CIL2CPP_FINALLY
+        t_inline_depth--;
+    CIL2CPP_END_TRY
+}
+
+// Thread pool work item: the node was handed over by schedule_continuation
+static void run_posted_continuation(void* raw) {
+    auto* node = static_cast<TaskContinuation*>(raw);
+    auto callback = node->callback;
+    auto* state = node->state;
+    continuation_release(node);
+    run_inline(callback, state);
+}
+
+// Run or post one continuation. The node goes back to the pool before an
+// inline callback runs, so a callback that awaits again can reuse it.
+static void schedule_continuation(TaskContinuation* node, bool task_async) {
+    if (must_post(node->flags, task_async)) {
+        node->next = nullptr;
+        threadpool::queue_work(run_posted_continuation, node);
+        return;
+    }
+    auto callback = node->callback;
+    auto* state = node->state;
+    continuation_release(node);
+    run_inline(callback, state);
+}
+
+static void run_continuations(TaskContinuation* head, bool task_async) {
     while (head) {
-        head->callback(head->state);
-        head = head->next;
+        auto* next = head->next;
+        schedule_continuation(head, task_async);
+        head = next;
+    }
+}
+
+// Complete (status 1) or fault (status 2) a pending task and schedule its
+// continuations; `post` sends them all to the thread pool.
+static void task_finish(Task* t, Int32 status, Exception* ex, bool post) {
+    if (!t || !t->f_lock) return;  // lock-less tasks are created completed
+    TaskContinuation* conts = nullptr;
+    bool task_async;
+    {
+        auto* lock = task_lock(t);
+        std::lock_guard<std::mutex> guard(lock->mutex);
+        if (t->f_status >= 1) return;
+        t->f_status = status;
+        if (status == 2) t->f_exception = ex;
+        conts = t->f_continuations;
+        t->f_continuations = nullptr;
+        task_async = post || lock->run_continuations_async;
     }
+    run_continuations(conts, task_async);
 }
 
 Task* task_create_completed() {
-    auto* t = task_alloc();
-    t->f_status = 1;
+    auto* t = reinterpret_cast<Task*>(gc::alloc(sizeof(Task), &Task_TypeInfo));
+    task_init_completed(t);
     return t;
 }
 
 Task* task_get_completed() {
-    if (!s_completed_task) {
-        s_completed_task = task_create_completed();
-    }
-    return s_completed_task;
+    // Shared and immutable, so it needs no lock
+    static Task* const completed = task_create_completed();
+    return completed;
 }
 
-Task* task_create_pending() {
-    return task_alloc();
+Task* task_create_pending(TaskCreationOptions options) {
+    return task_alloc(options);
 }
 
-void task_init_pending(Task* t) {
+void task_init_pending(Task* t, TaskCreationOptions options) {
     if (!t) return;
     t->f_status = 0;
     t->f_exception = nullptr;
     t->f_continuations = nullptr;
-    t->f_lock = new std::mutex();
+    t->f_lock = new TaskLock{{}, options == TaskCreationOptions::RunContinuationsAsynchronously};
 }
 
 void task_init_completed(Task* t) {
@@ -94,52 +294,31 @@ void task_init_completed(Task* t) {
 }
 
 void task_complete(Task* t) {
-    if (!t) return;
-    TaskContinuation* conts = nullptr;
-    {
-        auto* mtx = static_cast<std::mutex*>(t->f_lock);
-        std::lock_guard<std::mutex> lock(*mtx);
-        if (t->f_status >= 1) return;
-        t->f_status = 1;
-        conts = t->f_continuations;
-        t->f_continuations = nullptr;
-    }
-    run_continuations(conts);
+    task_finish(t, 1, nullptr, false);
 }
 
 void task_fault(Task* t, Exception* ex) {
-    if (!t) return;
-    TaskContinuation* conts = nullptr;
-    {
-        auto* mtx = static_cast<std::mutex*>(t->f_lock);
-        std::lock_guard<std::mutex> lock(*mtx);
-        if (t->f_status >= 1) return;
-        t->f_status = 2;
-        t->f_exception = ex;
-        conts = t->f_continuations;
-        t->f_continuations = nullptr;
-    }
-    run_continuations(conts);
+    task_finish(t, 2, ex, false);
 }
 
-void task_add_continuation(Task* t, void (*callback)(void*), void* state) {
+void task_add_continuation(Task* t, void (*callback)(void*), void* state, ContinuationFlags flags) {
     if (!t) return;
-    {
-        auto* mtx = static_cast<std::mutex*>(t->f_lock);
-        std::lock_guard<std::mutex> lock(*mtx);
+    auto* cont = continuation_acquire();
+    cont->callback = callback;
+    cont->state = state;
+    cont->flags = flags;
+    if (t->f_lock) {
+        auto* lock = task_lock(t);
+        std::lock_guard<std::mutex> guard(lock->mutex);
         if (t->f_status < 1) {
             // Task not yet complete — queue the continuation
-            auto* cont = static_cast<TaskContinuation*>(
-                gc::alloc(sizeof(TaskContinuation), nullptr));
-            cont->callback = callback;
-            cont->state = state;
             cont->next = t->f_continuations;
             t->f_continuations = cont;
             return;
         }
     }
-    // Task already complete — run immediately
-    callback(state);
+    // Task already complete — schedule immediately
+    schedule_continuation(cont, false);
 }
 
 void task_wait(Task* t) {
@@ -230,7 +409,8 @@ struct DelayState {
 static void delay_thread_func(void* raw) {
     auto* state = static_cast<DelayState*>(raw);
     std::this_thread::sleep_for(std::chrono::milliseconds(state->milliseconds));
-    task_complete(state->task);
+    // The timer's thread does not run user code: continuations go to the pool
+    task_finish(state->task, 1, nullptr, true);
     delete state;
 }
 
@@ -83,6 +83,10 @@ bool is_initialized() {
     return s_initialized;
 }
 
+Int32 worker_count() {
+    return static_cast<Int32>(s_workers.size());
+}
+
 void queue_work(void (*func)(void*), void* state) {
     {
         std::lock_guard<std::mutex> lock(s_mutex);
@@ -53,14 +53,11 @@ Array* array_get_subarray(Array* source, Int32 start, Int32 length) {
     return result;
 }
 
-void array_bounds_check(Array* arr, Int32 index) {
+void array_bounds_fail(Array* arr) {
     if (!arr) {
         throw_null_reference();
     }
-
-    if (index < 0 || index >= arr->length) {
-        throw_index_out_of_range();
-    }
+    throw_index_out_of_range();
 }
 
 // ===== ICall functions for System.Array (work with both 1D and multi-dim) =====
@@ -1,177 +1,302 @@
 /**
  * CIL2CPP Runtime - System.Console Implementation
+ *
+ * All Console.Write/WriteLine overloads funnel into a single process-wide
+ * writer: a lock-protected 64 KB byte buffer that UTF-16 strings are encoded
+ * into directly and numbers are formatted into with std::to_chars. One lock
+ * acquisition covers a whole call (value + newline), so concurrent WriteLine
+ * calls never interleave. The buffer is handed to stdout according to the
+ * active ConsoleFlushPolicy, on Console_Flush(), before reading stdin, and at
+ * runtime_shutdown().
  */
 
 #include <cil2cpp/bcl/System.Console.h>
 #include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/format.h>
+#include <cil2cpp/utf.h>
 
+#include <atomic>
+#include <charconv>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <mutex>
 #include <string>
 #include <iostream>
 
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <io.h>
+#define CIL2CPP_ISATTY(fd) _isatty(fd)
+#define CIL2CPP_FILENO(f) _fileno(f)
+#else
+#include <unistd.h>
+#define CIL2CPP_ISATTY(fd) isatty(fd)
+#define CIL2CPP_FILENO(f) fileno(f)
 #endif
 
 namespace cil2cpp {
 namespace System {
 
-// Initialize console for UTF-8 output on Windows
-static bool g_console_initialized = false;
+static constexpr size_t CONSOLE_BUFFER_SIZE = 64 * 1024;
 
-static void init_console() {
-    if (g_console_initialized) return;
+struct ConsoleWriter {
+    std::mutex lock;
+    size_t used = 0;
+    char buffer[CONSOLE_BUFFER_SIZE];
+};
+
+static ConsoleWriter g_console;
+static std::once_flag g_console_init;
+static std::atomic<ConsoleFlushPolicy> g_flush_policy{ConsoleFlushPolicy::Block};
 
+// Initialize console for UTF-8 output and pick the default flush policy:
+// line-flushed for an interactive terminal, block-buffered otherwise.
+static void init_console() {
+    std::call_once(g_console_init, [] {
 #ifdef _WIN32
-    // Set console code page to UTF-8
-    SetConsoleOutputCP(CP_UTF8);
+        // Set console code page to UTF-8
+        SetConsoleOutputCP(CP_UTF8);
 #endif
+        g_flush_policy.store(CIL2CPP_ISATTY(CIL2CPP_FILENO(stdout))
+                                 ? ConsoleFlushPolicy::Line
+                                 : ConsoleFlushPolicy::Block,
+                             std::memory_order_relaxed);
+    });
+}
+
+// ---------- Buffer primitives (caller holds g_console.lock) ----------
 
-    g_console_initialized = true;
+static void flush_locked() {
+    if (g_console.used > 0) {
+        std::fwrite(g_console.buffer, 1, g_console.used, stdout);
+        g_console.used = 0;
+    }
+    std::fflush(stdout);
 }
 
-static void print_string(String* str, FILE* stream = stdout) {
-    if (!str) {
-        return;
+static inline void reserve_locked(size_t bytes) {
+    if (g_console.used + bytes > CONSOLE_BUFFER_SIZE) {
+        flush_locked();
     }
+}
 
-    char* utf8 = string_to_utf8(str);
-    if (utf8) {
-        fputs(utf8, stream);
-        std::free(utf8);
+static void append_bytes_locked(const char* data, size_t len) {
+    while (len > 0) {
+        if (g_console.used == CONSOLE_BUFFER_SIZE) flush_locked();
+        size_t chunk = CONSOLE_BUFFER_SIZE - g_console.used;
+        if (chunk > len) chunk = len;
+        std::memcpy(g_console.buffer + g_console.used, data, chunk);
+        g_console.used += chunk;
+        data += chunk;
+        len -= chunk;
     }
 }
 
-void Console_WriteLine() {
+// Encode UTF-16 straight into the output buffer (no intermediate allocation),
+// a buffer-sized chunk at a time. Unpaired surrogates are written as U+FFFD.
+static void append_utf16_locked(const Char* chars, Int32 length) {
+    size_t i = 0;
+    size_t n = static_cast<size_t>(length);
+    while (i < n) {
+        size_t room = (CONSOLE_BUFFER_SIZE - g_console.used) / utf::MAX_UTF8_BYTES_PER_UNIT;
+        if (room < 2) {
+            flush_locked();
+            continue;
+        }
+        size_t take = utf::utf16_chunk(chars + i, n - i, room);
+        g_console.used += utf::utf16_to_utf8(chars + i, take, g_console.buffer + g_console.used);
+        i += take;
+    }
+}
+
+// Integers: std::to_chars writes digits directly, no format-string parsing.
+template<typename T>
+static void append_integer_locked(T value) {
+    reserve_locked(24);
+    char* out = g_console.buffer + g_console.used;
+    auto res = std::to_chars(out, out + 24, value);
+    g_console.used += static_cast<size_t>(res.ptr - out);
+}
+
+// Floating point: same shortest round-trip rendering as Double.ToString().
+static void append_double_locked(Double value) {
+    reserve_locked(format::MAX_NUMBER_CHARS);
+    g_console.used += static_cast<size_t>(format::format_double(g_console.buffer + g_console.used, value));
+}
+
+static void append_single_locked(Single value) {
+    reserve_locked(format::MAX_NUMBER_CHARS);
+    g_console.used += static_cast<size_t>(format::format_single(g_console.buffer + g_console.used, value));
+}
+
+static void append_bool_locked(Boolean value) {
+    if (value) append_bytes_locked("True", 4);
+    else append_bytes_locked("False", 5);
+}
+
+// Apply the flush policy at the end of a Write/WriteLine call.
+static inline void end_write_locked(bool wrote_newline) {
+    switch (g_flush_policy.load(std::memory_order_relaxed)) {
+    case ConsoleFlushPolicy::Always:
+        flush_locked();
+        break;
+    case ConsoleFlushPolicy::Line:
+        if (wrote_newline) flush_locked();
+        break;
+    case ConsoleFlushPolicy::Block:
+        break;
+    }
+}
+
+static inline void append_newline_locked() {
+    reserve_locked(1);
+    g_console.buffer[g_console.used++] = '\n';
+}
+
+// Write a value under one lock acquisition, optionally followed by '\n'.
+template<typename F>
+static inline void console_write(bool newline, F&& append) {
     init_console();
-    putchar('\n');
+    std::lock_guard<std::mutex> guard(g_console.lock);
+    append();
+    if (newline) append_newline_locked();
+    end_write_locked(newline);
 }
 
-void Console_WriteLine(String* value) {
+static inline void append_string_locked(String* str) {
+    if (str) append_utf16_locked(str->chars, str->length);
+}
+
+// ---------- Flush control ----------
+
+void Console_Flush() {
+    std::lock_guard<std::mutex> guard(g_console.lock);
+    flush_locked();
+}
+
+void Console_SetFlushPolicy(ConsoleFlushPolicy policy) {
+    init_console();  // ensure lazy init does not overwrite an explicit choice
+    g_flush_policy.store(policy, std::memory_order_relaxed);
+}
+
+ConsoleFlushPolicy Console_GetFlushPolicy() {
     init_console();
-    print_string(value);
-    putchar('\n');
+    return g_flush_policy.load(std::memory_order_relaxed);
+}
+
+// ---------- Console.WriteLine ----------
+
+void Console_WriteLine() {
+    console_write(true, [] {});
+}
+
+void Console_WriteLine(String* value) {
+    console_write(true, [&] { append_string_locked(value); });
 }
 
 void Console_WriteLine(Int32 value) {
-    init_console();
-    printf("%d\n", value);
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(UInt32 value) {
-    init_console();
-    printf("%u\n", value);
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(Int64 value) {
-    init_console();
-    printf("%lld\n", static_cast<long long>(value));
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(UInt64 value) {
-    init_console();
-    printf("%llu\n", static_cast<unsigned long long>(value));
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(UInt16 value) {
-    init_console();
-    printf("%u\n", static_cast<unsigned>(value));
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(Int16 value) {
-    init_console();
-    printf("%d\n", static_cast<int>(value));
+    console_write(true, [&] { append_integer_locked(value); });
 }
 
 void Console_WriteLine(Single value) {
-    init_console();
-    printf("%g\n", static_cast<double>(value));
+    console_write(true, [&] { append_single_locked(value); });
 }
 
 void Console_WriteLine(Double value) {
-    init_console();
-    printf("%g\n", value);
+    console_write(true, [&] { append_double_locked(value); });
 }
 
 void Console_WriteLine(Boolean value) {
-    init_console();
-    printf("%s\n", value ? "True" : "False");
+    console_write(true, [&] { append_bool_locked(value); });
 }
 
 void Console_WriteLine(Object* value) {
-    init_console();
-    if (!value) {
-        putchar('\n');
-        return;
-    }
-    String* str = object_to_string(value);
-    print_string(str);
-    putchar('\n');
+    // ToString may run managed code (which may itself write to the console),
+    // so it must be evaluated before taking the writer lock.
+    String* str = value ? object_to_string(value) : nullptr;
+    console_write(true, [&] { append_string_locked(str); });
 }
 
+// ---------- Console.Write ----------
+
 void Console_Write(String* value) {
-    init_console();
-    print_string(value);
+    console_write(false, [&] { append_string_locked(value); });
 }
 
 void Console_Write(Int32 value) {
-    init_console();
-    printf("%d", value);
+    console_write(false, [&] { append_integer_locked(value); });
 }
 
 void Console_Write(UInt32 value) {
-    init_console();
-    printf("%u", value);
+    console_write(false, [&] { append_integer_locked(value); });
 }
 
 void Console_Write(Int64 value) {
-    init_console();
-    printf("%lld", static_cast<long long>(value));
+    console_write(false, [&] { append_integer_locked(value); });
 }
 
 void Console_Write(UInt64 value) {
-    init_console();
-    printf("%llu", static_cast<unsigned long long>(value));
+    console_write(false, [&] { append_integer_locked(value); });
 }
 
 void Console_Write(Single value) {
-    init_console();
-    printf("%g", static_cast<double>(value));
+    console_write(false, [&] { append_single_locked(value); });
 }
 
 void Console_Write(Double value) {
-    init_console();
-    printf("%g", value);
+    console_write(false, [&] { append_double_locked(value); });
 }
 
 void Console_Write(Boolean value) {
-    init_console();
-    printf("%s", value ? "True" : "False");
+    console_write(false, [&] { append_bool_locked(value); });
 }
 
 void Console_Write(Object* value) {
-    init_console();
     if (!value) {
         return;
     }
     String* str = object_to_string(value);
-    print_string(str);
+    console_write(false, [&] { append_string_locked(str); });
 }
 
+// ---------- Console input ----------
+
 String* Console_ReadLine() {
     init_console();
+    Console_Flush();  // make pending prompts visible before blocking on input
 
     std::string line;
     if (std::getline(std::cin, line)) {
-        return string_create_utf8(line.c_str());
+        return string_create_utf8(line.data(), static_cast<Int32>(line.size()));
     }
     return nullptr;
 }
 
 Int32 Console_Read() {
     init_console();
+    Console_Flush();
     return getchar();
 }
 
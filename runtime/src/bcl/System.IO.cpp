@@ -6,6 +6,7 @@
 #include <cil2cpp/bcl/System.IO.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/exception.h>
+#include <cil2cpp/utf.h>
 
 #include <cstdio>
 #include <cstring>
@@ -37,6 +38,20 @@ static char* to_utf8(String* str) {
     return string_to_utf8(str);
 }
 
+// Encode a string to UTF-8 straight into the file through a stack buffer.
+static void write_utf8(FILE* f, String* str) {
+    char buf[8192];
+    constexpr size_t max_units = sizeof(buf) / utf::MAX_UTF8_BYTES_PER_UNIT;
+    size_t n = static_cast<size_t>(str->length);
+    size_t i = 0;
+    while (i < n) {
+        size_t take = utf::utf16_chunk(str->chars + i, n - i, max_units);
+        size_t bytes = utf::utf16_to_utf8(str->chars + i, take, buf);
+        fwrite(buf, 1, bytes, f);
+        i += take;
+    }
+}
+
 // ── System.IO.File ──────────────────────────────────────
 
 String* File_ReadAllText(String* path) {
@@ -65,14 +80,16 @@ String* File_ReadAllText(String* path) {
 
     // Skip UTF-8 BOM if present
     char* content = buf;
+    size_t contentLength = bytesRead;
     if (bytesRead >= 3 &&
         static_cast<unsigned char>(buf[0]) == 0xEF &&
         static_cast<unsigned char>(buf[1]) == 0xBB &&
         static_cast<unsigned char>(buf[2]) == 0xBF) {
         content = buf + 3;
+        contentLength -= 3;
     }
 
-    String* result = string_create_utf8(content);
+    String* result = string_create_utf8(content, static_cast<Int32>(contentLength));
     std::free(buf);
     return result;
 }
@@ -92,11 +109,7 @@ void File_WriteAllText(String* path, String* contents) {
     }
 
     if (contents && contents->length > 0) {
-        char* utf8Content = string_to_utf8(contents);
-        if (utf8Content) {
-            fwrite(utf8Content, 1, std::strlen(utf8Content), f);
-            std::free(utf8Content);
-        }
+        write_utf8(f, contents);
     }
 
     fclose(f);
@@ -159,11 +172,7 @@ void File_WriteAllLines(String* path, Array* lines) {
         auto** items = reinterpret_cast<String**>(array_data(lines));
         for (Int32 i = 0; i < lines->length; i++) {
             if (items[i]) {
-                char* line = string_to_utf8(items[i]);
-                if (line) {
-                    fwrite(line, 1, std::strlen(line), f);
-                    std::free(line);
-                }
+                write_utf8(f, items[i]);
             }
             // Write platform line ending
 #ifdef _WIN32
@@ -193,11 +202,7 @@ void File_AppendAllText(String* path, String* contents) {
     }
 
     if (contents && contents->length > 0) {
-        char* utf8Content = string_to_utf8(contents);
-        if (utf8Content) {
-            fwrite(utf8Content, 1, std::strlen(utf8Content), f);
-            std::free(utf8Content);
-        }
+        write_utf8(f, contents);
     }
 
     fclose(f);
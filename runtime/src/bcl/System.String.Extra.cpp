@@ -5,13 +5,15 @@
 
 #include <cil2cpp/bcl/System.String.h>
 #include <cil2cpp/array.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/format.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/type_info.h>
+#include <cil2cpp/string_search.h>
 
 #include <cstring>
 #include <cctype>
 #include <cstdio>
-#include <vector>
 
 namespace cil2cpp {
 
@@ -39,31 +41,19 @@ Int32 string_index_of(String* str, Char value) {
 }
 
 Int32 string_index_of(String* str, Char value, Int32 startIndex) {
-    if (!str) return -1;
-    for (Int32 i = startIndex; i < str->length; i++) {
-        if (str->chars[i] == value) return i;
-    }
-    return -1;
+    if (!str || startIndex < 0 || startIndex >= str->length) return -1;
+    Int32 r = search::index_of_char(str->chars + startIndex, str->length - startIndex, value);
+    return r < 0 ? -1 : startIndex + r;
 }
 
 Int32 string_index_of_string(String* str, String* value) {
     if (!str || !value) return -1;
-    if (value->length == 0) return 0;
-    if (value->length > str->length) return -1;
-
-    for (Int32 i = 0; i <= str->length - value->length; i++) {
-        if (std::memcmp(str->chars + i, value->chars, value->length * sizeof(Char)) == 0)
-            return i;
-    }
-    return -1;
+    return search::index_of(str->chars, str->length, value->chars, value->length);
 }
 
 Int32 string_last_index_of(String* str, Char value) {
     if (!str) return -1;
-    for (Int32 i = str->length - 1; i >= 0; i--) {
-        if (str->chars[i] == value) return i;
-    }
-    return -1;
+    return search::last_index_of_char(str->chars, str->length, value);
 }
 
 Boolean string_contains(String* str, Char value) {
@@ -92,10 +82,9 @@ Int32 string_compare_ordinal(String* a, String* b) {
     if (!a) return -1;
     if (!b) return 1;
     Int32 minLen = a->length < b->length ? a->length : b->length;
-    for (Int32 i = 0; i < minLen; i++) {
-        if (a->chars[i] != b->chars[i])
-            return a->chars[i] < b->chars[i] ? -1 : 1;
-    }
+    Int32 i = search::mismatch(a->chars, b->chars, minLen);
+    if (i < minLen)
+        return a->chars[i] < b->chars[i] ? -1 : 1;
     if (a->length == b->length) return 0;
     return a->length < b->length ? -1 : 1;
 }
@@ -164,32 +153,37 @@ String* string_replace_string(String* str, String* oldValue, String* newValue) {
     if (!str || !oldValue || oldValue->length == 0) return str;
     if (!newValue) newValue = string_create_utf8("");
 
-    // Count occurrences
-    std::vector<Int32> positions;
-    for (Int32 i = 0; i <= str->length - oldValue->length; i++) {
-        if (std::memcmp(str->chars + i, oldValue->chars, oldValue->length * sizeof(Char)) == 0) {
-            positions.push_back(i);
-            i += oldValue->length - 1;
-        }
+    // Pass 1: count non-overlapping occurrences (no position buffer needed)
+    const Char* src = str->chars;
+    const Int32 srcLen = str->length;
+    const Int32 oldLen = oldValue->length;
+    Int32 count = 0;
+    for (Int32 pos = 0;;) {
+        Int32 r = search::index_of(src + pos, srcLen - pos, oldValue->chars, oldLen);
+        if (r < 0) break;
+        count++;
+        pos += r + oldLen;
     }
-    if (positions.empty()) return str;
+    if (count == 0) return str;
 
-    Int32 newLen = str->length + static_cast<Int32>(positions.size()) * (newValue->length - oldValue->length);
+    // Pass 2: copy the gaps and the replacements
+    Int32 newLen = srcLen + count * (newValue->length - oldLen);
     String* result = string_fast_allocate(newLen);
     Int32 srcIdx = 0, dstIdx = 0;
-    for (Int32 pos : positions) {
+    for (Int32 n = 0; n < count; n++) {
+        Int32 pos = srcIdx + search::index_of(src + srcIdx, srcLen - srcIdx, oldValue->chars, oldLen);
         Int32 copyLen = pos - srcIdx;
         if (copyLen > 0) {
-            std::memcpy(result->chars + dstIdx, str->chars + srcIdx, copyLen * sizeof(Char));
+            std::memcpy(result->chars + dstIdx, src + srcIdx, copyLen * sizeof(Char));
             dstIdx += copyLen;
         }
         std::memcpy(result->chars + dstIdx, newValue->chars, newValue->length * sizeof(Char));
         dstIdx += newValue->length;
-        srcIdx = pos + oldValue->length;
+        srcIdx = pos + oldLen;
     }
-    Int32 remaining = str->length - srcIdx;
+    Int32 remaining = srcLen - srcIdx;
     if (remaining > 0) {
-        std::memcpy(result->chars + dstIdx, str->chars + srcIdx, remaining * sizeof(Char));
+        std::memcpy(result->chars + dstIdx, src + srcIdx, remaining * sizeof(Char));
     }
     return result;
 }
@@ -249,68 +243,42 @@ static String* obj_to_string(Object* obj) {
     return object_to_string(obj);
 }
 
+String* string_concat_obj(Object* a) {
+    return obj_to_string(a);
+}
+
 String* string_concat_obj(Object* a, Object* b) {
     return string_concat(obj_to_string(a), obj_to_string(b));
 }
 
 String* string_concat_obj3(Object* a, Object* b, Object* c) {
-    return string_concat(string_concat(obj_to_string(a), obj_to_string(b)), obj_to_string(c));
+    return string_concat(obj_to_string(a), obj_to_string(b), obj_to_string(c));
 }
 
-// ── Format ────────────────────────────────────────────────
-
-String* string_format(String* format, Array* args) {
-    if (!format) return nullptr;
-
-    // Convert each arg to string
-    Int32 argCount = args ? args->length : 0;
-    std::vector<String*> argStrings(argCount);
-    for (Int32 i = 0; i < argCount; i++) {
-        Object* obj = static_cast<Object**>(array_data(args))[i];
-        argStrings[i] = obj_to_string(obj);
+String* string_concat_obj_array(Array* values) {
+    if (!values) throw_argument_null();
+    Int32 count = values->length;
+    auto** objs = static_cast<Object**>(array_data(values));
+
+    // String.Concat(object[]) is what the C# compiler emits for long '+'
+    // chains over mixed types. Converted parts must stay visible to the GC:
+    // short lists live on the stack, longer ones in a managed string[].
+    constexpr Int32 STACK_PARTS = 16;
+    String* stack_parts[STACK_PARTS];
+    String** parts = stack_parts;
+    if (count > STACK_PARTS) {
+        parts = static_cast<String**>(array_data(array_create(&System::String_TypeInfo, count)));
     }
+    for (Int32 i = 0; i < count; i++) parts[i] = obj_to_string(objs[i]);
+    return string_concat(parts, count);
+}
 
-    // Parse format string and build result
-    std::vector<Char> result;
-    result.reserve(format->length * 2);
-
-    for (Int32 i = 0; i < format->length; i++) {
-        Char c = format->chars[i];
-
-        // Escaped braces {{ and }}
-        if (c == '{' && i + 1 < format->length && format->chars[i + 1] == '{') {
-            result.push_back('{');
-            i++;
-            continue;
-        }
-        if (c == '}' && i + 1 < format->length && format->chars[i + 1] == '}') {
-            result.push_back('}');
-            i++;
-            continue;
-        }
-
-        if (c == '{') {
-            // Parse {index} or {index:format} or {index,alignment}
-            i++;
-            Int32 index = 0;
-            while (i < format->length && format->chars[i] >= '0' && format->chars[i] <= '9') {
-                index = index * 10 + (format->chars[i] - '0');
-                i++;
-            }
-            // Skip format specifier and alignment (consume until '}')
-            while (i < format->length && format->chars[i] != '}') i++;
-
-            if (index >= 0 && index < argCount && argStrings[index]) {
-                String* s = argStrings[index];
-                for (Int32 j = 0; j < s->length; j++)
-                    result.push_back(s->chars[j]);
-            }
-        } else {
-            result.push_back(c);
-        }
-    }
+// ── Format ────────────────────────────────────────────────
 
-    return string_create_utf16(result.data(), static_cast<Int32>(result.size()));
+String* string_format(String* format, Array* args) {
+    format::Writer out;
+    format::composite(out, format, args);
+    return out.to_string();
 }
 
 // ── Join ──────────────────────────────────────────────────
@@ -350,22 +318,18 @@ Array* string_split(String* str, Char separator) {
         return array_create(&System::String_TypeInfo, 0);
     }
 
-    // Count segments
-    Int32 count = 1;
-    for (Int32 i = 0; i < str->length; i++) {
-        if (str->chars[i] == separator) count++;
-    }
+    Int32 count = 1 + search::count_char(str->chars, str->length, separator);
 
     Array* result = array_create(&System::String_TypeInfo, count);
     String** data = static_cast<String**>(array_data(result));
 
-    Int32 start = 0, idx = 0;
-    for (Int32 i = 0; i <= str->length; i++) {
-        if (i == str->length || str->chars[i] == separator) {
-            data[idx++] = string_create_utf16(str->chars + start, i - start);
-            start = i + 1;
-        }
+    Int32 start = 0;
+    for (Int32 idx = 0; idx < count - 1; idx++) {
+        Int32 end = start + search::index_of_char(str->chars + start, str->length - start, separator);
+        data[idx] = string_create_utf16(str->chars + start, end - start);
+        start = end + 1;
     }
+    data[count - 1] = string_create_utf16(str->chars + start, str->length - start);
     return result;
 }
 
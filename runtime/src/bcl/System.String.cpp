@@ -4,12 +4,18 @@
 
 #include <cil2cpp/bcl/System.String.h>
 #include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/array.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/format.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/type_info.h>
+#include <cil2cpp/utf.h>
 
+#include <climits>
 #include <unordered_map>
 #include <string>
 #include <cstring>
+#include <cstdlib>
 
 namespace cil2cpp {
 
@@ -26,7 +32,7 @@ TypeInfo String_TypeInfo = {
     .interfaces = nullptr,
     .interface_count = 0,
     .instance_size = sizeof(String),
-    .element_size = sizeof(Char),
+    .element_size = sizeof(String*),  // as an array element type (string[]): references
     .flags = TypeFlags::Sealed,
     .vtable = nullptr,
     .fields = nullptr,
@@ -41,77 +47,36 @@ TypeInfo String_TypeInfo = {
 
 } // namespace System
 
-// ---------- UTF-8 ↔ UTF-16 conversion (RFC 3629 / Unicode 15.0) ----------
-
-// Convert UTF-8 to UTF-16 length
-static Int32 utf8_to_utf16_length(const char* utf8) {
-    Int32 len = 0;
-    while (*utf8) {
-        unsigned char c = static_cast<unsigned char>(*utf8);
-        if (c < 0x80) {
-            utf8 += 1;
-        } else if ((c & 0xE0) == 0xC0) {
-            utf8 += 2;
-        } else if ((c & 0xF0) == 0xE0) {
-            utf8 += 3;
-        } else if ((c & 0xF8) == 0xF0) {
-            utf8 += 4;
-            len++;  // Surrogate pair
-        } else {
-            utf8 += 1;  // Invalid, skip
-        }
-        len++;
-    }
-    return len;
-}
+// ---------- UTF-8 ↔ UTF-16 conversion (see utf.h) ----------
 
-// Convert UTF-8 to UTF-16
-static void utf8_to_utf16(const char* utf8, Char* utf16) {
-    while (*utf8) {
-        unsigned char c = static_cast<unsigned char>(*utf8);
-
-        if (c < 0x80) {
-            *utf16++ = static_cast<Char>(c);
-            utf8 += 1;
-        } else if ((c & 0xE0) == 0xC0) {
-            UInt32 codepoint = (c & 0x1F) << 6;
-            codepoint |= (utf8[1] & 0x3F);
-            *utf16++ = static_cast<Char>(codepoint);
-            utf8 += 2;
-        } else if ((c & 0xF0) == 0xE0) {
-            UInt32 codepoint = (c & 0x0F) << 12;
-            codepoint |= (utf8[1] & 0x3F) << 6;
-            codepoint |= (utf8[2] & 0x3F);
-            *utf16++ = static_cast<Char>(codepoint);
-            utf8 += 3;
-        } else if ((c & 0xF8) == 0xF0) {
-            UInt32 codepoint = (c & 0x07) << 18;
-            codepoint |= (utf8[1] & 0x3F) << 12;
-            codepoint |= (utf8[2] & 0x3F) << 6;
-            codepoint |= (utf8[3] & 0x3F);
-            // Surrogate pair
-            codepoint -= 0x10000;
-            *utf16++ = static_cast<Char>(0xD800 | (codepoint >> 10));
-            *utf16++ = static_cast<Char>(0xDC00 | (codepoint & 0x3FF));
-            utf8 += 4;
-        } else {
-            utf8 += 1;  // Skip invalid
-        }
-    }
-}
+// UTF-8 input decodes in a single pass into a scratch buffer of one unit per
+// byte (always enough), then is copied into an exact-size string. Small inputs
+// use the stack; larger ones a temporary heap buffer.
+static constexpr size_t UTF8_STACK_DECODE_BYTES = 512;
 
 String* string_create_utf8(const char* utf8) {
     if (!utf8) {
         return nullptr;
     }
+    return string_create_utf8(utf8, static_cast<Int32>(std::strlen(utf8)));
+}
 
-    Int32 len = utf8_to_utf16_length(utf8);
-    size_t size = sizeof(String) + (len * sizeof(Char));
+String* string_create_utf8(const char* utf8, Int32 byte_length) {
+    if (!utf8 || byte_length < 0) {
+        return nullptr;
+    }
 
-    String* str = static_cast<String*>(gc::alloc(size, &System::String_TypeInfo));
-    str->length = len;
-    utf8_to_utf16(utf8, str->chars);
+    size_t bytes = static_cast<size_t>(byte_length);
+    if (bytes <= UTF8_STACK_DECODE_BYTES) {
+        Char tmp[UTF8_STACK_DECODE_BYTES];
+        size_t len = utf::utf8_to_utf16(utf8, bytes, tmp);
+        return string_create_utf16(tmp, static_cast<Int32>(len));
+    }
 
+    Char* tmp = static_cast<Char*>(std::malloc(bytes * sizeof(Char)));
+    size_t len = utf::utf8_to_utf16(utf8, bytes, tmp);
+    String* str = string_create_utf16(tmp, static_cast<Int32>(len));
+    std::free(tmp);
     return str;
 }
 
@@ -162,8 +127,50 @@ String* string_concat(String* a, String* b) {
     return result;
 }
 
+String* string_concat(String* const* parts, Int32 count) {
+    // Pass 1: total length, and whether a copy is needed at all.
+    Int64 total = 0;
+    Int32 non_empty = 0;
+    String* only = nullptr;
+    String* first = nullptr;
+    for (Int32 i = 0; i < count; i++) {
+        String* s = parts[i];
+        if (!s) continue;
+        if (!first) first = s;
+        if (s->length == 0) continue;
+        total += s->length;
+        non_empty++;
+        only = s;
+    }
+    if (non_empty == 0) return first;
+    if (non_empty == 1) return only;
+    if (total > INT32_MAX) throw_overflow();
+
+    // Pass 2: one allocation, one copy per part.
+    String* result = string_fast_allocate(static_cast<Int32>(total));
+    Char* dst = result->chars;
+    for (Int32 i = 0; i < count; i++) {
+        String* s = parts[i];
+        if (!s || s->length == 0) continue;
+        std::memcpy(dst, s->chars, static_cast<size_t>(s->length) * sizeof(Char));
+        dst += s->length;
+    }
+    return result;
+}
+
 String* string_concat(String* a, String* b, String* c) {
-    return string_concat(string_concat(a, b), c);
+    String* parts[] = {a, b, c};
+    return string_concat(parts, 3);
+}
+
+String* string_concat(String* a, String* b, String* c, String* d) {
+    String* parts[] = {a, b, c, d};
+    return string_concat(parts, 4);
+}
+
+String* string_concat_array(Array* values) {
+    if (!values) throw_argument_null();
+    return string_concat(static_cast<String* const*>(array_data(values)), values->length);
 }
 
 Boolean string_equals(String* a, String* b) {
@@ -220,56 +227,82 @@ char* string_to_utf8(String* str) {
         return nullptr;
     }
 
-    // Calculate UTF-8 length
-    size_t utf8_len = 0;
-    for (Int32 i = 0; i < str->length; i++) {
-        Char c = str->chars[i];
-        if (c < 0x80) {
-            utf8_len += 1;
-        } else if (c < 0x800) {
-            utf8_len += 2;
-        } else {
-            utf8_len += 3;
-        }
-    }
-
+    size_t utf8_len = utf::utf16_to_utf8_length(str->chars, static_cast<size_t>(str->length));
     char* utf8 = static_cast<char*>(std::malloc(utf8_len + 1));
-    char* p = utf8;
+    utf::utf16_to_utf8(str->chars, static_cast<size_t>(str->length), utf8);
+    utf8[utf8_len] = '\0';
+    return utf8;
+}
 
-    for (Int32 i = 0; i < str->length; i++) {
-        Char c = str->chars[i];
-        if (c < 0x80) {
-            *p++ = static_cast<char>(c);
-        } else if (c < 0x800) {
-            *p++ = static_cast<char>(0xC0 | (c >> 6));
-            *p++ = static_cast<char>(0x80 | (c & 0x3F));
-        } else {
-            *p++ = static_cast<char>(0xE0 | (c >> 12));
-            *p++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
-            *p++ = static_cast<char>(0x80 | (c & 0x3F));
-        }
-    }
+// ── Primitive ToString ────────────────────────────────────
+// Digits are generated into a stack buffer (see format.h) and widened into a
+// string of exactly the right length.
 
-    *p = '\0';
-    return utf8;
+static String* ascii_to_string(const char* chars, Int32 n) {
+    String* result = string_fast_allocate(n);
+    for (Int32 i = 0; i < n; i++) result->chars[i] = static_cast<Char>(chars[i]);
+    return result;
 }
 
 String* string_from_int32(Int32 value) {
-    char buf[16];
-    snprintf(buf, sizeof(buf), "%d", value);
-    return string_create_utf8(buf);
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_int64(buf, value));
 }
 
-String* string_from_double(Double value) {
-    char buf[32];
-    snprintf(buf, sizeof(buf), "%g", value);
-    return string_create_utf8(buf);
+String* string_from_uint32(UInt32 value) {
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_uint64(buf, value));
 }
 
 String* string_from_int64(Int64 value) {
-    char buf[24];
-    snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(value));
-    return string_create_utf8(buf);
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_int64(buf, value));
+}
+
+String* string_from_uint64(UInt64 value) {
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_uint64(buf, value));
+}
+
+String* string_from_double(Double value) {
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_double(buf, value));
+}
+
+String* string_from_single(Single value) {
+    char buf[format::MAX_NUMBER_CHARS];
+    return ascii_to_string(buf, format::format_single(buf, value));
+}
+
+// ToString(format): a null or empty format is the default rendering.
+static String* format_primitive(const FormatArg& arg, String* format) {
+    format::Writer out;
+    format::format_value(out, arg, format ? format->chars : nullptr, format ? format->length : 0);
+    return out.to_string();
+}
+
+String* string_from_int32(Int32 value, String* format) {
+    return format_primitive(FormatArg(value), format);
+}
+
+String* string_from_uint32(UInt32 value, String* format) {
+    return format_primitive(FormatArg(value), format);
+}
+
+String* string_from_int64(Int64 value, String* format) {
+    return format_primitive(FormatArg(value), format);
+}
+
+String* string_from_uint64(UInt64 value, String* format) {
+    return format_primitive(FormatArg(value), format);
+}
+
+String* string_from_double(Double value, String* format) {
+    return format_primitive(FormatArg(value), format);
+}
+
+String* string_from_single(Single value, String* format) {
+    return format_primitive(FormatArg(value), format);
 }
 
 } // namespace cil2cpp
@@ -210,7 +210,8 @@ Boolean element_equals(const void* a, const void* b, TypeInfo* type) {
         return false;
     }
 
-    // Value type: byte comparison
+    // Value type: its own Equals when it has one, else byte comparison
+    if (type->value_equals) return type->value_equals(a, b);
     size_t es = elem_size(type);
     return std::memcmp(a, b, es) == 0;
 }
@@ -231,7 +232,8 @@ Int32 element_hash(const void* element, TypeInfo* type) {
         return object_get_hash_code(obj);
     }
 
-    // Value type: FNV-1a hash on raw bytes
+    // Value type: its own GetHashCode when it has one, else FNV-1a on raw bytes
+    if (type->value_hash) return type->value_hash(element);
     size_t es = elem_size(type);
     auto* data = static_cast<const uint8_t*>(element);
     uint32_t hash = 2166136261u;
@@ -242,4 +244,9 @@ Int32 element_hash(const void* element, TypeInfo* type) {
     return static_cast<Int32>(hash);
 }
 
+Boolean value_type_equals(const void* value, Object* other, TypeInfo* type) {
+    if (!other || other->__type_info != type) return false;
+    return element_equals(value, reinterpret_cast<char*>(other) + sizeof(Object), type);
+}
+
 } // namespace cil2cpp
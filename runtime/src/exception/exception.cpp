@@ -3,11 +3,14 @@
  */
 
 #include <cil2cpp/exception.h>
+#include <cil2cpp/array.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/type_info.h>
+#include <cil2cpp/bcl/System.Console.h>
 
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 
 // Platform-specific headers for stack trace capture
 #ifdef CIL2CPP_DEBUG
@@ -56,7 +59,8 @@ extern TypeInfo KeyNotFoundException_TypeInfo;
         g_exception_context->current_exception = ex;
         longjmp(g_exception_context->jump_buffer, 1);
     } else {
-        // No exception handler, terminate
+        // No exception handler, terminate (keep already-written output)
+        System::Console_Flush();
         fprintf(stderr, "Unhandled exception: ");
         if (ex && ex->message) {
             // TODO: Convert string to UTF-8 and print
@@ -199,11 +203,80 @@ static Exception* create_exception(TypeInfo* type, const char* message) {
 }
 
 [[noreturn]] void throw_operation_canceled() {
-    Exception* ex = create_exception(&OperationCanceledException_TypeInfo,
-                                      "The operation was canceled.");
+    throw_exception(operation_canceled_exception_create());
+}
+
+[[noreturn]] void throw_semaphore_full() {
+    Exception* ex = create_exception(&SemaphoreFullException_TypeInfo,
+                                      "Adding the specified count to the semaphore would cause it to exceed its maximum count.");
+    throw_exception(ex);
+}
+
+[[noreturn]] void throw_synchronization_lock() {
+    Exception* ex = create_exception(&SynchronizationLockException_TypeInfo,
+                                      "The lock is being released without being held.");
+    throw_exception(ex);
+}
+
+[[noreturn]] void throw_lock_recursion() {
+    Exception* ex = create_exception(&LockRecursionException_TypeInfo,
+                                      "Recursive lock acquisition is not allowed in this mode.");
     throw_exception(ex);
 }
 
+AggregateException* aggregate_exception_create(Exception* const* inner, Int32 count) {
+    auto* ex = static_cast<AggregateException*>(gc::alloc(sizeof(AggregateException), &AggregateException_TypeInfo));
+    ex->message = string_literal("One or more errors occurred.");
+    ex->inner_exceptions = array_create(&Exception_TypeInfo, count);
+    for (Int32 i = 0; i < count; i++) array_set<Exception*>(ex->inner_exceptions, i, inner[i]);
+    ex->inner_exception = count > 0 ? inner[0] : nullptr;
+    ex->stack_trace = capture_stack_trace();
+    return ex;
+}
+
+AggregateException* aggregate_exception_flatten(AggregateException* ex) {
+    // Same order as the BCL: nested aggregates are queued and expanded after the
+    // exceptions that sit directly in `ex`
+    std::vector<Exception*> flattened;
+    std::vector<AggregateException*> pending{ex};
+    for (size_t i = 0; i < pending.size(); i++) {
+        Array* inner = pending[i]->inner_exceptions;
+        for (Int32 j = 0; j < inner->length; j++) {
+            auto* e = array_get<Exception*>(inner, j);
+            if (!e) continue;
+            if (object_is_instance_of(e, &AggregateException_TypeInfo))
+                pending.push_back(static_cast<AggregateException*>(e));
+            else
+                flattened.push_back(e);
+        }
+    }
+    return aggregate_exception_create(flattened.data(), static_cast<Int32>(flattened.size()));
+}
+
+void aggregate_exception_handle(AggregateException* ex, bool (*predicate)(void* ctx, Exception* inner), void* ctx) {
+    // A GC array, not a std::vector: the predicate may throw, and throwing longjmps
+    Array* inner = ex->inner_exceptions;
+    Array* unhandled = array_create(&Exception_TypeInfo, inner->length);
+    Int32 count = 0;
+    for (Int32 i = 0; i < inner->length; i++) {
+        auto* e = array_get<Exception*>(inner, i);
+        if (!predicate(ctx, e)) array_set<Exception*>(unhandled, count++, e);
+    }
+    if (count > 0)
+        throw_exception(aggregate_exception_create(static_cast<Exception**>(array_data(unhandled)), count));
+}
+
+Exception* operation_canceled_exception_create() {
+    return create_exception(&OperationCanceledException_TypeInfo, "The operation was canceled.");
+}
+
+ChannelClosedException* channel_closed_exception_create(Exception* inner) {
+    auto* ex = static_cast<ChannelClosedException*>(
+        create_exception(&ChannelClosedException_TypeInfo, "The channel has been closed."));
+    ex->inner_exception = inner;
+    return ex;
+}
+
 [[noreturn]] void throw_platform_not_supported() {
     Exception* ex = create_exception(&PlatformNotSupportedException_TypeInfo,
                                       "Operation is not supported on this platform.");
@@ -526,6 +599,10 @@ EXCEPTION_TYPEINFO(TimeoutException,                "System", "System.TimeoutExc
 EXCEPTION_TYPEINFO(AggregateException,              "System", "System.AggregateException",              Exception)
 EXCEPTION_TYPEINFO(OperationCanceledException,      "System", "System.OperationCanceledException",      Exception)
 EXCEPTION_TYPEINFO(TaskCanceledException,           "System.Threading.Tasks", "System.Threading.Tasks.TaskCanceledException", OperationCanceledException)
+EXCEPTION_TYPEINFO(ChannelClosedException,          "System.Threading.Channels", "System.Threading.Channels.ChannelClosedException", InvalidOperationException)
+EXCEPTION_TYPEINFO(SemaphoreFullException,          "System.Threading", "System.Threading.SemaphoreFullException", Exception)
+EXCEPTION_TYPEINFO(SynchronizationLockException,    "System.Threading", "System.Threading.SynchronizationLockException", Exception)
+EXCEPTION_TYPEINFO(LockRecursionException,          "System.Threading", "System.Threading.LockRecursionException", Exception)
 EXCEPTION_TYPEINFO(KeyNotFoundException,            "System.Collections.Generic", "System.Collections.Generic.KeyNotFoundException", Exception)
 EXCEPTION_TYPEINFO(IOException,                    "System.IO", "System.IO.IOException",                    Exception)
 EXCEPTION_TYPEINFO(FileNotFoundException,          "System.IO", "System.IO.FileNotFoundException",          IOException)
@@ -14,14 +14,263 @@
 #include <cil2cpp/exception.h>
 
 #include <gc.h>
+#include <gc/gc_mark.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cil2cpp {
 namespace gc {
 
-void init(const GCConfig&) {
+// Thread-local storage is not reliably scanned (it may live outside the
+// stack range a thread registers), so thread_local blocks holding managed
+// references are pushed as roots explicitly. Each attached thread keeps the
+// addresses of its own copies in a ThreadRoots record; the records form a
+// list that the collector walks from its push-other-roots hook. This costs no
+// GC_add_roots slot (bdwgc allows only MAX_ROOT_SETS of those) however many
+// threads and blocks there are.
+struct ThreadStaticBlock {
+    void* (*block)();
+    size_t size;
+};
+
+struct ThreadRoots {
+    ThreadRoots* next = nullptr;
+    bool linked = false;
+    std::vector<std::pair<char*, size_t>> ranges;
+
+    ~ThreadRoots();   // a thread that exits without unregister_thread still unlinks
+};
+
+static std::mutex g_thread_static_mutex;
+static std::atomic<bool> g_initialized{false};
+
+// Guarded by the GC allocation lock, which the collector holds while marking
+static ThreadRoots* g_thread_roots = nullptr;
+static GC_push_other_roots_proc g_next_push_other_roots = nullptr;
+static thread_local ThreadRoots t_thread_roots;
+
+static std::vector<ThreadStaticBlock>& thread_static_blocks() {
+    static std::vector<ThreadStaticBlock> blocks;
+    return blocks;
+}
+
+template <typename F>
+static void with_alloc_lock(F&& fn) {
+    using Fn = std::remove_reference_t<F>;
+    GC_call_with_alloc_lock([](void* p) -> void* {
+        (*static_cast<Fn*>(p))();
+        return nullptr;
+    }, &fn);
+}
+
+static void GC_CALLBACK push_thread_statics() {
+    if (g_next_push_other_roots) g_next_push_other_roots();
+    for (auto* r = g_thread_roots; r; r = r->next) {
+        for (auto& [begin, size] : r->ranges) GC_push_all(begin, begin + size);
+    }
+}
+
+static void attach_thread_statics() {
+    auto& roots = t_thread_roots;
+    std::lock_guard<std::mutex> lock(g_thread_static_mutex);
+    with_alloc_lock([&] {
+        if (roots.linked) return;
+        for (auto& b : thread_static_blocks()) {
+            roots.ranges.emplace_back(static_cast<char*>(b.block()), b.size);
+        }
+        roots.next = g_thread_roots;
+        g_thread_roots = &roots;
+        roots.linked = true;
+    });
+}
+
+static void detach_thread_statics(ThreadRoots& roots = t_thread_roots) {
+    with_alloc_lock([&] {
+        if (!roots.linked) return;
+        for (auto** p = &g_thread_roots; *p; p = &(*p)->next) {
+            if (*p == &roots) {
+                *p = roots.next;
+                break;
+            }
+        }
+        roots.ranges.clear();
+        roots.linked = false;
+    });
+}
+
+ThreadRoots::~ThreadRoots() {
+    if (linked) detach_thread_statics(*this);
+}
+
+// ===== Instrumentation =====
+
+// Bytes this thread has allocated through alloc(); constinit so the
+// increment on the allocation path needs no TLS init guard.
+static thread_local constinit UInt64 t_allocated_bytes = 0;
+
+// Pause totals are written by the collector (one collection at a time,
+// under BoehmGC's allocation lock) and read by get_stats from any thread.
+static std::atomic<UInt64> g_pause_count{0};
+static std::atomic<UInt64> g_pause_total_ns{0};
+static std::atomic<UInt64> g_pause_max_ns{0};
+static std::atomic<UInt64> g_pause_histogram[kPauseHistogramBuckets];
+
+// Only touched from inside the event callback, i.e. under the allocation lock.
+static std::chrono::steady_clock::time_point g_cycle_start;
+static std::chrono::steady_clock::time_point g_world_stop_start;
+static bool g_world_stopped_this_cycle = false;
+
+static void record_pause(std::chrono::steady_clock::duration d) {
+    auto ns = static_cast<UInt64>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    int bucket = 0;
+    while (bucket < kPauseHistogramBuckets - 1 && ns >= pause_bucket_limit_us(bucket) * 1000) bucket++;
+    g_pause_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    g_pause_total_ns.fetch_add(ns, std::memory_order_relaxed);
+    if (ns > g_pause_max_ns.load(std::memory_order_relaxed))
+        g_pause_max_ns.store(ns, std::memory_order_relaxed);
+    g_pause_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+// A pause is the window the world is stopped (PRE_STOP_WORLD to
+// POST_START_WORLD), which also covers incremental mark steps. Builds that
+// never stop the world (no thread support) fall back to START..END.
+static void on_collection_event(GC_EventType event) {
+    // Mark/reclaim and per-thread suspend events are ignored before the
+    // clock is read, so they cost one switch.
+    switch (event) {
+    case GC_EVENT_START:
+        g_cycle_start = std::chrono::steady_clock::now();
+        g_world_stopped_this_cycle = false;
+        break;
+    case GC_EVENT_PRE_STOP_WORLD:
+        g_world_stop_start = std::chrono::steady_clock::now();
+        break;
+    case GC_EVENT_POST_START_WORLD:
+        record_pause(std::chrono::steady_clock::now() - g_world_stop_start);
+        g_world_stopped_this_cycle = true;
+        break;
+    case GC_EVENT_END:
+        if (!g_world_stopped_this_cycle) record_pause(std::chrono::steady_clock::now() - g_cycle_start);
+        break;
+    default:
+        break;
+    }
+}
+
+// ===== Configuration =====
+
+static GCConfig g_config;
+
+// "64M", "1g", "4096" -> bytes
+static bool parse_size(const char* text, size_t& out) {
+    errno = 0;
+    char* end = nullptr;
+    unsigned long long v = std::strtoull(text, &end, 10);
+    if (end == text || errno != 0) return false;
+    unsigned shift = 0;
+    switch (*end) {
+    case 'k': case 'K': shift = 10; end++; break;
+    case 'm': case 'M': shift = 20; end++; break;
+    case 'g': case 'G': shift = 30; end++; break;
+    default: break;
+    }
+    if (*end == 'b' || *end == 'B') end++;
+    if (*end != '\0') return false;
+    // Reject sizes that would wrap instead of silently truncating them
+    if (v > (std::numeric_limits<size_t>::max() >> shift)) return false;
+    out = static_cast<size_t>(v << shift);
+    return true;
+}
+
+static bool parse_int(const char* text, long min, long max, long& out) {
+    errno = 0;
+    char* end = nullptr;
+    long v = std::strtol(text, &end, 10);
+    if (end == text || *end != '\0' || errno != 0 || v < min || v > max) return false;
+    out = v;
+    return true;
+}
+
+static bool parse_bool(const char* text, bool& out) {
+    if (!std::strcmp(text, "1") || !std::strcmp(text, "true") || !std::strcmp(text, "on")) { out = true; return true; }
+    if (!std::strcmp(text, "0") || !std::strcmp(text, "false") || !std::strcmp(text, "off")) { out = false; return true; }
+    return false;
+}
+
+static const char* env_setting(const char* name) {
+    const char* value = std::getenv(name);
+    return value && *value ? value : nullptr;
+}
+
+static void report_invalid(const char* name, const char* value) {
+    std::fprintf(stderr, "cil2cpp: ignoring %s=%s (invalid value)\n", name, value);
+}
+
+GCConfig config_from_environment(GCConfig config) {
+    long n = 0;
+    if (const char* v = env_setting("CIL2CPP_GC_INITIAL_HEAP"))
+        if (!parse_size(v, config.initial_heap_size)) report_invalid("CIL2CPP_GC_INITIAL_HEAP", v);
+    if (const char* v = env_setting("CIL2CPP_GC_MAX_HEAP"))
+        if (!parse_size(v, config.max_heap_size)) report_invalid("CIL2CPP_GC_MAX_HEAP", v);
+    if (const char* v = env_setting("CIL2CPP_GC_FREE_SPACE_DIVISOR")) {
+        if (parse_int(v, 1, 1 << 20, n)) config.free_space_divisor = static_cast<UInt32>(n);
+        else report_invalid("CIL2CPP_GC_FREE_SPACE_DIVISOR", v);
+    }
+    if (const char* v = env_setting("CIL2CPP_GC_MARKERS")) {
+        if (parse_int(v, 1, 1024, n)) config.parallel_markers = static_cast<Int32>(n);
+        else report_invalid("CIL2CPP_GC_MARKERS", v);
+    }
+    if (const char* v = env_setting("CIL2CPP_GC_INCREMENTAL"))
+        if (!parse_bool(v, config.incremental)) report_invalid("CIL2CPP_GC_INCREMENTAL", v);
+    if (const char* v = env_setting("CIL2CPP_GC_FULL_FREQUENCY")) {
+        if (parse_int(v, 0, 1 << 20, n)) config.full_collection_frequency = static_cast<Int32>(n);
+        else report_invalid("CIL2CPP_GC_FULL_FREQUENCY", v);
+    }
+    return config;
+}
+
+GCConfig current_config() {
+    return g_config;
+}
+
+void init(const GCConfig& config) {
+    // The marker count is read when GC_INIT starts the marker threads
+    if (config.parallel_markers > 0) GC_set_markers_count(static_cast<unsigned>(config.parallel_markers));
     GC_INIT();
-    GC_enable_incremental();
+    GC_set_on_collection_event(on_collection_event);
+    if (config.free_space_divisor > 0) GC_set_free_space_divisor(config.free_space_divisor);
+    if (config.full_collection_frequency >= 0) GC_set_full_freq(config.full_collection_frequency);
+    if (config.max_heap_size > 0) GC_set_max_heap_size(config.max_heap_size);
+    size_t heap = GC_get_heap_size();
+    if (config.initial_heap_size > heap) GC_expand_hp(config.initial_heap_size - heap);
+    if (config.incremental) GC_enable_incremental();
     GC_allow_register_threads();
+    g_config = config;
+    if (!g_initialized.exchange(true)) {
+        g_next_push_other_roots = GC_get_push_other_roots();
+        GC_set_push_other_roots(push_thread_statics);
+        attach_thread_statics(); // main thread
+    }
+}
+
+void register_thread_static_block(void* (*block)(), size_t size) {
+    std::lock_guard<std::mutex> lock(g_thread_static_mutex);
+    thread_static_blocks().push_back({block, size});
+    if (!g_initialized.load()) return;
+    auto& roots = t_thread_roots;
+    with_alloc_lock([&] {
+        if (roots.linked) roots.ranges.emplace_back(static_cast<char*>(block()), size);
+    });
 }
 
 void shutdown() {
@@ -34,6 +283,7 @@ void* alloc(size_t size, TypeInfo* type) {
     if (!memory) {
         return nullptr;
     }
+    t_allocated_bytes += size;
 
     // Initialize object header
     Object* obj = static_cast<Object*>(memory);
@@ -82,10 +332,23 @@ void* alloc_array(TypeInfo* element_type, size_t length) {
     return arr;
 }
 
+void* alloc_uncollectable(size_t size) {
+    return GC_MALLOC_UNCOLLECTABLE(size);
+}
+
+void free_uncollectable(void* memory) {
+    GC_FREE(memory);
+}
+
 void collect() {
     GC_gcollect();
 }
 
+void suppress_finalize(Object* obj) {
+    if (obj && obj->__type_info && obj->__type_info->finalizer)
+        GC_register_finalizer_no_order(obj, nullptr, nullptr, nullptr, nullptr);
+}
+
 void set_incremental(bool enabled) {
     if (enabled) {
         GC_enable_incremental();
@@ -103,9 +366,11 @@ void register_thread() {
     struct GC_stack_base sb;
     GC_get_stack_base(&sb);
     GC_register_my_thread(&sb);
+    attach_thread_statics();
 }
 
 void unregister_thread() {
+    detach_thread_statics();
     GC_unregister_my_thread();
 }
 
@@ -118,13 +383,31 @@ void remove_root(void**) {
 }
 
 GCStats get_stats() {
-    return GCStats{
-        .total_allocated = GC_get_total_bytes(),
-        .total_freed = 0,  // BoehmGC doesn't track freed bytes directly
-        .current_heap_size = GC_get_heap_size(),
-        .collection_count = static_cast<size_t>(GC_get_gc_no()),
-        .total_pause_time_ms = 0.0
-    };
+    GCStats stats{};
+    // One consistent snapshot. Heap size and free bytes already exclude
+    // unmapped pages, so in-use is simply their difference.
+    GC_word heap_size = 0, free_bytes = 0, total_bytes = 0;
+    GC_get_heap_usage_safe(&heap_size, &free_bytes, nullptr, nullptr, &total_bytes);
+    stats.total_allocated = static_cast<size_t>(total_bytes);
+    stats.current_heap_size = static_cast<size_t>(heap_size);
+    stats.free_bytes = static_cast<size_t>(free_bytes);
+    stats.heap_in_use = stats.current_heap_size > stats.free_bytes ? stats.current_heap_size - stats.free_bytes : 0;
+    stats.total_freed = stats.total_allocated > stats.heap_in_use ? stats.total_allocated - stats.heap_in_use : 0;
+    stats.collection_count = static_cast<size_t>(GC_get_gc_no());
+    stats.pause_count = static_cast<size_t>(g_pause_count.load(std::memory_order_relaxed));
+    stats.total_pause_time_ms = static_cast<double>(g_pause_total_ns.load(std::memory_order_relaxed)) / 1e6;
+    stats.max_pause_time_ms = static_cast<double>(g_pause_max_ns.load(std::memory_order_relaxed)) / 1e6;
+    for (int i = 0; i < kPauseHistogramBuckets; i++)
+        stats.pause_histogram[i] = static_cast<size_t>(g_pause_histogram[i].load(std::memory_order_relaxed));
+    return stats;
+}
+
+size_t collection_count() {
+    return static_cast<size_t>(GC_get_gc_no());
+}
+
+UInt64 allocated_bytes_for_current_thread() {
+    return t_allocated_bytes;
 }
 
 } // namespace gc
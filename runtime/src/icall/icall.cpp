@@ -48,8 +48,55 @@ Int32 Environment_get_ProcessorCount() {
 }
 
 Int32 Environment_get_CurrentManagedThreadId() {
-    // Return a hash of the native thread ID as a managed thread ID
-    return static_cast<Int32>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0x7FFFFFFF);
+    return thread::current_managed_id();
+}
+
+// ===== System.GC =====
+// BoehmGC is not generational: every collection is a full one, so the
+// generation arguments only get range-checked and CollectionCount is the
+// same for every generation.
+
+void GC_Collect() {
+    gc::collect();
+}
+
+void GC_Collect(Int32 generation) {
+    if (generation < 0) throw_argument_out_of_range();
+    gc::collect();
+}
+
+void GC_Collect(Int32 generation, Int32 /*mode*/) {
+    GC_Collect(generation);
+}
+
+Int64 GC_GetTotalMemory(bool forceFullCollection) {
+    if (forceFullCollection) gc::collect();
+    return static_cast<Int64>(gc::get_stats().heap_in_use);
+}
+
+Int32 GC_CollectionCount(Int32 generation) {
+    if (generation < 0) throw_argument_out_of_range();
+    return static_cast<Int32>(gc::collection_count());
+}
+
+Int64 GC_GetAllocatedBytesForCurrentThread() {
+    return static_cast<Int64>(gc::allocated_bytes_for_current_thread());
+}
+
+Int64 GC_GetTotalAllocatedBytes(bool /*precise*/) {
+    return static_cast<Int64>(gc::get_stats().total_allocated);
+}
+
+void GC_SuppressFinalize(Object* obj) {
+    if (!obj) throw_argument_null();
+    gc::suppress_finalize(obj);
+}
+
+void GC_KeepAlive(Object* obj) {
+    // The volatile store keeps obj in a register or stack slot the
+    // conservative scan sees, up to this call.
+    Object* volatile keep = obj;
+    (void)keep;
 }
 
 // ===== System.Buffer =====
@@ -103,20 +150,6 @@ void Monitor_PulseAll(Object* obj) {
     monitor::pulse_all(obj);
 }
 
-// ===== System.Threading.Interlocked =====
-
-Int32 Interlocked_Increment_i32(Int32* location) { return interlocked::increment_i32(location); }
-Int32 Interlocked_Decrement_i32(Int32* location) { return interlocked::decrement_i32(location); }
-Int32 Interlocked_Exchange_i32(Int32* location, Int32 value) { return interlocked::exchange_i32(location, value); }
-Int32 Interlocked_CompareExchange_i32(Int32* location, Int32 value, Int32 comparand) { return interlocked::compare_exchange_i32(location, value, comparand); }
-Int32 Interlocked_Add_i32(Int32* location, Int32 value) { return interlocked::add_i32(location, value); }
-Int64 Interlocked_Increment_i64(Int64* location) { return interlocked::increment_i64(location); }
-Int64 Interlocked_Decrement_i64(Int64* location) { return interlocked::decrement_i64(location); }
-Int64 Interlocked_Exchange_i64(Int64* location, Int64 value) { return interlocked::exchange_i64(location, value); }
-Int64 Interlocked_CompareExchange_i64(Int64* location, Int64 value, Int64 comparand) { return interlocked::compare_exchange_i64(location, value, comparand); }
-Object* Interlocked_Exchange_obj(Object** location, Object* value) { return interlocked::exchange_obj(location, value); }
-Object* Interlocked_CompareExchange_obj(Object** location, Object* value, Object* comparand) { return interlocked::compare_exchange_obj(location, value, comparand); }
-
 // ===== System.Threading.Thread =====
 
 void Thread_Sleep(Int32 milliseconds) {
@@ -6,13 +6,15 @@
 
 namespace cil2cpp {
 
-void runtime_init() {
-    gc::init();
+void runtime_init(const gc::GCConfig& gc_config) {
+    gc::init(gc::config_from_environment(gc_config));
+    thread::current_managed_id(); // the main thread is managed thread 1
     threadpool::init();
 }
 
 void runtime_shutdown() {
     threadpool::shutdown();
+    System::Console_Flush();
     gc::collect();
     gc::shutdown();
 }
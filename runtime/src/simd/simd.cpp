@@ -0,0 +1,88 @@
+/**
+ * CIL2CPP Runtime - SIMD capability detection
+ */
+
+#include <cil2cpp/simd.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(CIL2CPP_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace cil2cpp {
+namespace simd {
+
+static Level detect_cpu() {
+#if defined(CIL2CPP_SIMD_X86)
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] >= 7) {
+        __cpuid(regs, 1);
+        bool osxsave = (regs[2] & (1 << 27)) != 0;
+        bool avx = (regs[2] & (1 << 28)) != 0;
+        // The OS must save YMM state across context switches (XCR0 bits 1, 2)
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(regs, 7, 0);
+            if (regs[1] & (1 << 5)) return Level::AVX2;
+        }
+    }
+    return Level::SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return Level::AVX2;
+    return Level::SSE2;
+#endif
+#else
+    return Level::Scalar;
+#endif
+}
+
+static Level clamp_to_env(Level best) {
+    const char* env = std::getenv("CIL2CPP_SIMD");
+    if (!env) return best;
+    Level wanted = best;
+    if (std::strcmp(env, "scalar") == 0) wanted = Level::Scalar;
+    else if (std::strcmp(env, "sse2") == 0) wanted = Level::SSE2;
+    else if (std::strcmp(env, "avx2") == 0) wanted = Level::AVX2;
+    return wanted < best ? wanted : best;
+}
+
+static std::atomic<Level> g_level{static_cast<Level>(0xFF)};  // 0xFF = not yet initialized
+
+Level detected() {
+    static const Level best = detect_cpu();
+    return best;
+}
+
+Level level() {
+    Level l = g_level.load(std::memory_order_relaxed);
+    if (static_cast<Byte>(l) == 0xFF) {
+        l = clamp_to_env(detected());
+        g_level.store(l, std::memory_order_relaxed);
+    }
+    return l;
+}
+
+Level set_level(Level requested) {
+    Level best = detected();
+    Level l = requested < best ? requested : best;
+    g_level.store(l, std::memory_order_relaxed);
+    return l;
+}
+
+const char* level_name(Level level) {
+    switch (level) {
+    case Level::Scalar: return "scalar";
+    case Level::SSE2:   return "sse2";
+    case Level::AVX2:   return "avx2";
+    }
+    return "unknown";
+}
+
+} // namespace simd
+} // namespace cil2cpp
@@ -0,0 +1,1051 @@
+/**
+ * CIL2CPP Runtime - Vectorized aggregate and search kernels
+ *
+ * Checked integer Sum runs in two phases. The vector pass splits the input
+ * into its positive and negative parts and sums each part separately in
+ * 64-bit lanes. Every prefix sum lies between the negative total and the
+ * positive total, so when both totals fit in the result type no step of the
+ * sequential sum can overflow and the result is exact. Only when a total
+ * falls outside the range (rare: the answer is then usually an exception)
+ * is the sequence re-summed element by element with checked_add, so the
+ * OverflowException is raised exactly when the BCL would raise it.
+ *
+ * Floating-point Min/Max reduce lanes with minps/maxps, which ignore a NaN in
+ * the first operand; NaN and +0.0 / -0.0 cases are resolved afterwards with a
+ * search, so the fast path never branches per element.
+ */
+
+#include <cil2cpp/vector_ops.h>
+#include <cil2cpp/simd.h>
+#include <cil2cpp/checked.h>
+
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(CIL2CPP_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace cil2cpp {
+namespace vec {
+
+static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+// acc += v in wrapping arithmetic; returns false if the signed add overflowed.
+static inline bool add_no_overflow(Int64& acc, Int64 v) {
+    UInt64 r = static_cast<UInt64>(acc) + static_cast<UInt64>(v);
+    bool ok = ((static_cast<UInt64>(acc) ^ r) & (static_cast<UInt64>(v) ^ r)) >> 63 == 0;
+    acc = static_cast<Int64>(r);
+    return ok;
+}
+
+// ===== Kernels =====
+//
+// find_* return NPOS when nothing is found. min_*/max_* require n >= 1 and a
+// non-NaN data[0]; min_f* set `nan` when any element is NaN, max_f* skip NaN.
+
+struct ScalarKernels {
+    static inline void sum_i32(const Int32* s, size_t n, Int64& pos, Int64& neg) {
+        for (size_t i = 0; i < n; i++) {
+            if (s[i] >= 0) pos += s[i];
+            else neg += s[i];
+        }
+    }
+
+    static inline bool sum_i64(const Int64* s, size_t n, Int64& pos, Int64& neg) {
+        bool ok = true;
+        for (size_t i = 0; i < n; i++) {
+            ok &= add_no_overflow(s[i] >= 0 ? pos : neg, s[i]);
+        }
+        return ok;
+    }
+
+    template<typename T>
+    static inline T min_of(const T* s, size_t n) {
+        T m = s[0];
+        for (size_t i = 1; i < n; i++) {
+            if (s[i] < m) m = s[i];
+        }
+        return m;
+    }
+
+    template<typename T>
+    static inline T max_of(const T* s, size_t n) {
+        T m = s[0];
+        for (size_t i = 1; i < n; i++) {
+            if (s[i] > m) m = s[i];
+        }
+        return m;
+    }
+
+    static inline Int32 min_i32(const Int32* s, size_t n) { return min_of(s, n); }
+    static inline Int32 max_i32(const Int32* s, size_t n) { return max_of(s, n); }
+    static inline Int64 min_i64(const Int64* s, size_t n) { return min_of(s, n); }
+    static inline Int64 max_i64(const Int64* s, size_t n) { return max_of(s, n); }
+
+    template<typename T>
+    static inline T min_float(const T* s, size_t n, bool& nan) {
+        T m = s[0];
+        bool any_nan = false;
+        for (size_t i = 0; i < n; i++) {
+            if (s[i] < m) m = s[i];
+            any_nan |= s[i] != s[i];
+        }
+        nan |= any_nan;
+        return m;
+    }
+
+    static inline Single min_f32(const Single* s, size_t n, bool& nan) { return min_float(s, n, nan); }
+    static inline Double min_f64(const Double* s, size_t n, bool& nan) { return min_float(s, n, nan); }
+    // NaN never compares greater, so max_of already skips it
+    static inline Single max_f32(const Single* s, size_t n) { return max_of(s, n); }
+    static inline Double max_f64(const Double* s, size_t n) { return max_of(s, n); }
+
+    template<typename T>
+    static inline size_t find(const T* s, size_t n, T value) {
+        for (size_t i = 0; i < n; i++) {
+            if (s[i] == value) return i;
+        }
+        return NPOS;
+    }
+
+    template<typename T>
+    static inline size_t find_nan(const T* s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (s[i] != s[i]) return i;
+        }
+        return NPOS;
+    }
+
+    static inline size_t find_8(const Byte* s, size_t n, Byte v) { return find(s, n, v); }
+    static inline size_t find_16(const UInt16* s, size_t n, UInt16 v) { return find(s, n, v); }
+    static inline size_t find_32(const UInt32* s, size_t n, UInt32 v) { return find(s, n, v); }
+    static inline size_t find_64(const UInt64* s, size_t n, UInt64 v) { return find(s, n, v); }
+    static inline size_t find_f32(const Single* s, size_t n, Single v) { return find(s, n, v); }
+    static inline size_t find_f64(const Double* s, size_t n, Double v) { return find(s, n, v); }
+    static inline size_t find_nan_f32(const Single* s, size_t n) { return find_nan(s, n); }
+    static inline size_t find_nan_f64(const Double* s, size_t n) { return find_nan(s, n); }
+
+    template<typename T>
+    static inline bool equal_float(const T* a, const T* b, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            if (!(a[i] == b[i] || (a[i] != a[i] && b[i] != b[i]))) return false;
+        }
+        return true;
+    }
+
+    static inline bool equal_f32(const Single* a, const Single* b, size_t n) { return equal_float(a, b, n); }
+    static inline bool equal_f64(const Double* a, const Double* b, size_t n) { return equal_float(a, b, n); }
+
+    template<typename T>
+    static inline void fill(T* s, size_t n, T value) {
+        for (size_t i = 0; i < n; i++) s[i] = value;
+    }
+
+    static inline void fill_16(UInt16* s, size_t n, UInt16 v) { fill(s, n, v); }
+    static inline void fill_32(UInt32* s, size_t n, UInt32 v) { fill(s, n, v); }
+    static inline void fill_64(UInt64* s, size_t n, UInt64 v) { fill(s, n, v); }
+};
+
+#if defined(CIL2CPP_SIMD_X86)
+
+struct SSE2Kernels {
+    static inline __m128i load(const void* p) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    static inline Int64 lane_sum(__m128i v) {
+        alignas(16) Int64 l[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(l), v);
+        return l[0] + l[1];
+    }
+
+    static inline void sum_i32(const Int32* s, size_t n, Int64& pos, Int64& neg) {
+        // Lanes are sign-extended to 64 bits: `total` sums everything, `negs`
+        // only the negative elements; the positive part is their difference.
+        __m128i total = _mm_setzero_si128();
+        __m128i negs = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128i v = load(s + i);
+            __m128i sign = _mm_srai_epi32(v, 31);
+            __m128i nv = _mm_and_si128(v, sign);
+            total = _mm_add_epi64(total, _mm_add_epi64(_mm_unpacklo_epi32(v, sign),
+                                                       _mm_unpackhi_epi32(v, sign)));
+            negs = _mm_add_epi64(negs, _mm_add_epi64(_mm_unpacklo_epi32(nv, sign),
+                                                     _mm_unpackhi_epi32(nv, sign)));
+        }
+        Int64 t = lane_sum(total);
+        Int64 ng = lane_sum(negs);
+        pos += t - ng;
+        neg += ng;
+        ScalarKernels::sum_i32(s + i, n - i, pos, neg);
+    }
+
+    // Adds v to acc per 64-bit lane and accumulates the lane overflow bit in ovf.
+    static inline __m128i add_i64(__m128i acc, __m128i v, __m128i& ovf) {
+        __m128i r = _mm_add_epi64(acc, v);
+        ovf = _mm_or_si128(ovf, _mm_and_si128(_mm_xor_si128(acc, r), _mm_xor_si128(v, r)));
+        return r;
+    }
+
+    static inline bool combine_i64(__m128i p, __m128i q, __m128i ovf, Int64& pos, Int64& neg) {
+        if (_mm_movemask_pd(_mm_castsi128_pd(ovf)) != 0) return false;
+        alignas(16) Int64 pl[2];
+        alignas(16) Int64 ql[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(pl), p);
+        _mm_store_si128(reinterpret_cast<__m128i*>(ql), q);
+        bool ok = true;
+        ok &= add_no_overflow(pos, pl[0]);
+        ok &= add_no_overflow(pos, pl[1]);
+        ok &= add_no_overflow(neg, ql[0]);
+        ok &= add_no_overflow(neg, ql[1]);
+        return ok;
+    }
+
+    static inline bool sum_i64(const Int64* s, size_t n, Int64& pos, Int64& neg) {
+        __m128i p = _mm_setzero_si128();
+        __m128i q = _mm_setzero_si128();
+        __m128i ovf = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128i v = load(s + i);
+            // No 64-bit arithmetic shift in SSE2: broadcast the high dword's sign
+            __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(v, 31), _MM_SHUFFLE(3, 3, 1, 1));
+            p = add_i64(p, _mm_andnot_si128(sign, v), ovf);
+            q = add_i64(q, _mm_and_si128(sign, v), ovf);
+        }
+        if (!combine_i64(p, q, ovf, pos, neg)) return false;
+        return ScalarKernels::sum_i64(s + i, n - i, pos, neg);
+    }
+
+    static inline __m128i min_epi32(__m128i a, __m128i b) {
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+    }
+
+    static inline __m128i max_epi32(__m128i a, __m128i b) {
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+
+    static inline Int32 min_i32(const Int32* s, size_t n) {
+        if (n < 4) return ScalarKernels::min_i32(s, n);
+        // Two accumulators: the compare/blend chain is latency-bound otherwise
+        __m128i m0 = load(s), m1 = m0;
+        size_t i = 4;
+        for (; i + 8 <= n; i += 8) {
+            m0 = min_epi32(m0, load(s + i));
+            m1 = min_epi32(m1, load(s + i + 4));
+        }
+        if (i + 4 <= n) { m0 = min_epi32(m0, load(s + i)); i += 4; }
+        alignas(16) Int32 l[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(l), min_epi32(m0, m1));
+        Int32 r = ScalarKernels::min_i32(l, 4);
+        for (; i < n; i++) if (s[i] < r) r = s[i];
+        return r;
+    }
+
+    static inline Int32 max_i32(const Int32* s, size_t n) {
+        if (n < 4) return ScalarKernels::max_i32(s, n);
+        // Two accumulators: the compare/blend chain is latency-bound otherwise
+        __m128i m0 = load(s), m1 = m0;
+        size_t i = 4;
+        for (; i + 8 <= n; i += 8) {
+            m0 = max_epi32(m0, load(s + i));
+            m1 = max_epi32(m1, load(s + i + 4));
+        }
+        if (i + 4 <= n) { m0 = max_epi32(m0, load(s + i)); i += 4; }
+        alignas(16) Int32 l[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(l), max_epi32(m0, m1));
+        Int32 r = ScalarKernels::max_i32(l, 4);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    // SSE2 has no 64-bit compare
+    static inline Int64 min_i64(const Int64* s, size_t n) { return ScalarKernels::min_i64(s, n); }
+    static inline Int64 max_i64(const Int64* s, size_t n) { return ScalarKernels::max_i64(s, n); }
+
+    static inline Single min_f32(const Single* s, size_t n, bool& nan) {
+        __m128 m = _mm_set1_ps(s[0]);
+        __m128 unord = _mm_setzero_ps();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_loadu_ps(s + i);
+            m = _mm_min_ps(v, m);
+            unord = _mm_or_ps(unord, _mm_cmpunord_ps(v, v));
+        }
+        alignas(16) Single l[4];
+        _mm_store_ps(l, m);
+        nan |= _mm_movemask_ps(unord) != 0;
+        Single r = ScalarKernels::min_float(l, 4, nan);
+        if (i < n) {
+            Single t = ScalarKernels::min_float(s + i, n - i, nan);
+            if (t < r) r = t;
+        }
+        return r;
+    }
+
+    static inline Single max_f32(const Single* s, size_t n) {
+        __m128 m = _mm_set1_ps(s[0]);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) m = _mm_max_ps(_mm_loadu_ps(s + i), m);
+        alignas(16) Single l[4];
+        _mm_store_ps(l, m);
+        Single r = ScalarKernels::max_f32(l, 4);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    static inline Double min_f64(const Double* s, size_t n, bool& nan) {
+        __m128d m = _mm_set1_pd(s[0]);
+        __m128d unord = _mm_setzero_pd();
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d v = _mm_loadu_pd(s + i);
+            m = _mm_min_pd(v, m);
+            unord = _mm_or_pd(unord, _mm_cmpunord_pd(v, v));
+        }
+        alignas(16) Double l[2];
+        _mm_store_pd(l, m);
+        nan |= _mm_movemask_pd(unord) != 0;
+        Double r = l[1] < l[0] ? l[1] : l[0];
+        if (i < n) {
+            if (s[i] < r) r = s[i];
+            nan |= s[i] != s[i];
+        }
+        return r;
+    }
+
+    static inline Double max_f64(const Double* s, size_t n) {
+        __m128d m = _mm_set1_pd(s[0]);
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) m = _mm_max_pd(_mm_loadu_pd(s + i), m);
+        alignas(16) Double l[2];
+        _mm_store_pd(l, m);
+        Double r = l[1] > l[0] ? l[1] : l[0];
+        if (i < n && s[i] > r) r = s[i];
+        return r;
+    }
+
+    template<typename U>
+    static inline __m128i broadcast(U v) {
+        if constexpr (sizeof(U) == 1) return _mm_set1_epi8(static_cast<char>(v));
+        else if constexpr (sizeof(U) == 2) return _mm_set1_epi16(static_cast<short>(v));
+        else if constexpr (sizeof(U) == 4) return _mm_set1_epi32(static_cast<int>(v));
+        else return _mm_set1_epi64x(static_cast<long long>(v));
+    }
+
+    template<typename U>
+    static inline __m128i cmpeq(__m128i a, __m128i b) {
+        if constexpr (sizeof(U) == 1) return _mm_cmpeq_epi8(a, b);
+        else if constexpr (sizeof(U) == 2) return _mm_cmpeq_epi16(a, b);
+        else if constexpr (sizeof(U) == 4) return _mm_cmpeq_epi32(a, b);
+        else {
+            // Both dwords of a 64-bit lane must match
+            __m128i c = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(c, _mm_shuffle_epi32(c, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    template<typename U>
+    static inline size_t find(const U* s, size_t n, U value) {
+        constexpr size_t lanes = 16 / sizeof(U);
+        const __m128i needle = broadcast(value);
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(cmpeq<U>(load(s + i), needle)));
+            if (m) return i + std::countr_zero(m) / sizeof(U);
+        }
+        size_t r = ScalarKernels::find(s + i, n - i, value);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    static inline size_t find_8(const Byte* s, size_t n, Byte v) { return find(s, n, v); }
+    static inline size_t find_16(const UInt16* s, size_t n, UInt16 v) { return find(s, n, v); }
+    static inline size_t find_32(const UInt32* s, size_t n, UInt32 v) { return find(s, n, v); }
+    static inline size_t find_64(const UInt64* s, size_t n, UInt64 v) { return find(s, n, v); }
+
+    static inline size_t find_f32(const Single* s, size_t n, Single value) {
+        const __m128 needle = _mm_set1_ps(value);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(s + i), needle)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = ScalarKernels::find(s + i, n - i, value);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    static inline size_t find_f64(const Double* s, size_t n, Double value) {
+        const __m128d needle = _mm_set1_pd(value);
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(s + i), needle)));
+            if (m) return i + std::countr_zero(m);
+        }
+        return (i < n && s[i] == value) ? i : NPOS;
+    }
+
+    static inline size_t find_nan_f32(const Single* s, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_loadu_ps(s + i);
+            UInt32 m = static_cast<UInt32>(_mm_movemask_ps(_mm_cmpunord_ps(v, v)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = ScalarKernels::find_nan(s + i, n - i);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    static inline size_t find_nan_f64(const Double* s, size_t n) {
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d v = _mm_loadu_pd(s + i);
+            UInt32 m = static_cast<UInt32>(_mm_movemask_pd(_mm_cmpunord_pd(v, v)));
+            if (m) return i + std::countr_zero(m);
+        }
+        return (i < n && s[i] != s[i]) ? i : NPOS;
+    }
+
+    static inline bool equal_f32(const Single* a, const Single* b, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m128 x = _mm_loadu_ps(a + i);
+            __m128 y = _mm_loadu_ps(b + i);
+            __m128 eq = _mm_or_ps(_mm_cmpeq_ps(x, y),
+                                  _mm_and_ps(_mm_cmpunord_ps(x, x), _mm_cmpunord_ps(y, y)));
+            if (_mm_movemask_ps(eq) != 0xF) return false;
+        }
+        return ScalarKernels::equal_f32(a + i, b + i, n - i);
+    }
+
+    static inline bool equal_f64(const Double* a, const Double* b, size_t n) {
+        size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            __m128d x = _mm_loadu_pd(a + i);
+            __m128d y = _mm_loadu_pd(b + i);
+            __m128d eq = _mm_or_pd(_mm_cmpeq_pd(x, y),
+                                   _mm_and_pd(_mm_cmpunord_pd(x, x), _mm_cmpunord_pd(y, y)));
+            if (_mm_movemask_pd(eq) != 0x3) return false;
+        }
+        return ScalarKernels::equal_f64(a + i, b + i, n - i);
+    }
+
+    template<typename U>
+    static inline void fill(U* s, size_t n, U value) {
+        constexpr size_t lanes = 16 / sizeof(U);
+        const __m128i v = broadcast(value);
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes) _mm_storeu_si128(reinterpret_cast<__m128i*>(s + i), v);
+        ScalarKernels::fill(s + i, n - i, value);
+    }
+
+    static inline void fill_16(UInt16* s, size_t n, UInt16 v) { fill(s, n, v); }
+    static inline void fill_32(UInt32* s, size_t n, UInt32 v) { fill(s, n, v); }
+    static inline void fill_64(UInt64* s, size_t n, UInt64 v) { fill(s, n, v); }
+};
+
+// Tails fall back to the SSE2 kernels, which inline into these functions.
+struct AVX2Kernels {
+    CIL2CPP_TARGET_AVX2
+    static inline __m256i load(const void* p) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Int64 lane_sum(__m256i v) {
+        alignas(32) Int64 l[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), v);
+        return (l[0] + l[1]) + (l[2] + l[3]);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline void sum_i32(const Int32* s, size_t n, Int64& pos, Int64& neg) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i total = zero;
+        __m256i negs = zero;
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i lo = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+            __m256i hi = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 4)));
+            total = _mm256_add_epi64(total, _mm256_add_epi64(lo, hi));
+            negs = _mm256_add_epi64(negs, _mm256_add_epi64(
+                _mm256_and_si256(lo, _mm256_cmpgt_epi64(zero, lo)),
+                _mm256_and_si256(hi, _mm256_cmpgt_epi64(zero, hi))));
+        }
+        Int64 t = lane_sum(total);
+        Int64 ng = lane_sum(negs);
+        pos += t - ng;
+        neg += ng;
+        SSE2Kernels::sum_i32(s + i, n - i, pos, neg);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline __m256i add_i64(__m256i acc, __m256i v, __m256i& ovf) {
+        __m256i r = _mm256_add_epi64(acc, v);
+        ovf = _mm256_or_si256(ovf, _mm256_and_si256(_mm256_xor_si256(acc, r), _mm256_xor_si256(v, r)));
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline bool sum_i64(const Int64* s, size_t n, Int64& pos, Int64& neg) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i p = zero;
+        __m256i q = zero;
+        __m256i ovf = zero;
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = load(s + i);
+            __m256i sign = _mm256_cmpgt_epi64(zero, v);
+            p = add_i64(p, _mm256_andnot_si256(sign, v), ovf);
+            q = add_i64(q, _mm256_and_si256(sign, v), ovf);
+        }
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(ovf)) != 0) return false;
+        alignas(32) Int64 pl[4];
+        alignas(32) Int64 ql[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(pl), p);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(ql), q);
+        bool ok = true;
+        for (int k = 0; k < 4; k++) {
+            ok &= add_no_overflow(pos, pl[k]);
+            ok &= add_no_overflow(neg, ql[k]);
+        }
+        if (!ok) return false;
+        return SSE2Kernels::sum_i64(s + i, n - i, pos, neg);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Int32 min_i32(const Int32* s, size_t n) {
+        if (n < 8) return SSE2Kernels::min_i32(s, n);
+        __m256i m0 = load(s), m1 = m0;
+        size_t i = 8;
+        for (; i + 16 <= n; i += 16) {
+            m0 = _mm256_min_epi32(m0, load(s + i));
+            m1 = _mm256_min_epi32(m1, load(s + i + 8));
+        }
+        if (i + 8 <= n) { m0 = _mm256_min_epi32(m0, load(s + i)); i += 8; }
+        alignas(32) Int32 l[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), _mm256_min_epi32(m0, m1));
+        Int32 r = ScalarKernels::min_i32(l, 8);
+        for (; i < n; i++) if (s[i] < r) r = s[i];
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Int32 max_i32(const Int32* s, size_t n) {
+        if (n < 8) return SSE2Kernels::max_i32(s, n);
+        __m256i m0 = load(s), m1 = m0;
+        size_t i = 8;
+        for (; i + 16 <= n; i += 16) {
+            m0 = _mm256_max_epi32(m0, load(s + i));
+            m1 = _mm256_max_epi32(m1, load(s + i + 8));
+        }
+        if (i + 8 <= n) { m0 = _mm256_max_epi32(m0, load(s + i)); i += 8; }
+        alignas(32) Int32 l[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), _mm256_max_epi32(m0, m1));
+        Int32 r = ScalarKernels::max_i32(l, 8);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Int64 min_i64(const Int64* s, size_t n) {
+        if (n < 4) return ScalarKernels::min_i64(s, n);
+        __m256i m = load(s);
+        size_t i = 4;
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = load(s + i);
+            m = _mm256_blendv_epi8(m, v, _mm256_cmpgt_epi64(m, v));
+        }
+        alignas(32) Int64 l[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), m);
+        Int64 r = ScalarKernels::min_i64(l, 4);
+        for (; i < n; i++) if (s[i] < r) r = s[i];
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Int64 max_i64(const Int64* s, size_t n) {
+        if (n < 4) return ScalarKernels::max_i64(s, n);
+        __m256i m = load(s);
+        size_t i = 4;
+        for (; i + 4 <= n; i += 4) {
+            __m256i v = load(s + i);
+            m = _mm256_blendv_epi8(m, v, _mm256_cmpgt_epi64(v, m));
+        }
+        alignas(32) Int64 l[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(l), m);
+        Int64 r = ScalarKernels::max_i64(l, 4);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Single min_f32(const Single* s, size_t n, bool& nan) {
+        __m256 m = _mm256_set1_ps(s[0]);
+        __m256 unord = _mm256_setzero_ps();
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_loadu_ps(s + i);
+            m = _mm256_min_ps(v, m);
+            unord = _mm256_or_ps(unord, _mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+        }
+        alignas(32) Single l[8];
+        _mm256_store_ps(l, m);
+        nan |= _mm256_movemask_ps(unord) != 0;
+        Single r = ScalarKernels::min_float(l, 8, nan);
+        if (i < n) {
+            Single t = SSE2Kernels::min_f32(s + i, n - i, nan);
+            if (t < r) r = t;
+        }
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Single max_f32(const Single* s, size_t n) {
+        __m256 m = _mm256_set1_ps(s[0]);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) m = _mm256_max_ps(_mm256_loadu_ps(s + i), m);
+        alignas(32) Single l[8];
+        _mm256_store_ps(l, m);
+        Single r = ScalarKernels::max_f32(l, 8);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Double min_f64(const Double* s, size_t n, bool& nan) {
+        __m256d m = _mm256_set1_pd(s[0]);
+        __m256d unord = _mm256_setzero_pd();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d v = _mm256_loadu_pd(s + i);
+            m = _mm256_min_pd(v, m);
+            unord = _mm256_or_pd(unord, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+        }
+        alignas(32) Double l[4];
+        _mm256_store_pd(l, m);
+        nan |= _mm256_movemask_pd(unord) != 0;
+        Double r = ScalarKernels::min_float(l, 4, nan);
+        if (i < n) {
+            Double t = SSE2Kernels::min_f64(s + i, n - i, nan);
+            if (t < r) r = t;
+        }
+        return r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline Double max_f64(const Double* s, size_t n) {
+        __m256d m = _mm256_set1_pd(s[0]);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) m = _mm256_max_pd(_mm256_loadu_pd(s + i), m);
+        alignas(32) Double l[4];
+        _mm256_store_pd(l, m);
+        Double r = ScalarKernels::max_f64(l, 4);
+        for (; i < n; i++) if (s[i] > r) r = s[i];
+        return r;
+    }
+
+    template<typename U>
+    CIL2CPP_TARGET_AVX2
+    static inline __m256i broadcast(U v) {
+        if constexpr (sizeof(U) == 1) return _mm256_set1_epi8(static_cast<char>(v));
+        else if constexpr (sizeof(U) == 2) return _mm256_set1_epi16(static_cast<short>(v));
+        else if constexpr (sizeof(U) == 4) return _mm256_set1_epi32(static_cast<int>(v));
+        else return _mm256_set1_epi64x(static_cast<long long>(v));
+    }
+
+    template<typename U>
+    CIL2CPP_TARGET_AVX2
+    static inline __m256i cmpeq(__m256i a, __m256i b) {
+        if constexpr (sizeof(U) == 1) return _mm256_cmpeq_epi8(a, b);
+        else if constexpr (sizeof(U) == 2) return _mm256_cmpeq_epi16(a, b);
+        else if constexpr (sizeof(U) == 4) return _mm256_cmpeq_epi32(a, b);
+        else return _mm256_cmpeq_epi64(a, b);
+    }
+
+    template<typename U>
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find(const U* s, size_t n, U value) {
+        constexpr size_t lanes = 32 / sizeof(U);
+        const __m256i needle = broadcast(value);
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(cmpeq<U>(load(s + i), needle)));
+            if (m) return i + std::countr_zero(m) / sizeof(U);
+        }
+        size_t r = SSE2Kernels::find(s + i, n - i, value);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_8(const Byte* s, size_t n, Byte v) { return find(s, n, v); }
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_16(const UInt16* s, size_t n, UInt16 v) { return find(s, n, v); }
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_32(const UInt32* s, size_t n, UInt32 v) { return find(s, n, v); }
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_64(const UInt64* s, size_t n, UInt64 v) { return find(s, n, v); }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_f32(const Single* s, size_t n, Single value) {
+        const __m256 needle = _mm256_set1_ps(value);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_ps(
+                _mm256_cmp_ps(_mm256_loadu_ps(s + i), needle, _CMP_EQ_OQ)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = SSE2Kernels::find_f32(s + i, n - i, value);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_f64(const Double* s, size_t n, Double value) {
+        const __m256d needle = _mm256_set1_pd(value);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_pd(
+                _mm256_cmp_pd(_mm256_loadu_pd(s + i), needle, _CMP_EQ_OQ)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = SSE2Kernels::find_f64(s + i, n - i, value);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_nan_f32(const Single* s, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_loadu_ps(s + i);
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_ps(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = SSE2Kernels::find_nan_f32(s + i, n - i);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_nan_f64(const Double* s, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d v = _mm256_loadu_pd(s + i);
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_pd(_mm256_cmp_pd(v, v, _CMP_UNORD_Q)));
+            if (m) return i + std::countr_zero(m);
+        }
+        size_t r = SSE2Kernels::find_nan_f64(s + i, n - i);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline bool equal_f32(const Single* a, const Single* b, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256 x = _mm256_loadu_ps(a + i);
+            __m256 y = _mm256_loadu_ps(b + i);
+            __m256 eq = _mm256_or_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ),
+                                     _mm256_and_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q),
+                                                   _mm256_cmp_ps(y, y, _CMP_UNORD_Q)));
+            if (_mm256_movemask_ps(eq) != 0xFF) return false;
+        }
+        return SSE2Kernels::equal_f32(a + i, b + i, n - i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline bool equal_f64(const Double* a, const Double* b, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256d x = _mm256_loadu_pd(a + i);
+            __m256d y = _mm256_loadu_pd(b + i);
+            __m256d eq = _mm256_or_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ),
+                                      _mm256_and_pd(_mm256_cmp_pd(x, x, _CMP_UNORD_Q),
+                                                    _mm256_cmp_pd(y, y, _CMP_UNORD_Q)));
+            if (_mm256_movemask_pd(eq) != 0xF) return false;
+        }
+        return SSE2Kernels::equal_f64(a + i, b + i, n - i);
+    }
+
+    template<typename U>
+    CIL2CPP_TARGET_AVX2
+    static inline void fill(U* s, size_t n, U value) {
+        constexpr size_t lanes = 32 / sizeof(U);
+        const __m256i v = broadcast(value);
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes) _mm256_storeu_si256(reinterpret_cast<__m256i*>(s + i), v);
+        SSE2Kernels::fill(s + i, n - i, value);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline void fill_16(UInt16* s, size_t n, UInt16 v) { fill(s, n, v); }
+    CIL2CPP_TARGET_AVX2
+    static inline void fill_32(UInt32* s, size_t n, UInt32 v) { fill(s, n, v); }
+    CIL2CPP_TARGET_AVX2
+    static inline void fill_64(UInt64* s, size_t n, UInt64 v) { fill(s, n, v); }
+};
+
+#endif // CIL2CPP_SIMD_X86
+
+// ===== Drivers =====
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE void sum_i32_impl(const Int32* s, size_t n, Int64& pos, Int64& neg) {
+    K::sum_i32(s, n, pos, neg);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE bool sum_i64_impl(const Int64* s, size_t n, Int64& pos, Int64& neg) {
+    return K::sum_i64(s, n, pos, neg);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE Int32 min_i32_impl(const Int32* s, size_t n) { return K::min_i32(s, n); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE Int32 max_i32_impl(const Int32* s, size_t n) { return K::max_i32(s, n); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE Int64 min_i64_impl(const Int64* s, size_t n) { return K::min_i64(s, n); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE Int64 max_i64_impl(const Int64* s, size_t n) { return K::max_i64(s, n); }
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE Single min_f32_impl(const Single* s, size_t n, bool& nan) {
+    return K::min_f32(s, n, nan);
+}
+template<typename K>
+static CIL2CPP_FORCE_INLINE Double min_f64_impl(const Double* s, size_t n, bool& nan) {
+    return K::min_f64(s, n, nan);
+}
+template<typename K>
+static CIL2CPP_FORCE_INLINE Single max_f32_impl(const Single* s, size_t n) { return K::max_f32(s, n); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE Double max_f64_impl(const Double* s, size_t n) { return K::max_f64(s, n); }
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_8_impl(const Byte* s, size_t n, Byte v) { return K::find_8(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_16_impl(const UInt16* s, size_t n, UInt16 v) { return K::find_16(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_32_impl(const UInt32* s, size_t n, UInt32 v) { return K::find_32(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_64_impl(const UInt64* s, size_t n, UInt64 v) { return K::find_64(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_f32_impl(const Single* s, size_t n, Single v) { return K::find_f32(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_f64_impl(const Double* s, size_t n, Double v) { return K::find_f64(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_nan_f32_impl(const Single* s, size_t n) { return K::find_nan_f32(s, n); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_nan_f64_impl(const Double* s, size_t n) { return K::find_nan_f64(s, n); }
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE bool equal_f32_impl(const Single* a, const Single* b, size_t n) {
+    return K::equal_f32(a, b, n);
+}
+template<typename K>
+static CIL2CPP_FORCE_INLINE bool equal_f64_impl(const Double* a, const Double* b, size_t n) {
+    return K::equal_f64(a, b, n);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE void fill_16_impl(UInt16* s, size_t n, UInt16 v) { K::fill_16(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE void fill_32_impl(UInt32* s, size_t n, UInt32 v) { K::fill_32(s, n, v); }
+template<typename K>
+static CIL2CPP_FORCE_INLINE void fill_64_impl(UInt64* s, size_t n, UInt64 v) { K::fill_64(s, n, v); }
+
+CIL2CPP_SIMD_ENTRY(void, sum_i32, (const Int32* s, size_t n, Int64& pos, Int64& neg), (s, n, pos, neg))
+CIL2CPP_SIMD_ENTRY(bool, sum_i64, (const Int64* s, size_t n, Int64& pos, Int64& neg), (s, n, pos, neg))
+CIL2CPP_SIMD_ENTRY(Int32, min_i32, (const Int32* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(Int32, max_i32, (const Int32* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(Int64, min_i64, (const Int64* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(Int64, max_i64, (const Int64* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(Single, min_f32, (const Single* s, size_t n, bool& nan), (s, n, nan))
+CIL2CPP_SIMD_ENTRY(Double, min_f64, (const Double* s, size_t n, bool& nan), (s, n, nan))
+CIL2CPP_SIMD_ENTRY(Single, max_f32, (const Single* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(Double, max_f64, (const Double* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(size_t, find_8, (const Byte* s, size_t n, Byte v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_16, (const UInt16* s, size_t n, UInt16 v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_32, (const UInt32* s, size_t n, UInt32 v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_64, (const UInt64* s, size_t n, UInt64 v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_f32, (const Single* s, size_t n, Single v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_f64, (const Double* s, size_t n, Double v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(size_t, find_nan_f32, (const Single* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(size_t, find_nan_f64, (const Double* s, size_t n), (s, n))
+CIL2CPP_SIMD_ENTRY(bool, equal_f32, (const Single* a, const Single* b, size_t n), (a, b, n))
+CIL2CPP_SIMD_ENTRY(bool, equal_f64, (const Double* a, const Double* b, size_t n), (a, b, n))
+CIL2CPP_SIMD_ENTRY(void, fill_16, (UInt16* s, size_t n, UInt16 v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(void, fill_32, (UInt32* s, size_t n, UInt32 v), (s, n, v))
+CIL2CPP_SIMD_ENTRY(void, fill_64, (UInt64* s, size_t n, UInt64 v), (s, n, v))
+
+// ===== Public API =====
+
+static inline Int32 to_index(size_t r) {
+    return r == NPOS ? -1 : static_cast<Int32>(r);
+}
+
+static inline size_t count(Int32 n) {
+    return static_cast<size_t>(n);
+}
+
+template<typename T>
+static T sum_checked_sequential(const T* data, Int32 n) {
+    T s = 0;
+    for (Int32 i = 0; i < n; i++) s = checked_add(s, data[i]);
+    return s;
+}
+
+Int32 sum(const Int32* data, Int32 n) {
+    if (n <= 0) return 0;
+    Int64 pos = 0;
+    Int64 neg = 0;
+    sum_i32_dispatch(data, count(n), pos, neg);
+    if (pos <= std::numeric_limits<Int32>::max() && neg >= std::numeric_limits<Int32>::min())
+        return static_cast<Int32>(pos + neg);
+    return sum_checked_sequential(data, n);
+}
+
+Int64 sum(const Int64* data, Int32 n) {
+    if (n <= 0) return 0;
+    Int64 pos = 0;
+    Int64 neg = 0;
+    if (sum_i64_dispatch(data, count(n), pos, neg)) return pos + neg;
+    return sum_checked_sequential(data, n);
+}
+
+Double sum(const Double* data, Int32 n) {
+    Double s = 0;
+    for (Int32 i = 0; i < n; i++) s += data[i];
+    return s;
+}
+
+Double sum(const Single* data, Int32 n) {
+    Double s = 0;
+    for (Int32 i = 0; i < n; i++) s += data[i];
+    return s;
+}
+
+Int32 min(const Int32* data, Int32 n) { return min_i32_dispatch(data, count(n)); }
+Int32 max(const Int32* data, Int32 n) { return max_i32_dispatch(data, count(n)); }
+Int64 min(const Int64* data, Int32 n) { return min_i64_dispatch(data, count(n)); }
+Int64 max(const Int64* data, Int32 n) { return max_i64_dispatch(data, count(n)); }
+
+Double min(const Double* data, Int32 n) {
+    if (std::isnan(data[0])) return data[0];
+    bool nan = false;
+    Double m = min_f64_dispatch(data, count(n), nan);
+    if (nan) return data[find_nan_f64_dispatch(data, count(n))];
+    // -0.0 and +0.0 compare equal: the first zero is the sequential answer
+    if (m == 0) return data[find_f64_dispatch(data, count(n), 0.0)];
+    return m;
+}
+
+Single min(const Single* data, Int32 n) {
+    if (std::isnan(data[0])) return data[0];
+    bool nan = false;
+    Single m = min_f32_dispatch(data, count(n), nan);
+    if (nan) return data[find_nan_f32_dispatch(data, count(n))];
+    if (m == 0) return data[find_f32_dispatch(data, count(n), 0.0f)];
+    return m;
+}
+
+Double max(const Double* data, Int32 n) {
+    // Leading NaNs are skipped; NaN is the result only if every element is NaN
+    Int32 i = 0;
+    while (std::isnan(data[i])) {
+        if (++i == n) return data[n - 1];
+    }
+    Double m = max_f64_dispatch(data + i, count(n - i));
+    if (m == 0) return data[i + find_f64_dispatch(data + i, count(n - i), 0.0)];
+    return m;
+}
+
+Single max(const Single* data, Int32 n) {
+    Int32 i = 0;
+    while (std::isnan(data[i])) {
+        if (++i == n) return data[n - 1];
+    }
+    Single m = max_f32_dispatch(data + i, count(n - i));
+    if (m == 0) return data[i + find_f32_dispatch(data + i, count(n - i), 0.0f)];
+    return m;
+}
+
+Double average(const Int32* data, Int32 n) {
+    // An Int64 total of at most 2^31 Int32 values cannot overflow
+    Int64 pos = 0;
+    Int64 neg = 0;
+    sum_i32_dispatch(data, count(n), pos, neg);
+    return static_cast<Double>(pos + neg) / n;
+}
+
+Double average(const Int64* data, Int32 n) {
+    return static_cast<Double>(sum(data, n)) / n;
+}
+
+Double average(const Double* data, Int32 n) {
+    return sum(data, n) / n;
+}
+
+Single average(const Single* data, Int32 n) {
+    return static_cast<Single>(sum(data, n) / n);
+}
+
+namespace detail {
+
+Int32 index_of_8(const void* data, Int32 n, Byte value) {
+    if (n <= 0) return -1;
+    return to_index(find_8_dispatch(static_cast<const Byte*>(data), count(n), value));
+}
+
+Int32 index_of_16(const void* data, Int32 n, UInt16 value) {
+    if (n <= 0) return -1;
+    return to_index(find_16_dispatch(static_cast<const UInt16*>(data), count(n), value));
+}
+
+Int32 index_of_32(const void* data, Int32 n, UInt32 value) {
+    if (n <= 0) return -1;
+    return to_index(find_32_dispatch(static_cast<const UInt32*>(data), count(n), value));
+}
+
+Int32 index_of_64(const void* data, Int32 n, UInt64 value) {
+    if (n <= 0) return -1;
+    return to_index(find_64_dispatch(static_cast<const UInt64*>(data), count(n), value));
+}
+
+Int32 index_of_f32(const Single* data, Int32 n, Single value) {
+    if (n <= 0) return -1;
+    if (std::isnan(value)) return to_index(find_nan_f32_dispatch(data, count(n)));
+    return to_index(find_f32_dispatch(data, count(n), value));
+}
+
+Int32 index_of_f64(const Double* data, Int32 n, Double value) {
+    if (n <= 0) return -1;
+    if (std::isnan(value)) return to_index(find_nan_f64_dispatch(data, count(n)));
+    return to_index(find_f64_dispatch(data, count(n), value));
+}
+
+bool equal_f32(const Single* a, const Single* b, Int32 n) {
+    return equal_f32_dispatch(a, b, count(n));
+}
+
+bool equal_f64(const Double* a, const Double* b, Int32 n) {
+    return equal_f64_dispatch(a, b, count(n));
+}
+
+void fill_16(void* data, Int32 n, UInt16 value) {
+    fill_16_dispatch(static_cast<UInt16*>(data), count(n), value);
+}
+
+void fill_32(void* data, Int32 n, UInt32 value) {
+    fill_32_dispatch(static_cast<UInt32*>(data), count(n), value);
+}
+
+void fill_64(void* data, Int32 n, UInt64 value) {
+    fill_64_dispatch(static_cast<UInt64*>(data), count(n), value);
+}
+
+} // namespace detail
+
+} // namespace vec
+} // namespace cil2cpp
@@ -0,0 +1,834 @@
+/**
+ * CIL2CPP Runtime - Composite and numeric formatting
+ *
+ * Numbers are first reduced to a decimal digit string plus a scale (the
+ * Number struct below); every standard and custom format is then a layout of
+ * those digits. Integers produce their digits exactly; doubles get theirs from
+ * std::to_chars — shortest round-trip, N significant digits or N decimals,
+ * all correctly rounded — so nothing here does floating-point arithmetic.
+ */
+
+#include <cil2cpp/format.h>
+#include <cil2cpp/bcl/System.String.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/type_info.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace cil2cpp {
+namespace format {
+
+// ===== Integer digits =====
+
+static constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static inline Int32 count_digits(UInt64 v) {
+    Int32 n = 1;
+    for (;;) {
+        if (v < 10) return n;
+        if (v < 100) return n + 1;
+        if (v < 1000) return n + 2;
+        if (v < 10000) return n + 3;
+        v /= 10000;
+        n += 4;
+    }
+}
+
+// Write the decimal digits of v so that they end just before end.
+template<typename CharT>
+static inline void write_digits_backward(CharT* end, UInt64 v) {
+    while (v >= 100) {
+        auto pair = static_cast<size_t>(v % 100) * 2;
+        v /= 100;
+        end -= 2;
+        end[0] = static_cast<CharT>(DIGIT_PAIRS[pair]);
+        end[1] = static_cast<CharT>(DIGIT_PAIRS[pair + 1]);
+    }
+    if (v >= 10) {
+        auto pair = static_cast<size_t>(v) * 2;
+        end[-2] = static_cast<CharT>(DIGIT_PAIRS[pair]);
+        end[-1] = static_cast<CharT>(DIGIT_PAIRS[pair + 1]);
+    } else {
+        end[-1] = static_cast<CharT>('0' + v);
+    }
+}
+
+static inline UInt64 magnitude(Int64 v) {
+    return v < 0 ? 0 - static_cast<UInt64>(v) : static_cast<UInt64>(v);
+}
+
+Int32 format_uint64(char* out, UInt64 value) {
+    Int32 n = count_digits(value);
+    write_digits_backward(out + n, value);
+    return n;
+}
+
+Int32 format_int64(char* out, Int64 value) {
+    if (value < 0) {
+        out[0] = '-';
+        return 1 + format_uint64(out + 1, magnitude(value));
+    }
+    return format_uint64(out, static_cast<UInt64>(value));
+}
+
+// ===== Decimal numbers =====
+
+// value = 0.d1 d2 d3 ... × 10^scale. digits has no leading or trailing zeros;
+// zero is count == 0. Digits past count (or before 0) read as '0'.
+struct Number {
+    static constexpr Int32 MAX_DIGITS = 480;
+
+    char digits[MAX_DIGITS];
+    Int32 count = 0;
+    Int32 scale = 0;
+    bool negative = false;
+
+    char digit(Int32 i) const { return i >= 0 && i < count ? digits[i] : '0'; }
+    bool is_zero() const { return count == 0; }
+};
+
+// Longest precision requested from std::to_chars; larger requests are padded
+// with zeros past the last computed digit.
+static constexpr Int32 MAX_TO_CHARS_PRECISION = 100;
+
+static void set_digits(Number& num, const char* d, Int32 n, Int32 scale) {
+    while (n > 0 && *d == '0') { d++; n--; scale--; }
+    while (n > 0 && d[n - 1] == '0') n--;
+    // Clamped on both sides: n is never negative here, but GCC cannot tell and
+    // warns that the memcpy size may be huge (-Wstringop-overflow)
+    n = std::clamp(n, 0, Number::MAX_DIGITS);
+    std::memcpy(num.digits, d, static_cast<size_t>(n));
+    num.count = n;
+    num.scale = n > 0 ? scale : 0;
+}
+
+static void number_from_integer(Number& num, UInt64 mag, bool negative) {
+    char buf[24];
+    Int32 n = format_uint64(buf, mag);
+    set_digits(num, buf, n, n);
+    num.negative = negative;
+}
+
+enum class Digits { Shortest, Significant, Fixed };
+
+// Digits of a finite double: shortest round-trip, `precision` significant
+// digits, or `precision` digits after the decimal point.
+static void number_from_double(Number& num, Double value, bool single, Digits mode, Int32 precision) {
+    num.negative = std::signbit(value);
+    value = std::fabs(value);
+    precision = std::min(precision, MAX_TO_CHARS_PRECISION);
+
+    char buf[Number::MAX_DIGITS + 16];
+    char* end = buf + sizeof(buf);
+    std::to_chars_result res;
+    switch (mode) {
+    case Digits::Shortest:
+        res = single ? std::to_chars(buf, end, static_cast<Single>(value), std::chars_format::scientific)
+                     : std::to_chars(buf, end, value, std::chars_format::scientific);
+        break;
+    case Digits::Significant:
+        res = std::to_chars(buf, end, value, std::chars_format::scientific, std::max(precision, 1) - 1);
+        break;
+    case Digits::Fixed:
+    default:
+        res = std::to_chars(buf, end, value, std::chars_format::fixed, precision);
+        break;
+    }
+
+    // Collect digits without the '.'; the scale follows from where the point
+    // was (fixed) or from the exponent (scientific: d.ddde±XX).
+    char digits[Number::MAX_DIGITS + 16];
+    Int32 n = 0;
+    Int32 point = -1;
+    const char* p = buf;
+    for (; p < res.ptr && *p != 'e'; p++) {
+        if (*p == '.') point = n;
+        else digits[n++] = *p;
+    }
+    Int32 scale;
+    if (mode == Digits::Fixed) {
+        scale = point < 0 ? n : point;
+    } else {
+        Int32 exponent = 0;
+        if (p < res.ptr) std::from_chars(p + (p[1] == '+' ? 2 : 1), res.ptr, exponent);
+        scale = exponent + 1;
+    }
+    set_digits(num, digits, n, scale);
+}
+
+// Round to the first `pos` digits, half away from zero (used for integers,
+// whose digits are exact, and for custom formats).
+static void round_number(Number& num, Int32 pos) {
+    if (pos >= num.count) return;
+    if (pos < 0) {
+        num.count = 0;
+        num.scale = 0;
+        return;
+    }
+    Int32 i = pos;
+    if (num.digits[pos] >= '5') {
+        while (i > 0 && num.digits[i - 1] == '9') i--;
+        if (i == 0) {
+            num.digits[0] = '1';
+            num.count = 1;
+            num.scale++;
+            return;
+        }
+        num.digits[i - 1]++;
+    } else {
+        while (i > 0 && num.digits[i - 1] == '0') i--;
+    }
+    num.count = i;
+    if (i == 0) num.scale = 0;
+}
+
+// ===== Standard layouts =====
+
+static void put_sign(Writer& out, const Number& num) {
+    if (num.negative) out.put(u'-');
+}
+
+static void put_integer_part(Writer& out, const Number& num, bool group) {
+    Int32 n = num.scale;
+    if (n <= 0) {
+        out.put(u'0');
+        return;
+    }
+    for (Int32 i = 0; i < n; i++) {
+        out.put(static_cast<Char>(num.digit(i)));
+        Int32 left = n - 1 - i;
+        if (group && left > 0 && left % 3 == 0) out.put(u',');
+    }
+}
+
+static void put_fixed(Writer& out, const Number& num, Int32 decimals, bool group) {
+    put_integer_part(out, num, group);
+    if (decimals <= 0) return;
+    out.put(u'.');
+    Char* p = out.reserve(decimals);
+    for (Int32 i = 0; i < decimals; i++) p[i] = static_cast<Char>(num.digit(num.scale + i));
+    out.commit(decimals);
+}
+
+static void put_exponent(Writer& out, Int32 exponent, Char e, Int32 min_digits) {
+    out.put(e);
+    if (exponent < 0) {
+        out.put(u'-');
+        exponent = -exponent;
+    } else {
+        out.put(u'+');
+    }
+    char buf[12];
+    Int32 n = format_uint64(buf, static_cast<UInt64>(exponent));
+    out.fill(u'0', min_digits - n);
+    out.put_ascii(buf, n);
+}
+
+// "E": d.ddd…E+xxx with exactly `decimals` decimals.
+static void put_scientific(Writer& out, const Number& num, Int32 decimals, Char e) {
+    out.put(static_cast<Char>(num.digit(0)));
+    if (decimals > 0) {
+        out.put(u'.');
+        for (Int32 i = 1; i <= decimals; i++) out.put(static_cast<Char>(num.digit(i)));
+    }
+    put_exponent(out, num.is_zero() ? 0 : num.scale - 1, e, 3);
+}
+
+// "G": all significant digits, in scientific notation only when the exponent
+// is outside [-5, max_digits).
+static void put_general(Writer& out, const Number& num, Int32 max_digits, Char e) {
+    Int32 scale = num.scale;
+    if (!num.is_zero() && (scale > max_digits || scale < -3)) {
+        out.put(static_cast<Char>(num.digit(0)));
+        if (num.count > 1) {
+            out.put(u'.');
+            for (Int32 i = 1; i < num.count; i++) out.put(static_cast<Char>(num.digits[i]));
+        }
+        put_exponent(out, scale - 1, e, 2);
+        return;
+    }
+    put_integer_part(out, num, false);
+    if (num.count > scale) {
+        out.put(u'.');
+        for (Int32 i = scale; i < num.count; i++) out.put(static_cast<Char>(num.digit(i)));
+    }
+}
+
+// Invariant culture: "¤1,234.50", negative "(¤1,234.50)".
+static void put_currency(Writer& out, const Number& num, Int32 decimals) {
+    if (num.negative) out.put(u'(');
+    out.put(u'\u00A4');
+    put_fixed(out, num, decimals, true);
+    if (num.negative) out.put(u')');
+}
+
+// Invariant culture: "12.50 %".
+static void put_percent(Writer& out, const Number& num, Int32 decimals) {
+    put_sign(out, num);
+    put_fixed(out, num, decimals, true);
+    out.put(u' ');
+    out.put(u'%');
+}
+
+// A standard format is one letter plus an optional precision ("X8", "N2").
+static bool parse_standard(const Char* spec, Int32 len, Char& letter, Int32& precision) {
+    precision = -1;
+    if (len == 0) {
+        letter = u'G';
+        return true;
+    }
+    Char c = spec[0];
+    if (!((c >= u'A' && c <= u'Z') || (c >= u'a' && c <= u'z'))) return false;
+    if (len > 10) return false;
+    if (len > 1) {
+        Int32 p = 0;
+        for (Int32 i = 1; i < len; i++) {
+            if (spec[i] < u'0' || spec[i] > u'9') return false;
+            p = p * 10 + (spec[i] - u'0');
+        }
+        precision = p;
+    }
+    letter = c;
+    return true;
+}
+
+static inline Char exponent_char(Char letter) {
+    return (letter >= u'a' && letter <= u'z') ? u'e' : u'E';
+}
+
+// ===== Custom formats ("0.00", "#,##0", "0.0%;(0.0%);zero") =====
+
+struct Section {
+    const Char* text;
+    Int32 len;
+};
+
+// Split at unquoted ';' into at most three sections.
+static Int32 split_sections(const Char* spec, Int32 len, Section* out) {
+    Int32 count = 0;
+    Int32 start = 0;
+    Char quote = 0;
+    for (Int32 i = 0; i < len; i++) {
+        Char c = spec[i];
+        if (quote) {
+            if (c == quote) quote = 0;
+        } else if (c == u'\'' || c == u'"') {
+            quote = c;
+        } else if (c == u'\\') {
+            i++;
+        } else if (c == u';' && count < 2) {
+            out[count++] = {spec + start, i - start};
+            start = i + 1;
+        }
+    }
+    out[count++] = {spec + start, len - start};
+    return count;
+}
+
+static void format_custom_section(Writer& out, Number& num, Section sec, bool show_sign) {
+    // Pass 1: placeholders, decimal point, grouping/scaling commas, percent.
+    Int32 int_places = 0, first_zero = -1, dec_places = 0, last_zero_dec = 0;
+    Int32 pending_commas = 0, scale_adjust = 0;
+    bool has_point = false, group = false;
+    for (Int32 i = 0; i < sec.len; i++) {
+        Char c = sec.text[i];
+        if (c == u'\'' || c == u'"') {
+            while (++i < sec.len && sec.text[i] != c) {}
+        } else if (c == u'\\') {
+            i++;
+        } else if (c == u'0' || c == u'#') {
+            if (has_point) {
+                dec_places++;
+                if (c == u'0') last_zero_dec = dec_places;
+            } else {
+                if (c == u'0' && first_zero < 0) first_zero = int_places;
+                if (pending_commas > 0 && int_places > 0) group = true;
+                pending_commas = 0;
+                int_places++;
+            }
+        } else if (c == u',') {
+            if (!has_point) pending_commas++;
+        } else if (c == u'.') {
+            if (!has_point) {
+                has_point = true;
+                if (int_places > 0) scale_adjust -= 3 * pending_commas;
+                pending_commas = 0;
+            }
+        } else if (c == u'%') {
+            scale_adjust += 2;
+        }
+    }
+    if (!has_point && int_places > 0) scale_adjust -= 3 * pending_commas;
+
+    if (!num.is_zero()) num.scale += scale_adjust;
+    round_number(num, num.scale + dec_places);
+
+    Int32 min_int = first_zero < 0 ? 0 : int_places - first_zero;
+    Int32 int_digits = std::max(num.scale, min_int);
+    Int32 shown_dec = dec_places;
+    while (shown_dec > last_zero_dec && num.digit(num.scale + shown_dec - 1) == '0') shown_dec--;
+
+    if (show_sign && !num.is_zero()) out.put(u'-');
+
+    // Pass 2: layout. The first integer placeholder also emits any digits
+    // beyond the placeholder count.
+    auto put_int_digit = [&](Int32 pos) {
+        out.put(static_cast<Char>(num.digit(num.scale - 1 - pos)));
+        if (group && pos > 0 && pos % 3 == 0) out.put(u',');
+    };
+    Int32 int_seen = 0, dec_seen = 0;
+    bool in_decimals = false;
+    for (Int32 i = 0; i < sec.len; i++) {
+        Char c = sec.text[i];
+        if (c == u'\'' || c == u'"') {
+            while (++i < sec.len && sec.text[i] != c) out.put(sec.text[i]);
+        } else if (c == u'\\') {
+            if (++i < sec.len) out.put(sec.text[i]);
+        } else if (c == u'0' || c == u'#') {
+            if (in_decimals) {
+                if (dec_seen < shown_dec) out.put(static_cast<Char>(num.digit(num.scale + dec_seen)));
+                dec_seen++;
+            } else {
+                Int32 pos = int_places - 1 - int_seen;
+                if (int_seen == 0) {
+                    for (Int32 extra = int_digits - 1; extra > pos; extra--) put_int_digit(extra);
+                }
+                if (pos < int_digits) put_int_digit(pos);
+                int_seen++;
+            }
+        } else if (c == u'.') {
+            if (!in_decimals) {
+                in_decimals = true;
+                if (shown_dec > 0) out.put(u'.');
+            }
+        } else if (c == u',') {
+            // grouping / scaling: consumed in pass 1
+        } else {
+            out.put(c);
+        }
+    }
+}
+
+static void format_custom(Writer& out, Number& num, const Char* spec, Int32 len) {
+    Section sections[3];
+    Int32 count = split_sections(spec, len, sections);
+    Int32 which = 0;
+    if (num.negative && !num.is_zero() && count >= 2) which = 1;
+    else if (num.is_zero() && count >= 3) which = 2;
+    if (sections[which].len == 0) which = 0;
+    // A dedicated negative section supplies its own sign.
+    format_custom_section(out, num, sections[which], which == 0 && num.negative);
+}
+
+// ===== Integers =====
+
+static void format_integer(Writer& out, UInt64 bits, bool is_signed, Int32 size,
+                           const Char* spec, Int32 len) {
+    bool negative = is_signed && static_cast<Int64>(bits) < 0;
+    UInt64 mag = negative ? 0 - bits : bits;
+
+    Char letter;
+    Int32 precision;
+    if (!parse_standard(spec, len, letter, precision)) {
+        Number num;
+        number_from_integer(num, mag, negative);
+        format_custom(out, num, spec, len);
+        return;
+    }
+
+    Number num;
+    switch (letter) {
+    case u'G': case u'g':
+        if (precision <= 0) break;  // same as D
+        number_from_integer(num, mag, negative);
+        round_number(num, precision);
+        put_sign(out, num);
+        put_general(out, num, precision, exponent_char(letter));
+        return;
+    case u'D': case u'd':
+        break;
+    case u'X': case u'x': {
+        if (size < 8) bits &= (UInt64{1} << (size * 8)) - 1;
+        const char* hex = letter == u'X' ? "0123456789ABCDEF" : "0123456789abcdef";
+        Char buf[16];
+        Int32 n = 0;
+        do {
+            buf[15 - n++] = static_cast<Char>(hex[bits & 0xF]);
+            bits >>= 4;
+        } while (bits != 0);
+        out.fill(u'0', precision - n);
+        out.put(buf + 16 - n, n);
+        return;
+    }
+    case u'N': case u'n':
+        number_from_integer(num, mag, negative);
+        put_sign(out, num);
+        put_fixed(out, num, precision < 0 ? 2 : precision, true);
+        return;
+    case u'F': case u'f':
+        number_from_integer(num, mag, negative);
+        put_sign(out, num);
+        put_fixed(out, num, precision < 0 ? 2 : precision, false);
+        return;
+    case u'E': case u'e':
+        if (precision < 0) precision = 6;
+        number_from_integer(num, mag, negative);
+        round_number(num, precision + 1);
+        put_sign(out, num);
+        put_scientific(out, num, precision, exponent_char(letter));
+        return;
+    case u'P': case u'p':
+        number_from_integer(num, mag, negative);
+        if (!num.is_zero()) num.scale += 2;
+        put_percent(out, num, precision < 0 ? 2 : precision);
+        return;
+    case u'C': case u'c':
+        number_from_integer(num, mag, negative);
+        put_currency(out, num, precision < 0 ? 2 : precision);
+        return;
+    default:
+        throw_format();
+    }
+
+    // Decimal digits, at least `precision` of them
+    Int32 n = count_digits(mag);
+    if (negative) out.put(u'-');
+    out.fill(u'0', precision - n);
+    Char* p = out.reserve(n);
+    write_digits_backward(p + n, mag);
+    out.commit(n);
+}
+
+// ===== Floating point =====
+
+static void put_non_finite(Writer& out, Double value) {
+    if (std::isnan(value)) out.put_ascii("NaN", 3);
+    else if (value < 0) out.put_ascii("-Infinity", 9);
+    else out.put_ascii("Infinity", 8);
+}
+
+// .NET switches "G" to scientific notation once the exponent reaches
+// max(digit count, 15) for double (7 for float).
+static inline Int32 general_digits(const Number& num, bool single) {
+    return std::max(num.count, single ? 7 : 15);
+}
+
+static void format_floating(Writer& out, Double value, bool single, const Char* spec, Int32 len) {
+    if (!std::isfinite(value)) {
+        put_non_finite(out, value);
+        return;
+    }
+
+    Char letter;
+    Int32 precision;
+    Number num;
+    if (!parse_standard(spec, len, letter, precision)) {
+        // Custom formats see 15 (double) / 7 (float) significant digits
+        number_from_double(num, value, single, Digits::Significant, single ? 7 : 15);
+        format_custom(out, num, spec, len);
+        return;
+    }
+
+    switch (letter) {
+    case u'R': case u'r':
+        precision = -1;
+        [[fallthrough]];
+    case u'G': case u'g':
+        if (precision <= 0) {
+            number_from_double(num, value, single, Digits::Shortest, 0);
+            put_sign(out, num);
+            put_general(out, num, general_digits(num, single), exponent_char(letter));
+        } else {
+            number_from_double(num, value, single, Digits::Significant, precision);
+            put_sign(out, num);
+            put_general(out, num, precision, exponent_char(letter));
+        }
+        return;
+    case u'F': case u'f':
+    case u'N': case u'n':
+        if (precision < 0) precision = 2;
+        number_from_double(num, value, single, Digits::Fixed, precision);
+        put_sign(out, num);
+        put_fixed(out, num, precision, letter == u'N' || letter == u'n');
+        return;
+    case u'E': case u'e':
+        if (precision < 0) precision = 6;
+        number_from_double(num, value, single, Digits::Significant, precision + 1);
+        put_sign(out, num);
+        put_scientific(out, num, precision, exponent_char(letter));
+        return;
+    case u'P': case u'p':
+        if (precision < 0) precision = 2;
+        number_from_double(num, value, single, Digits::Fixed, precision + 2);
+        if (!num.is_zero()) num.scale += 2;
+        put_percent(out, num, precision);
+        return;
+    case u'C': case u'c':
+        if (precision < 0) precision = 2;
+        number_from_double(num, value, single, Digits::Fixed, precision);
+        put_currency(out, num, precision);
+        return;
+    default:
+        throw_format();
+    }
+}
+
+// Default ToString() of a double/float into ASCII.
+static Int32 format_floating_ascii(char* out, Double value, bool single) {
+    Writer w;
+    format_floating(w, value, single, nullptr, 0);
+    for (Int32 i = 0; i < w.size(); i++) out[i] = static_cast<char>(w.data()[i]);
+    return w.size();
+}
+
+Int32 format_double(char* out, Double value) {
+    return format_floating_ascii(out, value, false);
+}
+
+Int32 format_single(char* out, Single value) {
+    return format_floating_ascii(out, value, true);
+}
+
+// ===== Writer =====
+
+Writer::~Writer() = default;
+
+void Writer::grow(Int32 n) {
+    Int64 needed = static_cast<Int64>(len_) + n;
+    if (needed > INT32_MAX) throw_overflow();
+    Int64 cap = std::max<Int64>(needed, static_cast<Int64>(cap_) * 2);
+    cap = std::min<Int64>(cap, INT32_MAX);
+    // Spill storage is a GC string: an exception unwinding past the Writer
+    // (longjmp, no destructors) leaves nothing to free.
+    Char* bigger = string_fast_allocate(static_cast<Int32>(cap))->chars;
+    std::memcpy(bigger, buf_, static_cast<size_t>(len_) * sizeof(Char));
+    buf_ = bigger;
+    cap_ = static_cast<Int32>(cap);
+}
+
+void Writer::put(const Char* s, Int32 n) {
+    if (n <= 0) return;
+    std::memcpy(reserve(n), s, static_cast<size_t>(n) * sizeof(Char));
+    len_ += n;
+}
+
+void Writer::put_ascii(const char* s, Int32 n) {
+    if (n <= 0) return;
+    Char* p = reserve(n);
+    for (Int32 i = 0; i < n; i++) p[i] = static_cast<Char>(static_cast<unsigned char>(s[i]));
+    len_ += n;
+}
+
+void Writer::fill(Char c, Int32 n) {
+    if (n <= 0) return;
+    Char* p = reserve(n);
+    std::fill(p, p + n, c);
+    len_ += n;
+}
+
+void Writer::insert_fill(Int32 pos, Char c, Int32 n) {
+    if (n <= 0) return;
+    reserve(n);
+    std::memmove(buf_ + pos + n, buf_ + pos, static_cast<size_t>(len_ - pos) * sizeof(Char));
+    std::fill(buf_ + pos, buf_ + pos + n, c);
+    len_ += n;
+}
+
+String* Writer::to_string() const {
+    String* result = string_fast_allocate(len_);
+    std::memcpy(result->chars, buf_, static_cast<size_t>(len_) * sizeof(Char));
+    return result;
+}
+
+// ===== Values =====
+
+// Object.ToString() through the vtable (slot 0) for reference types, so
+// overrides are honored; value types and vtable-less objects use the default.
+static String* object_string_value(Object* obj) {
+    TypeInfo* type = obj->__type_info;
+    if (type == &System::String_TypeInfo) return reinterpret_cast<String*>(obj);
+    if (type && !(type->flags & TypeFlags::ValueType) && type->vtable
+        && type->vtable->method_count > 0 && type->vtable->methods[0]) {
+        return reinterpret_cast<String* (*)(Object*)>(type->vtable->methods[0])(obj);
+    }
+    return object_to_string(obj);
+}
+
+void format_value(Writer& out, const FormatArg& arg, const Char* spec, Int32 spec_len) {
+    switch (arg.kind) {
+    case FormatArg::Kind::Signed:
+        format_integer(out, static_cast<UInt64>(arg.i), true, arg.size, spec, spec_len);
+        return;
+    case FormatArg::Kind::Unsigned:
+        format_integer(out, arg.u, false, arg.size, spec, spec_len);
+        return;
+    case FormatArg::Kind::Double:
+        format_floating(out, arg.d, false, spec, spec_len);
+        return;
+    case FormatArg::Kind::Single:
+        format_floating(out, arg.f, true, spec, spec_len);
+        return;
+    case FormatArg::Kind::Boolean:
+        if (arg.b) out.put_ascii("True", 4);
+        else out.put_ascii("False", 5);
+        return;
+    case FormatArg::Kind::Char:
+        out.put(arg.c);
+        return;
+    case FormatArg::Kind::Object:
+        break;
+    }
+
+    Object* obj = arg.object;
+    if (!obj) return;
+    if (obj->__type_info && (obj->__type_info->flags & TypeFlags::Primitive)) {
+        FormatArg unboxed = FormatArg::from_object(obj);
+        if (unboxed.kind != FormatArg::Kind::Object) {
+            format_value(out, unboxed, spec, spec_len);
+            return;
+        }
+    }
+    String* s = object_string_value(obj);
+    if (s) out.put(s->chars, s->length);
+}
+
+// ===== Composite =====
+
+static inline bool is_digit(Char c) { return c >= u'0' && c <= u'9'; }
+
+template<typename GetArg>
+static void composite_impl(Writer& out, String* format, Int32 count, GetArg get_arg) {
+    if (!format) throw_argument_null();
+    const Char* s = format->chars;
+    const Int32 n = format->length;
+    Int32 i = 0;
+    while (i < n) {
+        // Copy the literal run up to the next brace in one go
+        Int32 run = i;
+        while (run < n && s[run] != u'{' && s[run] != u'}') run++;
+        out.put(s + i, run - i);
+        i = run;
+        if (i >= n) break;
+
+        Char brace = s[i];
+        if (i + 1 < n && s[i + 1] == brace) {  // "{{" or "}}"
+            out.put(brace);
+            i += 2;
+            continue;
+        }
+        if (brace == u'}') throw_format();
+
+        // {index[,alignment][:formatString]}
+        i++;
+        if (i >= n || !is_digit(s[i])) throw_format();
+        Int32 index = 0;
+        while (i < n && is_digit(s[i])) {
+            index = index * 10 + (s[i] - u'0');
+            if (index >= 1000000) throw_format();
+            i++;
+        }
+        while (i < n && s[i] == u' ') i++;
+
+        Int32 alignment = 0;
+        if (i < n && s[i] == u',') {
+            i++;
+            while (i < n && s[i] == u' ') i++;
+            bool left = false;
+            if (i < n && s[i] == u'-') {
+                left = true;
+                i++;
+            }
+            if (i >= n || !is_digit(s[i])) throw_format();
+            while (i < n && is_digit(s[i])) {
+                alignment = alignment * 10 + (s[i] - u'0');
+                if (alignment >= 1000000) throw_format();
+                i++;
+            }
+            if (left) alignment = -alignment;
+            while (i < n && s[i] == u' ') i++;
+        }
+
+        const Char* spec = nullptr;
+        Int32 spec_len = 0;
+        if (i < n && s[i] == u':') {
+            spec = s + ++i;
+            while (i < n && s[i] != u'}') {
+                if (s[i] == u'{') throw_format();
+                i++;
+            }
+            spec_len = static_cast<Int32>(s + i - spec);
+        }
+        if (i >= n || s[i] != u'}') throw_format();
+        i++;
+
+        if (index >= count) throw_format();
+
+        Int32 start = out.size();
+        format_value(out, get_arg(index), spec, spec_len);
+        Int32 pad = (alignment < 0 ? -alignment : alignment) - (out.size() - start);
+        if (pad > 0) {
+            if (alignment > 0) out.insert_fill(start, u' ', pad);
+            else out.fill(u' ', pad);
+        }
+    }
+}
+
+void composite(Writer& out, String* format, const FormatArg* args, Int32 count) {
+    composite_impl(out, format, count, [args](Int32 i) -> const FormatArg& { return args[i]; });
+}
+
+void composite(Writer& out, String* format, Array* args) {
+    Int32 count = args ? args->length : 0;
+    Object** items = args ? static_cast<Object**>(array_data(args)) : nullptr;
+    composite_impl(out, format, count, [items](Int32 i) { return FormatArg(items[i]); });
+}
+
+} // namespace format
+
+// ===== FormatArg =====
+
+FormatArg FormatArg::from_object(Object* obj) {
+    if (!obj || !obj->__type_info || !(obj->__type_info->flags & TypeFlags::Primitive)
+        || !obj->__type_info->full_name) {
+        return FormatArg(obj);
+    }
+    const char* name = obj->__type_info->full_name;
+    if (std::strncmp(name, "System.", 7) != 0) return FormatArg(obj);
+    name += 7;
+    const void* payload = reinterpret_cast<const char*>(obj) + sizeof(Object);
+    auto read = [payload](auto tag) {
+        decltype(tag) v;
+        std::memcpy(&v, payload, sizeof(v));
+        return v;
+    };
+    if (!std::strcmp(name, "Int32")) return FormatArg(read(Int32{}));
+    if (!std::strcmp(name, "Int64")) return FormatArg(read(Int64{}));
+    if (!std::strcmp(name, "Double")) return FormatArg(read(Double{}));
+    if (!std::strcmp(name, "Boolean")) return FormatArg(read(Boolean{}));
+    if (!std::strcmp(name, "Char")) return FormatArg(read(Char{}));
+    if (!std::strcmp(name, "Single")) return FormatArg(read(Single{}));
+    if (!std::strcmp(name, "UInt32")) return FormatArg(read(UInt32{}));
+    if (!std::strcmp(name, "UInt64")) return FormatArg(read(UInt64{}));
+    if (!std::strcmp(name, "Int16")) return FormatArg(read(Int16{}));
+    if (!std::strcmp(name, "UInt16")) return FormatArg(read(UInt16{}));
+    if (!std::strcmp(name, "Byte")) return FormatArg(read(Byte{}));
+    if (!std::strcmp(name, "SByte")) return FormatArg(read(SByte{}));
+    if (!std::strcmp(name, "IntPtr")) return FormatArg(read(IntPtr{}));
+    if (!std::strcmp(name, "UIntPtr")) return FormatArg(read(UIntPtr{}));
+    return FormatArg(obj);
+}
+
+String* string_format(String* format, const FormatArg* args, Int32 count) {
+    format::Writer out;
+    format::composite(out, format, args, count);
+    return out.to_string();
+}
+
+} // namespace cil2cpp
@@ -0,0 +1,646 @@
+/**
+ * CIL2CPP Runtime - System.Text.StringBuilder Implementation
+ *
+ * See string_builder.h for the chunk layout. Appends never move existing
+ * characters; operations that need the contents contiguous (Insert, Remove,
+ * Replace, writing into a shared chunk) first collapse the builder into a
+ * single writable chunk.
+ */
+
+#include <cil2cpp/string_builder.h>
+#include <cil2cpp/bcl/System.String.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/format.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/string_search.h>
+#include <cil2cpp/type_info.h>
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cstring>
+
+namespace cil2cpp {
+
+static constexpr Int32 DEFAULT_CAPACITY = 16;
+
+// Growth is geometric (a new chunk is as large as the builder so far) but
+// capped, so a huge builder never over-allocates by more than one chunk.
+static constexpr Int32 MAX_CHUNK_CHARS = 1 << 20;
+
+// ToString() hands a single chunk's buffer out as the result only when at
+// least half of it is used; otherwise copying into an exact-size string
+// wastes less memory than keeping the slack alive.
+static inline bool can_hand_out(const StringBuilderChunk* c) {
+    if (c->previous) return false;
+    if (c->shared) return c->length == c->buffer->length;
+    return c->length > 0 && c->length >= c->capacity / 2;
+}
+
+static inline void check_builder(StringBuilder* sb) {
+    if (!sb) throw_null_reference();
+}
+
+static inline Int32 tail_room(const StringBuilderChunk* c) {
+    return c->shared ? 0 : c->capacity - c->length;
+}
+
+static StringBuilderChunk* chunk_create(StringBuilderChunk* previous, Int32 offset, Int32 capacity) {
+    auto* c = static_cast<StringBuilderChunk*>(gc::alloc(sizeof(StringBuilderChunk), nullptr));
+    c->previous = previous;
+    c->buffer = string_fast_allocate(capacity);
+    c->length = 0;
+    c->capacity = capacity;
+    c->offset = offset;
+    c->shared = false;
+    return c;
+}
+
+// Capacity for a chunk that must hold `needed` more characters.
+static Int32 next_chunk_capacity(StringBuilder* sb, Int32 needed) {
+    Int32 cap = std::min(sb->length, MAX_CHUNK_CHARS);
+    cap = std::max(cap, needed);
+    cap = std::max(cap, DEFAULT_CAPACITY);
+    return std::min(cap, sb->max_capacity - sb->length);
+}
+
+// Capacity for a single chunk that must hold `needed` characters in total.
+static Int32 next_total_capacity(StringBuilder* sb, Int32 needed) {
+    Int64 cap = std::max<Int64>(needed, 2LL * sb->length);
+    cap = std::max<Int64>(cap, DEFAULT_CAPACITY);
+    return static_cast<Int32>(std::min<Int64>(cap, sb->max_capacity));
+}
+
+static inline void check_growth(StringBuilder* sb, Int32 count) {
+    if (count > sb->max_capacity - sb->length) throw_argument_out_of_range();
+}
+
+// Copy characters [start, start + count) into dst.
+static void copy_range(StringBuilder* sb, Int32 start, Int32 count, Char* dst) {
+    Int32 end = start + count;
+    for (StringBuilderChunk* c = sb->chunk; c && count > 0; c = c->previous) {
+        Int32 lo = std::max(start, c->offset);
+        Int32 hi = std::min(end, c->offset + c->length);
+        if (lo < hi) {
+            std::memcpy(dst + (lo - start), c->buffer->chars + (lo - c->offset),
+                        static_cast<size_t>(hi - lo) * sizeof(Char));
+        }
+        if (c->offset <= start) break;
+    }
+}
+
+// Replace all chunks by one writable chunk of the given capacity.
+static StringBuilderChunk* reallocate_single(StringBuilder* sb, Int32 capacity) {
+    StringBuilderChunk* c = chunk_create(nullptr, 0, capacity);
+    copy_range(sb, 0, sb->length, c->buffer->chars);
+    c->length = sb->length;
+    sb->chunk = c;
+    return c;
+}
+
+// The builder as one writable chunk with at least `extra` free characters.
+// A shared chunk is always copied, even for extra == 0: its buffer is a
+// String that ToString() already returned.
+static StringBuilderChunk* ensure_contiguous(StringBuilder* sb, Int32 extra) {
+    StringBuilderChunk* c = sb->chunk;
+    if (!c->previous && !c->shared && tail_room(c) >= extra) return c;
+    return reallocate_single(sb, next_total_capacity(sb, sb->length + extra));
+}
+
+// The chunk containing character `index` (0 <= index < length).
+static inline StringBuilderChunk* find_chunk(StringBuilder* sb, Int32 index) {
+    StringBuilderChunk* c = sb->chunk;
+    while (index < c->offset) c = c->previous;
+    return c;
+}
+
+// ===== Construction =====
+
+StringBuilder* string_builder_create(Int32 capacity, Int32 max_capacity) {
+    if (max_capacity < 1 || capacity > max_capacity) throw_argument_out_of_range();
+    if (capacity < 0) throw_argument_out_of_range();
+    if (capacity == 0) capacity = std::min(DEFAULT_CAPACITY, max_capacity);
+
+    auto* sb = static_cast<StringBuilder*>(gc::alloc(sizeof(StringBuilder), &StringBuilder_TypeInfo));
+    sb->chunk = chunk_create(nullptr, 0, capacity);
+    sb->length = 0;
+    sb->max_capacity = max_capacity;
+    return sb;
+}
+
+StringBuilder* string_builder_create(Int32 capacity) {
+    if (capacity < 0) throw_argument_out_of_range();
+    return string_builder_create(capacity, INT32_MAX);
+}
+
+StringBuilder* string_builder_create(String* value, Int32 capacity) {
+    if (capacity < 0) throw_argument_out_of_range();
+    Int32 len = value ? value->length : 0;
+    StringBuilder* sb = string_builder_create(std::max({capacity, len, DEFAULT_CAPACITY}), INT32_MAX);
+    if (len > 0) string_builder_append_chars(sb, value->chars, len);
+    return sb;
+}
+
+// ===== Append =====
+
+StringBuilder* string_builder_append_chars(StringBuilder* sb, const Char* chars, Int32 count) {
+    check_builder(sb);
+    if (count <= 0) return sb;
+
+    StringBuilderChunk* c = sb->chunk;
+    Int32 room = tail_room(c);
+    if (count <= room) {
+        std::memcpy(c->buffer->chars + c->length, chars, static_cast<size_t>(count) * sizeof(Char));
+        c->length += count;
+        sb->length += count;
+        return sb;
+    }
+
+    check_growth(sb, count);
+    if (room > 0) {
+        std::memcpy(c->buffer->chars + c->length, chars, static_cast<size_t>(room) * sizeof(Char));
+        c->length += room;
+        sb->length += room;
+        chars += room;
+        count -= room;
+    }
+    c = chunk_create(c, sb->length, next_chunk_capacity(sb, count));
+    std::memcpy(c->buffer->chars, chars, static_cast<size_t>(count) * sizeof(Char));
+    c->length = count;
+    sb->chunk = c;
+    sb->length += count;
+    return sb;
+}
+
+StringBuilder* string_builder_append(StringBuilder* sb, String* value) {
+    check_builder(sb);
+    if (!value) return sb;
+    return string_builder_append_chars(sb, value->chars, value->length);
+}
+
+StringBuilder* string_builder_append(StringBuilder* sb, String* value, Int32 start, Int32 count) {
+    check_builder(sb);
+    if (start < 0 || count < 0) throw_argument_out_of_range();
+    if (!value) {
+        if (start == 0 && count == 0) return sb;
+        throw_argument_null();
+    }
+    if (start > value->length - count) throw_argument_out_of_range();
+    return string_builder_append_chars(sb, value->chars + start, count);
+}
+
+StringBuilder* string_builder_append_char(StringBuilder* sb, Char value) {
+    check_builder(sb);
+    StringBuilderChunk* c = sb->chunk;
+    if (tail_room(c) > 0) {
+        c->buffer->chars[c->length++] = value;
+        sb->length++;
+        return sb;
+    }
+    return string_builder_append_chars(sb, &value, 1);
+}
+
+StringBuilder* string_builder_append_char(StringBuilder* sb, Char value, Int32 repeat_count) {
+    check_builder(sb);
+    if (repeat_count < 0) throw_argument_out_of_range();
+    check_growth(sb, repeat_count);
+
+    while (repeat_count > 0) {
+        StringBuilderChunk* c = sb->chunk;
+        Int32 room = tail_room(c);
+        if (room == 0) {
+            c = chunk_create(c, sb->length, next_chunk_capacity(sb, repeat_count));
+            sb->chunk = c;
+            room = c->capacity;
+        }
+        Int32 take = std::min(room, repeat_count);
+        std::fill_n(c->buffer->chars + c->length, take, value);
+        c->length += take;
+        sb->length += take;
+        repeat_count -= take;
+    }
+    return sb;
+}
+
+StringBuilder* string_builder_append_char_array(StringBuilder* sb, Array* value) {
+    check_builder(sb);
+    if (!value) return sb;
+    return string_builder_append_chars(sb, static_cast<const Char*>(array_data(value)), value->length);
+}
+
+StringBuilder* string_builder_append_char_array(StringBuilder* sb, Array* value, Int32 start, Int32 count) {
+    check_builder(sb);
+    if (start < 0 || count < 0) throw_argument_out_of_range();
+    if (!value) {
+        if (start == 0 && count == 0) return sb;
+        throw_argument_null();
+    }
+    if (start > value->length - count) throw_argument_out_of_range();
+    return string_builder_append_chars(sb, static_cast<const Char*>(array_data(value)) + start, count);
+}
+
+// Numbers are formatted with std::to_chars into a stack buffer and widened
+// straight into the builder — no temporary String.
+template<typename T>
+static StringBuilder* append_number(StringBuilder* sb, T value) {
+    check_builder(sb);
+    char digits[32];
+    auto res = std::to_chars(digits, digits + sizeof(digits), value);
+    Int32 n = static_cast<Int32>(res.ptr - digits);
+
+    StringBuilderChunk* c = sb->chunk;
+    if (tail_room(c) >= n) {
+        Char* dst = c->buffer->chars + c->length;
+        for (Int32 i = 0; i < n; i++) dst[i] = static_cast<Char>(digits[i]);
+        c->length += n;
+        sb->length += n;
+        return sb;
+    }
+    Char wide[32];
+    for (Int32 i = 0; i < n; i++) wide[i] = static_cast<Char>(digits[i]);
+    return string_builder_append_chars(sb, wide, n);
+}
+
+StringBuilder* string_builder_append_int32(StringBuilder* sb, Int32 value) {
+    return append_number(sb, value);
+}
+
+StringBuilder* string_builder_append_uint32(StringBuilder* sb, UInt32 value) {
+    return append_number(sb, value);
+}
+
+StringBuilder* string_builder_append_int64(StringBuilder* sb, Int64 value) {
+    return append_number(sb, value);
+}
+
+StringBuilder* string_builder_append_uint64(StringBuilder* sb, UInt64 value) {
+    return append_number(sb, value);
+}
+
+StringBuilder* string_builder_append_double(StringBuilder* sb, Double value) {
+    check_builder(sb);
+    char digits[format::MAX_NUMBER_CHARS];
+    Int32 n = format::format_double(digits, value);
+    Char wide[format::MAX_NUMBER_CHARS];
+    for (Int32 i = 0; i < n; i++) wide[i] = static_cast<Char>(digits[i]);
+    return string_builder_append_chars(sb, wide, n);
+}
+
+StringBuilder* string_builder_append_single(StringBuilder* sb, Single value) {
+    check_builder(sb);
+    char digits[format::MAX_NUMBER_CHARS];
+    Int32 n = format::format_single(digits, value);
+    Char wide[format::MAX_NUMBER_CHARS];
+    for (Int32 i = 0; i < n; i++) wide[i] = static_cast<Char>(digits[i]);
+    return string_builder_append_chars(sb, wide, n);
+}
+
+StringBuilder* string_builder_append_bool(StringBuilder* sb, Boolean value) {
+    static const Char TRUE_CHARS[] = u"True";
+    static const Char FALSE_CHARS[] = u"False";
+    return value ? string_builder_append_chars(sb, TRUE_CHARS, 4)
+                 : string_builder_append_chars(sb, FALSE_CHARS, 5);
+}
+
+StringBuilder* string_builder_append_object(StringBuilder* sb, Object* value) {
+    check_builder(sb);
+    if (!value) return sb;
+    if (value->__type_info == &System::String_TypeInfo) {
+        return string_builder_append(sb, reinterpret_cast<String*>(value));
+    }
+    if (value->__type_info == &StringBuilder_TypeInfo) {
+        return string_builder_append_builder(sb, reinterpret_cast<StringBuilder*>(value));
+    }
+    return string_builder_append(sb, object_to_string(value));
+}
+
+// Append chunks oldest-first. Each level records its length before recursing,
+// so appending a builder to itself copies exactly the original contents.
+static void append_chunks(StringBuilder* sb, StringBuilderChunk* c) {
+    if (!c) return;
+    Int32 len = c->length;
+    const Char* chars = c->buffer->chars;
+    append_chunks(sb, c->previous);
+    string_builder_append_chars(sb, chars, len);
+}
+
+StringBuilder* string_builder_append_builder(StringBuilder* sb, StringBuilder* value) {
+    check_builder(sb);
+    if (!value || value->length == 0) return sb;
+    check_growth(sb, value->length);
+    append_chunks(sb, value->chunk);
+    return sb;
+}
+
+StringBuilder* string_builder_append_line(StringBuilder* sb) {
+#ifdef _WIN32
+    return string_builder_append_chars(sb, u"\r\n", 2);
+#else
+    return string_builder_append_char(sb, u'\n');
+#endif
+}
+
+StringBuilder* string_builder_append_line(StringBuilder* sb, String* value) {
+    string_builder_append(sb, value);
+    return string_builder_append_line(sb);
+}
+
+// Expanded into a stack-backed buffer, then copied into the builder once.
+StringBuilder* string_builder_append_format(StringBuilder* sb, String* format, Array* args) {
+    check_builder(sb);
+    format::Writer out;
+    format::composite(out, format, args);
+    return string_builder_append_chars(sb, out.data(), out.size());
+}
+
+StringBuilder* string_builder_append_format(StringBuilder* sb, String* format,
+                                            const FormatArg* args, Int32 count) {
+    check_builder(sb);
+    format::Writer out;
+    format::composite(out, format, args, count);
+    return string_builder_append_chars(sb, out.data(), out.size());
+}
+
+// ===== Editing =====
+
+StringBuilder* string_builder_insert(StringBuilder* sb, Int32 index, String* value) {
+    check_builder(sb);
+    if (index < 0 || index > sb->length) throw_argument_out_of_range();
+    if (!value || value->length == 0) return sb;
+    if (index == sb->length) return string_builder_append(sb, value);
+
+    Int32 n = value->length;
+    check_growth(sb, n);
+    StringBuilderChunk* c = ensure_contiguous(sb, n);
+    Char* data = c->buffer->chars;
+    std::memmove(data + index + n, data + index, static_cast<size_t>(sb->length - index) * sizeof(Char));
+    std::memcpy(data + index, value->chars, static_cast<size_t>(n) * sizeof(Char));
+    c->length += n;
+    sb->length += n;
+    return sb;
+}
+
+StringBuilder* string_builder_insert_char(StringBuilder* sb, Int32 index, Char value) {
+    check_builder(sb);
+    if (index < 0 || index > sb->length) throw_argument_out_of_range();
+    if (index == sb->length) return string_builder_append_char(sb, value);
+
+    check_growth(sb, 1);
+    StringBuilderChunk* c = ensure_contiguous(sb, 1);
+    Char* data = c->buffer->chars;
+    std::memmove(data + index + 1, data + index, static_cast<size_t>(sb->length - index) * sizeof(Char));
+    data[index] = value;
+    c->length++;
+    sb->length++;
+    return sb;
+}
+
+StringBuilder* string_builder_remove(StringBuilder* sb, Int32 start, Int32 count) {
+    check_builder(sb);
+    if (start < 0 || count < 0 || start > sb->length - count) throw_argument_out_of_range();
+    if (count == 0) return sb;
+    if (start + count == sb->length) {
+        string_builder_set_length(sb, start);
+        return sb;
+    }
+
+    StringBuilderChunk* c = ensure_contiguous(sb, 0);
+    Char* data = c->buffer->chars;
+    std::memmove(data + start, data + start + count,
+                 static_cast<size_t>(sb->length - start - count) * sizeof(Char));
+    c->length -= count;
+    sb->length -= count;
+    return sb;
+}
+
+StringBuilder* string_builder_replace(StringBuilder* sb, String* old_value, String* new_value,
+                                      Int32 start, Int32 count) {
+    check_builder(sb);
+    if (start < 0 || count < 0 || start > sb->length - count) throw_argument_out_of_range();
+    if (!old_value) throw_argument_null();
+    if (old_value->length == 0) throw_argument();
+
+    Int32 old_len = old_value->length;
+    Int32 new_len = new_value ? new_value->length : 0;
+    Int32 end = start + count;
+    if (count < old_len) return sb;
+
+    StringBuilderChunk* c = ensure_contiguous(sb, 0);
+    Char* data = c->buffer->chars;
+
+    // Same length: overwrite in place.
+    if (old_len == new_len) {
+        Int32 pos = start;
+        while (pos <= end - old_len) {
+            Int32 hit = search::index_of(data + pos, end - pos, old_value->chars, old_len);
+            if (hit < 0) break;
+            std::memcpy(data + pos + hit, new_value->chars, static_cast<size_t>(new_len) * sizeof(Char));
+            pos += hit + old_len;
+        }
+        return sb;
+    }
+
+    // Otherwise count matches, then copy once into a right-sized chunk.
+    Int32 matches = 0;
+    for (Int32 pos = start; pos <= end - old_len; ) {
+        Int32 hit = search::index_of(data + pos, end - pos, old_value->chars, old_len);
+        if (hit < 0) break;
+        matches++;
+        pos += hit + old_len;
+    }
+    if (matches == 0) return sb;
+
+    Int64 result_len = static_cast<Int64>(sb->length) + static_cast<Int64>(matches) * (new_len - old_len);
+    if (result_len > sb->max_capacity) throw_argument_out_of_range();
+
+    Int32 length = static_cast<Int32>(result_len);
+    StringBuilderChunk* out = chunk_create(nullptr, 0, std::max(length, c->capacity));
+    Char* dst = out->buffer->chars;
+    std::memcpy(dst, data, static_cast<size_t>(start) * sizeof(Char));
+    dst += start;
+    Int32 pos = start;
+    for (Int32 i = 0; i < matches; i++) {
+        Int32 hit = search::index_of(data + pos, end - pos, old_value->chars, old_len);
+        std::memcpy(dst, data + pos, static_cast<size_t>(hit) * sizeof(Char));
+        dst += hit;
+        if (new_len > 0) {
+            std::memcpy(dst, new_value->chars, static_cast<size_t>(new_len) * sizeof(Char));
+            dst += new_len;
+        }
+        pos += hit + old_len;
+    }
+    std::memcpy(dst, data + pos, static_cast<size_t>(sb->length - pos) * sizeof(Char));
+
+    out->length = length;
+    sb->chunk = out;
+    sb->length = length;
+    return sb;
+}
+
+StringBuilder* string_builder_replace(StringBuilder* sb, String* old_value, String* new_value) {
+    check_builder(sb);
+    return string_builder_replace(sb, old_value, new_value, 0, sb->length);
+}
+
+StringBuilder* string_builder_replace_char(StringBuilder* sb, Char old_char, Char new_char,
+                                           Int32 start, Int32 count) {
+    check_builder(sb);
+    if (start < 0 || count < 0 || start > sb->length - count) throw_argument_out_of_range();
+    if (count == 0 || old_char == new_char) return sb;
+
+    StringBuilderChunk* c = ensure_contiguous(sb, 0);
+    Char* data = c->buffer->chars;
+    Int32 end = start + count;
+    for (Int32 pos = start; pos < end; ) {
+        Int32 hit = search::index_of_char(data + pos, end - pos, old_char);
+        if (hit < 0) break;
+        data[pos + hit] = new_char;
+        pos += hit + 1;
+    }
+    return sb;
+}
+
+StringBuilder* string_builder_replace_char(StringBuilder* sb, Char old_char, Char new_char) {
+    check_builder(sb);
+    return string_builder_replace_char(sb, old_char, new_char, 0, sb->length);
+}
+
+StringBuilder* string_builder_clear(StringBuilder* sb) {
+    check_builder(sb);
+    StringBuilderChunk* c = sb->chunk;
+    if (!c->previous && !c->shared) {
+        c->length = 0;
+    } else {
+        // Keep roughly the capacity the builder had grown to, in one chunk,
+        // so the next round of appends fits without re-growing.
+        Int32 cap = std::max({std::min(sb->length, MAX_CHUNK_CHARS), c->capacity, DEFAULT_CAPACITY});
+        sb->chunk = chunk_create(nullptr, 0, std::min(cap, sb->max_capacity));
+    }
+    sb->length = 0;
+    return sb;
+}
+
+// ===== Properties =====
+
+void string_builder_set_length(StringBuilder* sb, Int32 length) {
+    check_builder(sb);
+    if (length < 0 || length > sb->max_capacity) throw_argument_out_of_range();
+    if (length > sb->length) {
+        string_builder_append_char(sb, u'\0', length - sb->length);
+        return;
+    }
+
+    StringBuilderChunk* c = sb->chunk;
+    while (c->offset > length) c = c->previous;
+    c->length = length - c->offset;
+    sb->chunk = c;
+    sb->length = length;
+}
+
+Int32 string_builder_get_capacity(StringBuilder* sb) {
+    check_builder(sb);
+    return sb->length + tail_room(sb->chunk);
+}
+
+Int32 string_builder_ensure_capacity(StringBuilder* sb, Int32 capacity) {
+    check_builder(sb);
+    if (capacity < 0) throw_argument_out_of_range();
+    if (string_builder_get_capacity(sb) < capacity) {
+        string_builder_set_capacity(sb, capacity);
+    }
+    return string_builder_get_capacity(sb);
+}
+
+void string_builder_set_capacity(StringBuilder* sb, Int32 capacity) {
+    check_builder(sb);
+    if (capacity < sb->length || capacity > sb->max_capacity) throw_argument_out_of_range();
+    if (capacity > string_builder_get_capacity(sb)) {
+        reallocate_single(sb, capacity);
+    }
+}
+
+Int32 string_builder_get_max_capacity(StringBuilder* sb) {
+    check_builder(sb);
+    return sb->max_capacity;
+}
+
+Char string_builder_get_char(StringBuilder* sb, Int32 index) {
+    check_builder(sb);
+    if (index < 0 || index >= sb->length) throw_index_out_of_range();
+    StringBuilderChunk* c = find_chunk(sb, index);
+    return c->buffer->chars[index - c->offset];
+}
+
+void string_builder_set_char(StringBuilder* sb, Int32 index, Char value) {
+    check_builder(sb);
+    if (index < 0 || index >= sb->length) throw_argument_out_of_range();
+    StringBuilderChunk* c = find_chunk(sb, index);
+    if (c->shared) {
+        c = ensure_contiguous(sb, 0);
+    }
+    c->buffer->chars[index - c->offset] = value;
+}
+
+// ===== Materialization =====
+
+String* string_builder_to_string(StringBuilder* sb) {
+    check_builder(sb);
+    StringBuilderChunk* c = sb->chunk;
+    if (can_hand_out(c)) {
+        c->buffer->length = c->length;
+        c->shared = true;
+        return c->buffer;
+    }
+
+    String* result = string_fast_allocate(sb->length);
+    copy_range(sb, 0, sb->length, result->chars);
+    return result;
+}
+
+String* string_builder_to_string(StringBuilder* sb, Int32 start, Int32 length) {
+    check_builder(sb);
+    if (start < 0 || length < 0 || start > sb->length - length) throw_argument_out_of_range();
+    if (start == 0 && length == sb->length) return string_builder_to_string(sb);
+
+    String* result = string_fast_allocate(length);
+    copy_range(sb, start, length, result->chars);
+    return result;
+}
+
+// ===== Type info =====
+
+static void* g_string_builder_vtable_methods[] = {
+    reinterpret_cast<void*>(static_cast<String* (*)(StringBuilder*)>(&string_builder_to_string)),
+    reinterpret_cast<void*>(&object_equals),
+    reinterpret_cast<void*>(&object_get_hash_code),
+};
+
+static VTable g_string_builder_vtable = {
+    .type = &StringBuilder_TypeInfo,
+    .methods = g_string_builder_vtable_methods,
+    .method_count = 3,
+};
+
+TypeInfo StringBuilder_TypeInfo = {
+    .name = "StringBuilder",
+    .namespace_name = "System.Text",
+    .full_name = "System.Text.StringBuilder",
+    .base_type = &System::Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(StringBuilder),
+    .element_size = 0,
+    .flags = TypeFlags::Sealed,
+    .vtable = &g_string_builder_vtable,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+} // namespace cil2cpp
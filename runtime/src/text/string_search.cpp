@@ -0,0 +1,307 @@
+/**
+ * CIL2CPP Runtime - UTF-16 search and comparison kernels
+ *
+ * Char search broadcasts the target unit and compares 8 (SSE2) or 16 (AVX2)
+ * units per step. Substring search is SIMD-filtered: a position is only a
+ * candidate when both the needle's first and last units match there (two
+ * vector compares at offsets 0 and m-1, ANDed), and only candidates are
+ * verified with memcmp. On text such as logs this skips nearly every
+ * position without touching the middle of the needle.
+ */
+
+#include <cil2cpp/string_search.h>
+#include <cil2cpp/simd.h>
+
+#include <bit>
+#include <cstring>
+
+#if defined(CIL2CPP_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace cil2cpp {
+namespace search {
+
+static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+// ===== Kernels =====
+//
+// find_* return NPOS when nothing is found; mismatch returns n when equal.
+// find_substring requires 2 <= m <= n.
+
+struct ScalarKernels {
+    static inline size_t find_char(const Char* s, size_t n, Char c) {
+        for (size_t i = 0; i < n; i++) {
+            if (s[i] == c) return i;
+        }
+        return NPOS;
+    }
+
+    static inline size_t rfind_char(const Char* s, size_t n, Char c) {
+        while (n > 0) {
+            if (s[--n] == c) return n;
+        }
+        return NPOS;
+    }
+
+    static inline size_t count_char(const Char* s, size_t n, Char c) {
+        size_t count = 0;
+        for (size_t i = 0; i < n; i++) count += (s[i] == c);
+        return count;
+    }
+
+    static inline size_t mismatch(const Char* a, const Char* b, size_t n) {
+        size_t i = 0;
+        while (i < n && a[i] == b[i]) i++;
+        return i;
+    }
+
+    // Candidate positions start at `from`; first/last unit filter, then memcmp.
+    static inline size_t find_substring_from(const Char* h, size_t n, const Char* nd, size_t m,
+                                             size_t from) {
+        const Char first = nd[0];
+        const Char last = nd[m - 1];
+        const size_t mid_bytes = (m - 2) * sizeof(Char);
+        for (size_t i = from; i + m <= n; i++) {
+            if (h[i] == first && h[i + m - 1] == last &&
+                std::memcmp(h + i + 1, nd + 1, mid_bytes) == 0) {
+                return i;
+            }
+        }
+        return NPOS;
+    }
+
+    static inline size_t find_substring(const Char* h, size_t n, const Char* nd, size_t m) {
+        return find_substring_from(h, n, nd, m, 0);
+    }
+};
+
+#if defined(CIL2CPP_SIMD_X86)
+
+struct SSE2Kernels {
+    static inline __m128i load(const Char* p) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static inline size_t find_char(const Char* s, size_t n, Char c) {
+        const __m128i needle = _mm_set1_epi16(static_cast<short>(c));
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi16(load(s + i), needle)));
+            if (m) return i + std::countr_zero(m) / 2;
+        }
+        size_t r = ScalarKernels::find_char(s + i, n - i, c);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    static inline size_t rfind_char(const Char* s, size_t n, Char c) {
+        const __m128i needle = _mm_set1_epi16(static_cast<short>(c));
+        size_t i = n;
+        while (i >= 8) {
+            i -= 8;
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi16(load(s + i), needle)));
+            if (m) return i + (std::bit_width(m) - 1) / 2;
+        }
+        return ScalarKernels::rfind_char(s, i, c);
+    }
+
+    static inline size_t count_char(const Char* s, size_t n, Char c) {
+        const __m128i needle = _mm_set1_epi16(static_cast<short>(c));
+        size_t i = 0;
+        size_t count = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi16(load(s + i), needle)));
+            count += std::popcount(m) / 2;
+        }
+        return count + ScalarKernels::count_char(s + i, n - i, c);
+    }
+
+    static inline size_t mismatch(const Char* a, const Char* b, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi16(load(a + i), load(b + i))));
+            if (m != 0xFFFF) return i + std::countr_zero(~m) / 2;
+        }
+        return i + ScalarKernels::mismatch(a + i, b + i, n - i);
+    }
+
+    static inline size_t find_substring(const Char* h, size_t n, const Char* nd, size_t m) {
+        const __m128i first = _mm_set1_epi16(static_cast<short>(nd[0]));
+        const __m128i last = _mm_set1_epi16(static_cast<short>(nd[m - 1]));
+        const size_t mid_bytes = (m - 2) * sizeof(Char);
+        const size_t positions = n - m + 1;
+        size_t i = 0;
+        for (; i + 8 <= positions; i += 8) {
+            __m128i eq = _mm_and_si128(_mm_cmpeq_epi16(load(h + i), first),
+                                       _mm_cmpeq_epi16(load(h + i + m - 1), last));
+            UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(eq));
+            while (mask) {
+                unsigned bit = static_cast<unsigned>(std::countr_zero(mask));
+                size_t pos = i + bit / 2;
+                if (std::memcmp(h + pos + 1, nd + 1, mid_bytes) == 0) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+        return ScalarKernels::find_substring_from(h, n, nd, m, i);
+    }
+};
+
+// Tails fall back to the SSE2 kernels, which inline into these functions.
+struct AVX2Kernels {
+    CIL2CPP_TARGET_AVX2
+    static inline __m256i load(const Char* p) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_char(const Char* s, size_t n, Char c) {
+        const __m256i needle = _mm256_set1_epi16(static_cast<short>(c));
+        size_t i = 0;
+        // Two vectors per iteration: the OR test keeps the hot loop to one branch
+        for (; i + 32 <= n; i += 32) {
+            __m256i a = _mm256_cmpeq_epi16(load(s + i), needle);
+            __m256i b = _mm256_cmpeq_epi16(load(s + i + 16), needle);
+            if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_or_si256(a, b))) {
+                UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(a));
+                if (m) return i + std::countr_zero(m) / 2;
+                m = static_cast<UInt32>(_mm256_movemask_epi8(b));
+                return i + 16 + std::countr_zero(m) / 2;
+            }
+        }
+        for (; i + 16 <= n; i += 16) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(load(s + i), needle)));
+            if (m) return i + std::countr_zero(m) / 2;
+        }
+        size_t r = SSE2Kernels::find_char(s + i, n - i, c);
+        return r == NPOS ? NPOS : i + r;
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t rfind_char(const Char* s, size_t n, Char c) {
+        const __m256i needle = _mm256_set1_epi16(static_cast<short>(c));
+        size_t i = n;
+        while (i >= 16) {
+            i -= 16;
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(load(s + i), needle)));
+            if (m) return i + (std::bit_width(m) - 1) / 2;
+        }
+        return SSE2Kernels::rfind_char(s, i, c);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t count_char(const Char* s, size_t n, Char c) {
+        const __m256i needle = _mm256_set1_epi16(static_cast<short>(c));
+        size_t i = 0;
+        size_t count = 0;
+        for (; i + 16 <= n; i += 16) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(load(s + i), needle)));
+            count += std::popcount(m) / 2;
+        }
+        return count + SSE2Kernels::count_char(s + i, n - i, c);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t mismatch(const Char* a, const Char* b, size_t n) {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(load(a + i), load(b + i))));
+            if (m != 0xFFFFFFFFu) return i + std::countr_zero(~m) / 2;
+        }
+        return i + SSE2Kernels::mismatch(a + i, b + i, n - i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t find_substring(const Char* h, size_t n, const Char* nd, size_t m) {
+        const __m256i first = _mm256_set1_epi16(static_cast<short>(nd[0]));
+        const __m256i last = _mm256_set1_epi16(static_cast<short>(nd[m - 1]));
+        const size_t mid_bytes = (m - 2) * sizeof(Char);
+        const size_t positions = n - m + 1;
+        size_t i = 0;
+        for (; i + 16 <= positions; i += 16) {
+            __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi16(load(h + i), first),
+                                          _mm256_cmpeq_epi16(load(h + i + m - 1), last));
+            UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(eq));
+            while (mask) {
+                unsigned bit = static_cast<unsigned>(std::countr_zero(mask));
+                size_t pos = i + bit / 2;
+                if (std::memcmp(h + pos + 1, nd + 1, mid_bytes) == 0) return pos;
+                mask &= ~(3u << bit);
+            }
+        }
+        return ScalarKernels::find_substring_from(h, n, nd, m, i);
+    }
+};
+
+#endif // CIL2CPP_SIMD_X86
+
+// ===== Drivers =====
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_char_impl(const Char* s, size_t n, Char c) {
+    return K::find_char(s, n, c);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t rfind_char_impl(const Char* s, size_t n, Char c) {
+    return K::rfind_char(s, n, c);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t count_char_impl(const Char* s, size_t n, Char c) {
+    return K::count_char(s, n, c);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t mismatch_impl(const Char* a, const Char* b, size_t n) {
+    return K::mismatch(a, b, n);
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t find_substring_impl(const Char* h, size_t n,
+                                                      const Char* nd, size_t m) {
+    return K::find_substring(h, n, nd, m);
+}
+
+CIL2CPP_SIMD_ENTRY(size_t, find_char, (const Char* s, size_t n, Char c), (s, n, c))
+CIL2CPP_SIMD_ENTRY(size_t, rfind_char, (const Char* s, size_t n, Char c), (s, n, c))
+CIL2CPP_SIMD_ENTRY(size_t, count_char, (const Char* s, size_t n, Char c), (s, n, c))
+CIL2CPP_SIMD_ENTRY(size_t, mismatch, (const Char* a, const Char* b, size_t n), (a, b, n))
+CIL2CPP_SIMD_ENTRY(size_t, find_substring,
+                   (const Char* h, size_t n, const Char* nd, size_t m), (h, n, nd, m))
+
+// ===== Public API =====
+
+static inline Int32 to_index(size_t r) {
+    return r == NPOS ? -1 : static_cast<Int32>(r);
+}
+
+Int32 index_of_char(const Char* s, Int32 n, Char c) {
+    if (n <= 0) return -1;
+    return to_index(find_char_dispatch(s, static_cast<size_t>(n), c));
+}
+
+Int32 last_index_of_char(const Char* s, Int32 n, Char c) {
+    if (n <= 0) return -1;
+    return to_index(rfind_char_dispatch(s, static_cast<size_t>(n), c));
+}
+
+Int32 count_char(const Char* s, Int32 n, Char c) {
+    if (n <= 0) return 0;
+    return static_cast<Int32>(count_char_dispatch(s, static_cast<size_t>(n), c));
+}
+
+Int32 index_of(const Char* hay, Int32 n, const Char* needle, Int32 m) {
+    if (m <= 0) return 0;
+    if (m > n) return -1;
+    if (m == 1) return index_of_char(hay, n, needle[0]);
+    return to_index(find_substring_dispatch(hay, static_cast<size_t>(n),
+                                            needle, static_cast<size_t>(m)));
+}
+
+Int32 mismatch(const Char* a, const Char* b, Int32 n) {
+    if (n <= 0) return 0;
+    return static_cast<Int32>(mismatch_dispatch(a, b, static_cast<size_t>(n)));
+}
+
+} // namespace search
+} // namespace cil2cpp
@@ -0,0 +1,482 @@
+/**
+ * CIL2CPP Runtime - UTF-8 ⇄ UTF-16 transcoding
+ *
+ * Structure: each conversion alternates between an ASCII kernel that consumes
+ * the longest run of ASCII and a scalar loop that handles non-ASCII code
+ * points until the text turns back into a long ASCII run. Kernels come in three sets (Scalar/SWAR,
+ * SSE2, AVX2); the conversion drivers are templates over a kernel set and are
+ * instantiated once per level, so simd::level() is consulted once per call.
+ *
+ * Length functions share the scalar decoders with Write=false so that the
+ * computed length always matches what the converter produces, including
+ * U+FFFD replacements for ill-formed input.
+ */
+
+#include <cil2cpp/utf.h>
+#include <cil2cpp/simd.h>
+
+#include <bit>
+#include <cstring>
+
+#if defined(CIL2CPP_SIMD_X86)
+#include <immintrin.h>
+#endif
+
+namespace cil2cpp {
+namespace utf {
+
+static constexpr Char REPLACEMENT_CHAR = 0xFFFD;
+
+static inline bool is_high_surrogate(UInt32 c) { return c >= 0xD800 && c <= 0xDBFF; }
+static inline bool is_low_surrogate(UInt32 c) { return c >= 0xDC00 && c <= 0xDFFF; }
+static inline bool is_continuation(Byte b) { return (b & 0xC0) == 0x80; }
+
+// ===== ASCII kernels =====
+//
+// Each kernel works on the longest ASCII prefix of its input and returns its
+// length. widen/narrow also copy that prefix to the destination; they never
+// write past it, so destinations sized exactly for the result are safe.
+
+struct ScalarKernels {
+    static constexpr UInt64 HIGH_BITS_8x8 = 0x8080808080808080ull;
+    static constexpr UInt64 HIGH_BITS_16x4 = 0xFF80FF80FF80FF80ull;
+
+    static inline size_t ascii_prefix_u8(const Byte* s, size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt64 w;
+            std::memcpy(&w, s + i, 8);
+            if (w & HIGH_BITS_8x8) break;
+        }
+        while (i < n && s[i] < 0x80) i++;
+        return i;
+    }
+
+    static inline size_t widen_ascii(const Byte* s, size_t n, Char* d) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            UInt64 w;
+            std::memcpy(&w, s + i, 8);
+            if (w & HIGH_BITS_8x8) break;
+            for (int k = 0; k < 8; k++) d[i + k] = s[i + k];
+        }
+        while (i < n && s[i] < 0x80) {
+            d[i] = s[i];
+            i++;
+        }
+        return i;
+    }
+
+    static inline size_t narrow_ascii(const Char* s, size_t n, Byte* d) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            UInt64 w;
+            std::memcpy(&w, s + i, 8);
+            if (w & HIGH_BITS_16x4) break;
+            for (int k = 0; k < 4; k++) d[i + k] = static_cast<Byte>(s[i + k]);
+        }
+        while (i < n && s[i] < 0x80) {
+            d[i] = static_cast<Byte>(s[i]);
+            i++;
+        }
+        return i;
+    }
+
+    static inline size_t ascii_prefix_u16(const Char* s, size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            UInt64 w;
+            std::memcpy(&w, s + i, 8);
+            if (w & HIGH_BITS_16x4) break;
+        }
+        while (i < n && s[i] < 0x80) i++;
+        return i;
+    }
+
+    // UTF-8 size of a leading surrogate-free block. No block kernel at this
+    // level; the caller's per-unit loop does the counting.
+    static inline size_t utf8_bytes_block(const Char*, size_t, size_t*) {
+        return 0;
+    }
+};
+
+#if defined(CIL2CPP_SIMD_X86)
+
+struct SSE2Kernels {
+    static inline size_t ascii_prefix_u8(const Byte* s, size_t n) {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(v));
+            if (m) return i + std::countr_zero(m);
+        }
+        return i + ScalarKernels::ascii_prefix_u8(s + i, n - i);
+    }
+
+    static inline size_t widen_ascii(const Byte* s, size_t n, Char* d) {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            if (_mm_movemask_epi8(v)) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i + 8), _mm_unpackhi_epi8(v, zero));
+        }
+        return i + ScalarKernels::widen_ascii(s + i, n - i, d + i);
+    }
+
+    static inline size_t narrow_ascii(const Char* s, size_t n, Byte* d) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 8));
+            __m128i hi = _mm_and_si128(_mm_or_si128(a, b), non_ascii);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(hi, zero)) != 0xFFFF) break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_packus_epi16(a, b));
+        }
+        return i + ScalarKernels::narrow_ascii(s + i, n - i, d + i);
+    }
+
+    static inline size_t ascii_prefix_u16(const Char* s, size_t n) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            UInt32 m = static_cast<UInt32>(_mm_movemask_epi8(
+                _mm_cmpeq_epi16(_mm_and_si128(v, non_ascii), zero)));
+            if (m != 0xFFFF) return i + std::countr_zero(~m) / 2;
+        }
+        return i + ScalarKernels::ascii_prefix_u16(s + i, n - i);
+    }
+
+    // UTF-8 size of whole 8-unit blocks that contain no surrogates:
+    // 3 bytes per unit, minus one for each unit < 0x800 and one more for < 0x80.
+    static inline size_t utf8_bytes_block(const Char* s, size_t n, size_t* bytes) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i mask_80 = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i mask_800 = _mm_set1_epi16(static_cast<short>(0xF800));
+        const __m128i surrogate = _mm_set1_epi16(static_cast<short>(0xD800));
+        size_t i = 0;
+        size_t total = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            __m128i top5 = _mm_and_si128(v, mask_800);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(top5, surrogate))) break;
+            UInt32 lt80 = static_cast<UInt32>(_mm_movemask_epi8(
+                _mm_cmpeq_epi16(_mm_and_si128(v, mask_80), zero)));
+            UInt32 lt800 = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi16(top5, zero)));
+            total += 24 - (std::popcount(lt80) + std::popcount(lt800)) / 2;
+        }
+        *bytes += total;
+        return i;
+    }
+};
+
+// Tails fall back to the SSE2 kernels, which inline into these functions and
+// are therefore VEX-encoded as well.
+struct AVX2Kernels {
+    CIL2CPP_TARGET_AVX2
+    static inline size_t ascii_prefix_u8(const Byte* s, size_t n) {
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            UInt32 m = static_cast<UInt32>(_mm256_movemask_epi8(v));
+            if (m) return i + std::countr_zero(m);
+        }
+        return i + SSE2Kernels::ascii_prefix_u8(s + i, n - i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t widen_ascii(const Byte* s, size_t n, Char* d) {
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            if (_mm256_movemask_epi8(v)) break;
+            __m256i lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v));
+            __m256i hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i + 16), hi);
+        }
+        return i + SSE2Kernels::widen_ascii(s + i, n - i, d + i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t narrow_ascii(const Char* s, size_t n, Byte* d) {
+        const __m256i non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 16));
+            if (!_mm256_testz_si256(_mm256_or_si256(a, b), non_ascii)) break;
+            // packus works per 128-bit lane: [a0..7 b0..7 | a8..15 b8..15] → reorder qwords
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), packed);
+        }
+        return i + SSE2Kernels::narrow_ascii(s + i, n - i, d + i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t ascii_prefix_u16(const Char* s, size_t n) {
+        const __m256i non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            if (!_mm256_testz_si256(v, non_ascii)) break;
+        }
+        return i + SSE2Kernels::ascii_prefix_u16(s + i, n - i);
+    }
+
+    CIL2CPP_TARGET_AVX2
+    static inline size_t utf8_bytes_block(const Char* s, size_t n, size_t* bytes) {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i mask_80 = _mm256_set1_epi16(static_cast<short>(0xFF80));
+        const __m256i mask_800 = _mm256_set1_epi16(static_cast<short>(0xF800));
+        const __m256i surrogate = _mm256_set1_epi16(static_cast<short>(0xD800));
+        size_t i = 0;
+        size_t total = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+            __m256i top5 = _mm256_and_si256(v, mask_800);
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(top5, surrogate))) break;
+            UInt32 lt80 = static_cast<UInt32>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi16(_mm256_and_si256(v, mask_80), zero)));
+            UInt32 lt800 = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(top5, zero)));
+            total += 48 - (std::popcount(lt80) + std::popcount(lt800)) / 2;
+        }
+        *bytes += total;
+        return i + SSE2Kernels::utf8_bytes_block(s + i, n - i, bytes);
+    }
+};
+
+#endif // CIL2CPP_SIMD_X86
+
+// ===== Scalar non-ASCII paths =====
+
+// Decode one non-ASCII sequence starting at s[i] (s[i] >= 0x80), advancing i.
+// Ill-formed sequences yield one U+FFFD per maximal invalid subpart
+// (Unicode 15.0 §3.9, "U+FFFD Substitution of Maximal Subparts").
+// Returns the number of UTF-16 units produced (1 or 2).
+template<bool Write>
+static CIL2CPP_FORCE_INLINE size_t decode_one(const Byte* s, size_t n, size_t& i, Char* d) {
+    UInt32 c = s[i];
+
+    // Fast paths: complete, well-formed 2- and 3-byte sequences
+    if (c >= 0xC2 && c <= 0xDF && i + 1 < n && is_continuation(s[i + 1])) {
+        if constexpr (Write) d[0] = static_cast<Char>(((c & 0x1F) << 6) | (s[i + 1] & 0x3F));
+        i += 2;
+        return 1;
+    }
+    if ((c & 0xF0) == 0xE0 && i + 2 < n &&
+        is_continuation(s[i + 1]) && is_continuation(s[i + 2])) {
+        UInt32 cp = ((c & 0x0F) << 12) | ((s[i + 1] & 0x3F) << 6) | (s[i + 2] & 0x3F);
+        if (cp >= 0x800 && (cp < 0xD800 || cp > 0xDFFF)) {
+            if constexpr (Write) d[0] = static_cast<Char>(cp);
+            i += 3;
+            return 1;
+        }
+    }
+
+    UInt32 cp;
+    size_t need;
+    Byte lo = 0x80, hi = 0xBF;  // allowed range of the second byte
+
+    if (c >= 0xC2 && c <= 0xDF) {
+        need = 1;
+        cp = c & 0x1F;
+    } else if (c >= 0xE0 && c <= 0xEF) {
+        need = 2;
+        cp = c & 0x0F;
+        if (c == 0xE0) lo = 0xA0;        // overlong
+        else if (c == 0xED) hi = 0x9F;   // encoded surrogate
+    } else if (c >= 0xF0 && c <= 0xF4) {
+        need = 3;
+        cp = c & 0x07;
+        if (c == 0xF0) lo = 0x90;        // overlong
+        else if (c == 0xF4) hi = 0x8F;   // > U+10FFFF
+    } else {
+        i += 1;  // stray continuation byte or invalid lead (C0, C1, F5..FF)
+        if constexpr (Write) d[0] = REPLACEMENT_CHAR;
+        return 1;
+    }
+
+    size_t k = 1;
+    if (i + 1 < n && s[i + 1] >= lo && s[i + 1] <= hi) {
+        cp = (cp << 6) | (s[i + 1] & 0x3F);
+        k = 2;
+        while (k <= need && i + k < n && is_continuation(s[i + k])) {
+            cp = (cp << 6) | (s[i + k] & 0x3F);
+            k++;
+        }
+    }
+    i += k;
+
+    if (k <= need) {
+        if constexpr (Write) d[0] = REPLACEMENT_CHAR;
+        return 1;
+    }
+    if (cp < 0x10000) {
+        if constexpr (Write) d[0] = static_cast<Char>(cp);
+        return 1;
+    }
+    if constexpr (Write) {
+        cp -= 0x10000;
+        d[0] = static_cast<Char>(0xD800 | (cp >> 10));
+        d[1] = static_cast<Char>(0xDC00 | (cp & 0x3FF));
+    }
+    return 2;
+}
+
+// Encode one unit (or surrogate pair) starting at s[i], advancing i.
+// Returns the number of bytes produced.
+template<bool Write>
+static CIL2CPP_FORCE_INLINE size_t encode_one(const Char* s, size_t n, size_t& i, Byte* d) {
+    UInt32 c = s[i++];
+    if (c < 0x80) {
+        if constexpr (Write) d[0] = static_cast<Byte>(c);
+        return 1;
+    }
+    if (c < 0x800) {
+        if constexpr (Write) {
+            d[0] = static_cast<Byte>(0xC0 | (c >> 6));
+            d[1] = static_cast<Byte>(0x80 | (c & 0x3F));
+        }
+        return 2;
+    }
+    if ((c & 0xF800) == 0xD800) {
+        if (is_high_surrogate(c) && i < n && is_low_surrogate(s[i])) {
+            if constexpr (Write) {
+                UInt32 cp = 0x10000 + ((c - 0xD800) << 10) + (s[i] - 0xDC00);
+                d[0] = static_cast<Byte>(0xF0 | (cp >> 18));
+                d[1] = static_cast<Byte>(0x80 | ((cp >> 12) & 0x3F));
+                d[2] = static_cast<Byte>(0x80 | ((cp >> 6) & 0x3F));
+                d[3] = static_cast<Byte>(0x80 | (cp & 0x3F));
+            }
+            i++;
+            return 4;
+        }
+        c = REPLACEMENT_CHAR;  // unpaired surrogate
+    }
+    if constexpr (Write) {
+        d[0] = static_cast<Byte>(0xE0 | (c >> 12));
+        d[1] = static_cast<Byte>(0x80 | ((c >> 6) & 0x3F));
+        d[2] = static_cast<Byte>(0x80 | (c & 0x3F));
+    }
+    return 3;
+}
+
+// ===== Drivers (one instantiation per kernel set) =====
+//
+// After a non-ASCII code point the drivers stay on the scalar path (which
+// also handles ASCII) until ASCII_REENTRY_RUN units pass without another one,
+// so text with scattered accents does not bounce in and out of the kernels.
+
+static constexpr size_t ASCII_REENTRY_RUN = 16;
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t utf8_to_utf16_length_impl(const Byte* s, size_t len) {
+    size_t i = 0;
+    size_t units = 0;
+    while (i < len) {
+        size_t k = K::ascii_prefix_u8(s + i, len - i);
+        i += k;
+        units += k;
+        size_t last = i;
+        while (i < len && i - last < ASCII_REENTRY_RUN) {
+            if (s[i] < 0x80) {
+                i++;
+                units++;
+            } else {
+                last = i;
+                units += decode_one<false>(s, len, i, nullptr);
+            }
+        }
+    }
+    return units;
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t utf8_to_utf16_impl(const Byte* s, size_t len, Char* dst) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < len) {
+        size_t k = K::widen_ascii(s + i, len - i, dst + o);
+        i += k;
+        o += k;
+        size_t last = i;
+        while (i < len && i - last < ASCII_REENTRY_RUN) {
+            if (s[i] < 0x80) {
+                dst[o++] = s[i++];
+            } else {
+                last = i;
+                o += decode_one<true>(s, len, i, dst + o);
+            }
+        }
+    }
+    return o;
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t utf16_to_utf8_length_impl(const Char* src, size_t len) {
+    size_t i = 0;
+    size_t bytes = 0;
+    while (i < len) {
+        size_t k = K::ascii_prefix_u16(src + i, len - i);
+        i += k;
+        bytes += k;
+        i += K::utf8_bytes_block(src + i, len - i, &bytes);
+        // Per-unit path for what the block kernel left (surrogates, tails)
+        size_t last = i;
+        while (i < len && i - last < ASCII_REENTRY_RUN) {
+            if (src[i] >= 0x80) last = i;
+            bytes += encode_one<false>(src, len, i, nullptr);
+        }
+    }
+    return bytes;
+}
+
+template<typename K>
+static CIL2CPP_FORCE_INLINE size_t utf16_to_utf8_impl(const Char* src, size_t len, Byte* d) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < len) {
+        size_t k = K::narrow_ascii(src + i, len - i, d + o);
+        i += k;
+        o += k;
+        size_t last = i;
+        while (i < len && i - last < ASCII_REENTRY_RUN) {
+            if (src[i] >= 0x80) last = i;
+            o += encode_one<true>(src, len, i, d + o);
+        }
+    }
+    return o;
+}
+
+// Per-level entry points + dispatch (see CIL2CPP_SIMD_ENTRY in simd.h)
+CIL2CPP_SIMD_ENTRY(size_t, utf8_to_utf16_length, (const Byte* s, size_t len), (s, len))
+CIL2CPP_SIMD_ENTRY(size_t, utf8_to_utf16, (const Byte* s, size_t len, Char* d), (s, len, d))
+CIL2CPP_SIMD_ENTRY(size_t, utf16_to_utf8_length, (const Char* s, size_t len), (s, len))
+CIL2CPP_SIMD_ENTRY(size_t, utf16_to_utf8, (const Char* s, size_t len, Byte* d), (s, len, d))
+
+// ===== Public API =====
+
+size_t utf8_to_utf16_length(const char* src, size_t len) {
+    return utf8_to_utf16_length_dispatch(reinterpret_cast<const Byte*>(src), len);
+}
+
+size_t utf8_to_utf16(const char* src, size_t len, Char* dst) {
+    return utf8_to_utf16_dispatch(reinterpret_cast<const Byte*>(src), len, dst);
+}
+
+size_t utf16_to_utf8_length(const Char* src, size_t len) {
+    return utf16_to_utf8_length_dispatch(src, len);
+}
+
+size_t utf16_to_utf8(const Char* src, size_t len, char* dst) {
+    return utf16_to_utf8_dispatch(src, len, reinterpret_cast<Byte*>(dst));
+}
+
+} // namespace utf
+} // namespace cil2cpp
@@ -0,0 +1,146 @@
+/**
+ * CIL2CPP Runtime - Parking Lot
+ *
+ * Futex-style waiting on an arbitrary address: a fixed table of buckets, each
+ * a mutex and a FIFO of parked threads, chosen by hashing the address. A
+ * parked thread waits on a condition variable of its own, so unparking one
+ * thread wakes exactly that thread even when addresses share a bucket.
+ */
+
+#include <cil2cpp/synchronization.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace cil2cpp {
+namespace parking {
+
+namespace {
+
+struct ParkedThread {
+    const void* address;
+    ParkedThread* next = nullptr;
+    std::condition_variable wake;
+    bool unparked = false;
+};
+
+struct alignas(64) Bucket {
+    std::mutex lock;
+    ParkedThread* head = nullptr;
+    ParkedThread* tail = nullptr;
+};
+
+constexpr int kBucketBits = 8;
+Bucket g_buckets[1 << kBucketBits];
+
+Bucket& bucket_for(const void* address) {
+    auto key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(address));
+    return g_buckets[(key * 0x9E3779B97F4A7C15ull) >> (64 - kBucketBits)];
+}
+
+void append(Bucket& b, ParkedThread* t) {
+    if (b.tail) b.tail->next = t;
+    else b.head = t;
+    b.tail = t;
+}
+
+// Unlink t, whose predecessor is prev (nullptr: t is the head)
+void unlink(Bucket& b, ParkedThread* prev, ParkedThread* t) {
+    (prev ? prev->next : b.head) = t->next;
+    if (b.tail == t) b.tail = prev;
+    t->next = nullptr;
+}
+
+void remove(Bucket& b, ParkedThread* t) {
+    ParkedThread* prev = nullptr;
+    for (ParkedThread* p = b.head; p; prev = p, p = p->next) {
+        if (p == t) {
+            unlink(b, prev, p);
+            return;
+        }
+    }
+}
+
+} // namespace
+
+bool park(const void* address, bool (*validate)(void* context), void* context, Int32 timeout_ms) {
+    Bucket& b = bucket_for(address);
+    std::unique_lock<std::mutex> guard(b.lock);
+    if (!validate(context)) return false;
+
+    ParkedThread self;
+    self.address = address;
+    append(b, &self);
+    if (timeout_ms < 0) {
+        self.wake.wait(guard, [&] { return self.unparked; });
+        return true;
+    }
+    if (self.wake.wait_for(guard, std::chrono::milliseconds(timeout_ms), [&] { return self.unparked; }))
+        return true;
+    remove(b, &self);
+    return false;
+}
+
+bool unpark_one(const void* address) {
+    Bucket& b = bucket_for(address);
+    std::lock_guard<std::mutex> guard(b.lock);
+    ParkedThread* prev = nullptr;
+    for (ParkedThread* p = b.head; p; prev = p, p = p->next) {
+        if (p->address != address) continue;
+        unlink(b, prev, p);
+        p->unparked = true;
+        // Notify under the lock: once it sees `unparked` the thread returns
+        // and its ParkedThread (on its stack) is gone
+        p->wake.notify_one();
+        return true;
+    }
+    return false;
+}
+
+Int32 unpark_all(const void* address) {
+    Bucket& b = bucket_for(address);
+    std::lock_guard<std::mutex> guard(b.lock);
+    Int32 count = 0;
+    ParkedThread* prev = nullptr;
+    for (ParkedThread* p = b.head; p;) {
+        ParkedThread* next = p->next;
+        if (p->address == address) {
+            unlink(b, prev, p);
+            p->unparked = true;
+            p->wake.notify_one();
+            count++;
+        } else {
+            prev = p;
+        }
+        p = next;
+    }
+    return count;
+}
+
+void spin_pause() {
+    static const bool single_processor = std::thread::hardware_concurrency() <= 1;
+    if (single_processor) {
+        std::this_thread::yield();
+        return;
+    }
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+} // namespace parking
+} // namespace cil2cpp
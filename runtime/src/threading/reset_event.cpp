@@ -0,0 +1,77 @@
+/**
+ * CIL2CPP Runtime - ManualResetEventSlim Implementation
+ *
+ * Set and Reset are a store; Set unparks waiters only if some parked. Wait
+ * returns at once when the event is set, otherwise spins spin_count times,
+ * then parks on the state word.
+ */
+
+#include <cil2cpp/synchronization.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/type_info.h>
+
+namespace cil2cpp {
+
+TypeInfo ManualResetEventSlim_TypeInfo = {
+    .name = "ManualResetEventSlim",
+    .namespace_name = "System.Threading",
+    .full_name = "System.Threading.ManualResetEventSlim",
+    .base_type = &System::Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(ManualResetEventSlim),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+ManualResetEventSlim* reset_event_create(bool initial_state, Int32 spin_count) {
+    // The BCL caps SpinCount at 2047
+    if (spin_count < -1 || spin_count > 2047) throw_argument_out_of_range();
+    auto* e = static_cast<ManualResetEventSlim*>(
+        gc::alloc(sizeof(ManualResetEventSlim), &ManualResetEventSlim_TypeInfo));
+    e->state.store(initial_state ? 1 : 0, std::memory_order_relaxed);
+    e->spin_count = spin_count < 0 ? parking::kSpinCount : spin_count;
+    return e;
+}
+
+void reset_event_set(ManualResetEventSlim* e) {
+    if (!e) throw_null_reference();
+    e->state.store(1, std::memory_order_seq_cst);
+    if (e->parked.load(std::memory_order_seq_cst) > 0)
+        parking::unpark_all(&e->state);
+}
+
+bool reset_event_wait(ManualResetEventSlim* e, Int32 timeout_ms) {
+    if (!e) throw_null_reference();
+    if (timeout_ms < -1) throw_argument_out_of_range();
+    if (reset_event_is_set(e)) return true;
+    if (timeout_ms == 0) return false;
+
+    parking::Deadline deadline(timeout_ms);
+    for (Int32 i = 0; i < e->spin_count; i++) {
+        parking::spin_pause();
+        if (reset_event_is_set(e)) return true;
+    }
+    for (;;) {
+        e->parked.fetch_add(1, std::memory_order_seq_cst);
+        parking::park(&e->state, [](void* context) {
+            return static_cast<ManualResetEventSlim*>(context)->state.load(std::memory_order_seq_cst) == 0;
+        }, e, deadline.remaining_ms());
+        e->parked.fetch_sub(1, std::memory_order_relaxed);
+        if (reset_event_is_set(e)) return true;
+        if (deadline.expired()) return false;
+    }
+}
+
+} // namespace cil2cpp
@@ -0,0 +1,169 @@
+/**
+ * CIL2CPP Runtime - ReaderWriterLockSlim Implementation
+ *
+ * One state word holds the reader count and a writer bit. Readers enter with
+ * a CAS that bumps the count while no writer holds or waits for the lock;
+ * a writer enters with a CAS from 0. Waiting writers are counted in
+ * writers_waiting, which holds new readers back (writer preference).
+ * Readers park on `state`, writers on `writers_waiting`; whoever releases
+ * the lock unparks one writer if any is parked, otherwise every reader.
+ */
+
+#include <cil2cpp/synchronization.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/type_info.h>
+
+namespace cil2cpp {
+
+static constexpr UInt32 kWriterHeld = 0x80000000u;
+static constexpr UInt32 kReaderMask = 0x7FFFFFFFu;
+
+TypeInfo ReaderWriterLockSlim_TypeInfo = {
+    .name = "ReaderWriterLockSlim",
+    .namespace_name = "System.Threading",
+    .full_name = "System.Threading.ReaderWriterLockSlim",
+    .base_type = &System::Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(ReaderWriterLockSlim),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+// Identity of the calling thread (the address of a thread-local)
+static const void* current_thread() {
+    static thread_local char identity;
+    return &identity;
+}
+
+static bool try_enter_read(ReaderWriterLockSlim* l) {
+    UInt32 s = l->state.load(std::memory_order_relaxed);
+    while (!(s & kWriterHeld) && l->writers_waiting.load(std::memory_order_seq_cst) == 0) {
+        if (l->state.compare_exchange_weak(s, s + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+static bool try_enter_write(ReaderWriterLockSlim* l) {
+    UInt32 expected = 0;
+    return l->state.compare_exchange_strong(expected, kWriterHeld, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+}
+
+static void wake_after_release(ReaderWriterLockSlim* l) {
+    if (l->writers_parked.load(std::memory_order_seq_cst) > 0 && parking::unpark_one(&l->writers_waiting))
+        return;
+    if (l->readers_parked.load(std::memory_order_seq_cst) > 0)
+        parking::unpark_all(&l->state);
+}
+
+ReaderWriterLockSlim* rwlock_create(Int32 recursion_policy) {
+    if (recursion_policy != 0) throw_not_supported();   // LockRecursionPolicy.SupportsRecursion
+    return static_cast<ReaderWriterLockSlim*>(
+        gc::alloc(sizeof(ReaderWriterLockSlim), &ReaderWriterLockSlim_TypeInfo));
+}
+
+bool rwlock_enter_read(ReaderWriterLockSlim* l, Int32 timeout_ms) {
+    if (!l) throw_null_reference();
+    if (timeout_ms < -1) throw_argument_out_of_range();
+    if (l->writer.load(std::memory_order_relaxed) == current_thread()) throw_lock_recursion();
+    if (try_enter_read(l)) return true;
+    if (timeout_ms == 0) return false;
+
+    parking::Deadline deadline(timeout_ms);
+    for (Int32 i = 0; i < parking::kSpinCount; i++) {
+        parking::spin_pause();
+        if (try_enter_read(l)) return true;
+    }
+    for (;;) {
+        l->readers_parked.fetch_add(1, std::memory_order_seq_cst);
+        parking::park(&l->state, [](void* context) {
+            auto* lock = static_cast<ReaderWriterLockSlim*>(context);
+            return (lock->state.load(std::memory_order_seq_cst) & kWriterHeld) != 0
+                || lock->writers_waiting.load(std::memory_order_seq_cst) > 0;
+        }, l, deadline.remaining_ms());
+        l->readers_parked.fetch_sub(1, std::memory_order_relaxed);
+        if (try_enter_read(l)) return true;
+        if (deadline.expired()) return false;
+    }
+}
+
+void rwlock_exit_read(ReaderWriterLockSlim* l) {
+    if (!l) throw_null_reference();
+    UInt32 s = l->state.load(std::memory_order_relaxed);
+    do {
+        if ((s & kReaderMask) == 0) throw_synchronization_lock();
+    } while (!l->state.compare_exchange_weak(s, s - 1, std::memory_order_seq_cst, std::memory_order_relaxed));
+    // The last reader out lets a waiting writer in
+    if ((s & kReaderMask) == 1) wake_after_release(l);
+}
+
+bool rwlock_enter_write(ReaderWriterLockSlim* l, Int32 timeout_ms) {
+    if (!l) throw_null_reference();
+    if (timeout_ms < -1) throw_argument_out_of_range();
+    if (l->writer.load(std::memory_order_relaxed) == current_thread()) throw_lock_recursion();
+    if (try_enter_write(l)) {
+        l->writer.store(current_thread(), std::memory_order_relaxed);
+        return true;
+    }
+    if (timeout_ms == 0) return false;
+
+    parking::Deadline deadline(timeout_ms);
+    // From here on new readers wait behind this writer
+    l->writers_waiting.fetch_add(1, std::memory_order_seq_cst);
+    bool acquired = false;
+    for (Int32 i = 0; i < parking::kSpinCount && !acquired; i++) {
+        parking::spin_pause();
+        acquired = try_enter_write(l);
+    }
+    while (!acquired) {
+        l->writers_parked.fetch_add(1, std::memory_order_seq_cst);
+        parking::park(&l->writers_waiting, [](void* context) {
+            return static_cast<ReaderWriterLockSlim*>(context)->state.load(std::memory_order_seq_cst) != 0;
+        }, l, deadline.remaining_ms());
+        l->writers_parked.fetch_sub(1, std::memory_order_relaxed);
+        acquired = try_enter_write(l);
+        if (!acquired && deadline.expired()) break;
+    }
+    bool last_waiting = l->writers_waiting.fetch_sub(1, std::memory_order_seq_cst) == 1;
+    if (acquired) {
+        l->writer.store(current_thread(), std::memory_order_relaxed);
+        return true;
+    }
+    // Gave up: readers held back only by this writer may go
+    if (last_waiting && l->readers_parked.load(std::memory_order_seq_cst) > 0)
+        parking::unpark_all(&l->state);
+    return false;
+}
+
+void rwlock_exit_write(ReaderWriterLockSlim* l) {
+    if (!l) throw_null_reference();
+    if (l->writer.load(std::memory_order_relaxed) != current_thread()) throw_synchronization_lock();
+    l->writer.store(nullptr, std::memory_order_relaxed);
+    l->state.store(0, std::memory_order_seq_cst);
+    wake_after_release(l);
+}
+
+bool rwlock_is_write_lock_held(ReaderWriterLockSlim* l) {
+    if (!l) throw_null_reference();
+    return l->writer.load(std::memory_order_relaxed) == current_thread();
+}
+
+Int32 rwlock_current_read_count(ReaderWriterLockSlim* l) {
+    if (!l) throw_null_reference();
+    return static_cast<Int32>(l->state.load(std::memory_order_acquire) & kReaderMask);
+}
+
+} // namespace cil2cpp
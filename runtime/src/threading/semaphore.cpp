@@ -0,0 +1,152 @@
+/**
+ * CIL2CPP Runtime - SemaphoreSlim Implementation
+ *
+ * The count is one atomic word: Wait and Release are a CAS each when nobody
+ * waits. Wait spins, then parks on the count. WaitAsync callers queue a
+ * pending Task under a small spin lock; Release hands its slots to queued
+ * tasks first, completing them outside the lock.
+ */
+
+#include <cil2cpp/synchronization.h>
+#include <cil2cpp/bcl/System.Object.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/type_info.h>
+
+namespace cil2cpp {
+
+struct SemaphoreWaiter {
+    SemaphoreWaiter* next;
+    Task* task;
+};
+
+TypeInfo SemaphoreSlim_TypeInfo = {
+    .name = "SemaphoreSlim",
+    .namespace_name = "System.Threading",
+    .full_name = "System.Threading.SemaphoreSlim",
+    .base_type = &System::Object_TypeInfo,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(SemaphoreSlim),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = nullptr,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+// Take one slot if there is one. The load is seq_cst: WaitAsync raises
+// `queued` before retrying, Release raises `count` before reading `queued`.
+static bool try_take(SemaphoreSlim* s) {
+    Int32 c = s->count.load(std::memory_order_seq_cst);
+    while (c > 0) {
+        if (s->count.compare_exchange_weak(c, c - 1, std::memory_order_acquire, std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+static void lock_queue(SemaphoreSlim* s) {
+    while (s->queue_lock.exchange(true, std::memory_order_acquire))
+        parking::spin_pause();
+}
+
+static void unlock_queue(SemaphoreSlim* s) {
+    s->queue_lock.store(false, std::memory_order_release);
+}
+
+// Give free slots to queued WaitAsync callers, oldest first
+static void hand_to_queued(SemaphoreSlim* s) {
+    SemaphoreWaiter* ready = nullptr;
+    SemaphoreWaiter** ready_tail = &ready;
+    lock_queue(s);
+    while (s->head && try_take(s)) {
+        SemaphoreWaiter* w = s->head;
+        s->head = w->next;
+        if (!s->head) s->tail = nullptr;
+        s->queued.fetch_sub(1, std::memory_order_relaxed);
+        w->next = nullptr;
+        *ready_tail = w;
+        ready_tail = &w->next;
+    }
+    unlock_queue(s);
+    for (SemaphoreWaiter* w = ready; w; w = w->next)
+        task_complete(w->task);
+}
+
+SemaphoreSlim* semaphore_create(Int32 initial_count, Int32 max_count) {
+    if (max_count <= 0 || initial_count < 0 || initial_count > max_count)
+        throw_argument_out_of_range();
+    auto* s = static_cast<SemaphoreSlim*>(gc::alloc(sizeof(SemaphoreSlim), &SemaphoreSlim_TypeInfo));
+    s->count.store(initial_count, std::memory_order_relaxed);
+    s->max_count = max_count;
+    return s;
+}
+
+bool semaphore_wait(SemaphoreSlim* s, Int32 timeout_ms) {
+    if (!s) throw_null_reference();
+    if (timeout_ms < -1) throw_argument_out_of_range();
+    if (try_take(s)) return true;
+    if (timeout_ms == 0) return false;
+
+    parking::Deadline deadline(timeout_ms);
+    for (Int32 i = 0; i < parking::kSpinCount; i++) {
+        parking::spin_pause();
+        if (try_take(s)) return true;
+    }
+    for (;;) {
+        s->parked.fetch_add(1, std::memory_order_seq_cst);
+        parking::park(&s->count, [](void* context) {
+            return static_cast<SemaphoreSlim*>(context)->count.load(std::memory_order_seq_cst) == 0;
+        }, s, deadline.remaining_ms());
+        s->parked.fetch_sub(1, std::memory_order_relaxed);
+        if (try_take(s)) return true;
+        if (deadline.expired()) return false;
+    }
+}
+
+Task* semaphore_wait_async(SemaphoreSlim* s) {
+    if (!s) throw_null_reference();
+    if (try_take(s)) return task_get_completed();
+
+    auto* w = static_cast<SemaphoreWaiter*>(gc::alloc(sizeof(SemaphoreWaiter), nullptr));
+    w->task = task_create_pending();
+    lock_queue(s);
+    s->queued.fetch_add(1, std::memory_order_seq_cst);
+    // A Release that saw no queued waiter left its slot in the count
+    if (try_take(s)) {
+        s->queued.fetch_sub(1, std::memory_order_relaxed);
+        unlock_queue(s);
+        return task_get_completed();
+    }
+    if (s->tail) s->tail->next = w;
+    else s->head = w;
+    s->tail = w;
+    unlock_queue(s);
+    return w->task;
+}
+
+Int32 semaphore_release(SemaphoreSlim* s, Int32 release_count) {
+    if (!s) throw_null_reference();
+    if (release_count < 1) throw_argument_out_of_range();
+    Int32 previous = s->count.load(std::memory_order_relaxed);
+    do {
+        if (release_count > s->max_count - previous) throw_semaphore_full();
+    } while (!s->count.compare_exchange_weak(previous, previous + release_count,
+                                             std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    if (s->queued.load(std::memory_order_seq_cst) > 0) hand_to_queued(s);
+    if (s->parked.load(std::memory_order_seq_cst) > 0) {
+        if (release_count == 1) parking::unpark_one(&s->count);
+        else parking::unpark_all(&s->count);
+    }
+    return previous;
+}
+
+} // namespace cil2cpp
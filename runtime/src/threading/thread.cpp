@@ -3,9 +3,15 @@
  *
  * Wraps std::thread for managed thread support.
  * Each thread registers with BoehmGC for safe allocations.
+ *
+ * State moves Unstarted -> Running (CAS in start) -> Stopped (store at the
+ * end of thread_entry). Stopped is also the completion event: Join parks on
+ * the state word and the exiting thread unparks it, as ManualResetEventSlim
+ * does. The current thread's ManagedThread and ID live in thread_locals.
  */
 
 #include <cil2cpp/threading.h>
+#include <cil2cpp/synchronization.h>
 #include <cil2cpp/gc.h>
 #include <cil2cpp/exception.h>
 #include <cil2cpp/type_info.h>
@@ -19,11 +25,31 @@ namespace thread {
 
 static std::atomic<Int32> g_next_managed_id{1};
 
+static thread_local ManagedThread* t_current = nullptr;
+static thread_local Int32 t_managed_id = 0;
+
+// native_handle once a joiner has found the thread stopped before start
+// published the handle: start then reaps it itself.
+static void* const kReaped = reinterpret_cast<void*>(1);
+
+static void reap_native(void* handle) {
+    auto* native = static_cast<std::thread*>(handle);
+    native->join();
+    delete native;
+}
+
+// Join the native thread exactly once: whoever swaps the handle out owns it.
+static void reap(ManagedThread* t) {
+    void* handle = interlocked::exchange(&t->native_handle, kReaped);
+    if (handle != nullptr && handle != kReaped) reap_native(handle);
+}
+
 // Thread entry point — runs on the new thread
 static void thread_entry(ManagedThread* t) {
     gc::register_thread();
 
-    t->state = 1; // running
+    t_current = t;
+    t_managed_id = t->managed_id;
 
     CIL2CPP_TRY
         // Invoke the ThreadStart delegate: void()
@@ -36,63 +62,79 @@ static void thread_entry(ManagedThread* t) {
         // ECMA-335: unhandled exceptions in threads terminate the thread
     CIL2CPP_END_TRY
 
-    t->state = 2; // stopped
+    t->state.store(kStopped, std::memory_order_seq_cst);
+    if (t->joiners.load(std::memory_order_seq_cst) > 0)
+        parking::unpark_all(&t->state);
 
     gc::unregister_thread();
 }
 
+static ManagedThread* init_thread(void* memory, Delegate* start, Int32 managed_id, Int32 state) {
+    auto* t = static_cast<ManagedThread*>(memory);
+    t->native_handle = nullptr;
+    t->start_delegate = start;
+    t->managed_id = managed_id;
+    t->state.store(state, std::memory_order_relaxed);
+    t->joiners.store(0, std::memory_order_relaxed);
+    return t;
+}
+
 ManagedThread* create(Delegate* start) {
     if (!start) throw_null_reference();
 
     // Allocate ManagedThread as a GC object
-    auto* t = static_cast<ManagedThread*>(
-        gc::alloc(sizeof(ManagedThread), nullptr));
-    t->native_handle = nullptr;
-    t->start_delegate = start;
-    t->managed_id = g_next_managed_id.fetch_add(1, std::memory_order_relaxed);
-    t->state = 0; // unstarted
-    return t;
+    return init_thread(gc::alloc(sizeof(ManagedThread), nullptr), start,
+        g_next_managed_id.fetch_add(1, std::memory_order_relaxed), kUnstarted);
 }
 
 void start(ManagedThread* t) {
     if (!t) throw_null_reference();
-    if (t->state != 0) throw_invalid_operation();
+    Int32 expected = kUnstarted;
+    if (!t->state.compare_exchange_strong(expected, kRunning, std::memory_order_acq_rel))
+        throw_invalid_operation();
 
-    // Create the native thread
+    // Create the native thread, then publish it unless a joiner already
+    // saw the thread stop and left the reaping to us.
     auto* native = new std::thread(thread_entry, t);
-    t->native_handle = native;
+    if (interlocked::exchange(&t->native_handle, static_cast<void*>(native)) == kReaped) {
+        reap_native(native);
+        t->native_handle = kReaped;
+    }
 }
 
-void join(ManagedThread* t) {
-    if (!t) throw_null_reference();
-    auto* native = static_cast<std::thread*>(t->native_handle);
-    if (native && native->joinable()) {
-        native->join();
+static bool is_stopped(ManagedThread* t) {
+    return t->state.load(std::memory_order_acquire) == kStopped;
+}
+
+// Wait on the completion event: park on the state word until thread_entry stores Stopped.
+static bool wait_stopped(ManagedThread* t, Int32 timeout_ms) {
+    if (is_stopped(t)) return true;
+    if (timeout_ms == 0) return false;
+
+    parking::Deadline deadline(timeout_ms);
+    for (;;) {
+        t->joiners.fetch_add(1, std::memory_order_seq_cst);
+        parking::park(&t->state, [](void* context) {
+            return static_cast<ManagedThread*>(context)->state.load(std::memory_order_seq_cst) != kStopped;
+        }, t, deadline.remaining_ms());
+        t->joiners.fetch_sub(1, std::memory_order_relaxed);
+        if (is_stopped(t)) return true;
+        if (deadline.expired()) return false;
     }
 }
 
+void join(ManagedThread* t) {
+    join_timeout(t, -1);
+}
+
 bool join_timeout(ManagedThread* t, Int32 timeout_ms) {
     if (!t) throw_null_reference();
+    if (timeout_ms < -1) throw_argument_out_of_range();
+    if (t->state.load(std::memory_order_acquire) == kUnstarted) throw_invalid_operation();
 
-    // std::thread doesn't support timed join directly.
-    // For now, poll the state flag.
-    if (t->state == 2) return true;
-
-    auto deadline = std::chrono::steady_clock::now() +
-        std::chrono::milliseconds(timeout_ms);
-
-    while (std::chrono::steady_clock::now() < deadline) {
-        if (t->state == 2) {
-            // Thread finished — join to clean up
-            auto* native = static_cast<std::thread*>(t->native_handle);
-            if (native && native->joinable()) {
-                native->join();
-            }
-            return true;
-        }
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
-    return false;
+    if (!wait_stopped(t, timeout_ms)) return false;
+    reap(t);
+    return true;
 }
 
 void sleep(Int32 milliseconds) {
@@ -107,7 +149,7 @@ void sleep(Int32 milliseconds) {
 
 bool is_alive(ManagedThread* t) {
     if (!t) throw_null_reference();
-    return t->state == 1;
+    return t->state.load(std::memory_order_acquire) == kRunning;
 }
 
 Int32 get_managed_id(ManagedThread* t) {
@@ -115,5 +157,21 @@ Int32 get_managed_id(ManagedThread* t) {
     return t->managed_id;
 }
 
+ManagedThread* current() {
+    if (t_current) return t_current;
+    // Threads we didn't start have no owner keeping their Thread alive, and
+    // a thread_local is not a GC root: allocate it uncollectable.
+    t_current = init_thread(gc::alloc_uncollectable(sizeof(ManagedThread)), nullptr,
+        current_managed_id(), kRunning);
+    t_current->native_handle = kReaped;
+    return t_current;
+}
+
+Int32 current_managed_id() {
+    if (t_managed_id == 0)
+        t_managed_id = g_next_managed_id.fetch_add(1, std::memory_order_relaxed);
+    return t_managed_id;
+}
+
 } // namespace thread
 } // namespace cil2cpp
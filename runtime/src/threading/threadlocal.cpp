@@ -0,0 +1,141 @@
+/**
+ * CIL2CPP Runtime - ThreadLocal<T> Implementation
+ *
+ * Slots come from a free list under a mutex (taken only by create and
+ * Dispose); instance ids from a counter. A thread's table grows by doubling
+ * to cover the highest slot it touches.
+ */
+
+#include <cil2cpp/threadlocal.h>
+#include <cil2cpp/gc.h>
+#include <cil2cpp/type_info.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace cil2cpp {
+
+namespace tls {
+thread_local constinit ThreadLocalTable* t_table = nullptr;
+} // namespace tls
+
+static std::mutex g_slot_mutex;
+static std::vector<Int32> g_free_slots;
+static Int32 g_next_slot = 0;
+static std::atomic<UInt64> g_next_id{1};
+
+// The tables are GC memory reachable only through each thread's t_table
+static const bool g_table_rooted = (gc::register_thread_static_block(
+    [] { return static_cast<void*>(&tls::t_table); }, sizeof(tls::t_table)), true);
+
+static void release_slot(ThreadLocal* tl) {
+    std::lock_guard<std::mutex> lock(g_slot_mutex);
+    g_free_slots.push_back(tl->slot);
+}
+
+// A collected, undisposed ThreadLocal gives its slot back
+static void threadlocal_finalize(Object* obj) {
+    auto* tl = static_cast<ThreadLocal*>(obj);
+    if (tl->id != 0) {
+        tl->id = 0;
+        release_slot(tl);
+    }
+}
+
+static TypeInfo ThreadLocal_TypeInfo = {
+    .name = "ThreadLocal`1",
+    .namespace_name = "System.Threading",
+    .full_name = "System.Threading.ThreadLocal`1",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(ThreadLocal),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .default_ctor = nullptr,
+    .finalizer = threadlocal_finalize,
+    .interface_vtables = nullptr,
+    .interface_vtable_count = 0,
+};
+
+ThreadLocal* threadlocal_create(Int32 value_size, Delegate* factory) {
+    (void)g_table_rooted;
+    auto* tl = static_cast<ThreadLocal*>(gc::alloc(sizeof(ThreadLocal), &ThreadLocal_TypeInfo));
+    tl->value_size = value_size;
+    tl->factory = factory;
+    tl->id = g_next_id.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(g_slot_mutex);
+    if (!g_free_slots.empty()) {
+        tl->slot = g_free_slots.back();
+        g_free_slots.pop_back();
+    } else {
+        tl->slot = g_next_slot++;
+    }
+    return tl;
+}
+
+static ThreadLocalCell** table_entry(Int32 slot) {
+    ThreadLocalTable* table = tls::t_table;
+    if (!table || slot >= table->capacity) {
+        Int32 capacity = table ? table->capacity : 8;
+        while (capacity <= slot) capacity *= 2;
+        auto* grown = static_cast<ThreadLocalTable*>(
+            gc::alloc(sizeof(ThreadLocalTable) + capacity * sizeof(ThreadLocalCell*), nullptr));
+        grown->cells = reinterpret_cast<ThreadLocalCell**>(grown + 1);
+        for (Int32 i = 0; table && i < table->capacity; i++)
+            grown->cells[i] = table->cells[i];
+        grown->capacity = capacity;
+        tls::t_table = table = grown;
+    }
+    return &table->cells[slot];
+}
+
+static ThreadLocalCell* new_cell(ThreadLocal* tl) {
+    auto* cell = static_cast<ThreadLocalCell*>(
+        gc::alloc(sizeof(ThreadLocalCell) + static_cast<size_t>(tl->value_size), nullptr));
+    cell->owner = tl->id;
+    return cell;
+}
+
+void* threadlocal_get_slow(ThreadLocal* tl, void (*run_factory)(Delegate* factory, void* value)) {
+    if (!tl) throw_null_reference();
+    if (tl->id == 0) throw_object_disposed();
+    auto* cell = new_cell(tl);
+    // Install only once the factory returned: if it throws, the next access retries it
+    if (tl->factory) run_factory(tl->factory, cell + 1);
+    *table_entry(tl->slot) = cell;
+    return cell + 1;
+}
+
+void* threadlocal_set_slow(ThreadLocal* tl) {
+    if (!tl) throw_null_reference();
+    if (tl->id == 0) throw_object_disposed();
+    auto* cell = new_cell(tl);
+    *table_entry(tl->slot) = cell;
+    return cell + 1;
+}
+
+bool threadlocal_is_value_created(ThreadLocal* tl) {
+    if (!tl) throw_null_reference();
+    if (tl->id == 0) throw_object_disposed();
+    return threadlocal_find(tl) != nullptr;
+}
+
+void threadlocal_dispose(ThreadLocal* tl) {
+    if (!tl) throw_null_reference();
+    if (tl->id == 0) return;
+    // Drop this thread's value now; other threads' cells go when their slot
+    // is reused or their thread exits
+    ThreadLocalTable* table = tls::t_table;
+    if (table && tl->slot < table->capacity) table->cells[tl->slot] = nullptr;
+    tl->id = 0;
+    release_slot(tl);
+}
+
+} // namespace cil2cpp
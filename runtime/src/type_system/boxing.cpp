@@ -0,0 +1,54 @@
+/**
+ * CIL2CPP Runtime - Small-value box cache (see box_cache in boxing.h)
+ *
+ * A primitive's table is an Object[] hung off its TypeInfo, which lives in
+ * static storage that BoehmGC scans, so the boxes stay alive for the run.
+ */
+
+#include <cil2cpp/boxing.h>
+#include <cil2cpp/array.h>
+#include <cil2cpp/reflection.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace cil2cpp {
+namespace box_cache {
+
+static std::mutex g_init_mutex;
+
+template<typename T>
+static Object** build_table(TypeInfo* type) {
+    constexpr Int32 count = Range<T>::max - Range<T>::min + 1;
+    auto* table = static_cast<Array*>(gc::alloc_array(&System_Object_TypeInfo, count));
+    auto** boxes = static_cast<Object**>(array_data(table));
+    for (Int32 i = 0; i < count; i++) {
+        Object* obj = static_cast<Object*>(gc::alloc(sizeof(Object) + sizeof(T), type));
+        *reinterpret_cast<T*>(reinterpret_cast<char*>(obj) + sizeof(Object)) = static_cast<T>(i + Range<T>::min);
+        boxes[i] = obj;
+    }
+    return boxes;
+}
+
+template<typename T>
+Object* lookup(TypeInfo* type, Int32 value) {
+    std::atomic_ref<Object**> slot(type->small_boxes);
+    Object** boxes = slot.load(std::memory_order_acquire);
+    if (!boxes) {
+        std::lock_guard<std::mutex> lock(g_init_mutex);
+        boxes = slot.load(std::memory_order_relaxed);
+        if (!boxes) {
+            boxes = build_table<T>(type);
+            slot.store(boxes, std::memory_order_release);
+        }
+    }
+    return boxes[value - Range<T>::min];
+}
+
+template Object* lookup<Boolean>(TypeInfo*, Int32);
+template Object* lookup<Byte>(TypeInfo*, Int32);
+template Object* lookup<Char>(TypeInfo*, Int32);
+template Object* lookup<Int32>(TypeInfo*, Int32);
+
+} // namespace box_cache
+} // namespace cil2cpp
@@ -199,6 +199,38 @@ TEST_F(ArrayTest, GetElementPtr_ReturnsCorrectOffset) {
     EXPECT_EQ(elem1, static_cast<char*>(elem0) + sizeof(int32_t));
 }
 
+TEST_F(ArrayTest, ElementPtr_Typed_MatchesUntyped) {
+    Array* arr = array_create(&Int32ElementType, 5);
+    ASSERT_NE(arr, nullptr);
+
+    EXPECT_EQ(static_cast<void*>(array_element_ptr<Int32>(arr, 3)), array_get_element_ptr(arr, 3));
+    EXPECT_EQ(array_element_ptr_unchecked<Int32>(arr, 3), array_element_ptr<Int32>(arr, 3));
+}
+
+TEST_F(ArrayTest, ElementPtr_Typed_OutOfRange_Throws) {
+    Array* arr = array_create(&Int32ElementType, 5);
+    ASSERT_NE(arr, nullptr);
+
+    bool caught = false;
+    CIL2CPP_TRY
+        array_element_ptr<Int32>(arr, 5);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(ArrayTest, Unchecked_SetAndGet_MatchChecked) {
+    Array* arr = array_create(&Int32ElementType, 4);
+    ASSERT_NE(arr, nullptr);
+
+    for (Int32 i = 0; i < arr->length; i++)
+        array_set_unchecked<Int32>(arr, i, i * 10);
+    for (Int32 i = 0; i < arr->length; i++)
+        EXPECT_EQ(array_get<Int32>(arr, i), array_get_unchecked<Int32>(arr, i));
+    EXPECT_EQ(array_get<Int32>(arr, 3), 30);
+}
+
 // ===== Double arrays =====
 
 static TypeInfo DoubleElementType = {
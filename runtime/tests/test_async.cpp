@@ -12,7 +12,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <thread>
+#include <vector>
 
 using namespace cil2cpp;
 
@@ -107,6 +109,109 @@ TEST(TaskTest, Fault_SetsStatusAndException) {
     EXPECT_EQ(t->f_exception, ex);
 }
 
+// ===== Completed-task cache / AsyncTaskMethodBuilder =====
+
+// Task<T> as the compiler generates it: Task fields followed by f_result
+template <typename T>
+struct TestTaskOf {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_status;
+    Exception* f_exception;
+    intptr_t f_continuations;
+    intptr_t f_lock;
+    T f_result;
+};
+
+TEST(TaskTest, FromResult_Bool_SharedInstances) {
+    auto* t = task_from_result<TestTaskOf<bool>>(true);
+    auto* f = task_from_result<TestTaskOf<bool>>(false);
+    EXPECT_EQ(t, task_from_result<TestTaskOf<bool>>(true));
+    EXPECT_EQ(f, task_from_result<TestTaskOf<bool>>(false));
+    EXPECT_NE(t, f);
+    EXPECT_TRUE(t->f_result);
+    EXPECT_FALSE(f->f_result);
+    EXPECT_EQ(t->f_status, 1);
+    EXPECT_EQ(t->f_lock, 0);
+}
+
+TEST(TaskTest, FromResult_SmallInts_Cached) {
+    for (Int32 v = -1; v <= 8; v++) {
+        auto* t = task_from_result<TestTaskOf<Int32>>(v);
+        EXPECT_EQ(t, task_from_result<TestTaskOf<Int32>>(v));
+        EXPECT_EQ(t->f_result, v);
+    }
+    auto* big = task_from_result<TestTaskOf<Int32>>(9);
+    EXPECT_NE(big, task_from_result<TestTaskOf<Int32>>(9));
+    EXPECT_EQ(big->f_result, 9);
+    EXPECT_TRUE(task_is_completed(reinterpret_cast<Task*>(big)));
+
+    // Unsigned: -1 is not in range, UInt32 max must not alias it
+    auto* max = task_from_result<TestTaskOf<UInt32>>(0xFFFFFFFFu);
+    EXPECT_EQ(max->f_result, 0xFFFFFFFFu);
+    EXPECT_NE(max, task_from_result<TestTaskOf<UInt32>>(0xFFFFFFFFu));
+}
+
+TEST(TaskTest, FromResult_NullAndDefault_Cached) {
+    auto* n = task_from_result<TestTaskOf<Object*>>(nullptr);
+    EXPECT_EQ(n, task_from_result<TestTaskOf<Object*>>(nullptr));
+    EXPECT_EQ(n->f_result, nullptr);
+
+    auto* zero = task_from_result<TestTaskOf<Double>>(0.0);
+    EXPECT_EQ(zero, task_from_result<TestTaskOf<Double>>(0.0));
+    auto* neg = task_from_result<TestTaskOf<Double>>(-0.0);
+    EXPECT_NE(zero, neg);
+    EXPECT_TRUE(std::signbit(neg->f_result));
+}
+
+TEST(TaskTest, Builder_SynchronousCompletion_NoPendingTask) {
+    TestTaskOf<Int32>* task = nullptr;
+    task_builder_set_result(task, 5);
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task, task_from_result<TestTaskOf<Int32>>(5));
+    EXPECT_EQ(task_builder_get_task(task), task);
+
+    Task* plain = nullptr;
+    task_builder_set_result(plain);
+    EXPECT_EQ(plain, task_get_completed());
+}
+
+TEST(TaskTest, Builder_AsynchronousCompletion_CompletesPendingTask) {
+    TestTaskOf<Int32>* task = nullptr;
+    auto* pending = task_builder_get_task(task);  // first await
+    ASSERT_NE(pending, nullptr);
+    EXPECT_EQ(pending->f_status, 0);
+    EXPECT_NE(pending->f_lock, 0);
+
+    std::atomic<int> ran{0};
+    task_add_continuation(reinterpret_cast<Task*>(pending), [](void* state) {
+        static_cast<std::atomic<int>*>(state)->store(1);
+    }, &ran);
+    task_builder_set_result(task, 123);
+    EXPECT_EQ(task, pending);
+    EXPECT_EQ(pending->f_result, 123);
+    EXPECT_EQ(pending->f_status, 1);
+    EXPECT_EQ(ran.load(), 1);
+}
+
+TEST(TaskTest, Builder_SetException_Faults) {
+    TestTaskOf<Int32>* task = nullptr;
+    auto* ex = static_cast<Exception*>(gc::alloc(sizeof(Exception), nullptr));
+    task_builder_set_exception(task, ex);
+    ASSERT_NE(task, nullptr);
+    EXPECT_EQ(task->f_status, 2);
+    EXPECT_EQ(task->f_exception, ex);
+}
+
+TEST(TaskTest, SharedCompletedTask_CompleteAndFaultIgnored) {
+    auto* t = task_get_completed();
+    auto* ex = static_cast<Exception*>(gc::alloc(sizeof(Exception), nullptr));
+    task_fault(t, ex);
+    task_complete(t);
+    EXPECT_EQ(t->f_status, 1);
+    EXPECT_EQ(t->f_exception, nullptr);
+}
+
 // ===== Continuation Tests =====
 
 TEST(TaskTest, Continuation_RunsOnComplete) {
@@ -158,6 +263,185 @@ TEST(TaskTest, MultipleContinuations) {
     EXPECT_EQ(counter.load(), 5);
 }
 
+// ===== Continuation Scheduling Tests =====
+
+struct ThreadRecord {
+    std::atomic<bool> ran{false};
+    std::thread::id thread;
+};
+
+static void record_thread(void* raw) {
+    auto* rec = static_cast<ThreadRecord*>(raw);
+    rec->thread = std::this_thread::get_id();
+    rec->ran.store(true);
+}
+
+static void wait_for(const std::atomic<bool>& flag) {
+    for (int i = 0; i < 5000 && !flag.load(); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+TEST(TaskTest, Scheduling_DefaultRunsInlineOnCompletingThread) {
+    auto* t = task_create_pending();
+    ThreadRecord rec;
+    task_add_continuation(t, record_thread, &rec);
+    task_complete(t);
+    ASSERT_TRUE(rec.ran.load());
+    EXPECT_EQ(rec.thread, std::this_thread::get_id());
+}
+
+TEST(TaskTest, Scheduling_RunContinuationsAsynchronously_PostsToPool) {
+    auto* t = task_create_pending(TaskCreationOptions::RunContinuationsAsynchronously);
+    ThreadRecord rec;
+    task_add_continuation(t, record_thread, &rec);
+    task_complete(t);
+    wait_for(rec.ran);
+    ASSERT_TRUE(rec.ran.load());
+    EXPECT_NE(rec.thread, std::this_thread::get_id());
+}
+
+TEST(TaskTest, Scheduling_RunAsynchronouslyFlag_PostsEvenWhenComplete) {
+    ThreadRecord rec;
+    task_add_continuation(task_get_completed(), record_thread, &rec, ContinuationFlags::RunAsynchronously);
+    wait_for(rec.ran);
+    ASSERT_TRUE(rec.ran.load());
+    EXPECT_NE(rec.thread, std::this_thread::get_id());
+}
+
+// A chain where each continuation completes the next task, as awaits do
+struct ChainLink {
+    Task* next;
+    std::atomic<Int32>* max_depth;
+};
+
+static thread_local Int32 t_chain_nesting = 0;
+
+static void complete_next_link(void* raw) {
+    auto* link = static_cast<ChainLink*>(raw);
+    t_chain_nesting++;
+    Int32 seen = link->max_depth->load();
+    while (t_chain_nesting > seen && !link->max_depth->compare_exchange_weak(seen, t_chain_nesting)) {}
+    task_complete(link->next);
+    t_chain_nesting--;
+}
+
+TEST(TaskTest, Scheduling_InlineDepthLimit_HopsToPool) {
+    constexpr int length = 1000;
+    Int32 previous_limit = task_get_inline_depth_limit();
+    task_set_inline_depth_limit(8);
+
+    std::vector<Task*> tasks(length + 1);
+    for (auto& t : tasks) t = task_create_pending();
+    std::atomic<Int32> max_depth{0};
+    std::vector<ChainLink> links(length);
+    for (int i = 0; i < length; i++) {
+        links[i] = {tasks[i + 1], &max_depth};
+        task_add_continuation(tasks[i], complete_next_link, &links[i]);
+    }
+
+    task_complete(tasks[0]);
+    task_wait(tasks[length]);
+    task_set_inline_depth_limit(previous_limit);
+
+    EXPECT_TRUE(task_is_completed(tasks[length]));
+    EXPECT_LE(max_depth.load(), 8);
+}
+
+static void throw_from_continuation(void*) {
+    throw_invalid_operation();
+}
+
+TEST(TaskTest, Scheduling_ThrowingContinuation_KeepsInlineDepth) {
+    Int32 previous_limit = task_get_inline_depth_limit();
+    task_set_inline_depth_limit(1);
+
+    auto* failing = task_create_pending();
+    task_add_continuation(failing, throw_from_continuation, nullptr);
+    bool caught = false;
+    CIL2CPP_TRY
+        task_complete(failing);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+
+    // Depth is back to 0, so the next continuation still runs inline
+    auto* t = task_create_pending();
+    ThreadRecord rec;
+    task_add_continuation(t, record_thread, &rec);
+    task_complete(t);
+    task_set_inline_depth_limit(previous_limit);
+    wait_for(rec.ran);
+    ASSERT_TRUE(rec.ran.load());
+    EXPECT_EQ(rec.thread, std::this_thread::get_id());
+}
+
+// ===== Pooled State Machine Tests =====
+
+static TypeInfo PooledBoxType = {};
+
+TEST(TaskTest, PooledBox_ReusedAfterBothReleases) {
+    auto* box = static_cast<Object*>(async_box_acquire(40, &PooledBoxType));
+    EXPECT_EQ(box->__type_info, &PooledBoxType);
+    reinterpret_cast<Int32*>(box)[6] = 42;
+
+    async_box_release(box);                          // stub
+    auto* other = async_box_acquire(40, &PooledBoxType);
+    EXPECT_NE(other, box);                           // still owned by MoveNext
+    async_box_release(box);                          // MoveNext
+
+    auto* again = static_cast<Object*>(async_box_acquire(40, &PooledBoxType));
+    EXPECT_EQ(again, box);
+    EXPECT_EQ(reinterpret_cast<Int32*>(again)[6], 0); // cleared when pooled
+
+    for (void* b : {static_cast<void*>(again), other}) {
+        async_box_release(b);
+        async_box_release(b);
+    }
+}
+
+TEST(TaskTest, PooledBox_PooledBySizeClass) {
+    auto* small = async_box_acquire(24, &PooledBoxType);
+    async_box_release(small);
+    async_box_release(small);
+    auto* large = async_box_acquire(200, &PooledBoxType);
+    EXPECT_NE(large, small);
+    auto* small_again = async_box_acquire(32, &PooledBoxType);  // same 16-byte class
+    EXPECT_EQ(small_again, small);
+
+    for (void* b : {large, small_again}) {
+        async_box_release(b);
+        async_box_release(b);
+    }
+}
+
+TEST(TaskTest, PooledBox_OversizeStillWorks) {
+    auto* box = static_cast<Object*>(async_box_acquire(4096, &PooledBoxType));
+    ASSERT_NE(box, nullptr);
+    EXPECT_EQ(box->__type_info, &PooledBoxType);
+    async_box_release(box);
+    async_box_release(box);
+}
+
+TEST(TaskTest, Continuation_NodesReused) {
+    constexpr int rounds = 100;
+    Task* tasks[rounds];
+    for (auto& t : tasks) t = task_create_pending();
+    std::atomic<int> counter{0};
+    auto increment = [](void* state) { static_cast<std::atomic<int>*>(state)->fetch_add(1); };
+
+    // Warm this thread's pool, then await/complete without allocating
+    task_add_continuation(tasks[0], increment, &counter);
+    task_complete(tasks[0]);
+    size_t before = gc::get_stats().total_allocated;
+    for (int i = 1; i < rounds; i++) {
+        task_add_continuation(tasks[i], increment, &counter);
+        task_complete(tasks[i]);
+    }
+    EXPECT_EQ(gc::get_stats().total_allocated, before);
+    EXPECT_EQ(counter.load(), rounds);
+}
+
 // ===== Wait Tests =====
 
 TEST(TaskTest, Wait_CompletedTask_ReturnsImmediately) {
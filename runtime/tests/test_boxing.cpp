@@ -312,3 +312,82 @@ TEST_F(BoxingTest, BoxDifferentTypes_IndependentTypeInfo) {
     EXPECT_EQ(dblBox->__type_info, &DoubleType);
     EXPECT_EQ(boolBox->__type_info, &BooleanType);
 }
+
+// ===== Small-value box cache =====
+
+static TypeInfo CharType = {
+    .name = "Char", .namespace_name = "System", .full_name = "System.Char",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Object) + sizeof(Char), .element_size = 0,
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+static TypeInfo ByteType = {
+    .name = "Byte", .namespace_name = "System", .full_name = "System.Byte",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Object) + sizeof(Byte), .element_size = 0,
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+// Enums box through the same box<Int32> but are not Primitive
+static TypeInfo ColorEnumType = {
+    .name = "Color", .namespace_name = "", .full_name = "Color",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Object) + sizeof(Int32), .element_size = sizeof(Int32),
+    .flags = TypeFlags::ValueType | TypeFlags::Enum | TypeFlags::Sealed,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+TEST_F(BoxingTest, BoxCache_SmallInt32_SharesOneBox) {
+    Object* a = box<Int32>(7, &Int32Type);
+    Object* b = box<Int32>(7, &Int32Type);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(unbox<Int32>(a), 7);
+    EXPECT_EQ(a->__type_info, &Int32Type);
+    EXPECT_EQ(box<Int32>(-128, &Int32Type), box<Int32>(-128, &Int32Type));
+    EXPECT_EQ(box<Int32>(1023, &Int32Type), box<Int32>(1023, &Int32Type));
+}
+
+TEST_F(BoxingTest, BoxCache_Int32OutsideRange_Allocates) {
+    EXPECT_NE(box<Int32>(1024, &Int32Type), box<Int32>(1024, &Int32Type));
+    EXPECT_NE(box<Int32>(-129, &Int32Type), box<Int32>(-129, &Int32Type));
+    EXPECT_EQ(unbox<Int32>(box<Int32>(1024, &Int32Type)), 1024);
+}
+
+TEST_F(BoxingTest, BoxCache_Boolean_TrueAndFalseAreDistinctSingletons) {
+    Object* t = box<Boolean>(true, &BooleanType);
+    Object* f = box<Boolean>(false, &BooleanType);
+    EXPECT_EQ(t, box<Boolean>(true, &BooleanType));
+    EXPECT_EQ(f, box<Boolean>(false, &BooleanType));
+    EXPECT_NE(t, f);
+    EXPECT_TRUE(unbox<Boolean>(t));
+    EXPECT_FALSE(unbox<Boolean>(f));
+}
+
+TEST_F(BoxingTest, BoxCache_ByteAndAsciiChar) {
+    EXPECT_EQ(box<Byte>(255, &ByteType), box<Byte>(255, &ByteType));
+    EXPECT_EQ(unbox<Byte>(box<Byte>(200, &ByteType)), 200);
+    EXPECT_EQ(box<Char>(u'a', &CharType), box<Char>(u'a', &CharType));
+    EXPECT_EQ(unbox<Char>(box<Char>(u'a', &CharType)), u'a');
+    // Non-ASCII characters are boxed fresh
+    EXPECT_NE(box<Char>(u'é', &CharType), box<Char>(u'é', &CharType));
+}
+
+TEST_F(BoxingTest, BoxCache_EnumsAndOtherTypesNotShared) {
+    Object* a = box<Int32>(1, &ColorEnumType);
+    Object* b = box<Int32>(1, &ColorEnumType);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a->__type_info, &ColorEnumType);
+    EXPECT_NE(box<Int64>(1, &Int64Type), box<Int64>(1, &Int64Type));
+}
@@ -0,0 +1,413 @@
+/**
+ * CIL2CPP Runtime Tests - Channel<T> (channel.h)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+// Task<int> / Task<bool> / ValueTask<T>, as the generated code declares them
+template <typename T>
+struct TaskOf {
+    TypeInfo* __type_info;
+    UInt32 __sync_block;
+    Int32 f_status;
+    Exception* f_exception;
+    intptr_t f_continuations;
+    intptr_t f_lock;
+    T f_result;
+};
+
+template <typename T>
+struct ValueTaskOf {
+    TaskOf<T>* f_task;
+    T f_result;
+};
+
+using ValueTaskInt = ValueTaskOf<Int32>;
+using ValueTaskBool = ValueTaskOf<bool>;
+
+static Task* as_task(void* t) {
+    return static_cast<Task*>(t);
+}
+
+// await on a ValueTask<T> that did not fault: the immediate result or the task's
+template <typename T>
+static T await_value(const ValueTaskOf<T>& vt) {
+    if (!vt.f_task) return vt.f_result;
+    task_wait(as_task(vt.f_task));
+    return vt.f_task->f_result;
+}
+
+class ChannelTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        runtime_init();
+    }
+};
+
+// ===== Unbounded =====
+
+TEST_F(ChannelTest, Unbounded_TryWriteTryRead_FifoAcrossSegments) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    constexpr Int32 n = 5000;   // spans several segments
+    for (Int32 i = 0; i < n; i++) ASSERT_TRUE(channel_try_write(c, &i));
+    for (Int32 i = 0; i < n; i++) {
+        Int32 item = -1;
+        ASSERT_TRUE(channel_try_read(c, &item));
+        EXPECT_EQ(item, i);
+    }
+    Int32 item;
+    EXPECT_FALSE(channel_try_read(c, &item));
+}
+
+TEST_F(ChannelTest, ReadAsync_ItemAvailable_CompletesSynchronously) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    Int32 value = 42;
+    channel_try_write(c, &value);
+    auto vt = channel_read_async<ValueTaskInt>(c, ct_get_none());
+    EXPECT_EQ(vt.f_task, nullptr);
+    EXPECT_EQ(vt.f_result, 42);
+}
+
+TEST_F(ChannelTest, ReadAsync_Empty_CompletesWhenWritten) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto vt = channel_read_async<ValueTaskInt>(c, ct_get_none());
+    ASSERT_NE(vt.f_task, nullptr);
+    EXPECT_FALSE(task_is_completed(as_task(vt.f_task)));
+    EXPECT_EQ(vt.f_task->__type_info, &Task_TypeInfo);
+    EXPECT_TRUE(object_is_instance_of(reinterpret_cast<Object*>(c), &System_Object_TypeInfo));
+
+    Int32 value = 7;
+    EXPECT_TRUE(channel_try_write(c, &value));
+    EXPECT_TRUE(task_is_completed(as_task(vt.f_task)));
+    EXPECT_EQ(vt.f_task->f_result, 7);
+    // The item went to the parked reader, not into the queue
+    Int32 item;
+    EXPECT_FALSE(channel_try_read(c, &item));
+}
+
+TEST_F(ChannelTest, ReadAsync_ResumesContinuation) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto vt = channel_read_async<ValueTaskInt>(c, ct_get_none());
+    ASSERT_NE(vt.f_task, nullptr);
+    static Int32 resumed_with;
+    resumed_with = 0;
+    task_add_continuation(as_task(vt.f_task), [](void* t) {
+        resumed_with = static_cast<TaskOf<Int32>*>(t)->f_result;
+    }, vt.f_task);
+
+    Int32 value = 5;
+    channel_write_async(c, &value, ct_get_none());
+    task_wait(as_task(vt.f_task));
+    for (int i = 0; i < 1000 && resumed_with == 0; i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_EQ(resumed_with, 5);
+}
+
+TEST_F(ChannelTest, Unbounded_WriteAsync_AlwaysSynchronous) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    for (Int32 i = 0; i < 100; i++) EXPECT_EQ(channel_write_async(c, &i, ct_get_none()), nullptr);
+}
+
+// ===== Bounded =====
+
+TEST_F(ChannelTest, Bounded_TryWrite_FalseWhenFull) {
+    auto* c = channel_create_bounded(3, sizeof(Int32));
+    for (Int32 i = 0; i < 3; i++) EXPECT_TRUE(channel_try_write(c, &i));
+    Int32 extra = 3;
+    EXPECT_FALSE(channel_try_write(c, &extra));
+
+    Int32 item;
+    ASSERT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 0);
+    EXPECT_TRUE(channel_try_write(c, &extra));
+    for (Int32 expected = 1; expected <= 3; expected++) {
+        ASSERT_TRUE(channel_try_read(c, &item));
+        EXPECT_EQ(item, expected);
+    }
+}
+
+TEST_F(ChannelTest, Bounded_WrapsAroundManyLaps) {
+    auto* c = channel_create_bounded(5, sizeof(Int64));
+    for (Int64 i = 0; i < 1000; i++) {
+        ASSERT_TRUE(channel_try_write(c, &i));
+        Int64 item = -1;
+        ASSERT_TRUE(channel_try_read(c, &item));
+        EXPECT_EQ(item, i);
+    }
+}
+
+TEST_F(ChannelTest, Bounded_WriteAsync_Full_CompletesWhenRead) {
+    auto* c = channel_create_bounded(1, sizeof(Int32));
+    Int32 first = 1, second = 2;
+    EXPECT_EQ(channel_write_async(c, &first, ct_get_none()), nullptr);
+    Task* pending = channel_write_async(c, &second, ct_get_none());
+    ASSERT_NE(pending, nullptr);
+    EXPECT_FALSE(task_is_completed(pending));
+
+    Int32 item;
+    ASSERT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 1);
+    // The parked writer's item moved into the freed slot
+    EXPECT_TRUE(task_is_completed(pending));
+    ASSERT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 2);
+}
+
+TEST_F(ChannelTest, Bounded_ZeroCapacity_Throws) {
+    bool caught = false;
+    CIL2CPP_TRY
+        channel_create_bounded(0, sizeof(Int32));
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+// ===== WaitToReadAsync =====
+
+TEST_F(ChannelTest, WaitToReadAsync_TrueOnceWritten) {
+    auto* c = channel_create_bounded(4, sizeof(Int32));
+    auto vt = channel_wait_to_read_async<ValueTaskBool>(c, ct_get_none());
+    ASSERT_NE(vt.f_task, nullptr);
+    Int32 value = 9;
+    channel_try_write(c, &value);
+    EXPECT_TRUE(task_is_completed(as_task(vt.f_task)));
+    EXPECT_TRUE(vt.f_task->f_result);
+    // WaitToRead does not consume the item
+    Int32 item;
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 9);
+}
+
+TEST_F(ChannelTest, WaitToReadAsync_FalseAfterCompleteAndDrained) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    Int32 value = 1;
+    channel_try_write(c, &value);
+    channel_complete(c, nullptr);
+
+    auto ready = channel_wait_to_read_async<ValueTaskBool>(c, ct_get_none());
+    EXPECT_EQ(ready.f_task, nullptr);
+    EXPECT_TRUE(ready.f_result);
+    Int32 item;
+    EXPECT_TRUE(channel_try_read(c, &item));
+
+    auto done = channel_wait_to_read_async<ValueTaskBool>(c, ct_get_none());
+    EXPECT_EQ(done.f_task, nullptr);
+    EXPECT_FALSE(done.f_result);
+}
+
+// ===== Completion =====
+
+TEST_F(ChannelTest, Complete_FaultsParkedReadersAndLaterWrites) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto read = channel_read_async<ValueTaskInt>(c, ct_get_none());
+    auto wait = channel_wait_to_read_async<ValueTaskBool>(c, ct_get_none());
+    ASSERT_NE(read.f_task, nullptr);
+    ASSERT_NE(wait.f_task, nullptr);
+
+    EXPECT_TRUE(channel_try_complete(c, nullptr));
+    EXPECT_FALSE(channel_try_complete(c, nullptr));
+
+    EXPECT_EQ(read.f_task->f_status, 2);
+    EXPECT_TRUE(object_is_instance_of(reinterpret_cast<Object*>(read.f_task->f_exception),
+                                      &ChannelClosedException_TypeInfo));
+    EXPECT_EQ(wait.f_task->f_status, 1);
+    EXPECT_FALSE(wait.f_task->f_result);
+
+    Int32 value = 1;
+    EXPECT_FALSE(channel_try_write(c, &value));
+    Task* write = channel_write_async(c, &value, ct_get_none());
+    ASSERT_NE(write, nullptr);
+    EXPECT_EQ(write->f_status, 2);
+    EXPECT_TRUE(object_is_instance_of(reinterpret_cast<Object*>(write->f_exception),
+                                      &InvalidOperationException_TypeInfo));
+}
+
+TEST_F(ChannelTest, Complete_FaultsParkedWriters) {
+    auto* c = channel_create_bounded(1, sizeof(Int32));
+    Int32 a = 1, b = 2;
+    channel_try_write(c, &a);
+    Task* pending = channel_write_async(c, &b, ct_get_none());
+    ASSERT_NE(pending, nullptr);
+    channel_complete(c, nullptr);
+    EXPECT_EQ(pending->f_status, 2);
+
+    // The item written before Complete can still be read
+    Int32 item;
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 1);
+    EXPECT_FALSE(channel_try_read(c, &item));
+}
+
+TEST_F(ChannelTest, Completion_CompletesOnceDrained) {
+    auto* c = channel_create_bounded(2, sizeof(Int32));
+    Task* completion = channel_get_completion(c);
+    Int32 value = 3;
+    channel_try_write(c, &value);
+    channel_complete(c, nullptr);
+    EXPECT_FALSE(task_is_completed(completion));
+
+    Int32 item;
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(completion->f_status, 1);
+    EXPECT_EQ(channel_get_completion(c), completion);
+}
+
+TEST_F(ChannelTest, Completion_FaultsWithCompletionError) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto* error = static_cast<Exception*>(gc::alloc(sizeof(Exception), &Exception_TypeInfo));
+    channel_complete(c, error);
+    Task* completion = channel_get_completion(c);
+    EXPECT_EQ(completion->f_status, 2);
+    EXPECT_EQ(completion->f_exception, error);
+
+    auto read = channel_read_async<ValueTaskInt>(c, ct_get_none());
+    ASSERT_NE(read.f_task, nullptr);
+    EXPECT_EQ(read.f_task->f_status, 2);
+    EXPECT_EQ(read.f_task->f_exception->inner_exception, error);
+}
+
+TEST_F(ChannelTest, Complete_Twice_Throws) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    channel_complete(c, nullptr);
+    bool caught = false;
+    CIL2CPP_TRY
+        channel_complete(c, nullptr);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+// ===== Cancellation =====
+
+static bool is_canceled(Task* t) {
+    return t->f_status == 2 && object_is_instance_of(reinterpret_cast<Object*>(t->f_exception),
+                                                     &OperationCanceledException_TypeInfo);
+}
+
+TEST_F(ChannelTest, ReadAsync_Canceled_FaultsParkedReader) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto* cts = cts_create();
+    auto read = channel_read_async<ValueTaskInt>(c, cts_get_token(cts));
+    auto wait = channel_wait_to_read_async<ValueTaskBool>(c, cts_get_token(cts));
+    ASSERT_NE(read.f_task, nullptr);
+    ASSERT_NE(wait.f_task, nullptr);
+
+    cts_cancel(cts);
+    EXPECT_TRUE(is_canceled(as_task(read.f_task)));
+    EXPECT_TRUE(is_canceled(as_task(wait.f_task)));
+
+    // The canceled readers left the channel: the next item stays queued
+    Int32 value = 9, item = 0;
+    EXPECT_TRUE(channel_try_write(c, &value));
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 9);
+}
+
+TEST_F(ChannelTest, WriteAsync_Canceled_FaultsParkedWriter) {
+    auto* c = channel_create_bounded(1, sizeof(Int32));
+    auto* cts = cts_create();
+    Int32 a = 1, b = 2;
+    channel_try_write(c, &a);
+    Task* pending = channel_write_async(c, &b, cts_get_token(cts));
+    ASSERT_NE(pending, nullptr);
+
+    cts_cancel(cts);
+    EXPECT_TRUE(is_canceled(pending));
+
+    // Its item was never written
+    Int32 item;
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 1);
+    EXPECT_FALSE(channel_try_read(c, &item));
+}
+
+TEST_F(ChannelTest, ReadAsync_AlreadyCanceled_FailsUpFront) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    Int32 value = 3;
+    channel_try_write(c, &value);
+    auto* cts = cts_create();
+    cts_cancel(cts);
+    auto read = channel_read_async<ValueTaskInt>(c, cts_get_token(cts));
+    ASSERT_NE(read.f_task, nullptr);
+    EXPECT_TRUE(is_canceled(as_task(read.f_task)));
+    // The item was not consumed
+    Int32 item = 0;
+    EXPECT_TRUE(channel_try_read(c, &item));
+    EXPECT_EQ(item, 3);
+}
+
+TEST_F(ChannelTest, ReadAsync_ServedBeforeCancel_KeepsItem) {
+    auto* c = channel_create_unbounded(sizeof(Int32));
+    auto* cts = cts_create();
+    auto read = channel_read_async<ValueTaskInt>(c, cts_get_token(cts));
+    ASSERT_NE(read.f_task, nullptr);
+    Int32 value = 4;
+    channel_try_write(c, &value);
+    cts_cancel(cts);
+    EXPECT_EQ(read.f_task->f_status, 1);
+    EXPECT_EQ(read.f_task->f_result, 4);
+}
+
+// ===== Concurrency =====
+
+// Producers WriteAsync 0..per_producer-1 each, consumers ReadAsync until the
+// channel closes; every item must arrive exactly once.
+static void run_pipeline(Channel* c, int producers, int consumers, Int32 per_producer) {
+    std::atomic<Int64> sum{0};
+    std::atomic<Int64> count{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            gc::register_thread();
+            for (Int32 i = 0; i < per_producer; i++) {
+                if (Task* t = channel_write_async(c, &i, ct_get_none())) task_wait(t);
+            }
+            gc::unregister_thread();
+        });
+    }
+    std::vector<std::thread> readers;
+    for (int r = 0; r < consumers; r++) {
+        readers.emplace_back([&] {
+            gc::register_thread();
+            for (;;) {
+                auto vt = channel_read_async<ValueTaskInt>(c, ct_get_none());
+                if (vt.f_task) {
+                    task_wait(as_task(vt.f_task));
+                    if (vt.f_task->f_status == 2) break;   // closed
+                }
+                sum.fetch_add(await_value(vt), std::memory_order_relaxed);
+                count.fetch_add(1, std::memory_order_relaxed);
+            }
+            gc::unregister_thread();
+        });
+    }
+    for (auto& t : threads) t.join();
+    channel_complete(c, nullptr);
+    for (auto& t : readers) t.join();
+
+    Int64 n = per_producer;
+    EXPECT_EQ(count.load(), n * producers);
+    EXPECT_EQ(sum.load(), producers * n * (n - 1) / 2);
+    EXPECT_EQ(channel_get_completion(c)->f_status, 1);
+}
+
+TEST_F(ChannelTest, Concurrent_Bounded_ManyToMany) {
+    run_pipeline(channel_create_bounded(8, sizeof(Int32)), 4, 3, 20000);
+}
+
+TEST_F(ChannelTest, Concurrent_Unbounded_ManyToMany) {
+    run_pipeline(channel_create_unbounded(sizeof(Int32)), 4, 3, 20000);
+}
+
+TEST_F(ChannelTest, Concurrent_Bounded_OneToOne) {
+    run_pipeline(channel_create_bounded(1, sizeof(Int32)), 1, 1, 20000);
+}
@@ -460,3 +460,98 @@ TEST_F(CollectionTest, ElementHash_ReferenceType_Null) {
     String* n = nullptr;
     EXPECT_EQ(element_hash(&n, &System_String_TypeInfo), 0);
 }
+
+// ======================================================================
+// Value types with their own Equals/GetHashCode (TypeInfo thunks)
+// ======================================================================
+
+// Equality on `id` only: `payload` differs between keys that must match
+struct TaggedKey {
+    Int32 id;
+    Int32 payload;
+};
+
+static int g_tagged_equals_calls = 0;
+
+static Boolean tagged_key_equals(const void* a, const void* b) {
+    g_tagged_equals_calls++;
+    return static_cast<const TaggedKey*>(a)->id == static_cast<const TaggedKey*>(b)->id;
+}
+
+static Int32 tagged_key_hash(const void* value) {
+    return static_cast<const TaggedKey*>(value)->id * 31;
+}
+
+static TypeInfo TaggedKeyTypeInfo = {
+    .name = "TaggedKey", .namespace_name = "", .full_name = "TaggedKey",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(TaggedKey), .element_size = sizeof(TaggedKey),
+    .flags = TypeFlags::ValueType,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+    .value_equals = tagged_key_equals,
+    .value_hash = tagged_key_hash,
+};
+
+static TypeInfo BitwiseKeyTypeInfo = {
+    .name = "BitwiseKey", .namespace_name = "", .full_name = "BitwiseKey",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(TaggedKey), .element_size = sizeof(TaggedKey),
+    .flags = TypeFlags::ValueType,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+TEST_F(CollectionTest, ElementEquals_ValueTypeThunk_UsesOwnEquals) {
+    TaggedKey a{7, 1}, b{7, 2}, c{8, 1};
+    EXPECT_TRUE(element_equals(&a, &b, &TaggedKeyTypeInfo));
+    EXPECT_FALSE(element_equals(&a, &c, &TaggedKeyTypeInfo));
+    EXPECT_EQ(element_hash(&a, &TaggedKeyTypeInfo), 7 * 31);
+}
+
+TEST_F(CollectionTest, ElementEquals_ValueTypeWithoutThunk_IsBitwise) {
+    TaggedKey a{7, 1}, b{7, 2}, c{7, 1};
+    EXPECT_FALSE(element_equals(&a, &b, &BitwiseKeyTypeInfo));
+    EXPECT_TRUE(element_equals(&a, &c, &BitwiseKeyTypeInfo));
+    EXPECT_EQ(element_hash(&a, &BitwiseKeyTypeInfo), element_hash(&c, &BitwiseKeyTypeInfo));
+}
+
+TEST_F(CollectionTest, DictValueTypeKey_LooksUpThroughThunks) {
+    auto* dict = dict_create(&DictIntIntTypeInfo, &TaggedKeyTypeInfo, &Int32ElemTypeInfo);
+    for (Int32 i = 0; i < 50; i++) {
+        TaggedKey key{i, i * 3};
+        Int32 val = i * 10;
+        dict_set(dict, &key, &val);
+    }
+
+    g_tagged_equals_calls = 0;
+    TaggedKey probe{21, -1};
+    ASSERT_TRUE(dict_contains_key(dict, &probe));
+    EXPECT_EQ(*static_cast<Int32*>(dict_get_ref(dict, &probe)), 210);
+    EXPECT_GT(g_tagged_equals_calls, 0);
+
+    TaggedKey missing{99, 0};
+    EXPECT_FALSE(dict_contains_key(dict, &missing));
+}
+
+TEST_F(CollectionTest, ListValueType_ContainsUsesThunk) {
+    auto* list = list_create(&ListIntTypeInfo, &TaggedKeyTypeInfo, 0);
+    TaggedKey a{1, 100};
+    list_add(list, &a);
+    TaggedKey probe{1, 200};
+    EXPECT_TRUE(list_contains(list, &probe));
+}
+
+TEST_F(CollectionTest, ValueTypeEquals_ComparesBoxedContents) {
+    Int32 a = 5, b = 5, c = 6;
+    Object* boxed_b = box_raw(&b, sizeof(Int32), &Int32ElemTypeInfo);
+    Object* boxed_c = box_raw(&c, sizeof(Int32), &Int32ElemTypeInfo);
+    EXPECT_TRUE(value_type_equals(&a, boxed_b, &Int32ElemTypeInfo));
+    EXPECT_FALSE(value_type_equals(&a, boxed_c, &Int32ElemTypeInfo));
+    EXPECT_FALSE(value_type_equals(&a, nullptr, &Int32ElemTypeInfo));
+    EXPECT_FALSE(value_type_equals(&a, boxed_b, &TaggedKeyTypeInfo));
+}
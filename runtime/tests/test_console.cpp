@@ -12,6 +12,8 @@ class ConsoleTest : public ::testing::Test {
 protected:
     void SetUp() override {
         runtime_init();
+        // CaptureStdout only sees bytes that reached stdout; flush every call.
+        Console_SetFlushPolicy(ConsoleFlushPolicy::Always);
     }
 
     void TearDown() override {
@@ -243,3 +245,77 @@ TEST_F(ConsoleTest, WriteLineString_Utf8Content) {
     std::string output = testing::internal::GetCapturedStdout();
     EXPECT_EQ(output, "caf\xC3\xA9\n");
 }
+
+TEST_F(ConsoleTest, WriteLineString_SurrogatePair_EncodesAs4Bytes) {
+    // U+1F600 (grinning face) = D83D DE00 in UTF-16
+    Char chars[] = { 0xD83D, 0xDE00 };
+    String* str = string_create_utf16(chars, 2);
+    testing::internal::CaptureStdout();
+    Console_WriteLine(str);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "\xF0\x9F\x98\x80\n");
+}
+
+TEST_F(ConsoleTest, WriteString_LoneSurrogate_WritesReplacementChar) {
+    Char chars[] = { u'a', 0xD800, u'b' };
+    String* str = string_create_utf16(chars, 3);
+    testing::internal::CaptureStdout();
+    Console_Write(str);
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "a\xEF\xBF\xBD" "b");
+}
+
+TEST_F(ConsoleTest, WriteLineInt32_MinValue) {
+    testing::internal::CaptureStdout();
+    Console_WriteLine(static_cast<Int32>(-2147483647 - 1));
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "-2147483648\n");
+}
+
+TEST_F(ConsoleTest, WriteLineUInt64_MaxValue) {
+    testing::internal::CaptureStdout();
+    Console_WriteLine(static_cast<UInt64>(18446744073709551615ULL));
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "18446744073709551615\n");
+}
+
+// ===== Flush policy =====
+
+TEST_F(ConsoleTest, BlockPolicy_BuffersUntilFlush) {
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Block);
+    testing::internal::CaptureStdout();
+    Console_WriteLine(static_cast<Int32>(7));
+    Console_Flush();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "7\n");
+}
+
+TEST_F(ConsoleTest, LinePolicy_FlushesOnNewlineOnly) {
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Line);
+    testing::internal::CaptureStdout();
+    Console_Write(static_cast<Int32>(1));
+    Console_WriteLine(static_cast<Int32>(2));
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, "12\n");
+}
+
+TEST_F(ConsoleTest, SetFlushPolicy_RoundTrips) {
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Line);
+    EXPECT_EQ(Console_GetFlushPolicy(), ConsoleFlushPolicy::Line);
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Always);
+    EXPECT_EQ(Console_GetFlushPolicy(), ConsoleFlushPolicy::Always);
+}
+
+TEST_F(ConsoleTest, BlockPolicy_OutputLargerThanBuffer_IsComplete) {
+    Console_SetFlushPolicy(ConsoleFlushPolicy::Block);
+    std::string expected;
+    testing::internal::CaptureStdout();
+    for (Int32 i = 0; i < 20000; i++) {
+        Console_WriteLine(i);
+        expected += std::to_string(i);
+        expected += '\n';
+    }
+    Console_Flush();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_EQ(output, expected);
+}
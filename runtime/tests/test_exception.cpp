@@ -859,3 +859,53 @@ TEST_F(ExceptionTest, FieldHasAttribute_Found) {
     EXPECT_TRUE(field_has_attribute(&field, "System.ObsoleteAttribute"));
     EXPECT_FALSE(field_has_attribute(&field, "System.SerializableAttribute"));
 }
+
+// ===== AggregateException =====
+
+TEST_F(ExceptionTest, AggregateFlatten_ExpandsNestedAggregates) {
+    Exception* a = operation_canceled_exception_create();
+    Exception* b = channel_closed_exception_create(nullptr);
+    Exception* c = operation_canceled_exception_create();
+    Exception* nested_inner[] = { b };
+    Exception* nested = aggregate_exception_create(nested_inner, 1);
+    Exception* outer_inner[] = { nested, a, c };
+    auto* flat = aggregate_exception_flatten(aggregate_exception_create(outer_inner, 3));
+
+    // Exceptions directly in the outer aggregate come before the nested ones
+    ASSERT_EQ(array_length(flat->inner_exceptions), 3);
+    EXPECT_EQ(array_get<Exception*>(flat->inner_exceptions, 0), a);
+    EXPECT_EQ(array_get<Exception*>(flat->inner_exceptions, 1), c);
+    EXPECT_EQ(array_get<Exception*>(flat->inner_exceptions, 2), b);
+    EXPECT_EQ(flat->inner_exception, a);
+}
+
+static bool IsCanceled(void*, Exception* e) {
+    return object_is_instance_of(e, &OperationCanceledException_TypeInfo);
+}
+
+TEST_F(ExceptionTest, AggregateHandle_AllHandled_DoesNotThrow) {
+    Exception* inner[] = { operation_canceled_exception_create(), operation_canceled_exception_create() };
+    bool caught = false;
+    CIL2CPP_TRY
+        aggregate_exception_handle(aggregate_exception_create(inner, 2), &IsCanceled, nullptr);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_FALSE(caught);
+}
+
+TEST_F(ExceptionTest, AggregateHandle_RethrowsUnhandled) {
+    Exception* closed = channel_closed_exception_create(nullptr);
+    Exception* inner[] = { operation_canceled_exception_create(), closed };
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        aggregate_exception_handle(aggregate_exception_create(inner, 2), &IsCanceled, nullptr);
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    ASSERT_EQ(caught->__type_info, &AggregateException_TypeInfo);
+    auto* rest = static_cast<AggregateException*>(caught);
+    ASSERT_EQ(array_length(rest->inner_exceptions), 1);
+    EXPECT_EQ(array_get<Exception*>(rest->inner_exceptions, 0), closed);
+}
@@ -0,0 +1,214 @@
+/**
+ * CIL2CPP Runtime Tests - Composite and numeric formatting
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+#include <cmath>
+#include <limits>
+#include <string>
+
+using namespace cil2cpp;
+
+class FormatTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+    }
+
+    void TearDown() override {
+        runtime_shutdown();
+    }
+
+    static std::string utf8(String* s) {
+        char* raw = string_to_utf8(s);
+        std::string result = raw ? raw : "";
+        std::free(raw);
+        return result;
+    }
+
+    static std::string fmt(const FormatArg& arg, const char* spec = "") {
+        return utf8(string_format(string_literal((std::string("{0:") + spec + "}").c_str()), &arg, 1));
+    }
+
+    static bool throws_format(const char* format, const FormatArg& arg) {
+        bool caught = false;
+        CIL2CPP_TRY
+            string_format(string_literal(format), &arg, 1);
+        CIL2CPP_CATCH_ALL
+            caught = true;
+        CIL2CPP_END_TRY
+        return caught;
+    }
+};
+
+// ===== Default ToString() =====
+
+TEST_F(FormatTest, Integers_Default) {
+    EXPECT_EQ(utf8(string_from_int32(0)), "0");
+    EXPECT_EQ(utf8(string_from_int32(-2147483647 - 1)), "-2147483648");
+    EXPECT_EQ(utf8(string_from_uint32(4294967295u)), "4294967295");
+    EXPECT_EQ(utf8(string_from_int64(std::numeric_limits<Int64>::min())), "-9223372036854775808");
+    EXPECT_EQ(utf8(string_from_uint64(std::numeric_limits<UInt64>::max())), "18446744073709551615");
+}
+
+TEST_F(FormatTest, Double_ShortestRoundTrip) {
+    EXPECT_EQ(utf8(string_from_double(0.1)), "0.1");
+    EXPECT_EQ(utf8(string_from_double(3.14159265358979)), "3.14159265358979");
+    EXPECT_EQ(utf8(string_from_double(1.0 / 3.0)), "0.3333333333333333");
+    EXPECT_EQ(utf8(string_from_double(100.0)), "100");
+    EXPECT_EQ(utf8(string_from_double(-0.0)), "-0");
+    EXPECT_EQ(utf8(string_from_double(0.0001)), "0.0001");
+    EXPECT_EQ(utf8(string_from_double(0.00001)), "1E-05");
+    EXPECT_EQ(utf8(string_from_double(1e15)), "1E+15");
+    EXPECT_EQ(utf8(string_from_double(123456789012345.0)), "123456789012345");
+    EXPECT_EQ(utf8(string_from_double(123456789012345678.0)), "1.2345678901234568E+17");
+    EXPECT_EQ(utf8(string_from_double(std::numeric_limits<Double>::max())), "1.7976931348623157E+308");
+}
+
+TEST_F(FormatTest, Double_NonFinite) {
+    EXPECT_EQ(utf8(string_from_double(std::nan(""))), "NaN");
+    EXPECT_EQ(utf8(string_from_double(INFINITY)), "Infinity");
+    EXPECT_EQ(utf8(string_from_double(-INFINITY)), "-Infinity");
+    EXPECT_EQ(fmt(FormatArg(-INFINITY), "F2"), "-Infinity");
+}
+
+TEST_F(FormatTest, Single_ShortestRoundTrip) {
+    EXPECT_EQ(utf8(string_from_single(0.1f)), "0.1");
+    EXPECT_EQ(utf8(string_from_single(3.4028235e38f)), "3.4028235E+38");
+    EXPECT_EQ(utf8(string_from_single(1234567.0f)), "1234567");
+    EXPECT_EQ(utf8(string_from_single(1e7f)), "1E+07");
+}
+
+// ===== Standard numeric formats =====
+
+TEST_F(FormatTest, Integer_StandardFormats) {
+    EXPECT_EQ(fmt(FormatArg(42), "D5"), "00042");
+    EXPECT_EQ(fmt(FormatArg(-42), "D5"), "-00042");
+    EXPECT_EQ(fmt(FormatArg(255), "X"), "FF");
+    EXPECT_EQ(fmt(FormatArg(255), "x4"), "00ff");
+    EXPECT_EQ(fmt(FormatArg(-1), "X"), "FFFFFFFF");
+    EXPECT_EQ(fmt(FormatArg(static_cast<SByte>(-1)), "X"), "FF");
+    EXPECT_EQ(fmt(FormatArg(static_cast<Int64>(-1)), "X"), "FFFFFFFFFFFFFFFF");
+    EXPECT_EQ(fmt(FormatArg(1234567), "N"), "1,234,567.00");
+    EXPECT_EQ(fmt(FormatArg(-1234567), "N0"), "-1,234,567");
+    EXPECT_EQ(fmt(FormatArg(42), "F3"), "42.000");
+    EXPECT_EQ(fmt(FormatArg(12345), "E2"), "1.23E+004");
+    EXPECT_EQ(fmt(FormatArg(12355), "e2"), "1.24e+004");
+    EXPECT_EQ(fmt(FormatArg(12345), "G3"), "1.23E+04");
+    EXPECT_EQ(fmt(FormatArg(12345), "G"), "12345");
+    EXPECT_EQ(fmt(FormatArg(1), "P"), "100.00 %");
+    EXPECT_EQ(fmt(FormatArg(1234), "C"), "¤1,234.00");
+    EXPECT_EQ(fmt(FormatArg(-5), "C0"), "(¤5)");
+}
+
+TEST_F(FormatTest, Double_StandardFormats) {
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "F2"), "1234.57");
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "N1"), "1,234.6");
+    EXPECT_EQ(fmt(FormatArg(2.675), "F2"), "2.67");   // 2.67499999... in binary
+    EXPECT_EQ(fmt(FormatArg(-0.001), "F2"), "-0.00");
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "E"), "1.234568E+003");
+    EXPECT_EQ(fmt(FormatArg(0.000123), "e1"), "1.2e-004");
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "G6"), "1234.57");
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "G2"), "1.2E+03");
+    EXPECT_EQ(fmt(FormatArg(0.1 + 0.2), "R"), "0.30000000000000004");
+    EXPECT_EQ(fmt(FormatArg(0.125), "P1"), "12.5 %");
+    EXPECT_EQ(fmt(FormatArg(-1.5), "C"), "(¤1.50)");
+}
+
+TEST_F(FormatTest, InvalidStandardFormat_Throws) {
+    EXPECT_TRUE(throws_format("{0:X}", FormatArg(1.5)));
+    EXPECT_TRUE(throws_format("{0:D}", FormatArg(1.5)));
+    EXPECT_TRUE(throws_format("{0:R}", FormatArg(1)));
+    EXPECT_TRUE(throws_format("{0:K}", FormatArg(1)));
+}
+
+// ===== Custom numeric formats =====
+
+TEST_F(FormatTest, CustomFormats) {
+    EXPECT_EQ(fmt(FormatArg(1234.5678), "0.00"), "1234.57");
+    EXPECT_EQ(fmt(FormatArg(1234.5), "#,##0.00"), "1,234.50");
+    EXPECT_EQ(fmt(FormatArg(0.5), "#.##"), ".5");
+    EXPECT_EQ(fmt(FormatArg(7), "000"), "007");
+    EXPECT_EQ(fmt(FormatArg(1234567), "#,#"), "1,234,567");
+    EXPECT_EQ(fmt(FormatArg(1234567), "0,,"), "1");
+    EXPECT_EQ(fmt(FormatArg(0.256), "0.0%"), "25.6%");
+    EXPECT_EQ(fmt(FormatArg(42), "'#'0"), "#42");
+    EXPECT_EQ(fmt(FormatArg(-42), "0"), "-42");
+    EXPECT_EQ(fmt(FormatArg(-42), "0;(0)"), "(42)");
+    EXPECT_EQ(fmt(FormatArg(0), "0;(0);zero"), "zero");
+    EXPECT_EQ(fmt(FormatArg(1.5), "0.0 'kg'"), "1.5 kg");
+}
+
+// ===== Composite formatting =====
+
+TEST_F(FormatTest, Composite_AlignmentAndFormat) {
+    FormatArg args[] = {FormatArg(42), FormatArg(string_literal("ab")), FormatArg(3.14159)};
+    String* r = string_format(string_literal("[{0,5}][{1,-4}][{2,8:F2}][{0:X}]"), args, 3);
+    EXPECT_EQ(utf8(r), "[   42][ab  ][    3.14][2A]");
+}
+
+TEST_F(FormatTest, Composite_PrimitiveKinds) {
+    FormatArg args[] = {FormatArg(true), FormatArg(u'x'), FormatArg(nullptr),
+                        FormatArg(static_cast<UInt64>(18446744073709551615ull))};
+    String* r = string_format(string_literal("{0}|{1}|{2}|{3}"), args, 4);
+    EXPECT_EQ(utf8(r), "True|x||18446744073709551615");
+}
+
+TEST_F(FormatTest, Composite_BoxedPrimitivesInObjectArray) {
+    TypeInfo int_type = {};
+    int_type.name = "Int32";
+    int_type.namespace_name = "System";
+    int_type.full_name = "System.Int32";
+    int_type.flags = TypeFlags::ValueType | TypeFlags::Primitive;
+    TypeInfo double_type = int_type;
+    double_type.name = "Double";
+    double_type.full_name = "System.Double";
+
+    Array* args = array_create(&System::Object_TypeInfo, 2);
+    auto** items = static_cast<Object**>(array_data(args));
+    items[0] = box<Int32>(255, &int_type);
+    items[1] = box<Double>(0.1, &double_type);
+    String* r = string_format(string_literal("{0:X4} {1} {0,-4}|"), args);
+    EXPECT_EQ(utf8(r), "00FF 0.1 255 |");
+}
+
+TEST_F(FormatTest, Composite_EscapedBraces) {
+    FormatArg arg(7);
+    EXPECT_EQ(utf8(string_format(string_literal("{{{0}}}"), &arg, 1)), "{7}");
+}
+
+TEST_F(FormatTest, Composite_Malformed_Throws) {
+    FormatArg arg(1);
+    EXPECT_TRUE(throws_format("{1}", arg));      // index out of range
+    EXPECT_TRUE(throws_format("{0", arg));       // unterminated
+    EXPECT_TRUE(throws_format("{x}", arg));      // no index
+    EXPECT_TRUE(throws_format("a } b", arg));    // stray close brace
+    EXPECT_TRUE(throws_format("{0,}", arg));     // empty alignment
+}
+
+TEST_F(FormatTest, Composite_LongOutputSpillsToHeap) {
+    std::string big(1000, 'x');
+    FormatArg args[] = {FormatArg(string_literal(big.c_str())), FormatArg(5)};
+    String* r = string_format(string_literal("{0}{1,600}"), args, 2);
+    ASSERT_EQ(r->length, 1600);
+    EXPECT_EQ(r->chars[1599], u'5');
+    EXPECT_EQ(r->chars[1000], u' ');
+}
+
+// ===== ToString(format) / StringBuilder =====
+
+TEST_F(FormatTest, ToStringWithFormat) {
+    EXPECT_EQ(utf8(string_from_int32(255, string_literal("X2"))), "FF");
+    EXPECT_EQ(utf8(string_from_double(2.5, string_literal("0.000"))), "2.500");
+    EXPECT_EQ(utf8(string_from_int32(17, nullptr)), "17");
+    EXPECT_EQ(utf8(string_from_single(0.1f, string_literal("R"))), "0.1");
+}
+
+TEST_F(FormatTest, StringBuilder_AppendFormatUnboxed) {
+    auto* sb = string_builder_create();
+    string_builder_append_double(sb, 0.1);
+    FormatArg args[] = {FormatArg(1.5), FormatArg(-3)};
+    string_builder_append_format(sb, string_literal(" {0:F3} {1:D2}"), args, 2);
+    EXPECT_EQ(utf8(string_builder_to_string(sb)), "0.1 1.500 -03");
+}
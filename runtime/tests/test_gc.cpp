@@ -7,6 +7,10 @@
 #include <cil2cpp/object.h>
 #include <cil2cpp/type_info.h>
 #include <cil2cpp/array.h>
+#include <cil2cpp/icall.h>
+
+#include <cstdlib>
+#include <thread>
 
 #include <gc.h>
 
@@ -123,6 +127,170 @@ TEST_F(GCTest, GetStats_ReportsHeapSize) {
     EXPECT_GT(stats.total_allocated, 0u);
 }
 
+TEST_F(GCTest, GetStats_HeapFiguresConsistent) {
+    for (int i = 0; i < 10; i++) {
+        gc::alloc(TestType.instance_size, &TestType);
+    }
+    auto stats = gc::get_stats();
+    EXPECT_LE(stats.heap_in_use, stats.current_heap_size);
+    EXPECT_LE(stats.free_bytes, stats.current_heap_size);
+    EXPECT_LE(stats.total_freed, stats.total_allocated);
+}
+
+TEST_F(GCTest, GetStats_RecordsPausePerCollection) {
+    auto before = gc::get_stats();
+    gc::collect();
+    gc::collect();
+    auto after = gc::get_stats();
+    EXPECT_GE(after.pause_count, before.pause_count + 2);
+    EXPECT_GE(after.total_pause_time_ms, before.total_pause_time_ms);
+    EXPECT_GE(after.total_pause_time_ms, after.max_pause_time_ms);
+
+    size_t bucketed = 0;
+    for (size_t n : after.pause_histogram) bucketed += n;
+    EXPECT_EQ(bucketed, after.pause_count);
+}
+
+TEST_F(GCTest, PauseBucketLimits_Double) {
+    EXPECT_EQ(gc::pause_bucket_limit_us(0), 64u);
+    EXPECT_EQ(gc::pause_bucket_limit_us(1), 128u);
+    EXPECT_EQ(gc::pause_bucket_limit_us(gc::kPauseHistogramBuckets - 1), 64u << (gc::kPauseHistogramBuckets - 1));
+}
+
+TEST_F(GCTest, AllocatedBytes_CountsCallingThreadOnly) {
+    UInt64 before = gc::allocated_bytes_for_current_thread();
+    for (int i = 0; i < 10; i++) {
+        gc::alloc(TestType.instance_size, &TestType);
+    }
+    EXPECT_EQ(gc::allocated_bytes_for_current_thread() - before, 10 * TestType.instance_size);
+
+    UInt64 other_start = 1, other_end = 0;
+    std::thread worker([&] {
+        gc::register_thread();
+        other_start = gc::allocated_bytes_for_current_thread();
+        gc::alloc(64, &TestType);
+        other_end = gc::allocated_bytes_for_current_thread();
+        gc::unregister_thread();
+    });
+    worker.join();
+    EXPECT_EQ(other_start, 0u);
+    EXPECT_EQ(other_end, 64u);
+    EXPECT_EQ(gc::allocated_bytes_for_current_thread() - before, 10 * TestType.instance_size);
+}
+
+// ===== GCConfig =====
+
+static void set_env(const char* name, const char* value) {
+#ifdef _WIN32
+    _putenv_s(name, value ? value : "");
+#else
+    if (value) setenv(name, value, 1);
+    else unsetenv(name);
+#endif
+}
+
+static const char* const kGCEnvVars[] = {
+    "CIL2CPP_GC_INITIAL_HEAP", "CIL2CPP_GC_MAX_HEAP", "CIL2CPP_GC_FREE_SPACE_DIVISOR",
+    "CIL2CPP_GC_MARKERS", "CIL2CPP_GC_INCREMENTAL", "CIL2CPP_GC_FULL_FREQUENCY",
+};
+
+class GCConfigTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (auto* name : kGCEnvVars) set_env(name, nullptr);
+    }
+    void TearDown() override {
+        for (auto* name : kGCEnvVars) set_env(name, nullptr);
+        gc::init();
+    }
+};
+
+TEST_F(GCConfigTest, NoEnvironment_KeepsCompiledSettings) {
+    gc::GCConfig compiled;
+    compiled.max_heap_size = 1 << 30;
+    compiled.incremental = false;
+    auto config = gc::config_from_environment(compiled);
+    EXPECT_EQ(config.max_heap_size, size_t{1} << 30);
+    EXPECT_FALSE(config.incremental);
+    EXPECT_EQ(config.initial_heap_size, 0u);
+    EXPECT_EQ(config.full_collection_frequency, -1);
+}
+
+TEST_F(GCConfigTest, Environment_OverridesEverySetting) {
+    set_env("CIL2CPP_GC_INITIAL_HEAP", "64M");
+    set_env("CIL2CPP_GC_MAX_HEAP", "2g");
+    set_env("CIL2CPP_GC_FREE_SPACE_DIVISOR", "6");
+    set_env("CIL2CPP_GC_MARKERS", "2");
+    set_env("CIL2CPP_GC_INCREMENTAL", "off");
+    set_env("CIL2CPP_GC_FULL_FREQUENCY", "4");
+    gc::GCConfig compiled;
+    compiled.max_heap_size = 1 << 20;
+    auto config = gc::config_from_environment(compiled);
+    EXPECT_EQ(config.initial_heap_size, size_t{64} << 20);
+    EXPECT_EQ(config.max_heap_size, size_t{2} << 30);
+    EXPECT_EQ(config.free_space_divisor, 6u);
+    EXPECT_EQ(config.parallel_markers, 2);
+    EXPECT_FALSE(config.incremental);
+    EXPECT_EQ(config.full_collection_frequency, 4);
+}
+
+TEST_F(GCConfigTest, Environment_InvalidValuesIgnored) {
+    set_env("CIL2CPP_GC_MAX_HEAP", "lots");
+    set_env("CIL2CPP_GC_MARKERS", "0");
+    set_env("CIL2CPP_GC_INCREMENTAL", "maybe");
+    set_env("CIL2CPP_GC_FREE_SPACE_DIVISOR", "3x");
+    gc::GCConfig compiled;
+    compiled.max_heap_size = 4096;
+    auto config = gc::config_from_environment(compiled);
+    EXPECT_EQ(config.max_heap_size, 4096u);
+    EXPECT_EQ(config.parallel_markers, 0);
+    EXPECT_TRUE(config.incremental);
+    EXPECT_EQ(config.free_space_divisor, 0u);
+}
+
+TEST_F(GCConfigTest, Environment_OverflowingSizesIgnored) {
+    set_env("CIL2CPP_GC_INITIAL_HEAP", "17179869184G");
+    set_env("CIL2CPP_GC_MAX_HEAP", "18446744073709551615k");
+    gc::GCConfig compiled;
+    compiled.initial_heap_size = 1 << 20;
+    compiled.max_heap_size = 4096;
+    auto config = gc::config_from_environment(compiled);
+    EXPECT_EQ(config.initial_heap_size, size_t{1} << 20);
+    EXPECT_EQ(config.max_heap_size, 4096u);
+}
+
+TEST_F(GCConfigTest, Init_RecordsAppliedConfig) {
+    gc::GCConfig config;
+    config.initial_heap_size = 8 << 20;
+    config.free_space_divisor = 4;
+    config.full_collection_frequency = 10;
+    gc::init(config);
+    auto applied = gc::current_config();
+    EXPECT_EQ(applied.initial_heap_size, size_t{8} << 20);
+    EXPECT_EQ(applied.free_space_divisor, 4u);
+    EXPECT_EQ(applied.full_collection_frequency, 10);
+    EXPECT_GE(gc::get_stats().current_heap_size, size_t{8} << 20);
+}
+
+// ===== System.GC icalls =====
+
+TEST_F(GCTest, Icall_CollectionCount_TracksCollect) {
+    Int32 before = icall::GC_CollectionCount(0);
+    icall::GC_Collect();
+    icall::GC_Collect(2);
+    EXPECT_GE(icall::GC_CollectionCount(0), before + 2);
+    EXPECT_EQ(icall::GC_CollectionCount(2), icall::GC_CollectionCount(0));
+}
+
+TEST_F(GCTest, Icall_MemoryCounters) {
+    Int64 before = icall::GC_GetAllocatedBytesForCurrentThread();
+    gc::alloc_array(&TestType, 512);
+    Int64 after = icall::GC_GetAllocatedBytesForCurrentThread();
+    EXPECT_GE(after - before, static_cast<Int64>(512 * sizeof(void*)));
+    EXPECT_GT(icall::GC_GetTotalMemory(false), 0);
+    EXPECT_GE(icall::GC_GetTotalAllocatedBytes(false), after);
+}
+
 // Array allocation tests
 static TypeInfo IntElementType = {
     .name = "Int32",
@@ -0,0 +1,439 @@
+/**
+ * CIL2CPP Runtime Tests - LINQ query execution (linq.h)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <vector>
+
+using namespace cil2cpp;
+
+// === TypeInfo definitions for tests ===
+
+static TypeInfo LinqInt32Type = {
+    .name = "Int32", .namespace_name = "System", .full_name = "System.Int32",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Int32), .element_size = sizeof(Int32),
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+static TypeInfo LinqListIntType = {
+    .name = "List_Int32",
+    .namespace_name = "System.Collections.Generic",
+    .full_name = "System.Collections.Generic.List`1<System.Int32>",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(ListBase),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+#define LINQ_INTERFACE_TYPE(var, type_name, full)                                 \
+    static TypeInfo var = {                                                       \
+        .name = type_name, .namespace_name = "System.Collections.Generic",       \
+        .full_name = full,                                                        \
+        .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,        \
+        .instance_size = 0, .element_size = 0,                                    \
+        .flags = TypeFlags::Interface | TypeFlags::Abstract,                      \
+        .vtable = nullptr, .fields = nullptr, .field_count = 0,                   \
+        .methods = nullptr, .method_count = 0,                                    \
+        .default_ctor = nullptr, .finalizer = nullptr,                            \
+        .interface_vtables = nullptr, .interface_vtable_count = 0,                \
+    }
+
+LINQ_INTERFACE_TYPE(LinqIEnumerableInt, "IEnumerable", "System.Collections.Generic.IEnumerable`1<System.Int32>");
+LINQ_INTERFACE_TYPE(LinqIEnumeratorInt, "IEnumerator", "System.Collections.Generic.IEnumerator`1<System.Int32>");
+LINQ_INTERFACE_TYPE(LinqIEnumerator, "IEnumerator", "System.Collections.IEnumerator");
+LINQ_INTERFACE_TYPE(LinqIDisposable, "IDisposable", "System.IDisposable");
+
+#undef LINQ_INTERFACE_TYPE
+
+// A user IEnumerable<int> yielding 1..count, like a compiled iterator method
+
+struct CountingRange : Object {
+    Int32 count;
+};
+
+struct CountingEnumerator : Object {
+    Int32 current;
+    Int32 count;
+};
+
+static int g_disposed = 0;
+
+static Boolean Enumerator_MoveNext(Object* self) {
+    auto* e = static_cast<CountingEnumerator*>(self);
+    if (e->current >= e->count) return false;
+    e->current++;
+    return true;
+}
+
+static Int32 Enumerator_get_Current(Object* self) {
+    return static_cast<CountingEnumerator*>(self)->current;
+}
+
+static void Enumerator_Dispose(Object*) {
+    g_disposed++;
+}
+
+static void* enumerator_move_next[] = { reinterpret_cast<void*>(&Enumerator_MoveNext) };
+static void* enumerator_current[] = { reinterpret_cast<void*>(&Enumerator_get_Current) };
+static void* enumerator_dispose[] = { reinterpret_cast<void*>(&Enumerator_Dispose) };
+
+static InterfaceVTable enumerator_iface_vtables[] = {
+    { &LinqIEnumeratorInt, enumerator_current, 1 },
+    { &LinqIEnumerator, enumerator_move_next, 1 },
+    { &LinqIDisposable, enumerator_dispose, 1 },
+};
+
+static TypeInfo CountingEnumeratorType = {
+    .name = "CountingEnumerator", .namespace_name = "Tests", .full_name = "Tests.CountingEnumerator",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(CountingEnumerator), .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = enumerator_iface_vtables, .interface_vtable_count = 3,
+};
+
+static Object* Range_GetEnumerator(Object* self) {
+    auto* e = static_cast<CountingEnumerator*>(object_alloc(&CountingEnumeratorType));
+    e->current = 0;
+    e->count = static_cast<CountingRange*>(self)->count;
+    return e;
+}
+
+static void* range_get_enumerator[] = { reinterpret_cast<void*>(&Range_GetEnumerator) };
+
+static InterfaceVTable range_iface_vtables[] = {
+    { &LinqIEnumerableInt, range_get_enumerator, 1 },
+};
+
+static TypeInfo CountingRangeType = {
+    .name = "CountingRange", .namespace_name = "Tests", .full_name = "Tests.CountingRange",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(CountingRange), .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = range_iface_vtables, .interface_vtable_count = 1,
+};
+
+static const LinqEnumerableTypes IntEnumerableTypes = {
+    &LinqIEnumerableInt, &LinqIEnumeratorInt, &LinqIEnumerator, &LinqIDisposable,
+};
+
+class LinqTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        g_disposed = 0;
+    }
+    void TearDown() override { runtime_shutdown(); }
+
+    static Array* MakeArray(std::initializer_list<Int32> values) {
+        Array* arr = array_create(&LinqInt32Type, static_cast<Int32>(values.size()));
+        Int32 i = 0;
+        for (Int32 v : values) array_set<Int32>(arr, i++, v);
+        return arr;
+    }
+
+    static ListBase* MakeList(std::initializer_list<Int32> values) {
+        auto* list = static_cast<ListBase*>(list_create(&LinqListIntType, &LinqInt32Type, 0));
+        for (Int32 v : values) list_add(list, &v);
+        return list;
+    }
+
+    static CountingRange* MakeRange(Int32 count) {
+        auto* range = static_cast<CountingRange*>(object_alloc(&CountingRangeType));
+        range->count = count;
+        return range;
+    }
+};
+
+// ===== linq_for_each =====
+
+TEST_F(LinqTest, ForEach_Array_VisitsInOrder) {
+    Array* arr = MakeArray({3, 1, 4, 1, 5});
+    std::vector<Int32> seen;
+    linq_for_each<Int32>(arr, &LinqListIntType, &IntEnumerableTypes, [&](Int32 e) {
+        seen.push_back(e);
+        return true;
+    });
+    EXPECT_EQ(seen, (std::vector<Int32>{3, 1, 4, 1, 5}));
+}
+
+TEST_F(LinqTest, ForEach_List_VisitsInOrder) {
+    auto* list = MakeList({2, 7, 1, 8});
+    std::vector<Int32> seen;
+    linq_for_each<Int32>(list, &LinqListIntType, nullptr, [&](Int32 e) {
+        seen.push_back(e);
+        return true;
+    });
+    EXPECT_EQ(seen, (std::vector<Int32>{2, 7, 1, 8}));
+}
+
+TEST_F(LinqTest, ForEach_Enumerable_VisitsAndDisposes) {
+    Int32 sum = 0;
+    linq_for_each<Int32>(MakeRange(4), &LinqListIntType, &IntEnumerableTypes, [&](Int32 e) {
+        sum += e;
+        return true;
+    });
+    EXPECT_EQ(sum, 10);
+    EXPECT_EQ(g_disposed, 1);
+}
+
+TEST_F(LinqTest, ForEach_StopsWhenBodyReturnsFalse) {
+    Int32 visited = 0;
+    linq_for_each<Int32>(MakeRange(100), nullptr, &IntEnumerableTypes, [&](Int32 e) {
+        visited++;
+        return e < 3;
+    });
+    EXPECT_EQ(visited, 3);
+    EXPECT_EQ(g_disposed, 1);
+
+    visited = 0;
+    linq_for_each<Int32>(MakeArray({1, 2, 3, 4}), nullptr, nullptr, [&](Int32) {
+        return ++visited < 2;
+    });
+    EXPECT_EQ(visited, 2);
+}
+
+TEST_F(LinqTest, ForEach_ListModifiedDuringQuery_Throws) {
+    auto* list = MakeList({1, 2, 3});
+    bool caught = false;
+    CIL2CPP_TRY
+        linq_for_each<Int32>(list, &LinqListIntType, nullptr, [&](Int32 e) {
+            list_add(list, &e);
+            return true;
+        });
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(LinqTest, ForEach_NullSource_Throws) {
+    bool caught = false;
+    CIL2CPP_TRY
+        linq_for_each<Int32>(nullptr, nullptr, nullptr, [](Int32) { return true; });
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+// ===== Count / Last =====
+
+TEST_F(LinqTest, Count_AllSourceKinds) {
+    EXPECT_EQ(linq_count(MakeArray({1, 2, 3}), &LinqListIntType, &IntEnumerableTypes), 3);
+    EXPECT_EQ(linq_count(MakeList({1, 2}), &LinqListIntType, &IntEnumerableTypes), 2);
+    EXPECT_EQ(linq_count(MakeRange(7), &LinqListIntType, &IntEnumerableTypes), 7);
+}
+
+TEST_F(LinqTest, Count_DisposesEnumerator) {
+    EXPECT_EQ(linq_count(MakeRange(3), &LinqListIntType, &IntEnumerableTypes), 3);
+    EXPECT_EQ(g_disposed, 1);
+}
+
+TEST_F(LinqTest, CountHint_ZeroForEnumerables) {
+    EXPECT_EQ(linq_count_hint(MakeArray({1, 2, 3}), &LinqListIntType, &IntEnumerableTypes), 3);
+    EXPECT_EQ(linq_count_hint(MakeList({1, 2}), &LinqListIntType, &IntEnumerableTypes), 2);
+    EXPECT_EQ(linq_count_hint(MakeRange(7), &LinqListIntType, &IntEnumerableTypes), 0);
+}
+
+TEST_F(LinqTest, TryGetLast) {
+    Int32 last = 0;
+    EXPECT_TRUE(linq_try_get_last(MakeArray({4, 5, 6}), nullptr, nullptr, last));
+    EXPECT_EQ(last, 6);
+    EXPECT_TRUE(linq_try_get_last(MakeList({9, 8}), &LinqListIntType, nullptr, last));
+    EXPECT_EQ(last, 8);
+    EXPECT_TRUE(linq_try_get_last(MakeRange(5), nullptr, &IntEnumerableTypes, last));
+    EXPECT_EQ(last, 5);
+    EXPECT_FALSE(linq_try_get_last(MakeArray({}), nullptr, nullptr, last));
+}
+
+// ===== Aggregates (vector kernels for arrays and lists) =====
+
+TEST_F(LinqTest, Sum_AllSourceKinds) {
+    EXPECT_EQ(linq_sum<Int32>(MakeArray({1, 2, 3}), &LinqListIntType, &IntEnumerableTypes), 6);
+    EXPECT_EQ(linq_sum<Int32>(MakeList({4, 5}), &LinqListIntType, &IntEnumerableTypes), 9);
+    EXPECT_EQ(linq_sum<Int32>(MakeRange(100), &LinqListIntType, &IntEnumerableTypes), 5050);
+    EXPECT_EQ(linq_sum<Int32>(MakeList({}), &LinqListIntType, &IntEnumerableTypes), 0);
+}
+
+TEST_F(LinqTest, Sum_Overflow_Throws) {
+    bool caught = false;
+    CIL2CPP_TRY
+        linq_sum<Int32>(MakeList({2147483647, 1, -1}), &LinqListIntType, nullptr);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(LinqTest, MinMaxAverage_AllSourceKinds) {
+    EXPECT_EQ(linq_min<Int32>(MakeArray({3, -1, 2}), nullptr, nullptr), -1);
+    EXPECT_EQ(linq_max<Int32>(MakeList({3, 9, 2}), &LinqListIntType, nullptr), 9);
+    EXPECT_EQ(linq_min<Int32>(MakeRange(5), nullptr, &IntEnumerableTypes), 1);
+    EXPECT_EQ(linq_max<Int32>(MakeRange(5), nullptr, &IntEnumerableTypes), 5);
+    EXPECT_EQ(linq_average<Int32>(MakeArray({1, 2}), nullptr, nullptr), 1.5);
+    EXPECT_EQ(linq_average<Int32>(MakeRange(4), nullptr, &IntEnumerableTypes), 2.5);
+}
+
+TEST_F(LinqTest, MinAverage_Empty_Throws) {
+    int caught = 0;
+    CIL2CPP_TRY
+        linq_min<Int32>(MakeList({}), &LinqListIntType, nullptr);
+    CIL2CPP_CATCH_ALL
+        caught++;
+    CIL2CPP_END_TRY
+    CIL2CPP_TRY
+        linq_average<Int32>(MakeRange(0), nullptr, &IntEnumerableTypes);
+    CIL2CPP_CATCH_ALL
+        caught++;
+    CIL2CPP_END_TRY
+    EXPECT_EQ(caught, 2);
+}
+
+TEST_F(LinqTest, Contains_AllSourceKinds) {
+    EXPECT_TRUE(linq_contains<Int32>(MakeArray({1, 2, 3}), nullptr, nullptr, 3));
+    EXPECT_FALSE(linq_contains<Int32>(MakeList({1, 2}), &LinqListIntType, nullptr, 3));
+    EXPECT_TRUE(linq_contains<Int32>(MakeRange(9), nullptr, &IntEnumerableTypes, 9));
+    EXPECT_EQ(g_disposed, 1);
+}
+
+// ===== Result builders =====
+
+TEST_F(LinqTest, ArrayBuilder_GrowsFromEmpty) {
+    LinqArrayBuilder<Int32> builder(&LinqInt32Type, 0);
+    for (Int32 i = 0; i < 11; i++) builder.add(i * i);
+    Array* result = builder.to_array();
+    ASSERT_EQ(result->length, 11);
+    EXPECT_EQ(result->element_type, &LinqInt32Type);
+    for (Int32 i = 0; i < 11; i++) EXPECT_EQ(array_get<Int32>(result, i), i * i);
+}
+
+TEST_F(LinqTest, ArrayBuilder_ExactCapacity_ReturnsBuffer) {
+    LinqArrayBuilder<Int32> builder(&LinqInt32Type, 3);
+    builder.add(1);
+    builder.add(2);
+    builder.add(3);
+    Array* first = builder.to_array();
+    EXPECT_EQ(first->length, 3);
+
+    // A filtered result shorter than the hint is copied to its exact length
+    LinqArrayBuilder<Int32> partial(&LinqInt32Type, 8);
+    partial.add(5);
+    Array* trimmed = partial.to_array();
+    ASSERT_EQ(trimmed->length, 1);
+    EXPECT_EQ(array_get<Int32>(trimmed, 0), 5);
+}
+
+TEST_F(LinqTest, ArrayBuilder_NothingAdded_EmptyArray) {
+    LinqArrayBuilder<Int32> builder(&LinqInt32Type, 0);
+    Array* result = builder.to_array();
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->length, 0);
+}
+
+TEST_F(LinqTest, Reverse_InPlace) {
+    Array* arr = linq_reverse<Int32>(MakeArray({1, 2, 3, 4}));
+    EXPECT_EQ(array_get<Int32>(arr, 0), 4);
+    EXPECT_EQ(array_get<Int32>(arr, 3), 1);
+}
+
+// ===== A fused chain as the compiler emits it =====
+
+TEST_F(LinqTest, FusedWhereSelectSum_MatchesEager) {
+    auto* list = MakeList({1, 2, 3, 4, 5, 6, 7, 8});
+    Int32 sum = 0;
+    linq_for_each<Int32>(list, &LinqListIntType, nullptr, [&](Int32 e0) -> bool {
+        if (e0 % 2 != 0) return true;
+        Int32 e1 = e0 * 6;
+        sum += e1;
+        return true;
+    });
+    EXPECT_EQ(sum, 120);
+}
+
+// ===== Deferred queries =====
+
+// xs.Where(x => x % 2 == 0).Select(x => x * 10) as an escaping query; the
+// "delegates" here are only carried through, the stages are inlined
+static bool EvenTimesTen(LinqCursor<Int32>& cursor, Object* const*, Int32& item) {
+    Int32 e0;
+    while (cursor.next(e0)) {
+        if (e0 % 2 != 0) continue;
+        item = e0 * 10;
+        return true;
+    }
+    return false;
+}
+
+static std::vector<Int32> EnumerateDeferred(Object* query) {
+    auto* get_enumerator = type_get_interface_vtable_checked(query->__type_info, &LinqIEnumerableInt);
+    auto* e = reinterpret_cast<Object* (*)(Object*)>(get_enumerator->methods[0])(query);
+    auto move_next = reinterpret_cast<Boolean (*)(Object*)>(
+        type_get_interface_vtable_checked(e->__type_info, &LinqIEnumerator)->methods[0]);
+    auto current = reinterpret_cast<Int32 (*)(Object*)>(
+        type_get_interface_vtable_checked(e->__type_info, &LinqIEnumeratorInt)->methods[0]);
+    std::vector<Int32> seen;
+    while (move_next(e)) seen.push_back(current(e));
+    EXPECT_FALSE(move_next(e));
+    return seen;
+}
+
+TEST_F(LinqTest, Deferred_ListSource_SeesLaterChanges) {
+    static const LinqDeferredType<Int32, Int32> type(IntEnumerableTypes, nullptr, &LinqInt32Type,
+                                                     &LinqListIntType, &IntEnumerableTypes, &EvenTimesTen);
+    auto* list = MakeList({1, 2, 3});
+    Object* query = type.create(list, {});
+    Int32 value = 4;
+    list_add(list, &value);   // after the query is created, before it runs
+
+    EXPECT_EQ(EnumerateDeferred(query), (std::vector<Int32>{20, 40}));
+    // Each enumeration walks the source again
+    value = 6;
+    list_add(list, &value);
+    EXPECT_EQ(EnumerateDeferred(query), (std::vector<Int32>{20, 40, 60}));
+}
+
+TEST_F(LinqTest, Deferred_EnumerableSource_DisposedAtEnd) {
+    static const LinqDeferredType<Int32, Int32> type(IntEnumerableTypes, nullptr, &LinqInt32Type,
+                                                     &LinqListIntType, &IntEnumerableTypes, &EvenTimesTen);
+    Object* query = type.create(MakeRange(5), {});
+    EXPECT_EQ(g_disposed, 0);   // nothing runs at creation
+    EXPECT_EQ(EnumerateDeferred(query), (std::vector<Int32>{20, 40}));
+    EXPECT_EQ(g_disposed, 1);
+}
+
+TEST_F(LinqTest, Deferred_QueryIsLinqSource) {
+    static const LinqDeferredType<Int32, Int32> type(IntEnumerableTypes, nullptr, &LinqInt32Type,
+                                                     &LinqListIntType, &IntEnumerableTypes, &EvenTimesTen);
+    Object* query = type.create(MakeArray({1, 2, 3, 4, 5, 6}), {});
+    EXPECT_EQ(linq_sum<Int32>(query, &LinqListIntType, &IntEnumerableTypes), 120);
+    EXPECT_EQ(linq_count(query, &LinqListIntType, &IntEnumerableTypes), 3);
+}
+
+TEST_F(LinqTest, Deferred_NullSource_Throws) {
+    static const LinqDeferredType<Int32, Int32> type(IntEnumerableTypes, nullptr, &LinqInt32Type,
+                                                     &LinqListIntType, &IntEnumerableTypes, &EvenTimesTen);
+    bool caught = false;
+    CIL2CPP_TRY
+        type.create(nullptr, {});
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
@@ -297,3 +297,23 @@ TEST_F(ObjectTest, Cast_NullObject_ReturnsNull) {
     Object* result = object_cast(nullptr, &TestObjType);
     EXPECT_EQ(result, nullptr);
 }
+
+// ===== object_init_stack =====
+
+TEST_F(ObjectTest, InitStack_ZeroesAndSetsHeader) {
+    struct { Object header; Int64 payload; } storage;
+    std::memset(&storage, 0xAB, sizeof(storage));
+    Object* obj = object_init_stack(&storage, sizeof(storage), &DerivedType);
+    EXPECT_EQ(static_cast<void*>(obj), static_cast<void*>(&storage));
+    EXPECT_EQ(obj->__type_info, &DerivedType);
+    EXPECT_EQ(obj->__sync_block, 0u);
+    EXPECT_EQ(storage.payload, 0);
+}
+
+TEST_F(ObjectTest, InitStack_TypeChecksLikeHeapObject) {
+    struct { Object header; Int64 payload; } storage;
+    Object* obj = object_init_stack(&storage, sizeof(storage), &DerivedType);
+    EXPECT_TRUE(object_is_instance_of(obj, &BaseType));
+    EXPECT_EQ(object_as(obj, &BaseType), obj);
+    EXPECT_EQ(object_get_type(obj), &DerivedType);
+}
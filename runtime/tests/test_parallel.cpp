@@ -0,0 +1,310 @@
+/**
+ * CIL2CPP Runtime Tests - Fork-join loops and PLINQ reductions (parallel.h)
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+static TypeInfo ParInt32Type = {
+    .name = "Int32", .namespace_name = "System", .full_name = "System.Int32",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(Int32), .element_size = sizeof(Int32),
+    .flags = TypeFlags::ValueType | TypeFlags::Primitive,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+static TypeInfo ParListIntType = {
+    .name = "List_Int32",
+    .namespace_name = "System.Collections.Generic",
+    .full_name = "System.Collections.Generic.List`1<System.Int32>",
+    .base_type = nullptr, .interfaces = nullptr, .interface_count = 0,
+    .instance_size = sizeof(ListBase),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr, .fields = nullptr, .field_count = 0,
+    .methods = nullptr, .method_count = 0,
+    .default_ctor = nullptr, .finalizer = nullptr,
+    .interface_vtables = nullptr, .interface_vtable_count = 0,
+};
+
+class ParallelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        // A fixed pool size, so the loops really fork whatever the host has
+        threadpool::shutdown();
+        threadpool::init(kWorkers);
+    }
+    void TearDown() override { runtime_shutdown(); }
+
+    static constexpr int kWorkers = 4;
+
+    static Array* MakeArray(Int32 n) {
+        Array* arr = array_create(&ParInt32Type, n);
+        for (Int32 i = 0; i < n; i++) array_set<Int32>(arr, i, i + 1);
+        return arr;
+    }
+
+    static ListBase* MakeList(Int32 n) {
+        auto* list = static_cast<ListBase*>(list_create(&ParListIntType, &ParInt32Type, 0));
+        for (Int32 i = 1; i <= n; i++) list_add(list, &i);
+        return list;
+    }
+};
+
+// ===== for_range =====
+
+TEST_F(ParallelTest, For_VisitsEveryIndexOnce) {
+    const Int64 n = 100'003;
+    std::vector<std::atomic<Int32>> hits(n);
+    auto result = parallel::for_range(0, n, {}, [&](Int64 lo, Int64 hi, Int32) {
+        for (Int64 i = lo; i < hi; i++) hits[i].fetch_add(1, std::memory_order_relaxed);
+    });
+    EXPECT_TRUE(result.f_isCompleted);
+    for (Int64 i = 0; i < n; i++) ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+}
+
+TEST_F(ParallelTest, For_NonZeroStart) {
+    std::atomic<Int64> sum{0};
+    parallel::for_range(-50, 50, {}, [&](Int64 lo, Int64 hi, Int32) {
+        Int64 local = 0;
+        for (Int64 i = lo; i < hi; i++) local += i;
+        sum += local;
+    });
+    EXPECT_EQ(sum.load(), -50);
+}
+
+TEST_F(ParallelTest, For_EmptyRange_DoesNothing) {
+    bool called = false;
+    auto result = parallel::for_range(5, 5, {}, [&](Int64, Int64, Int32) { called = true; });
+    EXPECT_FALSE(called);
+    EXPECT_TRUE(result.f_isCompleted);
+}
+
+TEST_F(ParallelTest, For_UnevenWork_IsStolen) {
+    // All the cost sits in the first participant's range; the others finish
+    // their own ranges at once and must steal to help
+    const Int64 n = 4'000;
+    std::vector<std::atomic<Int32>> hits(n);
+    std::atomic<Int32> workers_seen{0};
+    std::vector<std::atomic<bool>> seen(kWorkers + 1);
+    parallel::for_range(0, n, {}, [&](Int64 lo, Int64 hi, Int32 worker) {
+        if (!seen[worker].exchange(true)) workers_seen++;
+        for (Int64 i = lo; i < hi; i++) {
+            if (i < n / 4) std::this_thread::sleep_for(std::chrono::microseconds(50));
+            hits[i]++;
+        }
+    });
+    for (Int64 i = 0; i < n; i++) ASSERT_EQ(hits[i].load(), 1);
+    EXPECT_GE(workers_seen.load(), 1);
+}
+
+TEST_F(ParallelTest, For_DegreeOne_RunsOnCaller) {
+    const auto caller = std::this_thread::get_id();
+    bool other_thread = false;
+    parallel::LoopOptions options;
+    options.max_degree = 1;
+    parallel::for_range(0, 10'000, options, [&](Int64, Int64, Int32 worker) {
+        if (std::this_thread::get_id() != caller || worker != 0) other_thread = true;
+    });
+    EXPECT_FALSE(other_thread);
+}
+
+TEST_F(ParallelTest, DegreeFor_CapsAtWorkersAndCount) {
+    EXPECT_EQ(parallel::degree_for(1'000, {}), kWorkers);
+    EXPECT_EQ(parallel::degree_for(2, {}), 2);
+    parallel::LoopOptions options;
+    options.max_degree = 64;
+    EXPECT_EQ(parallel::degree_for(1'000, options), kWorkers + 1);
+    options.max_degree = 3;
+    EXPECT_EQ(parallel::degree_for(1'000, options), 3);
+}
+
+// ===== Exceptions and cancellation =====
+
+TEST_F(ParallelTest, For_Exception_IsAggregated) {
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        parallel::for_range(0, 1'000, {}, [&](Int64 lo, Int64 hi, Int32) {
+            for (Int64 i = lo; i < hi; i++)
+                if (i == 500) throw_invalid_operation();
+        });
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    ASSERT_EQ(caught->__type_info, &AggregateException_TypeInfo);
+    auto* aggregate = static_cast<AggregateException*>(caught);
+    ASSERT_NE(aggregate->inner_exceptions, nullptr);
+    ASSERT_EQ(array_length(aggregate->inner_exceptions), 1);
+    Exception* inner = array_get<Exception*>(aggregate->inner_exceptions, 0);
+    EXPECT_EQ(inner->__type_info, &InvalidOperationException_TypeInfo);
+    EXPECT_EQ(aggregate->inner_exception, inner);
+}
+
+TEST_F(ParallelTest, For_ExceptionOnEveryParticipant_CollectsAll) {
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        parallel::for_range(0, 1'000, {}, [&](Int64, Int64, Int32) { throw_format(); });
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    auto* aggregate = static_cast<AggregateException*>(caught);
+    Int32 count = array_length(aggregate->inner_exceptions);
+    EXPECT_GE(count, 1);
+    EXPECT_LE(count, kWorkers);
+    for (Int32 i = 0; i < count; i++)
+        EXPECT_EQ(array_get<Exception*>(aggregate->inner_exceptions, i)->__type_info, &FormatException_TypeInfo);
+}
+
+TEST_F(ParallelTest, For_HugeRange_PartitionsAreDisjoint) {
+    constexpr Int64 from = -10, to = INT64_MAX - 10;
+    const size_t degree = static_cast<size_t>(parallel::degree_for(to - from, {}));
+    std::mutex mutex;
+    std::vector<std::pair<Int64, Int64>> chunks;
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        // Each participant records its first chunk, waits for the others and
+        // throws, so nobody walks the range or steals from a neighbour
+        parallel::for_range(from, to, {}, [&](Int64 lo, Int64 hi, Int32) {
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                chunks.emplace_back(lo, hi);
+            }
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (std::chrono::steady_clock::now() < deadline) {
+                std::lock_guard<std::mutex> guard(mutex);
+                if (chunks.size() >= degree) break;
+            }
+            throw_format();
+        });
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    ASSERT_EQ(chunks.size(), degree);
+    std::sort(chunks.begin(), chunks.end());
+    for (auto [lo, hi] : chunks) {
+        EXPECT_LE(from, lo);
+        EXPECT_LT(lo, hi);
+        EXPECT_LE(hi, to);
+    }
+    for (size_t i = 1; i < chunks.size(); i++) EXPECT_LE(chunks[i - 1].second, chunks[i].first);
+}
+
+TEST_F(ParallelTest, For_CanceledBeforeStart_Throws) {
+    auto* cts = cts_create();
+    cts_cancel(cts);
+    parallel::LoopOptions options;
+    options.token = cts_get_token(cts);
+    bool called = false;
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        parallel::for_range(0, 100, options, [&](Int64, Int64, Int32) { called = true; });
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    EXPECT_FALSE(called);
+    ASSERT_NE(caught, nullptr);
+    EXPECT_EQ(caught->__type_info, &OperationCanceledException_TypeInfo);
+}
+
+TEST_F(ParallelTest, For_CanceledDuringLoop_StopsEarly) {
+    auto* cts = cts_create();
+    parallel::LoopOptions options;
+    options.token = cts_get_token(cts);
+    std::atomic<Int64> visited{0};
+    Exception* caught = nullptr;
+    CIL2CPP_TRY
+        parallel::for_range(0, 1'000'000, options, [&](Int64 lo, Int64 hi, Int32) {
+            visited += hi - lo;
+            cts_cancel(cts);
+        });
+    CIL2CPP_CATCH_ALL
+        caught = get_current_exception();
+    CIL2CPP_END_TRY
+    ASSERT_NE(caught, nullptr);
+    EXPECT_EQ(caught->__type_info, &OperationCanceledException_TypeInfo);
+    EXPECT_LT(visited.load(), 1'000'000);
+}
+
+TEST_F(ParallelTest, OptionsOf_CopiesTokenAndDegree) {
+    auto* options = parallel_options_create();
+    EXPECT_EQ(options->f_maxDegreeOfParallelism, -1);
+    options->f_maxDegreeOfParallelism = 2;
+    parallel::LoopOptions loop = parallel::options_of(options);
+    EXPECT_EQ(loop.max_degree, 2);
+    EXPECT_FALSE(ct_can_be_canceled(loop.token));
+}
+
+// ===== reduce / for_each / linq_parallel_reduce =====
+
+TEST_F(ParallelTest, Reduce_SumsRange) {
+    Int64 sum = parallel::reduce<Int64>(1, 1'000'001, 0, {},
+        [](Int64& acc, Int64 lo, Int64 hi) {
+            for (Int64 i = lo; i < hi; i++) acc += i;
+        },
+        [](Int64 a, Int64 b) { return a + b; });
+    EXPECT_EQ(sum, 500'000'500'000LL);
+}
+
+TEST_F(ParallelTest, Reduce_EmptyRange_ReturnsIdentity) {
+    Int32 r = parallel::reduce<Int32>(0, 0, 42, {},
+        [](Int32&, Int64, Int64) {}, [](Int32 a, Int32 b) { return a + b; });
+    EXPECT_EQ(r, 42);
+}
+
+TEST_F(ParallelTest, ForEach_Array_VisitsEveryElement) {
+    Array* arr = MakeArray(10'000);
+    std::atomic<Int64> sum{0};
+    parallel::for_each<Int32>(arr, &ParListIntType, nullptr, {}, [&](Int32 e) { sum += e; });
+    EXPECT_EQ(sum.load(), 50'005'000);
+}
+
+TEST_F(ParallelTest, ForEach_List_VisitsEveryElement) {
+    auto* list = MakeList(1'000);
+    std::atomic<Int64> sum{0};
+    parallel::for_each<Int32>(list, &ParListIntType, nullptr, {}, [&](Int32 e) { sum += e; });
+    EXPECT_EQ(sum.load(), 500'500);
+}
+
+TEST_F(ParallelTest, LinqParallelReduce_FilteredSum) {
+    Array* arr = MakeArray(100'000);
+    Int64 evens = linq_parallel_reduce<Int32>(arr, &ParListIntType, nullptr, {}, Int64{0},
+        [](Int64& acc, Int32 e) {
+            if (e % 2 == 0) acc += e;
+            return true;
+        },
+        [](Int64 a, Int64 b) { return a + b; });
+    EXPECT_EQ(evens, 2'500'050'000LL);
+}
+
+TEST_F(ParallelTest, LinqParallelReduce_SeedlessAggregate) {
+    Array* arr = MakeArray(1'000);
+    auto max = linq_parallel_reduce<Int32>(arr, &ParListIntType, nullptr, {}, LinqPartial<Int32>{0, false},
+        [](LinqPartial<Int32>& acc, Int32 e) {
+            acc.value = acc.has_value && acc.value > e ? acc.value : e;
+            acc.has_value = true;
+            return true;
+        },
+        [](LinqPartial<Int32> a, LinqPartial<Int32> b) {
+            if (!a.has_value) return b;
+            if (!b.has_value) return a;
+            return LinqPartial<Int32>{a.value > b.value ? a.value : b.value, true};
+        });
+    EXPECT_TRUE(max.has_value);
+    EXPECT_EQ(max.value, 1'000);
+}
@@ -0,0 +1,292 @@
+/**
+ * CIL2CPP Runtime Tests - StringBuilder and N-ary string_concat
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+#include <string>
+
+using namespace cil2cpp;
+
+class StringBuilderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+    }
+
+    void TearDown() override {
+        runtime_shutdown();
+    }
+
+    static std::u16string str(String* s) {
+        return s ? std::u16string(s->chars, s->chars + s->length) : std::u16string();
+    }
+
+    static std::u16string contents(StringBuilder* sb) {
+        return str(string_builder_to_string(sb));
+    }
+
+    static String* lit(const char* s) {
+        return string_literal(s);
+    }
+};
+
+// ===== Construction / Append =====
+
+TEST_F(StringBuilderTest, Create_Empty) {
+    auto* sb = string_builder_create();
+    EXPECT_EQ(string_builder_get_length(sb), 0);
+    EXPECT_GE(string_builder_get_capacity(sb), 16);
+    EXPECT_EQ(contents(sb), u"");
+    EXPECT_EQ(sb->__type_info, &StringBuilder_TypeInfo);
+}
+
+TEST_F(StringBuilderTest, Create_FromString) {
+    auto* sb = string_builder_create(lit("seed"));
+    EXPECT_EQ(contents(sb), u"seed");
+}
+
+TEST_F(StringBuilderTest, Append_Strings_AcrossChunks) {
+    auto* sb = string_builder_create();
+    std::u16string expected;
+    for (int i = 0; i < 1000; i++) {
+        string_builder_append(sb, lit("abc"));
+        expected += u"abc";
+    }
+    EXPECT_EQ(string_builder_get_length(sb), 3000);
+    EXPECT_NE(sb->chunk->previous, nullptr);  // grew by linking chunks
+    EXPECT_EQ(contents(sb), expected);
+}
+
+TEST_F(StringBuilderTest, Append_NullIsNoOp) {
+    auto* sb = string_builder_create();
+    string_builder_append(sb, static_cast<String*>(nullptr));
+    string_builder_append_object(sb, nullptr);
+    EXPECT_EQ(string_builder_get_length(sb), 0);
+}
+
+TEST_F(StringBuilderTest, Append_Primitives) {
+    auto* sb = string_builder_create();
+    string_builder_append_int32(sb, -42);
+    string_builder_append_char(sb, u',');
+    string_builder_append_uint32(sb, 4000000000u);
+    string_builder_append_char(sb, u',');
+    string_builder_append_int64(sb, INT64_MIN);
+    string_builder_append_char(sb, u',');
+    string_builder_append_uint64(sb, UINT64_MAX);
+    string_builder_append_char(sb, u',');
+    string_builder_append_double(sb, 3.5);
+    string_builder_append_char(sb, u',');
+    string_builder_append_single(sb, 0.1f);
+    string_builder_append_char(sb, u',');
+    string_builder_append_bool(sb, true);
+    string_builder_append_bool(sb, false);
+    EXPECT_EQ(contents(sb),
+              u"-42,4000000000,-9223372036854775808,18446744073709551615,3.5,0.1,TrueFalse");
+}
+
+TEST_F(StringBuilderTest, Append_CharRepeatAndSubstring) {
+    auto* sb = string_builder_create();
+    string_builder_append_char(sb, u'-', 40);
+    string_builder_append(sb, lit("hello world"), 6, 5);
+    EXPECT_EQ(contents(sb), std::u16string(40, u'-') + u"world");
+}
+
+TEST_F(StringBuilderTest, Append_Object_UsesStringValue) {
+    auto* sb = string_builder_create();
+    string_builder_append_object(sb, reinterpret_cast<Object*>(lit("text")));
+    auto* other = string_builder_create(lit("+sb"));
+    string_builder_append_object(sb, reinterpret_cast<Object*>(other));
+    EXPECT_EQ(contents(sb), u"text+sb");
+}
+
+TEST_F(StringBuilderTest, Append_Self_DoublesContents) {
+    auto* sb = string_builder_create(4);
+    string_builder_append(sb, lit("abcdef"));
+    string_builder_append_builder(sb, sb);
+    EXPECT_EQ(contents(sb), u"abcdefabcdef");
+}
+
+TEST_F(StringBuilderTest, AppendLine) {
+    auto* sb = string_builder_create();
+    string_builder_append_line(sb, lit("a"));
+    string_builder_append_line(sb);
+#ifdef _WIN32
+    EXPECT_EQ(contents(sb), u"a\r\n\r\n");
+#else
+    EXPECT_EQ(contents(sb), u"a\n\n");
+#endif
+}
+
+// ===== Editing =====
+
+TEST_F(StringBuilderTest, Insert_Middle_AcrossChunks) {
+    auto* sb = string_builder_create();
+    for (int i = 0; i < 20; i++) string_builder_append(sb, lit("0123456789"));
+    string_builder_insert(sb, 5, lit("XY"));
+    string_builder_insert_char(sb, 0, u'[');
+    auto s = contents(sb);
+    EXPECT_EQ(s.size(), 203u);
+    EXPECT_EQ(s.substr(0, 10), u"[01234XY56");
+}
+
+TEST_F(StringBuilderTest, Remove_MiddleAndTail) {
+    auto* sb = string_builder_create(lit("hello cruel world"));
+    string_builder_remove(sb, 5, 6);
+    EXPECT_EQ(contents(sb), u"hello world");
+    string_builder_remove(sb, 5, 6);
+    EXPECT_EQ(contents(sb), u"hello");
+}
+
+TEST_F(StringBuilderTest, Replace_String_GrowShrinkSame) {
+    auto* sb = string_builder_create(lit("a-b-c-d"));
+    string_builder_replace(sb, lit("-"), lit("--"));
+    EXPECT_EQ(contents(sb), u"a--b--c--d");
+    string_builder_replace(sb, lit("--"), lit(""));
+    EXPECT_EQ(contents(sb), u"abcd");
+    string_builder_replace(sb, lit("bc"), lit("XY"));
+    EXPECT_EQ(contents(sb), u"aXYd");
+}
+
+TEST_F(StringBuilderTest, Replace_RangeOnly) {
+    auto* sb = string_builder_create(lit("aaaa"));
+    string_builder_replace(sb, lit("a"), lit("b"), 1, 2);
+    EXPECT_EQ(contents(sb), u"abba");
+    string_builder_replace_char(sb, u'a', u'c', 0, 1);
+    EXPECT_EQ(contents(sb), u"cbba");
+    string_builder_replace_char(sb, u'b', u'z');
+    EXPECT_EQ(contents(sb), u"czza");
+}
+
+TEST_F(StringBuilderTest, Length_TruncateAndPad) {
+    auto* sb = string_builder_create();
+    for (int i = 0; i < 50; i++) string_builder_append(sb, lit("xyz"));
+    string_builder_set_length(sb, 4);
+    EXPECT_EQ(contents(sb), u"xyzx");
+    string_builder_append(sb, lit("!"));
+    EXPECT_EQ(contents(sb), u"xyzx!");
+    string_builder_set_length(sb, 7);
+    EXPECT_EQ(contents(sb), std::u16string(u"xyzx!\0\0", 7));
+}
+
+TEST_F(StringBuilderTest, Indexer_GetSet) {
+    auto* sb = string_builder_create(2);
+    for (int i = 0; i < 100; i++) string_builder_append_char(sb, static_cast<Char>(u'a' + i % 26));
+    EXPECT_EQ(string_builder_get_char(sb, 0), u'a');
+    EXPECT_EQ(string_builder_get_char(sb, 99), static_cast<Char>(u'a' + 99 % 26));
+    string_builder_set_char(sb, 50, u'#');
+    EXPECT_EQ(string_builder_get_char(sb, 50), u'#');
+}
+
+TEST_F(StringBuilderTest, Clear_KeepsCapacity) {
+    auto* sb = string_builder_create();
+    for (int i = 0; i < 100; i++) string_builder_append(sb, lit("0123456789"));
+    string_builder_clear(sb);
+    EXPECT_EQ(string_builder_get_length(sb), 0);
+    EXPECT_EQ(sb->chunk->previous, nullptr);
+    EXPECT_GE(string_builder_get_capacity(sb), 1000);
+}
+
+TEST_F(StringBuilderTest, IndexOutOfRange_Throws) {
+    auto* sb = string_builder_create(lit("abc"));
+    bool caught = false;
+    CIL2CPP_TRY
+        string_builder_get_char(sb, 3);
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+}
+
+TEST_F(StringBuilderTest, MaxCapacity_Enforced) {
+    auto* sb = string_builder_create(4, 8);
+    string_builder_append(sb, lit("12345678"));
+    bool caught = false;
+    CIL2CPP_TRY
+        string_builder_append_char(sb, u'9');
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    EXPECT_TRUE(caught);
+    EXPECT_EQ(contents(sb), u"12345678");
+}
+
+// ===== ToString =====
+
+TEST_F(StringBuilderTest, ToString_SingleFullChunk_IsZeroCopy) {
+    auto* sb = string_builder_create(8);
+    string_builder_append(sb, lit("abcdefgh"));
+    String* a = string_builder_to_string(sb);
+    EXPECT_EQ(a, sb->chunk->buffer);
+    EXPECT_EQ(string_builder_to_string(sb), a);  // unchanged builder: same string
+
+    // Further edits must not disturb the handed-out string
+    string_builder_append(sb, lit("ij"));
+    string_builder_set_char(sb, 0, u'X');
+    EXPECT_EQ(str(a), u"abcdefgh");
+    EXPECT_EQ(contents(sb), u"Xbcdefghij");
+}
+
+TEST_F(StringBuilderTest, ToString_SingleChunk_InPlaceEditsCopyFirst) {
+    auto* sb = string_builder_create(16);
+    string_builder_append(sb, lit("hello world"));
+    String* s = string_builder_to_string(sb);
+    ASSERT_EQ(s, sb->chunk->buffer);
+
+    string_builder_replace_char(sb, u'o', u'0');
+    EXPECT_EQ(str(s), u"hello world");
+    EXPECT_EQ(contents(sb), u"hell0 w0rld");
+
+    String* t = string_builder_to_string(sb);
+    string_builder_replace(sb, lit("ll"), lit("LL"));
+    EXPECT_EQ(str(t), u"hell0 w0rld");
+
+    String* u = string_builder_to_string(sb);
+    string_builder_remove(sb, 0, 2);
+    EXPECT_EQ(str(u), u"heLL0 w0rld");
+
+    String* v = string_builder_to_string(sb);
+    string_builder_set_char(sb, 0, u'X');
+    EXPECT_EQ(str(v), u"LL0 w0rld");
+    EXPECT_EQ(contents(sb), u"XL0 w0rld");
+}
+
+TEST_F(StringBuilderTest, ToString_MultiChunk_CopiesOnce) {
+    auto* sb = string_builder_create(4);
+    string_builder_append(sb, lit("abcd"));
+    string_builder_append(sb, lit("efghij"));
+    String* s = string_builder_to_string(sb);
+    EXPECT_NE(s, sb->chunk->buffer);
+    EXPECT_EQ(str(s), u"abcdefghij");
+    EXPECT_EQ(str(string_builder_to_string(sb, 2, 5)), u"cdefg");
+}
+
+// ===== N-ary string_concat =====
+
+TEST_F(StringBuilderTest, Concat4_SingleAllocation) {
+    String* r = string_concat(lit("a"), lit("bc"), nullptr, lit("def"));
+    EXPECT_EQ(str(r), u"abcdef");
+}
+
+TEST_F(StringBuilderTest, Concat_OnlyOneNonEmpty_ReturnsIt) {
+    String* b = lit("only");
+    EXPECT_EQ(string_concat(nullptr, b, string_literal("")), b);
+    EXPECT_EQ(string_concat(nullptr, nullptr, nullptr), nullptr);
+}
+
+TEST_F(StringBuilderTest, ConcatArray_Strings) {
+    Array* arr = array_create(&System::String_TypeInfo, 5);
+    auto** items = static_cast<String**>(array_data(arr));
+    const char* parts[] = {"one", " ", "two", " ", "three"};
+    for (int i = 0; i < 5; i++) items[i] = lit(parts[i]);
+    EXPECT_EQ(str(string_concat_array(arr)), u"one two three");
+}
+
+TEST_F(StringBuilderTest, ConcatObjArray_ManyParts) {
+    Array* arr = array_create(&System::Object_TypeInfo, 20);
+    auto** items = static_cast<Object**>(array_data(arr));
+    for (int i = 0; i < 20; i++) items[i] = reinterpret_cast<Object*>(lit(i % 2 ? "b" : "a"));
+    std::u16string expected;
+    for (int i = 0; i < 10; i++) expected += u"ab";
+    EXPECT_EQ(str(string_concat_obj_array(arr)), expected);
+}
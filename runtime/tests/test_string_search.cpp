@@ -0,0 +1,188 @@
+/**
+ * CIL2CPP Runtime Tests - String search / compare kernels
+ *
+ * Kernel cases run once per SIMD level available on this machine; haystacks
+ * are long enough to cover the vector loops and their scalar tails.
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+#include <string>
+
+using namespace cil2cpp;
+
+class StringSearchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        saved_ = simd::level();
+    }
+
+    void TearDown() override {
+        simd::set_level(saved_);
+        runtime_shutdown();
+    }
+
+    template<typename F>
+    void for_each_level(F&& fn) {
+        for (int l = 0; l <= static_cast<int>(simd::detected()); l++) {
+            auto level = simd::set_level(static_cast<simd::Level>(l));
+            SCOPED_TRACE(simd::level_name(level));
+            fn();
+        }
+    }
+
+    static Int32 find(const std::u16string& h, const std::u16string& n) {
+        return search::index_of(h.data(), static_cast<Int32>(h.size()),
+                                n.data(), static_cast<Int32>(n.size()));
+    }
+
+private:
+    simd::Level saved_ = simd::Level::Scalar;
+};
+
+// ===== Char search =====
+
+TEST_F(StringSearchTest, IndexOfChar_EveryPosition) {
+    for_each_level([] {
+        for (Int32 pos = 0; pos < 70; pos++) {
+            std::u16string s(70, u'.');
+            s[pos] = u'#';
+            ASSERT_EQ(search::index_of_char(s.data(), 70, u'#'), pos);
+            ASSERT_EQ(search::last_index_of_char(s.data(), 70, u'#'), pos);
+        }
+    });
+}
+
+TEST_F(StringSearchTest, IndexOfChar_FirstAndLastOfMany) {
+    for_each_level([] {
+        std::u16string s(100, u'a');
+        s[5] = s[40] = s[97] = u'z';
+        EXPECT_EQ(search::index_of_char(s.data(), 100, u'z'), 5);
+        EXPECT_EQ(search::last_index_of_char(s.data(), 100, u'z'), 97);
+        EXPECT_EQ(search::count_char(s.data(), 100, u'z'), 3);
+    });
+}
+
+TEST_F(StringSearchTest, IndexOfChar_NotFound) {
+    for_each_level([] {
+        std::u16string s(50, u'a');
+        EXPECT_EQ(search::index_of_char(s.data(), 50, u'b'), -1);
+        EXPECT_EQ(search::last_index_of_char(s.data(), 50, u'b'), -1);
+        EXPECT_EQ(search::count_char(s.data(), 50, u'b'), 0);
+        EXPECT_EQ(search::index_of_char(s.data(), 0, u'a'), -1);
+    });
+}
+
+TEST_F(StringSearchTest, IndexOfChar_HighCodeUnit) {
+    // Sign of the 16-bit lane must not matter
+    for_each_level([] {
+        std::u16string s(40, u'x');
+        s[33] = u'\xFFFD';
+        EXPECT_EQ(search::index_of_char(s.data(), 40, u'\xFFFD'), 33);
+    });
+}
+
+// ===== Substring search =====
+
+TEST_F(StringSearchTest, IndexOf_NeedleAtEveryPosition) {
+    for_each_level([] {
+        for (size_t pos = 0; pos + 5 <= 80; pos++) {
+            std::u16string s(80, u'-');
+            s.replace(pos, 5, u"ERROR");
+            ASSERT_EQ(find(s, u"ERROR"), static_cast<Int32>(pos));
+        }
+    });
+}
+
+TEST_F(StringSearchTest, IndexOf_FirstLastMatchButMiddleDiffers) {
+    // Candidates that pass the first/last filter must still be verified
+    for_each_level([] {
+        std::u16string s;
+        for (int i = 0; i < 20; i++) s += u"EXXXR ";
+        s += u"ERROR";
+        EXPECT_EQ(find(s, u"ERROR"), 120);
+    });
+}
+
+TEST_F(StringSearchTest, IndexOf_EdgeCases) {
+    for_each_level([] {
+        EXPECT_EQ(find(u"abc", u""), 0);
+        EXPECT_EQ(find(u"abc", u"abcd"), -1);
+        EXPECT_EQ(find(u"abc", u"abc"), 0);
+        EXPECT_EQ(find(u"aab", u"ab"), 1);
+        EXPECT_EQ(find(std::u16string(64, u'a'), u"ab"), -1);
+        EXPECT_EQ(find(std::u16string(64, u'a') + u"b", u"ab"), 63);
+    });
+}
+
+TEST_F(StringSearchTest, IndexOf_LongNeedle) {
+    for_each_level([] {
+        std::u16string needle;
+        for (int i = 0; i < 40; i++) needle += static_cast<Char>(u'A' + i % 26);
+        std::u16string s = std::u16string(300, u'A') + needle + u"tail";
+        EXPECT_EQ(find(s, needle), 300);
+    });
+}
+
+// ===== mismatch / CompareOrdinal =====
+
+TEST_F(StringSearchTest, Mismatch_EveryPosition) {
+    for_each_level([] {
+        std::u16string a(70, u'q');
+        for (Int32 pos = 0; pos < 70; pos++) {
+            std::u16string b = a;
+            b[pos] = u'r';
+            ASSERT_EQ(search::mismatch(a.data(), b.data(), 70), pos);
+        }
+        EXPECT_EQ(search::mismatch(a.data(), a.data(), 70), 70);
+    });
+}
+
+TEST_F(StringSearchTest, CompareOrdinal_UsesUnsignedCodeUnits) {
+    for_each_level([] {
+        std::u16string base(40, u'k');
+        std::u16string hi = base;
+        hi[35] = u'\xE000';
+        String* a = string_create_utf16(base.data(), 40);
+        String* b = string_create_utf16(hi.data(), 40);
+        EXPECT_LT(string_compare_ordinal(a, b), 0);
+        EXPECT_GT(string_compare_ordinal(b, a), 0);
+    });
+}
+
+// ===== String-level wiring =====
+
+TEST_F(StringSearchTest, IndexOf_StartIndex) {
+    String* s = string_create_utf8("a.b.c.d");
+    EXPECT_EQ(string_index_of(s, u'.', 0), 1);
+    EXPECT_EQ(string_index_of(s, u'.', 2), 3);
+    EXPECT_EQ(string_index_of(s, u'.', 6), -1);
+    EXPECT_EQ(string_index_of(s, u'.', -1), -1);
+    EXPECT_EQ(string_index_of(s, u'.', 100), -1);
+}
+
+TEST_F(StringSearchTest, ReplaceString_NonOverlapping) {
+    String* s = string_create_utf8("aaaa");
+    String* r = string_replace_string(s, string_create_utf8("aa"), string_create_utf8("b"));
+    EXPECT_TRUE(string_equals(r, string_create_utf8("bb")));
+}
+
+TEST_F(StringSearchTest, ReplaceString_GrowAndShrink) {
+    String* s = string_create_utf8("x=1; y=2; z=3");
+    String* grown = string_replace_string(s, string_create_utf8("; "), string_create_utf8(" ;; "));
+    EXPECT_TRUE(string_equals(grown, string_create_utf8("x=1 ;; y=2 ;; z=3")));
+    String* shrunk = string_replace_string(s, string_create_utf8("="), string_create_utf8(""));
+    EXPECT_TRUE(string_equals(shrunk, string_create_utf8("x1; y2; z3")));
+}
+
+TEST_F(StringSearchTest, Split_ManySegments) {
+    std::string csv;
+    for (int i = 0; i < 50; i++) csv += std::to_string(i) + ",";
+    Array* parts = string_split(string_create_utf8(csv.c_str()), u',');
+    ASSERT_EQ(parts->length, 51);
+    auto** items = static_cast<String**>(array_data(parts));
+    EXPECT_TRUE(string_equals(items[0], string_create_utf8("0")));
+    EXPECT_TRUE(string_equals(items[49], string_create_utf8("49")));
+    EXPECT_EQ(items[50]->length, 0);
+}
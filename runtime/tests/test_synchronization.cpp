@@ -0,0 +1,298 @@
+/**
+ * CIL2CPP Runtime Tests - SemaphoreSlim, ManualResetEventSlim, ReaderWriterLockSlim
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+class SynchronizationTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        runtime_init();
+    }
+};
+
+template <typename Fn>
+static bool throws(Fn fn) {
+    bool caught = false;
+    CIL2CPP_TRY
+        fn();
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    return caught;
+}
+
+// ===== Parking lot =====
+
+TEST_F(SynchronizationTest, Park_ValidationFails_ReturnsAtOnce) {
+    int word = 0;
+    EXPECT_FALSE(parking::park(&word, [](void*) { return false; }, nullptr, -1));
+}
+
+TEST_F(SynchronizationTest, Park_Timeout_ReturnsFalse) {
+    int word = 0;
+    EXPECT_FALSE(parking::park(&word, [](void*) { return true; }, nullptr, 10));
+    EXPECT_FALSE(parking::unpark_one(&word));   // the timed-out thread left the queue
+}
+
+TEST_F(SynchronizationTest, Park_UnparkOne_WakesOnlyThatAddress) {
+    int a = 0, b = 0;
+    std::atomic<int> woken{0};
+    std::thread on_a([&] {
+        parking::park(&a, [](void*) { return true; }, nullptr, -1);
+        woken++;
+    });
+    std::thread on_b([&] {
+        parking::park(&b, [](void*) { return true; }, nullptr, -1);
+        woken++;
+    });
+    while (!parking::unpark_one(&a)) std::this_thread::yield();
+    on_a.join();
+    EXPECT_EQ(woken.load(), 1);
+    while (parking::unpark_all(&b) == 0) std::this_thread::yield();
+    on_b.join();
+    EXPECT_EQ(woken.load(), 2);
+}
+
+// ===== SemaphoreSlim =====
+
+TEST_F(SynchronizationTest, Semaphore_WaitRelease_Counts) {
+    auto* s = semaphore_create(2, 3);
+    EXPECT_TRUE(semaphore_wait(s, 0));
+    EXPECT_TRUE(semaphore_wait(s, 0));
+    EXPECT_FALSE(semaphore_wait(s, 0));
+    EXPECT_EQ(semaphore_current_count(s), 0);
+    EXPECT_EQ(semaphore_release(s, 2), 0);
+    EXPECT_EQ(semaphore_current_count(s), 2);
+}
+
+TEST_F(SynchronizationTest, Semaphore_ReleasePastMax_Throws) {
+    auto* s = semaphore_create(1, 2);
+    EXPECT_TRUE(throws([&] { semaphore_release(s, 2); }));
+    EXPECT_EQ(semaphore_current_count(s), 1);
+}
+
+TEST_F(SynchronizationTest, Semaphore_InvalidCounts_Throw) {
+    EXPECT_TRUE(throws([] { semaphore_create(-1, 1); }));
+    EXPECT_TRUE(throws([] { semaphore_create(2, 1); }));
+    EXPECT_TRUE(throws([] { semaphore_create(0, 0); }));
+}
+
+TEST_F(SynchronizationTest, Semaphore_Wait_TimesOut) {
+    auto* s = semaphore_create(0, 1);
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(semaphore_wait(s, 20));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(19));
+}
+
+TEST_F(SynchronizationTest, Semaphore_Wait_WakesOnRelease) {
+    auto* s = semaphore_create(0, 1);
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&] {
+        acquired = semaphore_wait(s, -1);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    semaphore_release(s, 1);
+    waiter.join();
+    EXPECT_TRUE(acquired.load());
+    EXPECT_EQ(semaphore_current_count(s), 0);
+}
+
+TEST_F(SynchronizationTest, Semaphore_WaitAsync_CompletedWhenFree) {
+    auto* s = semaphore_create(1, 1);
+    Task* t = semaphore_wait_async(s);
+    EXPECT_TRUE(task_is_completed(t));
+    EXPECT_EQ(semaphore_current_count(s), 0);
+}
+
+TEST_F(SynchronizationTest, Semaphore_WaitAsync_QueuedInOrder) {
+    auto* s = semaphore_create(0, 2);
+    Task* first = semaphore_wait_async(s);
+    Task* second = semaphore_wait_async(s);
+    EXPECT_FALSE(task_is_completed(first));
+    EXPECT_FALSE(task_is_completed(second));
+
+    semaphore_release(s, 1);
+    EXPECT_TRUE(task_is_completed(first));
+    EXPECT_FALSE(task_is_completed(second));
+    semaphore_release(s, 1);
+    EXPECT_TRUE(task_is_completed(second));
+    // Both slots went to the queued callers
+    EXPECT_EQ(semaphore_current_count(s), 0);
+}
+
+TEST_F(SynchronizationTest, Semaphore_Concurrent_NeverExceedsCount) {
+    constexpr int kThreads = 6, kIterations = 2000, kSlots = 2;
+    auto* s = semaphore_create(kSlots, kSlots);
+    std::atomic<int> inside{0}, max_inside{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIterations; i++) {
+                semaphore_wait(s, -1);
+                int now = ++inside;
+                int seen = max_inside.load();
+                while (now > seen && !max_inside.compare_exchange_weak(seen, now)) {}
+                --inside;
+                semaphore_release(s, 1);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_LE(max_inside.load(), kSlots);
+    EXPECT_EQ(semaphore_current_count(s), kSlots);
+}
+
+// ===== ManualResetEventSlim =====
+
+TEST_F(SynchronizationTest, ResetEvent_SetReset) {
+    auto* e = reset_event_create(false, -1);
+    EXPECT_FALSE(reset_event_is_set(e));
+    EXPECT_FALSE(reset_event_wait(e, 0));
+    reset_event_set(e);
+    EXPECT_TRUE(reset_event_wait(e, 0));
+    reset_event_reset(e);
+    EXPECT_FALSE(reset_event_is_set(e));
+}
+
+TEST_F(SynchronizationTest, ResetEvent_Wait_TimesOut) {
+    auto* e = reset_event_create(false, 0);
+    EXPECT_FALSE(reset_event_wait(e, 15));
+}
+
+TEST_F(SynchronizationTest, ResetEvent_Set_ReleasesAllWaiters) {
+    auto* e = reset_event_create(false, -1);
+    std::atomic<int> released{0};
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < 4; i++) {
+        waiters.emplace_back([&] {
+            if (reset_event_wait(e, -1)) released++;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    reset_event_set(e);
+    for (auto& t : waiters) t.join();
+    EXPECT_EQ(released.load(), 4);
+}
+
+TEST_F(SynchronizationTest, ResetEvent_InvalidSpinCount_Throws) {
+    EXPECT_TRUE(throws([] { reset_event_create(false, 2048); }));
+}
+
+// ===== ReaderWriterLockSlim =====
+
+TEST_F(SynchronizationTest, RwLock_ReadersShare) {
+    auto* l = rwlock_create(0);
+    EXPECT_TRUE(rwlock_enter_read(l, -1));
+    EXPECT_TRUE(rwlock_enter_read(l, 0));
+    EXPECT_EQ(rwlock_current_read_count(l), 2);
+    EXPECT_FALSE(rwlock_enter_write(l, 0));
+    rwlock_exit_read(l);
+    rwlock_exit_read(l);
+    EXPECT_TRUE(rwlock_enter_write(l, 0));
+    EXPECT_TRUE(rwlock_is_write_lock_held(l));
+    rwlock_exit_write(l);
+}
+
+TEST_F(SynchronizationTest, RwLock_WriterExcludesReaders) {
+    auto* l = rwlock_create(0);
+    rwlock_enter_write(l, -1);
+    std::atomic<bool> read{true};
+    std::thread reader([&] { read = rwlock_enter_read(l, 10); });
+    reader.join();
+    EXPECT_FALSE(read.load());
+    rwlock_exit_write(l);
+    EXPECT_EQ(rwlock_current_read_count(l), 0);
+}
+
+TEST_F(SynchronizationTest, RwLock_WaitingWriter_HoldsBackNewReaders) {
+    auto* l = rwlock_create(0);
+    rwlock_enter_read(l, -1);
+    std::atomic<bool> wrote{false};
+    std::thread writer([&] {
+        wrote = rwlock_enter_write(l, -1);
+        rwlock_exit_write(l);
+    });
+    while (rwlock_waiting_write_count(l) == 0) std::this_thread::yield();
+
+    // A new reader waits behind the writer even though only readers hold the lock
+    std::atomic<bool> late_read{true};
+    std::thread late_reader([&] { late_read = rwlock_enter_read(l, 10); });
+    late_reader.join();
+    EXPECT_FALSE(late_read.load());
+
+    rwlock_exit_read(l);
+    writer.join();
+    EXPECT_TRUE(wrote.load());
+    EXPECT_TRUE(rwlock_enter_read(l, 0));
+    rwlock_exit_read(l);
+}
+
+TEST_F(SynchronizationTest, RwLock_WriterTimesOut_LetsReadersIn) {
+    auto* l = rwlock_create(0);
+    rwlock_enter_read(l, -1);
+    std::atomic<bool> parked_reader{false};
+    std::thread writer([&] { EXPECT_FALSE(rwlock_enter_write(l, 30)); });
+    while (rwlock_waiting_write_count(l) == 0) std::this_thread::yield();
+    std::thread reader([&] {
+        parked_reader = rwlock_enter_read(l, -1);
+        rwlock_exit_read(l);
+    });
+    writer.join();
+    reader.join();
+    EXPECT_TRUE(parked_reader.load());
+    rwlock_exit_read(l);
+}
+
+TEST_F(SynchronizationTest, RwLock_Misuse_Throws) {
+    auto* l = rwlock_create(0);
+    EXPECT_TRUE(throws([&] { rwlock_exit_read(l); }));
+    EXPECT_TRUE(throws([&] { rwlock_exit_write(l); }));
+    rwlock_enter_write(l, -1);
+    EXPECT_TRUE(throws([&] { rwlock_enter_write(l, -1); }));
+    EXPECT_TRUE(throws([&] { rwlock_enter_read(l, -1); }));
+    rwlock_exit_write(l);
+    EXPECT_TRUE(throws([] { rwlock_create(1); }));
+}
+
+TEST_F(SynchronizationTest, RwLock_Concurrent_WritersExclusive) {
+    constexpr int kReaders = 4, kWriters = 2, kIterations = 2000;
+    auto* l = rwlock_create(0);
+    std::atomic<int> readers_inside{0}, writers_inside{0};
+    std::atomic<bool> violated{false};
+    Int64 value = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kWriters; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIterations; i++) {
+                rwlock_enter_write(l, -1);
+                if (++writers_inside != 1 || readers_inside.load() != 0) violated = true;
+                value++;
+                --writers_inside;
+                rwlock_exit_write(l);
+            }
+        });
+    }
+    for (int t = 0; t < kReaders; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIterations; i++) {
+                rwlock_enter_read(l, -1);
+                ++readers_inside;
+                if (writers_inside.load() != 0) violated = true;
+                --readers_inside;
+                rwlock_exit_read(l);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_FALSE(violated.load());
+    EXPECT_EQ(value, kWriters * kIterations);
+}
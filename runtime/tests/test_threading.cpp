@@ -8,9 +8,13 @@
 #include <cil2cpp/object.h>
 #include <cil2cpp/type_info.h>
 #include <cil2cpp/delegate.h>
+#include <cil2cpp/exception.h>
+#include <cil2cpp/icall.h>
 
 #include <atomic>
+#include <chrono>
 #include <thread>
+#include <vector>
 
 using namespace cil2cpp;
 
@@ -182,6 +186,68 @@ TEST(InterlockedTest, CompareExchange64_Success) {
     EXPECT_EQ(val, 100);
 }
 
+TEST(InterlockedTest, Increment_WrapsOnOverflow) {
+    Int32 val = INT32_MAX;
+    EXPECT_EQ(interlocked::increment(&val), INT32_MIN);
+    EXPECT_EQ(interlocked::decrement(&val), INT32_MAX);
+}
+
+TEST(InterlockedTest, Unsigned_AddAndDecrement) {
+    UInt32 val = 0;
+    EXPECT_EQ(interlocked::decrement(&val), UINT32_MAX);
+    UInt64 big = 1;
+    EXPECT_EQ(interlocked::add<UInt64>(&big, 41), 42u);
+}
+
+TEST(InterlockedTest, AndOr_ReturnOriginal) {
+    Int32 flags = 0b0110;
+    EXPECT_EQ(interlocked::or_(&flags, 0b1001), 0b0110);
+    EXPECT_EQ(flags, 0b1111);
+    EXPECT_EQ(interlocked::and_(&flags, 0b0101), 0b1111);
+    EXPECT_EQ(flags, 0b0101);
+}
+
+TEST(InterlockedTest, FloatingPoint_ExchangeAndCompareExchange) {
+    Double level = 1.5;
+    EXPECT_EQ(interlocked::exchange(&level, 2.5), 1.5);
+    EXPECT_EQ(interlocked::compare_exchange(&level, 3.0, 9.0), 2.5);
+    EXPECT_EQ(level, 2.5);
+    Single ratio = 0.25f;
+    EXPECT_EQ(interlocked::compare_exchange(&ratio, 0.5f, 0.25f), 0.25f);
+    EXPECT_EQ(ratio, 0.5f);
+}
+
+TEST(InterlockedTest, ObjectReference_CompareExchange) {
+    Object a{}, b{};
+    Object* slot = nullptr;
+    EXPECT_EQ(interlocked::compare_exchange_obj(&slot, &a, nullptr), nullptr);
+    EXPECT_EQ(interlocked::compare_exchange_obj(&slot, &b, nullptr), &a);
+    EXPECT_EQ(interlocked::exchange_obj(&slot, &b), &a);
+    EXPECT_EQ(slot, &b);
+}
+
+TEST(InterlockedTest, ReadAndVolatile) {
+    Int64 total = 1LL << 40;
+    EXPECT_EQ(interlocked::read(&total), 1LL << 40);
+    bool ready = false;
+    interlocked::volatile_write(&ready, true);
+    EXPECT_TRUE(interlocked::volatile_read(&ready));
+    interlocked::memory_barrier();
+}
+
+TEST(InterlockedTest, Increment_ConcurrentThreads_NoLostUpdates) {
+    constexpr int kThreads = 4, kIterations = 100000;
+    Int64 counter = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIterations; i++) interlocked::increment(&counter);
+        });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(counter, static_cast<Int64>(kThreads) * kIterations);
+}
+
 // ===== Thread Tests =====
 
 // Simple thread-start function for testing
@@ -219,12 +285,12 @@ TEST(ThreadTest, CreateStartJoin_Completes) {
 
     auto* t = thread::create(del);
     ASSERT_NE(t, nullptr);
-    EXPECT_EQ(t->state, 0); // unstarted
+    EXPECT_EQ(t->state.load(), thread::kUnstarted);
 
     thread::start(t);
     thread::join(t);
 
-    EXPECT_EQ(t->state, 2); // stopped
+    EXPECT_EQ(t->state.load(), thread::kStopped);
     EXPECT_EQ(g_thread_result.load(), 42);
 }
 
@@ -262,3 +328,102 @@ TEST(ThreadTest, GetManagedId_UniquePerThread) {
     thread::join(t1);
     thread::join(t2);
 }
+
+template <typename Fn>
+static bool throws(Fn fn) {
+    bool caught = false;
+    CIL2CPP_TRY
+        fn();
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    return caught;
+}
+
+// Blocks until g_thread_gate is set, recording the thread's ID as seen from inside
+static std::atomic<bool> g_thread_gate{false};
+static std::atomic<Int32> g_seen_id{0};
+static std::atomic<ManagedThread*> g_seen_current{nullptr};
+
+static void gated_thread_fn(Object* /*target*/) {
+    g_seen_id.store(thread::current_managed_id());
+    g_seen_current.store(thread::current());
+    while (!g_thread_gate.load()) std::this_thread::yield();
+}
+
+TEST(ThreadTest, JoinTimeout_FalseWhileRunning_TrueAfterExit) {
+    g_thread_gate.store(false);
+    auto* t = thread::create(delegate_create(&DelegateTestType, nullptr,
+        reinterpret_cast<void*>(&gated_thread_fn)));
+    thread::start(t);
+    EXPECT_TRUE(thread::is_alive(t));
+    EXPECT_FALSE(thread::join_timeout(t, 0));
+    EXPECT_FALSE(thread::join_timeout(t, 20));
+
+    g_thread_gate.store(true);
+    EXPECT_TRUE(thread::join_timeout(t, -1));
+    EXPECT_EQ(t->state.load(), thread::kStopped);
+    // Joining again after the native thread was reaped returns at once
+    EXPECT_TRUE(thread::join_timeout(t, 0));
+    thread::join(t);
+}
+
+TEST(ThreadTest, Join_WakesParkedJoiners) {
+    g_thread_gate.store(false);
+    auto* t = thread::create(delegate_create(&DelegateTestType, nullptr,
+        reinterpret_cast<void*>(&gated_thread_fn)));
+    thread::start(t);
+
+    std::atomic<int> joined{0};
+    std::vector<std::thread> joiners;
+    for (int i = 0; i < 3; i++)
+        joiners.emplace_back([&] { thread::join(t); joined.fetch_add(1); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(joined.load(), 0);
+
+    g_thread_gate.store(true);
+    for (auto& j : joiners) j.join();
+    EXPECT_EQ(joined.load(), 3);
+}
+
+TEST(ThreadTest, Start_Twice_Throws) {
+    g_thread_result.store(0);
+    auto* t = thread::create(delegate_create(&DelegateTestType, nullptr,
+        reinterpret_cast<void*>(&test_thread_fn)));
+    thread::start(t);
+    EXPECT_TRUE(throws([&] { thread::start(t); }));
+    thread::join(t);
+    EXPECT_EQ(g_thread_result.load(), 42);
+}
+
+TEST(ThreadTest, Join_Unstarted_Throws) {
+    auto* t = thread::create(delegate_create(&DelegateTestType, nullptr,
+        reinterpret_cast<void*>(&test_thread_fn)));
+    EXPECT_TRUE(throws([&] { thread::join(t); }));
+    EXPECT_TRUE(throws([&] { thread::join_timeout(t, 10); }));
+}
+
+TEST(ThreadTest, CurrentManagedId_MatchesCreate) {
+    g_thread_gate.store(true);
+    auto* t = thread::create(delegate_create(&DelegateTestType, nullptr,
+        reinterpret_cast<void*>(&gated_thread_fn)));
+    thread::start(t);
+    thread::join(t);
+    EXPECT_EQ(g_seen_id.load(), thread::get_managed_id(t));
+    EXPECT_EQ(g_seen_current.load(), t);
+}
+
+TEST(ThreadTest, CurrentThread_StableOnForeignThread) {
+    Int32 main_id = thread::current_managed_id();
+    EXPECT_EQ(thread::current_managed_id(), main_id);
+    EXPECT_EQ(icall::Environment_get_CurrentManagedThreadId(), main_id);
+    auto* self = thread::current();
+    EXPECT_EQ(thread::current(), self);
+    EXPECT_EQ(thread::get_managed_id(self), main_id);
+    EXPECT_TRUE(thread::is_alive(self));
+
+    Int32 other_id = 0;
+    std::thread([&] { other_id = thread::current_managed_id(); }).join();
+    EXPECT_NE(other_id, 0);
+    EXPECT_NE(other_id, main_id);
+}
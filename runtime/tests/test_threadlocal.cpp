@@ -0,0 +1,253 @@
+/**
+ * CIL2CPP Runtime Tests - ThreadLocal<T> (threadlocal.h) and thread-static GC roots
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <atomic>
+#include <utility>
+#include <thread>
+#include <vector>
+
+using namespace cil2cpp;
+
+class ThreadLocalTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        runtime_init();
+    }
+};
+
+template <typename Fn>
+static bool throws(Fn fn) {
+    bool caught = false;
+    CIL2CPP_TRY
+        fn();
+    CIL2CPP_CATCH_ALL
+        caught = true;
+    CIL2CPP_END_TRY
+    return caught;
+}
+
+static TypeInfo FuncType = {
+    .name = "Func`1",
+    .namespace_name = "System",
+    .full_name = "System.Func`1",
+    .base_type = nullptr,
+    .interfaces = nullptr,
+    .interface_count = 0,
+    .instance_size = sizeof(Delegate),
+    .element_size = 0,
+    .flags = TypeFlags::None,
+    .vtable = nullptr,
+    .fields = nullptr,
+    .field_count = 0,
+    .methods = nullptr,
+    .method_count = 0,
+    .finalizer = nullptr,
+};
+
+static std::atomic<Int32> g_factory_calls{0};
+
+// Static Func<int>: each call returns the next number
+static Int32 counting_factory() {
+    return 100 + g_factory_calls.fetch_add(1);
+}
+
+struct Pair {
+    Int64 a;
+    Int64 b;
+};
+
+// Instance Func<Pair>: the target is passed as the first argument
+static Pair pair_factory(Object* target) {
+    return Pair{reinterpret_cast<Int64>(target), 7};
+}
+
+// Runs fn on a runtime thread (registered with the GC) and joins it
+template <typename Fn>
+static void on_managed_thread(Fn fn) {
+    std::thread([&] {
+        gc::register_thread();
+        fn();
+        gc::unregister_thread();
+    }).join();
+}
+
+TEST_F(ThreadLocalTest, Default_IsZeroAndPerThread) {
+    auto* tl = threadlocal_create(sizeof(Int32), nullptr);
+    EXPECT_FALSE(threadlocal_is_value_created(tl));
+    EXPECT_EQ(threadlocal_get_value<Int32>(tl), 0);
+    EXPECT_TRUE(threadlocal_is_value_created(tl));
+
+    threadlocal_set_value<Int32>(tl, 5);
+    Int32 other = -1;
+    on_managed_thread([&] {
+        other = threadlocal_get_value<Int32>(tl);
+        threadlocal_set_value<Int32>(tl, 9);
+    });
+    EXPECT_EQ(other, 0);
+    EXPECT_EQ(threadlocal_get_value<Int32>(tl), 5);
+}
+
+TEST_F(ThreadLocalTest, Factory_RunsOncePerThread) {
+    g_factory_calls.store(0);
+    auto* tl = threadlocal_create(sizeof(Int32),
+        delegate_create(&FuncType, nullptr, reinterpret_cast<void*>(&counting_factory)));
+    EXPECT_EQ(threadlocal_get_value<Int32>(tl), 100);
+    EXPECT_EQ(threadlocal_get_value<Int32>(tl), 100);
+    on_managed_thread([&] { EXPECT_EQ(threadlocal_get_value<Int32>(tl), 101); });
+    EXPECT_EQ(g_factory_calls.load(), 2);
+}
+
+TEST_F(ThreadLocalTest, SetBeforeGet_SkipsFactory) {
+    g_factory_calls.store(0);
+    auto* tl = threadlocal_create(sizeof(Int32),
+        delegate_create(&FuncType, nullptr, reinterpret_cast<void*>(&counting_factory)));
+    threadlocal_set_value<Int32>(tl, 42);
+    EXPECT_EQ(threadlocal_get_value<Int32>(tl), 42);
+    EXPECT_EQ(g_factory_calls.load(), 0);
+}
+
+TEST_F(ThreadLocalTest, InstanceFactory_StructValue) {
+    Object target{};
+    auto* tl = threadlocal_create(sizeof(Pair),
+        delegate_create(&FuncType, &target, reinterpret_cast<void*>(&pair_factory)));
+    Pair p = threadlocal_get_value<Pair>(tl);
+    EXPECT_EQ(p.a, reinterpret_cast<Int64>(&target));
+    EXPECT_EQ(p.b, 7);
+}
+
+TEST_F(ThreadLocalTest, Dispose_ThrowsAndRecyclesSlot) {
+    auto* tl = threadlocal_create(sizeof(Int32), nullptr);
+    threadlocal_set_value<Int32>(tl, 3);
+    threadlocal_dispose(tl);
+    threadlocal_dispose(tl); // idempotent
+    EXPECT_TRUE(throws([&] { threadlocal_get_value<Int32>(tl); }));
+    EXPECT_TRUE(throws([&] { threadlocal_set_value<Int32>(tl, 1); }));
+    EXPECT_TRUE(throws([&] { threadlocal_is_value_created(tl); }));
+
+    // The next instance reuses the slot but must not see the old value
+    auto* next = threadlocal_create(sizeof(Int32), nullptr);
+    EXPECT_EQ(next->slot, tl->slot);
+    EXPECT_FALSE(threadlocal_is_value_created(next));
+    EXPECT_EQ(threadlocal_get_value<Int32>(next), 0);
+    threadlocal_dispose(next);
+}
+
+TEST_F(ThreadLocalTest, StaleCellOnOtherThread_NotVisibleAfterReuse) {
+    std::atomic<ThreadLocal*> current{threadlocal_create(sizeof(Int32), nullptr)};
+    std::atomic<int> step{0};
+    Int32 seen = -1;
+    std::thread worker([&] {
+        gc::register_thread();
+        threadlocal_set_value<Int32>(current.load(), 77);
+        step.store(1);
+        while (step.load() != 2) std::this_thread::yield();
+        seen = threadlocal_get_value<Int32>(current.load());
+        gc::unregister_thread();
+    });
+    while (step.load() != 1) std::this_thread::yield();
+    auto* old = current.load();
+    threadlocal_dispose(old);
+    auto* next = threadlocal_create(sizeof(Int32), nullptr);
+    ASSERT_EQ(next->slot, old->slot);
+    current.store(next);
+    step.store(2);
+    worker.join();
+    // The worker still holds the disposed instance's cell in that slot
+    EXPECT_EQ(seen, 0);
+    threadlocal_dispose(next);
+}
+
+TEST_F(ThreadLocalTest, ManyInstances_GrowTable) {
+    std::vector<ThreadLocal*> locals;
+    for (Int32 i = 0; i < 100; i++) {
+        locals.push_back(threadlocal_create(sizeof(Int64), nullptr));
+        threadlocal_set_value<Int64>(locals.back(), i * 3);
+    }
+    for (Int32 i = 0; i < 100; i++)
+        EXPECT_EQ(threadlocal_get_value<Int64>(locals[i]), i * 3);
+    for (auto* tl : locals) threadlocal_dispose(tl);
+}
+
+TEST_F(ThreadLocalTest, ReferenceValue_SurvivesCollection) {
+    auto* tl = threadlocal_create(sizeof(String*), nullptr);
+    threadlocal_set_value<String*>(tl, string_create_utf8("per-thread"));
+    for (int i = 0; i < 1000; i++) gc::alloc(64, nullptr);
+    gc::collect();
+    auto* s = threadlocal_get_value<String*>(tl);
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(string_length(s), 10);
+    threadlocal_dispose(tl);
+}
+
+// ===== [ThreadStatic] blocks =====
+
+struct ThreadStaticsBlock {
+    Object* value;
+    Int32 counter;
+};
+static thread_local constinit ThreadStaticsBlock t_block = {};
+
+TEST_F(ThreadLocalTest, ThreadStaticBlock_RootedOnRegisteredThreads) {
+    gc::register_thread_static_block([] { return static_cast<void*>(&t_block); }, sizeof(t_block));
+
+    // Registered after init: rooted on this thread
+    t_block.value = reinterpret_cast<Object*>(string_create_utf8("main"));
+    t_block.counter = 1;
+
+    Int32 worker_counter = -1;
+    on_managed_thread([&] {
+        worker_counter = t_block.counter; // fresh copy on the new thread
+        t_block.value = reinterpret_cast<Object*>(string_create_utf8("worker"));
+        gc::collect();
+        EXPECT_EQ(string_length(reinterpret_cast<String*>(t_block.value)), 6);
+    });
+    EXPECT_EQ(worker_counter, 0);
+    gc::collect();
+    EXPECT_EQ(string_length(reinterpret_cast<String*>(t_block.value)), 4);
+    EXPECT_EQ(t_block.counter, 1);
+}
+
+// One static per I, so each registers as its own block
+template <int I>
+struct ManySlot {
+    static thread_local constinit Object* value;
+};
+template <int I>
+thread_local constinit Object* ManySlot<I>::value = nullptr;
+
+template <int... I>
+static void register_many_slots(std::integer_sequence<int, I...>) {
+    (gc::register_thread_static_block(
+        [] { return static_cast<void*>(&ManySlot<I>::value); }, sizeof(Object*)), ...);
+}
+
+// More (thread, block) pairs alive at once than BoehmGC has root sets (2048)
+TEST_F(ThreadLocalTest, ThreadStaticBlock_ManyBlocksOnManyThreads) {
+    constexpr int kBlocks = 48;
+    constexpr int kThreads = 48;
+    register_many_slots(std::make_integer_sequence<int, kBlocks>());
+
+    std::atomic<int> attached{0};
+    std::atomic<bool> release{false};
+    std::atomic<int> survived{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            gc::register_thread();
+            ManySlot<kBlocks - 1>::value = reinterpret_cast<Object*>(string_create_utf8("live"));
+            attached++;
+            while (!release.load()) std::this_thread::yield();
+            if (string_length(reinterpret_cast<String*>(ManySlot<kBlocks - 1>::value)) == 4) survived++;
+            gc::unregister_thread();
+        });
+    }
+    while (attached.load() < kThreads) std::this_thread::yield();
+    gc::collect();
+    release = true;
+    for (auto& th : threads) th.join();
+    EXPECT_EQ(survived.load(), kThreads);
+}
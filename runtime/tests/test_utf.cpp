@@ -0,0 +1,221 @@
+/**
+ * CIL2CPP Runtime Tests - UTF-8 ⇄ UTF-16 transcoding
+ *
+ * Every case runs once per SIMD level available on this machine, so the
+ * scalar, SSE2 and AVX2 kernels are all checked against the same expectations.
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace cil2cpp;
+
+class UtfTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        saved_ = simd::level();
+    }
+
+    void TearDown() override {
+        simd::set_level(saved_);
+        runtime_shutdown();
+    }
+
+    template<typename F>
+    void for_each_level(F&& fn) {
+        for (int l = 0; l <= static_cast<int>(simd::detected()); l++) {
+            auto level = simd::set_level(static_cast<simd::Level>(l));
+            SCOPED_TRACE(simd::level_name(level));
+            fn();
+        }
+    }
+
+    static std::u16string decode(const std::string& s) {
+        size_t len = utf::utf8_to_utf16_length(s.data(), s.size());
+        std::u16string out(len, u'\0');
+        size_t written = utf::utf8_to_utf16(s.data(), s.size(), out.data());
+        EXPECT_EQ(written, len);
+        return out;
+    }
+
+    static std::string encode(const std::u16string& s) {
+        size_t len = utf::utf16_to_utf8_length(s.data(), s.size());
+        std::string out(len, '\0');
+        size_t written = utf::utf16_to_utf8(s.data(), s.size(), out.data());
+        EXPECT_EQ(written, len);
+        return out;
+    }
+
+private:
+    simd::Level saved_ = simd::Level::Scalar;
+};
+
+// ===== SIMD level control =====
+
+TEST_F(UtfTest, SetLevel_ClampsToDetected) {
+    EXPECT_EQ(simd::set_level(simd::Level::AVX2), simd::detected());
+    EXPECT_EQ(simd::set_level(simd::Level::Scalar), simd::Level::Scalar);
+    EXPECT_EQ(simd::level(), simd::Level::Scalar);
+}
+
+TEST_F(UtfTest, LevelName) {
+    EXPECT_STREQ(simd::level_name(simd::Level::Scalar), "scalar");
+    EXPECT_STREQ(simd::level_name(simd::Level::SSE2), "sse2");
+    EXPECT_STREQ(simd::level_name(simd::Level::AVX2), "avx2");
+}
+
+// ===== UTF-8 → UTF-16 =====
+
+TEST_F(UtfTest, Decode_Empty) {
+    for_each_level([] {
+        EXPECT_EQ(utf::utf8_to_utf16_length("", 0), 0u);
+    });
+}
+
+TEST_F(UtfTest, Decode_AllWidths) {
+    for_each_level([] {
+        // A, é (2), 你 (3), 😀 (4 → surrogate pair)
+        EXPECT_EQ(decode("A\xC3\xA9\xE4\xBD\xA0\xF0\x9F\x98\x80"),
+                  std::u16string(u"Aé你\U0001F600"));
+    });
+}
+
+TEST_F(UtfTest, Decode_LongAscii_NonAsciiAtEveryOffset) {
+    // Non-ASCII byte placed at each position of a 70-byte ASCII run exercises
+    // every SIMD block boundary (16/32) and the scalar tail.
+    for_each_level([] {
+        for (size_t pos = 0; pos < 70; pos++) {
+            std::string s(70, 'x');
+            s.replace(pos, 1, "\xC3\xA9");
+            std::u16string expected(70, u'x');
+            expected[pos] = u'é';
+            ASSERT_EQ(decode(s), expected) << "pos=" << pos;
+        }
+    });
+}
+
+TEST_F(UtfTest, Decode_EmbeddedNul) {
+    for_each_level([] {
+        std::string s("a\0b", 3);
+        EXPECT_EQ(decode(s), std::u16string(u"a\0b", 3));
+    });
+}
+
+TEST_F(UtfTest, Decode_InvalidBytes_BecomeReplacementChar) {
+    for_each_level([] {
+        EXPECT_EQ(decode("a\x80z"), u"a�z");          // stray continuation
+        EXPECT_EQ(decode("a\xFFz"), u"a�z");          // invalid lead
+        EXPECT_EQ(decode("\xC0\xAF"), u"��");    // overlong '/'
+        EXPECT_EQ(decode("\xED\xA0\x80"), u"���");  // encoded surrogate
+        EXPECT_EQ(decode("\xF4\x90\x80\x80"), u"����");  // > U+10FFFF
+    });
+}
+
+TEST_F(UtfTest, Decode_TruncatedSequence_OneReplacementPerMaximalSubpart) {
+    for_each_level([] {
+        EXPECT_EQ(decode("\xE4\xBD"), u"�");           // cut at end of input
+        EXPECT_EQ(decode("\xE4\xBDz"), u"�z");
+        EXPECT_EQ(decode("\xF0\x9F\x98z"), u"�z");
+    });
+}
+
+// ===== UTF-16 → UTF-8 =====
+
+TEST_F(UtfTest, Encode_AllWidths) {
+    for_each_level([] {
+        EXPECT_EQ(encode(u"Aé你\U0001F600"),
+                  "A\xC3\xA9\xE4\xBD\xA0\xF0\x9F\x98\x80");
+    });
+}
+
+TEST_F(UtfTest, Encode_SurrogatePair_Is4Bytes) {
+    for_each_level([] {
+        EXPECT_EQ(utf::utf16_to_utf8_length(u"\U0001F600", 2), 4u);
+    });
+}
+
+TEST_F(UtfTest, Encode_LoneSurrogates_BecomeReplacementChar) {
+    for_each_level([] {
+        EXPECT_EQ(encode(std::u16string(u"a\xD800z")), "a\xEF\xBF\xBDz");
+        EXPECT_EQ(encode(std::u16string(u"a\xDC00z")), "a\xEF\xBF\xBDz");
+        EXPECT_EQ(encode(std::u16string(1, u'\xD83D')), "\xEF\xBF\xBD");  // high at end
+    });
+}
+
+TEST_F(UtfTest, Encode_LongMixed_NonAsciiAtEveryOffset) {
+    for_each_level([] {
+        for (size_t pos = 0; pos < 70; pos++) {
+            std::u16string s(70, u'x');
+            s[pos] = u'你';
+            std::string expected(70, 'x');
+            expected.replace(pos, 1, "\xE4\xBD\xA0");
+            ASSERT_EQ(encode(s), expected) << "pos=" << pos;
+        }
+    });
+}
+
+TEST_F(UtfTest, Encode_Length_CjkAndLatinBlocks) {
+    // Long surrogate-free runs go through the vectorized length kernel
+    for_each_level([] {
+        std::u16string s;
+        for (int i = 0; i < 100; i++) s += u"é你a";
+        EXPECT_EQ(utf::utf16_to_utf8_length(s.data(), s.size()), 600u);
+    });
+}
+
+TEST_F(UtfTest, RoundTrip_AllScalarValues) {
+    for_each_level([] {
+        std::u16string s;
+        for (UInt32 cp = 1; cp <= 0x10FFFF; cp += 97) {
+            if (cp >= 0xD800 && cp <= 0xDFFF) continue;
+            if (cp < 0x10000) {
+                s += static_cast<Char>(cp);
+            } else {
+                s += static_cast<Char>(0xD800 | ((cp - 0x10000) >> 10));
+                s += static_cast<Char>(0xDC00 | ((cp - 0x10000) & 0x3FF));
+            }
+        }
+        EXPECT_EQ(decode(encode(s)), s);
+    });
+}
+
+// ===== utf16_chunk =====
+
+TEST_F(UtfTest, Chunk_DoesNotSplitSurrogatePair) {
+    const Char s[] = {u'a', 0xD83D, 0xDE00, u'b'};
+    EXPECT_EQ(utf::utf16_chunk(s, 4, 2), 1u);
+    EXPECT_EQ(utf::utf16_chunk(s, 4, 3), 3u);
+    EXPECT_EQ(utf::utf16_chunk(s, 4, 8), 4u);
+}
+
+// ===== String boundaries =====
+
+TEST_F(UtfTest, StringToUtf8_SurrogatePair) {
+    String* str = string_create_utf8("\xF0\x9F\x98\x80!");
+    char* utf8 = string_to_utf8(str);
+    EXPECT_STREQ(utf8, "\xF0\x9F\x98\x80!");
+    std::free(utf8);
+}
+
+TEST_F(UtfTest, StringCreateUtf8_WithLength_KeepsEmbeddedNul) {
+    String* str = string_create_utf8("a\0b", 3);
+    ASSERT_NE(str, nullptr);
+    ASSERT_EQ(str->length, 3);
+    EXPECT_EQ(str->chars[1], u'\0');
+}
+
+TEST_F(UtfTest, StringCreateUtf8_LargeInput) {
+    // Above the stack-decode threshold: decoded through a heap scratch buffer
+    std::string s;
+    for (int i = 0; i < 1000; i++) s += "\xE4\xBD\xA0x";
+    String* str = string_create_utf8(s.data(), static_cast<Int32>(s.size()));
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(str->length, 2000);
+    EXPECT_EQ(str->chars[0], u'你');
+    EXPECT_EQ(str->chars[1999], u'x');
+}
@@ -0,0 +1,323 @@
+/**
+ * CIL2CPP Runtime Tests - Vectorized aggregate and search kernels
+ *
+ * Kernel cases run once per SIMD level available on this machine; lengths
+ * sweep across the vector widths so every scalar tail is covered.
+ */
+
+#include <gtest/gtest.h>
+#include <cil2cpp/cil2cpp.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace cil2cpp;
+
+class VectorOpsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        runtime_init();
+        saved_ = simd::level();
+    }
+
+    void TearDown() override {
+        simd::set_level(saved_);
+        runtime_shutdown();
+    }
+
+    template<typename F>
+    void for_each_level(F&& fn) {
+        for (int l = 0; l <= static_cast<int>(simd::detected()); l++) {
+            auto level = simd::set_level(static_cast<simd::Level>(l));
+            SCOPED_TRACE(simd::level_name(level));
+            fn();
+        }
+    }
+
+    template<typename T>
+    static bool sum_throws(const std::vector<T>& v) {
+        bool caught = false;
+        CIL2CPP_TRY
+            vec::sum(v.data(), static_cast<Int32>(v.size()));
+        CIL2CPP_CATCH_ALL
+            caught = true;
+        CIL2CPP_END_TRY
+        return caught;
+    }
+
+    static constexpr Int32 kMaxLen = 70;
+
+private:
+    simd::Level saved_ = simd::Level::Scalar;
+};
+
+static constexpr Int32 I32_MAX = std::numeric_limits<Int32>::max();
+static constexpr Int32 I32_MIN = std::numeric_limits<Int32>::min();
+static constexpr Int64 I64_MAX = std::numeric_limits<Int64>::max();
+static constexpr Int64 I64_MIN = std::numeric_limits<Int64>::min();
+static const Double NaN = std::numeric_limits<Double>::quiet_NaN();
+
+// ===== Sum =====
+
+TEST_F(VectorOpsTest, Sum_Int32_MatchesSequential) {
+    for_each_level([&] {
+        for (Int32 n = 0; n <= kMaxLen; n++) {
+            std::vector<Int32> v(n);
+            Int32 expected = 0;
+            for (Int32 i = 0; i < n; i++) {
+                v[i] = (i % 3 == 0 ? -1 : 1) * (i * 7919 + 13);
+                expected += v[i];
+            }
+            EXPECT_EQ(vec::sum(v.data(), n), expected) << "n=" << n;
+        }
+    });
+}
+
+TEST_F(VectorOpsTest, Sum_Int32_OverflowAtSomeStep_Throws) {
+    for_each_level([&] {
+        // The total fits, but the first step does not: .NET throws
+        EXPECT_TRUE(sum_throws(std::vector<Int32>{I32_MAX, 1, -1}));
+        EXPECT_TRUE(sum_throws(std::vector<Int32>{I32_MIN, -1, 1, 0, 0, 0, 0, 0, 0, 0}));
+        std::vector<Int32> big(37, I32_MAX / 16);
+        EXPECT_TRUE(sum_throws(big));
+    });
+}
+
+TEST_F(VectorOpsTest, Sum_Int32_LargeTermsWithoutOverflow_DoesNotThrow) {
+    for_each_level([&] {
+        // Positive total exceeds Int32, but no prefix does
+        std::vector<Int32> v{-5, I32_MAX, 1, -I32_MAX, I32_MAX, 4, -9, 0, 3};
+        Int32 expected = -5 + I32_MAX + 1 - I32_MAX + I32_MAX + 4 - 9 + 0 + 3;
+        EXPECT_FALSE(sum_throws(v));
+        EXPECT_EQ(vec::sum(v.data(), static_cast<Int32>(v.size())), expected);
+        std::vector<Int32> edge{I32_MAX, I32_MIN, I32_MAX, I32_MIN, 0, 0, 0, 0, 1};
+        EXPECT_EQ(vec::sum(edge.data(), static_cast<Int32>(edge.size())), -1);
+    });
+}
+
+TEST_F(VectorOpsTest, Sum_Int64_MatchesSequentialAndChecksOverflow) {
+    for_each_level([&] {
+        for (Int32 n = 0; n <= kMaxLen; n++) {
+            std::vector<Int64> v(n);
+            Int64 expected = 0;
+            for (Int32 i = 0; i < n; i++) {
+                v[i] = (i % 2 ? -1 : 1) * (static_cast<Int64>(i) << 40);
+                expected += v[i];
+            }
+            EXPECT_EQ(vec::sum(v.data(), n), expected) << "n=" << n;
+        }
+        EXPECT_TRUE(sum_throws(std::vector<Int64>{I64_MAX, 1, -1}));
+        EXPECT_TRUE(sum_throws(std::vector<Int64>{I64_MIN, 0, 0, 0, -1, 0, 0, 0, 5}));
+        std::vector<Int64> lanes(16, I64_MAX / 4);
+        EXPECT_TRUE(sum_throws(lanes));
+
+        std::vector<Int64> v{I64_MAX, -1, 1, I64_MIN, I64_MAX, 0, 0, 0, 0, 0};
+        EXPECT_FALSE(sum_throws(v));
+        EXPECT_EQ(vec::sum(v.data(), static_cast<Int32>(v.size())), -1 + I64_MAX);
+    });
+}
+
+TEST_F(VectorOpsTest, Sum_Floating_IsSequential) {
+    for_each_level([&] {
+        // Reassociating would lose the small terms differently
+        std::vector<Double> d{1e16, 1.0, 1.0, 1.0, 1.0, -1e16, 1.0, 1.0, 0.5};
+        Double expected = 0;
+        for (Double x : d) expected += x;
+        EXPECT_EQ(vec::sum(d.data(), static_cast<Int32>(d.size())), expected);
+
+        std::vector<Single> f{16777216.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+        EXPECT_EQ(vec::sum(f.data(), static_cast<Int32>(f.size())), 16777220.0);
+    });
+}
+
+// ===== Min / Max =====
+
+TEST_F(VectorOpsTest, MinMax_Integers_EveryPosition) {
+    for_each_level([&] {
+        for (Int32 n = 1; n <= kMaxLen; n++) {
+            for (Int32 at = 0; at < n; at++) {
+                std::vector<Int32> a(n, 5);
+                std::vector<Int64> b(n, 5);
+                a[at] = -100;
+                b[at] = I64_MIN;
+                EXPECT_EQ(vec::min(a.data(), n), -100);
+                EXPECT_EQ(vec::min(b.data(), n), I64_MIN);
+                a[at] = I32_MAX;
+                b[at] = I64_MAX;
+                EXPECT_EQ(vec::max(a.data(), n), I32_MAX);
+                EXPECT_EQ(vec::max(b.data(), n), I64_MAX);
+            }
+        }
+    });
+}
+
+TEST_F(VectorOpsTest, MinMax_Floating_EveryPosition) {
+    for_each_level([&] {
+        for (Int32 n = 1; n <= kMaxLen; n++) {
+            for (Int32 at = 0; at < n; at++) {
+                std::vector<Double> d(n, 1.5);
+                std::vector<Single> f(n, 1.5f);
+                d[at] = -2.0;
+                f[at] = -2.0f;
+                EXPECT_EQ(vec::min(d.data(), n), -2.0);
+                EXPECT_EQ(vec::min(f.data(), n), -2.0f);
+                d[at] = 9.0;
+                f[at] = 9.0f;
+                EXPECT_EQ(vec::max(d.data(), n), 9.0);
+                EXPECT_EQ(vec::max(f.data(), n), 9.0f);
+            }
+        }
+    });
+}
+
+TEST_F(VectorOpsTest, MinMax_NaN) {
+    for_each_level([&] {
+        for (Int32 n = 1; n <= kMaxLen; n++) {
+            for (Int32 at = 0; at < n; at++) {
+                std::vector<Double> d(n, 3.0);
+                d[at] = NaN;
+                EXPECT_TRUE(std::isnan(vec::min(d.data(), n)));
+                // Max ignores NaN unless there is nothing else
+                if (n > 1) {
+                    EXPECT_EQ(vec::max(d.data(), n), 3.0);
+                } else {
+                    EXPECT_TRUE(std::isnan(vec::max(d.data(), n)));
+                }
+
+                std::vector<Single> f(n, 3.0f);
+                f[at] = std::numeric_limits<Single>::quiet_NaN();
+                EXPECT_TRUE(std::isnan(vec::min(f.data(), n)));
+                if (n > 1) {
+                    EXPECT_EQ(vec::max(f.data(), n), 3.0f);
+                }
+            }
+        }
+        std::vector<Double> all(9, NaN);
+        EXPECT_TRUE(std::isnan(vec::max(all.data(), 9)));
+    });
+}
+
+TEST_F(VectorOpsTest, MinMax_SignedZero_FirstWins) {
+    for_each_level([&] {
+        std::vector<Double> d(17, 1.0);
+        d[3] = -0.0;
+        d[11] = 0.0;
+        EXPECT_TRUE(std::signbit(vec::min(d.data(), 17)));
+        d[3] = 0.0;
+        d[11] = -0.0;
+        EXPECT_FALSE(std::signbit(vec::min(d.data(), 17)));
+
+        std::vector<Single> f(17, -1.0f);
+        f[2] = -0.0f;
+        f[9] = 0.0f;
+        EXPECT_TRUE(std::signbit(vec::max(f.data(), 17)));
+    });
+}
+
+TEST_F(VectorOpsTest, Average) {
+    for_each_level([&] {
+        std::vector<Int32> a{I32_MAX, I32_MAX, I32_MAX, I32_MAX, I32_MAX};
+        EXPECT_EQ(vec::average(a.data(), 5), static_cast<Double>(I32_MAX));
+        std::vector<Single> f{1.0f, 2.0f, 4.0f};
+        EXPECT_FLOAT_EQ(vec::average(f.data(), 3), 7.0f / 3.0f);
+        std::vector<Double> d{1.0, 2.0};
+        EXPECT_EQ(vec::average(d.data(), 2), 1.5);
+    });
+}
+
+// ===== Search / compare / fill =====
+
+TEST_F(VectorOpsTest, IndexOf_EveryWidthEveryPosition) {
+    for_each_level([&] {
+        for (Int32 n = 0; n <= kMaxLen; n++) {
+            std::vector<Byte> b(n, 1);
+            std::vector<Int16> s(n, 1);
+            std::vector<Int32> i32(n, 1);
+            std::vector<Int64> i64(n, 1);
+            EXPECT_EQ(vec::index_of(b.data(), n, Byte{7}), -1);
+            EXPECT_EQ(vec::index_of(i64.data(), n, Int64{7}), -1);
+            for (Int32 at = 0; at < n; at++) {
+                b[at] = 7;
+                s[at] = -7;
+                i32[at] = 7;
+                i64[at] = -7;
+                EXPECT_EQ(vec::index_of(b.data(), n, Byte{7}), at);
+                EXPECT_EQ(vec::index_of(s.data(), n, Int16{-7}), at);
+                EXPECT_EQ(vec::index_of(i32.data(), n, 7), at);
+                EXPECT_EQ(vec::index_of(i64.data(), n, Int64{-7}), at);
+                b[at] = 1;
+                s[at] = 1;
+                i32[at] = 1;
+                i64[at] = 1;
+            }
+        }
+    });
+}
+
+TEST_F(VectorOpsTest, IndexOf_Int64_HalfMatchIsNotAMatch) {
+    for_each_level([&] {
+        // Low dword matches in every lane, high dword only in the last one
+        std::vector<Int64> v(9, 0x100000007LL);
+        v[8] = 7;
+        EXPECT_EQ(vec::index_of(v.data(), 9, Int64{7}), 8);
+    });
+}
+
+TEST_F(VectorOpsTest, IndexOf_Floating_EqualsSemantics) {
+    for_each_level([&] {
+        std::vector<Double> d(21, 1.0);
+        d[13] = NaN;
+        d[17] = -0.0;
+        EXPECT_EQ(vec::index_of(d.data(), 21, NaN), 13);
+        EXPECT_EQ(vec::index_of(d.data(), 21, 0.0), 17);
+        EXPECT_FALSE(vec::contains(d.data(), 21, 2.0));
+
+        std::vector<Single> f(21, 1.0f);
+        f[20] = std::numeric_limits<Single>::quiet_NaN();
+        EXPECT_EQ(vec::index_of(f.data(), 21, std::numeric_limits<Single>::quiet_NaN()), 20);
+    });
+}
+
+TEST_F(VectorOpsTest, SequenceEqual) {
+    for_each_level([&] {
+        for (Int32 n = 0; n <= kMaxLen; n++) {
+            std::vector<Double> a(n, 2.0), b(n, 2.0);
+            std::vector<Int32> c(n, 2), e(n, 2);
+            EXPECT_TRUE(vec::sequence_equal(a.data(), b.data(), n));
+            EXPECT_TRUE(vec::sequence_equal(c.data(), e.data(), n));
+            if (n == 0) continue;
+            a[n - 1] = NaN;
+            b[n - 1] = NaN;
+            a[0] = -0.0;
+            b[0] = 0.0;
+            EXPECT_TRUE(vec::sequence_equal(a.data(), b.data(), n));
+            b[n / 2] = 3.0;
+            EXPECT_FALSE(vec::sequence_equal(a.data(), b.data(), n));
+            e[n / 2] = 3;
+            EXPECT_FALSE(vec::sequence_equal(c.data(), e.data(), n));
+        }
+    });
+}
+
+TEST_F(VectorOpsTest, Fill_EveryWidthAndLength) {
+    for_each_level([&] {
+        for (Int32 n = 0; n <= kMaxLen; n++) {
+            std::vector<Char> c(n + 1, u'x');
+            std::vector<Single> f(n + 1, 0.0f);
+            std::vector<Int64> l(n + 1, 0);
+            vec::fill(c.data(), n, u'y');
+            vec::fill(f.data(), n, -1.5f);
+            vec::fill(l.data(), n, Int64{-3});
+            for (Int32 i = 0; i < n; i++) {
+                ASSERT_EQ(c[i], u'y');
+                ASSERT_EQ(f[i], -1.5f);
+                ASSERT_EQ(l[i], -3);
+            }
+            // Nothing written past the end
+            EXPECT_EQ(c[n], u'x');
+            EXPECT_EQ(f[n], 0.0f);
+            EXPECT_EQ(l[n], 0);
+        }
+    });
+}
@@ -15,6 +15,7 @@ import shutil
 import subprocess
 import sys
 import tempfile
+import time
 from pathlib import Path
 
 # ===== Constants =====
@@ -25,6 +26,7 @@ RUNTIME_DIR = REPO_ROOT / "runtime"
 CLI_PROJECT = COMPILER_DIR / "CIL2CPP.CLI"
 TEST_PROJECT = COMPILER_DIR / "CIL2CPP.Tests"
 RUNTIME_TESTS_DIR = RUNTIME_DIR / "tests"
+RUNTIME_BENCH_DIR = RUNTIME_DIR / "benchmarks"
 SAMPLES_DIR = COMPILER_DIR / "samples"
 
 IS_WINDOWS = platform.system() == "Windows"
@@ -165,6 +167,206 @@ def cmd_test(args):
     return failures
 
 
+# ===== cmd_bench =====
+
+def cmd_bench(args):
+    """Build and run runtime micro-benchmarks (Release)."""
+    header("Runtime benchmarks")
+    build_dir = RUNTIME_BENCH_DIR / "build"
+    run(["cmake", "-B", str(build_dir), "-S", str(RUNTIME_BENCH_DIR),
+         "-G", DEFAULT_GENERATOR, "-DCMAKE_BUILD_TYPE=Release"]
+        + (["-A", "x64"] if IS_WINDOWS else []), capture=True)
+    run(["cmake", "--build", str(build_dir), "--config", "Release"])
+
+    names = sorted(p.stem for p in RUNTIME_BENCH_DIR.glob("bench_*.cpp"))
+    if args.filter:
+        names = [n for n in names if args.filter in n]
+    if not names:
+        warn(f"No benchmarks match '{args.filter}'")
+        return 1
+
+    env = dict(os.environ)
+    if args.scale:
+        env["BENCH_SCALE"] = str(args.scale)
+    failures = 0
+    for name in names:
+        exe = _exe_path(build_dir, "Release", name)
+        # Benchmarks report on stderr; stdout is discarded so console
+        # benchmarks measure the runtime, not the terminal.
+        result = subprocess.run([str(exe)], env=env, stdout=subprocess.DEVNULL)
+        if result.returncode != 0:
+            error(f"{name} exited with code {result.returncode}")
+            failures += 1
+    return failures
+
+
+# ===== cmd_build_bench =====
+
+def _synthetic_type(i, multiplier=31):
+    """C# source lines of the i-th synthetic class."""
+    return [
+        f"public class Type{i}",
+        "{",
+        "    private int _value;",
+        f"    private string _name = \"t{i}\";",
+        f"    public Type{i}(int value) {{ _value = value; }}",
+        "    public int Value => _value;",
+        "    public int Step(int x)",
+        "    {",
+        f"        for (int k = 0; k < 3; k++) x = x * {multiplier} + _value + k;",
+        "        return x;",
+        "    }",
+        "    public override string ToString() => _name + _value;",
+        f"    public static int Run(int x) => new Type{i}(x).Step(x) ^ {i};",
+        "}",
+        "",
+    ]
+
+
+def _write_synthetic_project(project_dir, type_count):
+    """Write a console project with `type_count` small classes, all reached from Main."""
+    project_dir.mkdir(parents=True, exist_ok=True)
+    (project_dir / "Synthetic.csproj").write_text(
+        '<Project Sdk="Microsoft.NET.Sdk">\n'
+        "  <PropertyGroup>\n"
+        "    <OutputType>Exe</OutputType>\n"
+        "    <TargetFramework>net8.0</TargetFramework>\n"
+        "  </PropertyGroup>\n"
+        "</Project>\n"
+    )
+    lines = ["using System;", ""]
+    for i in range(type_count):
+        lines += _synthetic_type(i)
+    lines += ["public static class Program", "{", "    public static void Main()", "    {", "        int acc = 0;"]
+    lines += [f"        acc += Type{i}.Run(acc);" for i in range(type_count)]
+    lines += ["        Console.WriteLine(acc);", "    }", "}"]
+    (project_dir / "Program.cs").write_text("\n".join(lines) + "\n")
+
+
+def cmd_build_bench(args):
+    """Time the native build of a synthetic program: one translation unit vs split sources."""
+    header(f"Native build time: synthetic program with {args.types} types")
+    cfg = Path(args.prefix) / "lib/cmake/cil2cpp/cil2cppConfig.cmake"
+    if not cfg.exists():
+        error(f"cil2cppConfig.cmake not found at {cfg} (run: python tools/dev.py install)")
+        return 1
+
+    temp_dir = Path(tempfile.mkdtemp(prefix="cil2cpp_build_bench_"))
+    project = temp_dir / "Synthetic"
+    _write_synthetic_project(project, args.types)
+    cmake_arch = ["-A", "x64"] if "Visual Studio" in args.generator else []
+    jobs = args.jobs or os.cpu_count() or 1
+
+    timings = []
+    for label, units in (("single translation unit", 1), ("split translation units", 0)):
+        output = temp_dir / f"gen_{units}"
+        build = temp_dir / f"build_{units}"
+        run(["dotnet", "run", "--project", str(CLI_PROJECT), "--",
+             "codegen", "-i", str(project / "Synthetic.csproj"), "-o", str(output),
+             "--translation-units", str(units)], capture=True)
+        sources = len(list(output.glob("*.cpp")))
+        run(["cmake", "-B", str(build), "-S", str(output), "-G", args.generator, *cmake_arch,
+             f"-DCMAKE_PREFIX_PATH={args.prefix}", "-DCMAKE_BUILD_TYPE=Release"], capture=True)
+        start = time.perf_counter()
+        run(["cmake", "--build", str(build), "--config", "Release", "--parallel", str(jobs)],
+            capture=True)
+        elapsed = time.perf_counter() - start
+        timings.append(elapsed)
+        print(f"  {label:<26s} {sources:3d} .cpp files  {elapsed:8.1f} s")
+
+    print(f"  {'speedup':<26s} {timings[0] / timings[1]:22.2f}x  (-j{jobs})")
+
+    if args.keep_temp:
+        print(f"  Keeping temp directory: {temp_dir}")
+    else:
+        shutil.rmtree(temp_dir, ignore_errors=True)
+    return 0
+
+
+# ===== cmd_edit_bench =====
+
+def _write_generated_mathlib(mathlib_dir, type_count, edited=None, multiplier=31):
+    """Add `type_count` synthetic classes to MathLib; `edited` gets a different Step multiplier."""
+    lines = ["namespace MathLib;", ""]
+    for i in range(type_count):
+        lines += _synthetic_type(i, multiplier if i == edited else 31)
+    lines += ["public static class Generated", "{", "    public static int RunAll(int acc)", "    {"]
+    lines += [f"        acc += Type{i}.Run(acc);" for i in range(type_count)]
+    lines += ["        return acc;", "    }", "}"]
+    (mathlib_dir / "Generated.cs").write_text("\n".join(lines) + "\n")
+
+
+def cmd_edit_bench(args):
+    """Time an edit-compile cycle (one method changed) with and without the codegen cache."""
+    header(f"Edit-compile cycle: MultiAssemblyTest + {args.types} types in MathLib")
+    cfg = Path(args.prefix) / "lib/cmake/cil2cpp/cil2cppConfig.cmake"
+    if not cfg.exists():
+        error(f"cil2cppConfig.cmake not found at {cfg} (run: python tools/dev.py install)")
+        return 1
+
+    temp_dir = Path(tempfile.mkdtemp(prefix="cil2cpp_edit_bench_"))
+    for name in ("MultiAssemblyTest", "MathLib"):
+        shutil.copytree(SAMPLES_DIR / name, temp_dir / name, ignore=shutil.ignore_patterns("bin", "obj"))
+    _write_generated_mathlib(temp_dir / "MathLib", args.types)
+    program = temp_dir / "MultiAssemblyTest" / "Program.cs"
+    source = program.read_text()
+    end_of_main = source.rindex("    }")
+    program.write_text(source[:end_of_main]
+                       + "        Console.WriteLine(MathLib.Generated.RunAll(1));\n"
+                       + source[end_of_main:])
+
+    project = temp_dir / "MultiAssemblyTest" / "MultiAssemblyTest.csproj"
+    output = temp_dir / "gen"
+    build = temp_dir / "build"
+    cmake_arch = ["-A", "x64"] if "Visual Studio" in args.generator else []
+    jobs = args.jobs or os.cpu_count() or 1
+
+    def codegen(*extra):
+        start = time.perf_counter()
+        run(["dotnet", "run", "--project", str(CLI_PROJECT), "--", "codegen", "--multi-assembly",
+             "-i", str(project), "-o", str(output), *extra], capture=True)
+        return time.perf_counter() - start
+
+    def native_build():
+        start = time.perf_counter()
+        run(["cmake", "--build", str(build), "--config", "Release", "--parallel", str(jobs)], capture=True)
+        return time.perf_counter() - start
+
+    def snapshot():
+        return {f.name: f.stat().st_mtime_ns for f in output.iterdir() if f.is_file()}
+
+    gen_time = codegen()
+    run(["cmake", "-B", str(build), "-S", str(output), "-G", args.generator, *cmake_arch,
+         f"-DCMAKE_PREFIX_PATH={args.prefix}", "-DCMAKE_BUILD_TYPE=Release"], capture=True)
+    build_time = native_build()
+    print(f"  {'initial build':<20s} codegen {gen_time:6.1f} s{'':22s}native {build_time:7.1f} s")
+
+    # Same edit each cycle (a different constant in one Step method); the full
+    # regeneration cycle touches every file, as codegen did before the cache.
+    edited = args.types // 2
+    cycles = (("incremental", []), ("full regeneration", ["--no-cache"]))
+    for step, (label, extra) in enumerate(cycles, 1):
+        _write_generated_mathlib(temp_dir / "MathLib", args.types, edited, 31 + 2 * step)
+        before = snapshot()
+        gen_time = codegen(*extra)
+        if extra:
+            for f in output.iterdir():
+                if f.is_file() and not f.name.startswith("."):
+                    f.touch()
+        after = snapshot()
+        changed = sum(1 for name, mtime in after.items()
+                      if before.get(name) != mtime and not name.startswith("."))
+        build_time = native_build()
+        print(f"  {label:<20s} codegen {gen_time:6.1f} s  {changed:3d} files rewritten  "
+              f"native {build_time:7.1f} s  total {gen_time + build_time:7.1f} s")
+
+    if args.keep_temp:
+        print(f"  Keeping temp directory: {temp_dir}")
+    else:
+        shutil.rmtree(temp_dir, ignore_errors=True)
+    return 0
+
+
 def _run_coverage():
     """Run compiler + runtime tests with coverage and generate unified report."""
     results_dir = REPO_ROOT / "CoverageResults"
@@ -643,7 +845,9 @@ def cmd_integration(args):
             raise RuntimeError("Counter type not found in header")
 
     def multi_source_has_cross_assembly_calls():
-        src = (multi_output / "MultiAssemblyTest.cpp").read_text(encoding="utf-8", errors="replace")
+        # Method implementations may be split across MultiAssemblyTest_methods_N.cpp
+        src = "".join(f.read_text(encoding="utf-8", errors="replace")
+                      for f in sorted(multi_output.glob("MultiAssemblyTest*.cpp")))
         if "MathLib_MathUtils_Add" not in src:
             raise RuntimeError("Cross-assembly MathUtils_Add call not found")
         if "MathLib_Counter" not in src:
@@ -819,6 +1023,7 @@ def interactive_menu():
         ("Integration tests",     "full pipeline test",      lambda: cmd_integration(argparse.Namespace(prefix=DEFAULT_PREFIX, config="Release", generator=DEFAULT_GENERATOR, keep_temp=False))),
         ("Install runtime",       f"cmake --install → {DEFAULT_PREFIX}", lambda: cmd_install(argparse.Namespace(prefix=DEFAULT_PREFIX, config="both"))),
         ("Codegen HelloWorld",     "quick codegen test",      lambda: cmd_codegen(argparse.Namespace(sample="HelloWorld", input=None, output="output", config="Release"))),
+        ("Run benchmarks",         "runtime micro-benchmarks", lambda: cmd_bench(argparse.Namespace(filter=None, scale=None))),
         ("Setup dev environment",  "check & install tools",   lambda: cmd_setup(argparse.Namespace())),
     ]
 
@@ -896,6 +1101,27 @@ def main():
     p_integ.add_argument("--generator", default=DEFAULT_GENERATOR, help=f"CMake generator (default: {DEFAULT_GENERATOR})")
     p_integ.add_argument("--keep-temp", action="store_true", help="Keep temp directory")
 
+    # bench
+    p_bench = subparsers.add_parser("bench", help="Build and run runtime benchmarks")
+    p_bench.add_argument("filter", nargs="?", help="Only run benchmarks whose name contains this")
+    p_bench.add_argument("--scale", type=float, help="Scale iteration counts (e.g. 0.1 for a quick run)")
+
+    # build-bench
+    p_build_bench = subparsers.add_parser("build-bench", help="Time native builds of a synthetic program (single vs split TUs)")
+    p_build_bench.add_argument("--types", type=int, default=5000, help="Number of generated classes (default: 5000)")
+    p_build_bench.add_argument("--jobs", type=int, help="Parallel build jobs (default: CPU count)")
+    p_build_bench.add_argument("--prefix", default=DEFAULT_PREFIX, help=f"Runtime prefix (default: {DEFAULT_PREFIX})")
+    p_build_bench.add_argument("--generator", default=DEFAULT_GENERATOR, help=f"CMake generator (default: {DEFAULT_GENERATOR})")
+    p_build_bench.add_argument("--keep-temp", action="store_true", help="Keep temp directory")
+
+    # edit-bench
+    p_edit_bench = subparsers.add_parser("edit-bench", help="Time an edit-compile cycle with and without the codegen cache")
+    p_edit_bench.add_argument("--types", type=int, default=2000, help="Classes added to MathLib (default: 2000)")
+    p_edit_bench.add_argument("--jobs", type=int, help="Parallel build jobs (default: CPU count)")
+    p_edit_bench.add_argument("--prefix", default=DEFAULT_PREFIX, help=f"Runtime prefix (default: {DEFAULT_PREFIX})")
+    p_edit_bench.add_argument("--generator", default=DEFAULT_GENERATOR, help=f"CMake generator (default: {DEFAULT_GENERATOR})")
+    p_edit_bench.add_argument("--keep-temp", action="store_true", help="Keep temp directory")
+
     # setup
     subparsers.add_parser("setup", help="Check prerequisites and install optional dev dependencies")
 
@@ -913,6 +1139,12 @@ def main():
         return cmd_codegen(args)
     elif args.command == "integration":
         return cmd_integration(args)
+    elif args.command == "bench":
+        return cmd_bench(args)
+    elif args.command == "build-bench":
+        return cmd_build_bench(args)
+    elif args.command == "edit-bench":
+        return cmd_edit_bench(args)
     elif args.command == "setup":
         return cmd_setup(args)
 